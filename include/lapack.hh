@@ -20,5 +20,14 @@ const char* lapackpp_id();
 }  // namespace lapack
 
 #include "lapack/wrappers.hh"
+#include "lapack/workspace.hh"
+#include "lapack/pivot.hh"
+#include "lapack/parallel.hh"
+#include "lapack/batch.hh"
+#include "lapack/fixed.hh"
+#include "lapack/streaming.hh"
+#include "lapack/update.hh"
+#include "lapack/mixed.hh"
+#include "lapack/factor.hh"
 
 #endif // LAPACK_HH
@@ -0,0 +1,817 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_BATCH_HH
+#define LAPACK_BATCH_HH
+
+#include "lapack/util.hh"
+
+#include <complex>
+
+namespace lapack {
+
+//------------------------------------------------------------------------------
+// Host-parallel batched routines.
+//
+// Each routine applies a LAPACK routine to many independent problems,
+// in parallel over the batch on the LAPACK++ thread pool; see
+// lapack::set_num_threads. Arguments are checked for the whole batch
+// before any problem is solved. Batches come in four forms:
+//
+// - pointer array: same sizes; matrices given by arrays of pointers.
+// - strided: same sizes; matrix i starts at A + i*strideA. For
+//   tridiagonal routines, the vectors of system i start at D + i*strideD.
+// - group: group_count groups; all matrices in group g have sizes m[g],
+//   n[g], etc.; group_size[g] matrices per group, listed consecutively
+//   in the pointer arrays.
+// - interleaved: same sizes; the same element of `lanes` consecutive
+//   matrices is contiguous, so kernels vectorize across the batch.
+//   See batch_interleave and potrf_batch_interleaved.
+
+// -----------------------------------------------------------------------------
+int64_t getrf_batch(
+    int64_t m, int64_t n,
+    float* const* Aarray, int64_t lda,
+    int64_t* const* ipiv_array,
+    int64_t batch_size, int64_t* info );
+
+int64_t getrf_batch(
+    int64_t m, int64_t n,
+    double* const* Aarray, int64_t lda,
+    int64_t* const* ipiv_array,
+    int64_t batch_size, int64_t* info );
+
+int64_t getrf_batch(
+    int64_t m, int64_t n,
+    std::complex<float>* const* Aarray, int64_t lda,
+    int64_t* const* ipiv_array,
+    int64_t batch_size, int64_t* info );
+
+int64_t getrf_batch(
+    int64_t m, int64_t n,
+    std::complex<double>* const* Aarray, int64_t lda,
+    int64_t* const* ipiv_array,
+    int64_t batch_size, int64_t* info );
+
+// strided
+int64_t getrf_batch(
+    int64_t m, int64_t n,
+    float* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    int64_t batch_size, int64_t* info );
+
+int64_t getrf_batch(
+    int64_t m, int64_t n,
+    double* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    int64_t batch_size, int64_t* info );
+
+int64_t getrf_batch(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    int64_t batch_size, int64_t* info );
+
+int64_t getrf_batch(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    int64_t batch_size, int64_t* info );
+
+// group
+int64_t getrf_batch(
+    int64_t group_count, int64_t const* group_size,
+    int64_t const* m, int64_t const* n,
+    float* const* Aarray, int64_t const* lda,
+    int64_t* const* ipiv_array,
+    int64_t* info );
+
+int64_t getrf_batch(
+    int64_t group_count, int64_t const* group_size,
+    int64_t const* m, int64_t const* n,
+    double* const* Aarray, int64_t const* lda,
+    int64_t* const* ipiv_array,
+    int64_t* info );
+
+int64_t getrf_batch(
+    int64_t group_count, int64_t const* group_size,
+    int64_t const* m, int64_t const* n,
+    std::complex<float>* const* Aarray, int64_t const* lda,
+    int64_t* const* ipiv_array,
+    int64_t* info );
+
+int64_t getrf_batch(
+    int64_t group_count, int64_t const* group_size,
+    int64_t const* m, int64_t const* n,
+    std::complex<double>* const* Aarray, int64_t const* lda,
+    int64_t* const* ipiv_array,
+    int64_t* info );
+
+// -----------------------------------------------------------------------------
+void getrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    float const* const* Aarray, int64_t lda,
+    int64_t const* const* ipiv_array,
+    float* const* Barray, int64_t ldb,
+    int64_t batch_size );
+
+void getrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    double const* const* Aarray, int64_t lda,
+    int64_t const* const* ipiv_array,
+    double* const* Barray, int64_t ldb,
+    int64_t batch_size );
+
+void getrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<float> const* const* Aarray, int64_t lda,
+    int64_t const* const* ipiv_array,
+    std::complex<float>* const* Barray, int64_t ldb,
+    int64_t batch_size );
+
+void getrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<double> const* const* Aarray, int64_t lda,
+    int64_t const* const* ipiv_array,
+    std::complex<double>* const* Barray, int64_t ldb,
+    int64_t batch_size );
+
+// strided
+void getrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda, int64_t strideA,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    float* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size );
+
+void getrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda, int64_t strideA,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    double* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size );
+
+void getrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda, int64_t strideA,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size );
+
+void getrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda, int64_t strideA,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size );
+
+// group
+void getrs_batch(
+    int64_t group_count, int64_t const* group_size,
+    lapack::Op const* trans, int64_t const* n, int64_t const* nrhs,
+    float const* const* Aarray, int64_t const* lda,
+    int64_t const* const* ipiv_array,
+    float* const* Barray, int64_t const* ldb );
+
+void getrs_batch(
+    int64_t group_count, int64_t const* group_size,
+    lapack::Op const* trans, int64_t const* n, int64_t const* nrhs,
+    double const* const* Aarray, int64_t const* lda,
+    int64_t const* const* ipiv_array,
+    double* const* Barray, int64_t const* ldb );
+
+void getrs_batch(
+    int64_t group_count, int64_t const* group_size,
+    lapack::Op const* trans, int64_t const* n, int64_t const* nrhs,
+    std::complex<float> const* const* Aarray, int64_t const* lda,
+    int64_t const* const* ipiv_array,
+    std::complex<float>* const* Barray, int64_t const* ldb );
+
+void getrs_batch(
+    int64_t group_count, int64_t const* group_size,
+    lapack::Op const* trans, int64_t const* n, int64_t const* nrhs,
+    std::complex<double> const* const* Aarray, int64_t const* lda,
+    int64_t const* const* ipiv_array,
+    std::complex<double>* const* Barray, int64_t const* ldb );
+
+// -----------------------------------------------------------------------------
+int64_t potrf_batch(
+    lapack::Uplo uplo, int64_t n,
+    float* const* Aarray, int64_t lda,
+    int64_t batch_size, int64_t* info );
+
+int64_t potrf_batch(
+    lapack::Uplo uplo, int64_t n,
+    double* const* Aarray, int64_t lda,
+    int64_t batch_size, int64_t* info );
+
+int64_t potrf_batch(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* const* Aarray, int64_t lda,
+    int64_t batch_size, int64_t* info );
+
+int64_t potrf_batch(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* const* Aarray, int64_t lda,
+    int64_t batch_size, int64_t* info );
+
+int64_t potrf_batch(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, int64_t strideA,
+    int64_t batch_size, int64_t* info );
+
+int64_t potrf_batch(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, int64_t strideA,
+    int64_t batch_size, int64_t* info );
+
+int64_t potrf_batch(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    int64_t batch_size, int64_t* info );
+
+int64_t potrf_batch(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    int64_t batch_size, int64_t* info );
+
+int64_t potrf_batch_interleaved(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lanes,
+    int64_t batch_size, int64_t* info );
+
+int64_t potrf_batch_interleaved(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lanes,
+    int64_t batch_size, int64_t* info );
+
+int64_t potrf_batch_interleaved(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lanes,
+    int64_t batch_size, int64_t* info );
+
+int64_t potrf_batch_interleaved(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lanes,
+    int64_t batch_size, int64_t* info );
+
+// -----------------------------------------------------------------------------
+void potrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* const* Aarray, int64_t lda,
+    float* const* Barray, int64_t ldb,
+    int64_t batch_size );
+
+void potrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* const* Aarray, int64_t lda,
+    double* const* Barray, int64_t ldb,
+    int64_t batch_size );
+
+void potrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* const* Aarray, int64_t lda,
+    std::complex<float>* const* Barray, int64_t ldb,
+    int64_t batch_size );
+
+void potrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* const* Aarray, int64_t lda,
+    std::complex<double>* const* Barray, int64_t ldb,
+    int64_t batch_size );
+
+void potrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda, int64_t strideA,
+    float* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size );
+
+void potrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda, int64_t strideA,
+    double* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size );
+
+void potrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda, int64_t strideA,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size );
+
+void potrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda, int64_t strideA,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size );
+
+void potrs_batch_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, float* B, int64_t lanes,
+    int64_t batch_size );
+
+void potrs_batch_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, double* B, int64_t lanes,
+    int64_t batch_size );
+
+void potrs_batch_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, std::complex<float>* B, int64_t lanes,
+    int64_t batch_size );
+
+void potrs_batch_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, std::complex<double>* B, int64_t lanes,
+    int64_t batch_size );
+
+// -----------------------------------------------------------------------------
+int64_t posv_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* const* Aarray, int64_t lda,
+    float* const* Barray, int64_t ldb,
+    int64_t batch_size, int64_t* info );
+
+int64_t posv_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* const* Aarray, int64_t lda,
+    double* const* Barray, int64_t ldb,
+    int64_t batch_size, int64_t* info );
+
+int64_t posv_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* const* Aarray, int64_t lda,
+    std::complex<float>* const* Barray, int64_t ldb,
+    int64_t batch_size, int64_t* info );
+
+int64_t posv_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* const* Aarray, int64_t lda,
+    std::complex<double>* const* Barray, int64_t ldb,
+    int64_t batch_size, int64_t* info );
+
+int64_t posv_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda, int64_t strideA,
+    float* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size, int64_t* info );
+
+int64_t posv_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda, int64_t strideA,
+    double* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size, int64_t* info );
+
+int64_t posv_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size, int64_t* info );
+
+int64_t posv_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size, int64_t* info );
+
+int64_t posv_batch_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, float* B, int64_t lanes,
+    int64_t batch_size, int64_t* info );
+
+int64_t posv_batch_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, double* B, int64_t lanes,
+    int64_t batch_size, int64_t* info );
+
+int64_t posv_batch_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, std::complex<float>* B, int64_t lanes,
+    int64_t batch_size, int64_t* info );
+
+int64_t posv_batch_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, std::complex<double>* B, int64_t lanes,
+    int64_t batch_size, int64_t* info );
+
+// -----------------------------------------------------------------------------
+void batch_interleave(
+    int64_t m, int64_t n,
+    float const* A, int64_t lda, int64_t strideA,
+    int64_t batch_size,
+    float* Ai, int64_t lanes );
+
+void batch_interleave(
+    int64_t m, int64_t n,
+    double const* A, int64_t lda, int64_t strideA,
+    int64_t batch_size,
+    double* Ai, int64_t lanes );
+
+void batch_interleave(
+    int64_t m, int64_t n,
+    std::complex<float> const* A, int64_t lda, int64_t strideA,
+    int64_t batch_size,
+    std::complex<float>* Ai, int64_t lanes );
+
+void batch_interleave(
+    int64_t m, int64_t n,
+    std::complex<double> const* A, int64_t lda, int64_t strideA,
+    int64_t batch_size,
+    std::complex<double>* Ai, int64_t lanes );
+
+void batch_deinterleave(
+    int64_t m, int64_t n,
+    float const* Ai, int64_t lanes,
+    int64_t batch_size,
+    float* A, int64_t lda, int64_t strideA );
+
+void batch_deinterleave(
+    int64_t m, int64_t n,
+    double const* Ai, int64_t lanes,
+    int64_t batch_size,
+    double* A, int64_t lda, int64_t strideA );
+
+void batch_deinterleave(
+    int64_t m, int64_t n,
+    std::complex<float> const* Ai, int64_t lanes,
+    int64_t batch_size,
+    std::complex<float>* A, int64_t lda, int64_t strideA );
+
+void batch_deinterleave(
+    int64_t m, int64_t n,
+    std::complex<double> const* Ai, int64_t lanes,
+    int64_t batch_size,
+    std::complex<double>* A, int64_t lda, int64_t strideA );
+
+// -----------------------------------------------------------------------------
+void lae2_batch(
+    int64_t batch_size,
+    float const* a, float const* b, float const* c,
+    float* rt1, float* rt2 );
+
+void lae2_batch(
+    int64_t batch_size,
+    double const* a, double const* b, double const* c,
+    double* rt1, double* rt2 );
+
+void laev2_batch(
+    int64_t batch_size,
+    float const* a, float const* b, float const* c,
+    float* rt1,
+    float* rt2,
+    float* cs1,
+    float* sn1 );
+
+void laev2_batch(
+    int64_t batch_size,
+    double const* a, double const* b, double const* c,
+    double* rt1,
+    double* rt2,
+    double* cs1,
+    double* sn1 );
+
+void laev2_batch(
+    int64_t batch_size,
+    std::complex<float> const* a, std::complex<float> const* b, std::complex<float> const* c,
+    float* rt1,
+    float* rt2,
+    float* cs1,
+    std::complex<float>* sn1 );
+
+void laev2_batch(
+    int64_t batch_size,
+    std::complex<double> const* a, std::complex<double> const* b, std::complex<double> const* c,
+    double* rt1,
+    double* rt2,
+    double* cs1,
+    std::complex<double>* sn1 );
+
+// -----------------------------------------------------------------------------
+int64_t heev_small_batch(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, int64_t strideA,
+    float* W, int64_t strideW,
+    int64_t batch_size, int64_t* info );
+
+int64_t heev_small_batch(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, int64_t strideA,
+    double* W, int64_t strideW,
+    int64_t batch_size, int64_t* info );
+
+int64_t heev_small_batch(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    float* W, int64_t strideW,
+    int64_t batch_size, int64_t* info );
+
+int64_t heev_small_batch(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    double* W, int64_t strideW,
+    int64_t batch_size, int64_t* info );
+
+// -----------------------------------------------------------------------------
+int64_t gtsv_batch(
+    int64_t n, int64_t nrhs,
+    float* DL, float* D, float* DU, int64_t strideD,
+    float* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size, int64_t* info );
+
+int64_t gtsv_batch(
+    int64_t n, int64_t nrhs,
+    double* DL, double* D, double* DU, int64_t strideD,
+    double* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size, int64_t* info );
+
+int64_t gtsv_batch(
+    int64_t n, int64_t nrhs,
+    std::complex<float>* DL, std::complex<float>* D, std::complex<float>* DU, int64_t strideD,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size, int64_t* info );
+
+int64_t gtsv_batch(
+    int64_t n, int64_t nrhs,
+    std::complex<double>* DL, std::complex<double>* D, std::complex<double>* DU, int64_t strideD,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size, int64_t* info );
+
+// interleaved
+int64_t gtsv_batch_interleaved(
+    int64_t n, int64_t nrhs,
+    float* DL, float* D, float* DU,
+    float* B, int64_t lanes,
+    int64_t batch_size, int64_t* info );
+
+int64_t gtsv_batch_interleaved(
+    int64_t n, int64_t nrhs,
+    double* DL, double* D, double* DU,
+    double* B, int64_t lanes,
+    int64_t batch_size, int64_t* info );
+
+int64_t gtsv_batch_interleaved(
+    int64_t n, int64_t nrhs,
+    std::complex<float>* DL, std::complex<float>* D, std::complex<float>* DU,
+    std::complex<float>* B, int64_t lanes,
+    int64_t batch_size, int64_t* info );
+
+int64_t gtsv_batch_interleaved(
+    int64_t n, int64_t nrhs,
+    std::complex<double>* DL, std::complex<double>* D, std::complex<double>* DU,
+    std::complex<double>* B, int64_t lanes,
+    int64_t batch_size, int64_t* info );
+
+// -----------------------------------------------------------------------------
+int64_t gttrf_batch(
+    int64_t n,
+    float* DL, float* D, float* DU, float* DU2, int64_t strideD,
+    int64_t* ipiv,
+    int64_t batch_size, int64_t* info );
+
+int64_t gttrf_batch(
+    int64_t n,
+    double* DL, double* D, double* DU, double* DU2, int64_t strideD,
+    int64_t* ipiv,
+    int64_t batch_size, int64_t* info );
+
+int64_t gttrf_batch(
+    int64_t n,
+    std::complex<float>* DL, std::complex<float>* D, std::complex<float>* DU, std::complex<float>* DU2, int64_t strideD,
+    int64_t* ipiv,
+    int64_t batch_size, int64_t* info );
+
+int64_t gttrf_batch(
+    int64_t n,
+    std::complex<double>* DL, std::complex<double>* D, std::complex<double>* DU, std::complex<double>* DU2, int64_t strideD,
+    int64_t* ipiv,
+    int64_t batch_size, int64_t* info );
+
+// interleaved
+int64_t gttrf_batch_interleaved(
+    int64_t n,
+    float* DL, float* D, float* DU, float* DU2,
+    int64_t* ipiv, int64_t lanes,
+    int64_t batch_size, int64_t* info );
+
+int64_t gttrf_batch_interleaved(
+    int64_t n,
+    double* DL, double* D, double* DU, double* DU2,
+    int64_t* ipiv, int64_t lanes,
+    int64_t batch_size, int64_t* info );
+
+int64_t gttrf_batch_interleaved(
+    int64_t n,
+    std::complex<float>* DL, std::complex<float>* D, std::complex<float>* DU, std::complex<float>* DU2,
+    int64_t* ipiv, int64_t lanes,
+    int64_t batch_size, int64_t* info );
+
+int64_t gttrf_batch_interleaved(
+    int64_t n,
+    std::complex<double>* DL, std::complex<double>* D, std::complex<double>* DU, std::complex<double>* DU2,
+    int64_t* ipiv, int64_t lanes,
+    int64_t batch_size, int64_t* info );
+
+// -----------------------------------------------------------------------------
+void gttrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    float const* DL, float const* D, float const* DU, float const* DU2, int64_t strideD,
+    int64_t const* ipiv,
+    float* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size );
+
+void gttrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    double const* DL, double const* D, double const* DU, double const* DU2, int64_t strideD,
+    int64_t const* ipiv,
+    double* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size );
+
+void gttrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<float> const* DL, std::complex<float> const* D, std::complex<float> const* DU, std::complex<float> const* DU2, int64_t strideD,
+    int64_t const* ipiv,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size );
+
+void gttrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<double> const* DL, std::complex<double> const* D, std::complex<double> const* DU, std::complex<double> const* DU2, int64_t strideD,
+    int64_t const* ipiv,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size );
+
+// interleaved
+void gttrs_batch_interleaved(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    float const* DL, float const* D, float const* DU, float const* DU2,
+    int64_t const* ipiv,
+    float* B, int64_t lanes,
+    int64_t batch_size );
+
+void gttrs_batch_interleaved(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    double const* DL, double const* D, double const* DU, double const* DU2,
+    int64_t const* ipiv,
+    double* B, int64_t lanes,
+    int64_t batch_size );
+
+void gttrs_batch_interleaved(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<float> const* DL, std::complex<float> const* D, std::complex<float> const* DU, std::complex<float> const* DU2,
+    int64_t const* ipiv,
+    std::complex<float>* B, int64_t lanes,
+    int64_t batch_size );
+
+void gttrs_batch_interleaved(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<double> const* DL, std::complex<double> const* D, std::complex<double> const* DU, std::complex<double> const* DU2,
+    int64_t const* ipiv,
+    std::complex<double>* B, int64_t lanes,
+    int64_t batch_size );
+
+// -----------------------------------------------------------------------------
+int64_t ptsv_batch(
+    int64_t n, int64_t nrhs,
+    float* D, float* E, int64_t strideD,
+    float* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size, int64_t* info );
+
+int64_t ptsv_batch(
+    int64_t n, int64_t nrhs,
+    double* D, double* E, int64_t strideD,
+    double* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size, int64_t* info );
+
+int64_t ptsv_batch(
+    int64_t n, int64_t nrhs,
+    float* D, std::complex<float>* E, int64_t strideD,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size, int64_t* info );
+
+int64_t ptsv_batch(
+    int64_t n, int64_t nrhs,
+    double* D, std::complex<double>* E, int64_t strideD,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size, int64_t* info );
+
+// interleaved
+int64_t ptsv_batch_interleaved(
+    int64_t n, int64_t nrhs,
+    float* D, float* E,
+    float* B, int64_t lanes,
+    int64_t batch_size, int64_t* info );
+
+int64_t ptsv_batch_interleaved(
+    int64_t n, int64_t nrhs,
+    double* D, double* E,
+    double* B, int64_t lanes,
+    int64_t batch_size, int64_t* info );
+
+int64_t ptsv_batch_interleaved(
+    int64_t n, int64_t nrhs,
+    float* D, std::complex<float>* E,
+    std::complex<float>* B, int64_t lanes,
+    int64_t batch_size, int64_t* info );
+
+int64_t ptsv_batch_interleaved(
+    int64_t n, int64_t nrhs,
+    double* D, std::complex<double>* E,
+    std::complex<double>* B, int64_t lanes,
+    int64_t batch_size, int64_t* info );
+
+// -----------------------------------------------------------------------------
+int64_t pttrf_batch(
+    int64_t n,
+    float* D, float* E, int64_t strideD,
+    int64_t batch_size, int64_t* info );
+
+int64_t pttrf_batch(
+    int64_t n,
+    double* D, double* E, int64_t strideD,
+    int64_t batch_size, int64_t* info );
+
+int64_t pttrf_batch(
+    int64_t n,
+    float* D, std::complex<float>* E, int64_t strideD,
+    int64_t batch_size, int64_t* info );
+
+int64_t pttrf_batch(
+    int64_t n,
+    double* D, std::complex<double>* E, int64_t strideD,
+    int64_t batch_size, int64_t* info );
+
+// interleaved
+int64_t pttrf_batch_interleaved(
+    int64_t n,
+    float* D, float* E, int64_t lanes,
+    int64_t batch_size, int64_t* info );
+
+int64_t pttrf_batch_interleaved(
+    int64_t n,
+    double* D, double* E, int64_t lanes,
+    int64_t batch_size, int64_t* info );
+
+int64_t pttrf_batch_interleaved(
+    int64_t n,
+    float* D, std::complex<float>* E, int64_t lanes,
+    int64_t batch_size, int64_t* info );
+
+int64_t pttrf_batch_interleaved(
+    int64_t n,
+    double* D, std::complex<double>* E, int64_t lanes,
+    int64_t batch_size, int64_t* info );
+
+// -----------------------------------------------------------------------------
+void pttrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* D, float const* E, int64_t strideD,
+    float* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size );
+
+void pttrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* D, double const* E, int64_t strideD,
+    double* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size );
+
+void pttrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* D, std::complex<float> const* E, int64_t strideD,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size );
+
+void pttrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* D, std::complex<double> const* E, int64_t strideD,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size );
+
+// interleaved
+void pttrs_batch_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* D, float const* E,
+    float* B, int64_t lanes,
+    int64_t batch_size );
+
+void pttrs_batch_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* D, double const* E,
+    double* B, int64_t lanes,
+    int64_t batch_size );
+
+void pttrs_batch_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* D, std::complex<float> const* E,
+    std::complex<float>* B, int64_t lanes,
+    int64_t batch_size );
+
+void pttrs_batch_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* D, std::complex<double> const* E,
+    std::complex<double>* B, int64_t lanes,
+    int64_t batch_size );
+
+}  // namespace lapack
+
+#endif // LAPACK_BATCH_HH
@@ -0,0 +1,320 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_FACTOR_HH
+#define LAPACK_FACTOR_HH
+
+#include "lapack/util.hh"
+
+#include <vector>
+
+namespace lapack {
+
+//------------------------------------------------------------------------------
+// Factorization objects.
+//
+// Each class factors a matrix once, then solves with it any number of
+// times. It owns a copy of the factors, the pivots, and the workspace
+// that solve needs, so repeated solves do no allocation, and it caches
+// the norm of A and the reciprocal condition number, estimated once
+// when A is factored. factor() refactors a new matrix of the same size,
+// reusing the storage.
+//
+// Numerical failures are reported as in the LAPACK routines: factor()
+// and the constructor set info() > 0, e.g., for an exactly singular U,
+// and solve() and inverse() then return info() without computing
+// anything. Invalid arguments throw lapack::Error.
+//
+// All are instantiated for
+// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+
+//------------------------------------------------------------------------------
+/// LU factorization with partial pivoting, $A = P L U$, of an n-by-n
+/// matrix, by lapack::getrf.
+///
+/// solve and inverse use only the factors, so they may be called
+/// concurrently on the same object.
+///
+/// Example:
+///
+///     lapack::LU< double > lu( n, A, lda );
+///     if (lu.rcond() < tol)
+///         throw std::runtime_error( "ill-conditioned" );
+///     while (receive( b ))
+///         lu.solve( 1, b, n );
+///
+template <typename scalar_t>
+class LU
+{
+public:
+    using real_t = blas::real_type< scalar_t >;
+
+    LU( int64_t n, scalar_t const* A, int64_t lda );
+
+    int64_t factor( scalar_t const* A, int64_t lda );
+
+    int64_t solve( int64_t nrhs, scalar_t* B, int64_t ldb,
+                   lapack::Op trans=lapack::Op::NoTrans ) const;
+
+    int64_t inverse( scalar_t* Ainv, int64_t ldainv ) const;
+
+    scalar_t det() const;
+
+    int64_t n() const { return n_; }
+
+    /// Status of the factorization: 0, or i > 0 if U(i,i) is exactly
+    /// zero, as returned by getrf.
+    int64_t info() const { return info_; }
+
+    /// One-norm of A.
+    real_t anorm() const { return anorm_; }
+
+    /// Estimate of the reciprocal condition number of A in the one-norm,
+    /// from gecon; 0 if A is singular.
+    real_t rcond() const { return rcond_; }
+
+    /// Factors L and U, n-by-n, stored with leading dimension n.
+    scalar_t const* factors() const { return LU_.data(); }
+
+    /// Pivot indices, 1-based, as returned by getrf.
+    lapack_int const* ipiv() const { return ipiv_.data(); }
+
+private:
+    int64_t n_;
+    int64_t info_;
+    real_t anorm_;
+    real_t rcond_;
+    std::vector< scalar_t > LU_;
+    std::vector< lapack_int > ipiv_;
+};
+
+//------------------------------------------------------------------------------
+/// Cholesky factorization of an n-by-n Hermitian positive definite
+/// matrix, $A = U^H U$ or $A = L L^H$, by lapack::potrf. Only the uplo
+/// triangle of A is referenced.
+///
+/// solve and inverse use only the factor, so they may be called
+/// concurrently on the same object.
+///
+template <typename scalar_t>
+class Cholesky
+{
+public:
+    using real_t = blas::real_type< scalar_t >;
+
+    Cholesky( lapack::Uplo uplo, int64_t n, scalar_t const* A, int64_t lda );
+
+    int64_t factor( scalar_t const* A, int64_t lda );
+
+    int64_t solve( int64_t nrhs, scalar_t* B, int64_t ldb ) const;
+
+    int64_t inverse( scalar_t* Ainv, int64_t ldainv ) const;
+
+    real_t det() const;
+
+    lapack::Uplo uplo() const { return uplo_; }
+    int64_t n() const { return n_; }
+
+    /// Status of the factorization: 0, or i > 0 if the leading minor of
+    /// order i is not positive definite, as returned by potrf.
+    int64_t info() const { return info_; }
+
+    /// One-norm of A.
+    real_t anorm() const { return anorm_; }
+
+    /// Estimate of the reciprocal condition number of A in the one-norm,
+    /// from pocon; 0 if A is not positive definite.
+    real_t rcond() const { return rcond_; }
+
+    /// Factor U or L in the uplo triangle, n-by-n, stored with leading
+    /// dimension n; the other triangle is zero.
+    scalar_t const* factors() const { return F_.data(); }
+
+private:
+    lapack::Uplo uplo_;
+    int64_t n_;
+    int64_t info_;
+    real_t anorm_;
+    real_t rcond_;
+    std::vector< scalar_t > F_;
+};
+
+//------------------------------------------------------------------------------
+/// QR factorization, $A = Q R$, of an m-by-n matrix with m >= n,
+/// by lapack::geqrf. solve computes the least squares solution;
+/// inverse requires m == n.
+///
+/// Q is applied by lapack::unmqr, to blocks of right-hand sides, with
+/// workspace owned by the object, so solve and inverse are not const:
+/// concurrent calls on the same object must be serialized.
+///
+template <typename scalar_t>
+class QR
+{
+public:
+    using real_t = blas::real_type< scalar_t >;
+
+    QR( int64_t m, int64_t n, scalar_t const* A, int64_t lda );
+
+    int64_t factor( scalar_t const* A, int64_t lda );
+
+    int64_t solve( int64_t nrhs, scalar_t* B, int64_t ldb );
+
+    int64_t inverse( scalar_t* Ainv, int64_t ldainv );
+
+    scalar_t det() const;
+
+    int64_t m() const { return m_; }
+    int64_t n() const { return n_; }
+
+    /// Status of the factorization: 0, or i > 0 if R(i,i) is exactly
+    /// zero, so A does not have full rank.
+    int64_t info() const { return info_; }
+
+    /// One-norm of A.
+    real_t anorm() const { return anorm_; }
+
+    /// Estimate of the reciprocal condition number of R in the one-norm,
+    /// from trcon; 0 if R is singular. R has the same 2-norm condition
+    /// number as A.
+    real_t rcond() const { return rcond_; }
+
+    /// Householder vectors and R, m-by-n, stored with leading dimension m,
+    /// as returned by geqrf.
+    scalar_t const* factors() const { return QR_.data(); }
+
+    /// Householder scalars, as returned by geqrf.
+    scalar_t const* tau() const { return tau_.data(); }
+
+private:
+    int64_t m_;
+    int64_t n_;
+    int64_t info_;
+    real_t anorm_;
+    real_t rcond_;
+    std::vector< scalar_t > QR_;
+    std::vector< scalar_t > tau_;
+    std::vector< scalar_t > work_;
+};
+
+//------------------------------------------------------------------------------
+/// Bunch-Kaufman factorization of an n-by-n Hermitian indefinite matrix,
+/// $A = U D U^H$ or $A = L D L^H$, by lapack::hetrf, where D is
+/// Hermitian block diagonal with 1-by-1 and 2-by-2 blocks. For real
+/// matrices, this is sytrf, $A = L D L^T$. Only the uplo triangle of A
+/// is referenced.
+///
+/// solve and inverse use only the factors, so they may be called
+/// concurrently on the same object.
+///
+template <typename scalar_t>
+class LDLT
+{
+public:
+    using real_t = blas::real_type< scalar_t >;
+
+    LDLT( lapack::Uplo uplo, int64_t n, scalar_t const* A, int64_t lda );
+
+    int64_t factor( scalar_t const* A, int64_t lda );
+
+    int64_t solve( int64_t nrhs, scalar_t* B, int64_t ldb ) const;
+
+    int64_t inverse( scalar_t* Ainv, int64_t ldainv ) const;
+
+    real_t det() const;
+
+    lapack::Uplo uplo() const { return uplo_; }
+    int64_t n() const { return n_; }
+
+    /// Status of the factorization: 0, or i > 0 if D(i,i) is exactly
+    /// zero, as returned by hetrf.
+    int64_t info() const { return info_; }
+
+    /// One-norm of A.
+    real_t anorm() const { return anorm_; }
+
+    /// Estimate of the reciprocal condition number of A in the one-norm,
+    /// from hecon; 0 if A is singular.
+    real_t rcond() const { return rcond_; }
+
+    /// Factors D and U or L, n-by-n, stored with leading dimension n,
+    /// as returned by hetrf.
+    scalar_t const* factors() const { return F_.data(); }
+
+    /// Pivot indices, 1-based, as returned by hetrf.
+    lapack_int const* ipiv() const { return ipiv_.data(); }
+
+private:
+    lapack::Uplo uplo_;
+    int64_t n_;
+    int64_t info_;
+    real_t anorm_;
+    real_t rcond_;
+    std::vector< scalar_t > F_;
+    std::vector< lapack_int > ipiv_;
+};
+
+//------------------------------------------------------------------------------
+/// Eigendecomposition of an n-by-n Hermitian matrix, $A = Z \Lambda Z^H$,
+/// by lapack::heevd. Only the uplo triangle of A is referenced.
+/// solve and inverse apply $A^{-1} = Z \Lambda^{-1} Z^H$. It costs
+/// several times an LDLT factorization, but gives the exact 2-norm
+/// condition number and the inertia of A.
+///
+/// solve and inverse work on blocks of right-hand sides, with workspace
+/// owned by the object, so they are not const: concurrent calls on the
+/// same object must be serialized.
+///
+template <typename scalar_t>
+class SymEig
+{
+public:
+    using real_t = blas::real_type< scalar_t >;
+
+    SymEig( lapack::Uplo uplo, int64_t n, scalar_t const* A, int64_t lda );
+
+    int64_t factor( scalar_t const* A, int64_t lda );
+
+    int64_t solve( int64_t nrhs, scalar_t* B, int64_t ldb );
+
+    int64_t inverse( scalar_t* Ainv, int64_t ldainv );
+
+    real_t det() const;
+
+    lapack::Uplo uplo() const { return uplo_; }
+    int64_t n() const { return n_; }
+
+    /// Status of the factorization: 0, or i > 0 if heevd failed to
+    /// converge; or n+1 if an eigenvalue is exactly zero, so A is
+    /// singular.
+    int64_t info() const { return info_; }
+
+    /// Two-norm of A, max | lambda_i |.
+    real_t anorm() const { return anorm_; }
+
+    /// Reciprocal condition number of A in the two-norm,
+    /// min | lambda_i | / max | lambda_i |.
+    real_t rcond() const { return rcond_; }
+
+    /// Eigenvalues, in ascending order.
+    real_t const* W() const { return W_.data(); }
+
+    /// Orthonormal eigenvectors, n-by-n, stored with leading dimension n.
+    scalar_t const* Z() const { return Z_.data(); }
+
+private:
+    lapack::Uplo uplo_;
+    int64_t n_;
+    int64_t info_;
+    real_t anorm_;
+    real_t rcond_;
+    std::vector< real_t > W_;
+    std::vector< scalar_t > Z_;
+    std::vector< scalar_t > work_;
+};
+
+}  // namespace lapack
+
+#endif // LAPACK_FACTOR_HH
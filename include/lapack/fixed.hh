@@ -0,0 +1,678 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_FIXED_HH
+#define LAPACK_FIXED_HH
+
+#include "lapack/util.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace lapack {
+
+//------------------------------------------------------------------------------
+// Compile-time fixed-size kernels for tiny matrices, N <= 16.
+//
+// These are header-only and fully inlineable: sizes are template
+// parameters, all loops over them are unrolled at compile time, and the
+// only storage is a copy of the matrix on the stack. There is no
+// to_lapack_int check, no pivot conversion, and no Fortran call.
+//
+// Numerics follow the reference LAPACK algorithms behind lapack::getrf,
+// potrf, and geqrf: the same pivot choice, zero-pivot and
+// non-positive-definite info, reciprocal scaling, and Householder
+// convention. Results agree with the generic routines to rounding; they
+// are not bitwise identical, since the generic routines use blocked or
+// recursive variants.
+//
+// Example:
+//
+//     double A[ 3*3 ] = { ... };
+//     int64_t ipiv[ 3 ];
+//     int64_t info = lapack::fixed::getrf< 3 >( A, 3, ipiv );
+//     lapack::fixed::getrs< 3 >( Op::NoTrans, 1, A, 3, ipiv, b, 3 );
+
+namespace fixed {
+
+/// Largest size supported by the fixed-size kernels.
+constexpr int max_size = 16;
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Calls f( std::integral_constant< int, i >() ) for i = begin, ..., end-1.
+/// Since i is a type, it can be used in constant expressions inside f,
+/// including as the bound of a nested static_for.
+template <int begin, int end, typename F>
+inline void static_for( F&& f )
+{
+    if constexpr (begin < end) {
+        f( std::integral_constant< int, begin >() );
+        static_for< begin + 1, end >( f );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// |Re(x)| + |Im(x)|, as used by LAPACK's i[cz]amax for pivot selection.
+template <typename real_t>
+inline real_t cabs1( real_t x )
+{
+    return std::abs( x );
+}
+
+template <typename real_t>
+inline real_t cabs1( std::complex< real_t > x )
+{
+    return std::abs( real( x ) ) + std::abs( imag( x ) );
+}
+
+//------------------------------------------------------------------------------
+/// Conjugate that keeps real types real, unlike std::conj.
+template <typename real_t>
+inline real_t conj( real_t x )
+{
+    return x;
+}
+
+template <typename real_t>
+inline std::complex< real_t > conj( std::complex< real_t > x )
+{
+    return std::conj( x );
+}
+
+//------------------------------------------------------------------------------
+/// 2-norm of x( begin : end-1 ), scaled by the largest |Re| or |Im| so
+/// the sum of squares cannot overflow or underflow, as in nrm2.
+template <int begin, int end, typename scalar_t>
+inline blas::real_type< scalar_t > nrm2( scalar_t const* x )
+{
+    using real_t = blas::real_type< scalar_t >;
+    real_t scale = 0;
+    static_for< begin, end >( [&]( auto i ) {
+        scale = std::max( scale, std::max( std::abs( std::real( x[ i ] ) ),
+                                           std::abs( std::imag( x[ i ] ) ) ) );
+    });
+    if (scale == 0 || std::isinf( scale ))
+        return scale;
+
+    real_t ssq = 0;
+    static_for< begin, end >( [&]( auto i ) {
+        real_t re = std::real( x[ i ] ) / scale;
+        real_t im = std::imag( x[ i ] ) / scale;
+        ssq += re*re + im*im;
+    });
+    return scale * std::sqrt( ssq );
+}
+
+//------------------------------------------------------------------------------
+/// sqrt( x^2 + y^2 + z^2 ), avoiding unnecessary overflow and underflow,
+/// as in lapy3.
+template <typename real_t>
+inline real_t lapy3( real_t x, real_t y, real_t z )
+{
+    real_t xabs = std::abs( x );
+    real_t yabs = std::abs( y );
+    real_t zabs = std::abs( z );
+    real_t w = std::max( xabs, std::max( yabs, zabs ) );
+    if (w == 0 || std::isinf( w ))
+        return xabs + yabs + zabs;
+
+    xabs /= w;
+    yabs /= w;
+    zabs /= w;
+    return w * std::sqrt( xabs*xabs + yabs*yabs + zabs*zabs );
+}
+
+//------------------------------------------------------------------------------
+/// Copies m-by-n A( lda ) into, or out of, packed a( m ) on the stack.
+template <int m, int n, typename scalar_t>
+inline void load( scalar_t const* A, int64_t lda, scalar_t* a )
+{
+    static_for< 0, n >( [&]( auto j ) {
+        static_for< 0, m >( [&]( auto i ) {
+            a[ i + j*m ] = A[ i + j*lda ];
+        });
+    });
+}
+
+template <int m, int n, typename scalar_t>
+inline void store( scalar_t const* a, scalar_t* A, int64_t lda )
+{
+    static_for< 0, n >( [&]( auto j ) {
+        static_for< 0, m >( [&]( auto i ) {
+            A[ i + j*lda ] = a[ i + j*m ];
+        });
+    });
+}
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+/// Computes an LU factorization of an N-by-N matrix A using partial
+/// pivoting with row interchanges; fixed-size version of lapack::getrf.
+/// \[
+///     A = P L U,
+/// \]
+/// where P is a permutation matrix, L is unit lower triangular, and U is
+/// upper triangular. As in LAPACK, the pivot is the first element of
+/// largest |Re| + |Im| in the column, and a zero pivot sets info but
+/// does not stop the factorization.
+///
+/// Generic in the scalar type and the pivot integer type.
+///
+/// @tparam N
+///     The order of the matrix A. 0 <= N <= 16.
+///
+/// @param[in,out] A
+///     The N-by-N matrix A, stored in an lda-by-N array.
+///     On exit, the factors L and U; the unit diagonal of L is not stored.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,N).
+///
+/// @param[out] ipiv
+///     The pivot indices, of length N; for 1 <= i <= N, row i of the
+///     matrix was interchanged with row ipiv(i).
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, U(i,i) is exactly zero.
+///
+/// @ingroup gesv_computational
+template <int N, typename scalar_t, typename pivot_t>
+inline int64_t getrf( scalar_t* A, int64_t lda, pivot_t* ipiv )
+{
+    static_assert( 0 <= N && N <= max_size, "fixed::getrf requires N <= 16" );
+    using real_t = blas::real_type< scalar_t >;
+    using internal::static_for;
+    lapack_error_if( lda < std::max( 1, N ) );
+
+    const real_t sfmin = std::numeric_limits< real_t >::min();
+
+    scalar_t a[ N*N > 0 ? N*N : 1 ];
+    internal::load< N, N >( A, lda, a );
+
+    int64_t info = 0;
+    static_for< 0, N >( [&]( auto j ) {
+        // Find pivot: first element of max |Re| + |Im| in column j.
+        int p = j;
+        real_t amax = internal::cabs1( a[ j + j*N ] );
+        static_for< j + 1, N >( [&]( auto i ) {
+            real_t aij = internal::cabs1( a[ i + j*N ] );
+            if (aij > amax) {
+                amax = aij;
+                p = i;
+            }
+        });
+        ipiv[ j ] = pivot_t( p + 1 );
+
+        if (a[ p + j*N ] != scalar_t( 0 )) {
+            // Interchange rows j and p across the whole matrix.
+            if (p != j) {
+                static_for< 0, N >( [&]( auto k ) {
+                    std::swap( a[ j + k*N ], a[ p + k*N ] );
+                });
+            }
+
+            // Compute elements j+1:N of column j, by reciprocal if it is
+            // safe, as LAPACK does.
+            scalar_t ajj = a[ j + j*N ];
+            if (std::abs( ajj ) >= sfmin) {
+                scalar_t rcp = scalar_t( 1 ) / ajj;
+                static_for< j + 1, N >( [&]( auto i ) {
+                    a[ i + j*N ] *= rcp;
+                });
+            }
+            else {
+                static_for< j + 1, N >( [&]( auto i ) {
+                    a[ i + j*N ] /= ajj;
+                });
+            }
+        }
+        else if (info == 0) {
+            // Whole column is zero; no interchange or scaling needed.
+            info = j + 1;
+        }
+
+        // Update trailing submatrix.
+        static_for< j + 1, N >( [&]( auto k ) {
+            scalar_t ajk = a[ j + k*N ];
+            static_for< j + 1, N >( [&]( auto i ) {
+                a[ i + k*N ] -= a[ i + j*N ] * ajk;
+            });
+        });
+    });
+
+    internal::store< N, N >( a, A, lda );
+    return info;
+}
+
+//------------------------------------------------------------------------------
+/// Solves a system of linear equations
+///     A X = B,
+///     A^T X = B, or
+///     A^H X = B,
+/// with an N-by-N matrix A using the LU factorization computed by
+/// lapack::fixed::getrf (or lapack::getrf); fixed-size version of
+/// lapack::getrs.
+///
+/// Generic in the scalar type and the pivot integer type.
+///
+/// @tparam N
+///     The order of the matrix A. 0 <= N <= 16.
+///
+/// @param[in] trans
+///     The form of the system of equations:
+///     - lapack::Op::NoTrans:   \f$ A   X = B \f$ (No transpose)
+///     - lapack::Op::Trans:     \f$ A^T X = B \f$ (Transpose)
+///     - lapack::Op::ConjTrans: \f$ A^H X = B \f$ (Conjugate transpose)
+///
+/// @param[in] nrhs
+///     The number of right hand sides, i.e., the number of columns of
+///     the matrix B. nrhs >= 0.
+///
+/// @param[in] A
+///     The factors L and U from the factorization A = P*L*U,
+///     stored in an lda-by-N array.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,N).
+///
+/// @param[in] ipiv
+///     The pivot indices from getrf, of length N.
+///
+/// @param[in,out] B
+///     The N-by-nrhs matrix B, stored in an ldb-by-nrhs array.
+///     On entry, the right hand side matrix B.
+///     On exit, the solution matrix X.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B. ldb >= max(1,N).
+///
+/// @return = 0: successful exit
+///
+/// @ingroup gesv_computational
+template <int N, typename scalar_t, typename pivot_t>
+inline int64_t getrs(
+    lapack::Op trans, int64_t nrhs,
+    scalar_t const* A, int64_t lda,
+    pivot_t const* ipiv,
+    scalar_t* B, int64_t ldb )
+{
+    static_assert( 0 <= N && N <= max_size, "fixed::getrs requires N <= 16" );
+    using internal::static_for;
+    lapack_error_if( trans != Op::NoTrans &&
+                     trans != Op::Trans &&
+                     trans != Op::ConjTrans );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( lda < std::max( 1, N ) );
+    lapack_error_if( ldb < std::max( 1, N ) );
+
+    scalar_t a[ N*N > 0 ? N*N : 1 ];
+    internal::load< N, N >( A, lda, a );
+    bool conj = (trans == Op::ConjTrans);
+    auto op = [conj]( scalar_t x ) {
+        return conj ? internal::conj( x ) : x;
+    };
+
+    for (int64_t c = 0; c < nrhs; ++c) {
+        scalar_t b[ N > 0 ? N : 1 ];
+        internal::load< N, 1 >( &B[ c*ldb ], ldb, b );
+
+        if (trans == Op::NoTrans) {
+            // Apply row interchanges, then solve L Y = P^T B, U X = Y.
+            static_for< 0, N >( [&]( auto i ) {
+                int p = int( ipiv[ i ] ) - 1;
+                if (p != i)
+                    std::swap( b[ i ], b[ p ] );
+            });
+            static_for< 0, N >( [&]( auto k ) {
+                static_for< k + 1, N >( [&]( auto i ) {
+                    b[ i ] -= a[ i + k*N ] * b[ k ];
+                });
+            });
+            static_for< 0, N >( [&]( auto kk ) {
+                constexpr int k = N - 1 - kk;
+                b[ k ] /= a[ k + k*N ];
+                static_for< 0, k >( [&]( auto i ) {
+                    b[ i ] -= a[ i + k*N ] * b[ k ];
+                });
+            });
+        }
+        else {
+            // Solve U^T Y = B, L^T Z = Y, then apply interchanges in
+            // reverse order, X = P Z. (Conjugated for ConjTrans.)
+            static_for< 0, N >( [&]( auto i ) {
+                static_for< 0, i >( [&]( auto k ) {
+                    b[ i ] -= op( a[ k + i*N ] ) * b[ k ];
+                });
+                b[ i ] /= op( a[ i + i*N ] );
+            });
+            static_for< 0, N >( [&]( auto ii ) {
+                constexpr int i = N - 1 - ii;
+                static_for< i + 1, N >( [&]( auto k ) {
+                    b[ i ] -= op( a[ k + i*N ] ) * b[ k ];
+                });
+            });
+            static_for< 0, N >( [&]( auto ii ) {
+                constexpr int i = N - 1 - ii;
+                int p = int( ipiv[ i ] ) - 1;
+                if (p != i)
+                    std::swap( b[ i ], b[ p ] );
+            });
+        }
+
+        internal::store< N, 1 >( b, &B[ c*ldb ], ldb );
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+/// Computes the Cholesky factorization of an N-by-N Hermitian positive
+/// definite matrix A; fixed-size version of lapack::potrf.
+/// \[
+///     A = U^H U \text{ or } A = L L^H.
+/// \]
+/// As in LAPACK, only the real part of the diagonal is used, and the
+/// factorization stops at the first non-positive (or NaN) pivot.
+///
+/// @tparam N
+///     The order of the matrix A. 0 <= N <= 16.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: Upper triangle of A is stored;
+///     - lapack::Uplo::Lower: Lower triangle of A is stored.
+///
+/// @param[in,out] A
+///     The N-by-N matrix A, stored in an lda-by-N array.
+///     On successful exit, the factor U or L, in the triangle given by
+///     uplo; the other triangle is not referenced.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,N).
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, the leading minor of order i is not
+///     positive definite, and the factorization could not be completed.
+///
+/// @ingroup posv_computational
+template <int N, typename scalar_t>
+inline int64_t potrf( lapack::Uplo uplo, scalar_t* A, int64_t lda )
+{
+    static_assert( 0 <= N && N <= max_size, "fixed::potrf requires N <= 16" );
+    using real_t = blas::real_type< scalar_t >;
+    using internal::static_for;
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( lda < std::max( 1, N ) );
+
+    scalar_t a[ N*N > 0 ? N*N : 1 ];
+    internal::load< N, N >( A, lda, a );
+    bool lower = (uplo == Uplo::Lower);
+
+    // Right-looking; on failure, skip the remaining columns.
+    int64_t info = 0;
+    static_for< 0, N >( [&]( auto j ) {
+        if (info != 0)
+            return;
+        real_t ajj = std::real( a[ j + j*N ] );
+        if (! (ajj > 0)) {  // also catches NaN
+            info = j + 1;
+            return;
+        }
+        ajj = std::sqrt( ajj );
+        a[ j + j*N ] = ajj;
+        real_t rcp = 1 / ajj;
+
+        if (lower) {
+            static_for< j + 1, N >( [&]( auto i ) {
+                a[ i + j*N ] *= rcp;
+            });
+            // A(j+1:N, j+1:N) -= A(j+1:N, j) A(j+1:N, j)^H, lower triangle.
+            static_for< j + 1, N >( [&]( auto k ) {
+                scalar_t akj = internal::conj( a[ k + j*N ] );
+                static_for< k, N >( [&]( auto i ) {
+                    a[ i + k*N ] -= a[ i + j*N ] * akj;
+                });
+            });
+        }
+        else {
+            static_for< j + 1, N >( [&]( auto k ) {
+                a[ j + k*N ] *= rcp;
+            });
+            // A(j+1:N, j+1:N) -= A(j, j+1:N)^H A(j, j+1:N), upper triangle.
+            static_for< j + 1, N >( [&]( auto k ) {
+                scalar_t ajk = a[ j + k*N ];
+                static_for< j + 1, k + 1 >( [&]( auto i ) {
+                    a[ i + k*N ] -= internal::conj( a[ j + i*N ] ) * ajk;
+                });
+            });
+        }
+    });
+
+    // Write back only the referenced triangle.
+    static_for< 0, N >( [&]( auto j ) {
+        if (lower) {
+            static_for< j, N >( [&]( auto i ) {
+                A[ i + j*lda ] = a[ i + j*N ];
+            });
+        }
+        else {
+            static_for< 0, j + 1 >( [&]( auto i ) {
+                A[ i + j*lda ] = a[ i + j*N ];
+            });
+        }
+    });
+    return info;
+}
+
+//------------------------------------------------------------------------------
+/// Solves a system of linear equations A X = B with an N-by-N Hermitian
+/// positive definite matrix A using the Cholesky factorization computed
+/// by lapack::fixed::potrf (or lapack::potrf); fixed-size version of
+/// lapack::potrs.
+///
+/// @tparam N
+///     The order of the matrix A. 0 <= N <= 16.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: Upper triangle of A is stored;
+///     - lapack::Uplo::Lower: Lower triangle of A is stored.
+///
+/// @param[in] nrhs
+///     The number of right hand sides, i.e., the number of columns of
+///     the matrix B. nrhs >= 0.
+///
+/// @param[in] A
+///     The triangular factor U or L from the Cholesky factorization,
+///     stored in an lda-by-N array.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,N).
+///
+/// @param[in,out] B
+///     The N-by-nrhs matrix B, stored in an ldb-by-nrhs array.
+///     On entry, the right hand side matrix B.
+///     On exit, the solution matrix X.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B. ldb >= max(1,N).
+///
+/// @return = 0: successful exit
+///
+/// @ingroup posv_computational
+template <int N, typename scalar_t>
+inline int64_t potrs(
+    lapack::Uplo uplo, int64_t nrhs,
+    scalar_t const* A, int64_t lda,
+    scalar_t* B, int64_t ldb )
+{
+    static_assert( 0 <= N && N <= max_size, "fixed::potrs requires N <= 16" );
+    using internal::static_for;
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( lda < std::max( 1, N ) );
+    lapack_error_if( ldb < std::max( 1, N ) );
+
+    // Load the factor as L, with A = L L^H; for upper, L = U^H.
+    scalar_t l[ N*N > 0 ? N*N : 1 ];
+    static_for< 0, N >( [&]( auto j ) {
+        static_for< j, N >( [&]( auto i ) {
+            l[ i + j*N ] = (uplo == Uplo::Lower
+                            ? A[ i + j*lda ]
+                            : internal::conj( A[ j + i*lda ] ));
+        });
+    });
+
+    for (int64_t c = 0; c < nrhs; ++c) {
+        scalar_t b[ N > 0 ? N : 1 ];
+        internal::load< N, 1 >( &B[ c*ldb ], ldb, b );
+
+        // Solve L Y = B.
+        static_for< 0, N >( [&]( auto k ) {
+            b[ k ] /= l[ k + k*N ];
+            static_for< k + 1, N >( [&]( auto i ) {
+                b[ i ] -= l[ i + k*N ] * b[ k ];
+            });
+        });
+        // Solve L^H X = Y.
+        static_for< 0, N >( [&]( auto ii ) {
+            constexpr int i = N - 1 - ii;
+            static_for< i + 1, N >( [&]( auto k ) {
+                b[ i ] -= internal::conj( l[ k + i*N ] ) * b[ k ];
+            });
+            b[ i ] /= l[ i + i*N ];
+        });
+
+        internal::store< N, 1 >( b, &B[ c*ldb ], ldb );
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+/// Computes a QR factorization of an M-by-N matrix A; fixed-size
+/// version of lapack::geqrf:
+/// \[
+///     A = Q R,
+/// \]
+/// where Q is a product of min(M, N) Householder reflectors
+/// \[
+///     H(i) = I - \tau_i v_i v_i^H,
+/// \]
+/// generated as in lapack::larfg, so lapack::ungqr and lapack::unmqr
+/// accept the result.
+///
+/// @tparam M
+///     The number of rows of the matrix A. 0 <= M <= 16.
+///
+/// @tparam N
+///     The number of columns of the matrix A. 0 <= N <= 16.
+///
+/// @param[in,out] A
+///     The M-by-N matrix A, stored in an lda-by-N array.
+///     On exit, R is on and above the diagonal, and the reflectors v_i
+///     below the diagonal, as in lapack::geqrf.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,M).
+///
+/// @param[out] tau
+///     The vector tau of length min(M,N).
+///     The scalar factors of the elementary reflectors.
+///
+/// @return = 0: successful exit
+///
+/// @ingroup geqrf
+template <int M, int N, typename scalar_t>
+inline int64_t geqrf( scalar_t* A, int64_t lda, scalar_t* tau )
+{
+    static_assert( 0 <= M && M <= max_size && 0 <= N && N <= max_size,
+                   "fixed::geqrf requires M, N <= 16" );
+    using real_t = blas::real_type< scalar_t >;
+    using internal::static_for;
+    lapack_error_if( lda < std::max( 1, M ) );
+
+    // Same threshold as larfg: safmin = lamch('S') / lamch('E').
+    const real_t safmin = std::numeric_limits< real_t >::min()
+                        / (std::numeric_limits< real_t >::epsilon() / 2);
+    const real_t rsafmn = 1 / safmin;
+
+    scalar_t a[ M*N > 0 ? M*N : 1 ];
+    internal::load< M, N >( A, lda, a );
+
+    constexpr int K = (M < N ? M : N);
+    static_for< 0, K >( [&]( auto j ) {
+        // Generate H(j) to annihilate A(j+1:M, j), as in larfg.
+        scalar_t alpha = a[ j + j*M ];
+        real_t xnorm = internal::nrm2< j + 1, M >( &a[ j*M ] );
+        real_t alphr = std::real( alpha );
+        real_t alphi = std::imag( alpha );
+
+        scalar_t tau_j = 0;
+        if (xnorm != 0 || alphi != 0) {
+            real_t beta = -std::copysign(
+                internal::lapy3( alphr, alphi, xnorm ), alphr );
+            int knt = 0;
+            if (std::abs( beta ) < safmin) {
+                // xnorm, beta may be inaccurate; scale x and recompute.
+                do {
+                    ++knt;
+                    static_for< j + 1, M >( [&]( auto i ) {
+                        a[ i + j*M ] *= rsafmn;
+                    });
+                    beta  *= rsafmn;
+                    alphr *= rsafmn;
+                    alphi *= rsafmn;
+                } while (std::abs( beta ) < safmin && knt < 20);
+                xnorm = internal::nrm2< j + 1, M >( &a[ j*M ] );
+                beta = -std::copysign(
+                    internal::lapy3( alphr, alphi, xnorm ), alphr );
+            }
+            if constexpr (blas::is_complex< scalar_t >::value) {
+                tau_j = scalar_t( (beta - alphr) / beta, -alphi / beta );
+                alpha = scalar_t( 1 ) / (scalar_t( alphr, alphi ) - beta);
+            }
+            else {
+                tau_j = (beta - alphr) / beta;
+                alpha = 1 / (alphr - beta);
+            }
+            static_for< j + 1, M >( [&]( auto i ) {
+                a[ i + j*M ] *= alpha;
+            });
+            for (int k = 0; k < knt; ++k)
+                beta *= safmin;
+            a[ j + j*M ] = beta;
+        }
+        tau[ j ] = tau_j;
+
+        // Apply H(j)^H to A(j:M, j+1:N) from the left, as in larf:
+        // A(:, k) -= conj( tau ) v (v^H A(:, k)), with v(j) = 1.
+        if (tau_j != scalar_t( 0 )) {
+            scalar_t ctau = internal::conj( tau_j );
+            static_for< j + 1, N >( [&]( auto k ) {
+                scalar_t s = a[ j + k*M ];
+                static_for< j + 1, M >( [&]( auto i ) {
+                    s += internal::conj( a[ i + j*M ] ) * a[ i + k*M ];
+                });
+                s *= ctau;
+                a[ j + k*M ] -= s;
+                static_for< j + 1, M >( [&]( auto i ) {
+                    a[ i + k*M ] -= a[ i + j*M ] * s;
+                });
+            });
+        }
+    });
+
+    internal::store< M, N >( a, A, lda );
+    return 0;
+}
+
+}  // namespace fixed
+}  // namespace lapack
+
+#endif // LAPACK_FIXED_HH
@@ -0,0 +1,112 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_MIXED_HH
+#define LAPACK_MIXED_HH
+
+#include "lapack/util.hh"
+
+#include <complex>
+
+namespace lapack {
+
+//------------------------------------------------------------------------------
+// Mixed-precision solvers.
+//
+// These factor a double precision matrix in single precision, by LU,
+// Cholesky, or QR for least squares (gels_mixed), then refine the
+// solution to double precision accuracy, falling back to a double
+// precision factorization when refinement fails. iter returns the number
+// of refinement iterations, or < 0 after a fallback. The _gmres variants
+// solve each correction by GMRES preconditioned with the single
+// precision factors (GMRES-IR), which converges for much more
+// ill-conditioned A, and also return the number of GMRES iterations.
+
+// -----------------------------------------------------------------------------
+int64_t gesv_mixed(
+    int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    int64_t* iter );
+
+int64_t gesv_mixed(
+    int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    int64_t* iter );
+
+// -----------------------------------------------------------------------------
+int64_t posv_mixed(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    int64_t* iter );
+
+int64_t posv_mixed(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    int64_t* iter );
+
+// -----------------------------------------------------------------------------
+int64_t gesv_mixed_gmres(
+    int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double tol, int64_t itermax, int64_t gmres_itermax,
+    int64_t* iter, int64_t* gmres_iter );
+
+int64_t gesv_mixed_gmres(
+    int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    double tol, int64_t itermax, int64_t gmres_itermax,
+    int64_t* iter, int64_t* gmres_iter );
+
+// -----------------------------------------------------------------------------
+int64_t posv_mixed_gmres(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double tol, int64_t itermax, int64_t gmres_itermax,
+    int64_t* iter, int64_t* gmres_iter );
+
+int64_t posv_mixed_gmres(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    double tol, int64_t itermax, int64_t gmres_itermax,
+    int64_t* iter, int64_t* gmres_iter );
+
+// -----------------------------------------------------------------------------
+int64_t gels_mixed(
+    int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    int64_t* iter );
+
+int64_t gels_mixed(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    int64_t* iter );
+
+}  // namespace lapack
+
+#endif // LAPACK_MIXED_HH
@@ -0,0 +1,220 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_PARALLEL_HH
+#define LAPACK_PARALLEL_HH
+
+#include "lapack/util.hh"
+
+#include <complex>
+
+namespace lapack {
+
+//------------------------------------------------------------------------------
+// Host threading.
+//
+// Host-parallel LAPACK++ routines, such as the batched factorizations,
+// run on a process-wide pool of threads. These set the pool size; they
+// do not change threading inside the BLAS or LAPACK library.
+
+void set_num_threads( int num_threads );
+
+int get_num_threads();
+
+//------------------------------------------------------------------------------
+// Host-parallel solvers for a single large problem.
+//
+// These split one problem across the thread pool, unlike the batched
+// routines in batch.hh, which solve many independent problems.
+
+// -----------------------------------------------------------------------------
+int64_t gtsv_parallel(
+    int64_t n, int64_t nrhs,
+    float* DL, float* D, float* DU,
+    float* B, int64_t ldb );
+
+int64_t gtsv_parallel(
+    int64_t n, int64_t nrhs,
+    double* DL, double* D, double* DU,
+    double* B, int64_t ldb );
+
+int64_t gtsv_parallel(
+    int64_t n, int64_t nrhs,
+    std::complex<float>* DL, std::complex<float>* D, std::complex<float>* DU,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t gtsv_parallel(
+    int64_t n, int64_t nrhs,
+    std::complex<double>* DL, std::complex<double>* D, std::complex<double>* DU,
+    std::complex<double>* B, int64_t ldb );
+
+// -----------------------------------------------------------------------------
+int64_t ptsv_parallel(
+    int64_t n, int64_t nrhs,
+    float* D, float* E,
+    float* B, int64_t ldb );
+
+int64_t ptsv_parallel(
+    int64_t n, int64_t nrhs,
+    double* D, double* E,
+    double* B, int64_t ldb );
+
+int64_t ptsv_parallel(
+    int64_t n, int64_t nrhs,
+    float* D, std::complex<float>* E,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t ptsv_parallel(
+    int64_t n, int64_t nrhs,
+    double* D, std::complex<double>* E,
+    std::complex<double>* B, int64_t ldb );
+
+// -----------------------------------------------------------------------------
+int64_t gbsv_parallel(
+    int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    float* AB, int64_t ldab,
+    int64_t* ipiv,
+    float* B, int64_t ldb );
+
+int64_t gbsv_parallel(
+    int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    double* AB, int64_t ldab,
+    int64_t* ipiv,
+    double* B, int64_t ldb );
+
+int64_t gbsv_parallel(
+    int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    std::complex<float>* AB, int64_t ldab,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t gbsv_parallel(
+    int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    std::complex<double>* AB, int64_t ldab,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb );
+
+// -----------------------------------------------------------------------------
+int64_t pbsv_parallel(
+    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
+    float* AB, int64_t ldab,
+    float* B, int64_t ldb );
+
+int64_t pbsv_parallel(
+    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
+    double* AB, int64_t ldab,
+    double* B, int64_t ldb );
+
+int64_t pbsv_parallel(
+    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
+    std::complex<float>* AB, int64_t ldab,
+    std::complex<float>* B, int64_t ldb );
+
+int64_t pbsv_parallel(
+    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
+    std::complex<double>* AB, int64_t ldab,
+    std::complex<double>* B, int64_t ldb );
+
+// -----------------------------------------------------------------------------
+int64_t stebz_parallel(
+    lapack::Range range, int64_t n,
+    float const* D, float const* E,
+    float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W );
+
+int64_t stebz_parallel(
+    lapack::Range range, int64_t n,
+    double const* D, double const* E,
+    double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W );
+
+// -----------------------------------------------------------------------------
+int64_t potrf_parallel(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda );
+
+int64_t potrf_parallel(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda );
+
+int64_t potrf_parallel(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda );
+
+int64_t potrf_parallel(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda );
+
+// -----------------------------------------------------------------------------
+int64_t getrf_parallel(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    int64_t* ipiv );
+
+int64_t getrf_parallel(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    int64_t* ipiv );
+
+int64_t getrf_parallel(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv );
+
+int64_t getrf_parallel(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv );
+
+// -----------------------------------------------------------------------------
+int64_t geqrf_tsqr(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* T, int64_t tsize );
+
+int64_t geqrf_tsqr(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* T, int64_t tsize );
+
+int64_t geqrf_tsqr(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* T, int64_t tsize );
+
+int64_t geqrf_tsqr(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* T, int64_t tsize );
+
+int64_t gemqr_tsqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* T, int64_t tsize,
+    float* C, int64_t ldc );
+
+int64_t gemqr_tsqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* T, int64_t tsize,
+    double* C, int64_t ldc );
+
+int64_t gemqr_tsqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* T, int64_t tsize,
+    std::complex<float>* C, int64_t ldc );
+
+int64_t gemqr_tsqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* T, int64_t tsize,
+    std::complex<double>* C, int64_t ldc );
+
+}  // namespace lapack
+
+#endif // LAPACK_PARALLEL_HH
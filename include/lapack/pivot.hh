@@ -0,0 +1,254 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_PIVOT_HH
+#define LAPACK_PIVOT_HH
+
+#include "lapack/wrappers.hh"
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+namespace lapack {
+
+//------------------------------------------------------------------------------
+// Pivot-type-agnostic entry points for the LU and symmetric-indefinite
+// routines. ipiv may be any integer type. When it is int64_t or the native
+// lapack_int, overload resolution picks the non-template wrappers, and the
+// native lapack_int overloads pass ipiv to LAPACK without copying. Other
+// integer types, e.g., int32_t with LAPACK_ILP64 or long long where int64_t
+// is long, are converted via a temporary lapack_int array.
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Temporary native-width copy of a pivot array of length n.
+/// If copy_in, it is initialized from ipiv; copy_out copies it back.
+template <typename pivot_t>
+class PivotCopy
+{
+public:
+    static_assert( std::is_integral< pivot_t >::value,
+                   "pivot type must be an integer type" );
+
+    PivotCopy( pivot_t const* ipiv, int64_t n, bool copy_in )
+        : ipiv_( std::max( int64_t( 1 ), n ) )
+    {
+        if (copy_in)
+            std::copy( ipiv, ipiv + n, ipiv_.begin() );
+    }
+
+    void copy_out( pivot_t* ipiv, int64_t n ) const
+    {
+        std::copy( ipiv_.begin(), ipiv_.begin() + n, ipiv );
+    }
+
+    lapack_int* data() { return ipiv_.data(); }
+
+private:
+    std::vector< lapack_int > ipiv_;
+};
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+/// Pivot-type-agnostic lapack::getrf.
+/// @ingroup gesv_computational
+template <typename scalar_t, typename pivot_t>
+int64_t getrf(
+    int64_t m, int64_t n,
+    scalar_t* A, int64_t lda,
+    pivot_t* ipiv )
+{
+    int64_t k = std::min( m, n );
+    internal::PivotCopy< pivot_t > ipiv_( ipiv, k, false );
+    int64_t info = getrf( m, n, A, lda, ipiv_.data() );
+    ipiv_.copy_out( ipiv, k );
+    return info;
+}
+
+//------------------------------------------------------------------------------
+/// Pivot-type-agnostic lapack::getrs.
+/// @ingroup gesv_computational
+template <typename scalar_t, typename pivot_t>
+int64_t getrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    scalar_t const* A, int64_t lda,
+    pivot_t const* ipiv,
+    scalar_t* B, int64_t ldb )
+{
+    internal::PivotCopy< pivot_t > ipiv_( ipiv, n, true );
+    return getrs( trans, n, nrhs, A, lda, ipiv_.data(), B, ldb );
+}
+
+//------------------------------------------------------------------------------
+/// Pivot-type-agnostic lapack::getri.
+/// @ingroup gesv_computational
+template <typename scalar_t, typename pivot_t>
+int64_t getri(
+    int64_t n,
+    scalar_t* A, int64_t lda,
+    pivot_t const* ipiv )
+{
+    internal::PivotCopy< pivot_t > ipiv_( ipiv, n, true );
+    return getri( n, A, lda, ipiv_.data() );
+}
+
+//------------------------------------------------------------------------------
+/// Pivot-type-agnostic lapack::gesv.
+/// @ingroup gesv
+template <typename scalar_t, typename pivot_t>
+int64_t gesv(
+    int64_t n, int64_t nrhs,
+    scalar_t* A, int64_t lda,
+    pivot_t* ipiv,
+    scalar_t* B, int64_t ldb )
+{
+    internal::PivotCopy< pivot_t > ipiv_( ipiv, n, false );
+    int64_t info = gesv( n, nrhs, A, lda, ipiv_.data(), B, ldb );
+    ipiv_.copy_out( ipiv, n );
+    return info;
+}
+
+//------------------------------------------------------------------------------
+/// Pivot-type-agnostic lapack::gbtrf.
+/// @ingroup gbsv_computational
+template <typename scalar_t, typename pivot_t>
+int64_t gbtrf(
+    int64_t m, int64_t n, int64_t kl, int64_t ku,
+    scalar_t* AB, int64_t ldab,
+    pivot_t* ipiv )
+{
+    int64_t k = std::min( m, n );
+    internal::PivotCopy< pivot_t > ipiv_( ipiv, k, false );
+    int64_t info = gbtrf( m, n, kl, ku, AB, ldab, ipiv_.data() );
+    ipiv_.copy_out( ipiv, k );
+    return info;
+}
+
+//------------------------------------------------------------------------------
+/// Pivot-type-agnostic lapack::gbtrs.
+/// @ingroup gbsv_computational
+template <typename scalar_t, typename pivot_t>
+int64_t gbtrs(
+    lapack::Op trans, int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    scalar_t const* AB, int64_t ldab,
+    pivot_t const* ipiv,
+    scalar_t* B, int64_t ldb )
+{
+    internal::PivotCopy< pivot_t > ipiv_( ipiv, n, true );
+    return gbtrs( trans, n, kl, ku, nrhs, AB, ldab, ipiv_.data(), B, ldb );
+}
+
+//------------------------------------------------------------------------------
+/// Pivot-type-agnostic lapack::gbsv.
+/// @ingroup gbsv
+template <typename scalar_t, typename pivot_t>
+int64_t gbsv(
+    int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    scalar_t* AB, int64_t ldab,
+    pivot_t* ipiv,
+    scalar_t* B, int64_t ldb )
+{
+    internal::PivotCopy< pivot_t > ipiv_( ipiv, n, false );
+    int64_t info = gbsv( n, kl, ku, nrhs, AB, ldab, ipiv_.data(), B, ldb );
+    ipiv_.copy_out( ipiv, n );
+    return info;
+}
+
+//------------------------------------------------------------------------------
+/// Pivot-type-agnostic lapack::sytrf.
+/// @ingroup sysv_computational
+template <typename scalar_t, typename pivot_t>
+int64_t sytrf(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda,
+    pivot_t* ipiv )
+{
+    internal::PivotCopy< pivot_t > ipiv_( ipiv, n, false );
+    int64_t info = sytrf( uplo, n, A, lda, ipiv_.data() );
+    ipiv_.copy_out( ipiv, n );
+    return info;
+}
+
+//------------------------------------------------------------------------------
+/// Pivot-type-agnostic lapack::sytrs.
+/// @ingroup sysv_computational
+template <typename scalar_t, typename pivot_t>
+int64_t sytrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t const* A, int64_t lda,
+    pivot_t const* ipiv,
+    scalar_t* B, int64_t ldb )
+{
+    internal::PivotCopy< pivot_t > ipiv_( ipiv, n, true );
+    return sytrs( uplo, n, nrhs, A, lda, ipiv_.data(), B, ldb );
+}
+
+//------------------------------------------------------------------------------
+/// Pivot-type-agnostic lapack::sysv.
+/// @ingroup sysv
+template <typename scalar_t, typename pivot_t>
+int64_t sysv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t* A, int64_t lda,
+    pivot_t* ipiv,
+    scalar_t* B, int64_t ldb )
+{
+    internal::PivotCopy< pivot_t > ipiv_( ipiv, n, false );
+    int64_t info = sysv( uplo, n, nrhs, A, lda, ipiv_.data(), B, ldb );
+    ipiv_.copy_out( ipiv, n );
+    return info;
+}
+
+//------------------------------------------------------------------------------
+/// Pivot-type-agnostic lapack::hetrf.
+/// @ingroup hesv_computational
+template <typename scalar_t, typename pivot_t>
+int64_t hetrf(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda,
+    pivot_t* ipiv )
+{
+    internal::PivotCopy< pivot_t > ipiv_( ipiv, n, false );
+    int64_t info = hetrf( uplo, n, A, lda, ipiv_.data() );
+    ipiv_.copy_out( ipiv, n );
+    return info;
+}
+
+//------------------------------------------------------------------------------
+/// Pivot-type-agnostic lapack::hetrs.
+/// @ingroup hesv_computational
+template <typename scalar_t, typename pivot_t>
+int64_t hetrs(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t const* A, int64_t lda,
+    pivot_t const* ipiv,
+    scalar_t* B, int64_t ldb )
+{
+    internal::PivotCopy< pivot_t > ipiv_( ipiv, n, true );
+    return hetrs( uplo, n, nrhs, A, lda, ipiv_.data(), B, ldb );
+}
+
+//------------------------------------------------------------------------------
+/// Pivot-type-agnostic lapack::hesv.
+/// @ingroup hesv
+template <typename scalar_t, typename pivot_t>
+int64_t hesv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t* A, int64_t lda,
+    pivot_t* ipiv,
+    scalar_t* B, int64_t ldb )
+{
+    internal::PivotCopy< pivot_t > ipiv_( ipiv, n, false );
+    int64_t info = hesv( uplo, n, nrhs, A, lda, ipiv_.data(), B, ldb );
+    ipiv_.copy_out( ipiv, n );
+    return info;
+}
+
+}  // namespace lapack
+
+#endif // LAPACK_PIVOT_HH
@@ -0,0 +1,89 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_STREAMING_HH
+#define LAPACK_STREAMING_HH
+
+#include "lapack/util.hh"
+
+#include <vector>
+
+namespace lapack {
+
+//------------------------------------------------------------------------------
+/// Streaming least squares, min || A X - B ||_F, for A and B arriving as
+/// blocks of rows. Instead of A and B, it keeps the n-by-n triangular
+/// factor R of A = Q R, D = (Q^H B)(1:n, :), and the residual norms, so
+/// memory is O( n (n + nrhs) ) however many rows have been added.
+///
+/// Each add_rows folds in a block of mb rows with tpqrt and tpmqrt, at
+/// O( mb n (n + nrhs) ) cost. remove_rows downdates R, D, and the residual
+/// norms, one row at a time, e.g., for a sliding window. With a
+/// forgetting factor lambda < 1, each row's squared residual is weighted
+/// by lambda^age, where age is the number of rows added after it. solve
+/// returns X = R^{-1} D at any point, at O( n^2 nrhs ) cost.
+///
+/// Instantiated for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// Example:
+///
+///     lapack::StreamingQR< double > ls( n, 1 );
+///     while (receive( mb, A, lda, b ))
+///         ls.add_rows( mb, A, lda, b, mb );
+///     ls.solve( x, n );
+///
+template <typename scalar_t>
+class StreamingQR
+{
+public:
+    using real_t = blas::real_type< scalar_t >;
+
+    StreamingQR( int64_t n, int64_t nrhs, real_t lambda=1 );
+
+    void add_rows( int64_t mb,
+                   scalar_t const* A, int64_t lda,
+                   scalar_t const* B, int64_t ldb );
+
+    int64_t remove_rows( int64_t mb,
+                         scalar_t const* A, int64_t lda,
+                         scalar_t const* B, int64_t ldb );
+
+    int64_t solve( scalar_t* X, int64_t ldx ) const;
+
+    void reset();
+
+    int64_t n() const { return n_; }
+    int64_t nrhs() const { return nrhs_; }
+
+    /// Number of rows added minus rows removed.
+    int64_t rows() const { return rows_; }
+
+    real_t lambda() const { return lambda_; }
+    void lambda( real_t lambda );
+
+    /// Triangular factor R, n-by-n, stored with leading dimension n.
+    scalar_t const* R() const { return R_.data(); }
+
+    /// (Q^H B)(1:n, :), n-by-nrhs, stored with leading dimension n.
+    scalar_t const* D() const { return D_.data(); }
+
+    /// Residual norm || A x_j - b_j || of the current solution,
+    /// for 0 <= j < nrhs.
+    real_t residual_norm( int64_t j ) const { return rnorm_[ j ]; }
+
+private:
+    int64_t n_;
+    int64_t nrhs_;
+    int64_t rows_;
+    real_t lambda_;
+    std::vector< scalar_t > R_;
+    std::vector< scalar_t > D_;
+    std::vector< real_t > rnorm_;
+};
+
+}  // namespace lapack
+
+#endif // LAPACK_STREAMING_HH
@@ -0,0 +1,157 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_UPDATE_HH
+#define LAPACK_UPDATE_HH
+
+#include "lapack/util.hh"
+
+#include <complex>
+
+namespace lapack {
+
+//------------------------------------------------------------------------------
+// Factorization updates.
+//
+// These modify an existing factorization after a low-rank change to the
+// matrix, at a fraction of the cost of factoring it again.
+
+// -----------------------------------------------------------------------------
+int64_t potrf_update(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* X, int64_t ldx );
+
+int64_t potrf_update(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* X, int64_t ldx );
+
+int64_t potrf_update(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* X, int64_t ldx );
+
+int64_t potrf_update(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* X, int64_t ldx );
+
+// -----------------------------------------------------------------------------
+int64_t potrf_downdate(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* X, int64_t ldx );
+
+int64_t potrf_downdate(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* X, int64_t ldx );
+
+int64_t potrf_downdate(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* X, int64_t ldx );
+
+int64_t potrf_downdate(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* X, int64_t ldx );
+
+// -----------------------------------------------------------------------------
+int64_t qr_insert_col(
+    int64_t m, int64_t n, int64_t j,
+    float* Q, int64_t ldq,
+    float* R, int64_t ldr,
+    float const* x, int64_t incx );
+
+int64_t qr_insert_col(
+    int64_t m, int64_t n, int64_t j,
+    double* Q, int64_t ldq,
+    double* R, int64_t ldr,
+    double const* x, int64_t incx );
+
+int64_t qr_insert_col(
+    int64_t m, int64_t n, int64_t j,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* R, int64_t ldr,
+    std::complex<float> const* x, int64_t incx );
+
+int64_t qr_insert_col(
+    int64_t m, int64_t n, int64_t j,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* R, int64_t ldr,
+    std::complex<double> const* x, int64_t incx );
+
+// -----------------------------------------------------------------------------
+int64_t qr_delete_col(
+    int64_t m, int64_t n, int64_t j,
+    float* Q, int64_t ldq,
+    float* R, int64_t ldr );
+
+int64_t qr_delete_col(
+    int64_t m, int64_t n, int64_t j,
+    double* Q, int64_t ldq,
+    double* R, int64_t ldr );
+
+int64_t qr_delete_col(
+    int64_t m, int64_t n, int64_t j,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* R, int64_t ldr );
+
+int64_t qr_delete_col(
+    int64_t m, int64_t n, int64_t j,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* R, int64_t ldr );
+
+// -----------------------------------------------------------------------------
+int64_t qr_insert_row(
+    int64_t m, int64_t n, int64_t i,
+    float* Q, int64_t ldq,
+    float* R, int64_t ldr,
+    float const* x, int64_t incx );
+
+int64_t qr_insert_row(
+    int64_t m, int64_t n, int64_t i,
+    double* Q, int64_t ldq,
+    double* R, int64_t ldr,
+    double const* x, int64_t incx );
+
+int64_t qr_insert_row(
+    int64_t m, int64_t n, int64_t i,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* R, int64_t ldr,
+    std::complex<float> const* x, int64_t incx );
+
+int64_t qr_insert_row(
+    int64_t m, int64_t n, int64_t i,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* R, int64_t ldr,
+    std::complex<double> const* x, int64_t incx );
+
+// -----------------------------------------------------------------------------
+int64_t qr_delete_row(
+    int64_t m, int64_t n, int64_t i,
+    float* Q, int64_t ldq,
+    float* R, int64_t ldr );
+
+int64_t qr_delete_row(
+    int64_t m, int64_t n, int64_t i,
+    double* Q, int64_t ldq,
+    double* R, int64_t ldr );
+
+int64_t qr_delete_row(
+    int64_t m, int64_t n, int64_t i,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* R, int64_t ldr );
+
+int64_t qr_delete_row(
+    int64_t m, int64_t n, int64_t i,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* R, int64_t ldr );
+
+}  // namespace lapack
+
+#endif // LAPACK_UPDATE_HH
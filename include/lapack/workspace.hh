@@ -0,0 +1,169 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_WORKSPACE_HH
+#define LAPACK_WORKSPACE_HH
+
+#include <cstddef>  // std::size_t
+#include <cstdint>  // int64_t
+#include <map>
+#include <memory_resource>  // std::pmr::memory_resource
+#include <string>
+
+namespace lapack {
+
+//------------------------------------------------------------------------------
+// Per-thread workspace arena.
+//
+// By default, each wrapper allocates its work, rwork, iwork, and 32-bit
+// pivot copies from the heap and frees them on exit. When the arena is
+// enabled for a thread, those temporaries are instead carved out of a
+// per-thread bump allocator. The arena is reset whenever the last
+// temporary is released, i.e., when the outermost wrapper returns, and
+// grows monotonically to fit the largest call seen. In steady state,
+// wrappers then do no heap allocation at all.
+//
+// All settings and statistics are for the calling thread only.
+
+void workspace_arena_enable( bool enable );
+
+bool workspace_arena_enabled();
+
+std::size_t workspace_arena_high_water();
+
+std::size_t workspace_arena_capacity();
+
+void workspace_arena_trim();
+
+//------------------------------------------------------------------------------
+// Caller-supplied workspace.
+//
+// Every wrapper whose LAPACK routine takes a queried workspace (lwork,
+// lrwork, or liwork) has a foo_work_size() query and an overload of foo()
+// that takes caller-owned work, rwork, and iwork arrays, skipping both
+// the internal query and the allocation; e.g., geqrf, gesvd, geev,
+// syev/heev, sytrd/hetrd, ormqr/unmqr, sytrf/hetrf, sysv/hesv, stedc,
+// ggev, tgsen. Variants with a pivot argument take ipiv as lapack_int,
+// so no pivot copy is needed either. Arrays that are not LAPACK
+// workspace, e.g., split-complex eigenvalues in geev, are still
+// allocated internally. The gecon family, whose workspace has a fixed
+// size, also has these overloads.
+//
+// The sizes are cached (see below) except for trsen, tgsen, and geqr,
+// whose sizes depend on the data.
+
+//------------------------------------------------------------------------------
+// Workspace-size cache.
+//
+// Each wrapper normally calls LAPACK with lwork = -1 to query its
+// workspace size before the actual call. When the cache is enabled, the
+// query result is remembered per routine, precision, job flags, and
+// dimensions (m, n, k, leading dimensions), so repeated calls with the
+// same shape skip the query. The cache is shared by all threads.
+
+void work_size_cache_enable( bool enable );
+
+bool work_size_cache_enabled();
+
+void work_size_cache_clear();
+
+int64_t work_size_cache_hits();
+
+int64_t work_size_cache_misses();
+
+std::size_t work_size_cache_size();
+
+//------------------------------------------------------------------------------
+// Memory resource for workspaces.
+//
+// Temporaries allocated inside wrappers (work, rwork, iwork, and 32-bit
+// copies of integer arrays) come from a std::pmr::memory_resource, if one
+// is set; by default they use an aligned heap allocation. A
+// MemoryResourceGuard overrides the process-wide resource for the calling
+// thread. An enabled workspace arena takes precedence over both.
+
+void set_memory_resource( std::pmr::memory_resource* resource );
+
+std::pmr::memory_resource* get_memory_resource();
+
+//------------------------------------------------------------------------------
+/// Scoped guard that sets the calling thread's workspace memory resource,
+/// restoring the previous one on destruction. Guards may be nested.
+///
+/// Example:
+///
+///     std::pmr::unsynchronized_pool_resource pool;
+///     {
+///         lapack::MemoryResourceGuard guard( &pool );
+///         lapack::gesdd( ... );  // workspace from pool
+///     }
+///
+class MemoryResourceGuard
+{
+public:
+    explicit MemoryResourceGuard( std::pmr::memory_resource* resource );
+    ~MemoryResourceGuard();
+
+    MemoryResourceGuard( MemoryResourceGuard const& ) = delete;
+    MemoryResourceGuard& operator = ( MemoryResourceGuard const& ) = delete;
+
+private:
+    std::pmr::memory_resource* prev_resource_;
+    bool prev_set_;
+};
+
+//------------------------------------------------------------------------------
+// Workspace placement.
+//
+// Process-wide options for how workspaces are laid out in memory:
+// alignment, huge pages for large workspaces, and NUMA placement.
+
+void set_workspace_alignment( std::size_t alignment );
+
+std::size_t get_workspace_alignment();
+
+void set_huge_page_threshold( std::size_t bytes );
+
+std::size_t get_huge_page_threshold();
+
+void set_workspace_numa( int node, bool first_touch=false );
+
+int get_workspace_numa_node();
+
+//------------------------------------------------------------------------------
+// Instrumentation counters.
+//
+// When enabled, each wrapper call that allocates workspace or queries its
+// size records, under its Fortran routine name (e.g., "dgesdd", which also
+// identifies the precision), the number of calls, workspace allocations and
+// bytes, the largest number of bytes allocated by a single call, and the
+// number and total time of workspace queries. Counts from all threads are
+// combined. Disabled by default; the cost when disabled is one relaxed
+// atomic load per call.
+
+/// Counters for one routine; see lapack::stats.
+struct RoutineStats
+{
+    int64_t calls      = 0;  ///< instrumented calls
+    int64_t allocs     = 0;  ///< workspace allocations
+    int64_t bytes      = 0;  ///< total workspace bytes allocated
+    int64_t peak_bytes = 0;  ///< most bytes allocated in a single call
+    int64_t queries    = 0;  ///< workspace queries (lwork = -1) made
+    double  query_time = 0;  ///< total time in workspace queries, in seconds
+};
+
+void stats_enable( bool enable );
+
+bool stats_enabled();
+
+void stats_reset();
+
+std::map< std::string, RoutineStats > stats();
+
+std::string stats_json();
+
+}  // namespace lapack
+
+#endif // LAPACK_WORKSPACE_HH
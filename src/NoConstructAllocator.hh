@@ -8,16 +8,24 @@
 
 #include <cstddef>  // std::size_t
 #include <limits>   // std::numeric_limits
-#include <new>      // std::bad_alloc, std::bad_array_new_length
+#include <new>      // std::bad_array_new_length, placement new
+#include <utility>  // std::forward
 #include <vector>   // std::vector
-#if defined( _WIN32 ) || defined( _WIN64 )
-#   include <malloc.h>  // _aligned_malloc, _aligned_free
-#else
-#   include <stdlib.h>  // posix_memalign, free
-#endif
 
 namespace lapack {
 
+namespace internal {
+
+// Allocates aligned memory for lapack::vector, from the calling thread's
+// workspace arena if enabled, else from the current memory resource, else
+// from the heap or huge pages; see src/workspace.cc. Throws on failure.
+void* workspace_allocate( std::size_t bytes );
+
+// Releases memory from workspace_allocate, wherever it came from.
+void workspace_deallocate( void* ptr ) noexcept;
+
+}  // namespace internal
+
 // No-construct allocator type which allocates / deallocates.
 template <typename T>
 struct NoConstructAllocator
@@ -26,47 +34,37 @@ struct NoConstructAllocator
 
     NoConstructAllocator() = default;
 
-    // Construction given an allocated pointer is a null-op.
-    //
-    // @tparam Args Parameter pack which handles all possible calling
-    // signatures of construct outlined in the Allocator concept.
-    //
-    template <typename... Args>
-    void construct( T* ptr, Args&& ... args ) { }
+    template <typename U>
+    NoConstructAllocator( NoConstructAllocator<U> const& ) {}
+
+    // Default construction given an allocated pointer is a null-op,
+    // so workspaces are left uninitialized.
+    template <typename U>
+    void construct( U* ptr ) { }
+
+    // Construction from values, e.g., copying a range, is done as usual.
+    template <typename U, typename Arg, typename... Args>
+    void construct( U* ptr, Arg&& arg, Args&& ... args )
+    {
+        ::new( static_cast<void*>( ptr ) )
+            U( std::forward<Arg>( arg ), std::forward<Args>( args )... );
+    }
 
     // Destruction of an object in allocated memory is a null-op
-    void destroy( T* ptr ) { }
+    template <typename U>
+    void destroy( U* ptr ) { }
 
     T* allocate(std::size_t n)
     {
         if (n > std::numeric_limits<std::size_t>::max() / sizeof(T))
             throw std::bad_array_new_length();
 
-        void* memPtr = nullptr;
-        #if defined( _WIN32 ) || defined( _WIN64 )
-            memPtr = _aligned_malloc( n*sizeof(T), 64 );
-            if (memPtr != nullptr) {
-                auto p = static_cast<T*>(memPtr);
-                return p;
-            }
-        #else
-            int err = posix_memalign( &memPtr, 64, n*sizeof(T) );
-            if (err == 0) {
-                auto p = static_cast<T*>(memPtr);
-                return p;
-            }
-        #endif
-
-        throw std::bad_alloc();
+        return static_cast<T*>( internal::workspace_allocate( n*sizeof(T) ) );
     }
 
     void deallocate(T* p, std::size_t n) noexcept
     {
-        #if defined( _WIN32 ) || defined( _WIN64 )
-            _aligned_free( p );
-        #else
-            free( p );
-        #endif
+        internal::workspace_deallocate( p );
     }
 };
 
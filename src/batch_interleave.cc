@@ -0,0 +1,248 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "batch_internal.hh"
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper.
+/// @ingroup initialize
+///
+template <typename scalar_t>
+void batch_interleave(
+    int64_t m, int64_t n,
+    scalar_t const* A, int64_t lda, int64_t strideA,
+    int64_t batch_size,
+    scalar_t* Ai, int64_t lanes )
+{
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+    lapack_error_if( strideA < lda * n );
+    lapack_error_if( batch_size < 0 );
+    lapack_error_if( lanes < 1 );
+
+    int64_t nblocks = (batch_size + lanes - 1) / lanes;
+    int64_t grain = (int64_t( 1 ) << 16) / max( 1, m*n*lanes );
+
+    internal::parallel_for( nblocks, grain, [&]( int64_t begin, int64_t end ) {
+        for (int64_t b = begin; b < end; ++b) {
+            int64_t nlanes = min( lanes, batch_size - b*lanes );
+            scalar_t* Ab = &Ai[ b * m*n*lanes ];
+            for (int64_t l = 0; l < nlanes; ++l) {
+                scalar_t const* Ak = &A[ (b*lanes + l) * strideA ];
+                for (int64_t j = 0; j < n; ++j) {
+                    for (int64_t i = 0; i < m; ++i) {
+                        Ab[ (i + j*m)*lanes + l ] = Ak[ i + j*lda ];
+                    }
+                }
+            }
+        }
+    });
+}
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper.
+/// @ingroup initialize
+///
+template <typename scalar_t>
+void batch_deinterleave(
+    int64_t m, int64_t n,
+    scalar_t const* Ai, int64_t lanes,
+    int64_t batch_size,
+    scalar_t* A, int64_t lda, int64_t strideA )
+{
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lanes < 1 );
+    lapack_error_if( batch_size < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+    lapack_error_if( strideA < lda * n );
+
+    int64_t nblocks = (batch_size + lanes - 1) / lanes;
+    int64_t grain = (int64_t( 1 ) << 16) / max( 1, m*n*lanes );
+
+    internal::parallel_for( nblocks, grain, [&]( int64_t begin, int64_t end ) {
+        for (int64_t b = begin; b < end; ++b) {
+            int64_t nlanes = min( lanes, batch_size - b*lanes );
+            scalar_t const* Ab = &Ai[ b * m*n*lanes ];
+            for (int64_t l = 0; l < nlanes; ++l) {
+                scalar_t* Ak = &A[ (b*lanes + l) * strideA ];
+                for (int64_t j = 0; j < n; ++j) {
+                    for (int64_t i = 0; i < m; ++i) {
+                        Ak[ i + j*lda ] = Ab[ (i + j*m)*lanes + l ];
+                    }
+                }
+            }
+        }
+    });
+}
+
+}  // namespace impl
+
+//------------------------------------------------------------------------------
+/// @ingroup initialize
+void batch_interleave(
+    int64_t m, int64_t n,
+    float const* A, int64_t lda, int64_t strideA,
+    int64_t batch_size,
+    float* Ai, int64_t lanes )
+{
+    impl::batch_interleave( m, n, A, lda, strideA, batch_size, Ai, lanes );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup initialize
+void batch_interleave(
+    int64_t m, int64_t n,
+    double const* A, int64_t lda, int64_t strideA,
+    int64_t batch_size,
+    double* Ai, int64_t lanes )
+{
+    impl::batch_interleave( m, n, A, lda, strideA, batch_size, Ai, lanes );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup initialize
+void batch_interleave(
+    int64_t m, int64_t n,
+    std::complex<float> const* A, int64_t lda, int64_t strideA,
+    int64_t batch_size,
+    std::complex<float>* Ai, int64_t lanes )
+{
+    impl::batch_interleave( m, n, A, lda, strideA, batch_size, Ai, lanes );
+}
+
+//------------------------------------------------------------------------------
+/// Copies a strided batch of m-by-n matrices into the interleaved
+/// ("batch-innermost") layout used by lapack::potrf_batch_interleaved and
+/// related routines. Element (i, j) of matrix k is stored at
+///
+///     Ai[ (k / lanes)*m*n*lanes + (i + j*m)*lanes + (k % lanes) ].
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] m
+///     The number of rows of each matrix A_k. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of each matrix A_k. n >= 0.
+///
+/// @param[in] A
+///     The batch_size matrices A_k, each lda-by-n, strideA apart.
+///
+/// @param[in] lda
+///     The leading dimension of each A_k. lda >= max(1,m).
+///
+/// @param[in] strideA
+///     Distance between the starts of A_k and A_{k+1}. strideA >= lda*n.
+///
+/// @param[in] batch_size
+///     The number of matrices. batch_size >= 0.
+///
+/// @param[out] Ai
+///     The array Ai of length ceil( batch_size / lanes ) * m*n*lanes.
+///     On exit, the matrices in interleaved layout. Lanes past batch_size
+///     in the last block are not referenced.
+///
+/// @param[in] lanes
+///     The number of interleaved matrices per block. lanes >= 1.
+///
+/// @ingroup initialize
+void batch_interleave(
+    int64_t m, int64_t n,
+    std::complex<double> const* A, int64_t lda, int64_t strideA,
+    int64_t batch_size,
+    std::complex<double>* Ai, int64_t lanes )
+{
+    impl::batch_interleave( m, n, A, lda, strideA, batch_size, Ai, lanes );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup initialize
+void batch_deinterleave(
+    int64_t m, int64_t n,
+    float const* Ai, int64_t lanes,
+    int64_t batch_size,
+    float* A, int64_t lda, int64_t strideA )
+{
+    impl::batch_deinterleave( m, n, Ai, lanes, batch_size, A, lda, strideA );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup initialize
+void batch_deinterleave(
+    int64_t m, int64_t n,
+    double const* Ai, int64_t lanes,
+    int64_t batch_size,
+    double* A, int64_t lda, int64_t strideA )
+{
+    impl::batch_deinterleave( m, n, Ai, lanes, batch_size, A, lda, strideA );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup initialize
+void batch_deinterleave(
+    int64_t m, int64_t n,
+    std::complex<float> const* Ai, int64_t lanes,
+    int64_t batch_size,
+    std::complex<float>* A, int64_t lda, int64_t strideA )
+{
+    impl::batch_deinterleave( m, n, Ai, lanes, batch_size, A, lda, strideA );
+}
+
+//------------------------------------------------------------------------------
+/// Copies a batch of m-by-n matrices from the interleaved layout back to
+/// the strided layout; the inverse of lapack::batch_interleave.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] m
+///     The number of rows of each matrix A_k. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of each matrix A_k. n >= 0.
+///
+/// @param[in] Ai
+///     The array Ai of length ceil( batch_size / lanes ) * m*n*lanes,
+///     holding the matrices in interleaved layout.
+///
+/// @param[in] lanes
+///     The number of interleaved matrices per block. lanes >= 1.
+///
+/// @param[in] batch_size
+///     The number of matrices. batch_size >= 0.
+///
+/// @param[out] A
+///     The batch_size matrices A_k, each lda-by-n, strideA apart.
+///
+/// @param[in] lda
+///     The leading dimension of each A_k. lda >= max(1,m).
+///
+/// @param[in] strideA
+///     Distance between the starts of A_k and A_{k+1}. strideA >= lda*n.
+///
+/// @ingroup initialize
+void batch_deinterleave(
+    int64_t m, int64_t n,
+    std::complex<double> const* Ai, int64_t lanes,
+    int64_t batch_size,
+    std::complex<double>* A, int64_t lda, int64_t strideA )
+{
+    impl::batch_deinterleave( m, n, Ai, lanes, batch_size, A, lda, strideA );
+}
+
+}  // namespace lapack
@@ -0,0 +1,598 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_BATCH_INTERNAL_HH
+#define LAPACK_BATCH_INTERNAL_HH
+
+#include "lapack/util.hh"
+#include "thread_pool.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <vector>
+
+namespace lapack {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Maps a matrix index in a group-form batch to its group. Matrices of
+/// group g are numbered offsets[g], ..., offsets[g+1] - 1.
+class BatchGroups
+{
+public:
+    BatchGroups( int64_t group_count, int64_t const* group_size )
+    {
+        lapack_error_if( group_count < 0 );
+        offsets_.resize( group_count + 1 );
+        offsets_[ 0 ] = 0;
+        for (int64_t g = 0; g < group_count; ++g) {
+            lapack_error_if( group_size[ g ] < 0 );
+            offsets_[ g+1 ] = offsets_[ g ] + group_size[ g ];
+        }
+    }
+
+    /// @return total number of matrices in all groups.
+    int64_t batch_size() const { return offsets_.back(); }
+
+    /// @return group of matrix i, for 0 <= i < batch_size().
+    int64_t group( int64_t i ) const
+    {
+        return std::upper_bound( offsets_.begin(), offsets_.end(), i )
+               - offsets_.begin() - 1;
+    }
+
+private:
+    std::vector< int64_t > offsets_;
+};
+
+//------------------------------------------------------------------------------
+// Interleaved ("batch-innermost") layout.
+//
+// With lanes L, matrix k of a batch is in block b = k / L, lane l = k % L.
+// Element (i, j) of an m-by-n matrix is at
+//
+//     A[ b*m*n*L + (i + j*m)*L + l ],
+//
+// so the same element of L consecutive matrices is contiguous, and the
+// kernels below vectorize across matrices: each inner loop runs over the
+// nlanes <= L lanes of one block. A partial last block has nlanes < L;
+// its remaining lanes are not referenced.
+
+/// @return number of elements in an interleaved batch of m-by-n matrices.
+inline int64_t interleaved_size(
+    int64_t m, int64_t n, int64_t lanes, int64_t batch_size )
+{
+    return ((batch_size + lanes - 1) / lanes) * m * n * lanes;
+}
+
+//------------------------------------------------------------------------------
+/// Cholesky factorization of one block of nlanes interleaved n-by-n
+/// Hermitian positive definite matrices, in place; left-looking
+/// (dot product) form. Sets info[ l ] = j+1 if the leading minor of order
+/// j+1 of lane l is not positive definite, else 0. Such a lane is
+/// continued with a unit pivot so the other lanes are not disturbed; its
+/// factor is then meaningless.
+template <typename scalar_t>
+void potrf_interleaved(
+    lapack::Uplo uplo, int64_t n, scalar_t* A, int64_t L, int64_t nlanes,
+    int64_t* info )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using blas::conj;
+    using blas::real;
+
+    // A(i, j) is the address of lane 0 of element (i, j).
+    auto a = [A, n, L]( int64_t i, int64_t j ) { return A + (i + j*n)*L; };
+
+    for (int64_t l = 0; l < nlanes; ++l)
+        info[ l ] = 0;
+
+    for (int64_t j = 0; j < n; ++j) {
+        // In lower, column j of L is A(j:n, j), and row j is A(j, 0:j).
+        // In upper, the same with row and column swapped and conjugated.
+        scalar_t* ajj = a( j, j );
+        for (int64_t k = 0; k < j; ++k) {
+            scalar_t const* ajk = (uplo == Uplo::Lower ? a( j, k ) : a( k, j ));
+            for (int64_t l = 0; l < nlanes; ++l)
+                ajj[ l ] -= real( conj( ajk[ l ] ) * ajk[ l ] );
+        }
+        for (int64_t l = 0; l < nlanes; ++l) {
+            real_t d = real( ajj[ l ] );
+            if (! (d > 0)) {  // also catches NaN
+                if (info[ l ] == 0)
+                    info[ l ] = j + 1;
+                d = 1;
+            }
+            ajj[ l ] = std::sqrt( d );
+        }
+
+        for (int64_t i = j + 1; i < n; ++i) {
+            if (uplo == Uplo::Lower) {
+                // L(i, j) = (A(i, j) - sum_k L(i, k) conj( L(j, k) )) / L(j, j)
+                scalar_t* aij = a( i, j );
+                for (int64_t k = 0; k < j; ++k) {
+                    scalar_t const* aik = a( i, k );
+                    scalar_t const* ajk = a( j, k );
+                    for (int64_t l = 0; l < nlanes; ++l)
+                        aij[ l ] -= aik[ l ] * conj( ajk[ l ] );
+                }
+                for (int64_t l = 0; l < nlanes; ++l)
+                    aij[ l ] /= real( ajj[ l ] );
+            }
+            else {
+                // U(j, i) = (A(j, i) - sum_k conj( U(k, j) ) U(k, i)) / U(j, j)
+                scalar_t* aji = a( j, i );
+                for (int64_t k = 0; k < j; ++k) {
+                    scalar_t const* aki = a( k, i );
+                    scalar_t const* akj = a( k, j );
+                    for (int64_t l = 0; l < nlanes; ++l)
+                        aji[ l ] -= conj( akj[ l ] ) * aki[ l ];
+                }
+                for (int64_t l = 0; l < nlanes; ++l)
+                    aji[ l ] /= real( ajj[ l ] );
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Solves A X = B for one block of nlanes interleaved systems, using the
+/// Cholesky factors from potrf_interleaved. B is n-by-nrhs, interleaved.
+template <typename scalar_t>
+void potrs_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t const* A, scalar_t* B, int64_t L, int64_t nlanes )
+{
+    using blas::conj;
+    using blas::real;
+
+    auto a = [A, n, L]( int64_t i, int64_t j ) { return A + (i + j*n)*L; };
+    auto b = [B, n, L]( int64_t i, int64_t j ) { return B + (i + j*n)*L; };
+
+    // With lower, A = L L^H; with upper, A = U^H U = L L^H for L = U^H.
+    // Lfac(i, k) for i >= k is the address of L(i, k), which is
+    // conj( U(k, i) ) in upper.
+    bool lower = (uplo == Uplo::Lower);
+    auto lfac = [&]( int64_t i, int64_t k ) {
+        return lower ? a( i, k ) : a( k, i );
+    };
+
+    for (int64_t c = 0; c < nrhs; ++c) {
+        // Forward solve L Y = B.
+        for (int64_t i = 0; i < n; ++i) {
+            scalar_t* bi = b( i, c );
+            for (int64_t k = 0; k < i; ++k) {
+                scalar_t const* lik = lfac( i, k );
+                scalar_t const* bk = b( k, c );
+                if (lower) {
+                    for (int64_t l = 0; l < nlanes; ++l)
+                        bi[ l ] -= lik[ l ] * bk[ l ];
+                }
+                else {
+                    for (int64_t l = 0; l < nlanes; ++l)
+                        bi[ l ] -= conj( lik[ l ] ) * bk[ l ];
+                }
+            }
+            scalar_t const* lii = a( i, i );
+            for (int64_t l = 0; l < nlanes; ++l)
+                bi[ l ] /= real( lii[ l ] );
+        }
+
+        // Back solve L^H X = Y.
+        for (int64_t i = n - 1; i >= 0; --i) {
+            scalar_t* bi = b( i, c );
+            for (int64_t k = i + 1; k < n; ++k) {
+                scalar_t const* lki = lfac( k, i );
+                scalar_t const* bk = b( k, c );
+                if (lower) {
+                    for (int64_t l = 0; l < nlanes; ++l)
+                        bi[ l ] -= conj( lki[ l ] ) * bk[ l ];
+                }
+                else {
+                    for (int64_t l = 0; l < nlanes; ++l)
+                        bi[ l ] -= lki[ l ] * bk[ l ];
+                }
+            }
+            scalar_t const* lii = a( i, i );
+            for (int64_t l = 0; l < nlanes; ++l)
+                bi[ l ] /= real( lii[ l ] );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// @return |real( x )| + |imag( x )|, as in LAPACK's cabs1.
+template <typename real_t>
+inline real_t cabs1( real_t x )
+{
+    return std::abs( x );
+}
+
+template <typename real_t>
+inline real_t cabs1( std::complex< real_t > x )
+{
+    return std::abs( std::real( x ) ) + std::abs( std::imag( x ) );
+}
+
+//------------------------------------------------------------------------------
+/// LU factorization with partial pivoting of one block of nlanes
+/// interleaved n-by-n tridiagonal matrices, in place, as in lapack::gttrf.
+/// DL, D, DU, DU2, and ipiv are interleaved vectors of lengths n-1, n,
+/// n-1, n-2, and n. The pivot choice is made per lane with selects
+/// instead of branches, so the elimination vectorizes across lanes.
+/// Sets info[ l ] = i+1 if U(i, i) of lane l is exactly zero, else 0.
+template <typename scalar_t>
+void gttrf_interleaved(
+    int64_t n, scalar_t* DL, scalar_t* D, scalar_t* DU, scalar_t* DU2,
+    int64_t* ipiv, int64_t L, int64_t nlanes, int64_t* info )
+{
+    const scalar_t zero = 0;
+    const scalar_t one  = 1;
+
+    for (int64_t i = 0; i < n - 1; ++i) {
+        scalar_t* dl  = DL + i*L;
+        scalar_t* d0  = D  + i*L;
+        scalar_t* d1  = D  + (i + 1)*L;
+        scalar_t* du0 = DU + i*L;
+        int64_t*  ip  = ipiv + i*L;
+        for (int64_t l = 0; l < nlanes; ++l) {
+            // Interchange rows i and i+1 if |D(i)| < |DL(i)|.
+            scalar_t a = d0[ l ], b = dl[ l ], c = du0[ l ], e = d1[ l ];
+            bool swap = cabs1( a ) < cabs1( b );
+            scalar_t piv  = (swap ? b : a);
+            scalar_t fact = (swap ? a : b) / (piv != zero ? piv : one);
+            d0[ l ]  = piv;
+            dl[ l ]  = fact;
+            du0[ l ] = (swap ? e : c);
+            d1[ l ]  = (swap ? c : e) - fact*(swap ? e : c);
+            ip[ l ]  = (swap ? i + 2 : i + 1);
+        }
+        // Fill-in of the interchange, in a separate pass: with all
+        // seven arrays in one loop, compilers give up on vectorizing.
+        if (i < n - 2) {
+            scalar_t* du1 = DU  + (i + 1)*L;
+            scalar_t* du2 = DU2 + i*L;
+            for (int64_t l = 0; l < nlanes; ++l) {
+                bool swap = (ip[ l ] != i + 1);
+                scalar_t f = du1[ l ];
+                du2[ l ] = (swap ? f : zero);
+                du1[ l ] = (swap ? -dl[ l ]*f : f);
+            }
+        }
+    }
+    if (n > 0) {
+        int64_t* ip = ipiv + (n - 1)*L;
+        for (int64_t l = 0; l < nlanes; ++l)
+            ip[ l ] = n;
+    }
+
+    for (int64_t l = 0; l < nlanes; ++l)
+        info[ l ] = 0;
+    for (int64_t i = 0; i < n; ++i) {
+        scalar_t const* d0 = D + i*L;
+        for (int64_t l = 0; l < nlanes; ++l) {
+            if (info[ l ] == 0 && d0[ l ] == zero)
+                info[ l ] = i + 1;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Solves op(A) X = B for one block of nlanes interleaved tridiagonal
+/// systems, using the LU factors from gttrf_interleaved, as in
+/// lapack::gttrs. B is n-by-nrhs, interleaved.
+template <typename scalar_t>
+void gttrs_interleaved(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    scalar_t const* DL, scalar_t const* D, scalar_t const* DU,
+    scalar_t const* DU2, int64_t const* ipiv,
+    scalar_t* B, int64_t L, int64_t nlanes )
+{
+    using blas::conj;
+
+    if (n == 0)
+        return;
+
+    for (int64_t c = 0; c < nrhs; ++c) {
+        // b( i ) is lane 0 of B(i, c).
+        auto b = [B, n, L, c]( int64_t i ) { return B + (i + c*n)*L; };
+
+        if (trans == Op::NoTrans) {
+            // Solve L Y = P^T B, applying interchanges as we go.
+            for (int64_t i = 0; i < n - 1; ++i) {
+                scalar_t const* dl = DL + i*L;
+                int64_t const* ip = ipiv + i*L;
+                scalar_t* b0 = b( i );
+                scalar_t* b1 = b( i + 1 );
+                for (int64_t l = 0; l < nlanes; ++l) {
+                    bool swap = (ip[ l ] != i + 1);
+                    scalar_t top = (swap ? b1[ l ] : b0[ l ]);
+                    scalar_t bot = (swap ? b0[ l ] : b1[ l ]);
+                    b0[ l ] = top;
+                    b1[ l ] = bot - dl[ l ]*top;
+                }
+            }
+
+            // Solve U X = Y.
+            for (int64_t i = n - 1; i >= 0; --i) {
+                scalar_t const* d0 = D + i*L;
+                scalar_t* b0 = b( i );
+                if (i < n - 1) {
+                    scalar_t const* du = DU + i*L;
+                    scalar_t const* b1 = b( i + 1 );
+                    for (int64_t l = 0; l < nlanes; ++l)
+                        b0[ l ] -= du[ l ]*b1[ l ];
+                }
+                if (i < n - 2) {
+                    scalar_t const* du2 = DU2 + i*L;
+                    scalar_t const* b2 = b( i + 2 );
+                    for (int64_t l = 0; l < nlanes; ++l)
+                        b0[ l ] -= du2[ l ]*b2[ l ];
+                }
+                for (int64_t l = 0; l < nlanes; ++l)
+                    b0[ l ] /= d0[ l ];
+            }
+        }
+        else {
+            // op(x) is conj( x ) for ConjTrans, x for Trans.
+            bool cj = (trans == Op::ConjTrans);
+            auto op = [cj]( scalar_t x ) { return cj ? conj( x ) : x; };
+
+            // Solve op(U) Y = B.
+            for (int64_t i = 0; i < n; ++i) {
+                scalar_t const* d0 = D + i*L;
+                scalar_t* b0 = b( i );
+                if (i > 0) {
+                    scalar_t const* du = DU + (i - 1)*L;
+                    scalar_t const* b1 = b( i - 1 );
+                    for (int64_t l = 0; l < nlanes; ++l)
+                        b0[ l ] -= op( du[ l ] )*b1[ l ];
+                }
+                if (i > 1) {
+                    scalar_t const* du2 = DU2 + (i - 2)*L;
+                    scalar_t const* b2 = b( i - 2 );
+                    for (int64_t l = 0; l < nlanes; ++l)
+                        b0[ l ] -= op( du2[ l ] )*b2[ l ];
+                }
+                for (int64_t l = 0; l < nlanes; ++l)
+                    b0[ l ] /= op( d0[ l ] );
+            }
+
+            // Solve op(L) X = Y, undoing interchanges as we go.
+            for (int64_t i = n - 2; i >= 0; --i) {
+                scalar_t const* dl = DL + i*L;
+                int64_t const* ip = ipiv + i*L;
+                scalar_t* b0 = b( i );
+                scalar_t* b1 = b( i + 1 );
+                for (int64_t l = 0; l < nlanes; ++l) {
+                    bool swap = (ip[ l ] != i + 1);
+                    scalar_t x0 = b0[ l ], x1 = b1[ l ];
+                    scalar_t t = x0 - op( dl[ l ] )*x1;
+                    b0[ l ] = (swap ? x1 : t);
+                    b1[ l ] = (swap ? t : x1);
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// L D L^H factorization of one block of nlanes interleaved n-by-n
+/// Hermitian positive definite tridiagonal matrices, in place, as in
+/// lapack::pttrf. D (real) and E are interleaved vectors of lengths n and
+/// n-1. Sets info[ l ] = i+1 if the leading minor of order i+1 of lane l
+/// is not positive definite, else 0. Such a lane is continued with a unit
+/// pivot so the other lanes are not disturbed; its factor is then
+/// meaningless.
+template <typename scalar_t>
+void pttrf_interleaved(
+    int64_t n, blas::real_type< scalar_t >* D, scalar_t* E,
+    int64_t L, int64_t nlanes, int64_t* info )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using blas::conj;
+    using blas::real;
+
+    for (int64_t l = 0; l < nlanes; ++l)
+        info[ l ] = 0;
+
+    for (int64_t i = 0; i < n; ++i) {
+        real_t* d0 = D + i*L;
+        for (int64_t l = 0; l < nlanes; ++l) {
+            real_t d = d0[ l ];
+            bool bad = ! (d > 0);  // also catches NaN
+            info[ l ] = (bad && info[ l ] == 0 ? i + 1 : info[ l ]);
+            d0[ l ] = (bad ? real_t( 1 ) : d);
+        }
+        if (i < n - 1) {
+            real_t* d1 = D + (i + 1)*L;
+            scalar_t* e0 = E + i*L;
+            for (int64_t l = 0; l < nlanes; ++l) {
+                scalar_t e = e0[ l ];
+                scalar_t f = e / d0[ l ];
+                e0[ l ] = f;
+                d1[ l ] -= real( conj( f ) * e );
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Solves A X = B for one block of nlanes interleaved tridiagonal
+/// systems, using the factors from pttrf_interleaved, as in
+/// lapack::pttrs. With uplo = Lower, A = L D L^H and E is the
+/// subdiagonal of L; with Upper, A = U^H D U and E is the superdiagonal
+/// of U. For real types the two are the same. B is n-by-nrhs, interleaved.
+template <typename scalar_t>
+void pttrs_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    blas::real_type< scalar_t > const* D, scalar_t const* E,
+    scalar_t* B, int64_t L, int64_t nlanes )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using blas::conj;
+
+    bool upper = (uplo == Uplo::Upper);
+    for (int64_t c = 0; c < nrhs; ++c) {
+        auto b = [B, n, L, c]( int64_t i ) { return B + (i + c*n)*L; };
+
+        // Solve L Y = B, where L(i, i-1) is E(i-1), or conj( E(i-1) )
+        // in upper.
+        for (int64_t i = 1; i < n; ++i) {
+            scalar_t const* e = E + (i - 1)*L;
+            scalar_t const* b1 = b( i - 1 );
+            scalar_t* b0 = b( i );
+            if (upper) {
+                for (int64_t l = 0; l < nlanes; ++l)
+                    b0[ l ] -= b1[ l ]*conj( e[ l ] );
+            }
+            else {
+                for (int64_t l = 0; l < nlanes; ++l)
+                    b0[ l ] -= b1[ l ]*e[ l ];
+            }
+        }
+
+        // Solve D L^H X = Y.
+        for (int64_t i = n - 1; i >= 0; --i) {
+            real_t const* d0 = D + i*L;
+            scalar_t* b0 = b( i );
+            if (i == n - 1) {
+                for (int64_t l = 0; l < nlanes; ++l)
+                    b0[ l ] /= d0[ l ];
+            }
+            else {
+                scalar_t const* e = E + i*L;
+                scalar_t const* b1 = b( i + 1 );
+                if (upper) {
+                    for (int64_t l = 0; l < nlanes; ++l)
+                        b0[ l ] = b0[ l ] / d0[ l ] - b1[ l ]*e[ l ];
+                }
+                else {
+                    for (int64_t l = 0; l < nlanes; ++l)
+                        b0[ l ] = b0[ l ] / d0[ l ] - b1[ l ]*conj( e[ l ] );
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Eigenvalues of the real symmetric 2-by-2 matrix [ a b; b c ], as in
+/// LAPACK's dlae2: rt1 has the larger absolute value. A native inline
+/// version, so batch loops over it can be vectorized.
+template <typename real_t>
+inline void lae2_kernel(
+    real_t a, real_t b, real_t c, real_t& rt1, real_t& rt2 )
+{
+    real_t sm = a + c;
+    real_t df = a - c;
+    real_t adf = std::abs( df );
+    real_t tb = b + b;
+    real_t ab = std::abs( tb );
+    real_t acmx = (std::abs( a ) > std::abs( c ) ? a : c);
+    real_t acmn = (std::abs( a ) > std::abs( c ) ? c : a);
+    real_t rt;
+    if (adf > ab)
+        rt = adf * std::sqrt( 1 + (ab/adf)*(ab/adf) );
+    else if (adf < ab)
+        rt = ab * std::sqrt( 1 + (adf/ab)*(adf/ab) );
+    else
+        rt = ab * std::sqrt( real_t( 2 ) );  // includes adf = ab = 0
+
+    if (sm != 0) {
+        // Order of operations important for an accurate smaller eigenvalue.
+        rt1 = real_t( 0.5 ) * (sm < 0 ? sm - rt : sm + rt);
+        rt2 = (acmx / rt1)*acmn - (b / rt1)*b;
+    }
+    else {
+        rt1 =  real_t( 0.5 ) * rt;
+        rt2 = -real_t( 0.5 ) * rt;
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Eigendecomposition of the real symmetric 2-by-2 matrix [ a b; b c ],
+/// as in LAPACK's dlaev2: rt1 has the larger absolute value, and
+/// (cs1, sn1) is its unit eigenvector.
+template <typename real_t>
+inline void laev2_kernel(
+    real_t a, real_t b, real_t c,
+    real_t& rt1, real_t& rt2, real_t& cs1, real_t& sn1 )
+{
+    real_t sm = a + c;
+    real_t df = a - c;
+    real_t adf = std::abs( df );
+    real_t tb = b + b;
+    real_t ab = std::abs( tb );
+    real_t acmx = (std::abs( a ) > std::abs( c ) ? a : c);
+    real_t acmn = (std::abs( a ) > std::abs( c ) ? c : a);
+    real_t rt;
+    if (adf > ab)
+        rt = adf * std::sqrt( 1 + (ab/adf)*(ab/adf) );
+    else if (adf < ab)
+        rt = ab * std::sqrt( 1 + (adf/ab)*(adf/ab) );
+    else
+        rt = ab * std::sqrt( real_t( 2 ) );  // includes adf = ab = 0
+
+    int sgn1;
+    if (sm != 0) {
+        // Order of operations important for an accurate smaller eigenvalue.
+        sgn1 = (sm < 0 ? -1 : 1);
+        rt1 = real_t( 0.5 ) * (sm < 0 ? sm - rt : sm + rt);
+        rt2 = (acmx / rt1)*acmn - (b / rt1)*b;
+    }
+    else {
+        sgn1 = 1;
+        rt1 =  real_t( 0.5 ) * rt;
+        rt2 = -real_t( 0.5 ) * rt;
+    }
+
+    // Compute the eigenvector.
+    int sgn2 = (df >= 0 ? 1 : -1);
+    real_t cs = (df >= 0 ? df + rt : df - rt);
+    if (std::abs( cs ) > ab) {
+        real_t ct = -tb / cs;
+        sn1 = 1 / std::sqrt( 1 + ct*ct );
+        cs1 = ct * sn1;
+    }
+    else if (ab == 0) {
+        cs1 = 1;
+        sn1 = 0;
+    }
+    else {
+        real_t tn = -cs / tb;
+        cs1 = 1 / std::sqrt( 1 + tn*tn );
+        sn1 = tn * cs1;
+    }
+    if (sgn1 == sgn2) {
+        real_t tn = cs1;
+        cs1 = -sn1;
+        sn1 = tn;
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Eigendecomposition of the Hermitian 2-by-2 matrix
+/// [ a b; conj( b ) c ], as in LAPACK's zlaev2. Only the real parts of a
+/// and c are used.
+template <typename real_t>
+inline void laev2_kernel(
+    std::complex< real_t > a, std::complex< real_t > b,
+    std::complex< real_t > c,
+    real_t& rt1, real_t& rt2, real_t& cs1, std::complex< real_t >& sn1 )
+{
+    real_t absb = std::abs( b );
+    std::complex< real_t > w = (absb == 0 ? std::complex< real_t >( 1 )
+                                          : std::conj( b ) / absb);
+    real_t t;
+    laev2_kernel( std::real( a ), absb, std::real( c ), rt1, rt2, cs1, t );
+    sn1 = w * t;
+}
+
+}  // namespace internal
+}  // namespace lapack
+
+#endif // LAPACK_BATCH_INTERNAL_HH
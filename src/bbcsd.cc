@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack_internal.hh"
 #include "lapack/fortran.h"
+#include "work_size_cache.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30300  // >= 3.3
@@ -20,7 +21,7 @@ using blas::real;
 
 // -----------------------------------------------------------------------------
 /// @ingroup bbcsd
-int64_t bbcsd(
+void bbcsd_work_size(
     lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
     float* theta,
     float* phi,
@@ -35,8 +36,17 @@ int64_t bbcsd(
     float* B21D,
     float* B21E,
     float* B22D,
-    float* B22E )
+    float* B22E,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "sbbcsd" );
+    internal::WorkSizeKey key( "sbbcsd",
+        { to_char( jobu1 ), to_char( jobu2 ), to_char( jobv1t ),
+          to_char( jobv2t ), to_char( trans ), m, p, q, ldu1, ldu2, ldv1t,
+          ldv2t } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     char jobu1_ = to_char_csd( jobu1 );
     char jobu2_ = to_char_csd( jobu2 );
     char jobv1t_ = to_char_csd( jobv1t );
@@ -54,6 +64,7 @@ int64_t bbcsd(
     // query for workspace size
     float qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_sbbcsd(
         &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
         theta,
@@ -72,13 +83,48 @@ int64_t bbcsd(
         B22E,
         qry_work, &ineg_one, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup bbcsd
+int64_t bbcsd(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    float* theta,
+    float* phi,
+    float* U1, int64_t ldu1,
+    float* U2, int64_t ldu2,
+    float* V1T, int64_t ldv1t,
+    float* V2T, int64_t ldv2t,
+    float* B11D,
+    float* B11E,
+    float* B12D,
+    float* B12E,
+    float* B21D,
+    float* B21E,
+    float* B22D,
+    float* B22E,
+    float* work, int64_t lwork )
+{
+    char jobu1_ = to_char_csd( jobu1 );
+    char jobu2_ = to_char_csd( jobu2 );
+    char jobv1t_ = to_char_csd( jobv1t );
+    char jobv2t_ = to_char_csd( jobv2t );
+    char trans_ = to_char( trans );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int q_ = to_lapack_int( q );
+    lapack_int ldu1_ = to_lapack_int( ldu1 );
+    lapack_int ldu2_ = to_lapack_int( ldu2 );
+    lapack_int ldv1t_ = to_lapack_int( ldv1t );
+    lapack_int ldv2t_ = to_lapack_int( ldv2t );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_sbbcsd(
         &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
@@ -96,7 +142,7 @@ int64_t bbcsd(
         B21E,
         B22D,
         B22E,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -107,6 +153,43 @@ int64_t bbcsd(
 // -----------------------------------------------------------------------------
 /// @ingroup bbcsd
 int64_t bbcsd(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    float* theta,
+    float* phi,
+    float* U1, int64_t ldu1,
+    float* U2, int64_t ldu2,
+    float* V1T, int64_t ldv1t,
+    float* V2T, int64_t ldv2t,
+    float* B11D,
+    float* B11E,
+    float* B12D,
+    float* B12E,
+    float* B21D,
+    float* B21E,
+    float* B22D,
+    float* B22E )
+{
+    internal::StatsScope stats_scope( "sbbcsd" );
+    int64_t lwork;
+    bbcsd_work_size(
+        jobu1, jobu2, jobv1t, jobv2t, trans, m, p, q, theta, phi, U1, ldu1, U2,
+        ldu2, V1T, ldv1t, V2T, ldv2t, B11D, B11E, B12D, B12E, B21D, B21E, B22D,
+        B22E,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return bbcsd(
+        jobu1, jobu2, jobv1t, jobv2t, trans, m, p, q, theta, phi, U1, ldu1, U2,
+        ldu2, V1T, ldv1t, V2T, ldv2t, B11D, B11E, B12D, B12E, B21D, B21E, B22D,
+        B22E,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup bbcsd
+void bbcsd_work_size(
     lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
     double* theta,
     double* phi,
@@ -121,8 +204,17 @@ int64_t bbcsd(
     double* B21D,
     double* B21E,
     double* B22D,
-    double* B22E )
+    double* B22E,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "dbbcsd" );
+    internal::WorkSizeKey key( "dbbcsd",
+        { to_char( jobu1 ), to_char( jobu2 ), to_char( jobv1t ),
+          to_char( jobv2t ), to_char( trans ), m, p, q, ldu1, ldu2, ldv1t,
+          ldv2t } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     char jobu1_ = to_char_csd( jobu1 );
     char jobu2_ = to_char_csd( jobu2 );
     char jobv1t_ = to_char_csd( jobv1t );
@@ -140,6 +232,7 @@ int64_t bbcsd(
     // query for workspace size
     double qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_dbbcsd(
         &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
         theta,
@@ -158,13 +251,48 @@ int64_t bbcsd(
         B22E,
         qry_work, &ineg_one, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup bbcsd
+int64_t bbcsd(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    double* theta,
+    double* phi,
+    double* U1, int64_t ldu1,
+    double* U2, int64_t ldu2,
+    double* V1T, int64_t ldv1t,
+    double* V2T, int64_t ldv2t,
+    double* B11D,
+    double* B11E,
+    double* B12D,
+    double* B12E,
+    double* B21D,
+    double* B21E,
+    double* B22D,
+    double* B22E,
+    double* work, int64_t lwork )
+{
+    char jobu1_ = to_char_csd( jobu1 );
+    char jobu2_ = to_char_csd( jobu2 );
+    char jobv1t_ = to_char_csd( jobv1t );
+    char jobv2t_ = to_char_csd( jobv2t );
+    char trans_ = to_char( trans );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int q_ = to_lapack_int( q );
+    lapack_int ldu1_ = to_lapack_int( ldu1 );
+    lapack_int ldu2_ = to_lapack_int( ldu2 );
+    lapack_int ldv1t_ = to_lapack_int( ldv1t );
+    lapack_int ldv2t_ = to_lapack_int( ldv2t );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_dbbcsd(
         &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
@@ -182,7 +310,7 @@ int64_t bbcsd(
         B21E,
         B22D,
         B22E,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -193,6 +321,43 @@ int64_t bbcsd(
 // -----------------------------------------------------------------------------
 /// @ingroup bbcsd
 int64_t bbcsd(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    double* theta,
+    double* phi,
+    double* U1, int64_t ldu1,
+    double* U2, int64_t ldu2,
+    double* V1T, int64_t ldv1t,
+    double* V2T, int64_t ldv2t,
+    double* B11D,
+    double* B11E,
+    double* B12D,
+    double* B12E,
+    double* B21D,
+    double* B21E,
+    double* B22D,
+    double* B22E )
+{
+    internal::StatsScope stats_scope( "dbbcsd" );
+    int64_t lwork;
+    bbcsd_work_size(
+        jobu1, jobu2, jobv1t, jobv2t, trans, m, p, q, theta, phi, U1, ldu1, U2,
+        ldu2, V1T, ldv1t, V2T, ldv2t, B11D, B11E, B12D, B12E, B21D, B21E, B22D,
+        B22E,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return bbcsd(
+        jobu1, jobu2, jobv1t, jobv2t, trans, m, p, q, theta, phi, U1, ldu1, U2,
+        ldu2, V1T, ldv1t, V2T, ldv2t, B11D, B11E, B12D, B12E, B21D, B21E, B22D,
+        B22E,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup bbcsd
+void bbcsd_work_size(
     lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
     float* theta,
     float* phi,
@@ -207,8 +372,17 @@ int64_t bbcsd(
     float* B21D,
     float* B21E,
     float* B22D,
-    float* B22E )
+    float* B22E,
+    int64_t* lrwork )
 {
+    internal::StatsScope stats_scope( "cbbcsd" );
+    internal::WorkSizeKey key( "cbbcsd",
+        { to_char( jobu1 ), to_char( jobu2 ), to_char( jobv1t ),
+          to_char( jobv2t ), to_char( trans ), m, p, q, ldu1, ldu2, ldv1t,
+          ldv2t } );
+    if (internal::work_size_cache_find( key, nullptr, lrwork ))
+        return;
+
     char jobu1_ = to_char_csd( jobu1 );
     char jobu2_ = to_char_csd( jobu2 );
     char jobv1t_ = to_char_csd( jobv1t );
@@ -226,6 +400,7 @@ int64_t bbcsd(
     // query for workspace size
     float qry_rwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_cbbcsd(
         &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
         theta,
@@ -244,13 +419,48 @@ int64_t bbcsd(
         B22E,
         qry_rwork, &ineg_one, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lrwork_ = real(qry_rwork[0]);
+    *lrwork = real(qry_rwork[0]);
+    internal::work_size_cache_insert( key, 0, *lrwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > rwork( lrwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup bbcsd
+int64_t bbcsd(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    float* theta,
+    float* phi,
+    std::complex<float>* U1, int64_t ldu1,
+    std::complex<float>* U2, int64_t ldu2,
+    std::complex<float>* V1T, int64_t ldv1t,
+    std::complex<float>* V2T, int64_t ldv2t,
+    float* B11D,
+    float* B11E,
+    float* B12D,
+    float* B12E,
+    float* B21D,
+    float* B21E,
+    float* B22D,
+    float* B22E,
+    float* rwork, int64_t lrwork )
+{
+    char jobu1_ = to_char_csd( jobu1 );
+    char jobu2_ = to_char_csd( jobu2 );
+    char jobv1t_ = to_char_csd( jobv1t );
+    char jobv2t_ = to_char_csd( jobv2t );
+    char trans_ = to_char( trans );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int q_ = to_lapack_int( q );
+    lapack_int ldu1_ = to_lapack_int( ldu1 );
+    lapack_int ldu2_ = to_lapack_int( ldu2 );
+    lapack_int ldv1t_ = to_lapack_int( ldv1t );
+    lapack_int ldv2t_ = to_lapack_int( ldv2t );
+    lapack_int lrwork_ = to_lapack_int( lrwork );
+    lapack_int info_ = 0;
 
     LAPACK_cbbcsd(
         &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
@@ -268,7 +478,192 @@ int64_t bbcsd(
         B21E,
         B22D,
         B22E,
-        &rwork[0], &lrwork_, &info_
+        rwork, &lrwork_, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup bbcsd
+int64_t bbcsd(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    float* theta,
+    float* phi,
+    std::complex<float>* U1, int64_t ldu1,
+    std::complex<float>* U2, int64_t ldu2,
+    std::complex<float>* V1T, int64_t ldv1t,
+    std::complex<float>* V2T, int64_t ldv2t,
+    float* B11D,
+    float* B11E,
+    float* B12D,
+    float* B12E,
+    float* B21D,
+    float* B21E,
+    float* B22D,
+    float* B22E )
+{
+    internal::StatsScope stats_scope( "cbbcsd" );
+    int64_t lrwork;
+    bbcsd_work_size(
+        jobu1, jobu2, jobv1t, jobv2t, trans, m, p, q, theta, phi, U1, ldu1, U2,
+        ldu2, V1T, ldv1t, V2T, ldv2t, B11D, B11E, B12D, B12E, B21D, B21E, B22D,
+        B22E,
+        &lrwork );
+
+    // allocate workspace
+    lapack::vector< float > rwork( lrwork );
+
+    return bbcsd(
+        jobu1, jobu2, jobv1t, jobv2t, trans, m, p, q, theta, phi, U1, ldu1, U2,
+        ldu2, V1T, ldv1t, V2T, ldv2t, B11D, B11E, B12D, B12E, B21D, B21E, B22D,
+        B22E,
+        &rwork[0], lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::bbcsd with caller-supplied workspace.
+/// Arguments are the same as for lapack::bbcsd; the matrices are not
+/// modified. The sizes can be reused for any call of the same shape.
+///
+/// @param[out] lrwork
+///     Required length of the rwork array.
+///
+/// @ingroup bbcsd
+void bbcsd_work_size(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    double* theta,
+    double* phi,
+    std::complex<double>* U1, int64_t ldu1,
+    std::complex<double>* U2, int64_t ldu2,
+    std::complex<double>* V1T, int64_t ldv1t,
+    std::complex<double>* V2T, int64_t ldv2t,
+    double* B11D,
+    double* B11E,
+    double* B12D,
+    double* B12E,
+    double* B21D,
+    double* B21E,
+    double* B22D,
+    double* B22E,
+    int64_t* lrwork )
+{
+    internal::StatsScope stats_scope( "zbbcsd" );
+    internal::WorkSizeKey key( "zbbcsd",
+        { to_char( jobu1 ), to_char( jobu2 ), to_char( jobv1t ),
+          to_char( jobv2t ), to_char( trans ), m, p, q, ldu1, ldu2, ldv1t,
+          ldv2t } );
+    if (internal::work_size_cache_find( key, nullptr, lrwork ))
+        return;
+
+    char jobu1_ = to_char_csd( jobu1 );
+    char jobu2_ = to_char_csd( jobu2 );
+    char jobv1t_ = to_char_csd( jobv1t );
+    char jobv2t_ = to_char_csd( jobv2t );
+    char trans_ = to_char( trans );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int q_ = to_lapack_int( q );
+    lapack_int ldu1_ = to_lapack_int( ldu1 );
+    lapack_int ldu2_ = to_lapack_int( ldu2 );
+    lapack_int ldv1t_ = to_lapack_int( ldv1t );
+    lapack_int ldv2t_ = to_lapack_int( ldv2t );
+    lapack_int info_ = 0;
+
+    // query for workspace size
+    double qry_rwork[1];
+    lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
+    LAPACK_zbbcsd(
+        &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
+        theta,
+        phi,
+        (lapack_complex_double*) U1, &ldu1_,
+        (lapack_complex_double*) U2, &ldu2_,
+        (lapack_complex_double*) V1T, &ldv1t_,
+        (lapack_complex_double*) V2T, &ldv2t_,
+        B11D,
+        B11E,
+        B12D,
+        B12E,
+        B21D,
+        B21E,
+        B22D,
+        B22E,
+        qry_rwork, &ineg_one, &info_
+    );
+    query_timer.stop();
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lrwork = real(qry_rwork[0]);
+    internal::work_size_cache_insert( key, 0, *lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::bbcsd with caller-supplied workspace, which
+/// skips the internal workspace query and allocation. Other arguments
+/// are the same as for lapack::bbcsd.
+///
+/// @param[out] rwork
+///     Workspace of length lrwork.
+///
+/// @param[in] lrwork
+///     Length of rwork, at least as returned by lapack::bbcsd_work_size.
+///
+/// @ingroup bbcsd
+int64_t bbcsd(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    double* theta,
+    double* phi,
+    std::complex<double>* U1, int64_t ldu1,
+    std::complex<double>* U2, int64_t ldu2,
+    std::complex<double>* V1T, int64_t ldv1t,
+    std::complex<double>* V2T, int64_t ldv2t,
+    double* B11D,
+    double* B11E,
+    double* B12D,
+    double* B12E,
+    double* B21D,
+    double* B21E,
+    double* B22D,
+    double* B22E,
+    double* rwork, int64_t lrwork )
+{
+    char jobu1_ = to_char_csd( jobu1 );
+    char jobu2_ = to_char_csd( jobu2 );
+    char jobv1t_ = to_char_csd( jobv1t );
+    char jobv2t_ = to_char_csd( jobv2t );
+    char trans_ = to_char( trans );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int q_ = to_lapack_int( q );
+    lapack_int ldu1_ = to_lapack_int( ldu1 );
+    lapack_int ldu2_ = to_lapack_int( ldu2 );
+    lapack_int ldv1t_ = to_lapack_int( ldv1t );
+    lapack_int ldv2t_ = to_lapack_int( ldv2t );
+    lapack_int lrwork_ = to_lapack_int( lrwork );
+    lapack_int info_ = 0;
+
+    LAPACK_zbbcsd(
+        &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
+        theta,
+        phi,
+        (lapack_complex_double*) U1, &ldu1_,
+        (lapack_complex_double*) U2, &ldu2_,
+        (lapack_complex_double*) V1T, &ldv1t_,
+        (lapack_complex_double*) V2T, &ldv2t_,
+        B11D,
+        B11E,
+        B12D,
+        B12E,
+        B21D,
+        B21E,
+        B22D,
+        B22E,
+        rwork, &lrwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -480,71 +875,22 @@ int64_t bbcsd(
     double* B22D,
     double* B22E )
 {
-    char jobu1_ = to_char_csd( jobu1 );
-    char jobu2_ = to_char_csd( jobu2 );
-    char jobv1t_ = to_char_csd( jobv1t );
-    char jobv2t_ = to_char_csd( jobv2t );
-    char trans_ = to_char( trans );
-    lapack_int m_ = to_lapack_int( m );
-    lapack_int p_ = to_lapack_int( p );
-    lapack_int q_ = to_lapack_int( q );
-    lapack_int ldu1_ = to_lapack_int( ldu1 );
-    lapack_int ldu2_ = to_lapack_int( ldu2 );
-    lapack_int ldv1t_ = to_lapack_int( ldv1t );
-    lapack_int ldv2t_ = to_lapack_int( ldv2t );
-    lapack_int info_ = 0;
-
-    // query for workspace size
-    double qry_rwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zbbcsd(
-        &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
-        theta,
-        phi,
-        (lapack_complex_double*) U1, &ldu1_,
-        (lapack_complex_double*) U2, &ldu2_,
-        (lapack_complex_double*) V1T, &ldv1t_,
-        (lapack_complex_double*) V2T, &ldv2t_,
-        B11D,
-        B11E,
-        B12D,
-        B12E,
-        B21D,
-        B21E,
-        B22D,
+    internal::StatsScope stats_scope( "zbbcsd" );
+    int64_t lrwork;
+    bbcsd_work_size(
+        jobu1, jobu2, jobv1t, jobv2t, trans, m, p, q, theta, phi, U1, ldu1, U2,
+        ldu2, V1T, ldv1t, V2T, ldv2t, B11D, B11E, B12D, B12E, B21D, B21E, B22D,
         B22E,
-        qry_rwork, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lrwork_ = real(qry_rwork[0]);
+        &lrwork );
 
     // allocate workspace
-    lapack::vector< double > rwork( lrwork_ );
+    lapack::vector< double > rwork( lrwork );
 
-    LAPACK_zbbcsd(
-        &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
-        theta,
-        phi,
-        (lapack_complex_double*) U1, &ldu1_,
-        (lapack_complex_double*) U2, &ldu2_,
-        (lapack_complex_double*) V1T, &ldv1t_,
-        (lapack_complex_double*) V2T, &ldv2t_,
-        B11D,
-        B11E,
-        B12D,
-        B12E,
-        B21D,
-        B21E,
-        B22D,
+    return bbcsd(
+        jobu1, jobu2, jobv1t, jobv2t, trans, m, p, q, theta, phi, U1, ldu1, U2,
+        ldu2, V1T, ldv1t, V2T, ldv2t, B11D, B11E, B12D, B12E, B21D, B21E, B22D,
         B22E,
-        &rwork[0], &lrwork_, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+        &rwork[0], lrwork );
 }
 
 }  // namespace lapack
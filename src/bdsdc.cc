@@ -27,6 +27,7 @@ int64_t bdsdc(
     float* Q,
     int64_t* IQ )
 {
+    internal::StatsScope stats_scope( "sbdsdc" );
     char uplo_ = to_char( uplo );
     char compq_ = to_char_comp( compq );
     lapack_int n_ = to_lapack_int( n );
@@ -187,6 +188,7 @@ int64_t bdsdc(
     double* Q,
     int64_t* IQ )
 {
+    internal::StatsScope stats_scope( "dbdsdc" );
     char uplo_ = to_char( uplo );
     char compq_ = to_char_comp( compq );
     lapack_int n_ = to_lapack_int( n );
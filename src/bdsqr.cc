@@ -26,6 +26,7 @@ int64_t bdsqr(
     float* U, int64_t ldu,
     float* C, int64_t ldc )
 {
+    internal::StatsScope stats_scope( "sbdsqr" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ncvt_ = to_lapack_int( ncvt );
@@ -64,6 +65,7 @@ int64_t bdsqr(
     double* U, int64_t ldu,
     double* C, int64_t ldc )
 {
+    internal::StatsScope stats_scope( "dbdsqr" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ncvt_ = to_lapack_int( ncvt );
@@ -102,6 +104,7 @@ int64_t bdsqr(
     std::complex<float>* U, int64_t ldu,
     std::complex<float>* C, int64_t ldc )
 {
+    internal::StatsScope stats_scope( "cbdsqr" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ncvt_ = to_lapack_int( ncvt );
@@ -239,6 +242,7 @@ int64_t bdsqr(
     std::complex<double>* U, int64_t ldu,
     std::complex<double>* C, int64_t ldc )
 {
+    internal::StatsScope stats_scope( "zbdsqr" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ncvt_ = to_lapack_int( ncvt );
@@ -28,6 +28,7 @@ int64_t bdsvdx(
     float* S,
     float* Z, int64_t ldz )
 {
+    internal::StatsScope stats_scope( "sbdsvdx" );
     char uplo_ = to_char( uplo );
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
@@ -196,6 +197,7 @@ int64_t bdsvdx(
     double* S,
     double* Z, int64_t ldz )
 {
+    internal::StatsScope stats_scope( "dbdsvdx" );
     char uplo_ = to_char( uplo );
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
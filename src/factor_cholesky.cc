@@ -0,0 +1,176 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/factor.hh"
+#include "lapack_internal.hh"
+
+namespace lapack {
+
+using blas::max;
+using blas::conj;
+using blas::real;
+
+//------------------------------------------------------------------------------
+/// Copies and factors the uplo triangle of the n-by-n Hermitian matrix A;
+/// see factor.
+///
+/// @param[in] uplo
+///     Whether the upper or lower triangle of A is stored and factored.
+///
+/// @param[in] n
+///     The order of the matrix A. n >= 0.
+///
+/// @param[in] A
+///     The n-by-n Hermitian matrix A, stored in an lda-by-n array.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+template <typename scalar_t>
+Cholesky< scalar_t >::Cholesky(
+    Uplo uplo, int64_t n, scalar_t const* A, int64_t lda )
+    : uplo_( uplo ),
+      n_( n ),
+      info_( 0 ),
+      anorm_( 0 ),
+      rcond_( 0 )
+{
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+
+    F_.resize( max( 1, n*n ) );
+    factor( A, lda );
+}
+
+//------------------------------------------------------------------------------
+/// Factors a new n-by-n Hermitian matrix A, replacing the previous
+/// factor, and updates anorm and rcond.
+///
+/// @param[in] A
+///     The n-by-n Hermitian matrix A, stored in an lda-by-n array.
+///     Only the uplo triangle is referenced.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @return info: 0, or i > 0 if the leading minor of order i is not
+///     positive definite.
+///
+template <typename scalar_t>
+int64_t Cholesky< scalar_t >::factor(
+    scalar_t const* A, int64_t lda )
+{
+    lapack_error_if( lda < max( 1, n_ ) );
+
+    info_ = 0;
+    anorm_ = 0;
+    rcond_ = 1;
+    if (n_ == 0)
+        return 0;
+
+    MatrixType mtype = (uplo_ == Uplo::Lower ? MatrixType::Lower
+                                             : MatrixType::Upper);
+    lapack::laset( MatrixType::General, n_, n_, 0.0, 0.0, F_.data(), n_ );
+    lapack::lacpy( mtype, n_, n_, A, lda, F_.data(), n_ );
+    anorm_ = lapack::lanhe( Norm::One, uplo_, n_, F_.data(), n_ );
+    info_ = lapack::potrf( uplo_, n_, F_.data(), n_ );
+    rcond_ = 0;
+    if (info_ == 0) {
+        lapack::pocon( uplo_, n_, F_.data(), n_, anorm_, &rcond_ );
+    }
+    return info_;
+}
+
+//------------------------------------------------------------------------------
+/// Solves $A X = B$ with the factor, by potrs.
+///
+/// @param[in] nrhs
+///     The number of right hand sides. nrhs >= 0.
+///
+/// @param[in,out] B
+///     On entry, the n-by-nrhs matrix B, stored in an ldb-by-nrhs array.
+///     On exit, if return value = 0, the solution X.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B. ldb >= max(1,n).
+///
+/// @return info: 0, or i > 0 if A is not positive definite; B is
+///     unchanged.
+///
+template <typename scalar_t>
+int64_t Cholesky< scalar_t >::solve(
+    int64_t nrhs, scalar_t* B, int64_t ldb ) const
+{
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( ldb < max( 1, n_ ) );
+
+    if (info_ != 0)
+        return info_;
+    if (n_ == 0 || nrhs == 0)
+        return 0;
+    return lapack::potrs( uplo_, n_, nrhs, F_.data(), n_, B, ldb );
+}
+
+//------------------------------------------------------------------------------
+/// Computes $A^{-1}$ by potri, and fills in both triangles.
+///
+/// @param[out] Ainv
+///     The n-by-n Hermitian inverse, stored in an ldainv-by-n array.
+///
+/// @param[in] ldainv
+///     The leading dimension of the array Ainv. ldainv >= max(1,n).
+///
+/// @return info: 0, or i > 0 if A is not positive definite; Ainv is
+///     not set.
+///
+template <typename scalar_t>
+int64_t Cholesky< scalar_t >::inverse(
+    scalar_t* Ainv, int64_t ldainv ) const
+{
+    lapack_error_if( ldainv < max( 1, n_ ) );
+
+    if (info_ != 0)
+        return info_;
+    if (n_ == 0)
+        return 0;
+    lapack::lacpy( MatrixType::General, n_, n_, F_.data(), n_, Ainv, ldainv );
+    int64_t info = lapack::potri( uplo_, n_, Ainv, ldainv );
+    for (int64_t j = 0; j < n_; ++j) {
+        for (int64_t i = j+1; i < n_; ++i) {
+            if (uplo_ == Uplo::Lower)
+                Ainv[ j + i*ldainv ] = conj( Ainv[ i + j*ldainv ] );
+            else
+                Ainv[ i + j*ldainv ] = conj( Ainv[ j + i*ldainv ] );
+        }
+    }
+    return info;
+}
+
+//------------------------------------------------------------------------------
+/// @return det( A ) = prod | F(i,i) |^2. It may overflow or underflow
+/// for large n; 0 if A is not positive definite.
+///
+template <typename scalar_t>
+blas::real_type< scalar_t > Cholesky< scalar_t >::det() const
+{
+    if (info_ != 0)
+        return 0;
+    real_t d = 1;
+    for (int64_t i = 0; i < n_; ++i) {
+        real_t fii = real( F_[ i + i*n_ ] );
+        d *= fii * fii;
+    }
+    return d;
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template class Cholesky< float >;
+template class Cholesky< double >;
+template class Cholesky< std::complex<float> >;
+template class Cholesky< std::complex<double> >;
+
+}  // namespace lapack
@@ -0,0 +1,178 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/factor.hh"
+#include "lapack_internal.hh"
+
+namespace lapack {
+
+using blas::max;
+using blas::real;
+
+//------------------------------------------------------------------------------
+/// Copies and factors the uplo triangle of the n-by-n Hermitian matrix A;
+/// see factor.
+///
+/// @param[in] uplo
+///     Whether the upper or lower triangle of A is stored and factored.
+///
+/// @param[in] n
+///     The order of the matrix A. n >= 0.
+///
+/// @param[in] A
+///     The n-by-n Hermitian matrix A, stored in an lda-by-n array.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+template <typename scalar_t>
+LDLT< scalar_t >::LDLT(
+    Uplo uplo, int64_t n, scalar_t const* A, int64_t lda )
+    : uplo_( uplo ),
+      n_( n ),
+      info_( 0 ),
+      anorm_( 0 ),
+      rcond_( 0 )
+{
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+
+    F_.resize( max( 1, n*n ) );
+    ipiv_.resize( max( 1, n ) );
+    factor( A, lda );
+}
+
+//------------------------------------------------------------------------------
+/// Factors a new n-by-n Hermitian matrix A, replacing the previous
+/// factors, and updates anorm and rcond.
+///
+/// @param[in] A
+///     The n-by-n Hermitian matrix A, stored in an lda-by-n array.
+///     Only the uplo triangle is referenced.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @return info: 0, or i > 0 if D(i,i) is exactly zero.
+///
+template <typename scalar_t>
+int64_t LDLT< scalar_t >::factor(
+    scalar_t const* A, int64_t lda )
+{
+    lapack_error_if( lda < max( 1, n_ ) );
+
+    info_ = 0;
+    anorm_ = 0;
+    rcond_ = 1;
+    if (n_ == 0)
+        return 0;
+
+    MatrixType mtype = (uplo_ == Uplo::Lower ? MatrixType::Lower
+                                             : MatrixType::Upper);
+    lapack::laset( MatrixType::General, n_, n_, 0.0, 0.0, F_.data(), n_ );
+    lapack::lacpy( mtype, n_, n_, A, lda, F_.data(), n_ );
+    anorm_ = lapack::lanhe( Norm::One, uplo_, n_, F_.data(), n_ );
+    info_ = lapack::hetrf( uplo_, n_, F_.data(), n_, ipiv_.data() );
+    rcond_ = 0;
+    if (info_ == 0) {
+        lapack::hecon( uplo_, n_, F_.data(), n_, ipiv_.data(), anorm_,
+                       &rcond_ );
+    }
+    return info_;
+}
+
+//------------------------------------------------------------------------------
+/// Solves $A X = B$ with the factors, by hetrs.
+///
+/// @param[in] nrhs
+///     The number of right hand sides. nrhs >= 0.
+///
+/// @param[in,out] B
+///     On entry, the n-by-nrhs matrix B, stored in an ldb-by-nrhs array.
+///     On exit, if return value = 0, the solution X.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B. ldb >= max(1,n).
+///
+/// @return info: 0, or i > 0 if D(i,i) is exactly zero; B is unchanged.
+///
+template <typename scalar_t>
+int64_t LDLT< scalar_t >::solve(
+    int64_t nrhs, scalar_t* B, int64_t ldb ) const
+{
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( ldb < max( 1, n_ ) );
+
+    if (info_ != 0)
+        return info_;
+    if (n_ == 0 || nrhs == 0)
+        return 0;
+    return lapack::hetrs( uplo_, n_, nrhs, F_.data(), n_, ipiv_.data(),
+                          B, ldb );
+}
+
+//------------------------------------------------------------------------------
+/// Computes $A^{-1}$, by solving with the identity, so both triangles
+/// are set. The factors are kept, unlike hetri, which overwrites them.
+///
+/// @param[out] Ainv
+///     The n-by-n Hermitian inverse, stored in an ldainv-by-n array.
+///
+/// @param[in] ldainv
+///     The leading dimension of the array Ainv. ldainv >= max(1,n).
+///
+/// @return info: 0, or i > 0 if D(i,i) is exactly zero; Ainv is not set.
+///
+template <typename scalar_t>
+int64_t LDLT< scalar_t >::inverse(
+    scalar_t* Ainv, int64_t ldainv ) const
+{
+    lapack_error_if( ldainv < max( 1, n_ ) );
+
+    if (info_ != 0)
+        return info_;
+    lapack::laset( MatrixType::General, n_, n_, 0.0, 1.0, Ainv, ldainv );
+    return solve( n_, Ainv, ldainv );
+}
+
+//------------------------------------------------------------------------------
+/// @return det( A ) = det( D ), the product of the determinants of the
+/// 1-by-1 and 2-by-2 diagonal blocks of D. It may overflow or underflow
+/// for large n.
+///
+template <typename scalar_t>
+blas::real_type< scalar_t > LDLT< scalar_t >::det() const
+{
+    real_t d = 1;
+    int64_t k = 0;
+    while (k < n_) {
+        real_t akk = real( F_[ k + k*n_ ] );
+        if (ipiv_[ k ] > 0) {
+            d *= akk;
+            k += 1;
+        }
+        else {
+            // 2-by-2 block in rows and columns k and k+1, marked by
+            // negative ipiv in both; its off-diagonal is in the uplo
+            // triangle.
+            real_t ak1 = real( F_[ (k+1) + (k+1)*n_ ] );
+            scalar_t b = (uplo_ == Uplo::Lower ? F_[ (k+1) + k*n_ ]
+                                               : F_[ k + (k+1)*n_ ]);
+            d *= akk*ak1 - std::norm( b );
+            k += 2;
+        }
+    }
+    return d;
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template class LDLT< float >;
+template class LDLT< double >;
+template class LDLT< std::complex<float> >;
+template class LDLT< std::complex<double> >;
+
+}  // namespace lapack
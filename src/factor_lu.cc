@@ -0,0 +1,155 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/factor.hh"
+#include "lapack_internal.hh"
+
+namespace lapack {
+
+using blas::max;
+
+//------------------------------------------------------------------------------
+/// Copies and factors the n-by-n matrix A; see factor.
+///
+/// @param[in] n
+///     The order of the matrix A. n >= 0.
+///
+/// @param[in] A
+///     The n-by-n matrix A, stored in an lda-by-n array.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+template <typename scalar_t>
+LU< scalar_t >::LU(
+    int64_t n, scalar_t const* A, int64_t lda )
+    : n_( n ),
+      info_( 0 ),
+      anorm_( 0 ),
+      rcond_( 0 )
+{
+    lapack_error_if( n < 0 );
+
+    LU_.resize( max( 1, n*n ) );
+    ipiv_.resize( max( 1, n ) );
+    factor( A, lda );
+}
+
+//------------------------------------------------------------------------------
+/// Factors a new n-by-n matrix A, replacing the previous factors, and
+/// updates anorm and rcond.
+///
+/// @param[in] A
+///     The n-by-n matrix A, stored in an lda-by-n array.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @return info: 0, or i > 0 if U(i,i) is exactly zero.
+///
+template <typename scalar_t>
+int64_t LU< scalar_t >::factor(
+    scalar_t const* A, int64_t lda )
+{
+    lapack_error_if( lda < max( 1, n_ ) );
+
+    info_ = 0;
+    anorm_ = 0;
+    rcond_ = 1;
+    if (n_ == 0)
+        return 0;
+
+    lapack::lacpy( MatrixType::General, n_, n_, A, lda, LU_.data(), n_ );
+    anorm_ = lapack::lange( Norm::One, n_, n_, LU_.data(), n_ );
+    info_ = lapack::getrf( n_, n_, LU_.data(), n_, ipiv_.data() );
+    rcond_ = 0;
+    if (info_ == 0) {
+        lapack::gecon( Norm::One, n_, LU_.data(), n_, anorm_, &rcond_ );
+    }
+    return info_;
+}
+
+//------------------------------------------------------------------------------
+/// Solves $op(A) X = B$ with the factors, by getrs.
+///
+/// @param[in] nrhs
+///     The number of right hand sides. nrhs >= 0.
+///
+/// @param[in,out] B
+///     On entry, the n-by-nrhs matrix B, stored in an ldb-by-nrhs array.
+///     On exit, if return value = 0, the solution X.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B. ldb >= max(1,n).
+///
+/// @param[in] trans
+///     The form of the system: op(A) = A, A^T, or A^H.
+///
+/// @return info: 0, or i > 0 if U(i,i) is exactly zero; B is unchanged.
+///
+template <typename scalar_t>
+int64_t LU< scalar_t >::solve(
+    int64_t nrhs, scalar_t* B, int64_t ldb, Op trans ) const
+{
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( ldb < max( 1, n_ ) );
+
+    if (info_ != 0)
+        return info_;
+    if (n_ == 0 || nrhs == 0)
+        return 0;
+    return lapack::getrs( trans, n_, nrhs, LU_.data(), n_, ipiv_.data(),
+                          B, ldb );
+}
+
+//------------------------------------------------------------------------------
+/// Computes $A^{-1}$, by solving with the identity. The factors are
+/// kept, unlike getri, which overwrites them.
+///
+/// @param[out] Ainv
+///     The n-by-n inverse, stored in an ldainv-by-n array.
+///
+/// @param[in] ldainv
+///     The leading dimension of the array Ainv. ldainv >= max(1,n).
+///
+/// @return info: 0, or i > 0 if U(i,i) is exactly zero; Ainv is not set.
+///
+template <typename scalar_t>
+int64_t LU< scalar_t >::inverse(
+    scalar_t* Ainv, int64_t ldainv ) const
+{
+    lapack_error_if( ldainv < max( 1, n_ ) );
+
+    if (info_ != 0)
+        return info_;
+    lapack::laset( MatrixType::General, n_, n_, 0.0, 1.0, Ainv, ldainv );
+    return solve( n_, Ainv, ldainv );
+}
+
+//------------------------------------------------------------------------------
+/// @return det( A ) = det( P ) prod U(i,i). It may overflow or
+/// underflow for large n; 0 if U is singular.
+///
+template <typename scalar_t>
+scalar_t LU< scalar_t >::det() const
+{
+    scalar_t d = 1;
+    for (int64_t i = 0; i < n_; ++i) {
+        d *= LU_[ i + i*n_ ];
+        if (ipiv_[ i ] != i + 1)
+            d = -d;
+    }
+    return d;
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template class LU< float >;
+template class LU< double >;
+template class LU< std::complex<float> >;
+template class LU< std::complex<double> >;
+
+}  // namespace lapack
@@ -0,0 +1,197 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/factor.hh"
+#include "lapack_internal.hh"
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+using blas::conj;
+
+// Right-hand sides per unmqr call, which sizes the workspace.
+static constexpr int64_t rhs_block = 32;
+
+//------------------------------------------------------------------------------
+/// Copies and factors the m-by-n matrix A; see factor.
+///
+/// @param[in] m
+///     The number of rows of the matrix A. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of the matrix A. 0 <= n <= m.
+///
+/// @param[in] A
+///     The m-by-n matrix A, stored in an lda-by-n array.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,m).
+///
+template <typename scalar_t>
+QR< scalar_t >::QR(
+    int64_t m, int64_t n, scalar_t const* A, int64_t lda )
+    : m_( m ),
+      n_( n ),
+      info_( 0 ),
+      anorm_( 0 ),
+      rcond_( 0 )
+{
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 || n > m );
+
+    QR_.resize( max( 1, m*n ) );
+    tau_.resize( max( 1, n ) );
+
+    // One workspace serves both geqrf and unmqr on rhs_block columns.
+    int64_t lwork = 1;
+    if (n > 0) {
+        int64_t lwork_qrf, lwork_mqr;
+        lapack::geqrf_work_size( m, n, QR_.data(), m, tau_.data(),
+                                 &lwork_qrf );
+        lapack::unmqr_work_size( Side::Left, Op::ConjTrans, m, rhs_block, n,
+                                 QR_.data(), m, tau_.data(), QR_.data(), m,
+                                 &lwork_mqr );
+        lwork = max( lwork_qrf, lwork_mqr );
+    }
+    work_.resize( lwork );
+    factor( A, lda );
+}
+
+//------------------------------------------------------------------------------
+/// Factors a new m-by-n matrix A, replacing the previous factors, and
+/// updates anorm and rcond.
+///
+/// @param[in] A
+///     The m-by-n matrix A, stored in an lda-by-n array.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,m).
+///
+/// @return info: 0, or i > 0 if R(i,i) is exactly zero.
+///
+template <typename scalar_t>
+int64_t QR< scalar_t >::factor(
+    scalar_t const* A, int64_t lda )
+{
+    lapack_error_if( lda < max( 1, m_ ) );
+
+    info_ = 0;
+    anorm_ = 0;
+    rcond_ = 1;
+    if (n_ == 0)
+        return 0;
+
+    lapack::lacpy( MatrixType::General, m_, n_, A, lda, QR_.data(), m_ );
+    anorm_ = lapack::lange( Norm::One, m_, n_, QR_.data(), m_ );
+    lapack::geqrf( m_, n_, QR_.data(), m_, tau_.data(),
+                   work_.data(), work_.size() );
+    for (int64_t i = 0; i < n_ && info_ == 0; ++i) {
+        if (QR_[ i + i*m_ ] == scalar_t( 0 ))
+            info_ = i + 1;
+    }
+    rcond_ = 0;
+    if (info_ == 0) {
+        lapack::trcon( Norm::One, Uplo::Upper, Diag::NonUnit, n_,
+                       QR_.data(), m_, &rcond_ );
+    }
+    return info_;
+}
+
+//------------------------------------------------------------------------------
+/// Solves the least squares problem $\min_X \| B - A X \|_F$ with the
+/// factors, $X = R^{-1} (Q^H B)(1:n, :)$, by unmqr and trsm.
+///
+/// @param[in] nrhs
+///     The number of right hand sides. nrhs >= 0.
+///
+/// @param[in,out] B
+///     On entry, the m-by-nrhs matrix B, stored in an ldb-by-nrhs array.
+///     On exit, if return value = 0, rows 1 to n hold the solution X,
+///     and rows n+1 to m hold $(Q^H B)(n+1:m, :)$, whose column norms
+///     are the residual norms, as in gels.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B. ldb >= max(1,m).
+///
+/// @return info: 0, or i > 0 if R(i,i) is exactly zero; B is unchanged.
+///
+template <typename scalar_t>
+int64_t QR< scalar_t >::solve(
+    int64_t nrhs, scalar_t* B, int64_t ldb )
+{
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( ldb < max( 1, m_ ) );
+
+    if (info_ != 0)
+        return info_;
+    if (n_ == 0 || nrhs == 0)
+        return 0;
+
+    for (int64_t j = 0; j < nrhs; j += rhs_block) {
+        int64_t jb = min( rhs_block, nrhs - j );
+        lapack::unmqr( Side::Left, Op::ConjTrans, m_, jb, n_,
+                       QR_.data(), m_, tau_.data(), &B[ j*ldb ], ldb,
+                       work_.data(), work_.size() );
+    }
+    blas::trsm( Layout::ColMajor, Side::Left, Uplo::Upper, Op::NoTrans,
+                Diag::NonUnit, n_, nrhs, 1.0, QR_.data(), m_, B, ldb );
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+/// Computes $A^{-1} = R^{-1} Q^H$, for square A.
+///
+/// @param[out] Ainv
+///     The n-by-n inverse, stored in an ldainv-by-n array.
+///
+/// @param[in] ldainv
+///     The leading dimension of the array Ainv. ldainv >= max(1,n).
+///
+/// @return info: 0, or i > 0 if R(i,i) is exactly zero; Ainv is not set.
+///
+template <typename scalar_t>
+int64_t QR< scalar_t >::inverse(
+    scalar_t* Ainv, int64_t ldainv )
+{
+    lapack_error_if( m_ != n_ );
+    lapack_error_if( ldainv < max( 1, n_ ) );
+
+    if (info_ != 0)
+        return info_;
+    lapack::laset( MatrixType::General, n_, n_, 0.0, 1.0, Ainv, ldainv );
+    return solve( n_, Ainv, ldainv );
+}
+
+//------------------------------------------------------------------------------
+/// @return det( A ) = det( Q ) prod R(i,i), for square A. Each
+/// Householder reflector $H = I - \tau v v^H$ has determinant
+/// $-\tau / \bar{\tau}$, or 1 if $\tau = 0$. It may overflow or
+/// underflow for large n.
+///
+template <typename scalar_t>
+scalar_t QR< scalar_t >::det() const
+{
+    lapack_error_if( m_ != n_ );
+
+    scalar_t d = 1;
+    for (int64_t i = 0; i < n_; ++i) {
+        d *= QR_[ i + i*m_ ];
+        scalar_t tau = tau_[ i ];
+        if (tau != scalar_t( 0 ))
+            d *= -tau / conj( tau );
+    }
+    return d;
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template class QR< float >;
+template class QR< double >;
+template class QR< std::complex<float> >;
+template class QR< std::complex<double> >;
+
+}  // namespace lapack
@@ -0,0 +1,211 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/factor.hh"
+#include "lapack_internal.hh"
+
+#include <cmath>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+using blas::conj;
+
+// Right-hand sides per pair of gemm calls, which sizes the workspace.
+static constexpr int64_t rhs_block = 32;
+
+//------------------------------------------------------------------------------
+/// Copies the uplo triangle of the n-by-n Hermitian matrix A and
+/// computes its eigendecomposition; see factor.
+///
+/// @param[in] uplo
+///     Whether the upper or lower triangle of A is stored.
+///
+/// @param[in] n
+///     The order of the matrix A. n >= 0.
+///
+/// @param[in] A
+///     The n-by-n Hermitian matrix A, stored in an lda-by-n array.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+template <typename scalar_t>
+SymEig< scalar_t >::SymEig(
+    Uplo uplo, int64_t n, scalar_t const* A, int64_t lda )
+    : uplo_( uplo ),
+      n_( n ),
+      info_( 0 ),
+      anorm_( 0 ),
+      rcond_( 0 )
+{
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+
+    W_.resize( max( 1, n ) );
+    Z_.resize( max( 1, n*n ) );
+    work_.resize( max( 1, n*rhs_block ) );
+    factor( A, lda );
+}
+
+//------------------------------------------------------------------------------
+/// Computes the eigendecomposition of a new n-by-n Hermitian matrix A,
+/// replacing the previous one, and updates anorm and rcond.
+///
+/// @param[in] A
+///     The n-by-n Hermitian matrix A, stored in an lda-by-n array.
+///     Only the uplo triangle is referenced.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @return info: 0; i, 0 < i <= n, if heevd failed to converge;
+///     or n+1 if an eigenvalue is exactly zero.
+///
+template <typename scalar_t>
+int64_t SymEig< scalar_t >::factor(
+    scalar_t const* A, int64_t lda )
+{
+    lapack_error_if( lda < max( 1, n_ ) );
+
+    info_ = 0;
+    anorm_ = 0;
+    rcond_ = 1;
+    if (n_ == 0)
+        return 0;
+
+    MatrixType mtype = (uplo_ == Uplo::Lower ? MatrixType::Lower
+                                             : MatrixType::Upper);
+    lapack::lacpy( mtype, n_, n_, A, lda, Z_.data(), n_ );
+    info_ = lapack::heevd( Job::Vec, uplo_, n_, Z_.data(), n_, W_.data() );
+    rcond_ = 0;
+    if (info_ == 0) {
+        // Eigenvalues are ascending, so the extremes in magnitude are at
+        // the ends, and the smallest is where they change sign.
+        real_t wmin = std::abs( W_[ 0 ] );
+        for (int64_t i = 1; i < n_; ++i)
+            wmin = min( wmin, std::abs( W_[ i ] ) );
+        anorm_ = max( std::abs( W_[ 0 ] ), std::abs( W_[ n_-1 ] ) );
+        if (wmin == 0)
+            info_ = n_ + 1;
+        else
+            rcond_ = wmin / anorm_;
+    }
+    return info_;
+}
+
+//------------------------------------------------------------------------------
+/// Solves $A X = B$, $X = Z \Lambda^{-1} Z^H B$, by gemm, a block of
+/// right-hand sides at a time.
+///
+/// @param[in] nrhs
+///     The number of right hand sides. nrhs >= 0.
+///
+/// @param[in,out] B
+///     On entry, the n-by-nrhs matrix B, stored in an ldb-by-nrhs array.
+///     On exit, if return value = 0, the solution X.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B. ldb >= max(1,n).
+///
+/// @return info: 0, or info() > 0 if A is singular or heevd failed;
+///     B is unchanged.
+///
+template <typename scalar_t>
+int64_t SymEig< scalar_t >::solve(
+    int64_t nrhs, scalar_t* B, int64_t ldb )
+{
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( ldb < max( 1, n_ ) );
+
+    if (info_ != 0)
+        return info_;
+    if (n_ == 0 || nrhs == 0)
+        return 0;
+
+    scalar_t* T = work_.data();
+    for (int64_t j = 0; j < nrhs; j += rhs_block) {
+        int64_t jb = min( rhs_block, nrhs - j );
+        scalar_t* Bj = &B[ j*ldb ];
+        blas::gemm( Layout::ColMajor, Op::ConjTrans, Op::NoTrans,
+                    n_, jb, n_,
+                    1.0, Z_.data(), n_,
+                         Bj, ldb,
+                    0.0, T, n_ );
+        for (int64_t c = 0; c < jb; ++c) {
+            for (int64_t i = 0; i < n_; ++i)
+                T[ i + c*n_ ] /= W_[ i ];
+        }
+        blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                    n_, jb, n_,
+                    1.0, Z_.data(), n_,
+                         T, n_,
+                    0.0, Bj, ldb );
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+/// Computes $A^{-1} = Z \Lambda^{-1} Z^H$, a block of columns at a time.
+///
+/// @param[out] Ainv
+///     The n-by-n Hermitian inverse, stored in an ldainv-by-n array.
+///
+/// @param[in] ldainv
+///     The leading dimension of the array Ainv. ldainv >= max(1,n).
+///
+/// @return info: 0, or info() > 0 if A is singular or heevd failed;
+///     Ainv is not set.
+///
+template <typename scalar_t>
+int64_t SymEig< scalar_t >::inverse(
+    scalar_t* Ainv, int64_t ldainv )
+{
+    lapack_error_if( ldainv < max( 1, n_ ) );
+
+    if (info_ != 0)
+        return info_;
+
+    // Columns j : j+jb-1 of A^{-1} are Z T, with T = Lambda^{-1} Z^H
+    // restricted to those columns, i.e., T(i, c) = conj( Z(j+c, i) ) / w_i.
+    scalar_t* T = work_.data();
+    for (int64_t j = 0; j < n_; j += rhs_block) {
+        int64_t jb = min( rhs_block, n_ - j );
+        for (int64_t c = 0; c < jb; ++c) {
+            for (int64_t i = 0; i < n_; ++i)
+                T[ i + c*n_ ] = conj( Z_[ (j+c) + i*n_ ] ) / W_[ i ];
+        }
+        blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                    n_, jb, n_,
+                    1.0, Z_.data(), n_,
+                         T, n_,
+                    0.0, &Ainv[ j*ldainv ], ldainv );
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+/// @return det( A ), the product of the eigenvalues. It may overflow or
+/// underflow for large n.
+///
+template <typename scalar_t>
+blas::real_type< scalar_t > SymEig< scalar_t >::det() const
+{
+    real_t d = 1;
+    for (int64_t i = 0; i < n_; ++i)
+        d *= W_[ i ];
+    return d;
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template class SymEig< float >;
+template class SymEig< double >;
+template class SymEig< std::complex<float> >;
+template class SymEig< std::complex<double> >;
+
+}  // namespace lapack
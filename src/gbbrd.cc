@@ -27,6 +27,7 @@ int64_t gbbrd(
     float* PT, int64_t ldpt,
     float* C, int64_t ldc )
 {
+    internal::StatsScope stats_scope( "sgbbrd" );
     char vect_ = to_char( vect );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -69,6 +70,7 @@ int64_t gbbrd(
     double* PT, int64_t ldpt,
     double* C, int64_t ldc )
 {
+    internal::StatsScope stats_scope( "dgbbrd" );
     char vect_ = to_char( vect );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -111,6 +113,7 @@ int64_t gbbrd(
     std::complex<float>* PT, int64_t ldpt,
     std::complex<float>* C, int64_t ldc )
 {
+    internal::StatsScope stats_scope( "cgbbrd" );
     char vect_ = to_char( vect );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -240,6 +243,7 @@ int64_t gbbrd(
     std::complex<double>* PT, int64_t ldpt,
     std::complex<double>* C, int64_t ldc )
 {
+    internal::StatsScope stats_scope( "zgbbrd" );
     char vect_ = to_char( vect );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
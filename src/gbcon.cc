@@ -24,6 +24,7 @@ int64_t gbcon(
     int64_t const* ipiv, float anorm,
     float* rcond )
 {
+    internal::StatsScope stats_scope( "sgbcon" );
     char norm_ = to_char( norm );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
@@ -31,7 +32,7 @@ int64_t gbcon(
     lapack_int ldab_ = to_lapack_int( ldab );
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -63,6 +64,7 @@ int64_t gbcon(
     int64_t const* ipiv, double anorm,
     double* rcond )
 {
+    internal::StatsScope stats_scope( "dgbcon" );
     char norm_ = to_char( norm );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
@@ -70,7 +72,7 @@ int64_t gbcon(
     lapack_int ldab_ = to_lapack_int( ldab );
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -102,6 +104,7 @@ int64_t gbcon(
     int64_t const* ipiv, float anorm,
     float* rcond )
 {
+    internal::StatsScope stats_scope( "cgbcon" );
     char norm_ = to_char( norm );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
@@ -109,7 +112,7 @@ int64_t gbcon(
     lapack_int ldab_ = to_lapack_int( ldab );
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -193,6 +196,7 @@ int64_t gbcon(
     int64_t const* ipiv, double anorm,
     double* rcond )
 {
+    internal::StatsScope stats_scope( "zgbcon" );
     char norm_ = to_char( norm );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
@@ -200,7 +204,7 @@ int64_t gbcon(
     lapack_int ldab_ = to_lapack_int( ldab );
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -224,4 +228,150 @@ int64_t gbcon(
     return info_;
 }
 
+#ifndef LAPACK_ILP64
+
+// -----------------------------------------------------------------------------
+/// @ingroup gbsv_computational
+int64_t gbcon(
+    lapack::Norm norm, int64_t n, int64_t kl, int64_t ku,
+    float const* AB, int64_t ldab,
+    lapack_int const* ipiv, float anorm,
+    float* rcond )
+{
+    internal::StatsScope stats_scope( "sgbcon" );
+    char norm_ = to_char( norm );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int kl_ = to_lapack_int( kl );
+    lapack_int ku_ = to_lapack_int( ku );
+    lapack_int ldab_ = to_lapack_int( ldab );
+    lapack_int const* ipiv_ptr = ipiv;
+    lapack_int info_ = 0;
+
+    // allocate workspace
+    lapack::vector< float > work( (3*n) );
+    lapack::vector< lapack_int > iwork( (n) );
+
+    LAPACK_sgbcon(
+        &norm_, &n_, &kl_, &ku_,
+        AB, &ldab_,
+        ipiv_ptr, &anorm, rcond,
+        &work[0],
+        &iwork[0], &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gbsv_computational
+int64_t gbcon(
+    lapack::Norm norm, int64_t n, int64_t kl, int64_t ku,
+    double const* AB, int64_t ldab,
+    lapack_int const* ipiv, double anorm,
+    double* rcond )
+{
+    internal::StatsScope stats_scope( "dgbcon" );
+    char norm_ = to_char( norm );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int kl_ = to_lapack_int( kl );
+    lapack_int ku_ = to_lapack_int( ku );
+    lapack_int ldab_ = to_lapack_int( ldab );
+    lapack_int const* ipiv_ptr = ipiv;
+    lapack_int info_ = 0;
+
+    // allocate workspace
+    lapack::vector< double > work( (3*n) );
+    lapack::vector< lapack_int > iwork( (n) );
+
+    LAPACK_dgbcon(
+        &norm_, &n_, &kl_, &ku_,
+        AB, &ldab_,
+        ipiv_ptr, &anorm, rcond,
+        &work[0],
+        &iwork[0], &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gbsv_computational
+int64_t gbcon(
+    lapack::Norm norm, int64_t n, int64_t kl, int64_t ku,
+    std::complex<float> const* AB, int64_t ldab,
+    lapack_int const* ipiv, float anorm,
+    float* rcond )
+{
+    internal::StatsScope stats_scope( "cgbcon" );
+    char norm_ = to_char( norm );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int kl_ = to_lapack_int( kl );
+    lapack_int ku_ = to_lapack_int( ku );
+    lapack_int ldab_ = to_lapack_int( ldab );
+    lapack_int const* ipiv_ptr = ipiv;
+    lapack_int info_ = 0;
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( (2*n) );
+    lapack::vector< float > rwork( (n) );
+
+    LAPACK_cgbcon(
+        &norm_, &n_, &kl_, &ku_,
+        (lapack_complex_float*) AB, &ldab_,
+        ipiv_ptr, &anorm, rcond,
+        (lapack_complex_float*) &work[0],
+        &rwork[0], &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::gbcon that takes ipiv in the native LAPACK integer
+/// type, lapack_int, instead of int64_t, which avoids allocating and
+/// copying a temporary pivot array. Available only when lapack_int is
+/// 32-bit, i.e., LAPACK_ILP64 is not defined; otherwise the int64_t
+/// version is already native.
+///
+/// @ingroup gbsv_computational
+int64_t gbcon(
+    lapack::Norm norm, int64_t n, int64_t kl, int64_t ku,
+    std::complex<double> const* AB, int64_t ldab,
+    lapack_int const* ipiv, double anorm,
+    double* rcond )
+{
+    internal::StatsScope stats_scope( "zgbcon" );
+    char norm_ = to_char( norm );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int kl_ = to_lapack_int( kl );
+    lapack_int ku_ = to_lapack_int( ku );
+    lapack_int ldab_ = to_lapack_int( ldab );
+    lapack_int const* ipiv_ptr = ipiv;
+    lapack_int info_ = 0;
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( (2*n) );
+    lapack::vector< double > rwork( (n) );
+
+    LAPACK_zgbcon(
+        &norm_, &n_, &kl_, &ku_,
+        (lapack_complex_double*) AB, &ldab_,
+        ipiv_ptr, &anorm, rcond,
+        (lapack_complex_double*) &work[0],
+        &rwork[0], &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+#endif  // LAPACK_ILP64
+
 }  // namespace lapack
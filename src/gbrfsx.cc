@@ -35,6 +35,7 @@ int64_t gbrfsx(
     float* err_bnds_comp, int64_t nparams,
     float* params )
 {
+    internal::StatsScope stats_scope( "sgbrfsx" );
     char trans_ = to_char( trans );
     char equed_ = to_char( equed );
     lapack_int n_ = to_lapack_int( n );
@@ -45,7 +46,7 @@ int64_t gbrfsx(
     lapack_int ldafb_ = to_lapack_int( ldafb );
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -99,6 +100,7 @@ int64_t gbrfsx(
     double* err_bnds_comp, int64_t nparams,
     double* params )
 {
+    internal::StatsScope stats_scope( "dgbrfsx" );
     char trans_ = to_char( trans );
     char equed_ = to_char( equed );
     lapack_int n_ = to_lapack_int( n );
@@ -109,7 +111,7 @@ int64_t gbrfsx(
     lapack_int ldafb_ = to_lapack_int( ldafb );
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -163,6 +165,7 @@ int64_t gbrfsx(
     float* err_bnds_comp, int64_t nparams,
     float* params )
 {
+    internal::StatsScope stats_scope( "cgbrfsx" );
     char trans_ = to_char( trans );
     char equed_ = to_char( equed );
     lapack_int n_ = to_lapack_int( n );
@@ -173,7 +176,7 @@ int64_t gbrfsx(
     lapack_int ldafb_ = to_lapack_int( ldafb );
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -528,6 +531,7 @@ int64_t gbrfsx(
     double* err_bnds_comp, int64_t nparams,
     double* params )
 {
+    internal::StatsScope stats_scope( "zgbrfsx" );
     char trans_ = to_char( trans );
     char equed_ = to_char( equed );
     lapack_int n_ = to_lapack_int( n );
@@ -538,7 +542,7 @@ int64_t gbrfsx(
     lapack_int ldafb_ = to_lapack_int( ldafb );
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -575,6 +579,252 @@ int64_t gbrfsx(
     return info_;
 }
 
+#ifndef LAPACK_ILP64
+
+// -----------------------------------------------------------------------------
+/// @ingroup gbsv_computational
+int64_t gbrfsx(
+    lapack::Op trans, lapack::Equed equed, int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    float const* AB, int64_t ldab,
+    float const* AFB, int64_t ldafb,
+    lapack_int const* ipiv,
+    float* R,
+    float* C,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* rcond,
+    float* berr, int64_t n_err_bnds,
+    float* err_bnds_norm,
+    float* err_bnds_comp, int64_t nparams,
+    float* params )
+{
+    internal::StatsScope stats_scope( "sgbrfsx" );
+    char trans_ = to_char( trans );
+    char equed_ = to_char( equed );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int kl_ = to_lapack_int( kl );
+    lapack_int ku_ = to_lapack_int( ku );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int ldab_ = to_lapack_int( ldab );
+    lapack_int ldafb_ = to_lapack_int( ldafb );
+    lapack_int const* ipiv_ptr = ipiv;
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int ldx_ = to_lapack_int( ldx );
+    lapack_int n_err_bnds_ = to_lapack_int( n_err_bnds );
+    lapack_int nparams_ = to_lapack_int( nparams );
+    lapack_int info_ = 0;
+
+    // allocate workspace
+    lapack::vector< float > work( (4*n) );
+    lapack::vector< lapack_int > iwork( (n) );
+
+    LAPACK_sgbrfsx(
+        &trans_, &equed_, &n_, &kl_, &ku_, &nrhs_,
+        AB, &ldab_,
+        AFB, &ldafb_,
+        ipiv_ptr,
+        R,
+        C,
+        B, &ldb_,
+        X, &ldx_, rcond,
+        berr, &n_err_bnds_,
+        err_bnds_norm,
+        err_bnds_comp, &nparams_,
+        params,
+        &work[0],
+        &iwork[0], &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gbsv_computational
+int64_t gbrfsx(
+    lapack::Op trans, lapack::Equed equed, int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    double const* AB, int64_t ldab,
+    double const* AFB, int64_t ldafb,
+    lapack_int const* ipiv,
+    double* R,
+    double* C,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* rcond,
+    double* berr, int64_t n_err_bnds,
+    double* err_bnds_norm,
+    double* err_bnds_comp, int64_t nparams,
+    double* params )
+{
+    internal::StatsScope stats_scope( "dgbrfsx" );
+    char trans_ = to_char( trans );
+    char equed_ = to_char( equed );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int kl_ = to_lapack_int( kl );
+    lapack_int ku_ = to_lapack_int( ku );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int ldab_ = to_lapack_int( ldab );
+    lapack_int ldafb_ = to_lapack_int( ldafb );
+    lapack_int const* ipiv_ptr = ipiv;
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int ldx_ = to_lapack_int( ldx );
+    lapack_int n_err_bnds_ = to_lapack_int( n_err_bnds );
+    lapack_int nparams_ = to_lapack_int( nparams );
+    lapack_int info_ = 0;
+
+    // allocate workspace
+    lapack::vector< double > work( (4*n) );
+    lapack::vector< lapack_int > iwork( (n) );
+
+    LAPACK_dgbrfsx(
+        &trans_, &equed_, &n_, &kl_, &ku_, &nrhs_,
+        AB, &ldab_,
+        AFB, &ldafb_,
+        ipiv_ptr,
+        R,
+        C,
+        B, &ldb_,
+        X, &ldx_, rcond,
+        berr, &n_err_bnds_,
+        err_bnds_norm,
+        err_bnds_comp, &nparams_,
+        params,
+        &work[0],
+        &iwork[0], &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gbsv_computational
+int64_t gbrfsx(
+    lapack::Op trans, lapack::Equed equed, int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    std::complex<float> const* AB, int64_t ldab,
+    std::complex<float> const* AFB, int64_t ldafb,
+    lapack_int const* ipiv,
+    float* R,
+    float* C,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* X, int64_t ldx,
+    float* rcond,
+    float* berr, int64_t n_err_bnds,
+    float* err_bnds_norm,
+    float* err_bnds_comp, int64_t nparams,
+    float* params )
+{
+    internal::StatsScope stats_scope( "cgbrfsx" );
+    char trans_ = to_char( trans );
+    char equed_ = to_char( equed );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int kl_ = to_lapack_int( kl );
+    lapack_int ku_ = to_lapack_int( ku );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int ldab_ = to_lapack_int( ldab );
+    lapack_int ldafb_ = to_lapack_int( ldafb );
+    lapack_int const* ipiv_ptr = ipiv;
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int ldx_ = to_lapack_int( ldx );
+    lapack_int n_err_bnds_ = to_lapack_int( n_err_bnds );
+    lapack_int nparams_ = to_lapack_int( nparams );
+    lapack_int info_ = 0;
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( (2*n) );
+    lapack::vector< float > rwork( (2*n) );
+
+    LAPACK_cgbrfsx(
+        &trans_, &equed_, &n_, &kl_, &ku_, &nrhs_,
+        (lapack_complex_float*) AB, &ldab_,
+        (lapack_complex_float*) AFB, &ldafb_,
+        ipiv_ptr,
+        R,
+        C,
+        (lapack_complex_float*) B, &ldb_,
+        (lapack_complex_float*) X, &ldx_, rcond,
+        berr, &n_err_bnds_,
+        err_bnds_norm,
+        err_bnds_comp, &nparams_,
+        params,
+        (lapack_complex_float*) &work[0],
+        &rwork[0], &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::gbrfsx that takes ipiv in the native LAPACK integer
+/// type, lapack_int, instead of int64_t, which avoids allocating and
+/// copying a temporary pivot array. Available only when lapack_int is
+/// 32-bit, i.e., LAPACK_ILP64 is not defined; otherwise the int64_t
+/// version is already native.
+///
+/// @ingroup gbsv_computational
+int64_t gbrfsx(
+    lapack::Op trans, lapack::Equed equed, int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    std::complex<double> const* AB, int64_t ldab,
+    std::complex<double> const* AFB, int64_t ldafb,
+    lapack_int const* ipiv,
+    double* R,
+    double* C,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    double* rcond,
+    double* berr, int64_t n_err_bnds,
+    double* err_bnds_norm,
+    double* err_bnds_comp, int64_t nparams,
+    double* params )
+{
+    internal::StatsScope stats_scope( "zgbrfsx" );
+    char trans_ = to_char( trans );
+    char equed_ = to_char( equed );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int kl_ = to_lapack_int( kl );
+    lapack_int ku_ = to_lapack_int( ku );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int ldab_ = to_lapack_int( ldab );
+    lapack_int ldafb_ = to_lapack_int( ldafb );
+    lapack_int const* ipiv_ptr = ipiv;
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int ldx_ = to_lapack_int( ldx );
+    lapack_int n_err_bnds_ = to_lapack_int( n_err_bnds );
+    lapack_int nparams_ = to_lapack_int( nparams );
+    lapack_int info_ = 0;
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( (2*n) );
+    lapack::vector< double > rwork( (2*n) );
+
+    LAPACK_zgbrfsx(
+        &trans_, &equed_, &n_, &kl_, &ku_, &nrhs_,
+        (lapack_complex_double*) AB, &ldab_,
+        (lapack_complex_double*) AFB, &ldafb_,
+        ipiv_ptr,
+        R,
+        C,
+        (lapack_complex_double*) B, &ldb_,
+        (lapack_complex_double*) X, &ldx_, rcond,
+        berr, &n_err_bnds_,
+        err_bnds_norm,
+        err_bnds_comp, &nparams_,
+        params,
+        (lapack_complex_double*) &work[0],
+        &rwork[0], &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+#endif  // LAPACK_ILP64
+
 }  // namespace lapack
 
 #endif  // HAVE_XBLAS
@@ -24,6 +24,7 @@ int64_t gbsv(
     int64_t* ipiv,
     float* B, int64_t ldb )
 {
+    internal::StatsScope stats_scope( "sgbsv" );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
     lapack_int ku_ = to_lapack_int( ku );
@@ -61,6 +62,7 @@ int64_t gbsv(
     int64_t* ipiv,
     double* B, int64_t ldb )
 {
+    internal::StatsScope stats_scope( "dgbsv" );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
     lapack_int ku_ = to_lapack_int( ku );
@@ -98,6 +100,7 @@ int64_t gbsv(
     int64_t* ipiv,
     std::complex<float>* B, int64_t ldb )
 {
+    internal::StatsScope stats_scope( "cgbsv" );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
     lapack_int ku_ = to_lapack_int( ku );
@@ -217,6 +220,7 @@ int64_t gbsv(
     int64_t* ipiv,
     std::complex<double>* B, int64_t ldb )
 {
+    internal::StatsScope stats_scope( "zgbsv" );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
     lapack_int ku_ = to_lapack_int( ku );
@@ -246,4 +250,126 @@ int64_t gbsv(
     return info_;
 }
 
+#ifndef LAPACK_ILP64
+
+// -----------------------------------------------------------------------------
+/// @ingroup gbsv
+int64_t gbsv(
+    int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    float* AB, int64_t ldab,
+    lapack_int* ipiv,
+    float* B, int64_t ldb )
+{
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int kl_ = to_lapack_int( kl );
+    lapack_int ku_ = to_lapack_int( ku );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int ldab_ = to_lapack_int( ldab );
+    lapack_int* ipiv_ptr = ipiv;
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int info_ = 0;
+
+    LAPACK_sgbsv(
+        &n_, &kl_, &ku_, &nrhs_,
+        AB, &ldab_,
+        ipiv_ptr,
+        B, &ldb_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gbsv
+int64_t gbsv(
+    int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    double* AB, int64_t ldab,
+    lapack_int* ipiv,
+    double* B, int64_t ldb )
+{
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int kl_ = to_lapack_int( kl );
+    lapack_int ku_ = to_lapack_int( ku );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int ldab_ = to_lapack_int( ldab );
+    lapack_int* ipiv_ptr = ipiv;
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int info_ = 0;
+
+    LAPACK_dgbsv(
+        &n_, &kl_, &ku_, &nrhs_,
+        AB, &ldab_,
+        ipiv_ptr,
+        B, &ldb_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gbsv
+int64_t gbsv(
+    int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    std::complex<float>* AB, int64_t ldab,
+    lapack_int* ipiv,
+    std::complex<float>* B, int64_t ldb )
+{
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int kl_ = to_lapack_int( kl );
+    lapack_int ku_ = to_lapack_int( ku );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int ldab_ = to_lapack_int( ldab );
+    lapack_int* ipiv_ptr = ipiv;
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int info_ = 0;
+
+    LAPACK_cgbsv(
+        &n_, &kl_, &ku_, &nrhs_,
+        (lapack_complex_float*) AB, &ldab_,
+        ipiv_ptr,
+        (lapack_complex_float*) B, &ldb_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::gbsv that takes ipiv in the native LAPACK integer
+/// type, lapack_int, instead of int64_t, which avoids allocating and
+/// copying a temporary pivot array. Available only when lapack_int is
+/// 32-bit, i.e., LAPACK_ILP64 is not defined; otherwise the int64_t
+/// version is already native.
+///
+/// @ingroup gbsv
+int64_t gbsv(
+    int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    std::complex<double>* AB, int64_t ldab,
+    lapack_int* ipiv,
+    std::complex<double>* B, int64_t ldb )
+{
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int kl_ = to_lapack_int( kl );
+    lapack_int ku_ = to_lapack_int( ku );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int ldab_ = to_lapack_int( ldab );
+    lapack_int* ipiv_ptr = ipiv;
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int info_ = 0;
+
+    LAPACK_zgbsv(
+        &n_, &kl_, &ku_, &nrhs_,
+        (lapack_complex_double*) AB, &ldab_,
+        ipiv_ptr,
+        (lapack_complex_double*) B, &ldb_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+#endif  // LAPACK_ILP64
+
 }  // namespace lapack
@@ -0,0 +1,319 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "spike_internal.hh"
+#include "NoConstructAllocator.hh"
+
+#include <algorithm>
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper.
+/// @ingroup gbsv
+///
+template <typename scalar_t>
+int64_t gbsv_parallel(
+    int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    scalar_t* AB, int64_t ldab,
+    int64_t* ipiv,
+    scalar_t* B, int64_t ldb )
+{
+    lapack_error_if( n < 0 );
+    lapack_error_if( kl < 0 );
+    lapack_error_if( ku < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( ldab < 2*kl + ku + 1 );
+    lapack_error_if( ldb < max( 1, n ) );
+
+    int64_t q = kl + ku;
+    int64_t p = internal::spike_partitions( n, q );
+    if (p == 1 || q == 0)
+        return lapack::gbsv( n, kl, ku, nrhs, AB, ldab, ipiv, B, ldb );
+
+    // Spike columns solved at a time, to bound workspace.
+    const int64_t nb = 16;
+
+    // A( i, j ) is stored in AB( kl + ku + i - j, j ).
+    auto A = [&]( int64_t i, int64_t j ) {
+        return AB[ kl + ku + i - j + j*ldab ];
+    };
+
+    // Coupling blocks B_k (upper triangular) and C_k (lower triangular),
+    // read before factoring, which may overwrite them as unused storage.
+    std::vector< scalar_t > Bc( p*ku*ku ), Cc( p*kl*kl );
+    for (int64_t k = 0; k < p; ++k) {
+        int64_t s = internal::spike_begin( n, p, k );
+        int64_t e = internal::spike_begin( n, p, k+1 );
+        if (k < p - 1) {
+            for (int64_t j = 0; j < ku; ++j)
+                for (int64_t i = j; i < ku; ++i)
+                    Bc[ k*ku*ku + i + j*ku ] = A( e - ku + i, e + j );
+        }
+        if (k > 0) {
+            for (int64_t j = 0; j < kl; ++j)
+                for (int64_t i = 0; i <= j; ++i)
+                    Cc[ k*kl*kl + i + j*kl ] = A( s + i, s - kl + j );
+        }
+    }
+
+    lapack::vector< lapack_int > ipiv_( n );
+    std::vector< scalar_t > T( p*q*q ), Y( p*q*nrhs );
+    std::vector< int64_t > info( p, 0 );
+
+    // Copy of rows 0 to 2 kl + ku of AB, restored on failure so the
+    // caller can fall back to lapack::gbsv with the original arrays.
+    int64_t ldsave = 2*kl + ku + 1;
+    lapack::vector< scalar_t > AB_save( ldsave*n );
+    auto restore = [&]() {
+        lapack::lacpy( MatrixType::General, ldsave, n, AB_save.data(), ldsave,
+                       AB, ldab );
+    };
+
+    // Factor each diagonal block and solve for the spike tips. gbtrf of
+    // partition k touches only columns [ s_k, e_k ) of AB. B is not
+    // touched until the block factorizations and the reduced system are
+    // known to be nonsingular.
+    internal::parallel_for( p, 1, [&]( int64_t begin, int64_t end ) {
+        std::vector< scalar_t > work;
+        for (int64_t k = begin; k < end; ++k) {
+            int64_t s = internal::spike_begin( n, p, k );
+            int64_t m = internal::spike_begin( n, p, k+1 ) - s;
+            scalar_t* ABk = &AB[ s*ldab ];
+            lapack_int* ipivk = &ipiv_[ s ];
+            lapack::lacpy( MatrixType::General, ldsave, m, ABk, ldab,
+                           &AB_save[ s*ldsave ], ldsave );
+
+            int64_t iinfo = lapack::gbtrf( m, m, kl, ku, ABk, ldab, ipivk );
+            if (iinfo != 0) {
+                info[ k ] = s + iinfo;
+                continue;
+            }
+
+            // Columns of [ V_k, W_k ], skipping W_0 and V_{p-1}, which
+            // are zero.
+            int64_t jbegin = (k < p - 1 ? 0 : ku);
+            int64_t jend   = (k > 0     ? q : ku);
+            work.resize( m*nb );
+            for (int64_t j = jbegin; j < jend; j += nb) {
+                int64_t jb = min( nb, jend - j );
+                std::fill( work.begin(), work.begin() + m*jb, scalar_t( 0 ) );
+                for (int64_t jj = 0; jj < jb; ++jj) {
+                    int64_t c = j + jj;
+                    scalar_t* w = &work[ jj*m ];
+                    if (c < ku) {
+                        for (int64_t i = 0; i < ku; ++i)
+                            w[ m - ku + i ] = Bc[ k*ku*ku + i + c*ku ];
+                    }
+                    else {
+                        for (int64_t i = 0; i < kl; ++i)
+                            w[ i ] = Cc[ k*kl*kl + i + (c - ku)*kl ];
+                    }
+                }
+                lapack::gbtrs( Op::NoTrans, m, kl, ku, jb, ABk, ldab, ipivk,
+                               work.data(), m );
+                internal::spike_tips( m, kl, ku, jb, work.data(), m,
+                                      &T[ k*q*q + j*q ] );
+            }
+        }
+    });
+    for (int64_t k = 0; k < p; ++k) {
+        if (info[ k ] != 0) {
+            restore();
+            return info[ k ];
+        }
+    }
+
+    std::vector< scalar_t > AB_r;
+    std::vector< int64_t > ipiv_r;
+    int64_t iinfo = internal::spike_reduced_factor(
+        n, kl, ku, p, T.data(), AB_r, ipiv_r );
+    if (iinfo != 0) {
+        restore();
+        return iinfo;
+    }
+
+    // Solve for y_k.
+    internal::parallel_for( p, 1, [&]( int64_t begin, int64_t end ) {
+        for (int64_t k = begin; k < end; ++k) {
+            int64_t s = internal::spike_begin( n, p, k );
+            int64_t m = internal::spike_begin( n, p, k+1 ) - s;
+            lapack::gbtrs( Op::NoTrans, m, kl, ku, nrhs, &AB[ s*ldab ], ldab,
+                           &ipiv_[ s ], &B[ s ], ldb );
+            internal::spike_tips( m, kl, ku, nrhs, &B[ s ], ldb,
+                                  &Y[ k*q*nrhs ] );
+        }
+    });
+
+    std::vector< scalar_t > Z( (p - 1)*q*nrhs );
+    internal::spike_reduced_solve(
+        kl, ku, nrhs, p, AB_r, ipiv_r, Y.data(), Z.data() );
+
+    // x_k = y_k - A_k^{-1} [ C_k xb_{k-1}; 0; B_k xt_{k+1} ].
+    internal::parallel_for( p, 1, [&]( int64_t begin, int64_t end ) {
+        std::vector< scalar_t > work;
+        for (int64_t k = begin; k < end; ++k) {
+            int64_t s = internal::spike_begin( n, p, k );
+            int64_t m = internal::spike_begin( n, p, k+1 ) - s;
+            scalar_t* ABk = &AB[ s*ldab ];
+            lapack_int* ipivk = &ipiv_[ s ];
+
+            work.resize( m*nrhs );
+            internal::spike_correction(
+                m, kl, ku, nrhs, p, k, &Bc[ k*ku*ku ], &Cc[ k*kl*kl ],
+                Z.data(), work.data(), m );
+            lapack::gbtrs( Op::NoTrans, m, kl, ku, nrhs, ABk, ldab, ipivk,
+                           work.data(), m );
+            for (int64_t c = 0; c < nrhs; ++c) {
+                for (int64_t i = 0; i < m; ++i)
+                    B[ s + i + c*ldb ] -= work[ i + c*m ];
+            }
+
+            // Pivots are local to each block; return them as rows of A.
+            for (int64_t i = 0; i < m; ++i)
+                ipiv[ s + i ] = s + ipivk[ i ];
+        }
+    });
+    return 0;
+}
+
+}  // namespace impl
+
+//------------------------------------------------------------------------------
+/// @ingroup gbsv
+int64_t gbsv_parallel(
+    int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    float* AB, int64_t ldab,
+    int64_t* ipiv,
+    float* B, int64_t ldb )
+{
+    return impl::gbsv_parallel( n, kl, ku, nrhs, AB, ldab, ipiv, B, ldb );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gbsv
+int64_t gbsv_parallel(
+    int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    double* AB, int64_t ldab,
+    int64_t* ipiv,
+    double* B, int64_t ldb )
+{
+    return impl::gbsv_parallel( n, kl, ku, nrhs, AB, ldab, ipiv, B, ldb );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gbsv
+int64_t gbsv_parallel(
+    int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    std::complex<float>* AB, int64_t ldab,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb )
+{
+    return impl::gbsv_parallel( n, kl, ku, nrhs, AB, ldab, ipiv, B, ldb );
+}
+
+//------------------------------------------------------------------------------
+/// Computes the solution to a system of linear equations
+/// $A X = B$, where A is a band matrix of order n with kl subdiagonals
+/// and ku superdiagonals, in parallel on the LAPACK++ thread pool, using
+/// the SPIKE partitioned algorithm. This is meant for a single large
+/// system with a narrow band, where lapack::gbsv is nearly sequential.
+/// A and B use the same storage as in lapack::gbsv.
+///
+/// The rows are split into one partition per thread (see
+/// lapack::set_num_threads), each at least several thousand rows and
+/// several bandwidths. Each diagonal block is factored by lapack::gbtrf,
+/// with partial pivoting inside the block, and solved by lapack::gbtrs
+/// for B and for the kl + ku "spike" columns that couple it to its
+/// neighbors. A banded reduced system of order (p-1)(kl + ku), for p
+/// partitions, couples the blocks and is solved by lapack::gbsv; then
+/// each block is solved once more for its correction. Only the first ku
+/// and last kl rows of each spike are kept, so besides a copy of AB, to
+/// restore it on failure, the workspace is about (16 + nrhs) n elements
+/// and n pivots, rather than (kl + ku) n.
+/// The spike solves cost about (2 kl + ku) / kl times the flops of the
+/// factorization, which the threads must make up.
+///
+/// Pivoting does not cross partition boundaries, so a diagonal block
+/// may be singular even when A is not. This cannot happen if A is
+/// diagonally dominant; otherwise, if the return value is > 0, AB and B
+/// are restored to their values on entry, so the caller can use
+/// lapack::gbsv on them. If n is too small to split, this calls
+/// lapack::gbsv, and the outputs are as from lapack::gbsv.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] n
+///     The number of linear equations, i.e., the order of the
+///     matrix A. n >= 0.
+///
+/// @param[in] kl
+///     The number of subdiagonals within the band of A. kl >= 0.
+///
+/// @param[in] ku
+///     The number of superdiagonals within the band of A. ku >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides, i.e., the number of columns
+///     of the matrix B. nrhs >= 0.
+///
+/// @param[in,out] AB
+///     The n-by-n band matrix AB, stored in an ldab-by-n array.
+///     On entry, the matrix A in band storage, in rows kl+1 to
+///     2*kl+ku+1; rows 1 to kl of the array need not be set.
+///     The j-th column of A is stored in the j-th column of the
+///     array AB as follows:
+///     \n
+///     AB(kl+ku+1+i-j,j) = A(i,j) for max(1,j-ku) <= i <= min(n,j+kl)
+///     \n
+///     On exit, if return value = 0, the LU factors of the diagonal
+///     blocks, each in the format of lapack::gbtrf; if return value > 0,
+///     AB is restored.
+///
+/// @param[in] ldab
+///     The leading dimension of the array AB. ldab >= 2*kl+ku+1.
+///
+/// @param[out] ipiv
+///     The vector ipiv of length n.
+///     If return value = 0, the pivot indices of the block
+///     factorizations; row i of A was interchanged with row ipiv(i),
+///     within the same block. If return value > 0, ipiv is not set.
+///
+/// @param[in,out] B
+///     The n-by-nrhs matrix B, stored in an ldb-by-nrhs array.
+///     On entry, the n-by-nrhs right hand side matrix B.
+///     On exit, if return value = 0, the n-by-nrhs solution matrix X;
+///     if return value > 0, B is unchanged.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B. ldb >= max(1,n).
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, the diagonal block holding row i,
+///     or the reduced system, has an exactly zero pivot at row i; the
+///     solution has not been computed, and AB and B are restored to
+///     their values on entry.
+///
+/// @ingroup gbsv
+int64_t gbsv_parallel(
+    int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    std::complex<double>* AB, int64_t ldab,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb )
+{
+    return impl::gbsv_parallel( n, kl, ku, nrhs, AB, ldab, ipiv, B, ldb );
+}
+
+}  // namespace lapack
@@ -32,6 +32,7 @@ int64_t gbsvx(
     float* ferr,
     float* berr )
 {
+    internal::StatsScope stats_scope( "sgbsvx" );
     char fact_ = to_char( fact );
     char trans_ = to_char( trans );
     char equed_ = to_char( *equed );
@@ -43,7 +44,7 @@ int64_t gbsvx(
     lapack_int ldafb_ = to_lapack_int( ldafb );
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
         lapack_int* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int* ipiv_ptr = ipiv;
@@ -97,6 +98,7 @@ int64_t gbsvx(
     double* ferr,
     double* berr )
 {
+    internal::StatsScope stats_scope( "dgbsvx" );
     char fact_ = to_char( fact );
     char trans_ = to_char( trans );
     char equed_ = to_char( *equed );
@@ -108,7 +110,7 @@ int64_t gbsvx(
     lapack_int ldafb_ = to_lapack_int( ldafb );
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
         lapack_int* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int* ipiv_ptr = ipiv;
@@ -162,6 +164,7 @@ int64_t gbsvx(
     float* ferr,
     float* berr )
 {
+    internal::StatsScope stats_scope( "cgbsvx" );
     char fact_ = to_char( fact );
     char trans_ = to_char( trans );
     char equed_ = to_char( *equed );
@@ -173,7 +176,7 @@ int64_t gbsvx(
     lapack_int ldafb_ = to_lapack_int( ldafb );
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
         lapack_int* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int* ipiv_ptr = ipiv;
@@ -448,6 +451,7 @@ int64_t gbsvx(
     double* ferr,
     double* berr )
 {
+    internal::StatsScope stats_scope( "zgbsvx" );
     char fact_ = to_char( fact );
     char trans_ = to_char( trans );
     char equed_ = to_char( *equed );
@@ -459,7 +463,7 @@ int64_t gbsvx(
     lapack_int ldafb_ = to_lapack_int( ldafb );
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
         lapack_int* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int* ipiv_ptr = ipiv;
@@ -497,4 +501,242 @@ int64_t gbsvx(
     return info_;
 }
 
+#ifndef LAPACK_ILP64
+
+// -----------------------------------------------------------------------------
+/// @ingroup gbsv
+int64_t gbsvx(
+    lapack::Factored fact, lapack::Op trans, int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    float* AB, int64_t ldab,
+    float* AFB, int64_t ldafb,
+    lapack_int* ipiv,
+    lapack::Equed* equed,
+    float* R,
+    float* C,
+    float* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr )
+{
+    internal::StatsScope stats_scope( "sgbsvx" );
+    char fact_ = to_char( fact );
+    char trans_ = to_char( trans );
+    char equed_ = to_char( *equed );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int kl_ = to_lapack_int( kl );
+    lapack_int ku_ = to_lapack_int( ku );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int ldab_ = to_lapack_int( ldab );
+    lapack_int ldafb_ = to_lapack_int( ldafb );
+    lapack_int* ipiv_ptr = ipiv;
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int ldx_ = to_lapack_int( ldx );
+    lapack_int info_ = 0;
+
+    // allocate workspace
+    lapack::vector< float > work( (3*n) );
+    lapack::vector< lapack_int > iwork( (n) );
+
+    LAPACK_sgbsvx(
+        &fact_, &trans_, &n_, &kl_, &ku_, &nrhs_,
+        AB, &ldab_,
+        AFB, &ldafb_,
+        ipiv_ptr,
+        &equed_,
+        R,
+        C,
+        B, &ldb_,
+        X, &ldx_, rcond,
+        ferr,
+        berr,
+        &work[0],
+        &iwork[0], &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    from_string( std::string( 1, equed_ ), equed );
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gbsv
+int64_t gbsvx(
+    lapack::Factored fact, lapack::Op trans, int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    double* AB, int64_t ldab,
+    double* AFB, int64_t ldafb,
+    lapack_int* ipiv,
+    lapack::Equed* equed,
+    double* R,
+    double* C,
+    double* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr )
+{
+    internal::StatsScope stats_scope( "dgbsvx" );
+    char fact_ = to_char( fact );
+    char trans_ = to_char( trans );
+    char equed_ = to_char( *equed );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int kl_ = to_lapack_int( kl );
+    lapack_int ku_ = to_lapack_int( ku );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int ldab_ = to_lapack_int( ldab );
+    lapack_int ldafb_ = to_lapack_int( ldafb );
+    lapack_int* ipiv_ptr = ipiv;
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int ldx_ = to_lapack_int( ldx );
+    lapack_int info_ = 0;
+
+    // allocate workspace
+    lapack::vector< double > work( (3*n) );
+    lapack::vector< lapack_int > iwork( (n) );
+
+    LAPACK_dgbsvx(
+        &fact_, &trans_, &n_, &kl_, &ku_, &nrhs_,
+        AB, &ldab_,
+        AFB, &ldafb_,
+        ipiv_ptr,
+        &equed_,
+        R,
+        C,
+        B, &ldb_,
+        X, &ldx_, rcond,
+        ferr,
+        berr,
+        &work[0],
+        &iwork[0], &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    from_string( std::string( 1, equed_ ), equed );
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gbsv
+int64_t gbsvx(
+    lapack::Factored fact, lapack::Op trans, int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    std::complex<float>* AB, int64_t ldab,
+    std::complex<float>* AFB, int64_t ldafb,
+    lapack_int* ipiv,
+    lapack::Equed* equed,
+    float* R,
+    float* C,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* X, int64_t ldx,
+    float* rcond,
+    float* ferr,
+    float* berr )
+{
+    internal::StatsScope stats_scope( "cgbsvx" );
+    char fact_ = to_char( fact );
+    char trans_ = to_char( trans );
+    char equed_ = to_char( *equed );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int kl_ = to_lapack_int( kl );
+    lapack_int ku_ = to_lapack_int( ku );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int ldab_ = to_lapack_int( ldab );
+    lapack_int ldafb_ = to_lapack_int( ldafb );
+    lapack_int* ipiv_ptr = ipiv;
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int ldx_ = to_lapack_int( ldx );
+    lapack_int info_ = 0;
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( (2*n) );
+    lapack::vector< float > rwork( (n) );
+
+    LAPACK_cgbsvx(
+        &fact_, &trans_, &n_, &kl_, &ku_, &nrhs_,
+        (lapack_complex_float*) AB, &ldab_,
+        (lapack_complex_float*) AFB, &ldafb_,
+        ipiv_ptr,
+        &equed_,
+        R,
+        C,
+        (lapack_complex_float*) B, &ldb_,
+        (lapack_complex_float*) X, &ldx_, rcond,
+        ferr,
+        berr,
+        (lapack_complex_float*) &work[0],
+        &rwork[0], &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    from_string( std::string( 1, equed_ ), equed );
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::gbsvx that takes ipiv in the native LAPACK integer
+/// type, lapack_int, instead of int64_t, which avoids allocating and
+/// copying a temporary pivot array. Available only when lapack_int is
+/// 32-bit, i.e., LAPACK_ILP64 is not defined; otherwise the int64_t
+/// version is already native.
+///
+/// @ingroup gbsv
+int64_t gbsvx(
+    lapack::Factored fact, lapack::Op trans, int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    std::complex<double>* AB, int64_t ldab,
+    std::complex<double>* AFB, int64_t ldafb,
+    lapack_int* ipiv,
+    lapack::Equed* equed,
+    double* R,
+    double* C,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    double* rcond,
+    double* ferr,
+    double* berr )
+{
+    internal::StatsScope stats_scope( "zgbsvx" );
+    char fact_ = to_char( fact );
+    char trans_ = to_char( trans );
+    char equed_ = to_char( *equed );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int kl_ = to_lapack_int( kl );
+    lapack_int ku_ = to_lapack_int( ku );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int ldab_ = to_lapack_int( ldab );
+    lapack_int ldafb_ = to_lapack_int( ldafb );
+    lapack_int* ipiv_ptr = ipiv;
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int ldx_ = to_lapack_int( ldx );
+    lapack_int info_ = 0;
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( (2*n) );
+    lapack::vector< double > rwork( (n) );
+
+    LAPACK_zgbsvx(
+        &fact_, &trans_, &n_, &kl_, &ku_, &nrhs_,
+        (lapack_complex_double*) AB, &ldab_,
+        (lapack_complex_double*) AFB, &ldafb_,
+        ipiv_ptr,
+        &equed_,
+        R,
+        C,
+        (lapack_complex_double*) B, &ldb_,
+        (lapack_complex_double*) X, &ldx_, rcond,
+        ferr,
+        berr,
+        (lapack_complex_double*) &work[0],
+        &rwork[0], &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    from_string( std::string( 1, equed_ ), equed );
+    return info_;
+}
+
+#endif  // LAPACK_ILP64
+
 }  // namespace lapack
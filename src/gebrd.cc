@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack_internal.hh"
 #include "lapack/fortran.h"
+#include "work_size_cache.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -18,14 +19,20 @@ using blas::real;
 
 // -----------------------------------------------------------------------------
 /// @ingroup gesvd_computational
-int64_t gebrd(
+void gebrd_work_size(
     int64_t m, int64_t n,
     float* A, int64_t lda,
     float* D,
     float* E,
     float* tauq,
-    float* taup )
+    float* taup,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "sgebrd" );
+    internal::WorkSizeKey key( "sgebrd", { m, n, lda } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -34,6 +41,7 @@ int64_t gebrd(
     // query for workspace size
     float qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_sgebrd(
         &m_, &n_,
         A, &lda_,
@@ -42,13 +50,30 @@ int64_t gebrd(
         tauq,
         taup,
         qry_work, &ineg_one, &info_ );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd_computational
+int64_t gebrd(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* D,
+    float* E,
+    float* tauq,
+    float* taup,
+    float* work, int64_t lwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_sgebrd(
         &m_, &n_,
@@ -57,7 +82,7 @@ int64_t gebrd(
         E,
         tauq,
         taup,
-        &work[0], &lwork_, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -67,13 +92,43 @@ int64_t gebrd(
 // -----------------------------------------------------------------------------
 /// @ingroup gesvd_computational
 int64_t gebrd(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* D,
+    float* E,
+    float* tauq,
+    float* taup )
+{
+    internal::StatsScope stats_scope( "sgebrd" );
+    int64_t lwork;
+    gebrd_work_size(
+        m, n, A, lda, D, E, tauq, taup,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return gebrd(
+        m, n, A, lda, D, E, tauq, taup,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd_computational
+void gebrd_work_size(
     int64_t m, int64_t n,
     double* A, int64_t lda,
     double* D,
     double* E,
     double* tauq,
-    double* taup )
+    double* taup,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "dgebrd" );
+    internal::WorkSizeKey key( "dgebrd", { m, n, lda } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -82,6 +137,7 @@ int64_t gebrd(
     // query for workspace size
     double qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_dgebrd(
         &m_, &n_,
         A, &lda_,
@@ -90,13 +146,30 @@ int64_t gebrd(
         tauq,
         taup,
         qry_work, &ineg_one, &info_ );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd_computational
+int64_t gebrd(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* D,
+    double* E,
+    double* tauq,
+    double* taup,
+    double* work, int64_t lwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_dgebrd(
         &m_, &n_,
@@ -105,7 +178,7 @@ int64_t gebrd(
         E,
         tauq,
         taup,
-        &work[0], &lwork_, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -115,13 +188,43 @@ int64_t gebrd(
 // -----------------------------------------------------------------------------
 /// @ingroup gesvd_computational
 int64_t gebrd(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* D,
+    double* E,
+    double* tauq,
+    double* taup )
+{
+    internal::StatsScope stats_scope( "dgebrd" );
+    int64_t lwork;
+    gebrd_work_size(
+        m, n, A, lda, D, E, tauq, taup,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return gebrd(
+        m, n, A, lda, D, E, tauq, taup,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd_computational
+void gebrd_work_size(
     int64_t m, int64_t n,
     std::complex<float>* A, int64_t lda,
     float* D,
     float* E,
     std::complex<float>* tauq,
-    std::complex<float>* taup )
+    std::complex<float>* taup,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "cgebrd" );
+    internal::WorkSizeKey key( "cgebrd", { m, n, lda } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -130,6 +233,7 @@ int64_t gebrd(
     // query for workspace size
     std::complex<float> qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_cgebrd(
         &m_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -138,13 +242,30 @@ int64_t gebrd(
         (lapack_complex_float*) tauq,
         (lapack_complex_float*) taup,
         (lapack_complex_float*) qry_work, &ineg_one, &info_ );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd_computational
+int64_t gebrd(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* D,
+    float* E,
+    std::complex<float>* tauq,
+    std::complex<float>* taup,
+    std::complex<float>* work, int64_t lwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_cgebrd(
         &m_, &n_,
@@ -153,7 +274,120 @@ int64_t gebrd(
         E,
         (lapack_complex_float*) tauq,
         (lapack_complex_float*) taup,
-        (lapack_complex_float*) &work[0], &lwork_, &info_ );
+        (lapack_complex_float*) work, &lwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd_computational
+int64_t gebrd(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* D,
+    float* E,
+    std::complex<float>* tauq,
+    std::complex<float>* taup )
+{
+    internal::StatsScope stats_scope( "cgebrd" );
+    int64_t lwork;
+    gebrd_work_size(
+        m, n, A, lda, D, E, tauq, taup,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+
+    return gebrd(
+        m, n, A, lda, D, E, tauq, taup,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::gebrd with caller-supplied workspace.
+/// Arguments are the same as for lapack::gebrd; the matrices are not
+/// modified. The sizes can be reused for any call of the same shape.
+///
+/// @param[out] lwork
+///     Required length of the work array.
+///
+/// @ingroup gesvd_computational
+void gebrd_work_size(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* D,
+    double* E,
+    std::complex<double>* tauq,
+    std::complex<double>* taup,
+    int64_t* lwork )
+{
+    internal::StatsScope stats_scope( "zgebrd" );
+    internal::WorkSizeKey key( "zgebrd", { m, n, lda } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+
+    // query for workspace size
+    std::complex<double> qry_work[1];
+    lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
+    LAPACK_zgebrd(
+        &m_, &n_,
+        (lapack_complex_double*) A, &lda_,
+        D,
+        E,
+        (lapack_complex_double*) tauq,
+        (lapack_complex_double*) taup,
+        (lapack_complex_double*) qry_work, &ineg_one, &info_ );
+    query_timer.stop();
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::gebrd with caller-supplied workspace, which
+/// skips the internal workspace query and allocation. Other arguments
+/// are the same as for lapack::gebrd.
+///
+/// @param[out] work
+///     Workspace of length lwork.
+///
+/// @param[in] lwork
+///     Length of work, at least as returned by lapack::gebrd_work_size.
+///
+/// @ingroup gesvd_computational
+int64_t gebrd(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* D,
+    double* E,
+    std::complex<double>* tauq,
+    std::complex<double>* taup,
+    std::complex<double>* work, int64_t lwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
+
+    LAPACK_zgebrd(
+        &m_, &n_,
+        (lapack_complex_double*) A, &lda_,
+        D,
+        E,
+        (lapack_complex_double*) tauq,
+        (lapack_complex_double*) taup,
+        (lapack_complex_double*) work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -298,42 +532,18 @@ int64_t gebrd(
     std::complex<double>* tauq,
     std::complex<double>* taup )
 {
-    lapack_int m_ = to_lapack_int( m );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int info_ = 0;
-
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgebrd(
-        &m_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        D,
-        E,
-        (lapack_complex_double*) tauq,
-        (lapack_complex_double*) taup,
-        (lapack_complex_double*) qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    internal::StatsScope stats_scope( "zgebrd" );
+    int64_t lwork;
+    gebrd_work_size(
+        m, n, A, lda, D, E, tauq, taup,
+        &lwork );
 
     // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+    lapack::vector< std::complex<double> > work( lwork );
 
-    LAPACK_zgebrd(
-        &m_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        D,
-        E,
-        (lapack_complex_double*) tauq,
-        (lapack_complex_double*) taup,
-        (lapack_complex_double*) &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return gebrd(
+        m, n, A, lda, D, E, tauq, taup,
+        &work[0], lwork );
 }
 
 }  // namespace lapack
@@ -16,27 +16,41 @@ using blas::max;
 using blas::min;
 using blas::real;
 
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void gecon_work_size(
+    lapack::Norm norm, int64_t n,
+    float const* A, int64_t lda,
+    int64_t* lwork,
+    int64_t* liwork )
+{
+    *lwork = 4*n;
+    *liwork = n;
+}
+
 // -----------------------------------------------------------------------------
 /// @ingroup gesv_computational
 int64_t gecon(
     lapack::Norm norm, int64_t n,
     float const* A, int64_t lda, float anorm,
-    float* rcond )
+    float* rcond,
+    float* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
 {
+    // gecon does not check the workspace lengths.
+    lapack_error_if( lwork < 4*n );
+    lapack_error_if( liwork < n );
+
     char norm_ = to_char( norm );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
 
-    // allocate workspace
-    lapack::vector< float > work( (4*n) );
-    lapack::vector< lapack_int > iwork( (n) );
-
     LAPACK_sgecon(
         &norm_, &n_,
         A, &lda_, &anorm, rcond,
-        &work[0],
-        &iwork[0], &info_
+        work,
+        iwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -44,27 +58,63 @@ int64_t gecon(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t gecon(
+    lapack::Norm norm, int64_t n,
+    float const* A, int64_t lda, float anorm,
+    float* rcond )
+{
+    internal::StatsScope stats_scope( "sgecon" );
+    int64_t lwork, liwork;
+    gecon_work_size(
+        norm, n, A, lda,
+        &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return gecon(
+        norm, n, A, lda, anorm, rcond,
+        &work[0], lwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void gecon_work_size(
+    lapack::Norm norm, int64_t n,
+    double const* A, int64_t lda,
+    int64_t* lwork,
+    int64_t* liwork )
+{
+    *lwork = 4*n;
+    *liwork = n;
+}
+
 // -----------------------------------------------------------------------------
 /// @ingroup gesv_computational
 int64_t gecon(
     lapack::Norm norm, int64_t n,
     double const* A, int64_t lda, double anorm,
-    double* rcond )
+    double* rcond,
+    double* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
 {
+    // gecon does not check the workspace lengths.
+    lapack_error_if( lwork < 4*n );
+    lapack_error_if( liwork < n );
+
     char norm_ = to_char( norm );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
 
-    // allocate workspace
-    lapack::vector< double > work( (4*n) );
-    lapack::vector< lapack_int > iwork( (n) );
-
     LAPACK_dgecon(
         &norm_, &n_,
         A, &lda_, &anorm, rcond,
-        &work[0],
-        &iwork[0], &info_
+        work,
+        iwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -72,27 +122,155 @@ int64_t gecon(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t gecon(
+    lapack::Norm norm, int64_t n,
+    double const* A, int64_t lda, double anorm,
+    double* rcond )
+{
+    internal::StatsScope stats_scope( "dgecon" );
+    int64_t lwork, liwork;
+    gecon_work_size(
+        norm, n, A, lda,
+        &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return gecon(
+        norm, n, A, lda, anorm, rcond,
+        &work[0], lwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void gecon_work_size(
+    lapack::Norm norm, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    int64_t* lwork,
+    int64_t* lrwork )
+{
+    *lwork = 2*n;
+    *lrwork = 2*n;
+}
+
 // -----------------------------------------------------------------------------
 /// @ingroup gesv_computational
 int64_t gecon(
     lapack::Norm norm, int64_t n,
     std::complex<float> const* A, int64_t lda, float anorm,
-    float* rcond )
+    float* rcond,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork )
 {
+    // gecon does not check the workspace lengths.
+    lapack_error_if( lwork < 2*n );
+    lapack_error_if( lrwork < 2*n );
+
     char norm_ = to_char( norm );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( (2*n) );
-    lapack::vector< float > rwork( (2*n) );
-
     LAPACK_cgecon(
         &norm_, &n_,
         (lapack_complex_float*) A, &lda_, &anorm, rcond,
-        (lapack_complex_float*) &work[0],
-        &rwork[0], &info_
+        (lapack_complex_float*) work,
+        rwork, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t gecon(
+    lapack::Norm norm, int64_t n,
+    std::complex<float> const* A, int64_t lda, float anorm,
+    float* rcond )
+{
+    internal::StatsScope stats_scope( "cgecon" );
+    int64_t lwork, lrwork;
+    gecon_work_size(
+        norm, n, A, lda,
+        &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+
+    return gecon(
+        norm, n, A, lda, anorm, rcond,
+        &work[0], lwork, &rwork[0], lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace sizes for lapack::gecon with caller-supplied workspace.
+/// gecon has no workspace query; the sizes depend only on n:
+/// lwork = 4n and liwork = n for real, lwork = 2n and lrwork = 2n for
+/// complex. Arguments are the same as for lapack::gecon, without anorm
+/// and rcond.
+///
+/// @param[out] lwork
+///     Required length of the work array.
+///
+/// @param[out] lrwork
+///     Required length of the rwork array.
+///
+/// @ingroup gesv_computational
+void gecon_work_size(
+    lapack::Norm norm, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    int64_t* lwork,
+    int64_t* lrwork )
+{
+    *lwork = 2*n;
+    *lrwork = 2*n;
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::gecon with caller-supplied workspace, which
+/// skips the internal allocation. Other arguments are the same as for
+/// lapack::gecon.
+///
+/// @param[out] work
+///     Workspace of length lwork.
+///
+/// @param[in] lwork
+///     Length of work, at least as returned by lapack::gecon_work_size.
+///
+/// @param[out] rwork
+///     Workspace of length lrwork.
+///
+/// @param[in] lrwork
+///     Length of rwork, at least as returned by lapack::gecon_work_size.
+///
+/// @ingroup gesv_computational
+int64_t gecon(
+    lapack::Norm norm, int64_t n,
+    std::complex<double> const* A, int64_t lda, double anorm,
+    double* rcond,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork )
+{
+    // gecon does not check the workspace lengths.
+    lapack_error_if( lwork < 2*n );
+    lapack_error_if( lrwork < 2*n );
+
+    char norm_ = to_char( norm );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+
+    LAPACK_zgecon(
+        &norm_, &n_,
+        (lapack_complex_double*) A, &lda_, &anorm, rcond,
+        (lapack_complex_double*) work,
+        rwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -145,25 +323,19 @@ int64_t gecon(
     std::complex<double> const* A, int64_t lda, double anorm,
     double* rcond )
 {
-    char norm_ = to_char( norm );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int info_ = 0;
+    internal::StatsScope stats_scope( "zgecon" );
+    int64_t lwork, lrwork;
+    gecon_work_size(
+        norm, n, A, lda,
+        &lwork, &lrwork );
 
     // allocate workspace
-    lapack::vector< std::complex<double> > work( (2*n) );
-    lapack::vector< double > rwork( (2*n) );
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< double > rwork( lrwork );
 
-    LAPACK_zgecon(
-        &norm_, &n_,
-        (lapack_complex_double*) A, &lda_, &anorm, rcond,
-        (lapack_complex_double*) &work[0],
-        &rwork[0], &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return gecon(
+        norm, n, A, lda, anorm, rcond,
+        &work[0], lwork, &rwork[0], lrwork );
 }
 
 }  // namespace lapack
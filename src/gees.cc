@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack_internal.hh"
 #include "lapack/fortran.h"
+#include "work_size_cache.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -17,13 +18,19 @@ using blas::min;
 using blas::real;
 
 // -----------------------------------------------------------------------------
-int64_t gees(
+void gees_work_size(
     lapack::Job jobvs, lapack::Sort sort, lapack_s_select2 select, int64_t n,
     float* A, int64_t lda,
     int64_t* sdim,
     std::complex<float>* W,
-    float* VS, int64_t ldvs )
+    float* VS, int64_t ldvs,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "sgees" );
+    internal::WorkSizeKey key( "sgees", { to_char( jobvs ), to_char( sort ), n, lda, ldvs } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     char jobvs_ = to_char( jobvs );
     char sort_ = to_char( sort );
     lapack_int n_ = to_lapack_int( n );
@@ -40,6 +47,7 @@ int64_t gees(
     float qry_work[1];
     lapack_int qry_bwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_sgees(
         &jobvs_, &sort_,
         select, &n_,
@@ -50,13 +58,37 @@ int64_t gees(
         qry_work, &ineg_one,
         qry_bwork, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gees(
+    lapack::Job jobvs, lapack::Sort sort, lapack_s_select2 select, int64_t n,
+    float* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<float>* W,
+    float* VS, int64_t ldvs,
+    float* work, int64_t lwork )
+{
+    char jobvs_ = to_char( jobvs );
+    char sort_ = to_char( sort );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int sdim_ = 0;  // out
+    lapack_int ldvs_ = to_lapack_int( ldvs );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
+
+    // split-complex representation
+    lapack::vector< float > WR( max( 1, n ) );
+    lapack::vector< float > WI( max( 1, n ) );
 
     // allocate workspace
-    lapack::vector< float > work( lwork_ );
     lapack::vector< lapack_int > bwork( (n) );
 
     LAPACK_sgees(
@@ -66,7 +98,7 @@ int64_t gees(
         &WR[0],
         &WI[0],
         VS, &ldvs_,
-        &work[0], &lwork_,
+        work, &lwork_,
         &bwork[0], &info_
     );
     if (info_ < 0) {
@@ -82,12 +114,40 @@ int64_t gees(
 
 // -----------------------------------------------------------------------------
 int64_t gees(
+    lapack::Job jobvs, lapack::Sort sort, lapack_s_select2 select, int64_t n,
+    float* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<float>* W,
+    float* VS, int64_t ldvs )
+{
+    internal::StatsScope stats_scope( "sgees" );
+    int64_t lwork;
+    gees_work_size(
+        jobvs, sort, select, n, A, lda, sdim, W, VS, ldvs,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return gees(
+        jobvs, sort, select, n, A, lda, sdim, W, VS, ldvs,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+void gees_work_size(
     lapack::Job jobvs, lapack::Sort sort, lapack_d_select2 select, int64_t n,
     double* A, int64_t lda,
     int64_t* sdim,
     std::complex<double>* W,
-    double* VS, int64_t ldvs )
+    double* VS, int64_t ldvs,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "dgees" );
+    internal::WorkSizeKey key( "dgees", { to_char( jobvs ), to_char( sort ), n, lda, ldvs } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     char jobvs_ = to_char( jobvs );
     char sort_ = to_char( sort );
     lapack_int n_ = to_lapack_int( n );
@@ -104,6 +164,7 @@ int64_t gees(
     double qry_work[1];
     lapack_int qry_bwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_dgees(
         &jobvs_, &sort_,
         select, &n_,
@@ -114,13 +175,37 @@ int64_t gees(
         qry_work, &ineg_one,
         qry_bwork, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gees(
+    lapack::Job jobvs, lapack::Sort sort, lapack_d_select2 select, int64_t n,
+    double* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<double>* W,
+    double* VS, int64_t ldvs,
+    double* work, int64_t lwork )
+{
+    char jobvs_ = to_char( jobvs );
+    char sort_ = to_char( sort );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int sdim_ = 0;  // out
+    lapack_int ldvs_ = to_lapack_int( ldvs );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
+
+    // split-complex representation
+    lapack::vector< double > WR( max( 1, n ) );
+    lapack::vector< double > WI( max( 1, n ) );
 
     // allocate workspace
-    lapack::vector< double > work( lwork_ );
     lapack::vector< lapack_int > bwork( (n) );
 
     LAPACK_dgees(
@@ -130,7 +215,7 @@ int64_t gees(
         &WR[0],
         &WI[0],
         VS, &ldvs_,
-        &work[0], &lwork_,
+        work, &lwork_,
         &bwork[0], &info_
     );
     if (info_ < 0) {
@@ -146,12 +231,41 @@ int64_t gees(
 
 // -----------------------------------------------------------------------------
 int64_t gees(
+    lapack::Job jobvs, lapack::Sort sort, lapack_d_select2 select, int64_t n,
+    double* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<double>* W,
+    double* VS, int64_t ldvs )
+{
+    internal::StatsScope stats_scope( "dgees" );
+    int64_t lwork;
+    gees_work_size(
+        jobvs, sort, select, n, A, lda, sdim, W, VS, ldvs,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return gees(
+        jobvs, sort, select, n, A, lda, sdim, W, VS, ldvs,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+void gees_work_size(
     lapack::Job jobvs, lapack::Sort sort, lapack_c_select1 select, int64_t n,
     std::complex<float>* A, int64_t lda,
     int64_t* sdim,
     std::complex<float>* W,
-    std::complex<float>* VS, int64_t ldvs )
+    std::complex<float>* VS, int64_t ldvs,
+    int64_t* lwork,
+    int64_t* lrwork )
 {
+    internal::StatsScope stats_scope( "cgees" );
+    internal::WorkSizeKey key( "cgees", { to_char( jobvs ), to_char( sort ), n, lda, ldvs } );
+    if (internal::work_size_cache_find( key, lwork, lrwork ))
+        return;
+
     char jobvs_ = to_char( jobvs );
     char sort_ = to_char( sort );
     lapack_int n_ = to_lapack_int( n );
@@ -165,6 +279,7 @@ int64_t gees(
     float qry_rwork[1];
     lapack_int qry_bwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_cgees(
         &jobvs_, &sort_,
         (LAPACK_C_SELECT1) select, &n_,
@@ -175,14 +290,36 @@ int64_t gees(
         qry_rwork,
         qry_bwork, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    *lrwork = n;
+    internal::work_size_cache_insert( key, *lwork, *lrwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gees(
+    lapack::Job jobvs, lapack::Sort sort, lapack_c_select1 select, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<float>* W,
+    std::complex<float>* VS, int64_t ldvs,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork )
+{
+    char jobvs_ = to_char( jobvs );
+    char sort_ = to_char( sort );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int sdim_ = 0;  // out
+    lapack_int ldvs_ = to_lapack_int( ldvs );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( lrwork < n );
+    lapack_int info_ = 0;
 
     // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (n) );
     lapack::vector< lapack_int > bwork( (n) );
 
     LAPACK_cgees(
@@ -191,8 +328,8 @@ int64_t gees(
         (lapack_complex_float*) A, &lda_, &sdim_,
         (lapack_complex_float*) W,
         (lapack_complex_float*) VS, &ldvs_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0],
+        (lapack_complex_float*) work, &lwork_,
+        rwork,
         &bwork[0], &info_
     );
     if (info_ < 0) {
@@ -204,12 +341,52 @@ int64_t gees(
 
 // -----------------------------------------------------------------------------
 int64_t gees(
+    lapack::Job jobvs, lapack::Sort sort, lapack_c_select1 select, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<float>* W,
+    std::complex<float>* VS, int64_t ldvs )
+{
+    internal::StatsScope stats_scope( "cgees" );
+    int64_t lwork, lrwork;
+    gees_work_size(
+        jobvs, sort, select, n, A, lda, sdim, W, VS, ldvs,
+        &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+
+    return gees(
+        jobvs, sort, select, n, A, lda, sdim, W, VS, ldvs,
+        &work[0], lwork, &rwork[0], lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::gees with caller-supplied workspace.
+/// Arguments are the same as for lapack::gees; the matrices are not
+/// modified. The sizes can be reused for any call of the same shape.
+///
+/// @param[out] lwork
+///     Required length of the work array.
+///
+/// @param[out] lrwork
+///     Required length of the rwork array.
+///
+void gees_work_size(
     lapack::Job jobvs, lapack::Sort sort, lapack_z_select1 select, int64_t n,
     std::complex<double>* A, int64_t lda,
     int64_t* sdim,
     std::complex<double>* W,
-    std::complex<double>* VS, int64_t ldvs )
+    std::complex<double>* VS, int64_t ldvs,
+    int64_t* lwork,
+    int64_t* lrwork )
 {
+    internal::StatsScope stats_scope( "zgees" );
+    internal::WorkSizeKey key( "zgees", { to_char( jobvs ), to_char( sort ), n, lda, ldvs } );
+    if (internal::work_size_cache_find( key, lwork, lrwork ))
+        return;
+
     char jobvs_ = to_char( jobvs );
     char sort_ = to_char( sort );
     lapack_int n_ = to_lapack_int( n );
@@ -223,6 +400,7 @@ int64_t gees(
     double qry_rwork[1];
     lapack_int qry_bwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_zgees(
         &jobvs_, &sort_,
         (LAPACK_Z_SELECT1) select, &n_,
@@ -233,14 +411,52 @@ int64_t gees(
         qry_rwork,
         qry_bwork, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    *lrwork = n;
+    internal::work_size_cache_insert( key, *lwork, *lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::gees with caller-supplied workspace, which
+/// skips the internal workspace query and allocation. Other arguments
+/// are the same as for lapack::gees.
+///
+/// @param[out] work
+///     Workspace of length lwork.
+///
+/// @param[in] lwork
+///     Length of work, at least as returned by lapack::gees_work_size.
+///
+/// @param[out] rwork
+///     Workspace of length lrwork.
+///
+/// @param[in] lrwork
+///     Length of rwork, at least as returned by lapack::gees_work_size.
+///
+int64_t gees(
+    lapack::Job jobvs, lapack::Sort sort, lapack_z_select1 select, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<double>* W,
+    std::complex<double>* VS, int64_t ldvs,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork )
+{
+    char jobvs_ = to_char( jobvs );
+    char sort_ = to_char( sort );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int sdim_ = 0;  // out
+    lapack_int ldvs_ = to_lapack_int( ldvs );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( lrwork < n );
+    lapack_int info_ = 0;
 
     // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (n) );
     lapack::vector< lapack_int > bwork( (n) );
 
     LAPACK_zgees(
@@ -249,8 +465,8 @@ int64_t gees(
         (lapack_complex_double*) A, &lda_, &sdim_,
         (lapack_complex_double*) W,
         (lapack_complex_double*) VS, &ldvs_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0],
+        (lapack_complex_double*) work, &lwork_,
+        rwork,
         &bwork[0], &info_
     );
     if (info_ < 0) {
@@ -260,4 +476,27 @@ int64_t gees(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+int64_t gees(
+    lapack::Job jobvs, lapack::Sort sort, lapack_z_select1 select, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<double>* W,
+    std::complex<double>* VS, int64_t ldvs )
+{
+    internal::StatsScope stats_scope( "zgees" );
+    int64_t lwork, lrwork;
+    gees_work_size(
+        jobvs, sort, select, n, A, lda, sdim, W, VS, ldvs,
+        &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+
+    return gees(
+        jobvs, sort, select, n, A, lda, sdim, W, VS, ldvs,
+        &work[0], lwork, &rwork[0], lrwork );
+}
+
 }  // namespace lapack
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack_internal.hh"
 #include "lapack/fortran.h"
+#include "work_size_cache.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -17,15 +18,23 @@ using blas::min;
 using blas::real;
 
 // -----------------------------------------------------------------------------
-int64_t geesx(
+void geesx_work_size(
     lapack::Job jobvs, lapack::Sort sort, lapack_s_select2 select, lapack::Sense sense, int64_t n,
     float* A, int64_t lda,
     int64_t* sdim,
     std::complex<float>* W,
     float* VS, int64_t ldvs,
     float* rconde,
-    float* rcondv )
+    float* rcondv,
+    int64_t* lwork,
+    int64_t* liwork )
 {
+    internal::StatsScope stats_scope( "sgeesx" );
+    internal::WorkSizeKey key( "sgeesx",
+        { to_char( jobvs ), to_char( sort ), to_char( sense ), n, lda, ldvs } );
+    if (internal::work_size_cache_find( key, lwork, nullptr, liwork ))
+        return;
+
     char jobvs_ = to_char( jobvs );
     char sort_ = to_char( sort );
     char sense_ = to_char( sense );
@@ -44,6 +53,7 @@ int64_t geesx(
     lapack_int qry_iwork[1];
     lapack_int qry_bwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_sgeesx(
         &jobvs_, &sort_,
         select, &sense_, &n_,
@@ -55,15 +65,43 @@ int64_t geesx(
         qry_iwork, &ineg_one,
         qry_bwork, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    *lwork = real(qry_work[0]);
+    *liwork = real(qry_iwork[0]);
+    internal::work_size_cache_insert( key, *lwork, 0, *liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t geesx(
+    lapack::Job jobvs, lapack::Sort sort, lapack_s_select2 select, lapack::Sense sense, int64_t n,
+    float* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<float>* W,
+    float* VS, int64_t ldvs,
+    float* rconde,
+    float* rcondv,
+    float* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    char jobvs_ = to_char( jobvs );
+    char sort_ = to_char( sort );
+    char sense_ = to_char( sense );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int sdim_ = 0;  // out
+    lapack_int ldvs_ = to_lapack_int( ldvs );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int liwork_ = to_lapack_int( liwork );
+    lapack_int info_ = 0;
+
+    // split-complex representation
+    lapack::vector< float > WR( max( 1, n ) );
+    lapack::vector< float > WI( max( 1, n ) );
 
     // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
     lapack::vector< lapack_int > bwork( (n) );
 
     LAPACK_sgeesx(
@@ -73,8 +111,8 @@ int64_t geesx(
         &WR[0],
         &WI[0],
         VS, &ldvs_, rconde, rcondv,
-        &work[0], &lwork_,
-        &iwork[0], &liwork_,
+        work, &lwork_,
+        iwork, &liwork_,
         &bwork[0], &info_
     );
     if (info_ < 0) {
@@ -90,14 +128,49 @@ int64_t geesx(
 
 // -----------------------------------------------------------------------------
 int64_t geesx(
+    lapack::Job jobvs, lapack::Sort sort, lapack_s_select2 select, lapack::Sense sense, int64_t n,
+    float* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<float>* W,
+    float* VS, int64_t ldvs,
+    float* rconde,
+    float* rcondv )
+{
+    internal::StatsScope stats_scope( "sgeesx" );
+    int64_t lwork, liwork;
+    geesx_work_size(
+        jobvs, sort, select, sense, n, A, lda, sdim, W, VS, ldvs, rconde,
+        rcondv,
+        &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return geesx(
+        jobvs, sort, select, sense, n, A, lda, sdim, W, VS, ldvs, rconde,
+        rcondv,
+        &work[0], lwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+void geesx_work_size(
     lapack::Job jobvs, lapack::Sort sort, lapack_d_select2 select, lapack::Sense sense, int64_t n,
     double* A, int64_t lda,
     int64_t* sdim,
     std::complex<double>* W,
     double* VS, int64_t ldvs,
     double* rconde,
-    double* rcondv )
+    double* rcondv,
+    int64_t* lwork,
+    int64_t* liwork )
 {
+    internal::StatsScope stats_scope( "dgeesx" );
+    internal::WorkSizeKey key( "dgeesx",
+        { to_char( jobvs ), to_char( sort ), to_char( sense ), n, lda, ldvs } );
+    if (internal::work_size_cache_find( key, lwork, nullptr, liwork ))
+        return;
+
     char jobvs_ = to_char( jobvs );
     char sort_ = to_char( sort );
     char sense_ = to_char( sense );
@@ -116,6 +189,7 @@ int64_t geesx(
     lapack_int qry_iwork[1];
     lapack_int qry_bwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_dgeesx(
         &jobvs_, &sort_,
         select, &sense_, &n_,
@@ -127,15 +201,43 @@ int64_t geesx(
         qry_iwork, &ineg_one,
         qry_bwork, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    *lwork = real(qry_work[0]);
+    *liwork = real(qry_iwork[0]);
+    internal::work_size_cache_insert( key, *lwork, 0, *liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t geesx(
+    lapack::Job jobvs, lapack::Sort sort, lapack_d_select2 select, lapack::Sense sense, int64_t n,
+    double* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<double>* W,
+    double* VS, int64_t ldvs,
+    double* rconde,
+    double* rcondv,
+    double* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    char jobvs_ = to_char( jobvs );
+    char sort_ = to_char( sort );
+    char sense_ = to_char( sense );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int sdim_ = 0;  // out
+    lapack_int ldvs_ = to_lapack_int( ldvs );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int liwork_ = to_lapack_int( liwork );
+    lapack_int info_ = 0;
+
+    // split-complex representation
+    lapack::vector< double > WR( max( 1, n ) );
+    lapack::vector< double > WI( max( 1, n ) );
 
     // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
     lapack::vector< lapack_int > bwork( (n) );
 
     LAPACK_dgeesx(
@@ -145,8 +247,8 @@ int64_t geesx(
         &WR[0],
         &WI[0],
         VS, &ldvs_, rconde, rcondv,
-        &work[0], &lwork_,
-        &iwork[0], &liwork_,
+        work, &lwork_,
+        iwork, &liwork_,
         &bwork[0], &info_
     );
     if (info_ < 0) {
@@ -162,14 +264,49 @@ int64_t geesx(
 
 // -----------------------------------------------------------------------------
 int64_t geesx(
+    lapack::Job jobvs, lapack::Sort sort, lapack_d_select2 select, lapack::Sense sense, int64_t n,
+    double* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<double>* W,
+    double* VS, int64_t ldvs,
+    double* rconde,
+    double* rcondv )
+{
+    internal::StatsScope stats_scope( "dgeesx" );
+    int64_t lwork, liwork;
+    geesx_work_size(
+        jobvs, sort, select, sense, n, A, lda, sdim, W, VS, ldvs, rconde,
+        rcondv,
+        &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return geesx(
+        jobvs, sort, select, sense, n, A, lda, sdim, W, VS, ldvs, rconde,
+        rcondv,
+        &work[0], lwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+void geesx_work_size(
     lapack::Job jobvs, lapack::Sort sort, lapack_c_select1 select, lapack::Sense sense, int64_t n,
     std::complex<float>* A, int64_t lda,
     int64_t* sdim,
     std::complex<float>* W,
     std::complex<float>* VS, int64_t ldvs,
     float* rconde,
-    float* rcondv )
+    float* rcondv,
+    int64_t* lwork,
+    int64_t* lrwork )
 {
+    internal::StatsScope stats_scope( "cgeesx" );
+    internal::WorkSizeKey key( "cgeesx",
+        { to_char( jobvs ), to_char( sort ), to_char( sense ), n, lda, ldvs } );
+    if (internal::work_size_cache_find( key, lwork, lrwork ))
+        return;
+
     char jobvs_ = to_char( jobvs );
     char sort_ = to_char( sort );
     char sense_ = to_char( sense );
@@ -184,6 +321,7 @@ int64_t geesx(
     float qry_rwork[1];
     lapack_int qry_bwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_cgeesx(
         &jobvs_, &sort_,
         (LAPACK_C_SELECT1) select, &sense_, &n_,
@@ -194,14 +332,39 @@ int64_t geesx(
         qry_rwork,
         qry_bwork, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    *lrwork = n;
+    internal::work_size_cache_insert( key, *lwork, *lrwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t geesx(
+    lapack::Job jobvs, lapack::Sort sort, lapack_c_select1 select, lapack::Sense sense, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<float>* W,
+    std::complex<float>* VS, int64_t ldvs,
+    float* rconde,
+    float* rcondv,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork )
+{
+    char jobvs_ = to_char( jobvs );
+    char sort_ = to_char( sort );
+    char sense_ = to_char( sense );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int sdim_ = 0;  // out
+    lapack_int ldvs_ = to_lapack_int( ldvs );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( lrwork < n );
+    lapack_int info_ = 0;
 
     // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (n) );
     lapack::vector< lapack_int > bwork( (n) );
 
     LAPACK_cgeesx(
@@ -210,8 +373,8 @@ int64_t geesx(
         (lapack_complex_float*) A, &lda_, &sdim_,
         (lapack_complex_float*) W,
         (lapack_complex_float*) VS, &ldvs_, rconde, rcondv,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0],
+        (lapack_complex_float*) work, &lwork_,
+        rwork,
         &bwork[0], &info_
     );
     if (info_ < 0) {
@@ -223,14 +386,59 @@ int64_t geesx(
 
 // -----------------------------------------------------------------------------
 int64_t geesx(
+    lapack::Job jobvs, lapack::Sort sort, lapack_c_select1 select, lapack::Sense sense, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<float>* W,
+    std::complex<float>* VS, int64_t ldvs,
+    float* rconde,
+    float* rcondv )
+{
+    internal::StatsScope stats_scope( "cgeesx" );
+    int64_t lwork, lrwork;
+    geesx_work_size(
+        jobvs, sort, select, sense, n, A, lda, sdim, W, VS, ldvs, rconde,
+        rcondv,
+        &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+
+    return geesx(
+        jobvs, sort, select, sense, n, A, lda, sdim, W, VS, ldvs, rconde,
+        rcondv,
+        &work[0], lwork, &rwork[0], lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::geesx with caller-supplied workspace.
+/// Arguments are the same as for lapack::geesx; the matrices are not
+/// modified. The sizes can be reused for any call of the same shape.
+///
+/// @param[out] lwork
+///     Required length of the work array.
+///
+/// @param[out] lrwork
+///     Required length of the rwork array.
+///
+void geesx_work_size(
     lapack::Job jobvs, lapack::Sort sort, lapack_z_select1 select, lapack::Sense sense, int64_t n,
     std::complex<double>* A, int64_t lda,
     int64_t* sdim,
     std::complex<double>* W,
     std::complex<double>* VS, int64_t ldvs,
     double* rconde,
-    double* rcondv )
+    double* rcondv,
+    int64_t* lwork,
+    int64_t* lrwork )
 {
+    internal::StatsScope stats_scope( "zgeesx" );
+    internal::WorkSizeKey key( "zgeesx",
+        { to_char( jobvs ), to_char( sort ), to_char( sense ), n, lda, ldvs } );
+    if (internal::work_size_cache_find( key, lwork, lrwork ))
+        return;
+
     char jobvs_ = to_char( jobvs );
     char sort_ = to_char( sort );
     char sense_ = to_char( sense );
@@ -245,6 +453,7 @@ int64_t geesx(
     double qry_rwork[1];
     lapack_int qry_bwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_zgeesx(
         &jobvs_, &sort_,
         (LAPACK_Z_SELECT1) select, &sense_, &n_,
@@ -255,14 +464,55 @@ int64_t geesx(
         qry_rwork,
         qry_bwork, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    *lrwork = n;
+    internal::work_size_cache_insert( key, *lwork, *lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::geesx with caller-supplied workspace, which
+/// skips the internal workspace query and allocation. Other arguments
+/// are the same as for lapack::geesx.
+///
+/// @param[out] work
+///     Workspace of length lwork.
+///
+/// @param[in] lwork
+///     Length of work, at least as returned by lapack::geesx_work_size.
+///
+/// @param[out] rwork
+///     Workspace of length lrwork.
+///
+/// @param[in] lrwork
+///     Length of rwork, at least as returned by lapack::geesx_work_size.
+///
+int64_t geesx(
+    lapack::Job jobvs, lapack::Sort sort, lapack_z_select1 select, lapack::Sense sense, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<double>* W,
+    std::complex<double>* VS, int64_t ldvs,
+    double* rconde,
+    double* rcondv,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork )
+{
+    char jobvs_ = to_char( jobvs );
+    char sort_ = to_char( sort );
+    char sense_ = to_char( sense );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int sdim_ = 0;  // out
+    lapack_int ldvs_ = to_lapack_int( ldvs );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( lrwork < n );
+    lapack_int info_ = 0;
 
     // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (n) );
     lapack::vector< lapack_int > bwork( (n) );
 
     LAPACK_zgeesx(
@@ -271,8 +521,8 @@ int64_t geesx(
         (lapack_complex_double*) A, &lda_, &sdim_,
         (lapack_complex_double*) W,
         (lapack_complex_double*) VS, &ldvs_, rconde, rcondv,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0],
+        (lapack_complex_double*) work, &lwork_,
+        rwork,
         &bwork[0], &info_
     );
     if (info_ < 0) {
@@ -282,4 +532,31 @@ int64_t geesx(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+int64_t geesx(
+    lapack::Job jobvs, lapack::Sort sort, lapack_z_select1 select, lapack::Sense sense, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<double>* W,
+    std::complex<double>* VS, int64_t ldvs,
+    double* rconde,
+    double* rcondv )
+{
+    internal::StatsScope stats_scope( "zgeesx" );
+    int64_t lwork, lrwork;
+    geesx_work_size(
+        jobvs, sort, select, sense, n, A, lda, sdim, W, VS, ldvs, rconde,
+        rcondv,
+        &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+
+    return geesx(
+        jobvs, sort, select, sense, n, A, lda, sdim, W, VS, ldvs, rconde,
+        rcondv,
+        &work[0], lwork, &rwork[0], lrwork );
+}
+
 }  // namespace lapack
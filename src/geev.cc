@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack_internal.hh"
 #include "lapack/fortran.h"
+#include "work_size_cache.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -18,13 +19,19 @@ using blas::real;
 
 // -----------------------------------------------------------------------------
 /// @ingroup geev
-int64_t geev(
+void geev_work_size(
     lapack::Job jobvl, lapack::Job jobvr, int64_t n,
     float* A, int64_t lda,
     std::complex<float>* W,
     float* VL, int64_t ldvl,
-    float* VR, int64_t ldvr )
+    float* VR, int64_t ldvr,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "sgeev" );
+    internal::WorkSizeKey key( "sgeev", { to_char( jobvl ), to_char( jobvr ), n, lda, ldvl, ldvr } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     char jobvl_ = to_char( jobvl );
     char jobvr_ = to_char( jobvr );
     lapack_int n_ = to_lapack_int( n );
@@ -40,6 +47,7 @@ int64_t geev(
     // query for workspace size
     float qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_sgeev(
         &jobvl_, &jobvr_, &n_,
         A, &lda_,
@@ -48,13 +56,37 @@ int64_t geev(
         VR, &ldvr_,
         qry_work, &ineg_one, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup geev
+int64_t geev(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    float* A, int64_t lda,
+    std::complex<float>* W,
+    float* VL, int64_t ldvl,
+    float* VR, int64_t ldvr,
+    float* work, int64_t lwork )
+{
+    internal::StatsScope stats_scope( "sgeev" );
+    char jobvl_ = to_char( jobvl );
+    char jobvr_ = to_char( jobvr );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldvl_ = to_lapack_int( ldvl );
+    lapack_int ldvr_ = to_lapack_int( ldvr );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
+
+    // split-complex representation
+    lapack::vector< float > WR( max( 1, n ) );
+    lapack::vector< float > WI( max( 1, n ) );
 
     LAPACK_sgeev(
         &jobvl_, &jobvr_, &n_,
@@ -62,7 +94,7 @@ int64_t geev(
         &WR[0], &WI[0],
         VL, &ldvl_,
         VR, &ldvr_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -77,12 +109,41 @@ int64_t geev(
 // -----------------------------------------------------------------------------
 /// @ingroup geev
 int64_t geev(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    float* A, int64_t lda,
+    std::complex<float>* W,
+    float* VL, int64_t ldvl,
+    float* VR, int64_t ldvr )
+{
+    internal::StatsScope stats_scope( "sgeev" );
+    int64_t lwork;
+    geev_work_size(
+        jobvl, jobvr, n, A, lda, W, VL, ldvl, VR, ldvr,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return geev(
+        jobvl, jobvr, n, A, lda, W, VL, ldvl, VR, ldvr,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev
+void geev_work_size(
     lapack::Job jobvl, lapack::Job jobvr, int64_t n,
     double* A, int64_t lda,
     std::complex<double>* W,
     double* VL, int64_t ldvl,
-    double* VR, int64_t ldvr )
+    double* VR, int64_t ldvr,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "dgeev" );
+    internal::WorkSizeKey key( "dgeev", { to_char( jobvl ), to_char( jobvr ), n, lda, ldvl, ldvr } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     char jobvl_ = to_char( jobvl );
     char jobvr_ = to_char( jobvr );
     lapack_int n_ = to_lapack_int( n );
@@ -98,6 +159,7 @@ int64_t geev(
     // query for workspace size
     double qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_dgeev(
         &jobvl_, &jobvr_, &n_,
         A, &lda_,
@@ -106,13 +168,37 @@ int64_t geev(
         VR, &ldvr_,
         qry_work, &ineg_one, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup geev
+int64_t geev(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    double* A, int64_t lda,
+    std::complex<double>* W,
+    double* VL, int64_t ldvl,
+    double* VR, int64_t ldvr,
+    double* work, int64_t lwork )
+{
+    internal::StatsScope stats_scope( "dgeev" );
+    char jobvl_ = to_char( jobvl );
+    char jobvr_ = to_char( jobvr );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldvl_ = to_lapack_int( ldvl );
+    lapack_int ldvr_ = to_lapack_int( ldvr );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
+
+    // split-complex representation
+    lapack::vector< double > WR( max( 1, n ) );
+    lapack::vector< double > WI( max( 1, n ) );
 
     LAPACK_dgeev(
         &jobvl_, &jobvr_, &n_,
@@ -120,7 +206,7 @@ int64_t geev(
         &WR[0], &WI[0],
         VL, &ldvl_,
         VR, &ldvr_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -135,12 +221,42 @@ int64_t geev(
 // -----------------------------------------------------------------------------
 /// @ingroup geev
 int64_t geev(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    double* A, int64_t lda,
+    std::complex<double>* W,
+    double* VL, int64_t ldvl,
+    double* VR, int64_t ldvr )
+{
+    internal::StatsScope stats_scope( "dgeev" );
+    int64_t lwork;
+    geev_work_size(
+        jobvl, jobvr, n, A, lda, W, VL, ldvl, VR, ldvr,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return geev(
+        jobvl, jobvr, n, A, lda, W, VL, ldvl, VR, ldvr,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev
+void geev_work_size(
     lapack::Job jobvl, lapack::Job jobvr, int64_t n,
     std::complex<float>* A, int64_t lda,
     std::complex<float>* W,
     std::complex<float>* VL, int64_t ldvl,
-    std::complex<float>* VR, int64_t ldvr )
+    std::complex<float>* VR, int64_t ldvr,
+    int64_t* lwork,
+    int64_t* lrwork )
 {
+    internal::StatsScope stats_scope( "cgeev" );
+    internal::WorkSizeKey key( "cgeev", { to_char( jobvl ), to_char( jobvr ), n, lda, ldvl, ldvr } );
+    if (internal::work_size_cache_find( key, lwork, lrwork ))
+        return;
+
     char jobvl_ = to_char( jobvl );
     char jobvr_ = to_char( jobvr );
     lapack_int n_ = to_lapack_int( n );
@@ -153,6 +269,7 @@ int64_t geev(
     std::complex<float> qry_work[1];
     float qry_rwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_cgeev(
         &jobvl_, &jobvr_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -162,14 +279,35 @@ int64_t geev(
         (lapack_complex_float*) qry_work, &ineg_one,
         qry_rwork, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    *lrwork = 2*n;
+    internal::work_size_cache_insert( key, *lwork, *lrwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (2*n) );
+// -----------------------------------------------------------------------------
+/// @ingroup geev
+int64_t geev(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* W,
+    std::complex<float>* VL, int64_t ldvl,
+    std::complex<float>* VR, int64_t ldvr,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork )
+{
+    char jobvl_ = to_char( jobvl );
+    char jobvr_ = to_char( jobvr );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldvl_ = to_lapack_int( ldvl );
+    lapack_int ldvr_ = to_lapack_int( ldvr );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( lrwork < 2*n );
+    lapack_int info_ = 0;
 
     LAPACK_cgeev(
         &jobvl_, &jobvr_, &n_,
@@ -177,8 +315,141 @@ int64_t geev(
         (lapack_complex_float*) W,
         (lapack_complex_float*) VL, &ldvl_,
         (lapack_complex_float*) VR, &ldvr_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0], &info_
+        (lapack_complex_float*) work, &lwork_,
+        rwork, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev
+int64_t geev(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* W,
+    std::complex<float>* VL, int64_t ldvl,
+    std::complex<float>* VR, int64_t ldvr )
+{
+    internal::StatsScope stats_scope( "cgeev" );
+    int64_t lwork, lrwork;
+    geev_work_size(
+        jobvl, jobvr, n, A, lda, W, VL, ldvl, VR, ldvr,
+        &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+
+    return geev(
+        jobvl, jobvr, n, A, lda, W, VL, ldvl, VR, ldvr,
+        &work[0], lwork, &rwork[0], lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::geev with caller-supplied workspace.
+/// Arguments are the same as for lapack::geev; the matrices are not
+/// modified. The sizes can be reused for any call of the same shape.
+///
+/// @param[out] lwork
+///     Required length of the work array.
+///
+/// @param[out] lrwork
+///     Required length of the rwork array.
+///
+/// @ingroup geev
+void geev_work_size(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* W,
+    std::complex<double>* VL, int64_t ldvl,
+    std::complex<double>* VR, int64_t ldvr,
+    int64_t* lwork,
+    int64_t* lrwork )
+{
+    internal::StatsScope stats_scope( "zgeev" );
+    internal::WorkSizeKey key( "zgeev", { to_char( jobvl ), to_char( jobvr ), n, lda, ldvl, ldvr } );
+    if (internal::work_size_cache_find( key, lwork, lrwork ))
+        return;
+
+    char jobvl_ = to_char( jobvl );
+    char jobvr_ = to_char( jobvr );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldvl_ = to_lapack_int( ldvl );
+    lapack_int ldvr_ = to_lapack_int( ldvr );
+    lapack_int info_ = 0;
+
+    // query for workspace size
+    std::complex<double> qry_work[1];
+    double qry_rwork[1];
+    lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
+    LAPACK_zgeev(
+        &jobvl_, &jobvr_, &n_,
+        (lapack_complex_double*) A, &lda_,
+        (lapack_complex_double*) W,
+        (lapack_complex_double*) VL, &ldvl_,
+        (lapack_complex_double*) VR, &ldvr_,
+        (lapack_complex_double*) qry_work, &ineg_one,
+        qry_rwork, &info_
+    );
+    query_timer.stop();
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    *lrwork = 2*n;
+    internal::work_size_cache_insert( key, *lwork, *lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::geev with caller-supplied workspace, which
+/// skips the internal workspace query and allocation. Other arguments
+/// are the same as for lapack::geev.
+///
+/// @param[out] work
+///     Workspace of length lwork.
+///
+/// @param[in] lwork
+///     Length of work, at least as returned by lapack::geev_work_size.
+///
+/// @param[out] rwork
+///     Workspace of length lrwork.
+///
+/// @param[in] lrwork
+///     Length of rwork, at least as returned by lapack::geev_work_size.
+///
+/// @ingroup geev
+int64_t geev(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* W,
+    std::complex<double>* VL, int64_t ldvl,
+    std::complex<double>* VR, int64_t ldvr,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork )
+{
+    char jobvl_ = to_char( jobvl );
+    char jobvr_ = to_char( jobvr );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldvl_ = to_lapack_int( ldvl );
+    lapack_int ldvr_ = to_lapack_int( ldvr );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( lrwork < 2*n );
+    lapack_int info_ = 0;
+
+    LAPACK_zgeev(
+        &jobvl_, &jobvr_, &n_,
+        (lapack_complex_double*) A, &lda_,
+        (lapack_complex_double*) W,
+        (lapack_complex_double*) VL, &ldvl_,
+        (lapack_complex_double*) VR, &ldvr_,
+        (lapack_complex_double*) work, &lwork_,
+        rwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -295,49 +566,19 @@ int64_t geev(
     std::complex<double>* VL, int64_t ldvl,
     std::complex<double>* VR, int64_t ldvr )
 {
-    char jobvl_ = to_char( jobvl );
-    char jobvr_ = to_char( jobvr );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int ldvl_ = to_lapack_int( ldvl );
-    lapack_int ldvr_ = to_lapack_int( ldvr );
-    lapack_int info_ = 0;
-
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    double qry_rwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgeev(
-        &jobvl_, &jobvr_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) W,
-        (lapack_complex_double*) VL, &ldvl_,
-        (lapack_complex_double*) VR, &ldvr_,
-        (lapack_complex_double*) qry_work, &ineg_one,
-        qry_rwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    internal::StatsScope stats_scope( "zgeev" );
+    int64_t lwork, lrwork;
+    geev_work_size(
+        jobvl, jobvr, n, A, lda, W, VL, ldvl, VR, ldvr,
+        &lwork, &lrwork );
 
     // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (2*n) );
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< double > rwork( lrwork );
 
-    LAPACK_zgeev(
-        &jobvl_, &jobvr_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) W,
-        (lapack_complex_double*) VL, &ldvl_,
-        (lapack_complex_double*) VR, &ldvr_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0], &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return geev(
+        jobvl, jobvr, n, A, lda, W, VL, ldvl, VR, ldvr,
+        &work[0], lwork, &rwork[0], lrwork );
 }
 
 }  // namespace lapack
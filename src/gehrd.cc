@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack_internal.hh"
 #include "lapack/fortran.h"
+#include "work_size_cache.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -18,11 +19,17 @@ using blas::real;
 
 // -----------------------------------------------------------------------------
 /// @ingroup geev_computational
-int64_t gehrd(
+void gehrd_work_size(
     int64_t n, int64_t ilo, int64_t ihi,
     float* A, int64_t lda,
-    float* tau )
+    float* tau,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "sgehrd" );
+    internal::WorkSizeKey key( "sgehrd", { n, ilo, ihi, lda } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int ilo_ = to_lapack_int( ilo );
     lapack_int ihi_ = to_lapack_int( ihi );
@@ -32,24 +39,40 @@ int64_t gehrd(
     // query for workspace size
     float qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_sgehrd(
         &n_, &ilo_, &ihi_,
         A, &lda_,
         tau,
         qry_work, &ineg_one, &info_ );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+int64_t gehrd(
+    int64_t n, int64_t ilo, int64_t ihi,
+    float* A, int64_t lda,
+    float* tau,
+    float* work, int64_t lwork )
+{
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ilo_ = to_lapack_int( ilo );
+    lapack_int ihi_ = to_lapack_int( ihi );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_sgehrd(
         &n_, &ilo_, &ihi_,
         A, &lda_,
         tau,
-        &work[0], &lwork_, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -59,10 +82,37 @@ int64_t gehrd(
 // -----------------------------------------------------------------------------
 /// @ingroup geev_computational
 int64_t gehrd(
+    int64_t n, int64_t ilo, int64_t ihi,
+    float* A, int64_t lda,
+    float* tau )
+{
+    internal::StatsScope stats_scope( "sgehrd" );
+    int64_t lwork;
+    gehrd_work_size(
+        n, ilo, ihi, A, lda, tau,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return gehrd(
+        n, ilo, ihi, A, lda, tau,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+void gehrd_work_size(
     int64_t n, int64_t ilo, int64_t ihi,
     double* A, int64_t lda,
-    double* tau )
+    double* tau,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "dgehrd" );
+    internal::WorkSizeKey key( "dgehrd", { n, ilo, ihi, lda } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int ilo_ = to_lapack_int( ilo );
     lapack_int ihi_ = to_lapack_int( ihi );
@@ -72,24 +122,40 @@ int64_t gehrd(
     // query for workspace size
     double qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_dgehrd(
         &n_, &ilo_, &ihi_,
         A, &lda_,
         tau,
         qry_work, &ineg_one, &info_ );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+int64_t gehrd(
+    int64_t n, int64_t ilo, int64_t ihi,
+    double* A, int64_t lda,
+    double* tau,
+    double* work, int64_t lwork )
+{
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ilo_ = to_lapack_int( ilo );
+    lapack_int ihi_ = to_lapack_int( ihi );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_dgehrd(
         &n_, &ilo_, &ihi_,
         A, &lda_,
         tau,
-        &work[0], &lwork_, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -99,10 +165,37 @@ int64_t gehrd(
 // -----------------------------------------------------------------------------
 /// @ingroup geev_computational
 int64_t gehrd(
+    int64_t n, int64_t ilo, int64_t ihi,
+    double* A, int64_t lda,
+    double* tau )
+{
+    internal::StatsScope stats_scope( "dgehrd" );
+    int64_t lwork;
+    gehrd_work_size(
+        n, ilo, ihi, A, lda, tau,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return gehrd(
+        n, ilo, ihi, A, lda, tau,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+void gehrd_work_size(
     int64_t n, int64_t ilo, int64_t ihi,
     std::complex<float>* A, int64_t lda,
-    std::complex<float>* tau )
+    std::complex<float>* tau,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "cgehrd" );
+    internal::WorkSizeKey key( "cgehrd", { n, ilo, ihi, lda } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int ilo_ = to_lapack_int( ilo );
     lapack_int ihi_ = to_lapack_int( ihi );
@@ -112,24 +205,140 @@ int64_t gehrd(
     // query for workspace size
     std::complex<float> qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_cgehrd(
         &n_, &ilo_, &ihi_,
         (lapack_complex_float*) A, &lda_,
         (lapack_complex_float*) tau,
         (lapack_complex_float*) qry_work, &ineg_one, &info_ );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+int64_t gehrd(
+    int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau,
+    std::complex<float>* work, int64_t lwork )
+{
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ilo_ = to_lapack_int( ilo );
+    lapack_int ihi_ = to_lapack_int( ihi );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_cgehrd(
         &n_, &ilo_, &ihi_,
         (lapack_complex_float*) A, &lda_,
         (lapack_complex_float*) tau,
-        (lapack_complex_float*) &work[0], &lwork_, &info_ );
+        (lapack_complex_float*) work, &lwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+int64_t gehrd(
+    int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* tau )
+{
+    internal::StatsScope stats_scope( "cgehrd" );
+    int64_t lwork;
+    gehrd_work_size(
+        n, ilo, ihi, A, lda, tau,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+
+    return gehrd(
+        n, ilo, ihi, A, lda, tau,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::gehrd with caller-supplied workspace.
+/// Arguments are the same as for lapack::gehrd; the matrices are not
+/// modified. The sizes can be reused for any call of the same shape.
+///
+/// @param[out] lwork
+///     Required length of the work array.
+///
+/// @ingroup geev_computational
+void gehrd_work_size(
+    int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    int64_t* lwork )
+{
+    internal::StatsScope stats_scope( "zgehrd" );
+    internal::WorkSizeKey key( "zgehrd", { n, ilo, ihi, lda } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ilo_ = to_lapack_int( ilo );
+    lapack_int ihi_ = to_lapack_int( ihi );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+
+    // query for workspace size
+    std::complex<double> qry_work[1];
+    lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
+    LAPACK_zgehrd(
+        &n_, &ilo_, &ihi_,
+        (lapack_complex_double*) A, &lda_,
+        (lapack_complex_double*) tau,
+        (lapack_complex_double*) qry_work, &ineg_one, &info_ );
+    query_timer.stop();
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::gehrd with caller-supplied workspace, which
+/// skips the internal workspace query and allocation. Other arguments
+/// are the same as for lapack::gehrd.
+///
+/// @param[out] work
+///     Workspace of length lwork.
+///
+/// @param[in] lwork
+///     Length of work, at least as returned by lapack::gehrd_work_size.
+///
+/// @ingroup geev_computational
+int64_t gehrd(
+    int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* tau,
+    std::complex<double>* work, int64_t lwork )
+{
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ilo_ = to_lapack_int( ilo );
+    lapack_int ihi_ = to_lapack_int( ihi );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
+
+    LAPACK_zgehrd(
+        &n_, &ilo_, &ihi_,
+        (lapack_complex_double*) A, &lda_,
+        (lapack_complex_double*) tau,
+        (lapack_complex_double*) work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -220,37 +429,18 @@ int64_t gehrd(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* tau )
 {
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int ilo_ = to_lapack_int( ilo );
-    lapack_int ihi_ = to_lapack_int( ihi );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int info_ = 0;
-
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgehrd(
-        &n_, &ilo_, &ihi_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) tau,
-        (lapack_complex_double*) qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    internal::StatsScope stats_scope( "zgehrd" );
+    int64_t lwork;
+    gehrd_work_size(
+        n, ilo, ihi, A, lda, tau,
+        &lwork );
 
     // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+    lapack::vector< std::complex<double> > work( lwork );
 
-    LAPACK_zgehrd(
-        &n_, &ilo_, &ihi_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) tau,
-        (lapack_complex_double*) &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return gehrd(
+        n, ilo, ihi, A, lda, tau,
+        &work[0], lwork );
 }
 
 }  // namespace lapack
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack_internal.hh"
 #include "lapack/fortran.h"
+#include "work_size_cache.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7
@@ -19,11 +20,17 @@ using blas::min;
 using blas::real;
 
 // -----------------------------------------------------------------------------
-int64_t gelq(
+void gelq_work_size(
     int64_t m, int64_t n,
     float* A, int64_t lda,
-    float* T, int64_t tsize )
+    float* T, int64_t tsize,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "sgelq" );
+    internal::WorkSizeKey key( "sgelq", { m, n, lda, tsize } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -33,24 +40,39 @@ int64_t gelq(
     // query for workspace size
     float qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_sgelq(
         &m_, &n_,
         A, &lda_,
         T, &tsize_,
         qry_work, &ineg_one, &info_ );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+// -----------------------------------------------------------------------------
+int64_t gelq(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* T, int64_t tsize,
+    float* work, int64_t lwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int tsize_ = to_lapack_int( tsize );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_sgelq(
         &m_, &n_,
         A, &lda_,
         T, &tsize_,
-        &work[0], &lwork_, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -59,10 +81,36 @@ int64_t gelq(
 
 // -----------------------------------------------------------------------------
 int64_t gelq(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* T, int64_t tsize )
+{
+    internal::StatsScope stats_scope( "sgelq" );
+    int64_t lwork;
+    gelq_work_size(
+        m, n, A, lda, T, tsize,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return gelq(
+        m, n, A, lda, T, tsize,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+void gelq_work_size(
     int64_t m, int64_t n,
     double* A, int64_t lda,
-    double* T, int64_t tsize )
+    double* T, int64_t tsize,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "dgelq" );
+    internal::WorkSizeKey key( "dgelq", { m, n, lda, tsize } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -72,24 +120,39 @@ int64_t gelq(
     // query for workspace size
     double qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_dgelq(
         &m_, &n_,
         A, &lda_,
         T, &tsize_,
         qry_work, &ineg_one, &info_ );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+// -----------------------------------------------------------------------------
+int64_t gelq(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* T, int64_t tsize,
+    double* work, int64_t lwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int tsize_ = to_lapack_int( tsize );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_dgelq(
         &m_, &n_,
         A, &lda_,
         T, &tsize_,
-        &work[0], &lwork_, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -98,10 +161,36 @@ int64_t gelq(
 
 // -----------------------------------------------------------------------------
 int64_t gelq(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* T, int64_t tsize )
+{
+    internal::StatsScope stats_scope( "dgelq" );
+    int64_t lwork;
+    gelq_work_size(
+        m, n, A, lda, T, tsize,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return gelq(
+        m, n, A, lda, T, tsize,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+void gelq_work_size(
     int64_t m, int64_t n,
     std::complex<float>* A, int64_t lda,
-    std::complex<float>* T, int64_t tsize )
+    std::complex<float>* T, int64_t tsize,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "cgelq" );
+    internal::WorkSizeKey key( "cgelq", { m, n, lda, tsize } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -111,24 +200,39 @@ int64_t gelq(
     // query for workspace size
     std::complex<float> qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_cgelq(
         &m_, &n_,
         (lapack_complex_float*) A, &lda_,
         (lapack_complex_float*) T, &tsize_,
         (lapack_complex_float*) qry_work, &ineg_one, &info_ );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+// -----------------------------------------------------------------------------
+int64_t gelq(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* T, int64_t tsize,
+    std::complex<float>* work, int64_t lwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int tsize_ = to_lapack_int( tsize );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_cgelq(
         &m_, &n_,
         (lapack_complex_float*) A, &lda_,
         (lapack_complex_float*) T, &tsize_,
-        (lapack_complex_float*) &work[0], &lwork_, &info_ );
+        (lapack_complex_float*) work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -137,10 +241,43 @@ int64_t gelq(
 
 // -----------------------------------------------------------------------------
 int64_t gelq(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* T, int64_t tsize )
+{
+    internal::StatsScope stats_scope( "cgelq" );
+    int64_t lwork;
+    gelq_work_size(
+        m, n, A, lda, T, tsize,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+
+    return gelq(
+        m, n, A, lda, T, tsize,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::gelq with caller-supplied workspace.
+/// Arguments are the same as for lapack::gelq; the matrices are not
+/// modified. The sizes can be reused for any call of the same shape.
+///
+/// @param[out] lwork
+///     Required length of the work array.
+///
+void gelq_work_size(
     int64_t m, int64_t n,
     std::complex<double>* A, int64_t lda,
-    std::complex<double>* T, int64_t tsize )
+    std::complex<double>* T, int64_t tsize,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "zgelq" );
+    internal::WorkSizeKey key( "zgelq", { m, n, lda, tsize } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -150,30 +287,75 @@ int64_t gelq(
     // query for workspace size
     std::complex<double> qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_zgelq(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
         (lapack_complex_double*) T, &tsize_,
         (lapack_complex_double*) qry_work, &ineg_one, &info_ );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// Variant of lapack::gelq with caller-supplied workspace, which
+/// skips the internal workspace query and allocation. Other arguments
+/// are the same as for lapack::gelq.
+///
+/// @param[out] work
+///     Workspace of length lwork.
+///
+/// @param[in] lwork
+///     Length of work, at least as returned by lapack::gelq_work_size.
+///
+int64_t gelq(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* T, int64_t tsize,
+    std::complex<double>* work, int64_t lwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int tsize_ = to_lapack_int( tsize );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_zgelq(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
         (lapack_complex_double*) T, &tsize_,
-        (lapack_complex_double*) &work[0], &lwork_, &info_ );
+        (lapack_complex_double*) work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+int64_t gelq(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* T, int64_t tsize )
+{
+    internal::StatsScope stats_scope( "zgelq" );
+    int64_t lwork;
+    gelq_work_size(
+        m, n, A, lda, T, tsize,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+
+    return gelq(
+        m, n, A, lda, T, tsize,
+        &work[0], lwork );
+}
+
 }  // namespace lapack
 
 #endif  // LAPACK >= 3.7
@@ -0,0 +1,312 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "mixed_internal.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper.
+/// @ingroup gels
+///
+template <typename scalar_t>
+int64_t gels_mixed(
+    int64_t m, int64_t n, int64_t nrhs,
+    scalar_t* A, int64_t lda,
+    scalar_t const* B, int64_t ldb,
+    scalar_t* X, int64_t ldx,
+    int64_t* iter )
+{
+    using low_t = internal::lower_precision_t< scalar_t >;
+    using real_t = blas::real_type< scalar_t >;
+
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 || n > m );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+    lapack_error_if( ldb < max( 1, m ) );
+    lapack_error_if( ldx < max( 1, n ) );
+
+    *iter = 0;
+    if (n == 0 || nrhs == 0) {
+        lapack::laset( MatrixType::General, n, nrhs, 0.0, 0.0, X, ldx );
+        return 0;
+    }
+
+    auto cabs1 = []( scalar_t z ) {
+        return std::abs( std::real( z ) ) + std::abs( std::imag( z ) );
+    };
+    auto norm_inf = [&]( int64_t len, scalar_t const* x ) {
+        return cabs1( x[ blas::iamax( len, x, 1 ) ] );
+    };
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t cte = eps * std::sqrt( real_t( m ) );
+    real_t anorm_inf = lapack::lange( Norm::Inf, m, n, A, lda );
+    real_t anorm_one = lapack::lange( Norm::One, m, n, A, lda );
+
+    std::vector< low_t > SA( m*n );
+    std::vector< low_t > tau( n );
+    std::vector< low_t > SF( m*nrhs );
+    std::vector< low_t > SG( n*nrhs );
+    // Residuals of the augmented system, F = B - R - A X and G = -A^H R,
+    // and the least squares residual R = B - A X itself.
+    std::vector< scalar_t > F( m*nrhs );
+    std::vector< scalar_t > G( n*nrhs );
+    std::vector< scalar_t > R( m*nrhs );
+
+    // Solves the augmented system
+    //     [ I    A ] [ dr ] = [ F ]
+    //     [ A^H  0 ] [ dx ]   [ G ]
+    // with the lower precision QR factors A = Q [ Rf; 0 ]: with
+    // h = Rf^{-H} G and d = Q^H F, dr = Q [ h; d(n:m) ] and
+    // dx = Rf^{-1} (d(0:n) - h). Then R += dr, X += dx.
+    // Returns false if F or G overflows in lower precision.
+    int64_t lwork;
+    lapack::unmqr_work_size( Side::Left, Op::ConjTrans, m, nrhs, n,
+                             SA.data(), m, tau.data(), SF.data(), m, &lwork );
+    std::vector< low_t > work( lwork );
+    auto correct = [&]() {
+        if (internal::lag2lower( m, nrhs, F.data(), m, SF.data(), m ) != 0
+            || internal::lag2lower( n, nrhs, G.data(), n, SG.data(), n ) != 0)
+            return false;
+
+        blas::trsm( Layout::ColMajor, Side::Left, Uplo::Upper, Op::ConjTrans,
+                    Diag::NonUnit, n, nrhs, 1.0f, SA.data(), m, SG.data(), n );
+        lapack::unmqr( Side::Left, Op::ConjTrans, m, nrhs, n,
+                       SA.data(), m, tau.data(), SF.data(), m,
+                       work.data(), lwork );
+        for (int64_t j = 0; j < nrhs; ++j) {
+            for (int64_t i = 0; i < n; ++i) {
+                low_t h = SG[ i + j*n ];
+                SG[ i + j*n ] = SF[ i + j*m ] - h;
+                SF[ i + j*m ] = h;
+            }
+        }
+        lapack::unmqr( Side::Left, Op::NoTrans, m, nrhs, n,
+                       SA.data(), m, tau.data(), SF.data(), m,
+                       work.data(), lwork );
+        blas::trsm( Layout::ColMajor, Side::Left, Uplo::Upper, Op::NoTrans,
+                    Diag::NonUnit, n, nrhs, 1.0f, SA.data(), m, SG.data(), n );
+
+        // Reuse F and G to promote the corrections.
+        internal::lag2higher( m, nrhs, SF.data(), m, F.data(), m );
+        internal::lag2higher( n, nrhs, SG.data(), n, G.data(), n );
+        for (int64_t j = 0; j < nrhs; ++j) {
+            blas::axpy( m, 1.0, &F[ j*m ], 1, &R[ j*m ], 1 );
+            blas::axpy( n, 1.0, &G[ j*n ], 1, &X[ j*ldx ], 1 );
+        }
+        return true;
+    };
+
+    // Factor in lower precision, unless A overflows there. geqrf does not
+    // detect rank deficiency, so check the diagonal of Rf for zeros.
+    bool singular = false;
+    if (internal::lag2lower( m, n, A, lda, SA.data(), m ) != 0) {
+        *iter = -2;
+    }
+    else {
+        lapack::geqrf( m, n, SA.data(), m, tau.data() );
+        for (int64_t i = 0; i < n; ++i)
+            singular = singular || SA[ i + i*m ] == low_t( 0 );
+        if (singular)
+            *iter = -3;
+    }
+
+    // Initial solve from X = 0, R = 0, so F = B, G = 0.
+    if (*iter == 0) {
+        lapack::lacpy( MatrixType::General, m, nrhs, B, ldb, F.data(), m );
+        std::fill( G.begin(), G.end(), scalar_t( 0 ) );
+        std::fill( R.begin(), R.end(), scalar_t( 0 ) );
+        lapack::laset( MatrixType::General, n, nrhs, 0.0, 0.0, X, ldx );
+        if (! correct())
+            *iter = -2;
+    }
+
+    if (*iter == 0) {
+        // Refine, while either residual keeps decreasing. Columns have
+        // converged when F and G are at the level of rounding errors in
+        // computing B - A X: for each column,
+        //     || f ||_inf <= bound,  || g ||_inf <= || A ||_1 bound,
+        // with bound = (|| r ||_inf + || A ||_inf || x ||_inf) eps sqrt( m ).
+        // For a consistent system, r is only accurate to that level, so g
+        // cannot be smaller.
+        real_t fnorm_prev = std::numeric_limits< real_t >::infinity();
+        real_t gnorm_prev = fnorm_prev;
+        for (int64_t it = 0; ; ++it) {
+            // F = B - R - A X and G = -A^H R, in higher precision.
+            lapack::lacpy( MatrixType::General, m, nrhs, B, ldb, F.data(), m );
+            for (int64_t j = 0; j < nrhs; ++j)
+                blas::axpy( m, -1.0, &R[ j*m ], 1, &F[ j*m ], 1 );
+            blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                        m, nrhs, n,
+                        -1.0, A, lda,
+                              X, ldx,
+                         1.0, F.data(), m );
+            blas::gemm( Layout::ColMajor, Op::ConjTrans, Op::NoTrans,
+                        n, nrhs, m,
+                        -1.0, A, lda,
+                              R.data(), m,
+                         0.0, G.data(), n );
+
+            bool converged = true;
+            real_t fnorm = 0, gnorm = 0;
+            for (int64_t j = 0; j < nrhs; ++j) {
+                real_t fnrm = norm_inf( m, &F[ j*m ] );
+                real_t gnrm = norm_inf( n, &G[ j*n ] );
+                real_t rnrm = norm_inf( m, &R[ j*m ] );
+                real_t xnrm = norm_inf( n, &X[ j*ldx ] );
+                real_t bound = (rnrm + anorm_inf * xnrm) * cte;
+                converged = converged
+                            && fnrm <= bound
+                            && gnrm <= anorm_one * bound;
+                // NaN propagates, so it stalls refinement.
+                if (! (fnrm <= fnorm) && ! std::isnan( fnorm ))
+                    fnorm = fnrm;
+                if (! (gnrm <= gnorm) && ! std::isnan( gnorm ))
+                    gnorm = gnrm;
+            }
+            if (converged) {
+                *iter = it;
+                return 0;
+            }
+            if (it == internal::mixed_itermax
+                || (! (fnorm < fnorm_prev) && ! (gnorm < gnorm_prev))) {
+                *iter = -(internal::mixed_itermax + 1);
+                break;
+            }
+            fnorm_prev = fnorm;
+            gnorm_prev = gnorm;
+
+            if (! correct()) {
+                *iter = -2;
+                break;
+            }
+        }
+    }
+
+    // Fall back to factoring and solving in higher precision.
+    std::vector< scalar_t > W( m*nrhs );
+    lapack::lacpy( MatrixType::General, m, nrhs, B, ldb, W.data(), m );
+    int64_t info = lapack::gels( Op::NoTrans, m, n, nrhs, A, lda, W.data(), m );
+    lapack::lacpy( MatrixType::General, n, nrhs, W.data(), m, X, ldx );
+    return info;
+}
+
+}  // namespace impl
+
+//------------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gels_mixed(
+    int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    int64_t* iter )
+{
+    return impl::gels_mixed( m, n, nrhs, A, lda, B, ldb, X, ldx, iter );
+}
+
+//------------------------------------------------------------------------------
+/// Solves the overdetermined least squares problem
+///     $\min_X \| B - A X \|_F$,
+/// where A is an m-by-n matrix of full rank, m >= n, and X and B are
+/// n-by-nrhs and m-by-nrhs matrices, using mixed precision iterative
+/// refinement.
+///
+/// A is factored by lapack::geqrf in single precision, $A = Q R$, and
+/// the solution is refined to double precision accuracy by iterative
+/// refinement on the augmented system
+///     $\begin{bmatrix} I & A \\ A^H & 0 \end{bmatrix}
+///      \begin{bmatrix} r \\ x \end{bmatrix}
+///     = \begin{bmatrix} b \\ 0 \end{bmatrix},$
+/// whose residuals are computed in double, and whose corrections are
+/// solved with the single precision factors Q and R, by lapack::unmqr
+/// and trsm. Refining the least squares residual r along with x, as
+/// Bjorck proposed, is needed to reach double precision accuracy when
+/// r is not small; refining only the normal equations is not enough.
+/// Each refinement step costs $O(m n \, nrhs)$.
+///
+/// Falls back to lapack::gels in double precision if A overflows in
+/// single precision, if the single precision R has a zero on its
+/// diagonal, or if refinement stalls or does not converge in 30
+/// iterations. Convergence needs roughly
+/// $\kappa(A) < 1/\epsilon_{single} \approx 10^7$.
+///
+/// Overloaded versions are available for
+/// `double` and `std::complex<double>`,
+/// factoring in `float` and `std::complex<float>`, respectively.
+///
+/// @see gesv_mixed
+///
+/// @param[in] m
+///     The number of rows of the matrix A. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of the matrix A. 0 <= n <= m.
+///
+/// @param[in] nrhs
+///     The number of right hand sides, i.e., the number of columns
+///     of the matrices B and X. nrhs >= 0.
+///
+/// @param[in,out] A
+///     The m-by-n matrix A, stored in an lda-by-n array.
+///     On exit, if iter >= 0, unchanged; if iter < 0, the QR factorization
+///     of A computed in double precision, as returned by lapack::geqrf.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,m).
+///
+/// @param[in] B
+///     The m-by-nrhs right hand side matrix B, stored in an ldb-by-nrhs
+///     array.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B. ldb >= max(1,m).
+///
+/// @param[out] X
+///     The n-by-nrhs solution matrix X, stored in an ldx-by-nrhs array.
+///
+/// @param[in] ldx
+///     The leading dimension of the array X. ldx >= max(1,n).
+///
+/// @param[out] iter
+///     - >= 0: the number of refinement iterations; A was factored
+///             only in single precision.
+///     - < 0: refinement failed, and A was factored in double precision:
+///         - -2: A, or a residual, overflows in single precision;
+///         - -3: the single precision R has a zero diagonal entry;
+///         - -31: refinement stalled or did not converge in 30 iterations.
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, the i-th diagonal element of the
+///              triangular factor of A computed in double precision is
+///              zero, so that A does not have full rank; the least
+///              squares solution could not be computed.
+///
+/// @ingroup gels
+int64_t gels_mixed(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    int64_t* iter )
+{
+    return impl::gels_mixed( m, n, nrhs, A, lda, B, ldb, X, ldx, iter );
+}
+
+}  // namespace lapack
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack_internal.hh"
 #include "lapack/fortran.h"
+#include "work_size_cache.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -18,13 +19,20 @@ using blas::real;
 
 // -----------------------------------------------------------------------------
 /// @ingroup gels
-int64_t gelsd(
+void gelsd_work_size(
     int64_t m, int64_t n, int64_t nrhs,
     float* A, int64_t lda,
     float* B, int64_t ldb,
     float* S, float rcond,
-    int64_t* rank )
+    int64_t* rank,
+    int64_t* lwork,
+    int64_t* liwork )
 {
+    internal::StatsScope stats_scope( "sgelsd" );
+    internal::WorkSizeKey key( "sgelsd", { m, n, nrhs, lda, ldb } );
+    if (internal::work_size_cache_find( key, lwork, nullptr, liwork ))
+        return;
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -37,6 +45,7 @@ int64_t gelsd(
     float qry_work[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_sgelsd(
         &m_, &n_, &nrhs_,
         A, &lda_,
@@ -44,23 +53,43 @@ int64_t gelsd(
         S, &rcond, &rank_,
         qry_work, &ineg_one,
         qry_iwork, &info_ );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = qry_iwork[0];
+    *lwork = real(qry_work[0]);
+    *liwork = qry_iwork[0];
+    internal::work_size_cache_insert( key, *lwork, 0, *liwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gelsd(
+    int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank,
+    float* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int rank_ = 0;  // out
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int liwork_ = to_lapack_int( liwork );
+    lapack_int info_ = 0;
 
     LAPACK_sgelsd(
         &m_, &n_, &nrhs_,
         A, &lda_,
         B, &ldb_,
         S, &rcond, &rank_,
-        &work[0], &lwork_,
-        &iwork[0], &info_ );
+        work, &lwork_,
+        iwork, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -71,12 +100,43 @@ int64_t gelsd(
 // -----------------------------------------------------------------------------
 /// @ingroup gels
 int64_t gelsd(
+    int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank )
+{
+    internal::StatsScope stats_scope( "sgelsd" );
+    int64_t lwork, liwork;
+    gelsd_work_size(
+        m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+        &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return gelsd(
+        m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+        &work[0], lwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+void gelsd_work_size(
     int64_t m, int64_t n, int64_t nrhs,
     double* A, int64_t lda,
     double* B, int64_t ldb,
     double* S, double rcond,
-    int64_t* rank )
+    int64_t* rank,
+    int64_t* lwork,
+    int64_t* liwork )
 {
+    internal::StatsScope stats_scope( "dgelsd" );
+    internal::WorkSizeKey key( "dgelsd", { m, n, nrhs, lda, ldb } );
+    if (internal::work_size_cache_find( key, lwork, nullptr, liwork ))
+        return;
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -89,6 +149,7 @@ int64_t gelsd(
     double qry_work[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_dgelsd(
         &m_, &n_, &nrhs_,
         A, &lda_,
@@ -96,23 +157,43 @@ int64_t gelsd(
         S, &rcond, &rank_,
         qry_work, &ineg_one,
         qry_iwork, &info_ );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = qry_iwork[0];
+    *lwork = real(qry_work[0]);
+    *liwork = qry_iwork[0];
+    internal::work_size_cache_insert( key, *lwork, 0, *liwork );
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gelsd(
+    int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank,
+    double* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int rank_ = 0;  // out
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int liwork_ = to_lapack_int( liwork );
+    lapack_int info_ = 0;
 
     LAPACK_dgelsd(
         &m_, &n_, &nrhs_,
         A, &lda_,
         B, &ldb_,
         S, &rcond, &rank_,
-        &work[0], &lwork_,
-        &iwork[0], &info_ );
+        work, &lwork_,
+        iwork, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -123,12 +204,44 @@ int64_t gelsd(
 // -----------------------------------------------------------------------------
 /// @ingroup gels
 int64_t gelsd(
+    int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank )
+{
+    internal::StatsScope stats_scope( "dgelsd" );
+    int64_t lwork, liwork;
+    gelsd_work_size(
+        m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+        &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return gelsd(
+        m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+        &work[0], lwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+void gelsd_work_size(
     int64_t m, int64_t n, int64_t nrhs,
     std::complex<float>* A, int64_t lda,
     std::complex<float>* B, int64_t ldb,
     float* S, float rcond,
-    int64_t* rank )
+    int64_t* rank,
+    int64_t* lwork,
+    int64_t* lrwork,
+    int64_t* liwork )
 {
+    internal::StatsScope stats_scope( "cgelsd" );
+    internal::WorkSizeKey key( "cgelsd", { m, n, nrhs, lda, ldb } );
+    if (internal::work_size_cache_find( key, lwork, lrwork, liwork ))
+        return;
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -142,6 +255,7 @@ int64_t gelsd(
     float qry_rwork[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_cgelsd(
         &m_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
@@ -150,26 +264,194 @@ int64_t gelsd(
         (lapack_complex_float*) qry_work, &ineg_one,
         qry_rwork,
         qry_iwork, &info_ );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int lrwork_ = qry_rwork[0];
-    lapack_int liwork_ = qry_iwork[0];
+    *lwork = real(qry_work[0]);
+    *lrwork = qry_rwork[0];
+    *liwork = qry_iwork[0];
+    internal::work_size_cache_insert( key, *lwork, *lrwork, *liwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gelsd(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int rank_ = 0;  // out
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int lrwork_ = to_lapack_int( lrwork );
+    lapack_int liwork_ = to_lapack_int( liwork );
+    lapack_int info_ = 0;
 
     LAPACK_cgelsd(
         &m_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
         (lapack_complex_float*) B, &ldb_,
         S, &rcond, &rank_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0],
-        &iwork[0], &info_ );
+        (lapack_complex_float*) work, &lwork_,
+        rwork,
+        iwork, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *rank = rank_;
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gelsd(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank )
+{
+    internal::StatsScope stats_scope( "cgelsd" );
+    int64_t lwork, lrwork, liwork;
+    gelsd_work_size(
+        m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+        &lwork, &lrwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return gelsd(
+        m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+        &work[0], lwork, &rwork[0], lrwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::gelsd with caller-supplied workspace.
+/// Arguments are the same as for lapack::gelsd; the matrices are not
+/// modified. The sizes can be reused for any call of the same shape.
+///
+/// @param[out] lwork
+///     Required length of the work array.
+///
+/// @param[out] lrwork
+///     Required length of the rwork array.
+///
+/// @param[out] liwork
+///     Required length of the iwork array.
+///
+/// @ingroup gels
+void gelsd_work_size(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank,
+    int64_t* lwork,
+    int64_t* lrwork,
+    int64_t* liwork )
+{
+    internal::StatsScope stats_scope( "zgelsd" );
+    internal::WorkSizeKey key( "zgelsd", { m, n, nrhs, lda, ldb } );
+    if (internal::work_size_cache_find( key, lwork, lrwork, liwork ))
+        return;
+
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int rank_ = 0;  // out
+    lapack_int info_ = 0;
+
+    // query for workspace size
+    std::complex<double> qry_work[1];
+    double qry_rwork[1];
+    lapack_int qry_iwork[1];
+    lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
+    LAPACK_zgelsd(
+        &m_, &n_, &nrhs_,
+        (lapack_complex_double*) A, &lda_,
+        (lapack_complex_double*) B, &ldb_,
+        S, &rcond, &rank_,
+        (lapack_complex_double*) qry_work, &ineg_one,
+        qry_rwork,
+        qry_iwork, &info_ );
+    query_timer.stop();
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    *lrwork = qry_rwork[0];
+    *liwork = qry_iwork[0];
+    internal::work_size_cache_insert( key, *lwork, *lrwork, *liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::gelsd with caller-supplied workspace, which
+/// skips the internal workspace query and allocation. Other arguments
+/// are the same as for lapack::gelsd.
+///
+/// @param[out] work
+///     Workspace of length lwork.
+///
+/// @param[in] lwork
+///     Length of work, at least as returned by lapack::gelsd_work_size.
+///
+/// @param[out] rwork
+///     Workspace of length lrwork.
+///
+/// @param[in] lrwork
+///     Length of rwork, at least as returned by lapack::gelsd_work_size.
+///
+/// @param[out] iwork
+///     Workspace of length liwork.
+///
+/// @param[in] liwork
+///     Length of iwork, at least as returned by lapack::gelsd_work_size.
+///
+/// @ingroup gels
+int64_t gelsd(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int rank_ = 0;  // out
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int lrwork_ = to_lapack_int( lrwork );
+    lapack_int liwork_ = to_lapack_int( liwork );
+    lapack_int info_ = 0;
+
+    LAPACK_zgelsd(
+        &m_, &n_, &nrhs_,
+        (lapack_complex_double*) A, &lda_,
+        (lapack_complex_double*) B, &ldb_,
+        S, &rcond, &rank_,
+        (lapack_complex_double*) work, &lwork_,
+        rwork,
+        iwork, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -267,52 +549,20 @@ int64_t gelsd(
     double* S, double rcond,
     int64_t* rank )
 {
-    lapack_int m_ = to_lapack_int( m );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int nrhs_ = to_lapack_int( nrhs );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int ldb_ = to_lapack_int( ldb );
-    lapack_int rank_ = 0;  // out
-    lapack_int info_ = 0;
-
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    double qry_rwork[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgelsd(
-        &m_, &n_, &nrhs_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) B, &ldb_,
-        S, &rcond, &rank_,
-        (lapack_complex_double*) qry_work, &ineg_one,
-        qry_rwork,
-        qry_iwork, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int lrwork_ = qry_rwork[0];
-    lapack_int liwork_ = qry_iwork[0];
+    internal::StatsScope stats_scope( "zgelsd" );
+    int64_t lwork, lrwork, liwork;
+    gelsd_work_size(
+        m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+        &lwork, &lrwork, &liwork );
 
     // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+    lapack::vector< lapack_int > iwork( liwork );
 
-    LAPACK_zgelsd(
-        &m_, &n_, &nrhs_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) B, &ldb_,
-        S, &rcond, &rank_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0],
-        &iwork[0], &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    *rank = rank_;
-    return info_;
+    return gelsd(
+        m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+        &work[0], lwork, &rwork[0], lrwork, &iwork[0], liwork );
 }
 
 }  // namespace lapack
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack_internal.hh"
 #include "lapack/fortran.h"
+#include "work_size_cache.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -18,51 +19,78 @@ using blas::real;
 
 // -----------------------------------------------------------------------------
 /// @ingroup gels
-int64_t gelsy(
+void gelsy_work_size(
     int64_t m, int64_t n, int64_t nrhs,
     float* A, int64_t lda,
     float* B, int64_t ldb,
     int64_t* jpvt, float rcond,
-    int64_t* rank )
+    int64_t* rank,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "sgelsy" );
+    internal::WorkSizeKey key( "sgelsy", { m, n, nrhs, lda, ldb } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldb_ = to_lapack_int( ldb );
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        std::vector< lapack_int > jpvt_( &jpvt[0], &jpvt[(n)] );
-        lapack_int* jpvt_ptr = &jpvt_[0];
-    #else
-        lapack_int* jpvt_ptr = jpvt;
-    #endif
     lapack_int rank_ = 0;  // out
     lapack_int info_ = 0;
 
     // query for workspace size
+    lapack_int qry_jpvt[1];
     float qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_sgelsy(
         &m_, &n_, &nrhs_,
         A, &lda_,
         B, &ldb_,
-        jpvt_ptr, &rcond, &rank_,
+        qry_jpvt, &rcond, &rank_,
         qry_work, &ineg_one, &info_ );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gelsy(
+    int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    int64_t* jpvt, float rcond,
+    int64_t* rank,
+    float* work, int64_t lwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack::vector< lapack_int > jpvt_( &jpvt[0], &jpvt[(n)] );
+        lapack_int* jpvt_ptr = &jpvt_[0];
+    #else
+        lapack_int* jpvt_ptr = jpvt;
+    #endif
+    lapack_int rank_ = 0;  // out
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_sgelsy(
         &m_, &n_, &nrhs_,
         A, &lda_,
         B, &ldb_,
         jpvt_ptr, &rcond, &rank_,
-        &work[0], &lwork_, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -76,50 +104,100 @@ int64_t gelsy(
 // -----------------------------------------------------------------------------
 /// @ingroup gels
 int64_t gelsy(
+    int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    int64_t* jpvt, float rcond,
+    int64_t* rank )
+{
+    internal::StatsScope stats_scope( "sgelsy" );
+    int64_t lwork;
+    gelsy_work_size(
+        m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return gelsy(
+        m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+void gelsy_work_size(
     int64_t m, int64_t n, int64_t nrhs,
     double* A, int64_t lda,
     double* B, int64_t ldb,
     int64_t* jpvt, double rcond,
-    int64_t* rank )
+    int64_t* rank,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "dgelsy" );
+    internal::WorkSizeKey key( "dgelsy", { m, n, nrhs, lda, ldb } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldb_ = to_lapack_int( ldb );
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        std::vector< lapack_int > jpvt_( &jpvt[0], &jpvt[(n)] );
-        lapack_int* jpvt_ptr = &jpvt_[0];
-    #else
-        lapack_int* jpvt_ptr = jpvt;
-    #endif
     lapack_int rank_ = 0;  // out
     lapack_int info_ = 0;
 
     // query for workspace size
+    lapack_int qry_jpvt[1];
     double qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_dgelsy(
         &m_, &n_, &nrhs_,
         A, &lda_,
         B, &ldb_,
-        jpvt_ptr, &rcond, &rank_,
+        qry_jpvt, &rcond, &rank_,
         qry_work, &ineg_one, &info_ );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gelsy(
+    int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    int64_t* jpvt, double rcond,
+    int64_t* rank,
+    double* work, int64_t lwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack::vector< lapack_int > jpvt_( &jpvt[0], &jpvt[(n)] );
+        lapack_int* jpvt_ptr = &jpvt_[0];
+    #else
+        lapack_int* jpvt_ptr = jpvt;
+    #endif
+    lapack_int rank_ = 0;  // out
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_dgelsy(
         &m_, &n_, &nrhs_,
         A, &lda_,
         B, &ldb_,
         jpvt_ptr, &rcond, &rank_,
-        &work[0], &lwork_, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -133,54 +211,248 @@ int64_t gelsy(
 // -----------------------------------------------------------------------------
 /// @ingroup gels
 int64_t gelsy(
+    int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    int64_t* jpvt, double rcond,
+    int64_t* rank )
+{
+    internal::StatsScope stats_scope( "dgelsy" );
+    int64_t lwork;
+    gelsy_work_size(
+        m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return gelsy(
+        m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+void gelsy_work_size(
     int64_t m, int64_t n, int64_t nrhs,
     std::complex<float>* A, int64_t lda,
     std::complex<float>* B, int64_t ldb,
     int64_t* jpvt, float rcond,
-    int64_t* rank )
+    int64_t* rank,
+    int64_t* lwork,
+    int64_t* lrwork )
 {
+    internal::StatsScope stats_scope( "cgelsy" );
+    internal::WorkSizeKey key( "cgelsy", { m, n, nrhs, lda, ldb } );
+    if (internal::work_size_cache_find( key, lwork, lrwork ))
+        return;
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldb_ = to_lapack_int( ldb );
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        std::vector< lapack_int > jpvt_( &jpvt[0], &jpvt[(n)] );
-        lapack_int* jpvt_ptr = &jpvt_[0];
-    #else
-        lapack_int* jpvt_ptr = jpvt;
-    #endif
     lapack_int rank_ = 0;  // out
     lapack_int info_ = 0;
 
     // query for workspace size
+    lapack_int qry_jpvt[1];
     std::complex<float> qry_work[1];
     float qry_rwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_cgelsy(
         &m_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
         (lapack_complex_float*) B, &ldb_,
-        jpvt_ptr, &rcond, &rank_,
+        qry_jpvt, &rcond, &rank_,
         (lapack_complex_float*) qry_work, &ineg_one,
         qry_rwork, &info_ );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    *lrwork = 2*n;
+    internal::work_size_cache_insert( key, *lwork, *lrwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (2*n) );
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gelsy(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* jpvt, float rcond,
+    int64_t* rank,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack::vector< lapack_int > jpvt_( &jpvt[0], &jpvt[(n)] );
+        lapack_int* jpvt_ptr = &jpvt_[0];
+    #else
+        lapack_int* jpvt_ptr = jpvt;
+    #endif
+    lapack_int rank_ = 0;  // out
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( lrwork < 2*n );
+    lapack_int info_ = 0;
 
     LAPACK_cgelsy(
         &m_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
         (lapack_complex_float*) B, &ldb_,
         jpvt_ptr, &rcond, &rank_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0], &info_ );
+        (lapack_complex_float*) work, &lwork_,
+        rwork, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    #ifndef LAPACK_ILP64
+        std::copy( jpvt_.begin(), jpvt_.end(), jpvt );
+    #endif
+    *rank = rank_;
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gelsy(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* jpvt, float rcond,
+    int64_t* rank )
+{
+    internal::StatsScope stats_scope( "cgelsy" );
+    int64_t lwork, lrwork;
+    gelsy_work_size(
+        m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank,
+        &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+
+    return gelsy(
+        m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank,
+        &work[0], lwork, &rwork[0], lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::gelsy with caller-supplied workspace.
+/// Arguments are the same as for lapack::gelsy; the matrices are not
+/// modified. The sizes can be reused for any call of the same shape.
+///
+/// @param[out] lwork
+///     Required length of the work array.
+///
+/// @param[out] lrwork
+///     Required length of the rwork array.
+///
+/// @ingroup gels
+void gelsy_work_size(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    int64_t* jpvt, double rcond,
+    int64_t* rank,
+    int64_t* lwork,
+    int64_t* lrwork )
+{
+    internal::StatsScope stats_scope( "zgelsy" );
+    internal::WorkSizeKey key( "zgelsy", { m, n, nrhs, lda, ldb } );
+    if (internal::work_size_cache_find( key, lwork, lrwork ))
+        return;
+
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int rank_ = 0;  // out
+    lapack_int info_ = 0;
+
+    // query for workspace size
+    lapack_int qry_jpvt[1];
+    std::complex<double> qry_work[1];
+    double qry_rwork[1];
+    lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
+    LAPACK_zgelsy(
+        &m_, &n_, &nrhs_,
+        (lapack_complex_double*) A, &lda_,
+        (lapack_complex_double*) B, &ldb_,
+        qry_jpvt, &rcond, &rank_,
+        (lapack_complex_double*) qry_work, &ineg_one,
+        qry_rwork, &info_ );
+    query_timer.stop();
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    *lrwork = 2*n;
+    internal::work_size_cache_insert( key, *lwork, *lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::gelsy with caller-supplied workspace, which
+/// skips the internal workspace query and allocation. Other arguments
+/// are the same as for lapack::gelsy.
+///
+/// @param[out] work
+///     Workspace of length lwork.
+///
+/// @param[in] lwork
+///     Length of work, at least as returned by lapack::gelsy_work_size.
+///
+/// @param[out] rwork
+///     Workspace of length lrwork.
+///
+/// @param[in] lrwork
+///     Length of rwork, at least as returned by lapack::gelsy_work_size.
+///
+/// @ingroup gels
+int64_t gelsy(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    int64_t* jpvt, double rcond,
+    int64_t* rank,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack::vector< lapack_int > jpvt_( &jpvt[0], &jpvt[(n)] );
+        lapack_int* jpvt_ptr = &jpvt_[0];
+    #else
+        lapack_int* jpvt_ptr = jpvt;
+    #endif
+    lapack_int rank_ = 0;  // out
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( lrwork < 2*n );
+    lapack_int info_ = 0;
+
+    LAPACK_zgelsy(
+        &m_, &n_, &nrhs_,
+        (lapack_complex_double*) A, &lda_,
+        (lapack_complex_double*) B, &ldb_,
+        jpvt_ptr, &rcond, &rank_,
+        (lapack_complex_double*) work, &lwork_,
+        rwork, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -299,56 +571,19 @@ int64_t gelsy(
     int64_t* jpvt, double rcond,
     int64_t* rank )
 {
-    lapack_int m_ = to_lapack_int( m );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int nrhs_ = to_lapack_int( nrhs );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int ldb_ = to_lapack_int( ldb );
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        std::vector< lapack_int > jpvt_( &jpvt[0], &jpvt[(n)] );
-        lapack_int* jpvt_ptr = &jpvt_[0];
-    #else
-        lapack_int* jpvt_ptr = jpvt;
-    #endif
-    lapack_int rank_ = 0;  // out
-    lapack_int info_ = 0;
-
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    double qry_rwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgelsy(
-        &m_, &n_, &nrhs_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) B, &ldb_,
-        jpvt_ptr, &rcond, &rank_,
-        (lapack_complex_double*) qry_work, &ineg_one,
-        qry_rwork, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    internal::StatsScope stats_scope( "zgelsy" );
+    int64_t lwork, lrwork;
+    gelsy_work_size(
+        m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank,
+        &lwork, &lrwork );
 
     // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (2*n) );
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< double > rwork( lrwork );
 
-    LAPACK_zgelsy(
-        &m_, &n_, &nrhs_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) B, &ldb_,
-        jpvt_ptr, &rcond, &rank_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0], &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    #ifndef LAPACK_ILP64
-        std::copy( jpvt_.begin(), jpvt_.end(), jpvt );
-    #endif
-    *rank = rank_;
-    return info_;
+    return gelsy(
+        m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank,
+        &work[0], lwork, &rwork[0], lrwork );
 }
 
 }  // namespace lapack
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack_internal.hh"
 #include "lapack/fortran.h"
+#include "work_size_cache.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7
@@ -19,12 +20,19 @@ using blas::min;
 using blas::real;
 
 // -----------------------------------------------------------------------------
-int64_t gemlq(
+void gemlq_work_size(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
     float const* A, int64_t lda,
     float const* T, int64_t tsize,
-    float* C, int64_t ldc )
+    float* C, int64_t ldc,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "sgemlq" );
+    internal::WorkSizeKey key( "sgemlq",
+        { to_char( side ), to_char( trans ), m, n, k, lda, tsize, ldc } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     char side_ = to_char( side );
     char trans_ = to_char( trans );
     lapack_int m_ = to_lapack_int( m );
@@ -38,6 +46,7 @@ int64_t gemlq(
     // query for workspace size
     float qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_sgemlq(
         &side_, &trans_, &m_, &n_, &k_,
         A, &lda_,
@@ -45,20 +54,39 @@ int64_t gemlq(
         C, &ldc_,
         qry_work, &ineg_one, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+// -----------------------------------------------------------------------------
+int64_t gemlq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* T, int64_t tsize,
+    float* C, int64_t ldc,
+    float* work, int64_t lwork )
+{
+    char side_ = to_char( side );
+    char trans_ = to_char( trans );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int k_ = to_lapack_int( k );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int tsize_ = to_lapack_int( tsize );
+    lapack_int ldc_ = to_lapack_int( ldc );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_sgemlq(
         &side_, &trans_, &m_, &n_, &k_,
         A, &lda_,
         T, &tsize_,
         C, &ldc_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -68,11 +96,39 @@ int64_t gemlq(
 
 // -----------------------------------------------------------------------------
 int64_t gemlq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* T, int64_t tsize,
+    float* C, int64_t ldc )
+{
+    internal::StatsScope stats_scope( "sgemlq" );
+    int64_t lwork;
+    gemlq_work_size(
+        side, trans, m, n, k, A, lda, T, tsize, C, ldc,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return gemlq(
+        side, trans, m, n, k, A, lda, T, tsize, C, ldc,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+void gemlq_work_size(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
     double const* A, int64_t lda,
     double const* T, int64_t tsize,
-    double* C, int64_t ldc )
+    double* C, int64_t ldc,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "dgemlq" );
+    internal::WorkSizeKey key( "dgemlq",
+        { to_char( side ), to_char( trans ), m, n, k, lda, tsize, ldc } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     char side_ = to_char( side );
     char trans_ = to_char( trans );
     lapack_int m_ = to_lapack_int( m );
@@ -86,6 +142,7 @@ int64_t gemlq(
     // query for workspace size
     double qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_dgemlq(
         &side_, &trans_, &m_, &n_, &k_,
         A, &lda_,
@@ -93,20 +150,39 @@ int64_t gemlq(
         C, &ldc_,
         qry_work, &ineg_one, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+// -----------------------------------------------------------------------------
+int64_t gemlq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* T, int64_t tsize,
+    double* C, int64_t ldc,
+    double* work, int64_t lwork )
+{
+    char side_ = to_char( side );
+    char trans_ = to_char( trans );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int k_ = to_lapack_int( k );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int tsize_ = to_lapack_int( tsize );
+    lapack_int ldc_ = to_lapack_int( ldc );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_dgemlq(
         &side_, &trans_, &m_, &n_, &k_,
         A, &lda_,
         T, &tsize_,
         C, &ldc_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -116,11 +192,39 @@ int64_t gemlq(
 
 // -----------------------------------------------------------------------------
 int64_t gemlq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* T, int64_t tsize,
+    double* C, int64_t ldc )
+{
+    internal::StatsScope stats_scope( "dgemlq" );
+    int64_t lwork;
+    gemlq_work_size(
+        side, trans, m, n, k, A, lda, T, tsize, C, ldc,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return gemlq(
+        side, trans, m, n, k, A, lda, T, tsize, C, ldc,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+void gemlq_work_size(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
     std::complex<float> const* A, int64_t lda,
     std::complex<float> const* T, int64_t tsize,
-    std::complex<float>* C, int64_t ldc )
+    std::complex<float>* C, int64_t ldc,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "cgemlq" );
+    internal::WorkSizeKey key( "cgemlq",
+        { to_char( side ), to_char( trans ), m, n, k, lda, tsize, ldc } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     char side_ = to_char( side );
     char trans_ = to_char( trans );
     lapack_int m_ = to_lapack_int( m );
@@ -134,6 +238,7 @@ int64_t gemlq(
     // query for workspace size
     std::complex<float> qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_cgemlq(
         &side_, &trans_, &m_, &n_, &k_,
         (lapack_complex_float*) A, &lda_,
@@ -141,20 +246,39 @@ int64_t gemlq(
         (lapack_complex_float*) C, &ldc_,
         (lapack_complex_float*) qry_work, &ineg_one, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+// -----------------------------------------------------------------------------
+int64_t gemlq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* T, int64_t tsize,
+    std::complex<float>* C, int64_t ldc,
+    std::complex<float>* work, int64_t lwork )
+{
+    char side_ = to_char( side );
+    char trans_ = to_char( trans );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int k_ = to_lapack_int( k );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int tsize_ = to_lapack_int( tsize );
+    lapack_int ldc_ = to_lapack_int( ldc );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_cgemlq(
         &side_, &trans_, &m_, &n_, &k_,
         (lapack_complex_float*) A, &lda_,
         (lapack_complex_float*) T, &tsize_,
         (lapack_complex_float*) C, &ldc_,
-        (lapack_complex_float*) &work[0], &lwork_, &info_
+        (lapack_complex_float*) work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -164,11 +288,46 @@ int64_t gemlq(
 
 // -----------------------------------------------------------------------------
 int64_t gemlq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* T, int64_t tsize,
+    std::complex<float>* C, int64_t ldc )
+{
+    internal::StatsScope stats_scope( "cgemlq" );
+    int64_t lwork;
+    gemlq_work_size(
+        side, trans, m, n, k, A, lda, T, tsize, C, ldc,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+
+    return gemlq(
+        side, trans, m, n, k, A, lda, T, tsize, C, ldc,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::gemlq with caller-supplied workspace.
+/// Arguments are the same as for lapack::gemlq; the matrices are not
+/// modified. The sizes can be reused for any call of the same shape.
+///
+/// @param[out] lwork
+///     Required length of the work array.
+///
+void gemlq_work_size(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
     std::complex<double> const* A, int64_t lda,
     std::complex<double> const* T, int64_t tsize,
-    std::complex<double>* C, int64_t ldc )
+    std::complex<double>* C, int64_t ldc,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "zgemlq" );
+    internal::WorkSizeKey key( "zgemlq",
+        { to_char( side ), to_char( trans ), m, n, k, lda, tsize, ldc } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     char side_ = to_char( side );
     char trans_ = to_char( trans );
     lapack_int m_ = to_lapack_int( m );
@@ -182,6 +341,7 @@ int64_t gemlq(
     // query for workspace size
     std::complex<double> qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_zgemlq(
         &side_, &trans_, &m_, &n_, &k_,
         (lapack_complex_double*) A, &lda_,
@@ -189,20 +349,49 @@ int64_t gemlq(
         (lapack_complex_double*) C, &ldc_,
         (lapack_complex_double*) qry_work, &ineg_one, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// Variant of lapack::gemlq with caller-supplied workspace, which
+/// skips the internal workspace query and allocation. Other arguments
+/// are the same as for lapack::gemlq.
+///
+/// @param[out] work
+///     Workspace of length lwork.
+///
+/// @param[in] lwork
+///     Length of work, at least as returned by lapack::gemlq_work_size.
+///
+int64_t gemlq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* T, int64_t tsize,
+    std::complex<double>* C, int64_t ldc,
+    std::complex<double>* work, int64_t lwork )
+{
+    char side_ = to_char( side );
+    char trans_ = to_char( trans );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int k_ = to_lapack_int( k );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int tsize_ = to_lapack_int( tsize );
+    lapack_int ldc_ = to_lapack_int( ldc );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_zgemlq(
         &side_, &trans_, &m_, &n_, &k_,
         (lapack_complex_double*) A, &lda_,
         (lapack_complex_double*) T, &tsize_,
         (lapack_complex_double*) C, &ldc_,
-        (lapack_complex_double*) &work[0], &lwork_, &info_
+        (lapack_complex_double*) work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -210,6 +399,27 @@ int64_t gemlq(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+int64_t gemlq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* T, int64_t tsize,
+    std::complex<double>* C, int64_t ldc )
+{
+    internal::StatsScope stats_scope( "zgemlq" );
+    int64_t lwork;
+    gemlq_work_size(
+        side, trans, m, n, k, A, lda, T, tsize, C, ldc,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+
+    return gemlq(
+        side, trans, m, n, k, A, lda, T, tsize, C, ldc,
+        &work[0], lwork );
+}
+
 }  // namespace lapack
 
 #endif  // LAPACK >= 3.7
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack_internal.hh"
 #include "lapack/fortran.h"
+#include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30400  // >= 3.4.0
 
@@ -25,6 +26,7 @@ int64_t gemqrt(
     float const* T, int64_t ldt,
     float* C, int64_t ldc )
 {
+    internal::StatsScope stats_scope( "sgemqrt" );
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
         trans = Op::Trans;
@@ -44,7 +46,7 @@ int64_t gemqrt(
     lapack_int lwork_ = real((side == lapack::Side::Right) ? (m * nb) : (n * nb));
 
     // allocate workspace
-    std::vector< float > work( lwork_ );
+    lapack::vector< float > work( lwork_ );
 
     LAPACK_sgemqrt(
         &side_, &trans_, &m_, &n_, &k_, &nb_,
@@ -67,6 +69,7 @@ int64_t gemqrt(
     double const* T, int64_t ldt,
     double* C, int64_t ldc )
 {
+    internal::StatsScope stats_scope( "dgemqrt" );
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
         trans = Op::Trans;
@@ -86,7 +89,7 @@ int64_t gemqrt(
     lapack_int lwork_ = real((side == lapack::Side::Right) ? (m * nb) : (n * nb));
 
     // allocate workspace
-    std::vector< double > work( lwork_ );
+    lapack::vector< double > work( lwork_ );
 
     LAPACK_dgemqrt(
         &side_, &trans_, &m_, &n_, &k_, &nb_,
@@ -109,6 +112,7 @@ int64_t gemqrt(
     std::complex<float> const* T, int64_t ldt,
     std::complex<float>* C, int64_t ldc )
 {
+    internal::StatsScope stats_scope( "cgemqrt" );
     // for complex, map Trans to ConjTrans
     if (trans == Op::Trans)
         trans = Op::ConjTrans;
@@ -128,7 +132,7 @@ int64_t gemqrt(
     lapack_int lwork_ = real((side == lapack::Side::Right) ? (m * nb) : (n * nb));
 
     // allocate workspace
-    std::vector< std::complex<float> > work( lwork_ );
+    lapack::vector< std::complex<float> > work( lwork_ );
 
     LAPACK_cgemqrt(
         &side_, &trans_, &m_, &n_, &k_, &nb_,
@@ -226,6 +230,7 @@ int64_t gemqrt(
     std::complex<double> const* T, int64_t ldt,
     std::complex<double>* C, int64_t ldc )
 {
+    internal::StatsScope stats_scope( "zgemqrt" );
     // for complex, map Trans to ConjTrans
     if (trans == Op::Trans)
         trans = Op::ConjTrans;
@@ -245,7 +250,7 @@ int64_t gemqrt(
     lapack_int lwork_ = real((side == lapack::Side::Right) ? (m * nb) : (n * nb));
 
     // allocate workspace
-    std::vector< std::complex<double> > work( lwork_ );
+    lapack::vector< std::complex<double> > work( lwork_ );
 
     LAPACK_zgemqrt(
         &side_, &trans_, &m_, &n_, &k_, &nb_,
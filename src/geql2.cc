@@ -23,6 +23,7 @@ int64_t geql2(
     float* A, int64_t lda,
     float* tau )
 {
+    internal::StatsScope stats_scope( "sgeql2" );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -49,6 +50,7 @@ int64_t geql2(
     double* A, int64_t lda,
     double* tau )
 {
+    internal::StatsScope stats_scope( "dgeql2" );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -75,6 +77,7 @@ int64_t geql2(
     std::complex<float>* A, int64_t lda,
     std::complex<float>* tau )
 {
+    internal::StatsScope stats_scope( "cgeql2" );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -155,6 +158,7 @@ int64_t geql2(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* tau )
 {
+    internal::StatsScope stats_scope( "zgeql2" );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack_internal.hh"
 #include "lapack/fortran.h"
+#include "work_size_cache.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -17,47 +18,69 @@ using blas::min;
 using blas::real;
 
 // -----------------------------------------------------------------------------
-int64_t geqp3(
+void geqp3_work_size(
     int64_t m, int64_t n,
     float* A, int64_t lda,
     int64_t* jpvt,
-    float* tau )
+    float* tau,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "sgeqp3" );
+    internal::WorkSizeKey key( "sgeqp3", { m, n, lda } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        std::vector< lapack_int > jpvt_( &jpvt[0], &jpvt[(n)] );
-        lapack_int* jpvt_ptr = &jpvt_[0];
-    #else
-        lapack_int* jpvt_ptr = jpvt;
-    #endif
     lapack_int info_ = 0;
 
     // query for workspace size
+    lapack_int qry_jpvt[1];
     float qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_sgeqp3(
         &m_, &n_,
         A, &lda_,
-        jpvt_ptr,
+        qry_jpvt,
         tau,
         qry_work, &ineg_one, &info_ );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+// -----------------------------------------------------------------------------
+int64_t geqp3(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    int64_t* jpvt,
+    float* tau,
+    float* work, int64_t lwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack::vector< lapack_int > jpvt_( &jpvt[0], &jpvt[(n)] );
+        lapack_int* jpvt_ptr = &jpvt_[0];
+    #else
+        lapack_int* jpvt_ptr = jpvt;
+    #endif
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_sgeqp3(
         &m_, &n_,
         A, &lda_,
         jpvt_ptr,
         tau,
-        &work[0], &lwork_, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -69,46 +92,89 @@ int64_t geqp3(
 
 // -----------------------------------------------------------------------------
 int64_t geqp3(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    int64_t* jpvt,
+    float* tau )
+{
+    internal::StatsScope stats_scope( "sgeqp3" );
+    int64_t lwork;
+    geqp3_work_size(
+        m, n, A, lda, jpvt, tau,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return geqp3(
+        m, n, A, lda, jpvt, tau,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+void geqp3_work_size(
     int64_t m, int64_t n,
     double* A, int64_t lda,
     int64_t* jpvt,
-    double* tau )
+    double* tau,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "dgeqp3" );
+    internal::WorkSizeKey key( "dgeqp3", { m, n, lda } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        std::vector< lapack_int > jpvt_( &jpvt[0], &jpvt[(n)] );
-        lapack_int* jpvt_ptr = &jpvt_[0];
-    #else
-        lapack_int* jpvt_ptr = jpvt;
-    #endif
     lapack_int info_ = 0;
 
     // query for workspace size
+    lapack_int qry_jpvt[1];
     double qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_dgeqp3(
         &m_, &n_,
         A, &lda_,
-        jpvt_ptr,
+        qry_jpvt,
         tau,
         qry_work, &ineg_one, &info_ );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+// -----------------------------------------------------------------------------
+int64_t geqp3(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    int64_t* jpvt,
+    double* tau,
+    double* work, int64_t lwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack::vector< lapack_int > jpvt_( &jpvt[0], &jpvt[(n)] );
+        lapack_int* jpvt_ptr = &jpvt_[0];
+    #else
+        lapack_int* jpvt_ptr = jpvt;
+    #endif
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_dgeqp3(
         &m_, &n_,
         A, &lda_,
         jpvt_ptr,
         tau,
-        &work[0], &lwork_, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -120,50 +186,96 @@ int64_t geqp3(
 
 // -----------------------------------------------------------------------------
 int64_t geqp3(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    int64_t* jpvt,
+    double* tau )
+{
+    internal::StatsScope stats_scope( "dgeqp3" );
+    int64_t lwork;
+    geqp3_work_size(
+        m, n, A, lda, jpvt, tau,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return geqp3(
+        m, n, A, lda, jpvt, tau,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+void geqp3_work_size(
     int64_t m, int64_t n,
     std::complex<float>* A, int64_t lda,
     int64_t* jpvt,
-    std::complex<float>* tau )
+    std::complex<float>* tau,
+    int64_t* lwork,
+    int64_t* lrwork )
 {
+    internal::StatsScope stats_scope( "cgeqp3" );
+    internal::WorkSizeKey key( "cgeqp3", { m, n, lda } );
+    if (internal::work_size_cache_find( key, lwork, lrwork ))
+        return;
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        std::vector< lapack_int > jpvt_( &jpvt[0], &jpvt[(n)] );
-        lapack_int* jpvt_ptr = &jpvt_[0];
-    #else
-        lapack_int* jpvt_ptr = jpvt;
-    #endif
     lapack_int info_ = 0;
 
     // query for workspace size
+    lapack_int qry_jpvt[1];
     std::complex<float> qry_work[1];
     float qry_rwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_cgeqp3(
         &m_, &n_,
         (lapack_complex_float*) A, &lda_,
-        jpvt_ptr,
+        qry_jpvt,
         (lapack_complex_float*) tau,
         (lapack_complex_float*) qry_work, &ineg_one,
         qry_rwork, &info_ );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    *lrwork = 2*n;
+    internal::work_size_cache_insert( key, *lwork, *lrwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (2*n) );
+// -----------------------------------------------------------------------------
+int64_t geqp3(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* jpvt,
+    std::complex<float>* tau,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack::vector< lapack_int > jpvt_( &jpvt[0], &jpvt[(n)] );
+        lapack_int* jpvt_ptr = &jpvt_[0];
+    #else
+        lapack_int* jpvt_ptr = jpvt;
+    #endif
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( lrwork < 2*n );
+    lapack_int info_ = 0;
 
     LAPACK_cgeqp3(
         &m_, &n_,
         (lapack_complex_float*) A, &lda_,
         jpvt_ptr,
         (lapack_complex_float*) tau,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0], &info_ );
+        (lapack_complex_float*) work, &lwork_,
+        rwork, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -175,50 +287,123 @@ int64_t geqp3(
 
 // -----------------------------------------------------------------------------
 int64_t geqp3(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* jpvt,
+    std::complex<float>* tau )
+{
+    internal::StatsScope stats_scope( "cgeqp3" );
+    int64_t lwork, lrwork;
+    geqp3_work_size(
+        m, n, A, lda, jpvt, tau,
+        &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+
+    return geqp3(
+        m, n, A, lda, jpvt, tau,
+        &work[0], lwork, &rwork[0], lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::geqp3 with caller-supplied workspace.
+/// Arguments are the same as for lapack::geqp3; the matrices are not
+/// modified. The sizes can be reused for any call of the same shape.
+///
+/// @param[out] lwork
+///     Required length of the work array.
+///
+/// @param[out] lrwork
+///     Required length of the rwork array.
+///
+void geqp3_work_size(
     int64_t m, int64_t n,
     std::complex<double>* A, int64_t lda,
     int64_t* jpvt,
-    std::complex<double>* tau )
+    std::complex<double>* tau,
+    int64_t* lwork,
+    int64_t* lrwork )
 {
+    internal::StatsScope stats_scope( "zgeqp3" );
+    internal::WorkSizeKey key( "zgeqp3", { m, n, lda } );
+    if (internal::work_size_cache_find( key, lwork, lrwork ))
+        return;
+
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        std::vector< lapack_int > jpvt_( &jpvt[0], &jpvt[(n)] );
-        lapack_int* jpvt_ptr = &jpvt_[0];
-    #else
-        lapack_int* jpvt_ptr = jpvt;
-    #endif
     lapack_int info_ = 0;
 
     // query for workspace size
+    lapack_int qry_jpvt[1];
     std::complex<double> qry_work[1];
     double qry_rwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_zgeqp3(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
-        jpvt_ptr,
+        qry_jpvt,
         (lapack_complex_double*) tau,
         (lapack_complex_double*) qry_work, &ineg_one,
         qry_rwork, &info_ );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    *lrwork = 2*n;
+    internal::work_size_cache_insert( key, *lwork, *lrwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (2*n) );
+// -----------------------------------------------------------------------------
+/// Variant of lapack::geqp3 with caller-supplied workspace, which
+/// skips the internal workspace query and allocation. Other arguments
+/// are the same as for lapack::geqp3.
+///
+/// @param[out] work
+///     Workspace of length lwork.
+///
+/// @param[in] lwork
+///     Length of work, at least as returned by lapack::geqp3_work_size.
+///
+/// @param[out] rwork
+///     Workspace of length lrwork.
+///
+/// @param[in] lrwork
+///     Length of rwork, at least as returned by lapack::geqp3_work_size.
+///
+int64_t geqp3(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* jpvt,
+    std::complex<double>* tau,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack::vector< lapack_int > jpvt_( &jpvt[0], &jpvt[(n)] );
+        lapack_int* jpvt_ptr = &jpvt_[0];
+    #else
+        lapack_int* jpvt_ptr = jpvt;
+    #endif
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( lrwork < 2*n );
+    lapack_int info_ = 0;
 
     LAPACK_zgeqp3(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
         jpvt_ptr,
         (lapack_complex_double*) tau,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0], &info_ );
+        (lapack_complex_double*) work, &lwork_,
+        rwork, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -228,4 +413,26 @@ int64_t geqp3(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+int64_t geqp3(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* jpvt,
+    std::complex<double>* tau )
+{
+    internal::StatsScope stats_scope( "zgeqp3" );
+    int64_t lwork, lrwork;
+    geqp3_work_size(
+        m, n, A, lda, jpvt, tau,
+        &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+
+    return geqp3(
+        m, n, A, lda, jpvt, tau,
+        &work[0], lwork, &rwork[0], lrwork );
+}
+
 }  // namespace lapack
@@ -23,6 +23,7 @@ int64_t geqr2(
     float* A, int64_t lda,
     float* tau )
 {
+    internal::StatsScope stats_scope( "sgeqr2" );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -49,6 +50,7 @@ int64_t geqr2(
     double* A, int64_t lda,
     double* tau )
 {
+    internal::StatsScope stats_scope( "dgeqr2" );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -75,6 +77,7 @@ int64_t geqr2(
     std::complex<float>* A, int64_t lda,
     std::complex<float>* tau )
 {
+    internal::StatsScope stats_scope( "cgeqr2" );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -153,6 +156,7 @@ int64_t geqr2(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* tau )
 {
+    internal::StatsScope stats_scope( "zgeqr2" );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
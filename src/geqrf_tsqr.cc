@@ -0,0 +1,412 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "thread_pool.hh"
+
+#if LAPACK_VERSION >= 30400  // >= 3.4.0
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+using blas::real;
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Layout of the TSQR reduction tree and its T factors, shared by
+/// geqrf_tsqr and gemqr_tsqr.
+///
+/// The mq rows of A are split into p row blocks of mb rows; the last
+/// block also takes the remaining mq - p*mb rows. T holds, after a
+/// 3-entry header (tsize, mb, nb), the nb-by-k T factor of each block's
+/// geqrt, then of each tpqrt in the tree. The tree node that eliminates
+/// block j >= 1 stores its T at node( j ) and its V over the top of
+/// block j's R.
+struct TsqrTree
+{
+    int64_t mq, k, mb, nb, p;
+
+    TsqrTree( int64_t mq_, int64_t k_, int64_t mb_, int64_t nb_ ):
+        mq( mq_ ), k( k_ ), mb( mb_ ), nb( nb_ ),
+        p( max( 1, mq_ / mb_ ) )
+    {}
+
+    /// First row of block b.
+    int64_t row( int64_t b ) const { return b*mb; }
+
+    /// Number of rows in block b.
+    int64_t rows( int64_t b ) const { return (b < p-1 ? mb : mq - b*mb); }
+
+    /// Offset in T of block b's leaf factor.
+    int64_t leaf( int64_t b ) const { return 3 + b*nb*k; }
+
+    /// Offset in T of the factor of the tree node eliminating block b >= 1.
+    int64_t node( int64_t b ) const { return 3 + (p + b - 1)*nb*k; }
+
+    /// Required length of T.
+    int64_t tsize() const { return 3 + (2*p - 1)*nb*k; }
+};
+
+}  // namespace internal
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper.
+/// @ingroup geqrf
+///
+template <typename scalar_t>
+int64_t geqrf_tsqr(
+    int64_t m, int64_t n,
+    scalar_t* A, int64_t lda,
+    scalar_t* T, int64_t tsize )
+{
+    lapack_error_if( n < 0 );
+    lapack_error_if( m < n );
+    lapack_error_if( lda < max( 1, m ) );
+
+    // Row blocks big enough for efficient geqrt, with at least 2n rows
+    // so the tree's extra flops stay small.
+    int64_t mb = max( 4096, 2*n );
+    int64_t nb = max( 1, min( 32, n ) );
+    internal::TsqrTree tree( m, n, mb, nb );
+
+    if (tsize == -1) {
+        T[ 0 ] = scalar_t( tree.tsize() );
+        return 0;
+    }
+    lapack_error_if( tsize < tree.tsize() );
+    T[ 0 ] = scalar_t( tree.tsize() );
+    T[ 1 ] = scalar_t( mb );
+    T[ 2 ] = scalar_t( nb );
+    if (n == 0)
+        return 0;
+
+    // Leaves: independent QR of each row block.
+    internal::parallel_for( tree.p, 1, [&]( int64_t begin, int64_t end ) {
+        for (int64_t b = begin; b < end; ++b) {
+            lapack::geqrt( tree.rows( b ), n, nb,
+                           &A[ tree.row( b ) ], lda,
+                           &T[ tree.leaf( b ) ], nb );
+        }
+    });
+
+    // Binary tree: at stride s, block i absorbs block i + s's R, with
+    // tpqrt on the two stacked n-by-n triangles.
+    for (int64_t s = 1; s < tree.p; s *= 2) {
+        int64_t npairs = (tree.p - s + 2*s - 1) / (2*s);
+        internal::parallel_for( npairs, 1, [&]( int64_t begin, int64_t end ) {
+            for (int64_t q = begin; q < end; ++q) {
+                int64_t i = 2*s*q;
+                int64_t j = i + s;
+                lapack::tpqrt( n, n, n, nb,
+                               &A[ tree.row( i ) ], lda,
+                               &A[ tree.row( j ) ], lda,
+                               &T[ tree.node( j ) ], nb );
+            }
+        });
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper.
+/// @ingroup geqrf
+///
+template <typename scalar_t>
+int64_t gemqr_tsqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    scalar_t const* A, int64_t lda,
+    scalar_t const* T, int64_t tsize,
+    scalar_t* C, int64_t ldc )
+{
+    bool left = (side == Side::Left);
+    int64_t mq = (left ? m : n);
+
+    lapack_error_if( side != Side::Left && side != Side::Right );
+    lapack_error_if( trans != Op::NoTrans && trans != Op::ConjTrans
+                     && (trans != Op::Trans || blas::is_complex< scalar_t >::value) );
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( k < 0 || k > mq );
+    lapack_error_if( lda < max( 1, mq ) );
+    lapack_error_if( tsize < 3 );
+    lapack_error_if( ldc < max( 1, m ) );
+
+    if (m == 0 || n == 0 || k == 0)
+        return 0;
+
+    int64_t mb = int64_t( real( T[ 1 ] ) );
+    int64_t nb = int64_t( real( T[ 2 ] ) );
+    internal::TsqrTree tree( mq, k, mb, nb );
+    lapack_error_if( tsize < tree.tsize() );
+
+    // Rows (if left) or columns (if right) of C matching row r of A.
+    auto Cblock = [&]( int64_t r ) {
+        return (left ? &C[ r ] : &C[ r*ldc ]);
+    };
+
+    auto apply_leaves = [&] {
+        internal::parallel_for( tree.p, 1, [&]( int64_t begin, int64_t end ) {
+            for (int64_t b = begin; b < end; ++b) {
+                int64_t mb_b = tree.rows( b );
+                lapack::gemqrt( side, trans,
+                                (left ? mb_b : m), (left ? n : mb_b), k, nb,
+                                &A[ tree.row( b ) ], lda,
+                                &T[ tree.leaf( b ) ], nb,
+                                Cblock( tree.row( b ) ), ldc );
+            }
+        });
+    };
+    auto apply_level = [&]( int64_t s ) {
+        int64_t npairs = (tree.p - s + 2*s - 1) / (2*s);
+        internal::parallel_for( npairs, 1, [&]( int64_t begin, int64_t end ) {
+            for (int64_t q = begin; q < end; ++q) {
+                int64_t i = 2*s*q;
+                int64_t j = i + s;
+                lapack::tpmqrt( side, trans,
+                                (left ? k : m), (left ? n : k), k, k, nb,
+                                &A[ tree.row( j ) ], lda,
+                                &T[ tree.node( j ) ], nb,
+                                Cblock( tree.row( i ) ), ldc,
+                                Cblock( tree.row( j ) ), ldc );
+            }
+        });
+    };
+
+    int64_t smax = 1;
+    while (2*smax < tree.p)
+        smax *= 2;
+
+    // Q = Q_leaves Q_tree, where Q_tree's levels apply bottom-up.
+    // Q^H C and C Q start with the leaves; Q C and C Q^H with the root.
+    if (left == (trans != Op::NoTrans)) {
+        apply_leaves();
+        for (int64_t s = 1; s < tree.p; s *= 2)
+            apply_level( s );
+    }
+    else {
+        for (int64_t s = smax; s >= 1 && s < tree.p; s /= 2)
+            apply_level( s );
+        apply_leaves();
+    }
+    return 0;
+}
+
+}  // namespace impl
+
+//------------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t geqrf_tsqr(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* T, int64_t tsize )
+{
+    return impl::geqrf_tsqr( m, n, A, lda, T, tsize );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t geqrf_tsqr(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* T, int64_t tsize )
+{
+    return impl::geqrf_tsqr( m, n, A, lda, T, tsize );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t geqrf_tsqr(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* T, int64_t tsize )
+{
+    return impl::geqrf_tsqr( m, n, A, lda, T, tsize );
+}
+
+//------------------------------------------------------------------------------
+/// Computes a QR factorization of a tall-skinny m-by-n matrix A, m >= n,
+/// by TSQR, in parallel on the LAPACK++ thread pool
+/// (see lapack::set_num_threads):
+/// \[
+///     A = Q \begin{bmatrix} R
+///           \\              0
+///           \end{bmatrix}.
+/// \]
+///
+/// A is split into row blocks of mb = max( 4096, 2n ) rows, which are
+/// factored independently by geqrt. Their n-by-n R factors are then
+/// combined pairwise up a binary tree by tpqrt, each level in parallel.
+/// This reads A once, in cache-sized blocks, and parallelizes across
+/// blocks, unlike geqrf, whose panels sweep all m rows for each column
+/// block. Q is kept implicitly, as the Householder vectors of the leaves
+/// and tree nodes; apply it with lapack::gemqr_tsqr. To form the first n
+/// columns of Q explicitly, apply Q to the first n columns of the
+/// identity. The blocking does not depend on the number of threads, so
+/// the result is the same for any number of threads.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @since LAPACK 3.4.0
+///
+/// @param[in] m
+///     The number of rows of the matrix A. m >= n.
+///
+/// @param[in] n
+///     The number of columns of the matrix A. n >= 0.
+///
+/// @param[in,out] A
+///     The m-by-n matrix A, stored in an lda-by-n array.
+///     On entry, the m-by-n matrix A.
+///     On exit, the elements on and above the diagonal of the first
+///     n rows contain the n-by-n upper triangular matrix R;
+///     the remaining elements hold the Householder vectors representing
+///     Q, in the format used by gemqr_tsqr.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,m).
+///
+/// @param[out] T
+///     The vector T of length max(1,tsize).
+///     On exit, T[0] returns the required tsize.
+///     If tsize >= required size, the remaining T contains the block sizes
+///     and T factors that, with A, represent Q.
+///
+/// @param[in] tsize
+///     The length of T.
+///     If tsize = -1, a workspace query is assumed; the routine only
+///     computes the required size of T, returns it in T[0], and does
+///     not reference A.
+///
+/// @return = 0: successful exit
+///
+/// @ingroup geqrf
+int64_t geqrf_tsqr(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* T, int64_t tsize )
+{
+    return impl::geqrf_tsqr( m, n, A, lda, T, tsize );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t gemqr_tsqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* T, int64_t tsize,
+    float* C, int64_t ldc )
+{
+    return impl::gemqr_tsqr( side, trans, m, n, k, A, lda, T, tsize, C, ldc );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t gemqr_tsqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* T, int64_t tsize,
+    double* C, int64_t ldc )
+{
+    return impl::gemqr_tsqr( side, trans, m, n, k, A, lda, T, tsize, C, ldc );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t gemqr_tsqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* T, int64_t tsize,
+    std::complex<float>* C, int64_t ldc )
+{
+    return impl::gemqr_tsqr( side, trans, m, n, k, A, lda, T, tsize, C, ldc );
+}
+
+//------------------------------------------------------------------------------
+/// Overwrites the general m-by-n matrix C with
+///
+/// - side = Left,  trans = NoTrans:   $Q C$
+/// - side = Right, trans = NoTrans:   $C Q$
+/// - side = Left,  trans = ConjTrans: $Q^H C$
+/// - side = Right, trans = ConjTrans: $C Q^H$
+///
+/// where Q is the orthogonal (unitary) matrix from lapack::geqrf_tsqr.
+/// Q is of order m if side = Left and of order n if side = Right.
+/// Like the factorization, each leaf block and each level of the tree is
+/// applied in parallel on the LAPACK++ thread pool.
+///
+/// For instance, the least squares solution of min || A x - b ||
+/// is $x = R^{-1} (Q^H b)(1:n),$ using gemqr_tsqr and then trsm with R.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @since LAPACK 3.4.0
+///
+/// @param[in] side
+///     - lapack::Side::Left:  apply Q or Q^H from the Left;
+///     - lapack::Side::Right: apply Q or Q^H from the Right.
+///
+/// @param[in] trans
+///     - lapack::Op::NoTrans:   No transpose, apply Q;
+///     - lapack::Op::ConjTrans: Conjugate transpose, apply Q^H.
+///     - lapack::Op::Trans:     Transpose, apply Q^T (real only).
+///
+/// @param[in] m
+///     The number of rows of the matrix C. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of the matrix C. n >= 0.
+///
+/// @param[in] k
+///     The number of columns of the factored matrix A,
+///     the n passed to geqrf_tsqr.
+///     - If side = Left,  m >= k >= 0;
+///     - if side = Right, n >= k >= 0.
+///
+/// @param[in] A
+///     The factored matrix from geqrf_tsqr, stored in an lda-by-k array.
+///     It has m rows if side = Left, n rows if side = Right.
+///
+/// @param[in] lda
+///     The leading dimension of the array A.
+///     - If side = Left,  lda >= max(1,m);
+///     - if side = Right, lda >= max(1,n).
+///
+/// @param[in] T
+///     The vector T of length max(3,tsize), as returned by geqrf_tsqr.
+///
+/// @param[in] tsize
+///     The length of T, at least the size geqrf_tsqr required.
+///
+/// @param[in,out] C
+///     The m-by-n matrix C, stored in an ldc-by-n array.
+///     On entry, the m-by-n matrix C.
+///     On exit, C is overwritten by Q C, Q^H C, C Q^H, or C Q.
+///
+/// @param[in] ldc
+///     The leading dimension of the array C. ldc >= max(1,m).
+///
+/// @return = 0: successful exit
+///
+/// @ingroup geqrf
+int64_t gemqr_tsqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* T, int64_t tsize,
+    std::complex<double>* C, int64_t ldc )
+{
+    return impl::gemqr_tsqr( side, trans, m, n, k, A, lda, T, tsize, C, ldc );
+}
+
+}  // namespace lapack
+
+#endif  // LAPACK >= 3.4.0
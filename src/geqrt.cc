@@ -24,6 +24,7 @@ int64_t geqrt(
     float* A, int64_t lda,
     float* T, int64_t ldt )
 {
+    internal::StatsScope stats_scope( "sgeqrt" );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nb_ = to_lapack_int( nb );
@@ -51,6 +52,7 @@ int64_t geqrt(
     double* A, int64_t lda,
     double* T, int64_t ldt )
 {
+    internal::StatsScope stats_scope( "dgeqrt" );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nb_ = to_lapack_int( nb );
@@ -78,6 +80,7 @@ int64_t geqrt(
     std::complex<float>* A, int64_t lda,
     std::complex<float>* T, int64_t ldt )
 {
+    internal::StatsScope stats_scope( "cgeqrt" );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nb_ = to_lapack_int( nb );
@@ -105,6 +108,7 @@ int64_t geqrt(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* T, int64_t ldt )
 {
+    internal::StatsScope stats_scope( "zgeqrt" );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nb_ = to_lapack_int( nb );
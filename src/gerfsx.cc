@@ -35,6 +35,7 @@ int64_t gerfsx(
     float* err_bnds_comp, int64_t nparams,
     float* params )
 {
+    internal::StatsScope stats_scope( "sgerfsx" );
     char trans_ = to_char( trans );
     char equed_ = to_char( equed );
     lapack_int n_ = to_lapack_int( n );
@@ -43,7 +44,7 @@ int64_t gerfsx(
     lapack_int ldaf_ = to_lapack_int( ldaf );
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -97,6 +98,7 @@ int64_t gerfsx(
     double* err_bnds_comp, int64_t nparams,
     double* params )
 {
+    internal::StatsScope stats_scope( "dgerfsx" );
     char trans_ = to_char( trans );
     char equed_ = to_char( equed );
     lapack_int n_ = to_lapack_int( n );
@@ -105,7 +107,7 @@ int64_t gerfsx(
     lapack_int ldaf_ = to_lapack_int( ldaf );
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -159,6 +161,7 @@ int64_t gerfsx(
     float* err_bnds_comp, int64_t nparams,
     float* params )
 {
+    internal::StatsScope stats_scope( "cgerfsx" );
     char trans_ = to_char( trans );
     char equed_ = to_char( equed );
     lapack_int n_ = to_lapack_int( n );
@@ -167,7 +170,7 @@ int64_t gerfsx(
     lapack_int ldaf_ = to_lapack_int( ldaf );
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -493,6 +496,7 @@ int64_t gerfsx(
     double* err_bnds_comp, int64_t nparams,
     double* params )
 {
+    internal::StatsScope stats_scope( "zgerfsx" );
     char trans_ = to_char( trans );
     char equed_ = to_char( equed );
     lapack_int n_ = to_lapack_int( n );
@@ -501,7 +505,7 @@ int64_t gerfsx(
     lapack_int ldaf_ = to_lapack_int( ldaf );
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -538,6 +542,244 @@ int64_t gerfsx(
     return info_;
 }
 
+#ifndef LAPACK_ILP64
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t gerfsx(
+    lapack::Op trans, lapack::Equed equed, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    float const* AF, int64_t ldaf,
+    lapack_int const* ipiv,
+    float const* R,
+    float const* C,
+    float const* B, int64_t ldb,
+    float* X, int64_t ldx,
+    float* rcond,
+    float* berr, int64_t n_err_bnds,
+    float* err_bnds_norm,
+    float* err_bnds_comp, int64_t nparams,
+    float* params )
+{
+    internal::StatsScope stats_scope( "sgerfsx" );
+    char trans_ = to_char( trans );
+    char equed_ = to_char( equed );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldaf_ = to_lapack_int( ldaf );
+    lapack_int const* ipiv_ptr = ipiv;
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int ldx_ = to_lapack_int( ldx );
+    lapack_int n_err_bnds_ = to_lapack_int( n_err_bnds );
+    lapack_int nparams_ = to_lapack_int( nparams );
+    lapack_int info_ = 0;
+
+    // allocate workspace
+    lapack::vector< float > work( (4*n) );
+    lapack::vector< lapack_int > iwork( (n) );
+
+    LAPACK_sgerfsx(
+        &trans_, &equed_, &n_, &nrhs_,
+        A, &lda_,
+        AF, &ldaf_,
+        ipiv_ptr,
+        R,
+        C,
+        B, &ldb_,
+        X, &ldx_, rcond,
+        berr, &n_err_bnds_,
+        err_bnds_norm,
+        err_bnds_comp, &nparams_,
+        params,
+        &work[0],
+        &iwork[0], &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t gerfsx(
+    lapack::Op trans, lapack::Equed equed, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    double const* AF, int64_t ldaf,
+    lapack_int const* ipiv,
+    double const* R,
+    double const* C,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double* rcond,
+    double* berr, int64_t n_err_bnds,
+    double* err_bnds_norm,
+    double* err_bnds_comp, int64_t nparams,
+    double* params )
+{
+    internal::StatsScope stats_scope( "dgerfsx" );
+    char trans_ = to_char( trans );
+    char equed_ = to_char( equed );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldaf_ = to_lapack_int( ldaf );
+    lapack_int const* ipiv_ptr = ipiv;
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int ldx_ = to_lapack_int( ldx );
+    lapack_int n_err_bnds_ = to_lapack_int( n_err_bnds );
+    lapack_int nparams_ = to_lapack_int( nparams );
+    lapack_int info_ = 0;
+
+    // allocate workspace
+    lapack::vector< double > work( (4*n) );
+    lapack::vector< lapack_int > iwork( (n) );
+
+    LAPACK_dgerfsx(
+        &trans_, &equed_, &n_, &nrhs_,
+        A, &lda_,
+        AF, &ldaf_,
+        ipiv_ptr,
+        R,
+        C,
+        B, &ldb_,
+        X, &ldx_, rcond,
+        berr, &n_err_bnds_,
+        err_bnds_norm,
+        err_bnds_comp, &nparams_,
+        params,
+        &work[0],
+        &iwork[0], &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t gerfsx(
+    lapack::Op trans, lapack::Equed equed, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* AF, int64_t ldaf,
+    lapack_int const* ipiv,
+    float const* R,
+    float const* C,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* X, int64_t ldx,
+    float* rcond,
+    float* berr, int64_t n_err_bnds,
+    float* err_bnds_norm,
+    float* err_bnds_comp, int64_t nparams,
+    float* params )
+{
+    internal::StatsScope stats_scope( "cgerfsx" );
+    char trans_ = to_char( trans );
+    char equed_ = to_char( equed );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldaf_ = to_lapack_int( ldaf );
+    lapack_int const* ipiv_ptr = ipiv;
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int ldx_ = to_lapack_int( ldx );
+    lapack_int n_err_bnds_ = to_lapack_int( n_err_bnds );
+    lapack_int nparams_ = to_lapack_int( nparams );
+    lapack_int info_ = 0;
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( (2*n) );
+    lapack::vector< float > rwork( (2*n) );
+
+    LAPACK_cgerfsx(
+        &trans_, &equed_, &n_, &nrhs_,
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) AF, &ldaf_,
+        ipiv_ptr,
+        R,
+        C,
+        (lapack_complex_float*) B, &ldb_,
+        (lapack_complex_float*) X, &ldx_, rcond,
+        berr, &n_err_bnds_,
+        err_bnds_norm,
+        err_bnds_comp, &nparams_,
+        params,
+        (lapack_complex_float*) &work[0],
+        &rwork[0], &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::gerfsx that takes ipiv in the native LAPACK integer
+/// type, lapack_int, instead of int64_t, which avoids allocating and
+/// copying a temporary pivot array. Available only when lapack_int is
+/// 32-bit, i.e., LAPACK_ILP64 is not defined; otherwise the int64_t
+/// version is already native.
+///
+/// @ingroup gesv_computational
+int64_t gerfsx(
+    lapack::Op trans, lapack::Equed equed, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* AF, int64_t ldaf,
+    lapack_int const* ipiv,
+    double const* R,
+    double const* C,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    double* rcond,
+    double* berr, int64_t n_err_bnds,
+    double* err_bnds_norm,
+    double* err_bnds_comp, int64_t nparams,
+    double* params )
+{
+    internal::StatsScope stats_scope( "zgerfsx" );
+    char trans_ = to_char( trans );
+    char equed_ = to_char( equed );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldaf_ = to_lapack_int( ldaf );
+    lapack_int const* ipiv_ptr = ipiv;
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int ldx_ = to_lapack_int( ldx );
+    lapack_int n_err_bnds_ = to_lapack_int( n_err_bnds );
+    lapack_int nparams_ = to_lapack_int( nparams );
+    lapack_int info_ = 0;
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( (2*n) );
+    lapack::vector< double > rwork( (2*n) );
+
+    LAPACK_zgerfsx(
+        &trans_, &equed_, &n_, &nrhs_,
+        (lapack_complex_double*) A, &lda_,
+        (lapack_complex_double*) AF, &ldaf_,
+        ipiv_ptr,
+        R,
+        C,
+        (lapack_complex_double*) B, &ldb_,
+        (lapack_complex_double*) X, &ldx_, rcond,
+        berr, &n_err_bnds_,
+        err_bnds_norm,
+        err_bnds_comp, &nparams_,
+        params,
+        (lapack_complex_double*) &work[0],
+        &rwork[0], &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+#endif  // LAPACK_ILP64
+
 }  // namespace lapack
 
 #endif  // HAVE_XBLAS
@@ -23,6 +23,7 @@ int64_t gerq2(
     float* A, int64_t lda,
     float* tau )
 {
+    internal::StatsScope stats_scope( "sgerq2" );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -49,6 +50,7 @@ int64_t gerq2(
     double* A, int64_t lda,
     double* tau )
 {
+    internal::StatsScope stats_scope( "dgerq2" );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -75,6 +77,7 @@ int64_t gerq2(
     std::complex<float>* A, int64_t lda,
     std::complex<float>* tau )
 {
+    internal::StatsScope stats_scope( "cgerq2" );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -156,6 +159,7 @@ int64_t gerq2(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* tau )
 {
+    internal::StatsScope stats_scope( "zgerq2" );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
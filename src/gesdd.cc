@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack_internal.hh"
 #include "lapack/fortran.h"
+#include "work_size_cache.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -18,13 +19,20 @@ using blas::real;
 
 // -----------------------------------------------------------------------------
 /// @ingroup gesvd
-int64_t gesdd(
+void gesdd_work_size(
     lapack::Job jobz, int64_t m, int64_t n,
     float* A, int64_t lda,
     float* S,
     float* U, int64_t ldu,
-    float* VT, int64_t ldvt )
+    float* VT, int64_t ldvt,
+    int64_t* lwork,
+    int64_t* liwork )
 {
+    internal::StatsScope stats_scope( "sgesdd" );
+    internal::WorkSizeKey key( "sgesdd", { to_char( jobz ), m, n, lda, ldu, ldvt } );
+    if (internal::work_size_cache_find( key, lwork, nullptr, liwork ))
+        return;
+
     char jobz_ = to_char( jobz );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -37,6 +45,7 @@ int64_t gesdd(
     float qry_work[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_sgesdd(
         &jobz_, &m_, &n_,
         A, &lda_,
@@ -46,14 +55,35 @@ int64_t gesdd(
         qry_work, &ineg_one,
         qry_iwork, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    *liwork = 8*min( m, n );
+    internal::work_size_cache_insert( key, *lwork, 0, *liwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (8*min(m,n)) );
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+int64_t gesdd(
+    lapack::Job jobz, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt,
+    float* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    char jobz_ = to_char( jobz );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldu_ = to_lapack_int( ldu );
+    lapack_int ldvt_ = to_lapack_int( ldvt );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( liwork < 8*min( m, n ) );
+    lapack_int info_ = 0;
 
     LAPACK_sgesdd(
         &jobz_, &m_, &n_,
@@ -61,8 +91,8 @@ int64_t gesdd(
         S,
         U, &ldu_,
         VT, &ldvt_,
-        &work[0], &lwork_,
-        &iwork[0], &info_
+        work, &lwork_,
+        iwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -73,12 +103,43 @@ int64_t gesdd(
 // -----------------------------------------------------------------------------
 /// @ingroup gesvd
 int64_t gesdd(
+    lapack::Job jobz, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt )
+{
+    internal::StatsScope stats_scope( "sgesdd" );
+    int64_t lwork, liwork;
+    gesdd_work_size(
+        jobz, m, n, A, lda, S, U, ldu, VT, ldvt,
+        &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return gesdd(
+        jobz, m, n, A, lda, S, U, ldu, VT, ldvt,
+        &work[0], lwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+void gesdd_work_size(
     lapack::Job jobz, int64_t m, int64_t n,
     double* A, int64_t lda,
     double* S,
     double* U, int64_t ldu,
-    double* VT, int64_t ldvt )
+    double* VT, int64_t ldvt,
+    int64_t* lwork,
+    int64_t* liwork )
 {
+    internal::StatsScope stats_scope( "dgesdd" );
+    internal::WorkSizeKey key( "dgesdd", { to_char( jobz ), m, n, lda, ldu, ldvt } );
+    if (internal::work_size_cache_find( key, lwork, nullptr, liwork ))
+        return;
+
     char jobz_ = to_char( jobz );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -91,6 +152,7 @@ int64_t gesdd(
     double qry_work[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_dgesdd(
         &jobz_, &m_, &n_,
         A, &lda_,
@@ -100,14 +162,35 @@ int64_t gesdd(
         qry_work, &ineg_one,
         qry_iwork, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    *liwork = 8*min( m, n );
+    internal::work_size_cache_insert( key, *lwork, 0, *liwork );
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (8*min(m,n)) );
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+int64_t gesdd(
+    lapack::Job jobz, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt,
+    double* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    char jobz_ = to_char( jobz );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldu_ = to_lapack_int( ldu );
+    lapack_int ldvt_ = to_lapack_int( ldvt );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( liwork < 8*min( m, n ) );
+    lapack_int info_ = 0;
 
     LAPACK_dgesdd(
         &jobz_, &m_, &n_,
@@ -115,8 +198,8 @@ int64_t gesdd(
         S,
         U, &ldu_,
         VT, &ldvt_,
-        &work[0], &lwork_,
-        &iwork[0], &info_
+        work, &lwork_,
+        iwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -127,12 +210,44 @@ int64_t gesdd(
 // -----------------------------------------------------------------------------
 /// @ingroup gesvd
 int64_t gesdd(
+    lapack::Job jobz, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt )
+{
+    internal::StatsScope stats_scope( "dgesdd" );
+    int64_t lwork, liwork;
+    gesdd_work_size(
+        jobz, m, n, A, lda, S, U, ldu, VT, ldvt,
+        &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return gesdd(
+        jobz, m, n, A, lda, S, U, ldu, VT, ldvt,
+        &work[0], lwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+void gesdd_work_size(
     lapack::Job jobz, int64_t m, int64_t n,
     std::complex<float>* A, int64_t lda,
     float* S,
     std::complex<float>* U, int64_t ldu,
-    std::complex<float>* VT, int64_t ldvt )
+    std::complex<float>* VT, int64_t ldvt,
+    int64_t* lwork,
+    int64_t* lrwork,
+    int64_t* liwork )
 {
+    internal::StatsScope stats_scope( "cgesdd" );
+    internal::WorkSizeKey key( "cgesdd", { to_char( jobz ), m, n, lda, ldu, ldvt } );
+    if (internal::work_size_cache_find( key, lwork, lrwork, liwork ))
+        return;
+
     char jobz_ = to_char( jobz );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -146,6 +261,7 @@ int64_t gesdd(
     float qry_rwork[1] = { 0 };
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_cgesdd(
         &jobz_, &m_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -156,10 +272,11 @@ int64_t gesdd(
         qry_rwork,
         qry_iwork, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
     lapack_int lrwork_ = qry_rwork[0];
     if (lrwork_ == 0) {
         // if query doesn't work, this is from documentation
@@ -173,11 +290,32 @@ int64_t gesdd(
         }
         lrwork_ = max( 1, lrwork_ );
     }
+    *lrwork = lrwork_;
+    *liwork = 8*min( m, n );
+    internal::work_size_cache_insert( key, *lwork, *lrwork, *liwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( (8*min(m,n)) );
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+int64_t gesdd(
+    lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    char jobz_ = to_char( jobz );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldu_ = to_lapack_int( ldu );
+    lapack_int ldvt_ = to_lapack_int( ldvt );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( liwork < 8*min( m, n ) );
+    lapack_int info_ = 0;
 
     LAPACK_cgesdd(
         &jobz_, &m_, &n_,
@@ -185,9 +323,171 @@ int64_t gesdd(
         S,
         (lapack_complex_float*) U, &ldu_,
         (lapack_complex_float*) VT, &ldvt_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0],
-        &iwork[0], &info_
+        (lapack_complex_float*) work, &lwork_,
+        rwork,
+        iwork, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+int64_t gesdd(
+    lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt )
+{
+    internal::StatsScope stats_scope( "cgesdd" );
+    int64_t lwork, lrwork, liwork;
+    gesdd_work_size(
+        jobz, m, n, A, lda, S, U, ldu, VT, ldvt,
+        &lwork, &lrwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return gesdd(
+        jobz, m, n, A, lda, S, U, ldu, VT, ldvt,
+        &work[0], lwork, &rwork[0], lrwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::gesdd with caller-supplied workspace.
+/// Arguments are the same as for lapack::gesdd; the matrices are not
+/// modified. The sizes can be reused for any call of the same shape.
+///
+/// @param[out] lwork
+///     Required length of the work array.
+///
+/// @param[out] lrwork
+///     Required length of the rwork array.
+///
+/// @param[out] liwork
+///     Required length of the iwork array.
+///
+/// @ingroup gesvd
+void gesdd_work_size(
+    lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt,
+    int64_t* lwork,
+    int64_t* lrwork,
+    int64_t* liwork )
+{
+    internal::StatsScope stats_scope( "zgesdd" );
+    internal::WorkSizeKey key( "zgesdd", { to_char( jobz ), m, n, lda, ldu, ldvt } );
+    if (internal::work_size_cache_find( key, lwork, lrwork, liwork ))
+        return;
+
+    char jobz_ = to_char( jobz );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldu_ = to_lapack_int( ldu );
+    lapack_int ldvt_ = to_lapack_int( ldvt );
+    lapack_int info_ = 0;
+
+    // query for workspace size
+    std::complex<double> qry_work[1];
+    double qry_rwork[1] = { 0 };
+    lapack_int qry_iwork[1];
+    lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
+    LAPACK_zgesdd(
+        &jobz_, &m_, &n_,
+        (lapack_complex_double*) A, &lda_,
+        S,
+        (lapack_complex_double*) U, &ldu_,
+        (lapack_complex_double*) VT, &ldvt_,
+        (lapack_complex_double*) qry_work, &ineg_one,
+        qry_rwork,
+        qry_iwork, &info_
+    );
+    query_timer.stop();
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    lapack_int lrwork_ = qry_rwork[0];
+    if (lrwork_ == 0) {
+        // if query doesn't work, this is from documentation
+        lapack_int mx = max( m, n );
+        lapack_int mn = min( m, n );
+        if (jobz == lapack::Job::NoVec) {
+            lrwork_ = 7*mn;  // LAPACK > 3.6 needs only 5*mn
+        }
+        else {
+            lrwork_ = max( 5*mn*mn + 5*mn, 2*mx*mn + 2*mn*mn + mn );
+        }
+        lrwork_ = max( 1, lrwork_ );
+    }
+    *lrwork = lrwork_;
+    *liwork = 8*min( m, n );
+    internal::work_size_cache_insert( key, *lwork, *lrwork, *liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::gesdd with caller-supplied workspace, which
+/// skips the internal workspace query and allocation. Other arguments
+/// are the same as for lapack::gesdd.
+///
+/// @param[out] work
+///     Workspace of length lwork.
+///
+/// @param[in] lwork
+///     Length of work, at least as returned by lapack::gesdd_work_size.
+///
+/// @param[out] rwork
+///     Workspace of length lrwork.
+///
+/// @param[in] lrwork
+///     Length of rwork, at least as returned by lapack::gesdd_work_size.
+///
+/// @param[out] iwork
+///     Workspace of length liwork, of the native LAPACK integer type.
+///
+/// @param[in] liwork
+///     Length of iwork, at least as returned by lapack::gesdd_work_size.
+///
+/// @ingroup gesvd
+int64_t gesdd(
+    lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    char jobz_ = to_char( jobz );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldu_ = to_lapack_int( ldu );
+    lapack_int ldvt_ = to_lapack_int( ldvt );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( liwork < 8*min( m, n ) );
+    lapack_int info_ = 0;
+
+    LAPACK_zgesdd(
+        &jobz_, &m_, &n_,
+        (lapack_complex_double*) A, &lda_,
+        S,
+        (lapack_complex_double*) U, &ldu_,
+        (lapack_complex_double*) VT, &ldvt_,
+        (lapack_complex_double*) work, &lwork_,
+        rwork,
+        iwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -310,66 +610,20 @@ int64_t gesdd(
     std::complex<double>* U, int64_t ldu,
     std::complex<double>* VT, int64_t ldvt )
 {
-    char jobz_ = to_char( jobz );
-    lapack_int m_ = to_lapack_int( m );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int ldu_ = to_lapack_int( ldu );
-    lapack_int ldvt_ = to_lapack_int( ldvt );
-    lapack_int info_ = 0;
-
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    double qry_rwork[1] = { 0 };
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgesdd(
-        &jobz_, &m_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        S,
-        (lapack_complex_double*) U, &ldu_,
-        (lapack_complex_double*) VT, &ldvt_,
-        (lapack_complex_double*) qry_work, &ineg_one,
-        qry_rwork,
-        qry_iwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int lrwork_ = qry_rwork[0];
-    if (lrwork_ == 0) {
-        // if query doesn't work, this is from documentation
-        lapack_int mx = max( m, n );
-        lapack_int mn = min( m, n );
-        if (jobz == lapack::Job::NoVec) {
-            lrwork_ = 7*mn;  // LAPACK > 3.6 needs only 5*mn
-        }
-        else {
-            lrwork_ = max( 5*mn*mn + 5*mn, 2*mx*mn + 2*mn*mn + mn );
-        }
-        lrwork_ = max( 1, lrwork_ );
-    }
+    internal::StatsScope stats_scope( "zgesdd" );
+    int64_t lwork, lrwork, liwork;
+    gesdd_work_size(
+        jobz, m, n, A, lda, S, U, ldu, VT, ldvt,
+        &lwork, &lrwork, &liwork );
 
     // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( (8*min(m,n)) );
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+    lapack::vector< lapack_int > iwork( liwork );
 
-    LAPACK_zgesdd(
-        &jobz_, &m_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        S,
-        (lapack_complex_double*) U, &ldu_,
-        (lapack_complex_double*) VT, &ldvt_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0],
-        &iwork[0], &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return gesdd(
+        jobz, m, n, A, lda, S, U, ldu, VT, ldvt,
+        &work[0], lwork, &rwork[0], lrwork, &iwork[0], liwork );
 }
 
 }  // namespace lapack
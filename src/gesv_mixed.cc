@@ -0,0 +1,219 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "mixed_internal.hh"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper.
+/// @ingroup gesv
+///
+template <typename scalar_t>
+int64_t gesv_mixed(
+    int64_t n, int64_t nrhs,
+    scalar_t* A, int64_t lda,
+    int64_t* ipiv,
+    scalar_t const* B, int64_t ldb,
+    scalar_t* X, int64_t ldx,
+    int64_t* iter )
+{
+    using low_t = internal::lower_precision_t< scalar_t >;
+    using real_t = blas::real_type< scalar_t >;
+
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( ldb < max( 1, n ) );
+    lapack_error_if( ldx < max( 1, n ) );
+
+    *iter = 0;
+    if (n == 0 || nrhs == 0)
+        return 0;
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t anorm = lapack::lange( Norm::Inf, n, n, A, lda );
+    real_t cte = anorm * eps * std::sqrt( real_t( n ) );
+
+    std::vector< low_t > SA( n*n );
+    std::vector< low_t > SX( n*nrhs );
+    std::vector< scalar_t > R( n*nrhs );
+
+    // Factor and solve in lower precision, unless A or B overflows there.
+    if (internal::lag2lower( n, n, A, lda, SA.data(), n ) != 0
+        || internal::lag2lower( n, nrhs, B, ldb, SX.data(), n ) != 0) {
+        *iter = -2;
+    }
+    else if (lapack::getrf( n, n, SA.data(), n, ipiv ) != 0) {
+        *iter = -3;
+    }
+    else {
+        lapack::getrs( Op::NoTrans, n, nrhs, SA.data(), n, ipiv,
+                       SX.data(), n );
+        internal::lag2higher( n, nrhs, SX.data(), n, X, ldx );
+
+        // Refine, while the residual keeps decreasing. Unlike dsgesv,
+        // which always runs itermax iterations before giving up, a
+        // residual that stalls or grows means refinement cannot
+        // converge, so fall back at once.
+        real_t rnorm_prev = std::numeric_limits< real_t >::infinity();
+        for (int64_t it = 0; ; ++it) {
+            // R = B - A X, in higher precision.
+            lapack::lacpy( MatrixType::General, n, nrhs, B, ldb, R.data(), n );
+            blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                        n, nrhs, n,
+                        -1.0, A, lda,
+                              X, ldx,
+                         1.0, R.data(), n );
+
+            real_t rnorm;
+            if (internal::mixed_converged( n, nrhs, X, ldx, R.data(), n,
+                                           cte, &rnorm )) {
+                *iter = it;
+                return 0;
+            }
+            if (it == internal::mixed_itermax || ! (rnorm < rnorm_prev)) {
+                *iter = -(internal::mixed_itermax + 1);
+                break;
+            }
+            if (internal::lag2lower( n, nrhs, R.data(), n,
+                                     SX.data(), n ) != 0) {
+                *iter = -2;
+                break;
+            }
+            rnorm_prev = rnorm;
+
+            // X += A^{-1} R, with the correction solved in lower precision.
+            lapack::getrs( Op::NoTrans, n, nrhs, SA.data(), n, ipiv,
+                           SX.data(), n );
+            internal::lag2higher( n, nrhs, SX.data(), n, R.data(), n );
+            for (int64_t j = 0; j < nrhs; ++j)
+                blas::axpy( n, 1.0, &R[ j*n ], 1, &X[ j*ldx ], 1 );
+        }
+    }
+
+    // Fall back to factoring and solving in higher precision.
+    lapack::lacpy( MatrixType::General, n, nrhs, B, ldb, X, ldx );
+    return lapack::gesv( n, nrhs, A, lda, ipiv, X, ldx );
+}
+
+}  // namespace impl
+
+//------------------------------------------------------------------------------
+/// @ingroup gesv
+int64_t gesv_mixed(
+    int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    int64_t* iter )
+{
+    return impl::gesv_mixed( n, nrhs, A, lda, ipiv, B, ldb, X, ldx, iter );
+}
+
+//------------------------------------------------------------------------------
+/// Computes the solution to a system of linear equations
+///     $A X = B$,
+/// where A is an n-by-n matrix and X and B are n-by-nrhs matrices,
+/// using mixed precision iterative refinement.
+///
+/// A is factored by lapack::getrf in single precision, which is about
+/// twice as fast as double, and the solution is refined to double
+/// precision accuracy, with residuals $R = B - A X$ computed in double:
+///     $X = X + (LU)^{-1} R$.
+/// Each refinement step costs $O(n^2 \, nrhs)$; for well-conditioned A,
+/// it converges in a few steps, when for each column
+///     $\|r\|_{\infty} \le \|x\|_{\infty} \|A\|_{\infty} \epsilon \sqrt{n}.$
+///
+/// Refinement falls back to factoring A with lapack::gesv in double
+/// precision if A or B overflows in single precision, if the single
+/// precision factor is singular, or if refinement stalls: unlike
+/// LAPACK's dsgesv, which runs up to 30 iterations before giving up, it
+/// stops as soon as the residual fails to decrease. Convergence needs
+/// roughly $\kappa(A) < 1/\epsilon_{single} \approx 10^7$.
+///
+/// This is a native implementation, not a wrapper for dsgesv or zcgesv.
+///
+/// Overloaded versions are available for
+/// `double` and `std::complex<double>`,
+/// factoring in `float` and `std::complex<float>`, respectively.
+///
+/// @see posv_mixed
+///
+/// @param[in] n
+///     The number of linear equations, i.e., the order of the
+///     matrix A. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides, i.e., the number of columns
+///     of the matrix B. nrhs >= 0.
+///
+/// @param[in,out] A
+///     The n-by-n matrix A, stored in an lda-by-n array.
+///     On entry, the n-by-n coefficient matrix A.
+///     On exit, if iter >= 0, unchanged; if iter < 0, the factors L and U
+///     from the double precision factorization $A = P L U$.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @param[out] ipiv
+///     The vector ipiv of length n.
+///     The pivot indices that define the permutation matrix P, of the
+///     single precision factorization if iter >= 0, or of the double
+///     precision factorization if iter < 0.
+///
+/// @param[in] B
+///     The n-by-nrhs right hand side matrix B, stored in an ldb-by-nrhs
+///     array.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B. ldb >= max(1,n).
+///
+/// @param[out] X
+///     The n-by-nrhs solution matrix X, stored in an ldx-by-nrhs array.
+///
+/// @param[in] ldx
+///     The leading dimension of the array X. ldx >= max(1,n).
+///
+/// @param[out] iter
+///     - >= 0: the number of refinement iterations; A was factored
+///             only in single precision.
+///     - < 0: refinement failed, and A was factored in double precision:
+///         - -2: A, B, or a residual overflows in single precision;
+///         - -3: the single precision factor is singular;
+///         - -31: refinement stalled or did not converge in 30 iterations.
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, U(i,i) computed in double precision
+///              is exactly zero. The factorization has been completed,
+///              but the factor U is exactly singular, so the solution
+///              could not be computed.
+///
+/// @ingroup gesv
+int64_t gesv_mixed(
+    int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    int64_t* iter )
+{
+    return impl::gesv_mixed( n, nrhs, A, lda, ipiv, B, ldb, X, ldx, iter );
+}
+
+}  // namespace lapack
@@ -0,0 +1,236 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "mixed_internal.hh"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper.
+/// @ingroup gesv
+///
+template <typename scalar_t>
+int64_t gesv_mixed_gmres(
+    int64_t n, int64_t nrhs,
+    scalar_t* A, int64_t lda,
+    int64_t* ipiv,
+    scalar_t const* B, int64_t ldb,
+    scalar_t* X, int64_t ldx,
+    blas::real_type< scalar_t > tol,
+    int64_t itermax, int64_t gmres_itermax,
+    int64_t* iter, int64_t* gmres_iter )
+{
+    using low_t = internal::lower_precision_t< scalar_t >;
+    using real_t = blas::real_type< scalar_t >;
+
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( ldb < max( 1, n ) );
+    lapack_error_if( ldx < max( 1, n ) );
+    lapack_error_if( itermax < 0 );
+    lapack_error_if( gmres_itermax < 1 );
+
+    *iter = 0;
+    *gmres_iter = 0;
+    if (n == 0 || nrhs == 0)
+        return 0;
+
+    if (tol <= 0)
+        tol = std::numeric_limits< real_t >::epsilon() * std::sqrt( real_t( n ) );
+    real_t anorm = lapack::lange( Norm::Inf, n, n, A, lda );
+    real_t cte = anorm * tol;
+
+    // Factor in lower precision; if A overflows there or the factor is
+    // singular, fall back to gesv below. Otherwise, promote the factors
+    // to higher precision, so GMRES applies the preconditioner at
+    // working precision.
+    std::vector< scalar_t > LU;
+    {
+        std::vector< low_t > SA( n*n );
+        if (internal::lag2lower( n, n, A, lda, SA.data(), n ) != 0) {
+            *iter = -2;
+        }
+        else if (lapack::getrf( n, n, SA.data(), n, ipiv ) != 0) {
+            *iter = -3;
+        }
+        else {
+            LU.resize( n*n );
+            internal::lag2higher( n, n, SA.data(), n, LU.data(), n );
+        }
+    }
+
+    if (*iter == 0) {
+        auto gemm_A = [&]( int64_t k, scalar_t alpha,
+                           scalar_t const* Xk, int64_t ldxk,
+                           scalar_t beta, scalar_t* Y, int64_t ldy ) {
+            blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                        n, k, n,
+                        alpha, A, lda,
+                               Xk, ldxk,
+                        beta,  Y, ldy );
+        };
+        auto precond = [&]( int64_t k, scalar_t* Y, int64_t ldy ) {
+            lapack::getrs( Op::NoTrans, n, k, LU.data(), n, ipiv, Y, ldy );
+        };
+
+        lapack::lacpy( MatrixType::General, n, nrhs, B, ldb, X, ldx );
+        precond( nrhs, X, ldx );
+        if (internal::gmres_ir( n, nrhs, B, ldb, X, ldx, cte,
+                                itermax, gmres_itermax, gemm_A, precond,
+                                iter, gmres_iter ))
+            return 0;
+        *iter = -(itermax + 1);
+    }
+
+    // Fall back to factoring and solving in higher precision.
+    lapack::lacpy( MatrixType::General, n, nrhs, B, ldb, X, ldx );
+    return lapack::gesv( n, nrhs, A, lda, ipiv, X, ldx );
+}
+
+}  // namespace impl
+
+//------------------------------------------------------------------------------
+/// @ingroup gesv
+int64_t gesv_mixed_gmres(
+    int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double tol, int64_t itermax, int64_t gmres_itermax,
+    int64_t* iter, int64_t* gmres_iter )
+{
+    return impl::gesv_mixed_gmres( n, nrhs, A, lda, ipiv, B, ldb, X, ldx,
+                                   tol, itermax, gmres_itermax,
+                                   iter, gmres_iter );
+}
+
+//------------------------------------------------------------------------------
+/// Computes the solution to a system of linear equations
+///     $A X = B$,
+/// where A is an n-by-n matrix and X and B are n-by-nrhs matrices,
+/// using GMRES-based mixed precision iterative refinement (GMRES-IR).
+///
+/// As in lapack::gesv_mixed, A is factored by lapack::getrf in single
+/// precision, and the solution is refined with residuals
+/// $R = B - A X$ computed in double. But each correction solves
+/// $A D = R$ by GMRES in double precision, preconditioned by the
+/// single precision factors $M = P L U$, instead of $D = M^{-1} R$.
+/// Classic refinement needs roughly $\kappa(A) < 10^7$; GMRES-IR
+/// converges for $\kappa(A)$ of $10^9$ or more, at the cost of
+/// GMRES iterations, each costing $O(n^2)$, whose number grows with
+/// $\kappa(A)$.
+/// Each GMRES solve stops when the preconditioned residual drops by
+/// $10^{-6}$, or after gmres_itermax iterations; refinement then
+/// restarts it from the new residual.
+///
+/// Falls back to lapack::gesv in double precision if A overflows in
+/// single precision, if the single precision factor is singular, or if
+/// refinement stalls or does not converge in itermax iterations.
+///
+/// Overloaded versions are available for
+/// `double` and `std::complex<double>`,
+/// factoring in `float` and `std::complex<float>`, respectively.
+///
+/// @see gesv_mixed
+/// @see posv_mixed_gmres
+///
+/// @param[in] n
+///     The number of linear equations, i.e., the order of the
+///     matrix A. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides, i.e., the number of columns
+///     of the matrix B. nrhs >= 0.
+///
+/// @param[in,out] A
+///     The n-by-n matrix A, stored in an lda-by-n array.
+///     On entry, the n-by-n coefficient matrix A.
+///     On exit, if iter >= 0, unchanged; if iter < 0, the factors L and U
+///     from the double precision factorization $A = P L U$.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @param[out] ipiv
+///     The vector ipiv of length n.
+///     The pivot indices that define the permutation matrix P, of the
+///     single precision factorization if iter >= 0, or of the double
+///     precision factorization if iter < 0.
+///
+/// @param[in] B
+///     The n-by-nrhs right hand side matrix B, stored in an ldb-by-nrhs
+///     array.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B. ldb >= max(1,n).
+///
+/// @param[out] X
+///     The n-by-nrhs solution matrix X, stored in an ldx-by-nrhs array.
+///
+/// @param[in] ldx
+///     The leading dimension of the array X. ldx >= max(1,n).
+///
+/// @param[in] tol
+///     Refinement has converged when, for each column,
+///     $\|r\|_{\infty} \le \|x\|_{\infty} \|A\|_{\infty} \, tol$.
+///     If tol <= 0, uses $\epsilon \sqrt{n}$, as gesv_mixed does.
+///
+/// @param[in] itermax
+///     Most refinement iterations. itermax >= 0.
+///
+/// @param[in] gmres_itermax
+///     Most GMRES iterations per refinement iteration and right hand
+///     side, i.e., the Krylov subspace dimension. gmres_itermax >= 1.
+///     Workspace is n*(gmres_itermax + 1).
+///
+/// @param[out] iter
+///     - >= 0: the number of refinement iterations; A was factored
+///             only in single precision.
+///     - < 0: refinement failed, and A was factored in double precision:
+///         - -2: A overflows in single precision;
+///         - -3: the single precision factor is singular;
+///         - -itermax-1: refinement stalled or did not converge in
+///           itermax iterations.
+///
+/// @param[out] gmres_iter
+///     Total number of GMRES iterations, over all refinement iterations
+///     and right hand sides, each costing one matrix-vector product and
+///     one pair of triangular solves; counted even if refinement failed.
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, U(i,i) computed in double precision
+///              is exactly zero. The factorization has been completed,
+///              but the factor U is exactly singular, so the solution
+///              could not be computed.
+///
+/// @ingroup gesv
+int64_t gesv_mixed_gmres(
+    int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    double tol, int64_t itermax, int64_t gmres_itermax,
+    int64_t* iter, int64_t* gmres_iter )
+{
+    return impl::gesv_mixed_gmres( n, nrhs, A, lda, ipiv, B, ldb, X, ldx,
+                                   tol, itermax, gmres_itermax,
+                                   iter, gmres_iter );
+}
+
+}  // namespace lapack
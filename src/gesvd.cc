@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack_internal.hh"
 #include "lapack/fortran.h"
+#include "work_size_cache.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -18,13 +19,19 @@ using blas::real;
 
 // -----------------------------------------------------------------------------
 /// @ingroup gesvd
-int64_t gesvd(
+void gesvd_work_size(
     lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
     float* A, int64_t lda,
     float* S,
     float* U, int64_t ldu,
-    float* VT, int64_t ldvt )
+    float* VT, int64_t ldvt,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "sgesvd" );
+    internal::WorkSizeKey key( "sgesvd", { to_char( jobu ), to_char( jobvt ), m, n, lda, ldu, ldvt } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     char jobu_ = to_char( jobu );
     char jobvt_ = to_char( jobvt );
     lapack_int m_ = to_lapack_int( m );
@@ -37,6 +44,7 @@ int64_t gesvd(
     // query for workspace size
     float qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_sgesvd(
         &jobu_, &jobvt_, &m_, &n_,
         A, &lda_,
@@ -45,13 +53,33 @@ int64_t gesvd(
         VT, &ldvt_,
         qry_work, &ineg_one, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    std::vector< float > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt,
+    float* work, int64_t lwork )
+{
+    char jobu_ = to_char( jobu );
+    char jobvt_ = to_char( jobvt );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldu_ = to_lapack_int( ldu );
+    lapack_int ldvt_ = to_lapack_int( ldvt );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_sgesvd(
         &jobu_, &jobvt_, &m_, &n_,
@@ -59,7 +87,7 @@ int64_t gesvd(
         S,
         U, &ldu_,
         VT, &ldvt_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -70,12 +98,41 @@ int64_t gesvd(
 // -----------------------------------------------------------------------------
 /// @ingroup gesvd
 int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt )
+{
+    internal::StatsScope stats_scope( "sgesvd" );
+    int64_t lwork;
+    gesvd_work_size(
+        jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return gesvd(
+        jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+void gesvd_work_size(
     lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
     double* A, int64_t lda,
     double* S,
     double* U, int64_t ldu,
-    double* VT, int64_t ldvt )
+    double* VT, int64_t ldvt,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "dgesvd" );
+    internal::WorkSizeKey key( "dgesvd", { to_char( jobu ), to_char( jobvt ), m, n, lda, ldu, ldvt } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     char jobu_ = to_char( jobu );
     char jobvt_ = to_char( jobvt );
     lapack_int m_ = to_lapack_int( m );
@@ -88,6 +145,7 @@ int64_t gesvd(
     // query for workspace size
     double qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_dgesvd(
         &jobu_, &jobvt_, &m_, &n_,
         A, &lda_,
@@ -96,13 +154,33 @@ int64_t gesvd(
         VT, &ldvt_,
         qry_work, &ineg_one, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    std::vector< double > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt,
+    double* work, int64_t lwork )
+{
+    char jobu_ = to_char( jobu );
+    char jobvt_ = to_char( jobvt );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldu_ = to_lapack_int( ldu );
+    lapack_int ldvt_ = to_lapack_int( ldvt );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_dgesvd(
         &jobu_, &jobvt_, &m_, &n_,
@@ -110,7 +188,7 @@ int64_t gesvd(
         S,
         U, &ldu_,
         VT, &ldvt_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -121,12 +199,42 @@ int64_t gesvd(
 // -----------------------------------------------------------------------------
 /// @ingroup gesvd
 int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt )
+{
+    internal::StatsScope stats_scope( "dgesvd" );
+    int64_t lwork;
+    gesvd_work_size(
+        jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return gesvd(
+        jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+void gesvd_work_size(
     lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
     std::complex<float>* A, int64_t lda,
     float* S,
     std::complex<float>* U, int64_t ldu,
-    std::complex<float>* VT, int64_t ldvt )
+    std::complex<float>* VT, int64_t ldvt,
+    int64_t* lwork,
+    int64_t* lrwork )
 {
+    internal::StatsScope stats_scope( "cgesvd" );
+    internal::WorkSizeKey key( "cgesvd", { to_char( jobu ), to_char( jobvt ), m, n, lda, ldu, ldvt } );
+    if (internal::work_size_cache_find( key, lwork, lrwork ))
+        return;
+
     char jobu_ = to_char( jobu );
     char jobvt_ = to_char( jobvt );
     lapack_int m_ = to_lapack_int( m );
@@ -140,6 +248,7 @@ int64_t gesvd(
     std::complex<float> qry_work[1];
     float qry_rwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_cgesvd(
         &jobu_, &jobvt_, &m_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -149,14 +258,36 @@ int64_t gesvd(
         (lapack_complex_float*) qry_work, &ineg_one,
         qry_rwork, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    *lrwork = 5*min( m, n );
+    internal::work_size_cache_insert( key, *lwork, *lrwork );
+}
 
-    // allocate workspace
-    std::vector< std::complex<float> > work( lwork_ );
-    std::vector< float > rwork( (5*min(m,n)) );
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork )
+{
+    char jobu_ = to_char( jobu );
+    char jobvt_ = to_char( jobvt );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldu_ = to_lapack_int( ldu );
+    lapack_int ldvt_ = to_lapack_int( ldvt );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( lrwork < 5*min( m, n ) );
+    lapack_int info_ = 0;
 
     LAPACK_cgesvd(
         &jobu_, &jobvt_, &m_, &n_,
@@ -164,8 +295,143 @@ int64_t gesvd(
         S,
         (lapack_complex_float*) U, &ldu_,
         (lapack_complex_float*) VT, &ldvt_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0], &info_
+        (lapack_complex_float*) work, &lwork_,
+        rwork, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt )
+{
+    internal::StatsScope stats_scope( "cgesvd" );
+    int64_t lwork, lrwork;
+    gesvd_work_size(
+        jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt,
+        &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+
+    return gesvd(
+        jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt,
+        &work[0], lwork, &rwork[0], lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::gesvd with caller-supplied workspace.
+/// Arguments are the same as for lapack::gesvd; the matrices are not
+/// modified. The sizes can be reused for any call of the same shape.
+///
+/// @param[out] lwork
+///     Required length of the work array.
+///
+/// @param[out] lrwork
+///     Required length of the rwork array.
+///
+/// @ingroup gesvd
+void gesvd_work_size(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt,
+    int64_t* lwork,
+    int64_t* lrwork )
+{
+    internal::StatsScope stats_scope( "zgesvd" );
+    internal::WorkSizeKey key( "zgesvd", { to_char( jobu ), to_char( jobvt ), m, n, lda, ldu, ldvt } );
+    if (internal::work_size_cache_find( key, lwork, lrwork ))
+        return;
+
+    char jobu_ = to_char( jobu );
+    char jobvt_ = to_char( jobvt );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldu_ = to_lapack_int( ldu );
+    lapack_int ldvt_ = to_lapack_int( ldvt );
+    lapack_int info_ = 0;
+
+    // query for workspace size
+    std::complex<double> qry_work[1];
+    double qry_rwork[1];
+    lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
+    LAPACK_zgesvd(
+        &jobu_, &jobvt_, &m_, &n_,
+        (lapack_complex_double*) A, &lda_,
+        S,
+        (lapack_complex_double*) U, &ldu_,
+        (lapack_complex_double*) VT, &ldvt_,
+        (lapack_complex_double*) qry_work, &ineg_one,
+        qry_rwork, &info_
+    );
+    query_timer.stop();
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    *lrwork = 5*min( m, n );
+    internal::work_size_cache_insert( key, *lwork, *lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::gesvd with caller-supplied workspace, which
+/// skips the internal workspace query and allocation. Other arguments
+/// are the same as for lapack::gesvd.
+///
+/// @param[out] work
+///     Workspace of length lwork.
+///
+/// @param[in] lwork
+///     Length of work, at least as returned by lapack::gesvd_work_size.
+///
+/// @param[out] rwork
+///     Workspace of length lrwork.
+///
+/// @param[in] lrwork
+///     Length of rwork, at least as returned by lapack::gesvd_work_size.
+///
+/// @ingroup gesvd
+int64_t gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork )
+{
+    char jobu_ = to_char( jobu );
+    char jobvt_ = to_char( jobvt );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldu_ = to_lapack_int( ldu );
+    lapack_int ldvt_ = to_lapack_int( ldvt );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( lrwork < 5*min( m, n ) );
+    lapack_int info_ = 0;
+
+    LAPACK_zgesvd(
+        &jobu_, &jobvt_, &m_, &n_,
+        (lapack_complex_double*) A, &lda_,
+        S,
+        (lapack_complex_double*) U, &ldu_,
+        (lapack_complex_double*) VT, &ldvt_,
+        (lapack_complex_double*) work, &lwork_,
+        rwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -291,50 +557,19 @@ int64_t gesvd(
     std::complex<double>* U, int64_t ldu,
     std::complex<double>* VT, int64_t ldvt )
 {
-    char jobu_ = to_char( jobu );
-    char jobvt_ = to_char( jobvt );
-    lapack_int m_ = to_lapack_int( m );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int ldu_ = to_lapack_int( ldu );
-    lapack_int ldvt_ = to_lapack_int( ldvt );
-    lapack_int info_ = 0;
-
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    double qry_rwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgesvd(
-        &jobu_, &jobvt_, &m_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        S,
-        (lapack_complex_double*) U, &ldu_,
-        (lapack_complex_double*) VT, &ldvt_,
-        (lapack_complex_double*) qry_work, &ineg_one,
-        qry_rwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    internal::StatsScope stats_scope( "zgesvd" );
+    int64_t lwork, lrwork;
+    gesvd_work_size(
+        jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt,
+        &lwork, &lrwork );
 
     // allocate workspace
-    std::vector< std::complex<double> > work( lwork_ );
-    std::vector< double > rwork( (5*min(m,n)) );
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< double > rwork( lrwork );
 
-    LAPACK_zgesvd(
-        &jobu_, &jobvt_, &m_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        S,
-        (lapack_complex_double*) U, &ldu_,
-        (lapack_complex_double*) VT, &ldvt_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0], &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return gesvd(
+        jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt,
+        &work[0], lwork, &rwork[0], lrwork );
 }
 
 }  // namespace lapack
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack_internal.hh"
 #include "lapack/fortran.h"
+#include "work_size_cache.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30600  // >= 3.6.0
@@ -20,14 +21,23 @@ using blas::real;
 
 // -----------------------------------------------------------------------------
 /// @ingroup gesvd
-int64_t gesvdx(
+void gesvdx_work_size(
     lapack::Job jobu, lapack::Job jobvt, lapack::Range range, int64_t m, int64_t n,
     float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu,
     int64_t* nfound,
     float* S,
     float* U, int64_t ldu,
-    float* VT, int64_t ldvt )
+    float* VT, int64_t ldvt,
+    int64_t* lwork,
+    int64_t* liwork )
 {
+    internal::StatsScope stats_scope( "sgesvdx" );
+    internal::WorkSizeKey key( "sgesvdx",
+        { to_char( jobu ), to_char( jobvt ), to_char( range ), m, n, lda, il,
+          iu, ldu, ldvt } );
+    if (internal::work_size_cache_find( key, lwork, nullptr, liwork ))
+        return;
+
     char jobu_ = to_char( jobu );
     char jobvt_ = to_char( jobvt );
     char range_ = to_char( range );
@@ -45,6 +55,7 @@ int64_t gesvdx(
     float qry_work[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_sgesvdx(
         &jobu_, &jobvt_, &range_, &m_, &n_,
         A, &lda_, &vl, &vu, &il_, &iu_, &nfound_,
@@ -54,14 +65,41 @@ int64_t gesvdx(
         qry_work, &ineg_one,
         qry_iwork, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    *liwork = 12*min(m,n);
+    internal::work_size_cache_insert( key, *lwork, 0, *liwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (12*min(m,n)) );
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+int64_t gesvdx(
+    lapack::Job jobu, lapack::Job jobvt, lapack::Range range, int64_t m, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu,
+    int64_t* nfound,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt,
+    float* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    char jobu_ = to_char( jobu );
+    char jobvt_ = to_char( jobvt );
+    char range_ = to_char( range );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int il_ = to_lapack_int( il );
+    lapack_int iu_ = to_lapack_int( iu );
+    lapack_int nfound_ = 0;  // out
+    lapack_int ldu_ = to_lapack_int( ldu );
+    lapack_int ldvt_ = to_lapack_int( ldvt );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( liwork < 12*min(m,n) );
+    lapack_int info_ = 0;
 
     LAPACK_sgesvdx(
         &jobu_, &jobvt_, &range_, &m_, &n_,
@@ -69,8 +107,8 @@ int64_t gesvdx(
         S,
         U, &ldu_,
         VT, &ldvt_,
-        &work[0], &lwork_,
-        &iwork[0], &info_
+        work, &lwork_,
+        iwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -82,13 +120,49 @@ int64_t gesvdx(
 // -----------------------------------------------------------------------------
 /// @ingroup gesvd
 int64_t gesvdx(
+    lapack::Job jobu, lapack::Job jobvt, lapack::Range range, int64_t m, int64_t n,
+    float* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu,
+    int64_t* nfound,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt )
+{
+    internal::StatsScope stats_scope( "sgesvdx" );
+    int64_t lwork, liwork;
+    gesvdx_work_size(
+        jobu, jobvt, range, m, n, A, lda, vl, vu, il, iu, nfound, S, U, ldu,
+        VT, ldvt,
+        &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return gesvdx(
+        jobu, jobvt, range, m, n, A, lda, vl, vu, il, iu, nfound, S, U, ldu,
+        VT, ldvt,
+        &work[0], lwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+void gesvdx_work_size(
     lapack::Job jobu, lapack::Job jobvt, lapack::Range range, int64_t m, int64_t n,
     double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu,
     int64_t* nfound,
     double* S,
     double* U, int64_t ldu,
-    double* VT, int64_t ldvt )
+    double* VT, int64_t ldvt,
+    int64_t* lwork,
+    int64_t* liwork )
 {
+    internal::StatsScope stats_scope( "dgesvdx" );
+    internal::WorkSizeKey key( "dgesvdx",
+        { to_char( jobu ), to_char( jobvt ), to_char( range ), m, n, lda, il,
+          iu, ldu, ldvt } );
+    if (internal::work_size_cache_find( key, lwork, nullptr, liwork ))
+        return;
+
     char jobu_ = to_char( jobu );
     char jobvt_ = to_char( jobvt );
     char range_ = to_char( range );
@@ -106,6 +180,7 @@ int64_t gesvdx(
     double qry_work[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_dgesvdx(
         &jobu_, &jobvt_, &range_, &m_, &n_,
         A, &lda_, &vl, &vu, &il_, &iu_, &nfound_,
@@ -115,14 +190,41 @@ int64_t gesvdx(
         qry_work, &ineg_one,
         qry_iwork, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    *liwork = 12*min(m,n);
+    internal::work_size_cache_insert( key, *lwork, 0, *liwork );
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (12*min(m,n)) );
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+int64_t gesvdx(
+    lapack::Job jobu, lapack::Job jobvt, lapack::Range range, int64_t m, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu,
+    int64_t* nfound,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt,
+    double* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    char jobu_ = to_char( jobu );
+    char jobvt_ = to_char( jobvt );
+    char range_ = to_char( range );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int il_ = to_lapack_int( il );
+    lapack_int iu_ = to_lapack_int( iu );
+    lapack_int nfound_ = 0;  // out
+    lapack_int ldu_ = to_lapack_int( ldu );
+    lapack_int ldvt_ = to_lapack_int( ldvt );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( liwork < 12*min(m,n) );
+    lapack_int info_ = 0;
 
     LAPACK_dgesvdx(
         &jobu_, &jobvt_, &range_, &m_, &n_,
@@ -130,8 +232,8 @@ int64_t gesvdx(
         S,
         U, &ldu_,
         VT, &ldvt_,
-        &work[0], &lwork_,
-        &iwork[0], &info_
+        work, &lwork_,
+        iwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -143,13 +245,50 @@ int64_t gesvdx(
 // -----------------------------------------------------------------------------
 /// @ingroup gesvd
 int64_t gesvdx(
+    lapack::Job jobu, lapack::Job jobvt, lapack::Range range, int64_t m, int64_t n,
+    double* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu,
+    int64_t* nfound,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt )
+{
+    internal::StatsScope stats_scope( "dgesvdx" );
+    int64_t lwork, liwork;
+    gesvdx_work_size(
+        jobu, jobvt, range, m, n, A, lda, vl, vu, il, iu, nfound, S, U, ldu,
+        VT, ldvt,
+        &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return gesvdx(
+        jobu, jobvt, range, m, n, A, lda, vl, vu, il, iu, nfound, S, U, ldu,
+        VT, ldvt,
+        &work[0], lwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+void gesvdx_work_size(
     lapack::Job jobu, lapack::Job jobvt, lapack::Range range, int64_t m, int64_t n,
     std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu,
     int64_t* nfound,
     float* S,
     std::complex<float>* U, int64_t ldu,
-    std::complex<float>* VT, int64_t ldvt )
+    std::complex<float>* VT, int64_t ldvt,
+    int64_t* lwork,
+    int64_t* lrwork,
+    int64_t* liwork )
 {
+    internal::StatsScope stats_scope( "cgesvdx" );
+    internal::WorkSizeKey key( "cgesvdx",
+        { to_char( jobu ), to_char( jobvt ), to_char( range ), m, n, lda, il,
+          iu, ldu, ldvt } );
+    if (internal::work_size_cache_find( key, lwork, lrwork, liwork ))
+        return;
+
     char jobu_ = to_char( jobu );
     char jobvt_ = to_char( jobvt );
     char range_ = to_char( range );
@@ -168,6 +307,7 @@ int64_t gesvdx(
     float qry_rwork[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_cgesvdx(
         &jobu_, &jobvt_, &range_, &m_, &n_,
         (lapack_complex_float*) A, &lda_, &vl, &vu, &il_, &iu_, &nfound_,
@@ -178,18 +318,45 @@ int64_t gesvdx(
         qry_rwork,
         qry_iwork, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-
+    *lwork = real(qry_work[0]);
     // from docs
-    int64_t lrwork = min(m,n)*(min(m,n)*2 + 15*min(m,n));
+    *lrwork = max( 1, min(m,n)*(min(m,n)*2 + 15*min(m,n)) );
+    *liwork = 12*min(m,n);
+    internal::work_size_cache_insert( key, *lwork, *lrwork, *liwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (max( 1, lrwork )) );
-    lapack::vector< lapack_int > iwork( (12*min(m,n)) );
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+int64_t gesvdx(
+    lapack::Job jobu, lapack::Job jobvt, lapack::Range range, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu,
+    int64_t* nfound,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    char jobu_ = to_char( jobu );
+    char jobvt_ = to_char( jobvt );
+    char range_ = to_char( range );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int il_ = to_lapack_int( il );
+    lapack_int iu_ = to_lapack_int( iu );
+    lapack_int nfound_ = 0;  // out
+    lapack_int ldu_ = to_lapack_int( ldu );
+    lapack_int ldvt_ = to_lapack_int( ldvt );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( lrwork < max( 1, min(m,n)*(min(m,n)*2 + 15*min(m,n)) ) );
+    lapack_error_if( liwork < 12*min(m,n) );
+    lapack_int info_ = 0;
 
     LAPACK_cgesvdx(
         &jobu_, &jobvt_, &range_, &m_, &n_,
@@ -197,9 +364,178 @@ int64_t gesvdx(
         S,
         (lapack_complex_float*) U, &ldu_,
         (lapack_complex_float*) VT, &ldvt_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0],
-        &iwork[0], &info_
+        (lapack_complex_float*) work, &lwork_,
+        rwork,
+        iwork, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *nfound = nfound_;
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+int64_t gesvdx(
+    lapack::Job jobu, lapack::Job jobvt, lapack::Range range, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda, float vl, float vu, int64_t il, int64_t iu,
+    int64_t* nfound,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt )
+{
+    internal::StatsScope stats_scope( "cgesvdx" );
+    int64_t lwork, lrwork, liwork;
+    gesvdx_work_size(
+        jobu, jobvt, range, m, n, A, lda, vl, vu, il, iu, nfound, S, U, ldu,
+        VT, ldvt,
+        &lwork, &lrwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return gesvdx(
+        jobu, jobvt, range, m, n, A, lda, vl, vu, il, iu, nfound, S, U, ldu,
+        VT, ldvt,
+        &work[0], lwork, &rwork[0], lrwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::gesvdx with caller-supplied workspace.
+/// Arguments are the same as for lapack::gesvdx; the matrices are not
+/// modified. The sizes can be reused for any call of the same shape.
+///
+/// @param[out] lwork
+///     Required length of the work array.
+///
+/// @param[out] lrwork
+///     Required length of the rwork array.
+///
+/// @param[out] liwork
+///     Required length of the iwork array.
+///
+/// @ingroup gesvd
+void gesvdx_work_size(
+    lapack::Job jobu, lapack::Job jobvt, lapack::Range range, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu,
+    int64_t* nfound,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt,
+    int64_t* lwork,
+    int64_t* lrwork,
+    int64_t* liwork )
+{
+    internal::StatsScope stats_scope( "zgesvdx" );
+    internal::WorkSizeKey key( "zgesvdx",
+        { to_char( jobu ), to_char( jobvt ), to_char( range ), m, n, lda, il,
+          iu, ldu, ldvt } );
+    if (internal::work_size_cache_find( key, lwork, lrwork, liwork ))
+        return;
+
+    char jobu_ = to_char( jobu );
+    char jobvt_ = to_char( jobvt );
+    char range_ = to_char( range );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int il_ = to_lapack_int( il );
+    lapack_int iu_ = to_lapack_int( iu );
+    lapack_int nfound_ = 0;  // out
+    lapack_int ldu_ = to_lapack_int( ldu );
+    lapack_int ldvt_ = to_lapack_int( ldvt );
+    lapack_int info_ = 0;
+
+    // query for workspace size
+    std::complex<double> qry_work[1];
+    double qry_rwork[1];
+    lapack_int qry_iwork[1];
+    lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
+    LAPACK_zgesvdx(
+        &jobu_, &jobvt_, &range_, &m_, &n_,
+        (lapack_complex_double*) A, &lda_, &vl, &vu, &il_, &iu_, &nfound_,
+        S,
+        (lapack_complex_double*) U, &ldu_,
+        (lapack_complex_double*) VT, &ldvt_,
+        (lapack_complex_double*) qry_work, &ineg_one,
+        qry_rwork,
+        qry_iwork, &info_
+    );
+    query_timer.stop();
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    // from docs
+    *lrwork = max( 1, min(m,n)*(min(m,n)*2 + 15*min(m,n)) );
+    *liwork = 12*min(m,n);
+    internal::work_size_cache_insert( key, *lwork, *lrwork, *liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::gesvdx with caller-supplied workspace, which
+/// skips the internal workspace query and allocation. Other arguments
+/// are the same as for lapack::gesvdx.
+///
+/// @param[out] work
+///     Workspace of length lwork.
+///
+/// @param[in] lwork
+///     Length of work, at least as returned by lapack::gesvdx_work_size.
+///
+/// @param[out] rwork
+///     Workspace of length lrwork.
+///
+/// @param[in] lrwork
+///     Length of rwork, at least as returned by lapack::gesvdx_work_size.
+///
+/// @param[out] iwork
+///     Workspace of length liwork.
+///
+/// @param[in] liwork
+///     Length of iwork, at least as returned by lapack::gesvdx_work_size.
+///
+/// @ingroup gesvd
+int64_t gesvdx(
+    lapack::Job jobu, lapack::Job jobvt, lapack::Range range, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda, double vl, double vu, int64_t il, int64_t iu,
+    int64_t* nfound,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    char jobu_ = to_char( jobu );
+    char jobvt_ = to_char( jobvt );
+    char range_ = to_char( range );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int il_ = to_lapack_int( il );
+    lapack_int iu_ = to_lapack_int( iu );
+    lapack_int nfound_ = 0;  // out
+    lapack_int ldu_ = to_lapack_int( ldu );
+    lapack_int ldvt_ = to_lapack_int( ldvt );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( lrwork < max( 1, min(m,n)*(min(m,n)*2 + 15*min(m,n)) ) );
+    lapack_error_if( liwork < 12*min(m,n) );
+    lapack_int info_ = 0;
+
+    LAPACK_zgesvdx(
+        &jobu_, &jobvt_, &range_, &m_, &n_,
+        (lapack_complex_double*) A, &lda_, &vl, &vu, &il_, &iu_, &nfound_,
+        S,
+        (lapack_complex_double*) U, &ldu_,
+        (lapack_complex_double*) VT, &ldvt_,
+        (lapack_complex_double*) work, &lwork_,
+        rwork,
+        iwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -345,62 +681,22 @@ int64_t gesvdx(
     std::complex<double>* U, int64_t ldu,
     std::complex<double>* VT, int64_t ldvt )
 {
-    char jobu_ = to_char( jobu );
-    char jobvt_ = to_char( jobvt );
-    char range_ = to_char( range );
-    lapack_int m_ = to_lapack_int( m );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int il_ = to_lapack_int( il );
-    lapack_int iu_ = to_lapack_int( iu );
-    lapack_int nfound_ = 0;  // out
-    lapack_int ldu_ = to_lapack_int( ldu );
-    lapack_int ldvt_ = to_lapack_int( ldvt );
-    lapack_int info_ = 0;
-
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    double qry_rwork[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgesvdx(
-        &jobu_, &jobvt_, &range_, &m_, &n_,
-        (lapack_complex_double*) A, &lda_, &vl, &vu, &il_, &iu_, &nfound_,
-        S,
-        (lapack_complex_double*) U, &ldu_,
-        (lapack_complex_double*) VT, &ldvt_,
-        (lapack_complex_double*) qry_work, &ineg_one,
-        qry_rwork,
-        qry_iwork, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // from docs
-    int64_t lrwork = min(m,n)*(min(m,n)*2 + 15*min(m,n));
+    internal::StatsScope stats_scope( "zgesvdx" );
+    int64_t lwork, lrwork, liwork;
+    gesvdx_work_size(
+        jobu, jobvt, range, m, n, A, lda, vl, vu, il, iu, nfound, S, U, ldu,
+        VT, ldvt,
+        &lwork, &lrwork, &liwork );
 
     // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (max( 1, lrwork )) );
-    lapack::vector< lapack_int > iwork( (12*min(m,n)) );
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+    lapack::vector< lapack_int > iwork( liwork );
 
-    LAPACK_zgesvdx(
-        &jobu_, &jobvt_, &range_, &m_, &n_,
-        (lapack_complex_double*) A, &lda_, &vl, &vu, &il_, &iu_, &nfound_,
-        S,
-        (lapack_complex_double*) U, &ldu_,
-        (lapack_complex_double*) VT, &ldvt_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0],
-        &iwork[0], &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    *nfound = nfound_;
-    return info_;
+    return gesvdx(
+        jobu, jobvt, range, m, n, A, lda, vl, vu, il, iu, nfound, S, U, ldu,
+        VT, ldvt,
+        &work[0], lwork, &rwork[0], lrwork, &iwork[0], liwork );
 }
 
 }  // namespace lapack
@@ -25,6 +25,7 @@ int64_t getrf2(
     float* A, int64_t lda,
     int64_t* ipiv )
 {
+    internal::StatsScope stats_scope( "sgetrf2" );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -57,6 +58,7 @@ int64_t getrf2(
     double* A, int64_t lda,
     int64_t* ipiv )
 {
+    internal::StatsScope stats_scope( "dgetrf2" );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -89,6 +91,7 @@ int64_t getrf2(
     std::complex<float>* A, int64_t lda,
     int64_t* ipiv )
 {
+    internal::StatsScope stats_scope( "cgetrf2" );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -191,6 +194,7 @@ int64_t getrf2(
     std::complex<double>* A, int64_t lda,
     int64_t* ipiv )
 {
+    internal::StatsScope stats_scope( "zgetrf2" );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -216,6 +220,108 @@ int64_t getrf2(
     return info_;
 }
 
+#ifndef LAPACK_ILP64
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getrf2(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    lapack_int* ipiv )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int* ipiv_ptr = ipiv;
+    lapack_int info_ = 0;
+
+    LAPACK_sgetrf2(
+        &m_, &n_,
+        A, &lda_,
+        ipiv_ptr, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getrf2(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    lapack_int* ipiv )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int* ipiv_ptr = ipiv;
+    lapack_int info_ = 0;
+
+    LAPACK_dgetrf2(
+        &m_, &n_,
+        A, &lda_,
+        ipiv_ptr, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getrf2(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    lapack_int* ipiv )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int* ipiv_ptr = ipiv;
+    lapack_int info_ = 0;
+
+    LAPACK_cgetrf2(
+        &m_, &n_,
+        (lapack_complex_float*) A, &lda_,
+        ipiv_ptr, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::getrf2 that takes ipiv in the native LAPACK integer
+/// type, lapack_int, instead of int64_t, which avoids allocating and
+/// copying a temporary pivot array. Available only when lapack_int is
+/// 32-bit, i.e., LAPACK_ILP64 is not defined; otherwise the int64_t
+/// version is already native.
+///
+/// @ingroup gesv_computational
+int64_t getrf2(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    lapack_int* ipiv )
+{
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int* ipiv_ptr = ipiv;
+    lapack_int info_ = 0;
+
+    LAPACK_zgetrf2(
+        &m_, &n_,
+        (lapack_complex_double*) A, &lda_,
+        ipiv_ptr, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+#endif  // LAPACK_ILP64
+
 }  // namespace lapack
 
 #endif  // LAPACK >= v3.6
@@ -0,0 +1,487 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "lapack/fortran.h"
+#include "NoConstructAllocator.hh"
+#include "batch_internal.hh"
+
+#include <atomic>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+//==============================================================================
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, float version.
+inline void getrf(
+    lapack_int m, lapack_int n,
+    float* A, lapack_int lda,
+    lapack_int* ipiv, lapack_int* info )
+{
+    LAPACK_sgetrf( &m, &n, A, &lda, ipiv, info );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, double version.
+inline void getrf(
+    lapack_int m, lapack_int n,
+    double* A, lapack_int lda,
+    lapack_int* ipiv, lapack_int* info )
+{
+    LAPACK_dgetrf( &m, &n, A, &lda, ipiv, info );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, complex<float> version.
+inline void getrf(
+    lapack_int m, lapack_int n,
+    std::complex<float>* A, lapack_int lda,
+    lapack_int* ipiv, lapack_int* info )
+{
+    LAPACK_cgetrf( &m, &n, (lapack_complex_float*) A, &lda, ipiv, info );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, complex<double> version.
+inline void getrf(
+    lapack_int m, lapack_int n,
+    std::complex<double>* A, lapack_int lda,
+    lapack_int* ipiv, lapack_int* info )
+{
+    LAPACK_zgetrf( &m, &n, (lapack_complex_double*) A, &lda, ipiv, info );
+}
+
+}  // namespace internal
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// One problem in a getrf batch.
+template <typename scalar_t>
+struct GetrfProblem
+{
+    int64_t m, n;
+    scalar_t* A;
+    int64_t lda;
+    int64_t* ipiv;
+};
+
+//------------------------------------------------------------------------------
+/// Mid-level templated batch driver. problem( i ) returns the GetrfProblem
+/// for matrix i. Checks all arguments on the calling thread, then factors
+/// the matrices in parallel.
+/// @ingroup gesv_computational
+///
+template <typename scalar_t, typename problem_t>
+int64_t getrf_batch(
+    int64_t batch_size, problem_t const& problem, int64_t* info )
+{
+    lapack_error_if( batch_size < 0 );
+
+    int64_t flops = 0;
+    for (int64_t i = 0; i < batch_size; ++i) {
+        GetrfProblem< scalar_t > p = problem( i );
+        lapack_error_if( p.m < 0 );
+        lapack_error_if( p.n < 0 );
+        lapack_error_if( p.lda < max( 1, p.m ) );
+        to_lapack_int( p.n );    // check for overflow
+        to_lapack_int( p.lda );
+        flops += p.m * p.n * min( p.m, p.n );
+    }
+    if (batch_size == 0)
+        return 0;
+
+    // Give each thread at least ~64K flops per range, e.g., 128 8x8 matrices.
+    int64_t grain = (int64_t( 1 ) << 16) / max( 1, flops / batch_size );
+
+    std::atomic< int64_t > nsingular { 0 };
+    internal::parallel_for( batch_size, grain, [&]( int64_t begin, int64_t end ) {
+        #ifndef LAPACK_ILP64
+            // 32-bit copy, reused for all matrices in this range
+            lapack::vector< lapack_int > ipiv_;
+        #endif
+        int64_t count = 0;
+        for (int64_t i = begin; i < end; ++i) {
+            GetrfProblem< scalar_t > p = problem( i );
+            int64_t minmn = min( p.m, p.n );
+            lapack_int m_ = lapack_int( p.m );
+            lapack_int n_ = lapack_int( p.n );
+            lapack_int lda_ = lapack_int( p.lda );
+            #ifndef LAPACK_ILP64
+                if (int64_t( ipiv_.size() ) < max( 1, minmn ))
+                    ipiv_.resize( max( 1, minmn ) );
+                lapack_int* ipiv_ptr = &ipiv_[0];
+            #else
+                lapack_int* ipiv_ptr = p.ipiv;
+            #endif
+            lapack_int info_ = 0;
+
+            internal::getrf( m_, n_, p.A, lda_, ipiv_ptr, &info_ );
+            if (info_ < 0) {
+                throw Error();
+            }
+            #ifndef LAPACK_ILP64
+                std::copy( &ipiv_[0], &ipiv_[minmn], p.ipiv );
+            #endif
+            info[ i ] = info_;
+            if (info_ > 0)
+                ++count;
+        }
+        nsingular += count;
+    });
+    return nsingular;
+}
+
+//------------------------------------------------------------------------------
+/// Pointer-array form.
+/// @ingroup gesv_computational
+///
+template <typename scalar_t>
+int64_t getrf_batch(
+    int64_t m, int64_t n,
+    scalar_t* const* Aarray, int64_t lda,
+    int64_t* const* ipiv_array,
+    int64_t batch_size, int64_t* info )
+{
+    return getrf_batch< scalar_t >(
+        batch_size,
+        [&]( int64_t i ) {
+            return GetrfProblem< scalar_t >
+                { m, n, Aarray[ i ], lda, ipiv_array[ i ] };
+        },
+        info );
+}
+
+//------------------------------------------------------------------------------
+/// Strided form.
+/// @ingroup gesv_computational
+///
+template <typename scalar_t>
+int64_t getrf_batch(
+    int64_t m, int64_t n,
+    scalar_t* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    int64_t batch_size, int64_t* info )
+{
+    lapack_error_if( strideA < lda * n );
+    lapack_error_if( stride_ipiv < min( m, n ) );
+
+    return getrf_batch< scalar_t >(
+        batch_size,
+        [&]( int64_t i ) {
+            return GetrfProblem< scalar_t >
+                { m, n, A + i*strideA, lda, ipiv + i*stride_ipiv };
+        },
+        info );
+}
+
+//------------------------------------------------------------------------------
+/// Group form.
+/// @ingroup gesv_computational
+///
+template <typename scalar_t>
+int64_t getrf_batch(
+    int64_t group_count, int64_t const* group_size,
+    int64_t const* m, int64_t const* n,
+    scalar_t* const* Aarray, int64_t const* lda,
+    int64_t* const* ipiv_array,
+    int64_t* info )
+{
+    internal::BatchGroups groups( group_count, group_size );
+    return getrf_batch< scalar_t >(
+        groups.batch_size(),
+        [&]( int64_t i ) {
+            int64_t g = groups.group( i );
+            return GetrfProblem< scalar_t >
+                { m[ g ], n[ g ], Aarray[ i ], lda[ g ], ipiv_array[ i ] };
+        },
+        info );
+}
+
+}  // namespace impl
+
+//------------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getrf_batch(
+    int64_t m, int64_t n,
+    float* const* Aarray, int64_t lda,
+    int64_t* const* ipiv_array,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::getrf_batch(
+        m, n, Aarray, lda, ipiv_array, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getrf_batch(
+    int64_t m, int64_t n,
+    double* const* Aarray, int64_t lda,
+    int64_t* const* ipiv_array,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::getrf_batch(
+        m, n, Aarray, lda, ipiv_array, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getrf_batch(
+    int64_t m, int64_t n,
+    std::complex<float>* const* Aarray, int64_t lda,
+    int64_t* const* ipiv_array,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::getrf_batch(
+        m, n, Aarray, lda, ipiv_array, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// Computes LU factorizations of a batch of general m-by-n matrices,
+/// in parallel, using partial pivoting with row interchanges:
+/// \[
+///     A_i = P_i L_i U_i,
+/// \]
+/// as in lapack::getrf. Pointer-array form: all matrices have the same
+/// size and leading dimension.
+///
+/// Compared to calling lapack::getrf in a loop, this checks arguments
+/// once for the batch, does no workspace query, and reuses one pivot
+/// buffer per thread for the 32-bit copy when needed.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] m
+///     The number of rows of each matrix A_i. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of each matrix A_i. n >= 0.
+///
+/// @param[in,out] Aarray
+///     Array of batch_size pointers. Each A_i is an lda-by-n matrix,
+///     stored in an lda-by-n array.
+///     On entry, the m-by-n matrix A_i to be factored.
+///     On exit, the factors L_i and U_i; the unit diagonal elements of
+///     L_i are not stored.
+///
+/// @param[in] lda
+///     The leading dimension of each A_i. lda >= max(1,m).
+///
+/// @param[out] ipiv_array
+///     Array of batch_size pointers. Each ipiv_i is a vector of length
+///     min(m,n), the pivot indices of A_i, as in lapack::getrf.
+///
+/// @param[in] batch_size
+///     The number of matrices. batch_size >= 0.
+///
+/// @param[out] info
+///     The vector info of length batch_size.
+///     - info[i] = 0: A_i was factored successfully.
+///     - info[i] = k > 0: U_i(k,k) is exactly zero; see lapack::getrf.
+///
+/// @return number of matrices with info[i] > 0, i.e., 0 if all are
+///     nonsingular.
+///
+/// @ingroup gesv_computational
+int64_t getrf_batch(
+    int64_t m, int64_t n,
+    std::complex<double>* const* Aarray, int64_t lda,
+    int64_t* const* ipiv_array,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::getrf_batch(
+        m, n, Aarray, lda, ipiv_array, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getrf_batch(
+    int64_t m, int64_t n,
+    float* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::getrf_batch(
+        m, n, A, lda, strideA, ipiv, stride_ipiv, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getrf_batch(
+    int64_t m, int64_t n,
+    double* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::getrf_batch(
+        m, n, A, lda, strideA, ipiv, stride_ipiv, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getrf_batch(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::getrf_batch(
+        m, n, A, lda, strideA, ipiv, stride_ipiv, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// Computes LU factorizations of a batch of general m-by-n matrices,
+/// in parallel; strided form. Matrix A_i starts at A + i*strideA and
+/// its pivots at ipiv + i*stride_ipiv.
+/// See the pointer-array form of lapack::getrf_batch for details.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] m
+///     The number of rows of each matrix A_i. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of each matrix A_i. n >= 0.
+///
+/// @param[in,out] A
+///     The batch_size matrices A_i, each lda-by-n, strideA apart.
+///
+/// @param[in] lda
+///     The leading dimension of each A_i. lda >= max(1,m).
+///
+/// @param[in] strideA
+///     Distance between the starts of A_i and A_{i+1}. strideA >= lda*n.
+///
+/// @param[out] ipiv
+///     The batch_size pivot vectors, each of length min(m,n),
+///     stride_ipiv apart.
+///
+/// @param[in] stride_ipiv
+///     Distance between the starts of ipiv_i and ipiv_{i+1}.
+///     stride_ipiv >= min(m,n).
+///
+/// @param[in] batch_size
+///     The number of matrices. batch_size >= 0.
+///
+/// @param[out] info
+///     The vector info of length batch_size; see lapack::getrf.
+///
+/// @return number of matrices with info[i] > 0.
+///
+/// @ingroup gesv_computational
+int64_t getrf_batch(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::getrf_batch(
+        m, n, A, lda, strideA, ipiv, stride_ipiv, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getrf_batch(
+    int64_t group_count, int64_t const* group_size,
+    int64_t const* m, int64_t const* n,
+    float* const* Aarray, int64_t const* lda,
+    int64_t* const* ipiv_array,
+    int64_t* info )
+{
+    return impl::getrf_batch(
+        group_count, group_size, m, n, Aarray, lda, ipiv_array, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getrf_batch(
+    int64_t group_count, int64_t const* group_size,
+    int64_t const* m, int64_t const* n,
+    double* const* Aarray, int64_t const* lda,
+    int64_t* const* ipiv_array,
+    int64_t* info )
+{
+    return impl::getrf_batch(
+        group_count, group_size, m, n, Aarray, lda, ipiv_array, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getrf_batch(
+    int64_t group_count, int64_t const* group_size,
+    int64_t const* m, int64_t const* n,
+    std::complex<float>* const* Aarray, int64_t const* lda,
+    int64_t* const* ipiv_array,
+    int64_t* info )
+{
+    return impl::getrf_batch(
+        group_count, group_size, m, n, Aarray, lda, ipiv_array, info );
+}
+
+//------------------------------------------------------------------------------
+/// Computes LU factorizations of a batch of general matrices,
+/// in parallel; group form with variable sizes. Group g has
+/// group_size[g] matrices, each m[g]-by-n[g] with leading dimension
+/// lda[g]. The matrices of all groups are listed consecutively in
+/// Aarray, ipiv_array, and info, starting with group 0.
+/// See the pointer-array form of lapack::getrf_batch for details.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] group_count
+///     The number of groups. group_count >= 0.
+///
+/// @param[in] group_size
+///     The vector group_size of length group_count.
+///     The number of matrices in each group. group_size[g] >= 0.
+///
+/// @param[in] m
+///     The vector m of length group_count.
+///     The number of rows of matrices in each group. m[g] >= 0.
+///
+/// @param[in] n
+///     The vector n of length group_count.
+///     The number of columns of matrices in each group. n[g] >= 0.
+///
+/// @param[in,out] Aarray
+///     Array of sum( group_size ) pointers to the matrices A_i.
+///
+/// @param[in] lda
+///     The vector lda of length group_count.
+///     The leading dimension of matrices in each group.
+///     lda[g] >= max(1,m[g]).
+///
+/// @param[out] ipiv_array
+///     Array of sum( group_size ) pointers to the pivot vectors ipiv_i,
+///     each of length min(m[g],n[g]).
+///
+/// @param[out] info
+///     The vector info of length sum( group_size ); see lapack::getrf.
+///
+/// @return number of matrices with info[i] > 0.
+///
+/// @ingroup gesv_computational
+int64_t getrf_batch(
+    int64_t group_count, int64_t const* group_size,
+    int64_t const* m, int64_t const* n,
+    std::complex<double>* const* Aarray, int64_t const* lda,
+    int64_t* const* ipiv_array,
+    int64_t* info )
+{
+    return impl::getrf_batch(
+        group_count, group_size, m, n, Aarray, lda, ipiv_array, info );
+}
+
+}  // namespace lapack
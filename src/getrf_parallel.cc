@@ -0,0 +1,365 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "task_graph.hh"
+#include "thread_pool.hh"
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Candidate pivot rows in a tournament: their global indices, their
+/// original values, and the LU factors GEPP computed with them on top.
+template <typename scalar_t>
+struct TournamentRows
+{
+    int64_t count = 0;
+    std::vector< int64_t > rows;     ///< global row indices
+    std::vector< scalar_t > values;  ///< count-by-kb original rows
+    std::vector< scalar_t > lu;      ///< count-by-kb top of the LU factors
+};
+
+//------------------------------------------------------------------------------
+/// Plays one round of the tournament: factors the nrows-by-kb matrix S
+/// of original rows, with global indices rows, using GEPP, and keeps the
+/// first min( kb, nrows ) pivot rows as winners, in pivot order.
+/// S is overwritten.
+template <typename scalar_t>
+void tournament_round(
+    int64_t nrows, int64_t kb,
+    scalar_t* S, std::vector< int64_t >& rows,
+    TournamentRows< scalar_t >& winners )
+{
+    std::vector< scalar_t > W( S, S + nrows*kb );
+    std::vector< lapack_int > piv( min( nrows, kb ) );
+    lapack::getrf( nrows, kb, W.data(), nrows, piv.data() );
+
+    int64_t count = min( kb, nrows );
+    for (int64_t i = 0; i < count; ++i) {
+        int64_t p = piv[ i ] - 1;
+        if (p != i) {
+            blas::swap( kb, &S[ i ], nrows, &S[ p ], nrows );
+            std::swap( rows[ i ], rows[ p ] );
+        }
+    }
+
+    winners.count = count;
+    winners.rows.assign( rows.begin(), rows.begin() + count );
+    winners.values.resize( count*kb );
+    winners.lu.resize( count*kb );
+    lapack::lacpy( MatrixType::General, count, kb, S, nrows,
+                   winners.values.data(), count );
+    lapack::lacpy( MatrixType::General, count, kb, W.data(), nrows,
+                   winners.lu.data(), count );
+}
+
+}  // namespace internal
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper.
+/// @ingroup gesv_computational
+///
+template <typename scalar_t>
+int64_t getrf_parallel(
+    int64_t m, int64_t n,
+    scalar_t* A, int64_t lda,
+    int64_t* ipiv )
+{
+    using blas::Layout;
+    using blas::Side;
+    using blas::Diag;
+    using Rows = internal::TournamentRows< scalar_t >;
+
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+
+    int64_t nb = (min( m, n ) >= 4096 ? 256 : 128);
+    int64_t mt = (m + nb - 1) / nb;
+    int64_t nt = (n + nb - 1) / nb;
+    int64_t kt = min( mt, nt );
+    if (kt <= 1)
+        return lapack::getrf( m, n, A, lda, ipiv );
+
+    const scalar_t one = 1;
+
+    auto tile = [&]( int64_t i, int64_t j ) {
+        return &A[ i*nb + j*nb*lda ];
+    };
+    auto rows = [&]( int64_t i ) {
+        return min( nb, m - i*nb );
+    };
+    auto cols = [&]( int64_t j ) {
+        return min( nb, n - j*nb );
+    };
+    auto key = [&]( int64_t i, int64_t j ) {
+        return i + j*mt;
+    };
+    // Tournament candidates of panel k, row tile i.
+    auto cand_key = [&]( int64_t k, int64_t i ) {
+        return mt*nt + k*mt + i;
+    };
+    // Lookahead, as in potrf_parallel: earlier columns first, and the
+    // panel before updates.
+    auto priority = [&]( int64_t j, bool panel ) {
+        return 2*(nt - j) + (panel ? 1 : 0);
+    };
+
+    // First zero pivot, as in getrf.
+    std::atomic< int64_t > info { 0 };
+    std::vector< Rows > cand( kt * mt );
+
+    internal::TaskGraph graph;
+    for (int64_t k = 0; k < kt; ++k) {
+        int64_t r0 = k*nb;
+        int64_t kb = min( nb, min( m - r0, n - r0 ) );
+        Rows* cand_k = &cand[ k*mt ];
+
+        // Tournament leaves: GEPP on each row tile of the panel.
+        for (int64_t i = k; i < mt; ++i) {
+            graph.add( priority( k, true ),
+                       { key( i, k ) }, { cand_key( k, i ) }, [=, &tile] {
+                int64_t mb = rows( i );
+                std::vector< scalar_t > S( mb*kb );
+                lapack::lacpy( MatrixType::General, mb, kb, tile( i, k ), lda,
+                               S.data(), mb );
+                std::vector< int64_t > idx( mb );
+                for (int64_t ii = 0; ii < mb; ++ii)
+                    idx[ ii ] = i*nb + ii;
+                internal::tournament_round( mb, kb, S.data(), idx, cand_k[ i ] );
+            });
+        }
+
+        // Binary reduction tree; the winners end in cand_k[ k ].
+        for (int64_t s = 1; k + s < mt; s *= 2) {
+            for (int64_t i = k; i + s < mt; i += 2*s) {
+                graph.add( priority( k, true ),
+                           { cand_key( k, i + s ) }, { cand_key( k, i ) }, [=] {
+                    Rows& a = cand_k[ i ];
+                    Rows& b = cand_k[ i + s ];
+                    int64_t nrows = a.count + b.count;
+                    std::vector< scalar_t > S( nrows*kb );
+                    lapack::lacpy( MatrixType::General, a.count, kb,
+                                   a.values.data(), a.count, &S[ 0 ], nrows );
+                    lapack::lacpy( MatrixType::General, b.count, kb,
+                                   b.values.data(), b.count, &S[ a.count ], nrows );
+                    std::vector< int64_t > idx( a.rows );
+                    idx.insert( idx.end(), b.rows.begin(), b.rows.end() );
+                    internal::tournament_round( nrows, kb, S.data(), idx, a );
+                    b = Rows();  // release
+                });
+            }
+        }
+
+        // Move the winners to the top of the panel, recording the swaps
+        // in ipiv as getrf does, and install their LU factors.
+        std::vector< int64_t > panel_keys;
+        for (int64_t i = k; i < mt; ++i)
+            panel_keys.push_back( key( i, k ) );
+        panel_keys.push_back( cand_key( k, k ) );
+        graph.add( priority( k, true ), {}, panel_keys, [=, &info, &tile] {
+            Rows& win = cand_k[ k ];
+            int64_t mk = m - r0;
+            int64_t nbk = cols( k );
+            scalar_t* Akk = tile( k, k );
+
+            // order[ p ] is the original row at position r0 + p; where is
+            // its inverse.
+            std::vector< int64_t > order( mk ), where( mk );
+            for (int64_t p = 0; p < mk; ++p)
+                order[ p ] = where[ p ] = p;
+            for (int64_t ii = 0; ii < kb; ++ii) {
+                int64_t p = where[ win.rows[ ii ] - r0 ];
+                ipiv[ r0 + ii ] = r0 + p + 1;
+                if (p != ii) {
+                    blas::swap( nbk, &Akk[ ii ], lda, &Akk[ p ], lda );
+                    std::swap( order[ ii ], order[ p ] );
+                    where[ order[ ii ] ] = ii;
+                    where[ order[ p ] ] = p;
+                }
+            }
+
+            lapack::lacpy( MatrixType::General, kb, kb, win.lu.data(), kb,
+                           Akk, lda );
+            for (int64_t ii = 0; ii < kb; ++ii) {
+                if (Akk[ ii + ii*lda ] == scalar_t( 0 )) {
+                    int64_t expected = 0;
+                    info.compare_exchange_strong( expected, r0 + ii + 1 );
+                    break;
+                }
+            }
+            // Rest of the diagonal tile: U to the right of the panel, if
+            // n < nb there; L below it, if the tile is taller than kb.
+            if (nbk > kb) {
+                blas::trsm( Layout::ColMajor, Side::Left, Uplo::Lower,
+                            Op::NoTrans, Diag::Unit, kb, nbk - kb,
+                            one, Akk, lda, &Akk[ kb*lda ], lda );
+            }
+            if (rows( k ) > kb) {
+                blas::trsm( Layout::ColMajor, Side::Right, Uplo::Upper,
+                            Op::NoTrans, Diag::NonUnit, rows( k ) - kb, kb,
+                            one, Akk, lda, &Akk[ kb ], lda );
+            }
+            win = Rows();  // release
+        });
+
+        // L21 = A21 U11^{-1}, by row tiles.
+        for (int64_t i = k+1; i < mt; ++i) {
+            graph.add( priority( k, true ),
+                       { key( k, k ) }, { key( i, k ) }, [=, &tile] {
+                blas::trsm( Layout::ColMajor, Side::Right, Uplo::Upper,
+                            Op::NoTrans, Diag::NonUnit, rows( i ), kb,
+                            one, tile( k, k ), lda, tile( i, k ), lda );
+            });
+        }
+
+        // Trailing columns: apply the swaps, U12 = L11^{-1} A12, then
+        // A22 -= L21 U12.
+        for (int64_t j = k+1; j < nt; ++j) {
+            std::vector< int64_t > col_keys;
+            for (int64_t i = k; i < mt; ++i)
+                col_keys.push_back( key( i, j ) );
+            graph.add( priority( j, false ),
+                       { key( k, k ) }, col_keys, [=, &tile] {
+                lapack::laswp( cols( j ), &A[ j*nb*lda ], lda,
+                               r0 + 1, r0 + kb, ipiv, 1 );
+                blas::trsm( Layout::ColMajor, Side::Left, Uplo::Lower,
+                            Op::NoTrans, Diag::Unit, kb, cols( j ),
+                            one, tile( k, k ), lda, tile( k, j ), lda );
+            });
+            for (int64_t i = k+1; i < mt; ++i) {
+                graph.add( priority( j, false ),
+                           { key( i, k ), key( k, j ) }, { key( i, j ) },
+                           [=, &tile] {
+                    blas::gemm( Layout::ColMajor, Op::NoTrans, Op::NoTrans,
+                                rows( i ), cols( j ), kb,
+                                -one, tile( i, k ), lda,
+                                      tile( k, j ), lda,
+                                 one, tile( i, j ), lda );
+                });
+            }
+        }
+    }
+    graph.run();
+
+    // Apply later panels' swaps to the columns of L left of them.
+    int64_t mn = min( m, n );
+    internal::parallel_for( kt - 1, 1, [&]( int64_t begin, int64_t end ) {
+        for (int64_t j = begin; j < end; ++j) {
+            lapack::laswp( cols( j ), &A[ j*nb*lda ], lda,
+                           (j + 1)*nb + 1, mn, ipiv, 1 );
+        }
+    });
+    return info.load();
+}
+
+}  // namespace impl
+
+//------------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getrf_parallel(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    int64_t* ipiv )
+{
+    return impl::getrf_parallel( m, n, A, lda, ipiv );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getrf_parallel(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    int64_t* ipiv )
+{
+    return impl::getrf_parallel( m, n, A, lda, ipiv );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getrf_parallel(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv )
+{
+    return impl::getrf_parallel( m, n, A, lda, ipiv );
+}
+
+//------------------------------------------------------------------------------
+/// Computes an LU factorization of a general m-by-n matrix A,
+/// $A = P L U,$ as lapack::getrf does, but with communication-avoiding
+/// tournament pivoting (CALU) and tile tasks run in parallel on the
+/// LAPACK++ thread pool (see lapack::set_num_threads). The result has
+/// the same format as lapack::getrf, so it can be passed unchanged to
+/// lapack::getrs, getri, or gecon.
+///
+/// A is split into nb-by-nb tiles, in place, with nb = 128, or 256 for
+/// min( m, n ) >= 4096. For each panel of nb columns, each row tile picks
+/// nb candidate pivot rows by partial pivoting, independently; pairs of
+/// candidate sets then play off in a binary tree, each round by partial
+/// pivoting on the 2nb stacked rows, and the final winners are the
+/// pivots. This replaces the column-by-column pivot search over the whole
+/// panel, which is latency bound, with independent tile factorizations.
+/// The panel then needs no further pivoting, and the trsm and gemm tile
+/// updates run as tasks, prioritized by column for lookahead, as in
+/// lapack::potrf_parallel.
+///
+/// The pivots, hence the factors, generally differ from getrf's. CALU
+/// is stable in practice, like partial pivoting, but its worst-case
+/// growth factor bound is larger; test_getrf --tiled y reports the
+/// growth max |U| / max |A| of both.
+/// If A has at most one tile row or column, this calls lapack::getrf.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] m
+///     The number of rows of the matrix A. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of the matrix A. n >= 0.
+///
+/// @param[in,out] A
+///     The m-by-n matrix A, stored in an lda-by-n array.
+///     On entry, the m-by-n matrix to be factored.
+///     On exit, the factors L and U from the factorization
+///     A = P*L*U; the unit diagonal elements of L are not stored.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,m).
+///
+/// @param[out] ipiv
+///     The vector ipiv of length min(m,n).
+///     The pivot indices; for 1 <= i <= min(m,n), row i of the
+///     matrix was interchanged with row ipiv(i).
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, U(i,i) is exactly zero. The
+///     factors are not usable to solve a system; unlike getrf,
+///     the entries of L below a zero pivot are not finite.
+///
+/// @ingroup gesv_computational
+int64_t getrf_parallel(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv )
+{
+    return impl::getrf_parallel( m, n, A, lda, ipiv );
+}
+
+}  // namespace lapack
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack_internal.hh"
 #include "lapack/fortran.h"
+#include "work_size_cache.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -18,44 +19,56 @@ using blas::real;
 
 // -----------------------------------------------------------------------------
 /// @ingroup gesv_computational
-int64_t getri(
+void getri_work_size(
     int64_t n,
     float* A, int64_t lda,
-    int64_t const* ipiv )
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "sgetri" );
+    internal::WorkSizeKey key( "sgetri", { n, lda } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( max( 1, (n) ) );
-        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
-        lapack_int const* ipiv_ptr = &ipiv_[0];
-    #else
-        lapack_int const* ipiv_ptr = ipiv;
-    #endif
     lapack_int info_ = 0;
 
     // query for workspace size
+    lapack_int qry_ipiv[1];
     float qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_sgetri(
         &n_,
         A, &lda_,
-        ipiv_ptr,
+        qry_ipiv,
         qry_work, &ineg_one, &info_ );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getri(
+    int64_t n,
+    float* A, int64_t lda,
+    lapack_int const* ipiv,
+    float* work, int64_t lwork )
+{
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_sgetri(
         &n_,
         A, &lda_,
-        ipiv_ptr,
-        &work[0], &lwork_, &info_ );
+        ipiv,
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -66,11 +79,10 @@ int64_t getri(
 /// @ingroup gesv_computational
 int64_t getri(
     int64_t n,
-    double* A, int64_t lda,
+    float* A, int64_t lda,
     int64_t const* ipiv )
 {
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int lda_ = to_lapack_int( lda );
+    internal::StatsScope stats_scope( "sgetri" );
     #ifndef LAPACK_ILP64
         // 32-bit copy
         lapack::vector< lapack_int > ipiv_( max( 1, (n) ) );
@@ -79,29 +91,72 @@ int64_t getri(
     #else
         lapack_int const* ipiv_ptr = ipiv;
     #endif
+
+    int64_t lwork;
+    getri_work_size(
+        n, A, lda,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return getri(
+        n, A, lda, ipiv_ptr,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void getri_work_size(
+    int64_t n,
+    double* A, int64_t lda,
+    int64_t* lwork )
+{
+    internal::StatsScope stats_scope( "dgetri" );
+    internal::WorkSizeKey key( "dgetri", { n, lda } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
 
     // query for workspace size
+    lapack_int qry_ipiv[1];
     double qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_dgetri(
         &n_,
         A, &lda_,
-        ipiv_ptr,
+        qry_ipiv,
         qry_work, &ineg_one, &info_ );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getri(
+    int64_t n,
+    double* A, int64_t lda,
+    lapack_int const* ipiv,
+    double* work, int64_t lwork )
+{
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_dgetri(
         &n_,
         A, &lda_,
-        ipiv_ptr,
-        &work[0], &lwork_, &info_ );
+        ipiv,
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -112,11 +167,10 @@ int64_t getri(
 /// @ingroup gesv_computational
 int64_t getri(
     int64_t n,
-    std::complex<float>* A, int64_t lda,
+    double* A, int64_t lda,
     int64_t const* ipiv )
 {
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int lda_ = to_lapack_int( lda );
+    internal::StatsScope stats_scope( "dgetri" );
     #ifndef LAPACK_ILP64
         // 32-bit copy
         lapack::vector< lapack_int > ipiv_( max( 1, (n) ) );
@@ -125,29 +179,179 @@ int64_t getri(
     #else
         lapack_int const* ipiv_ptr = ipiv;
     #endif
+
+    int64_t lwork;
+    getri_work_size(
+        n, A, lda,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return getri(
+        n, A, lda, ipiv_ptr,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void getri_work_size(
+    int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* lwork )
+{
+    internal::StatsScope stats_scope( "cgetri" );
+    internal::WorkSizeKey key( "cgetri", { n, lda } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
     lapack_int info_ = 0;
 
     // query for workspace size
+    lapack_int qry_ipiv[1];
     std::complex<float> qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_cgetri(
         &n_,
         (lapack_complex_float*) A, &lda_,
-        ipiv_ptr,
+        qry_ipiv,
         (lapack_complex_float*) qry_work, &ineg_one, &info_ );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getri(
+    int64_t n,
+    std::complex<float>* A, int64_t lda,
+    lapack_int const* ipiv,
+    std::complex<float>* work, int64_t lwork )
+{
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_cgetri(
         &n_,
         (lapack_complex_float*) A, &lda_,
-        ipiv_ptr,
-        (lapack_complex_float*) &work[0], &lwork_, &info_ );
+        ipiv,
+        (lapack_complex_float*) work, &lwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getri(
+    int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t const* ipiv )
+{
+    internal::StatsScope stats_scope( "cgetri" );
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack::vector< lapack_int > ipiv_( max( 1, (n) ) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
+        lapack_int const* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int const* ipiv_ptr = ipiv;
+    #endif
+
+    int64_t lwork;
+    getri_work_size(
+        n, A, lda,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+
+    return getri(
+        n, A, lda, ipiv_ptr,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::getri with caller-supplied workspace.
+/// Arguments are the same as for lapack::getri, without ipiv; the
+/// matrices are not modified. The sizes can be reused for any call of
+/// the same shape.
+///
+/// @param[out] lwork
+///     Required length of the work array.
+///
+/// @ingroup gesv_computational
+void getri_work_size(
+    int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* lwork )
+{
+    internal::StatsScope stats_scope( "zgetri" );
+    internal::WorkSizeKey key( "zgetri", { n, lda } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int info_ = 0;
+
+    // query for workspace size
+    lapack_int qry_ipiv[1];
+    std::complex<double> qry_work[1];
+    lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
+    LAPACK_zgetri(
+        &n_,
+        (lapack_complex_double*) A, &lda_,
+        qry_ipiv,
+        (lapack_complex_double*) qry_work, &ineg_one, &info_ );
+    query_timer.stop();
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::getri with caller-supplied workspace, which
+/// skips the internal workspace query and allocation. ipiv is in the
+/// native LAPACK integer type, lapack_int, so no pivot copy is needed
+/// either. Other arguments are the same as for lapack::getri.
+///
+/// @param[out] work
+///     Workspace of length lwork.
+///
+/// @param[in] lwork
+///     Length of work, at least as returned by lapack::getri_work_size.
+///
+/// @ingroup gesv_computational
+int64_t getri(
+    int64_t n,
+    std::complex<double>* A, int64_t lda,
+    lapack_int const* ipiv,
+    std::complex<double>* work, int64_t lwork )
+{
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
+
+    LAPACK_zgetri(
+        &n_,
+        (lapack_complex_double*) A, &lda_,
+        ipiv,
+        (lapack_complex_double*) work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -193,8 +397,7 @@ int64_t getri(
     std::complex<double>* A, int64_t lda,
     int64_t const* ipiv )
 {
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int lda_ = to_lapack_int( lda );
+    internal::StatsScope stats_scope( "zgetri" );
     #ifndef LAPACK_ILP64
         // 32-bit copy
         lapack::vector< lapack_int > ipiv_( max( 1, (n) ) );
@@ -203,33 +406,112 @@ int64_t getri(
     #else
         lapack_int const* ipiv_ptr = ipiv;
     #endif
-    lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgetri(
-        &n_,
-        (lapack_complex_double*) A, &lda_,
-        ipiv_ptr,
-        (lapack_complex_double*) qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork;
+    getri_work_size(
+        n, A, lda,
+        &lwork );
 
     // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+    lapack::vector< std::complex<double> > work( lwork );
 
-    LAPACK_zgetri(
-        &n_,
-        (lapack_complex_double*) A, &lda_,
-        ipiv_ptr,
-        (lapack_complex_double*) &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return getri(
+        n, A, lda, ipiv_ptr,
+        &work[0], lwork );
 }
 
+#ifndef LAPACK_ILP64
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getri(
+    int64_t n,
+    float* A, int64_t lda,
+    lapack_int const* ipiv )
+{
+    internal::StatsScope stats_scope( "sgetri" );
+    int64_t lwork;
+    getri_work_size(
+        n, A, lda,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return getri(
+        n, A, lda, ipiv,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getri(
+    int64_t n,
+    double* A, int64_t lda,
+    lapack_int const* ipiv )
+{
+    internal::StatsScope stats_scope( "dgetri" );
+    int64_t lwork;
+    getri_work_size(
+        n, A, lda,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return getri(
+        n, A, lda, ipiv,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getri(
+    int64_t n,
+    std::complex<float>* A, int64_t lda,
+    lapack_int const* ipiv )
+{
+    internal::StatsScope stats_scope( "cgetri" );
+    int64_t lwork;
+    getri_work_size(
+        n, A, lda,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+
+    return getri(
+        n, A, lda, ipiv,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::getri that takes ipiv in the native LAPACK integer
+/// type, lapack_int, instead of int64_t, which avoids allocating and
+/// copying a temporary pivot array. Available only when lapack_int is
+/// 32-bit, i.e., LAPACK_ILP64 is not defined; otherwise the int64_t
+/// version is already native.
+///
+/// @ingroup gesv_computational
+int64_t getri(
+    int64_t n,
+    std::complex<double>* A, int64_t lda,
+    lapack_int const* ipiv )
+{
+    internal::StatsScope stats_scope( "zgetri" );
+    int64_t lwork;
+    getri_work_size(
+        n, A, lda,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+
+    return getri(
+        n, A, lda, ipiv,
+        &work[0], lwork );
+}
+
+#endif  // LAPACK_ILP64
+
 }  // namespace lapack
@@ -0,0 +1,526 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "lapack/fortran.h"
+#include "NoConstructAllocator.hh"
+#include "batch_internal.hh"
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+//==============================================================================
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, float version.
+inline void getrs(
+    char trans, lapack_int n, lapack_int nrhs,
+    float const* A, lapack_int lda,
+    lapack_int const* ipiv,
+    float* B, lapack_int ldb, lapack_int* info )
+{
+    LAPACK_sgetrs(
+        &trans, &n, &nrhs, A, &lda, ipiv, B, &ldb, info );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, double version.
+inline void getrs(
+    char trans, lapack_int n, lapack_int nrhs,
+    double const* A, lapack_int lda,
+    lapack_int const* ipiv,
+    double* B, lapack_int ldb, lapack_int* info )
+{
+    LAPACK_dgetrs(
+        &trans, &n, &nrhs, A, &lda, ipiv, B, &ldb, info );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, complex<float> version.
+inline void getrs(
+    char trans, lapack_int n, lapack_int nrhs,
+    std::complex<float> const* A, lapack_int lda,
+    lapack_int const* ipiv,
+    std::complex<float>* B, lapack_int ldb, lapack_int* info )
+{
+    LAPACK_cgetrs(
+        &trans, &n, &nrhs, (lapack_complex_float const*) A, &lda, ipiv, (lapack_complex_float*) B, &ldb, info );
+}
+
+//------------------------------------------------------------------------------
+/// Low-level overload wrapper calls Fortran, complex<double> version.
+inline void getrs(
+    char trans, lapack_int n, lapack_int nrhs,
+    std::complex<double> const* A, lapack_int lda,
+    lapack_int const* ipiv,
+    std::complex<double>* B, lapack_int ldb, lapack_int* info )
+{
+    LAPACK_zgetrs(
+        &trans, &n, &nrhs, (lapack_complex_double const*) A, &lda, ipiv, (lapack_complex_double*) B, &ldb, info );
+}
+
+}  // namespace internal
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// One problem in a getrs batch.
+template <typename scalar_t>
+struct GetrsProblem
+{
+    lapack::Op trans;
+    int64_t n, nrhs;
+    scalar_t const* A;
+    int64_t lda;
+    int64_t const* ipiv;
+    scalar_t* B;
+    int64_t ldb;
+};
+
+//------------------------------------------------------------------------------
+/// Mid-level templated batch driver. problem( i ) returns the GetrsProblem
+/// for matrix i. Checks all arguments on the calling thread, then solves
+/// in parallel.
+/// @ingroup gesv_computational
+///
+template <typename scalar_t, typename problem_t>
+void getrs_batch( int64_t batch_size, problem_t const& problem )
+{
+    lapack_error_if( batch_size < 0 );
+
+    int64_t flops = 0;
+    for (int64_t i = 0; i < batch_size; ++i) {
+        GetrsProblem< scalar_t > p = problem( i );
+        lapack_error_if( p.trans != Op::NoTrans &&
+                         p.trans != Op::Trans &&
+                         p.trans != Op::ConjTrans );
+        lapack_error_if( p.n < 0 );
+        lapack_error_if( p.nrhs < 0 );
+        lapack_error_if( p.lda < max( 1, p.n ) );
+        lapack_error_if( p.ldb < max( 1, p.n ) );
+        to_lapack_int( p.nrhs );  // check for overflow
+        to_lapack_int( p.lda );
+        to_lapack_int( p.ldb );
+        flops += 2 * p.n * p.n * p.nrhs;
+    }
+    if (batch_size == 0)
+        return;
+
+    // Give each thread at least ~64K flops per range.
+    int64_t grain = (int64_t( 1 ) << 16) / max( 1, flops / batch_size );
+
+    internal::parallel_for( batch_size, grain, [&]( int64_t begin, int64_t end ) {
+        #ifndef LAPACK_ILP64
+            // 32-bit copy, reused for all matrices in this range
+            lapack::vector< lapack_int > ipiv_;
+        #endif
+        for (int64_t i = begin; i < end; ++i) {
+            GetrsProblem< scalar_t > p = problem( i );
+            char trans_ = to_char( p.trans );
+            lapack_int n_ = lapack_int( p.n );
+            lapack_int nrhs_ = lapack_int( p.nrhs );
+            lapack_int lda_ = lapack_int( p.lda );
+            lapack_int ldb_ = lapack_int( p.ldb );
+            #ifndef LAPACK_ILP64
+                if (int64_t( ipiv_.size() ) < max( 1, p.n ))
+                    ipiv_.resize( max( 1, p.n ) );
+                std::copy( &p.ipiv[0], &p.ipiv[ p.n ], ipiv_.begin() );
+                lapack_int const* ipiv_ptr = &ipiv_[0];
+            #else
+                lapack_int const* ipiv_ptr = p.ipiv;
+            #endif
+            lapack_int info_ = 0;
+
+            internal::getrs(
+                trans_, n_, nrhs_, p.A, lda_, ipiv_ptr, p.B, ldb_, &info_ );
+            if (info_ < 0) {
+                throw Error();
+            }
+        }
+    });
+}
+
+//------------------------------------------------------------------------------
+/// Pointer-array form.
+/// @ingroup gesv_computational
+///
+template <typename scalar_t>
+void getrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    scalar_t const* const* Aarray, int64_t lda,
+    int64_t const* const* ipiv_array,
+    scalar_t* const* Barray, int64_t ldb,
+    int64_t batch_size )
+{
+    getrs_batch< scalar_t >(
+        batch_size,
+        [&]( int64_t i ) {
+            return GetrsProblem< scalar_t >
+                { trans, n, nrhs, Aarray[ i ], lda, ipiv_array[ i ],
+                  Barray[ i ], ldb };
+        } );
+}
+
+//------------------------------------------------------------------------------
+/// Strided form.
+/// @ingroup gesv_computational
+///
+template <typename scalar_t>
+void getrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    scalar_t const* A, int64_t lda, int64_t strideA,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    scalar_t* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size )
+{
+    lapack_error_if( strideA < lda * n );
+    lapack_error_if( stride_ipiv < n );
+    lapack_error_if( strideB < ldb * nrhs );
+
+    getrs_batch< scalar_t >(
+        batch_size,
+        [&]( int64_t i ) {
+            return GetrsProblem< scalar_t >
+                { trans, n, nrhs, A + i*strideA, lda, ipiv + i*stride_ipiv,
+                  B + i*strideB, ldb };
+        } );
+}
+
+//------------------------------------------------------------------------------
+/// Group form.
+/// @ingroup gesv_computational
+///
+template <typename scalar_t>
+void getrs_batch(
+    int64_t group_count, int64_t const* group_size,
+    lapack::Op const* trans, int64_t const* n, int64_t const* nrhs,
+    scalar_t const* const* Aarray, int64_t const* lda,
+    int64_t const* const* ipiv_array,
+    scalar_t* const* Barray, int64_t const* ldb )
+{
+    internal::BatchGroups groups( group_count, group_size );
+    getrs_batch< scalar_t >(
+        groups.batch_size(),
+        [&]( int64_t i ) {
+            int64_t g = groups.group( i );
+            return GetrsProblem< scalar_t >
+                { trans[ g ], n[ g ], nrhs[ g ], Aarray[ i ], lda[ g ],
+                  ipiv_array[ i ], Barray[ i ], ldb[ g ] };
+        } );
+}
+
+}  // namespace impl
+
+//------------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void getrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    float const* const* Aarray, int64_t lda,
+    int64_t const* const* ipiv_array,
+    float* const* Barray, int64_t ldb,
+    int64_t batch_size )
+{
+    impl::getrs_batch(
+        trans, n, nrhs, Aarray, lda, ipiv_array, Barray, ldb, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void getrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    double const* const* Aarray, int64_t lda,
+    int64_t const* const* ipiv_array,
+    double* const* Barray, int64_t ldb,
+    int64_t batch_size )
+{
+    impl::getrs_batch(
+        trans, n, nrhs, Aarray, lda, ipiv_array, Barray, ldb, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void getrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<float> const* const* Aarray, int64_t lda,
+    int64_t const* const* ipiv_array,
+    std::complex<float>* const* Barray, int64_t ldb,
+    int64_t batch_size )
+{
+    impl::getrs_batch(
+        trans, n, nrhs, Aarray, lda, ipiv_array, Barray, ldb, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// Solves a batch of systems of linear equations, in parallel,
+/// \[
+///     A_i X_i = B_i,
+///     \quad A_i^T X_i = B_i,
+///     \quad \text{or} \quad A_i^H X_i = B_i,
+/// \]
+/// with general n-by-n matrices A_i, using the LU factorizations computed
+/// by lapack::getrf_batch or lapack::getrf. Pointer-array form: all
+/// systems have the same size and leading dimensions.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] trans
+///     The form of the systems of equations:
+///     - lapack::Op::NoTrans:   $A_i   X_i = B_i$ (No transpose)
+///     - lapack::Op::Trans:     $A_i^T X_i = B_i$ (Transpose)
+///     - lapack::Op::ConjTrans: $A_i^H X_i = B_i$ (Conjugate transpose)
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides, i.e., the number of columns
+///     of each matrix B_i. nrhs >= 0.
+///
+/// @param[in] Aarray
+///     Array of batch_size pointers. Each A_i is an lda-by-n array
+///     holding the factors L_i and U_i from lapack::getrf_batch.
+///
+/// @param[in] lda
+///     The leading dimension of each A_i. lda >= max(1,n).
+///
+/// @param[in] ipiv_array
+///     Array of batch_size pointers. Each ipiv_i is the pivot vector of
+///     length n from lapack::getrf_batch.
+///
+/// @param[in,out] Barray
+///     Array of batch_size pointers. Each B_i is an ldb-by-nrhs array.
+///     On entry, the right hand side matrix B_i.
+///     On exit, the solution matrix X_i.
+///
+/// @param[in] ldb
+///     The leading dimension of each B_i. ldb >= max(1,n).
+///
+/// @param[in] batch_size
+///     The number of systems. batch_size >= 0.
+///
+/// @ingroup gesv_computational
+void getrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<double> const* const* Aarray, int64_t lda,
+    int64_t const* const* ipiv_array,
+    std::complex<double>* const* Barray, int64_t ldb,
+    int64_t batch_size )
+{
+    impl::getrs_batch(
+        trans, n, nrhs, Aarray, lda, ipiv_array, Barray, ldb, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void getrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda, int64_t strideA,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    float* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size )
+{
+    impl::getrs_batch(
+        trans, n, nrhs, A, lda, strideA, ipiv, stride_ipiv,
+        B, ldb, strideB, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void getrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda, int64_t strideA,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    double* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size )
+{
+    impl::getrs_batch(
+        trans, n, nrhs, A, lda, strideA, ipiv, stride_ipiv,
+        B, ldb, strideB, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void getrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda, int64_t strideA,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size )
+{
+    impl::getrs_batch(
+        trans, n, nrhs, A, lda, strideA, ipiv, stride_ipiv,
+        B, ldb, strideB, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// Solves a batch of systems of linear equations, in parallel, using LU
+/// factorizations; strided form. A_i, ipiv_i, and B_i start at
+/// A + i*strideA, ipiv + i*stride_ipiv, and B + i*strideB.
+/// See the pointer-array form of lapack::getrs_batch for details.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] trans
+///     The form of the systems of equations; see lapack::getrs.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of columns of each matrix B_i. nrhs >= 0.
+///
+/// @param[in] A
+///     The batch_size factored matrices A_i, each lda-by-n, strideA apart.
+///
+/// @param[in] lda
+///     The leading dimension of each A_i. lda >= max(1,n).
+///
+/// @param[in] strideA
+///     Distance between the starts of A_i and A_{i+1}. strideA >= lda*n.
+///
+/// @param[in] ipiv
+///     The batch_size pivot vectors, each of length n, stride_ipiv apart.
+///
+/// @param[in] stride_ipiv
+///     Distance between the starts of ipiv_i and ipiv_{i+1}.
+///     stride_ipiv >= n.
+///
+/// @param[in,out] B
+///     The batch_size matrices B_i, each ldb-by-nrhs, strideB apart.
+///     On exit, the solutions X_i.
+///
+/// @param[in] ldb
+///     The leading dimension of each B_i. ldb >= max(1,n).
+///
+/// @param[in] strideB
+///     Distance between the starts of B_i and B_{i+1}. strideB >= ldb*nrhs.
+///
+/// @param[in] batch_size
+///     The number of systems. batch_size >= 0.
+///
+/// @ingroup gesv_computational
+void getrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda, int64_t strideA,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size )
+{
+    impl::getrs_batch(
+        trans, n, nrhs, A, lda, strideA, ipiv, stride_ipiv,
+        B, ldb, strideB, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void getrs_batch(
+    int64_t group_count, int64_t const* group_size,
+    lapack::Op const* trans, int64_t const* n, int64_t const* nrhs,
+    float const* const* Aarray, int64_t const* lda,
+    int64_t const* const* ipiv_array,
+    float* const* Barray, int64_t const* ldb )
+{
+    impl::getrs_batch(
+        group_count, group_size, trans, n, nrhs,
+        Aarray, lda, ipiv_array, Barray, ldb );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void getrs_batch(
+    int64_t group_count, int64_t const* group_size,
+    lapack::Op const* trans, int64_t const* n, int64_t const* nrhs,
+    double const* const* Aarray, int64_t const* lda,
+    int64_t const* const* ipiv_array,
+    double* const* Barray, int64_t const* ldb )
+{
+    impl::getrs_batch(
+        group_count, group_size, trans, n, nrhs,
+        Aarray, lda, ipiv_array, Barray, ldb );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void getrs_batch(
+    int64_t group_count, int64_t const* group_size,
+    lapack::Op const* trans, int64_t const* n, int64_t const* nrhs,
+    std::complex<float> const* const* Aarray, int64_t const* lda,
+    int64_t const* const* ipiv_array,
+    std::complex<float>* const* Barray, int64_t const* ldb )
+{
+    impl::getrs_batch(
+        group_count, group_size, trans, n, nrhs,
+        Aarray, lda, ipiv_array, Barray, ldb );
+}
+
+//------------------------------------------------------------------------------
+/// Solves a batch of systems of linear equations, in parallel, using LU
+/// factorizations; group form with variable sizes. Group g has
+/// group_size[g] systems, each with trans[g], n[g], nrhs[g], lda[g],
+/// and ldb[g]. The systems of all groups are listed consecutively in
+/// Aarray, ipiv_array, and Barray, starting with group 0.
+/// See the pointer-array form of lapack::getrs_batch for details.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] group_count
+///     The number of groups. group_count >= 0.
+///
+/// @param[in] group_size
+///     The vector group_size of length group_count.
+///     The number of systems in each group. group_size[g] >= 0.
+///
+/// @param[in] trans
+///     The vector trans of length group_count.
+///     The form of the systems in each group; see lapack::getrs.
+///
+/// @param[in] n
+///     The vector n of length group_count.
+///     The order of matrices A_i in each group. n[g] >= 0.
+///
+/// @param[in] nrhs
+///     The vector nrhs of length group_count.
+///     The number of columns of matrices B_i in each group. nrhs[g] >= 0.
+///
+/// @param[in] Aarray
+///     Array of sum( group_size ) pointers to the factored matrices A_i.
+///
+/// @param[in] lda
+///     The vector lda of length group_count.
+///     The leading dimension of A_i in each group. lda[g] >= max(1,n[g]).
+///
+/// @param[in] ipiv_array
+///     Array of sum( group_size ) pointers to the pivot vectors ipiv_i.
+///
+/// @param[in,out] Barray
+///     Array of sum( group_size ) pointers to the matrices B_i.
+///     On exit, the solutions X_i.
+///
+/// @param[in] ldb
+///     The vector ldb of length group_count.
+///     The leading dimension of B_i in each group. ldb[g] >= max(1,n[g]).
+///
+/// @ingroup gesv_computational
+void getrs_batch(
+    int64_t group_count, int64_t const* group_size,
+    lapack::Op const* trans, int64_t const* n, int64_t const* nrhs,
+    std::complex<double> const* const* Aarray, int64_t const* lda,
+    int64_t const* const* ipiv_array,
+    std::complex<double>* const* Barray, int64_t const* ldb )
+{
+    impl::getrs_batch(
+        group_count, group_size, trans, n, nrhs,
+        Aarray, lda, ipiv_array, Barray, ldb );
+}
+
+}  // namespace lapack
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack_internal.hh"
 #include "lapack/fortran.h"
+#include "work_size_cache.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7
@@ -19,11 +20,17 @@ using blas::min;
 using blas::real;
 
 // -----------------------------------------------------------------------------
-int64_t getsls(
+void getsls_work_size(
     lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
     float* A, int64_t lda,
-    float* B, int64_t ldb )
+    float* B, int64_t ldb,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "sgetsls" );
+    internal::WorkSizeKey key( "sgetsls", { to_char( trans ), m, n, nrhs, lda, ldb } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
         trans = Op::Trans;
@@ -39,12 +46,14 @@ int64_t getsls(
     // query for workspace size
     float qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_sgetsls(
         &trans_, &m_, &n_, &nrhs_,
         A, &lda_,
         B, &ldb_,
         qry_work, &ineg_one, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
@@ -63,14 +72,35 @@ int64_t getsls(
     }
     lwork_ = max( lwork_, real(qry_work[0]) );
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    *lwork = lwork_;
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t getsls(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* work, int64_t lwork )
+{
+    // for real, map ConjTrans to Trans
+    if (trans == Op::ConjTrans)
+        trans = Op::Trans;
+
+    char trans_ = to_char( trans );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_sgetsls(
         &trans_, &m_, &n_, &nrhs_,
         A, &lda_,
         B, &ldb_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -80,10 +110,36 @@ int64_t getsls(
 
 // -----------------------------------------------------------------------------
 int64_t getsls(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb )
+{
+    internal::StatsScope stats_scope( "sgetsls" );
+    int64_t lwork;
+    getsls_work_size(
+        trans, m, n, nrhs, A, lda, B, ldb,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return getsls(
+        trans, m, n, nrhs, A, lda, B, ldb,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+void getsls_work_size(
     lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
     double* A, int64_t lda,
-    double* B, int64_t ldb )
+    double* B, int64_t ldb,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "dgetsls" );
+    internal::WorkSizeKey key( "dgetsls", { to_char( trans ), m, n, nrhs, lda, ldb } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
         trans = Op::Trans;
@@ -99,12 +155,14 @@ int64_t getsls(
     // query for workspace size
     double qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_dgetsls(
         &trans_, &m_, &n_, &nrhs_,
         A, &lda_,
         B, &ldb_,
         qry_work, &ineg_one, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
@@ -123,14 +181,35 @@ int64_t getsls(
     }
     lwork_ = max( lwork_, real(qry_work[0]) );
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    *lwork = lwork_;
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t getsls(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* work, int64_t lwork )
+{
+    // for real, map ConjTrans to Trans
+    if (trans == Op::ConjTrans)
+        trans = Op::Trans;
+
+    char trans_ = to_char( trans );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_dgetsls(
         &trans_, &m_, &n_, &nrhs_,
         A, &lda_,
         B, &ldb_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -140,10 +219,36 @@ int64_t getsls(
 
 // -----------------------------------------------------------------------------
 int64_t getsls(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb )
+{
+    internal::StatsScope stats_scope( "dgetsls" );
+    int64_t lwork;
+    getsls_work_size(
+        trans, m, n, nrhs, A, lda, B, ldb,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return getsls(
+        trans, m, n, nrhs, A, lda, B, ldb,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+void getsls_work_size(
     lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
     std::complex<float>* A, int64_t lda,
-    std::complex<float>* B, int64_t ldb )
+    std::complex<float>* B, int64_t ldb,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "cgetsls" );
+    internal::WorkSizeKey key( "cgetsls", { to_char( trans ), m, n, nrhs, lda, ldb } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     char trans_ = to_char( trans );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -155,12 +260,14 @@ int64_t getsls(
     // query for workspace size
     std::complex<float> qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_cgetsls(
         &trans_, &m_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
         (lapack_complex_float*) B, &ldb_,
         (lapack_complex_float*) qry_work, &ineg_one, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
@@ -179,14 +286,31 @@ int64_t getsls(
     }
     lwork_ = max( lwork_, real(qry_work[0]) );
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+    *lwork = lwork_;
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t getsls(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* work, int64_t lwork )
+{
+    char trans_ = to_char( trans );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_cgetsls(
         &trans_, &m_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
         (lapack_complex_float*) B, &ldb_,
-        (lapack_complex_float*) &work[0], &lwork_, &info_
+        (lapack_complex_float*) work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -196,10 +320,43 @@ int64_t getsls(
 
 // -----------------------------------------------------------------------------
 int64_t getsls(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb )
+{
+    internal::StatsScope stats_scope( "cgetsls" );
+    int64_t lwork;
+    getsls_work_size(
+        trans, m, n, nrhs, A, lda, B, ldb,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+
+    return getsls(
+        trans, m, n, nrhs, A, lda, B, ldb,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::getsls with caller-supplied workspace.
+/// Arguments are the same as for lapack::getsls; the matrices are not
+/// modified. The sizes can be reused for any call of the same shape.
+///
+/// @param[out] lwork
+///     Required length of the work array.
+///
+void getsls_work_size(
     lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
     std::complex<double>* A, int64_t lda,
-    std::complex<double>* B, int64_t ldb )
+    std::complex<double>* B, int64_t ldb,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "zgetsls" );
+    internal::WorkSizeKey key( "zgetsls", { to_char( trans ), m, n, nrhs, lda, ldb } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     char trans_ = to_char( trans );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -211,12 +368,14 @@ int64_t getsls(
     // query for workspace size
     std::complex<double> qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_zgetsls(
         &trans_, &m_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
         (lapack_complex_double*) B, &ldb_,
         (lapack_complex_double*) qry_work, &ineg_one, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
@@ -235,14 +394,41 @@ int64_t getsls(
     }
     lwork_ = max( lwork_, real(qry_work[0]) );
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+    *lwork = lwork_;
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::getsls with caller-supplied workspace, which
+/// skips the internal workspace query and allocation. Other arguments
+/// are the same as for lapack::getsls.
+///
+/// @param[out] work
+///     Workspace of length lwork.
+///
+/// @param[in] lwork
+///     Length of work, at least as returned by lapack::getsls_work_size.
+///
+int64_t getsls(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* work, int64_t lwork )
+{
+    char trans_ = to_char( trans );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_zgetsls(
         &trans_, &m_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
         (lapack_complex_double*) B, &ldb_,
-        (lapack_complex_double*) &work[0], &lwork_, &info_
+        (lapack_complex_double*) work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -250,6 +436,26 @@ int64_t getsls(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+int64_t getsls(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb )
+{
+    internal::StatsScope stats_scope( "zgetsls" );
+    int64_t lwork;
+    getsls_work_size(
+        trans, m, n, nrhs, A, lda, B, ldb,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+
+    return getsls(
+        trans, m, n, nrhs, A, lda, B, ldb,
+        &work[0], lwork );
+}
+
 }  // namespace lapack
 
 #endif  // LAPACK >= 3.7
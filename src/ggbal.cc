@@ -26,6 +26,7 @@ int64_t ggbal(
     float* lscale,
     float* rscale )
 {
+    internal::StatsScope stats_scope( "sggbal" );
     char balance_ = to_char( balance );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -66,6 +67,7 @@ int64_t ggbal(
     double* lscale,
     double* rscale )
 {
+    internal::StatsScope stats_scope( "dggbal" );
     char balance_ = to_char( balance );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -106,6 +108,7 @@ int64_t ggbal(
     float* lscale,
     float* rscale )
 {
+    internal::StatsScope stats_scope( "cggbal" );
     char balance_ = to_char( balance );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -146,6 +149,7 @@ int64_t ggbal(
     double* lscale,
     double* rscale )
 {
+    internal::StatsScope stats_scope( "zggbal" );
     char balance_ = to_char( balance );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack_internal.hh"
 #include "lapack/fortran.h"
+#include "work_size_cache.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30600  // >= v3.6
@@ -19,7 +20,7 @@ using blas::min;
 using blas::real;
 
 // -----------------------------------------------------------------------------
-int64_t gges3(
+void gges3_work_size(
     lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
     lapack_s_select3 select, int64_t n,
     float* A, int64_t lda,
@@ -28,8 +29,16 @@ int64_t gges3(
     std::complex<float>* alpha,
     float* beta,
     float* VSL, int64_t ldvsl,
-    float* VSR, int64_t ldvsr )
+    float* VSR, int64_t ldvsr,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "sgges3" );
+    internal::WorkSizeKey key( "sgges3",
+        { to_char( jobvsl ), to_char( jobvsr ), to_char( sort ), n, lda, ldb,
+          ldvsl, ldvsr } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     char jobvsl_ = to_char( jobvsl );
     char jobvsr_ = to_char( jobvsr );
     char sort_ = to_char( sort );
@@ -49,6 +58,7 @@ int64_t gges3(
     float qry_work[1];
     lapack_int qry_bwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_sgges3(
         &jobvsl_, &jobvsr_, &sort_,
         select, &n_,
@@ -62,13 +72,44 @@ int64_t gges3(
         qry_work, &ineg_one,
         qry_bwork, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gges3(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_s_select3 select, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<float>* alpha,
+    float* beta,
+    float* VSL, int64_t ldvsl,
+    float* VSR, int64_t ldvsr,
+    float* work, int64_t lwork )
+{
+    char jobvsl_ = to_char( jobvsl );
+    char jobvsr_ = to_char( jobvsr );
+    char sort_ = to_char( sort );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int sdim_ = 0;  // out
+    lapack_int ldvsl_ = to_lapack_int( ldvsl );
+    lapack_int ldvsr_ = to_lapack_int( ldvsr );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
+
+    // split-complex representation
+    lapack::vector< float > alphar( max( 1, n ) );
+    lapack::vector< float > alphai( max( 1, n ) );
 
     // allocate workspace
-    lapack::vector< float > work( lwork_ );
     lapack::vector< lapack_int > bwork( (n) );
 
     LAPACK_sgges3(
@@ -81,7 +122,7 @@ int64_t gges3(
         beta,
         VSL, &ldvsl_,
         VSR, &ldvsr_,
-        &work[0], &lwork_,
+        work, &lwork_,
         &bwork[0], &info_
     );
     if (info_ < 0) {
@@ -97,6 +138,34 @@ int64_t gges3(
 
 // -----------------------------------------------------------------------------
 int64_t gges3(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_s_select3 select, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<float>* alpha,
+    float* beta,
+    float* VSL, int64_t ldvsl,
+    float* VSR, int64_t ldvsr )
+{
+    internal::StatsScope stats_scope( "sgges3" );
+    int64_t lwork;
+    gges3_work_size(
+        jobvsl, jobvsr, sort, select, n, A, lda, B, ldb, sdim, alpha, beta,
+        VSL, ldvsl, VSR, ldvsr,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return gges3(
+        jobvsl, jobvsr, sort, select, n, A, lda, B, ldb, sdim, alpha, beta,
+        VSL, ldvsl, VSR, ldvsr,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+void gges3_work_size(
     lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
     lapack_d_select3 select, int64_t n,
     double* A, int64_t lda,
@@ -105,8 +174,16 @@ int64_t gges3(
     std::complex<double>* alpha,
     double* beta,
     double* VSL, int64_t ldvsl,
-    double* VSR, int64_t ldvsr )
+    double* VSR, int64_t ldvsr,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "dgges3" );
+    internal::WorkSizeKey key( "dgges3",
+        { to_char( jobvsl ), to_char( jobvsr ), to_char( sort ), n, lda, ldb,
+          ldvsl, ldvsr } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     char jobvsl_ = to_char( jobvsl );
     char jobvsr_ = to_char( jobvsr );
     char sort_ = to_char( sort );
@@ -126,6 +203,7 @@ int64_t gges3(
     double qry_work[1];
     lapack_int qry_bwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_dgges3(
         &jobvsl_, &jobvsr_, &sort_,
         select, &n_,
@@ -139,13 +217,44 @@ int64_t gges3(
         qry_work, &ineg_one,
         qry_bwork, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gges3(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_d_select3 select, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<double>* alpha,
+    double* beta,
+    double* VSL, int64_t ldvsl,
+    double* VSR, int64_t ldvsr,
+    double* work, int64_t lwork )
+{
+    char jobvsl_ = to_char( jobvsl );
+    char jobvsr_ = to_char( jobvsr );
+    char sort_ = to_char( sort );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int sdim_ = 0;  // out
+    lapack_int ldvsl_ = to_lapack_int( ldvsl );
+    lapack_int ldvsr_ = to_lapack_int( ldvsr );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
+
+    // split-complex representation
+    lapack::vector< double > alphar( max( 1, n ) );
+    lapack::vector< double > alphai( max( 1, n ) );
 
     // allocate workspace
-    lapack::vector< double > work( lwork_ );
     lapack::vector< lapack_int > bwork( (n) );
 
     LAPACK_dgges3(
@@ -158,7 +267,7 @@ int64_t gges3(
         beta,
         VSL, &ldvsl_,
         VSR, &ldvsr_,
-        &work[0], &lwork_,
+        work, &lwork_,
         &bwork[0], &info_
     );
     if (info_ < 0) {
@@ -174,6 +283,34 @@ int64_t gges3(
 
 // -----------------------------------------------------------------------------
 int64_t gges3(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_d_select3 select, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<double>* alpha,
+    double* beta,
+    double* VSL, int64_t ldvsl,
+    double* VSR, int64_t ldvsr )
+{
+    internal::StatsScope stats_scope( "dgges3" );
+    int64_t lwork;
+    gges3_work_size(
+        jobvsl, jobvsr, sort, select, n, A, lda, B, ldb, sdim, alpha, beta,
+        VSL, ldvsl, VSR, ldvsr,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return gges3(
+        jobvsl, jobvsr, sort, select, n, A, lda, B, ldb, sdim, alpha, beta,
+        VSL, ldvsl, VSR, ldvsr,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+void gges3_work_size(
     lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
     lapack_c_select2 select, int64_t n,
     std::complex<float>* A, int64_t lda,
@@ -182,8 +319,17 @@ int64_t gges3(
     std::complex<float>* alpha,
     std::complex<float>* beta,
     std::complex<float>* VSL, int64_t ldvsl,
-    std::complex<float>* VSR, int64_t ldvsr )
+    std::complex<float>* VSR, int64_t ldvsr,
+    int64_t* lwork,
+    int64_t* lrwork )
 {
+    internal::StatsScope stats_scope( "cgges3" );
+    internal::WorkSizeKey key( "cgges3",
+        { to_char( jobvsl ), to_char( jobvsr ), to_char( sort ), n, lda, ldb,
+          ldvsl, ldvsr } );
+    if (internal::work_size_cache_find( key, lwork, lrwork ))
+        return;
+
     char jobvsl_ = to_char( jobvsl );
     char jobvsr_ = to_char( jobvsr );
     char sort_ = to_char( sort );
@@ -200,6 +346,7 @@ int64_t gges3(
     float qry_rwork[1];
     lapack_int qry_bwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_cgges3(
         &jobvsl_, &jobvsr_, &sort_,
         (LAPACK_C_SELECT2) select, &n_,
@@ -213,14 +360,43 @@ int64_t gges3(
         qry_rwork,
         qry_bwork, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    *lrwork = 8*n;
+    internal::work_size_cache_insert( key, *lwork, *lrwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gges3(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_c_select2 select, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* VSL, int64_t ldvsl,
+    std::complex<float>* VSR, int64_t ldvsr,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork )
+{
+    char jobvsl_ = to_char( jobvsl );
+    char jobvsr_ = to_char( jobvsr );
+    char sort_ = to_char( sort );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int sdim_ = 0;  // out
+    lapack_int ldvsl_ = to_lapack_int( ldvsl );
+    lapack_int ldvsr_ = to_lapack_int( ldvsr );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( lrwork < 8*n );
+    lapack_int info_ = 0;
 
     // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (8*n) );
     lapack::vector< lapack_int > bwork( (n) );
 
     LAPACK_cgges3(
@@ -232,8 +408,8 @@ int64_t gges3(
         (lapack_complex_float*) beta,
         (lapack_complex_float*) VSL, &ldvsl_,
         (lapack_complex_float*) VSR, &ldvsr_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0],
+        (lapack_complex_float*) work, &lwork_,
+        rwork,
         &bwork[0], &info_
     );
     if (info_ < 0) {
@@ -245,6 +421,45 @@ int64_t gges3(
 
 // -----------------------------------------------------------------------------
 int64_t gges3(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_c_select2 select, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* VSL, int64_t ldvsl,
+    std::complex<float>* VSR, int64_t ldvsr )
+{
+    internal::StatsScope stats_scope( "cgges3" );
+    int64_t lwork, lrwork;
+    gges3_work_size(
+        jobvsl, jobvsr, sort, select, n, A, lda, B, ldb, sdim, alpha, beta,
+        VSL, ldvsl, VSR, ldvsr,
+        &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+
+    return gges3(
+        jobvsl, jobvsr, sort, select, n, A, lda, B, ldb, sdim, alpha, beta,
+        VSL, ldvsl, VSR, ldvsr,
+        &work[0], lwork, &rwork[0], lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::gges3 with caller-supplied workspace.
+/// Arguments are the same as for lapack::gges3; the matrices are not
+/// modified. The sizes can be reused for any call of the same shape.
+///
+/// @param[out] lwork
+///     Required length of the work array.
+///
+/// @param[out] lrwork
+///     Required length of the rwork array.
+///
+void gges3_work_size(
     lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
     lapack_z_select2 select, int64_t n,
     std::complex<double>* A, int64_t lda,
@@ -253,8 +468,17 @@ int64_t gges3(
     std::complex<double>* alpha,
     std::complex<double>* beta,
     std::complex<double>* VSL, int64_t ldvsl,
-    std::complex<double>* VSR, int64_t ldvsr )
+    std::complex<double>* VSR, int64_t ldvsr,
+    int64_t* lwork,
+    int64_t* lrwork )
 {
+    internal::StatsScope stats_scope( "zgges3" );
+    internal::WorkSizeKey key( "zgges3",
+        { to_char( jobvsl ), to_char( jobvsr ), to_char( sort ), n, lda, ldb,
+          ldvsl, ldvsr } );
+    if (internal::work_size_cache_find( key, lwork, lrwork ))
+        return;
+
     char jobvsl_ = to_char( jobvsl );
     char jobvsr_ = to_char( jobvsr );
     char sort_ = to_char( sort );
@@ -271,6 +495,7 @@ int64_t gges3(
     double qry_rwork[1];
     lapack_int qry_bwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_zgges3(
         &jobvsl_, &jobvsr_, &sort_,
         (LAPACK_Z_SELECT2) select, &n_,
@@ -284,14 +509,59 @@ int64_t gges3(
         qry_rwork,
         qry_bwork, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    *lrwork = 8*n;
+    internal::work_size_cache_insert( key, *lwork, *lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::gges3 with caller-supplied workspace, which
+/// skips the internal workspace query and allocation. Other arguments
+/// are the same as for lapack::gges3.
+///
+/// @param[out] work
+///     Workspace of length lwork.
+///
+/// @param[in] lwork
+///     Length of work, at least as returned by lapack::gges3_work_size.
+///
+/// @param[out] rwork
+///     Workspace of length lrwork.
+///
+/// @param[in] lrwork
+///     Length of rwork, at least as returned by lapack::gges3_work_size.
+///
+int64_t gges3(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_z_select2 select, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* VSL, int64_t ldvsl,
+    std::complex<double>* VSR, int64_t ldvsr,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork )
+{
+    char jobvsl_ = to_char( jobvsl );
+    char jobvsr_ = to_char( jobvsr );
+    char sort_ = to_char( sort );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int sdim_ = 0;  // out
+    lapack_int ldvsl_ = to_lapack_int( ldvsl );
+    lapack_int ldvsr_ = to_lapack_int( ldvsr );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( lrwork < 8*n );
+    lapack_int info_ = 0;
 
     // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (8*n) );
     lapack::vector< lapack_int > bwork( (n) );
 
     LAPACK_zgges3(
@@ -303,8 +573,8 @@ int64_t gges3(
         (lapack_complex_double*) beta,
         (lapack_complex_double*) VSL, &ldvsl_,
         (lapack_complex_double*) VSR, &ldvsr_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0],
+        (lapack_complex_double*) work, &lwork_,
+        rwork,
         &bwork[0], &info_
     );
     if (info_ < 0) {
@@ -314,6 +584,35 @@ int64_t gges3(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+int64_t gges3(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_z_select2 select, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* VSL, int64_t ldvsl,
+    std::complex<double>* VSR, int64_t ldvsr )
+{
+    internal::StatsScope stats_scope( "zgges3" );
+    int64_t lwork, lrwork;
+    gges3_work_size(
+        jobvsl, jobvsr, sort, select, n, A, lda, B, ldb, sdim, alpha, beta,
+        VSL, ldvsl, VSR, ldvsr,
+        &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+
+    return gges3(
+        jobvsl, jobvsr, sort, select, n, A, lda, B, ldb, sdim, alpha, beta,
+        VSL, ldvsl, VSR, ldvsr,
+        &work[0], lwork, &rwork[0], lrwork );
+}
+
 }  // namespace lapack
 
 #endif  // LAPACK >= v3.6
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack_internal.hh"
 #include "lapack/fortran.h"
+#include "work_size_cache.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -17,7 +18,7 @@ using blas::min;
 using blas::real;
 
 // -----------------------------------------------------------------------------
-int64_t ggesx(
+void ggesx_work_size(
     lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
     lapack_s_select3 select, lapack::Sense sense, int64_t n,
     float* A, int64_t lda,
@@ -28,8 +29,17 @@ int64_t ggesx(
     float* VSL, int64_t ldvsl,
     float* VSR, int64_t ldvsr,
     float* rconde,
-    float* rcondv )
+    float* rcondv,
+    int64_t* lwork,
+    int64_t* liwork )
 {
+    internal::StatsScope stats_scope( "sggesx" );
+    internal::WorkSizeKey key( "sggesx",
+        { to_char( jobvsl ), to_char( jobvsr ), to_char( sort ),
+          to_char( sense ), n, lda, ldb, ldvsl, ldvsr } );
+    if (internal::work_size_cache_find( key, lwork, nullptr, liwork ))
+        return;
+
     char jobvsl_ = to_char( jobvsl );
     char jobvsr_ = to_char( jobvsr );
     char sort_ = to_char( sort );
@@ -51,6 +61,7 @@ int64_t ggesx(
     lapack_int qry_iwork[1];
     lapack_int qry_bwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_sggesx(
         &jobvsl_, &jobvsr_, &sort_,
         select, &sense_, &n_,
@@ -67,15 +78,50 @@ int64_t ggesx(
         qry_iwork, &ineg_one,
         qry_bwork, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    *lwork = real(qry_work[0]);
+    *liwork = real(qry_iwork[0]);
+    internal::work_size_cache_insert( key, *lwork, 0, *liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggesx(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_s_select3 select, lapack::Sense sense, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<float>* alpha,
+    float* beta,
+    float* VSL, int64_t ldvsl,
+    float* VSR, int64_t ldvsr,
+    float* rconde,
+    float* rcondv,
+    float* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    char jobvsl_ = to_char( jobvsl );
+    char jobvsr_ = to_char( jobvsr );
+    char sort_ = to_char( sort );
+    char sense_ = to_char( sense );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int sdim_ = 0;  // out
+    lapack_int ldvsl_ = to_lapack_int( ldvsl );
+    lapack_int ldvsr_ = to_lapack_int( ldvsr );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int liwork_ = to_lapack_int( liwork );
+    lapack_int info_ = 0;
+
+    // split-complex representation
+    lapack::vector< float > alphar( max( 1, n ) );
+    lapack::vector< float > alphai( max( 1, n ) );
 
     // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
     lapack::vector< lapack_int > bwork( (n) );
 
     LAPACK_sggesx(
@@ -90,8 +136,8 @@ int64_t ggesx(
         VSR, &ldvsr_,
         rconde,
         rcondv,
-        &work[0], &lwork_,
-        &iwork[0], &liwork_,
+        work, &lwork_,
+        iwork, &liwork_,
         &bwork[0], &info_
     );
     if (info_ < 0) {
@@ -107,6 +153,37 @@ int64_t ggesx(
 
 // -----------------------------------------------------------------------------
 int64_t ggesx(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_s_select3 select, lapack::Sense sense, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<float>* alpha,
+    float* beta,
+    float* VSL, int64_t ldvsl,
+    float* VSR, int64_t ldvsr,
+    float* rconde,
+    float* rcondv )
+{
+    internal::StatsScope stats_scope( "sggesx" );
+    int64_t lwork, liwork;
+    ggesx_work_size(
+        jobvsl, jobvsr, sort, select, sense, n, A, lda, B, ldb, sdim, alpha,
+        beta, VSL, ldvsl, VSR, ldvsr, rconde, rcondv,
+        &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return ggesx(
+        jobvsl, jobvsr, sort, select, sense, n, A, lda, B, ldb, sdim, alpha,
+        beta, VSL, ldvsl, VSR, ldvsr, rconde, rcondv,
+        &work[0], lwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+void ggesx_work_size(
     lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
     lapack_d_select3 select, lapack::Sense sense, int64_t n,
     double* A, int64_t lda,
@@ -117,8 +194,17 @@ int64_t ggesx(
     double* VSL, int64_t ldvsl,
     double* VSR, int64_t ldvsr,
     double* rconde,
-    double* rcondv )
+    double* rcondv,
+    int64_t* lwork,
+    int64_t* liwork )
 {
+    internal::StatsScope stats_scope( "dggesx" );
+    internal::WorkSizeKey key( "dggesx",
+        { to_char( jobvsl ), to_char( jobvsr ), to_char( sort ),
+          to_char( sense ), n, lda, ldb, ldvsl, ldvsr } );
+    if (internal::work_size_cache_find( key, lwork, nullptr, liwork ))
+        return;
+
     char jobvsl_ = to_char( jobvsl );
     char jobvsr_ = to_char( jobvsr );
     char sort_ = to_char( sort );
@@ -140,6 +226,7 @@ int64_t ggesx(
     lapack_int qry_iwork[1];
     lapack_int qry_bwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_dggesx(
         &jobvsl_, &jobvsr_, &sort_,
         select, &sense_, &n_,
@@ -156,15 +243,50 @@ int64_t ggesx(
         qry_iwork, &ineg_one,
         qry_bwork, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    *lwork = real(qry_work[0]);
+    *liwork = real(qry_iwork[0]);
+    internal::work_size_cache_insert( key, *lwork, 0, *liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggesx(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_d_select3 select, lapack::Sense sense, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<double>* alpha,
+    double* beta,
+    double* VSL, int64_t ldvsl,
+    double* VSR, int64_t ldvsr,
+    double* rconde,
+    double* rcondv,
+    double* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    char jobvsl_ = to_char( jobvsl );
+    char jobvsr_ = to_char( jobvsr );
+    char sort_ = to_char( sort );
+    char sense_ = to_char( sense );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int sdim_ = 0;  // out
+    lapack_int ldvsl_ = to_lapack_int( ldvsl );
+    lapack_int ldvsr_ = to_lapack_int( ldvsr );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int liwork_ = to_lapack_int( liwork );
+    lapack_int info_ = 0;
+
+    // split-complex representation
+    lapack::vector< double > alphar( max( 1, n ) );
+    lapack::vector< double > alphai( max( 1, n ) );
 
     // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
     lapack::vector< lapack_int > bwork( (n) );
 
     LAPACK_dggesx(
@@ -179,8 +301,8 @@ int64_t ggesx(
         VSR, &ldvsr_,
         rconde,
         rcondv,
-        &work[0], &lwork_,
-        &iwork[0], &liwork_,
+        work, &lwork_,
+        iwork, &liwork_,
         &bwork[0], &info_
     );
     if (info_ < 0) {
@@ -196,6 +318,37 @@ int64_t ggesx(
 
 // -----------------------------------------------------------------------------
 int64_t ggesx(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_d_select3 select, lapack::Sense sense, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<double>* alpha,
+    double* beta,
+    double* VSL, int64_t ldvsl,
+    double* VSR, int64_t ldvsr,
+    double* rconde,
+    double* rcondv )
+{
+    internal::StatsScope stats_scope( "dggesx" );
+    int64_t lwork, liwork;
+    ggesx_work_size(
+        jobvsl, jobvsr, sort, select, sense, n, A, lda, B, ldb, sdim, alpha,
+        beta, VSL, ldvsl, VSR, ldvsr, rconde, rcondv,
+        &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return ggesx(
+        jobvsl, jobvsr, sort, select, sense, n, A, lda, B, ldb, sdim, alpha,
+        beta, VSL, ldvsl, VSR, ldvsr, rconde, rcondv,
+        &work[0], lwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+void ggesx_work_size(
     lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
     lapack_c_select2 select, lapack::Sense sense, int64_t n,
     std::complex<float>* A, int64_t lda,
@@ -206,8 +359,18 @@ int64_t ggesx(
     std::complex<float>* VSL, int64_t ldvsl,
     std::complex<float>* VSR, int64_t ldvsr,
     float* rconde,
-    float* rcondv )
+    float* rcondv,
+    int64_t* lwork,
+    int64_t* lrwork,
+    int64_t* liwork )
 {
+    internal::StatsScope stats_scope( "cggesx" );
+    internal::WorkSizeKey key( "cggesx",
+        { to_char( jobvsl ), to_char( jobvsr ), to_char( sort ),
+          to_char( sense ), n, lda, ldb, ldvsl, ldvsr } );
+    if (internal::work_size_cache_find( key, lwork, lrwork, liwork ))
+        return;
+
     char jobvsl_ = to_char( jobvsl );
     char jobvsr_ = to_char( jobvsr );
     char sort_ = to_char( sort );
@@ -226,6 +389,7 @@ int64_t ggesx(
     lapack_int qry_iwork[1];
     lapack_int qry_bwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_cggesx(
         &jobvsl_, &jobvsr_, &sort_,
         (LAPACK_C_SELECT2) select, &sense_, &n_,
@@ -242,16 +406,49 @@ int64_t ggesx(
         qry_iwork, &ineg_one,
         qry_bwork, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    *lwork = real(qry_work[0]);
+    *lrwork = 8*n;
+    *liwork = real(qry_iwork[0]);
+    internal::work_size_cache_insert( key, *lwork, *lrwork, *liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggesx(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_c_select2 select, lapack::Sense sense, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* VSL, int64_t ldvsl,
+    std::complex<float>* VSR, int64_t ldvsr,
+    float* rconde,
+    float* rcondv,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    char jobvsl_ = to_char( jobvsl );
+    char jobvsr_ = to_char( jobvsr );
+    char sort_ = to_char( sort );
+    char sense_ = to_char( sense );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int sdim_ = 0;  // out
+    lapack_int ldvsl_ = to_lapack_int( ldvsl );
+    lapack_int ldvsr_ = to_lapack_int( ldvsr );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int liwork_ = to_lapack_int( liwork );
+    lapack_error_if( lrwork < 8*n );
+    lapack_int info_ = 0;
 
     // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (8*n) );
-    lapack::vector< lapack_int > iwork( liwork_ );
     lapack::vector< lapack_int > bwork( (n) );
 
     LAPACK_cggesx(
@@ -265,9 +462,9 @@ int64_t ggesx(
         (lapack_complex_float*) VSR, &ldvsr_,
         rconde,
         rcondv,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0],
-        &iwork[0], &liwork_,
+        (lapack_complex_float*) work, &lwork_,
+        rwork,
+        iwork, &liwork_,
         &bwork[0], &info_
     );
     if (info_ < 0) {
@@ -279,6 +476,51 @@ int64_t ggesx(
 
 // -----------------------------------------------------------------------------
 int64_t ggesx(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_c_select2 select, lapack::Sense sense, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* VSL, int64_t ldvsl,
+    std::complex<float>* VSR, int64_t ldvsr,
+    float* rconde,
+    float* rcondv )
+{
+    internal::StatsScope stats_scope( "cggesx" );
+    int64_t lwork, lrwork, liwork;
+    ggesx_work_size(
+        jobvsl, jobvsr, sort, select, sense, n, A, lda, B, ldb, sdim, alpha,
+        beta, VSL, ldvsl, VSR, ldvsr, rconde, rcondv,
+        &lwork, &lrwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return ggesx(
+        jobvsl, jobvsr, sort, select, sense, n, A, lda, B, ldb, sdim, alpha,
+        beta, VSL, ldvsl, VSR, ldvsr, rconde, rcondv,
+        &work[0], lwork, &rwork[0], lrwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::ggesx with caller-supplied workspace.
+/// Arguments are the same as for lapack::ggesx; the matrices are not
+/// modified. The sizes can be reused for any call of the same shape.
+///
+/// @param[out] lwork
+///     Required length of the work array.
+///
+/// @param[out] lrwork
+///     Required length of the rwork array.
+///
+/// @param[out] liwork
+///     Required length of the iwork array.
+///
+void ggesx_work_size(
     lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
     lapack_z_select2 select, lapack::Sense sense, int64_t n,
     std::complex<double>* A, int64_t lda,
@@ -289,8 +531,18 @@ int64_t ggesx(
     std::complex<double>* VSL, int64_t ldvsl,
     std::complex<double>* VSR, int64_t ldvsr,
     double* rconde,
-    double* rcondv )
+    double* rcondv,
+    int64_t* lwork,
+    int64_t* lrwork,
+    int64_t* liwork )
 {
+    internal::StatsScope stats_scope( "zggesx" );
+    internal::WorkSizeKey key( "zggesx",
+        { to_char( jobvsl ), to_char( jobvsr ), to_char( sort ),
+          to_char( sense ), n, lda, ldb, ldvsl, ldvsr } );
+    if (internal::work_size_cache_find( key, lwork, lrwork, liwork ))
+        return;
+
     char jobvsl_ = to_char( jobvsl );
     char jobvsr_ = to_char( jobvsr );
     char sort_ = to_char( sort );
@@ -309,6 +561,7 @@ int64_t ggesx(
     lapack_int qry_iwork[1];
     lapack_int qry_bwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_zggesx(
         &jobvsl_, &jobvsr_, &sort_,
         (LAPACK_Z_SELECT2) select, &sense_, &n_,
@@ -325,16 +578,71 @@ int64_t ggesx(
         qry_iwork, &ineg_one,
         qry_bwork, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    *lwork = real(qry_work[0]);
+    *lrwork = 8*n;
+    *liwork = real(qry_iwork[0]);
+    internal::work_size_cache_insert( key, *lwork, *lrwork, *liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::ggesx with caller-supplied workspace, which
+/// skips the internal workspace query and allocation. Other arguments
+/// are the same as for lapack::ggesx.
+///
+/// @param[out] work
+///     Workspace of length lwork.
+///
+/// @param[in] lwork
+///     Length of work, at least as returned by lapack::ggesx_work_size.
+///
+/// @param[out] rwork
+///     Workspace of length lrwork.
+///
+/// @param[in] lrwork
+///     Length of rwork, at least as returned by lapack::ggesx_work_size.
+///
+/// @param[out] iwork
+///     Workspace of length liwork.
+///
+/// @param[in] liwork
+///     Length of iwork, at least as returned by lapack::ggesx_work_size.
+///
+int64_t ggesx(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_z_select2 select, lapack::Sense sense, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* VSL, int64_t ldvsl,
+    std::complex<double>* VSR, int64_t ldvsr,
+    double* rconde,
+    double* rcondv,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    char jobvsl_ = to_char( jobvsl );
+    char jobvsr_ = to_char( jobvsr );
+    char sort_ = to_char( sort );
+    char sense_ = to_char( sense );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int sdim_ = 0;  // out
+    lapack_int ldvsl_ = to_lapack_int( ldvsl );
+    lapack_int ldvsr_ = to_lapack_int( ldvsr );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int liwork_ = to_lapack_int( liwork );
+    lapack_error_if( lrwork < 8*n );
+    lapack_int info_ = 0;
 
     // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (8*n) );
-    lapack::vector< lapack_int > iwork( liwork_ );
     lapack::vector< lapack_int > bwork( (n) );
 
     LAPACK_zggesx(
@@ -348,9 +656,9 @@ int64_t ggesx(
         (lapack_complex_double*) VSR, &ldvsr_,
         rconde,
         rcondv,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0],
-        &iwork[0], &liwork_,
+        (lapack_complex_double*) work, &lwork_,
+        rwork,
+        iwork, &liwork_,
         &bwork[0], &info_
     );
     if (info_ < 0) {
@@ -360,4 +668,36 @@ int64_t ggesx(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+int64_t ggesx(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_z_select2 select, lapack::Sense sense, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* VSL, int64_t ldvsl,
+    std::complex<double>* VSR, int64_t ldvsr,
+    double* rconde,
+    double* rcondv )
+{
+    internal::StatsScope stats_scope( "zggesx" );
+    int64_t lwork, lrwork, liwork;
+    ggesx_work_size(
+        jobvsl, jobvsr, sort, select, sense, n, A, lda, B, ldb, sdim, alpha,
+        beta, VSL, ldvsl, VSR, ldvsr, rconde, rcondv,
+        &lwork, &lrwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return ggesx(
+        jobvsl, jobvsr, sort, select, sense, n, A, lda, B, ldb, sdim, alpha,
+        beta, VSL, ldvsl, VSR, ldvsr, rconde, rcondv,
+        &work[0], lwork, &rwork[0], lrwork, &iwork[0], liwork );
+}
+
 }  // namespace lapack
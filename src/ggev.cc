@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack_internal.hh"
 #include "lapack/fortran.h"
+#include "work_size_cache.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -17,15 +18,22 @@ using blas::min;
 using blas::real;
 
 // -----------------------------------------------------------------------------
-int64_t ggev(
+void ggev_work_size(
     lapack::Job jobvl, lapack::Job jobvr, int64_t n,
     float* A, int64_t lda,
     float* B, int64_t ldb,
     std::complex<float>* alpha,
     float* beta,
     float* VL, int64_t ldvl,
-    float* VR, int64_t ldvr )
+    float* VR, int64_t ldvr,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "sggev" );
+    internal::WorkSizeKey key( "sggev",
+        { to_char( jobvl ), to_char( jobvr ), n, lda, ldb, ldvl, ldvr } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     char jobvl_ = to_char( jobvl );
     char jobvr_ = to_char( jobvr );
     lapack_int n_ = to_lapack_int( n );
@@ -42,6 +50,7 @@ int64_t ggev(
     // query for workspace size
     float qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_sggev(
         &jobvl_, &jobvr_, &n_,
         A, &lda_,
@@ -52,13 +61,38 @@ int64_t ggev(
         VR, &ldvr_,
         qry_work, &ineg_one, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+// -----------------------------------------------------------------------------
+int64_t ggev(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    std::complex<float>* alpha,
+    float* beta,
+    float* VL, int64_t ldvl,
+    float* VR, int64_t ldvr,
+    float* work, int64_t lwork )
+{
+    char jobvl_ = to_char( jobvl );
+    char jobvr_ = to_char( jobvr );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int ldvl_ = to_lapack_int( ldvl );
+    lapack_int ldvr_ = to_lapack_int( ldvr );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
+
+    // split-complex representation
+    lapack::vector< float > alphar( max( 1, n ) );
+    lapack::vector< float > alphai( max( 1, n ) );
 
     LAPACK_sggev(
         &jobvl_, &jobvr_, &n_,
@@ -68,7 +102,7 @@ int64_t ggev(
         beta,
         VL, &ldvl_,
         VR, &ldvr_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -82,14 +116,45 @@ int64_t ggev(
 
 // -----------------------------------------------------------------------------
 int64_t ggev(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    std::complex<float>* alpha,
+    float* beta,
+    float* VL, int64_t ldvl,
+    float* VR, int64_t ldvr )
+{
+    internal::StatsScope stats_scope( "sggev" );
+    int64_t lwork;
+    ggev_work_size(
+        jobvl, jobvr, n, A, lda, B, ldb, alpha, beta, VL, ldvl, VR, ldvr,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return ggev(
+        jobvl, jobvr, n, A, lda, B, ldb, alpha, beta, VL, ldvl, VR, ldvr,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+void ggev_work_size(
     lapack::Job jobvl, lapack::Job jobvr, int64_t n,
     double* A, int64_t lda,
     double* B, int64_t ldb,
     std::complex<double>* alpha,
     double* beta,
     double* VL, int64_t ldvl,
-    double* VR, int64_t ldvr )
+    double* VR, int64_t ldvr,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "dggev" );
+    internal::WorkSizeKey key( "dggev",
+        { to_char( jobvl ), to_char( jobvr ), n, lda, ldb, ldvl, ldvr } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     char jobvl_ = to_char( jobvl );
     char jobvr_ = to_char( jobvr );
     lapack_int n_ = to_lapack_int( n );
@@ -106,6 +171,7 @@ int64_t ggev(
     // query for workspace size
     double qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_dggev(
         &jobvl_, &jobvr_, &n_,
         A, &lda_,
@@ -116,13 +182,38 @@ int64_t ggev(
         VR, &ldvr_,
         qry_work, &ineg_one, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+// -----------------------------------------------------------------------------
+int64_t ggev(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    std::complex<double>* alpha,
+    double* beta,
+    double* VL, int64_t ldvl,
+    double* VR, int64_t ldvr,
+    double* work, int64_t lwork )
+{
+    char jobvl_ = to_char( jobvl );
+    char jobvr_ = to_char( jobvr );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int ldvl_ = to_lapack_int( ldvl );
+    lapack_int ldvr_ = to_lapack_int( ldvr );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
+
+    // split-complex representation
+    lapack::vector< double > alphar( max( 1, n ) );
+    lapack::vector< double > alphai( max( 1, n ) );
 
     LAPACK_dggev(
         &jobvl_, &jobvr_, &n_,
@@ -132,7 +223,7 @@ int64_t ggev(
         beta,
         VL, &ldvl_,
         VR, &ldvr_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -146,14 +237,46 @@ int64_t ggev(
 
 // -----------------------------------------------------------------------------
 int64_t ggev(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    std::complex<double>* alpha,
+    double* beta,
+    double* VL, int64_t ldvl,
+    double* VR, int64_t ldvr )
+{
+    internal::StatsScope stats_scope( "dggev" );
+    int64_t lwork;
+    ggev_work_size(
+        jobvl, jobvr, n, A, lda, B, ldb, alpha, beta, VL, ldvl, VR, ldvr,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return ggev(
+        jobvl, jobvr, n, A, lda, B, ldb, alpha, beta, VL, ldvl, VR, ldvr,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+void ggev_work_size(
     lapack::Job jobvl, lapack::Job jobvr, int64_t n,
     std::complex<float>* A, int64_t lda,
     std::complex<float>* B, int64_t ldb,
     std::complex<float>* alpha,
     std::complex<float>* beta,
     std::complex<float>* VL, int64_t ldvl,
-    std::complex<float>* VR, int64_t ldvr )
+    std::complex<float>* VR, int64_t ldvr,
+    int64_t* lwork,
+    int64_t* lrwork )
 {
+    internal::StatsScope stats_scope( "cggev" );
+    internal::WorkSizeKey key( "cggev",
+        { to_char( jobvl ), to_char( jobvr ), n, lda, ldb, ldvl, ldvr } );
+    if (internal::work_size_cache_find( key, lwork, lrwork ))
+        return;
+
     char jobvl_ = to_char( jobvl );
     char jobvr_ = to_char( jobvr );
     lapack_int n_ = to_lapack_int( n );
@@ -167,6 +290,7 @@ int64_t ggev(
     std::complex<float> qry_work[1];
     float qry_rwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_cggev(
         &jobvl_, &jobvr_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -178,14 +302,37 @@ int64_t ggev(
         (lapack_complex_float*) qry_work, &ineg_one,
         qry_rwork, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    *lrwork = 8*n;
+    internal::work_size_cache_insert( key, *lwork, *lrwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (8*n) );
+// -----------------------------------------------------------------------------
+int64_t ggev(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* VL, int64_t ldvl,
+    std::complex<float>* VR, int64_t ldvr,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork )
+{
+    char jobvl_ = to_char( jobvl );
+    char jobvr_ = to_char( jobvr );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int ldvl_ = to_lapack_int( ldvl );
+    lapack_int ldvr_ = to_lapack_int( ldvr );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( lrwork < 8*n );
+    lapack_int info_ = 0;
 
     LAPACK_cggev(
         &jobvl_, &jobvr_, &n_,
@@ -195,8 +342,8 @@ int64_t ggev(
         (lapack_complex_float*) beta,
         (lapack_complex_float*) VL, &ldvl_,
         (lapack_complex_float*) VR, &ldvr_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0], &info_
+        (lapack_complex_float*) work, &lwork_,
+        rwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -206,14 +353,57 @@ int64_t ggev(
 
 // -----------------------------------------------------------------------------
 int64_t ggev(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* VL, int64_t ldvl,
+    std::complex<float>* VR, int64_t ldvr )
+{
+    internal::StatsScope stats_scope( "cggev" );
+    int64_t lwork, lrwork;
+    ggev_work_size(
+        jobvl, jobvr, n, A, lda, B, ldb, alpha, beta, VL, ldvl, VR, ldvr,
+        &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+
+    return ggev(
+        jobvl, jobvr, n, A, lda, B, ldb, alpha, beta, VL, ldvl, VR, ldvr,
+        &work[0], lwork, &rwork[0], lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::ggev with caller-supplied workspace.
+/// Arguments are the same as for lapack::ggev; the matrices are not
+/// modified. The sizes can be reused for any call of the same shape.
+///
+/// @param[out] lwork
+///     Required length of the work array.
+///
+/// @param[out] lrwork
+///     Required length of the rwork array.
+///
+void ggev_work_size(
     lapack::Job jobvl, lapack::Job jobvr, int64_t n,
     std::complex<double>* A, int64_t lda,
     std::complex<double>* B, int64_t ldb,
     std::complex<double>* alpha,
     std::complex<double>* beta,
     std::complex<double>* VL, int64_t ldvl,
-    std::complex<double>* VR, int64_t ldvr )
+    std::complex<double>* VR, int64_t ldvr,
+    int64_t* lwork,
+    int64_t* lrwork )
 {
+    internal::StatsScope stats_scope( "zggev" );
+    internal::WorkSizeKey key( "zggev",
+        { to_char( jobvl ), to_char( jobvr ), n, lda, ldb, ldvl, ldvr } );
+    if (internal::work_size_cache_find( key, lwork, lrwork ))
+        return;
+
     char jobvl_ = to_char( jobvl );
     char jobvr_ = to_char( jobvr );
     lapack_int n_ = to_lapack_int( n );
@@ -227,6 +417,7 @@ int64_t ggev(
     std::complex<double> qry_work[1];
     double qry_rwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_zggev(
         &jobvl_, &jobvr_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -238,14 +429,53 @@ int64_t ggev(
         (lapack_complex_double*) qry_work, &ineg_one,
         qry_rwork, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    *lrwork = 8*n;
+    internal::work_size_cache_insert( key, *lwork, *lrwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (8*n) );
+// -----------------------------------------------------------------------------
+/// Variant of lapack::ggev with caller-supplied workspace, which
+/// skips the internal workspace query and allocation. Other arguments
+/// are the same as for lapack::ggev.
+///
+/// @param[out] work
+///     Workspace of length lwork.
+///
+/// @param[in] lwork
+///     Length of work, at least as returned by lapack::ggev_work_size.
+///
+/// @param[out] rwork
+///     Workspace of length lrwork.
+///
+/// @param[in] lrwork
+///     Length of rwork, at least as returned by lapack::ggev_work_size.
+///
+int64_t ggev(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* VL, int64_t ldvl,
+    std::complex<double>* VR, int64_t ldvr,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork )
+{
+    char jobvl_ = to_char( jobvl );
+    char jobvr_ = to_char( jobvr );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int ldvl_ = to_lapack_int( ldvl );
+    lapack_int ldvr_ = to_lapack_int( ldvr );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( lrwork < 8*n );
+    lapack_int info_ = 0;
 
     LAPACK_zggev(
         &jobvl_, &jobvr_, &n_,
@@ -255,8 +485,8 @@ int64_t ggev(
         (lapack_complex_double*) beta,
         (lapack_complex_double*) VL, &ldvl_,
         (lapack_complex_double*) VR, &ldvr_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0], &info_
+        (lapack_complex_double*) work, &lwork_,
+        rwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -264,4 +494,29 @@ int64_t ggev(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+int64_t ggev(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* VL, int64_t ldvl,
+    std::complex<double>* VR, int64_t ldvr )
+{
+    internal::StatsScope stats_scope( "zggev" );
+    int64_t lwork, lrwork;
+    ggev_work_size(
+        jobvl, jobvr, n, A, lda, B, ldb, alpha, beta, VL, ldvl, VR, ldvr,
+        &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+
+    return ggev(
+        jobvl, jobvr, n, A, lda, B, ldb, alpha, beta, VL, ldvl, VR, ldvr,
+        &work[0], lwork, &rwork[0], lrwork );
+}
+
 }  // namespace lapack
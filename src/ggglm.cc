@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack_internal.hh"
 #include "lapack/fortran.h"
+#include "work_size_cache.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -18,14 +19,20 @@ using blas::real;
 
 // -----------------------------------------------------------------------------
 /// @ingroup ggls
-int64_t ggglm(
+void ggglm_work_size(
     int64_t n, int64_t m, int64_t p,
     float* A, int64_t lda,
     float* B, int64_t ldb,
     float* D,
     float* X,
-    float* Y )
+    float* Y,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "sggglm" );
+    internal::WorkSizeKey key( "sggglm", { n, m, p, lda, ldb } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int m_ = to_lapack_int( m );
     lapack_int p_ = to_lapack_int( p );
@@ -36,6 +43,7 @@ int64_t ggglm(
     // query for workspace size
     float qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_sggglm(
         &n_, &m_, &p_,
         A, &lda_,
@@ -44,13 +52,32 @@ int64_t ggglm(
         X,
         Y,
         qry_work, &ineg_one, &info_ );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup ggls
+int64_t ggglm(
+    int64_t n, int64_t m, int64_t p,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* D,
+    float* X,
+    float* Y,
+    float* work, int64_t lwork )
+{
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_sggglm(
         &n_, &m_, &p_,
@@ -59,7 +86,7 @@ int64_t ggglm(
         D,
         X,
         Y,
-        &work[0], &lwork_, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -69,13 +96,43 @@ int64_t ggglm(
 // -----------------------------------------------------------------------------
 /// @ingroup ggls
 int64_t ggglm(
+    int64_t n, int64_t m, int64_t p,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* D,
+    float* X,
+    float* Y )
+{
+    internal::StatsScope stats_scope( "sggglm" );
+    int64_t lwork;
+    ggglm_work_size(
+        n, m, p, A, lda, B, ldb, D, X, Y,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return ggglm(
+        n, m, p, A, lda, B, ldb, D, X, Y,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup ggls
+void ggglm_work_size(
     int64_t n, int64_t m, int64_t p,
     double* A, int64_t lda,
     double* B, int64_t ldb,
     double* D,
     double* X,
-    double* Y )
+    double* Y,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "dggglm" );
+    internal::WorkSizeKey key( "dggglm", { n, m, p, lda, ldb } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int m_ = to_lapack_int( m );
     lapack_int p_ = to_lapack_int( p );
@@ -86,6 +143,7 @@ int64_t ggglm(
     // query for workspace size
     double qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_dggglm(
         &n_, &m_, &p_,
         A, &lda_,
@@ -94,13 +152,32 @@ int64_t ggglm(
         X,
         Y,
         qry_work, &ineg_one, &info_ );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup ggls
+int64_t ggglm(
+    int64_t n, int64_t m, int64_t p,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* D,
+    double* X,
+    double* Y,
+    double* work, int64_t lwork )
+{
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_dggglm(
         &n_, &m_, &p_,
@@ -109,7 +186,7 @@ int64_t ggglm(
         D,
         X,
         Y,
-        &work[0], &lwork_, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -119,13 +196,43 @@ int64_t ggglm(
 // -----------------------------------------------------------------------------
 /// @ingroup ggls
 int64_t ggglm(
+    int64_t n, int64_t m, int64_t p,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* D,
+    double* X,
+    double* Y )
+{
+    internal::StatsScope stats_scope( "dggglm" );
+    int64_t lwork;
+    ggglm_work_size(
+        n, m, p, A, lda, B, ldb, D, X, Y,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return ggglm(
+        n, m, p, A, lda, B, ldb, D, X, Y,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup ggls
+void ggglm_work_size(
     int64_t n, int64_t m, int64_t p,
     std::complex<float>* A, int64_t lda,
     std::complex<float>* B, int64_t ldb,
     std::complex<float>* D,
     std::complex<float>* X,
-    std::complex<float>* Y )
+    std::complex<float>* Y,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "cggglm" );
+    internal::WorkSizeKey key( "cggglm", { n, m, p, lda, ldb } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int m_ = to_lapack_int( m );
     lapack_int p_ = to_lapack_int( p );
@@ -136,6 +243,7 @@ int64_t ggglm(
     // query for workspace size
     std::complex<float> qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_cggglm(
         &n_, &m_, &p_,
         (lapack_complex_float*) A, &lda_,
@@ -144,13 +252,32 @@ int64_t ggglm(
         (lapack_complex_float*) X,
         (lapack_complex_float*) Y,
         (lapack_complex_float*) qry_work, &ineg_one, &info_ );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup ggls
+int64_t ggglm(
+    int64_t n, int64_t m, int64_t p,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* D,
+    std::complex<float>* X,
+    std::complex<float>* Y,
+    std::complex<float>* work, int64_t lwork )
+{
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_cggglm(
         &n_, &m_, &p_,
@@ -159,7 +286,124 @@ int64_t ggglm(
         (lapack_complex_float*) D,
         (lapack_complex_float*) X,
         (lapack_complex_float*) Y,
-        (lapack_complex_float*) &work[0], &lwork_, &info_ );
+        (lapack_complex_float*) work, &lwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup ggls
+int64_t ggglm(
+    int64_t n, int64_t m, int64_t p,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* D,
+    std::complex<float>* X,
+    std::complex<float>* Y )
+{
+    internal::StatsScope stats_scope( "cggglm" );
+    int64_t lwork;
+    ggglm_work_size(
+        n, m, p, A, lda, B, ldb, D, X, Y,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+
+    return ggglm(
+        n, m, p, A, lda, B, ldb, D, X, Y,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::ggglm with caller-supplied workspace.
+/// Arguments are the same as for lapack::ggglm; the matrices are not
+/// modified. The sizes can be reused for any call of the same shape.
+///
+/// @param[out] lwork
+///     Required length of the work array.
+///
+/// @ingroup ggls
+void ggglm_work_size(
+    int64_t n, int64_t m, int64_t p,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* D,
+    std::complex<double>* X,
+    std::complex<double>* Y,
+    int64_t* lwork )
+{
+    internal::StatsScope stats_scope( "zggglm" );
+    internal::WorkSizeKey key( "zggglm", { n, m, p, lda, ldb } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int info_ = 0;
+
+    // query for workspace size
+    std::complex<double> qry_work[1];
+    lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
+    LAPACK_zggglm(
+        &n_, &m_, &p_,
+        (lapack_complex_double*) A, &lda_,
+        (lapack_complex_double*) B, &ldb_,
+        (lapack_complex_double*) D,
+        (lapack_complex_double*) X,
+        (lapack_complex_double*) Y,
+        (lapack_complex_double*) qry_work, &ineg_one, &info_ );
+    query_timer.stop();
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::ggglm with caller-supplied workspace, which
+/// skips the internal workspace query and allocation. Other arguments
+/// are the same as for lapack::ggglm.
+///
+/// @param[out] work
+///     Workspace of length lwork.
+///
+/// @param[in] lwork
+///     Length of work, at least as returned by lapack::ggglm_work_size.
+///
+/// @ingroup ggls
+int64_t ggglm(
+    int64_t n, int64_t m, int64_t p,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* D,
+    std::complex<double>* X,
+    std::complex<double>* Y,
+    std::complex<double>* work, int64_t lwork )
+{
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
+
+    LAPACK_zggglm(
+        &n_, &m_, &p_,
+        (lapack_complex_double*) A, &lda_,
+        (lapack_complex_double*) B, &ldb_,
+        (lapack_complex_double*) D,
+        (lapack_complex_double*) X,
+        (lapack_complex_double*) Y,
+        (lapack_complex_double*) work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -260,44 +504,18 @@ int64_t ggglm(
     std::complex<double>* X,
     std::complex<double>* Y )
 {
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int m_ = to_lapack_int( m );
-    lapack_int p_ = to_lapack_int( p );
-    lapack_int lda_ = to_lapack_int( lda );
-    lapack_int ldb_ = to_lapack_int( ldb );
-    lapack_int info_ = 0;
-
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zggglm(
-        &n_, &m_, &p_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) B, &ldb_,
-        (lapack_complex_double*) D,
-        (lapack_complex_double*) X,
-        (lapack_complex_double*) Y,
-        (lapack_complex_double*) qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    internal::StatsScope stats_scope( "zggglm" );
+    int64_t lwork;
+    ggglm_work_size(
+        n, m, p, A, lda, B, ldb, D, X, Y,
+        &lwork );
 
     // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+    lapack::vector< std::complex<double> > work( lwork );
 
-    LAPACK_zggglm(
-        &n_, &m_, &p_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) B, &ldb_,
-        (lapack_complex_double*) D,
-        (lapack_complex_double*) X,
-        (lapack_complex_double*) Y,
-        (lapack_complex_double*) &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return ggglm(
+        n, m, p, A, lda, B, ldb, D, X, Y,
+        &work[0], lwork );
 }
 
 }  // namespace lapack
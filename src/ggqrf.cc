@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack_internal.hh"
 #include "lapack/fortran.h"
+#include "work_size_cache.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -17,13 +18,19 @@ using blas::min;
 using blas::real;
 
 // -----------------------------------------------------------------------------
-int64_t ggqrf(
+void ggqrf_work_size(
     int64_t n, int64_t m, int64_t p,
     float* A, int64_t lda,
     float* taua,
     float* B, int64_t ldb,
-    float* taub )
+    float* taub,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "sggqrf" );
+    internal::WorkSizeKey key( "sggqrf", { n, m, p, lda, ldb } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int m_ = to_lapack_int( m );
     lapack_int p_ = to_lapack_int( p );
@@ -34,6 +41,7 @@ int64_t ggqrf(
     // query for workspace size
     float qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_sggqrf(
         &n_, &m_, &p_,
         A, &lda_,
@@ -41,13 +49,30 @@ int64_t ggqrf(
         B, &ldb_,
         taub,
         qry_work, &ineg_one, &info_ );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+// -----------------------------------------------------------------------------
+int64_t ggqrf(
+    int64_t n, int64_t m, int64_t p,
+    float* A, int64_t lda,
+    float* taua,
+    float* B, int64_t ldb,
+    float* taub,
+    float* work, int64_t lwork )
+{
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_sggqrf(
         &n_, &m_, &p_,
@@ -55,7 +80,7 @@ int64_t ggqrf(
         taua,
         B, &ldb_,
         taub,
-        &work[0], &lwork_, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -64,12 +89,40 @@ int64_t ggqrf(
 
 // -----------------------------------------------------------------------------
 int64_t ggqrf(
+    int64_t n, int64_t m, int64_t p,
+    float* A, int64_t lda,
+    float* taua,
+    float* B, int64_t ldb,
+    float* taub )
+{
+    internal::StatsScope stats_scope( "sggqrf" );
+    int64_t lwork;
+    ggqrf_work_size(
+        n, m, p, A, lda, taua, B, ldb, taub,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return ggqrf(
+        n, m, p, A, lda, taua, B, ldb, taub,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+void ggqrf_work_size(
     int64_t n, int64_t m, int64_t p,
     double* A, int64_t lda,
     double* taua,
     double* B, int64_t ldb,
-    double* taub )
+    double* taub,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "dggqrf" );
+    internal::WorkSizeKey key( "dggqrf", { n, m, p, lda, ldb } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int m_ = to_lapack_int( m );
     lapack_int p_ = to_lapack_int( p );
@@ -80,6 +133,7 @@ int64_t ggqrf(
     // query for workspace size
     double qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_dggqrf(
         &n_, &m_, &p_,
         A, &lda_,
@@ -87,13 +141,30 @@ int64_t ggqrf(
         B, &ldb_,
         taub,
         qry_work, &ineg_one, &info_ );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+// -----------------------------------------------------------------------------
+int64_t ggqrf(
+    int64_t n, int64_t m, int64_t p,
+    double* A, int64_t lda,
+    double* taua,
+    double* B, int64_t ldb,
+    double* taub,
+    double* work, int64_t lwork )
+{
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_dggqrf(
         &n_, &m_, &p_,
@@ -101,7 +172,7 @@ int64_t ggqrf(
         taua,
         B, &ldb_,
         taub,
-        &work[0], &lwork_, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -110,12 +181,40 @@ int64_t ggqrf(
 
 // -----------------------------------------------------------------------------
 int64_t ggqrf(
+    int64_t n, int64_t m, int64_t p,
+    double* A, int64_t lda,
+    double* taua,
+    double* B, int64_t ldb,
+    double* taub )
+{
+    internal::StatsScope stats_scope( "dggqrf" );
+    int64_t lwork;
+    ggqrf_work_size(
+        n, m, p, A, lda, taua, B, ldb, taub,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return ggqrf(
+        n, m, p, A, lda, taua, B, ldb, taub,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+void ggqrf_work_size(
     int64_t n, int64_t m, int64_t p,
     std::complex<float>* A, int64_t lda,
     std::complex<float>* taua,
     std::complex<float>* B, int64_t ldb,
-    std::complex<float>* taub )
+    std::complex<float>* taub,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "cggqrf" );
+    internal::WorkSizeKey key( "cggqrf", { n, m, p, lda, ldb } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int m_ = to_lapack_int( m );
     lapack_int p_ = to_lapack_int( p );
@@ -126,6 +225,7 @@ int64_t ggqrf(
     // query for workspace size
     std::complex<float> qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_cggqrf(
         &n_, &m_, &p_,
         (lapack_complex_float*) A, &lda_,
@@ -133,13 +233,30 @@ int64_t ggqrf(
         (lapack_complex_float*) B, &ldb_,
         (lapack_complex_float*) taub,
         (lapack_complex_float*) qry_work, &ineg_one, &info_ );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+// -----------------------------------------------------------------------------
+int64_t ggqrf(
+    int64_t n, int64_t m, int64_t p,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* taua,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* taub,
+    std::complex<float>* work, int64_t lwork )
+{
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_cggqrf(
         &n_, &m_, &p_,
@@ -147,7 +264,7 @@ int64_t ggqrf(
         (lapack_complex_float*) taua,
         (lapack_complex_float*) B, &ldb_,
         (lapack_complex_float*) taub,
-        (lapack_complex_float*) &work[0], &lwork_, &info_ );
+        (lapack_complex_float*) work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -156,12 +273,47 @@ int64_t ggqrf(
 
 // -----------------------------------------------------------------------------
 int64_t ggqrf(
+    int64_t n, int64_t m, int64_t p,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* taua,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* taub )
+{
+    internal::StatsScope stats_scope( "cggqrf" );
+    int64_t lwork;
+    ggqrf_work_size(
+        n, m, p, A, lda, taua, B, ldb, taub,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+
+    return ggqrf(
+        n, m, p, A, lda, taua, B, ldb, taub,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::ggqrf with caller-supplied workspace.
+/// Arguments are the same as for lapack::ggqrf; the matrices are not
+/// modified. The sizes can be reused for any call of the same shape.
+///
+/// @param[out] lwork
+///     Required length of the work array.
+///
+void ggqrf_work_size(
     int64_t n, int64_t m, int64_t p,
     std::complex<double>* A, int64_t lda,
     std::complex<double>* taua,
     std::complex<double>* B, int64_t ldb,
-    std::complex<double>* taub )
+    std::complex<double>* taub,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "zggqrf" );
+    internal::WorkSizeKey key( "zggqrf", { n, m, p, lda, ldb } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     lapack_int n_ = to_lapack_int( n );
     lapack_int m_ = to_lapack_int( m );
     lapack_int p_ = to_lapack_int( p );
@@ -172,6 +324,7 @@ int64_t ggqrf(
     // query for workspace size
     std::complex<double> qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_zggqrf(
         &n_, &m_, &p_,
         (lapack_complex_double*) A, &lda_,
@@ -179,13 +332,40 @@ int64_t ggqrf(
         (lapack_complex_double*) B, &ldb_,
         (lapack_complex_double*) taub,
         (lapack_complex_double*) qry_work, &ineg_one, &info_ );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// Variant of lapack::ggqrf with caller-supplied workspace, which
+/// skips the internal workspace query and allocation. Other arguments
+/// are the same as for lapack::ggqrf.
+///
+/// @param[out] work
+///     Workspace of length lwork.
+///
+/// @param[in] lwork
+///     Length of work, at least as returned by lapack::ggqrf_work_size.
+///
+int64_t ggqrf(
+    int64_t n, int64_t m, int64_t p,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* taua,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* taub,
+    std::complex<double>* work, int64_t lwork )
+{
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_zggqrf(
         &n_, &m_, &p_,
@@ -193,11 +373,33 @@ int64_t ggqrf(
         (lapack_complex_double*) taua,
         (lapack_complex_double*) B, &ldb_,
         (lapack_complex_double*) taub,
-        (lapack_complex_double*) &work[0], &lwork_, &info_ );
+        (lapack_complex_double*) work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+int64_t ggqrf(
+    int64_t n, int64_t m, int64_t p,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* taua,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* taub )
+{
+    internal::StatsScope stats_scope( "zggqrf" );
+    int64_t lwork;
+    ggqrf_work_size(
+        n, m, p, A, lda, taua, B, ldb, taub,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+
+    return ggqrf(
+        n, m, p, A, lda, taua, B, ldb, taub,
+        &work[0], lwork );
+}
+
 }  // namespace lapack
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack_internal.hh"
 #include "lapack/fortran.h"
+#include "work_size_cache.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30600  // >= 3.6
@@ -19,7 +20,7 @@ using blas::min;
 using blas::real;
 
 // -----------------------------------------------------------------------------
-int64_t ggsvd3(
+void ggsvd3_work_size(
     lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
     int64_t* k,
     int64_t* l,
@@ -29,8 +30,17 @@ int64_t ggsvd3(
     float* beta,
     float* U, int64_t ldu,
     float* V, int64_t ldv,
-    float* Q, int64_t ldq )
+    float* Q, int64_t ldq,
+    int64_t* lwork,
+    int64_t* liwork )
 {
+    internal::StatsScope stats_scope( "sggsvd3" );
+    internal::WorkSizeKey key( "sggsvd3",
+        { to_char( jobu ), to_char( jobv ), to_char( jobq ), m, n, p, lda, ldb,
+          ldu, ldv, ldq } );
+    if (internal::work_size_cache_find( key, lwork, nullptr, liwork ))
+        return;
+
     char jobu_ = to_char_jobu( jobu );
     char jobv_ = to_char( jobv );
     char jobq_ = to_char_jobq( jobq );
@@ -50,6 +60,7 @@ int64_t ggsvd3(
     float qry_work[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_sggsvd3(
         &jobu_, &jobv_, &jobq_, &m_, &n_, &p_, &k_, &l_,
         A, &lda_,
@@ -62,14 +73,46 @@ int64_t ggsvd3(
         qry_work, &ineg_one,
         qry_iwork, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    *liwork = n;
+    internal::work_size_cache_insert( key, *lwork, 0, *liwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (n) );
+// -----------------------------------------------------------------------------
+int64_t ggsvd3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* alpha,
+    float* beta,
+    float* U, int64_t ldu,
+    float* V, int64_t ldv,
+    float* Q, int64_t ldq,
+    float* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    char jobu_ = to_char_jobu( jobu );
+    char jobv_ = to_char( jobv );
+    char jobq_ = to_char_jobq( jobq );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int k_ = 0;  // out
+    lapack_int l_ = 0;  // out
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int ldu_ = to_lapack_int( ldu );
+    lapack_int ldv_ = to_lapack_int( ldv );
+    lapack_int ldq_ = to_lapack_int( ldq );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( liwork < n );
+    lapack_int info_ = 0;
 
     LAPACK_sggsvd3(
         &jobu_, &jobv_, &jobq_, &m_, &n_, &p_, &k_, &l_,
@@ -80,8 +123,8 @@ int64_t ggsvd3(
         U, &ldu_,
         V, &ldv_,
         Q, &ldq_,
-        &work[0], &lwork_,
-        &iwork[0], &info_
+        work, &lwork_,
+        iwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -93,6 +136,36 @@ int64_t ggsvd3(
 
 // -----------------------------------------------------------------------------
 int64_t ggsvd3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* alpha,
+    float* beta,
+    float* U, int64_t ldu,
+    float* V, int64_t ldv,
+    float* Q, int64_t ldq )
+{
+    internal::StatsScope stats_scope( "sggsvd3" );
+    int64_t lwork, liwork;
+    ggsvd3_work_size(
+        jobu, jobv, jobq, m, n, p, k, l, A, lda, B, ldb, alpha, beta, U, ldu,
+        V, ldv, Q, ldq,
+        &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return ggsvd3(
+        jobu, jobv, jobq, m, n, p, k, l, A, lda, B, ldb, alpha, beta, U, ldu,
+        V, ldv, Q, ldq,
+        &work[0], lwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+void ggsvd3_work_size(
     lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
     int64_t* k,
     int64_t* l,
@@ -102,8 +175,17 @@ int64_t ggsvd3(
     double* beta,
     double* U, int64_t ldu,
     double* V, int64_t ldv,
-    double* Q, int64_t ldq )
+    double* Q, int64_t ldq,
+    int64_t* lwork,
+    int64_t* liwork )
 {
+    internal::StatsScope stats_scope( "dggsvd3" );
+    internal::WorkSizeKey key( "dggsvd3",
+        { to_char( jobu ), to_char( jobv ), to_char( jobq ), m, n, p, lda, ldb,
+          ldu, ldv, ldq } );
+    if (internal::work_size_cache_find( key, lwork, nullptr, liwork ))
+        return;
+
     char jobu_ = to_char_jobu( jobu );
     char jobv_ = to_char( jobv );
     char jobq_ = to_char_jobq( jobq );
@@ -123,6 +205,7 @@ int64_t ggsvd3(
     double qry_work[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_dggsvd3(
         &jobu_, &jobv_, &jobq_, &m_, &n_, &p_, &k_, &l_,
         A, &lda_,
@@ -135,14 +218,46 @@ int64_t ggsvd3(
         qry_work, &ineg_one,
         qry_iwork, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    *liwork = n;
+    internal::work_size_cache_insert( key, *lwork, 0, *liwork );
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (n) );
+// -----------------------------------------------------------------------------
+int64_t ggsvd3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* alpha,
+    double* beta,
+    double* U, int64_t ldu,
+    double* V, int64_t ldv,
+    double* Q, int64_t ldq,
+    double* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    char jobu_ = to_char_jobu( jobu );
+    char jobv_ = to_char( jobv );
+    char jobq_ = to_char_jobq( jobq );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int k_ = 0;  // out
+    lapack_int l_ = 0;  // out
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int ldu_ = to_lapack_int( ldu );
+    lapack_int ldv_ = to_lapack_int( ldv );
+    lapack_int ldq_ = to_lapack_int( ldq );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( liwork < n );
+    lapack_int info_ = 0;
 
     LAPACK_dggsvd3(
         &jobu_, &jobv_, &jobq_, &m_, &n_, &p_, &k_, &l_,
@@ -153,8 +268,8 @@ int64_t ggsvd3(
         U, &ldu_,
         V, &ldv_,
         Q, &ldq_,
-        &work[0], &lwork_,
-        &iwork[0], &info_
+        work, &lwork_,
+        iwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -166,6 +281,36 @@ int64_t ggsvd3(
 
 // -----------------------------------------------------------------------------
 int64_t ggsvd3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* alpha,
+    double* beta,
+    double* U, int64_t ldu,
+    double* V, int64_t ldv,
+    double* Q, int64_t ldq )
+{
+    internal::StatsScope stats_scope( "dggsvd3" );
+    int64_t lwork, liwork;
+    ggsvd3_work_size(
+        jobu, jobv, jobq, m, n, p, k, l, A, lda, B, ldb, alpha, beta, U, ldu,
+        V, ldv, Q, ldq,
+        &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return ggsvd3(
+        jobu, jobv, jobq, m, n, p, k, l, A, lda, B, ldb, alpha, beta, U, ldu,
+        V, ldv, Q, ldq,
+        &work[0], lwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+void ggsvd3_work_size(
     lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
     int64_t* k,
     int64_t* l,
@@ -175,8 +320,18 @@ int64_t ggsvd3(
     float* beta,
     std::complex<float>* U, int64_t ldu,
     std::complex<float>* V, int64_t ldv,
-    std::complex<float>* Q, int64_t ldq )
+    std::complex<float>* Q, int64_t ldq,
+    int64_t* lwork,
+    int64_t* lrwork,
+    int64_t* liwork )
 {
+    internal::StatsScope stats_scope( "cggsvd3" );
+    internal::WorkSizeKey key( "cggsvd3",
+        { to_char( jobu ), to_char( jobv ), to_char( jobq ), m, n, p, lda, ldb,
+          ldu, ldv, ldq } );
+    if (internal::work_size_cache_find( key, lwork, lrwork, liwork ))
+        return;
+
     char jobu_ = to_char_jobu( jobu );
     char jobv_ = to_char( jobv );
     char jobq_ = to_char_jobq( jobq );
@@ -197,6 +352,7 @@ int64_t ggsvd3(
     float qry_rwork[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_cggsvd3(
         &jobu_, &jobv_, &jobq_, &m_, &n_, &p_, &k_, &l_,
         (lapack_complex_float*) A, &lda_,
@@ -210,15 +366,49 @@ int64_t ggsvd3(
         qry_rwork,
         qry_iwork, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    *lrwork = 2*n;
+    *liwork = n;
+    internal::work_size_cache_insert( key, *lwork, *lrwork, *liwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (2*n) );
-    lapack::vector< lapack_int > iwork( (n) );
+// -----------------------------------------------------------------------------
+int64_t ggsvd3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* alpha,
+    float* beta,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* V, int64_t ldv,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    char jobu_ = to_char_jobu( jobu );
+    char jobv_ = to_char( jobv );
+    char jobq_ = to_char_jobq( jobq );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int k_ = 0;  // out
+    lapack_int l_ = 0;  // out
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int ldu_ = to_lapack_int( ldu );
+    lapack_int ldv_ = to_lapack_int( ldv );
+    lapack_int ldq_ = to_lapack_int( ldq );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( lrwork < 2*n );
+    lapack_error_if( liwork < n );
+    lapack_int info_ = 0;
 
     LAPACK_cggsvd3(
         &jobu_, &jobv_, &jobq_, &m_, &n_, &p_, &k_, &l_,
@@ -229,9 +419,9 @@ int64_t ggsvd3(
         (lapack_complex_float*) U, &ldu_,
         (lapack_complex_float*) V, &ldv_,
         (lapack_complex_float*) Q, &ldq_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0],
-        &iwork[0], &info_
+        (lapack_complex_float*) work, &lwork_,
+        rwork,
+        iwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -243,6 +433,50 @@ int64_t ggsvd3(
 
 // -----------------------------------------------------------------------------
 int64_t ggsvd3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* alpha,
+    float* beta,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* V, int64_t ldv,
+    std::complex<float>* Q, int64_t ldq )
+{
+    internal::StatsScope stats_scope( "cggsvd3" );
+    int64_t lwork, lrwork, liwork;
+    ggsvd3_work_size(
+        jobu, jobv, jobq, m, n, p, k, l, A, lda, B, ldb, alpha, beta, U, ldu,
+        V, ldv, Q, ldq,
+        &lwork, &lrwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return ggsvd3(
+        jobu, jobv, jobq, m, n, p, k, l, A, lda, B, ldb, alpha, beta, U, ldu,
+        V, ldv, Q, ldq,
+        &work[0], lwork, &rwork[0], lrwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::ggsvd3 with caller-supplied workspace.
+/// Arguments are the same as for lapack::ggsvd3; the matrices are not
+/// modified. The sizes can be reused for any call of the same shape.
+///
+/// @param[out] lwork
+///     Required length of the work array.
+///
+/// @param[out] lrwork
+///     Required length of the rwork array.
+///
+/// @param[out] liwork
+///     Required length of the iwork array.
+///
+void ggsvd3_work_size(
     lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
     int64_t* k,
     int64_t* l,
@@ -252,8 +486,18 @@ int64_t ggsvd3(
     double* beta,
     std::complex<double>* U, int64_t ldu,
     std::complex<double>* V, int64_t ldv,
-    std::complex<double>* Q, int64_t ldq )
+    std::complex<double>* Q, int64_t ldq,
+    int64_t* lwork,
+    int64_t* lrwork,
+    int64_t* liwork )
 {
+    internal::StatsScope stats_scope( "zggsvd3" );
+    internal::WorkSizeKey key( "zggsvd3",
+        { to_char( jobu ), to_char( jobv ), to_char( jobq ), m, n, p, lda, ldb,
+          ldu, ldv, ldq } );
+    if (internal::work_size_cache_find( key, lwork, lrwork, liwork ))
+        return;
+
     char jobu_ = to_char_jobu( jobu );
     char jobv_ = to_char( jobv );
     char jobq_ = to_char_jobq( jobq );
@@ -274,6 +518,7 @@ int64_t ggsvd3(
     double qry_rwork[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_zggsvd3(
         &jobu_, &jobv_, &jobq_, &m_, &n_, &p_, &k_, &l_,
         (lapack_complex_double*) A, &lda_,
@@ -287,15 +532,71 @@ int64_t ggsvd3(
         qry_rwork,
         qry_iwork, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    *lrwork = 2*n;
+    *liwork = n;
+    internal::work_size_cache_insert( key, *lwork, *lrwork, *liwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (2*n) );
-    lapack::vector< lapack_int > iwork( (n) );
+// -----------------------------------------------------------------------------
+/// Variant of lapack::ggsvd3 with caller-supplied workspace, which
+/// skips the internal workspace query and allocation. Other arguments
+/// are the same as for lapack::ggsvd3.
+///
+/// @param[out] work
+///     Workspace of length lwork.
+///
+/// @param[in] lwork
+///     Length of work, at least as returned by lapack::ggsvd3_work_size.
+///
+/// @param[out] rwork
+///     Workspace of length lrwork.
+///
+/// @param[in] lrwork
+///     Length of rwork, at least as returned by lapack::ggsvd3_work_size.
+///
+/// @param[out] iwork
+///     Workspace of length liwork.
+///
+/// @param[in] liwork
+///     Length of iwork, at least as returned by lapack::ggsvd3_work_size.
+///
+int64_t ggsvd3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* alpha,
+    double* beta,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* V, int64_t ldv,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    char jobu_ = to_char_jobu( jobu );
+    char jobv_ = to_char( jobv );
+    char jobq_ = to_char_jobq( jobq );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int k_ = 0;  // out
+    lapack_int l_ = 0;  // out
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int ldu_ = to_lapack_int( ldu );
+    lapack_int ldv_ = to_lapack_int( ldv );
+    lapack_int ldq_ = to_lapack_int( ldq );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( lrwork < 2*n );
+    lapack_error_if( liwork < n );
+    lapack_int info_ = 0;
 
     LAPACK_zggsvd3(
         &jobu_, &jobv_, &jobq_, &m_, &n_, &p_, &k_, &l_,
@@ -306,9 +607,9 @@ int64_t ggsvd3(
         (lapack_complex_double*) U, &ldu_,
         (lapack_complex_double*) V, &ldv_,
         (lapack_complex_double*) Q, &ldq_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0],
-        &iwork[0], &info_
+        (lapack_complex_double*) work, &lwork_,
+        rwork,
+        iwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -318,6 +619,37 @@ int64_t ggsvd3(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+int64_t ggsvd3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* alpha,
+    double* beta,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* V, int64_t ldv,
+    std::complex<double>* Q, int64_t ldq )
+{
+    internal::StatsScope stats_scope( "zggsvd3" );
+    int64_t lwork, lrwork, liwork;
+    ggsvd3_work_size(
+        jobu, jobv, jobq, m, n, p, k, l, A, lda, B, ldb, alpha, beta, U, ldu,
+        V, ldv, Q, ldq,
+        &lwork, &lrwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return ggsvd3(
+        jobu, jobv, jobq, m, n, p, k, l, A, lda, B, ldb, alpha, beta, U, ldu,
+        V, ldv, Q, ldq,
+        &work[0], lwork, &rwork[0], lrwork, &iwork[0], liwork );
+}
+
 }  // namespace lapack
 
 #endif  // LAPACK >= 3.6
@@ -27,11 +27,12 @@ int64_t gtcon(
     int64_t const* ipiv, float anorm,
     float* rcond )
 {
+    internal::StatsScope stats_scope( "sgtcon" );
     char norm_ = to_char( norm );
     lapack_int n_ = to_lapack_int( n );
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -69,11 +70,12 @@ int64_t gtcon(
     int64_t const* ipiv, double anorm,
     double* rcond )
 {
+    internal::StatsScope stats_scope( "dgtcon" );
     char norm_ = to_char( norm );
     lapack_int n_ = to_lapack_int( n );
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -111,11 +113,12 @@ int64_t gtcon(
     int64_t const* ipiv, float anorm,
     float* rcond )
 {
+    internal::StatsScope stats_scope( "cgtcon" );
     char norm_ = to_char( norm );
     lapack_int n_ = to_lapack_int( n );
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -207,11 +210,12 @@ int64_t gtcon(
     int64_t const* ipiv, double anorm,
     double* rcond )
 {
+    internal::StatsScope stats_scope( "zgtcon" );
     char norm_ = to_char( norm );
     lapack_int n_ = to_lapack_int( n );
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -236,4 +240,158 @@ int64_t gtcon(
     return info_;
 }
 
+#ifndef LAPACK_ILP64
+
+// -----------------------------------------------------------------------------
+/// @ingroup gtsv_computational
+int64_t gtcon(
+    lapack::Norm norm, int64_t n,
+    float const* DL,
+    float const* D,
+    float const* DU,
+    float const* DU2,
+    lapack_int const* ipiv, float anorm,
+    float* rcond )
+{
+    internal::StatsScope stats_scope( "sgtcon" );
+    char norm_ = to_char( norm );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int const* ipiv_ptr = ipiv;
+    lapack_int info_ = 0;
+
+    // allocate workspace
+    lapack::vector< float > work( (2*n) );
+    lapack::vector< lapack_int > iwork( (n) );
+
+    LAPACK_sgtcon(
+        &norm_, &n_,
+        DL,
+        D,
+        DU,
+        DU2,
+        ipiv_ptr, &anorm, rcond,
+        &work[0],
+        &iwork[0], &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gtsv_computational
+int64_t gtcon(
+    lapack::Norm norm, int64_t n,
+    double const* DL,
+    double const* D,
+    double const* DU,
+    double const* DU2,
+    lapack_int const* ipiv, double anorm,
+    double* rcond )
+{
+    internal::StatsScope stats_scope( "dgtcon" );
+    char norm_ = to_char( norm );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int const* ipiv_ptr = ipiv;
+    lapack_int info_ = 0;
+
+    // allocate workspace
+    lapack::vector< double > work( (2*n) );
+    lapack::vector< lapack_int > iwork( (n) );
+
+    LAPACK_dgtcon(
+        &norm_, &n_,
+        DL,
+        D,
+        DU,
+        DU2,
+        ipiv_ptr, &anorm, rcond,
+        &work[0],
+        &iwork[0], &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gtsv_computational
+int64_t gtcon(
+    lapack::Norm norm, int64_t n,
+    std::complex<float> const* DL,
+    std::complex<float> const* D,
+    std::complex<float> const* DU,
+    std::complex<float> const* DU2,
+    lapack_int const* ipiv, float anorm,
+    float* rcond )
+{
+    internal::StatsScope stats_scope( "cgtcon" );
+    char norm_ = to_char( norm );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int const* ipiv_ptr = ipiv;
+    lapack_int info_ = 0;
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( (2*n) );
+
+    LAPACK_cgtcon(
+        &norm_, &n_,
+        (lapack_complex_float*) DL,
+        (lapack_complex_float*) D,
+        (lapack_complex_float*) DU,
+        (lapack_complex_float*) DU2,
+        ipiv_ptr, &anorm, rcond,
+        (lapack_complex_float*) &work[0], &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::gtcon that takes ipiv in the native LAPACK integer
+/// type, lapack_int, instead of int64_t, which avoids allocating and
+/// copying a temporary pivot array. Available only when lapack_int is
+/// 32-bit, i.e., LAPACK_ILP64 is not defined; otherwise the int64_t
+/// version is already native.
+///
+/// @ingroup gtsv_computational
+int64_t gtcon(
+    lapack::Norm norm, int64_t n,
+    std::complex<double> const* DL,
+    std::complex<double> const* D,
+    std::complex<double> const* DU,
+    std::complex<double> const* DU2,
+    lapack_int const* ipiv, double anorm,
+    double* rcond )
+{
+    internal::StatsScope stats_scope( "zgtcon" );
+    char norm_ = to_char( norm );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int const* ipiv_ptr = ipiv;
+    lapack_int info_ = 0;
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( (2*n) );
+
+    LAPACK_zgtcon(
+        &norm_, &n_,
+        (lapack_complex_double*) DL,
+        (lapack_complex_double*) D,
+        (lapack_complex_double*) DU,
+        (lapack_complex_double*) DU2,
+        ipiv_ptr, &anorm, rcond,
+        (lapack_complex_double*) &work[0], &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+#endif  // LAPACK_ILP64
+
 }  // namespace lapack
@@ -0,0 +1,346 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "batch_internal.hh"
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper for the strided layout.
+/// @ingroup gtsv
+///
+template <typename scalar_t>
+int64_t gtsv_batch(
+    int64_t n, int64_t nrhs,
+    scalar_t* DL, scalar_t* D, scalar_t* DU, int64_t strideD,
+    scalar_t* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size, int64_t* info )
+{
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( strideD < n );
+    lapack_error_if( ldb < max( 1, n ) );
+    lapack_error_if( strideB < ldb * nrhs );
+    lapack_error_if( batch_size < 0 );
+    to_lapack_int( ldb );  // check for overflow
+
+    // Give each thread at least ~64K flops per range.
+    int64_t grain = (int64_t( 1 ) << 16) / max( 1, 8*n*(1 + nrhs) );
+
+    std::atomic< int64_t > nfailed { 0 };
+    internal::parallel_for( batch_size, grain, [&]( int64_t begin, int64_t end ) {
+        int64_t count = 0;
+        for (int64_t i = begin; i < end; ++i) {
+            int64_t offset = i * strideD;
+            info[ i ] = lapack::gtsv(
+                n, nrhs, DL + offset, D + offset, DU + offset,
+                B + i*strideB, ldb );
+            if (info[ i ] > 0)
+                ++count;
+        }
+        nfailed += count;
+    });
+    return nfailed;
+}
+
+//------------------------------------------------------------------------------
+/// Factors and solves one interleaved block, then moves the second
+/// super-diagonal of U into DL, as lapack::gtsv returns it.
+template <typename scalar_t>
+void gtsv_block(
+    int64_t n, int64_t nrhs,
+    scalar_t* DL, scalar_t* D, scalar_t* DU, scalar_t* B,
+    scalar_t* DU2, int64_t* ipiv,
+    int64_t lanes, int64_t nlanes, int64_t* info )
+{
+    internal::gttrf_interleaved(
+        n, DL, D, DU, DU2, ipiv, lanes, nlanes, info );
+    internal::gttrs_interleaved(
+        Op::NoTrans, n, nrhs, DL, D, DU, DU2, ipiv, B, lanes, nlanes );
+    std::copy( DU2, DU2 + max( 0, n - 2 )*lanes, DL );
+}
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper for the interleaved layout.
+/// @ingroup gtsv
+///
+template <typename scalar_t>
+int64_t gtsv_batch_interleaved(
+    int64_t n, int64_t nrhs,
+    scalar_t* DL, scalar_t* D, scalar_t* DU,
+    scalar_t* B, int64_t lanes,
+    int64_t batch_size, int64_t* info )
+{
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( lanes < 1 );
+    lapack_error_if( batch_size < 0 );
+
+    int64_t n1 = max( 0, n - 1 );
+    int64_t n2 = max( 0, n - 2 );
+    int64_t nblocks = (batch_size + lanes - 1) / lanes;
+    int64_t grain = (int64_t( 1 ) << 16) / max( 1, lanes * 8*n*(1 + nrhs) );
+
+    std::atomic< int64_t > nfailed { 0 };
+    internal::parallel_for( nblocks, grain, [&]( int64_t begin, int64_t end ) {
+        std::vector< scalar_t > DU2b( n2 * lanes );
+        std::vector< int64_t > ipiv_b( n * lanes );
+        int64_t count = 0;
+        for (int64_t b = begin; b < end; ++b) {
+            int64_t k = b * lanes;
+            int64_t nlanes = min( lanes, batch_size - k );
+            gtsv_block( n, nrhs,
+                        &DL[ b * n1*lanes ], &D[ b * n*lanes ],
+                        &DU[ b * n1*lanes ], &B[ b * n*nrhs*lanes ],
+                        DU2b.data(), ipiv_b.data(), lanes, nlanes, &info[ k ] );
+            for (int64_t l = 0; l < nlanes; ++l) {
+                if (info[ k + l ] > 0)
+                    ++count;
+            }
+        }
+        nfailed += count;
+    });
+    return nfailed;
+}
+
+}  // namespace impl
+
+//------------------------------------------------------------------------------
+/// @ingroup gtsv
+int64_t gtsv_batch(
+    int64_t n, int64_t nrhs,
+    float* DL, float* D, float* DU, int64_t strideD,
+    float* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::gtsv_batch(
+        n, nrhs, DL, D, DU, strideD, B, ldb, strideB, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gtsv
+int64_t gtsv_batch(
+    int64_t n, int64_t nrhs,
+    double* DL, double* D, double* DU, int64_t strideD,
+    double* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::gtsv_batch(
+        n, nrhs, DL, D, DU, strideD, B, ldb, strideB, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gtsv
+int64_t gtsv_batch(
+    int64_t n, int64_t nrhs,
+    std::complex<float>* DL, std::complex<float>* D, std::complex<float>* DU, int64_t strideD,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::gtsv_batch(
+        n, nrhs, DL, D, DU, strideD, B, ldb, strideB, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// Solves a batch of tridiagonal systems of linear equations, in parallel,
+/// \[
+///     A_i X_i = B_i,
+/// \]
+/// using Gaussian elimination with partial pivoting, as in lapack::gtsv.
+/// This suits, e.g., ADI or line-implicit sweeps, which solve many
+/// independent systems of the same size.
+///
+/// Strided ("separate arrays") layout: the vectors of system i start at
+/// DL + i*strideD, D + i*strideD, and so on, and B_i at B + i*strideB.
+/// Each system is handled by LAPACK, in parallel over the batch. For many
+/// small systems, the interleaved layout is faster, since its recurrences
+/// vectorize across systems; see lapack::gtsv_batch_interleaved.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides, i.e., the number of columns
+///     of each B_i. nrhs >= 0.
+///
+/// @param[in,out] DL
+///     The vectors DL_i of length n-1, strideD apart.
+///     On entry, the sub-diagonal of A_i.
+///     On exit, the n-2 elements of the second super-diagonal of U_i,
+///     as in lapack::gtsv.
+///
+/// @param[in,out] D
+///     The vectors D_i of length n, strideD apart.
+///     On entry, the diagonal of A_i; on exit, the diagonal of U_i.
+///
+/// @param[in,out] DU
+///     The vectors DU_i of length n-1, strideD apart.
+///     On entry, the super-diagonal of A_i; on exit, the first
+///     super-diagonal of U_i.
+///
+/// @param[in] strideD
+///     Distance between the starts of the vectors of consecutive
+///     systems. strideD >= n.
+///
+/// @param[in,out] B
+///     The batch_size matrices B_i, each ldb-by-nrhs, strideB apart.
+///     On entry, the right hand sides; on exit, if info[i] = 0, the
+///     solutions X_i.
+///
+/// @param[in] ldb
+///     The leading dimension of each B_i. ldb >= max(1,n).
+///
+/// @param[in] strideB
+///     Distance between the starts of B_i and B_{i+1}. strideB >= ldb*nrhs.
+///
+/// @param[in] batch_size
+///     The number of systems. batch_size >= 0.
+///
+/// @param[out] info
+///     The vector info of length batch_size.
+///     - info[i] = 0: system i was solved successfully.
+///     - info[i] = k > 0: U_i(k,k) is exactly zero, so A_i is singular
+///       and X_i was not computed.
+///
+/// @return number of systems with info[i] > 0.
+///
+/// @ingroup gtsv
+int64_t gtsv_batch(
+    int64_t n, int64_t nrhs,
+    std::complex<double>* DL, std::complex<double>* D, std::complex<double>* DU, int64_t strideD,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::gtsv_batch(
+        n, nrhs, DL, D, DU, strideD, B, ldb, strideB, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gtsv
+int64_t gtsv_batch_interleaved(
+    int64_t n, int64_t nrhs,
+    float* DL, float* D, float* DU,
+    float* B, int64_t lanes,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::gtsv_batch_interleaved(
+        n, nrhs, DL, D, DU, B, lanes, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gtsv
+int64_t gtsv_batch_interleaved(
+    int64_t n, int64_t nrhs,
+    double* DL, double* D, double* DU,
+    double* B, int64_t lanes,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::gtsv_batch_interleaved(
+        n, nrhs, DL, D, DU, B, lanes, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gtsv
+int64_t gtsv_batch_interleaved(
+    int64_t n, int64_t nrhs,
+    std::complex<float>* DL, std::complex<float>* D, std::complex<float>* DU,
+    std::complex<float>* B, int64_t lanes,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::gtsv_batch_interleaved(
+        n, nrhs, DL, D, DU, B, lanes, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// Solves a batch of tridiagonal systems of linear equations, in
+/// parallel; interleaved layout. Each block of `lanes` systems is
+/// factored and solved in one pass. See the strided form of
+/// lapack::gtsv_batch for details.
+///
+/// Unlike lapack::gtsv, a singular system is still solved (producing
+/// infinities or NaNs) so the other systems in its block are unaffected.
+///
+/// Vectors are stored "batch-innermost" in blocks of `lanes` systems:
+/// element j of a length-len vector (e.g., len = n-1 for DL) of system k
+/// is at
+///
+///     X[ (k / lanes)*len*lanes + j*lanes + (k % lanes) ],
+///
+/// and B likewise, with element (i, j) at
+/// B[ (k / lanes)*n*nrhs*lanes + (i + j*n)*lanes + (k % lanes) ].
+/// The same element of `lanes` consecutive systems is contiguous, so the
+/// inherently serial recurrence vectorizes across systems. Use a multiple
+/// of the SIMD width, e.g., lanes = 8 or 16. See lapack::batch_interleave
+/// to convert from the strided layout, treating each vector as a
+/// len-by-1 matrix.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides. nrhs >= 0.
+///
+/// @param[in,out] DL
+///     The interleaved vectors DL_i of length n-1.
+///     On entry, the sub-diagonal of A_i; on exit, the n-2 elements of
+///     the second super-diagonal of U_i.
+///
+/// @param[in,out] D
+///     The interleaved vectors D_i of length n.
+///     On entry, the diagonal of A_i; on exit, the diagonal of U_i.
+///
+/// @param[in,out] DU
+///     The interleaved vectors DU_i of length n-1.
+///     On entry, the super-diagonal of A_i; on exit, the first
+///     super-diagonal of U_i.
+///
+/// @param[in,out] B
+///     The interleaved n-by-nrhs matrices B_i.
+///     On entry, the right hand sides; on exit, if info[i] = 0, the
+///     solutions X_i.
+///
+/// @param[in] lanes
+///     The number of interleaved systems per block. lanes >= 1.
+///
+/// @param[in] batch_size
+///     The number of systems. batch_size >= 0.
+///
+/// @param[out] info
+///     The vector info of length batch_size.
+///     - info[i] = 0: system i was solved successfully.
+///     - info[i] = k > 0: U_i(k,k) is exactly zero, so A_i is singular.
+///
+/// @return number of systems with info[i] > 0.
+///
+/// @ingroup gtsv
+int64_t gtsv_batch_interleaved(
+    int64_t n, int64_t nrhs,
+    std::complex<double>* DL, std::complex<double>* D, std::complex<double>* DU,
+    std::complex<double>* B, int64_t lanes,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::gtsv_batch_interleaved(
+        n, nrhs, DL, D, DU, B, lanes, batch_size, info );
+}
+
+}  // namespace lapack
@@ -0,0 +1,237 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "spike_internal.hh"
+#include "NoConstructAllocator.hh"
+
+#include <algorithm>
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper.
+/// @ingroup gtsv
+///
+template <typename scalar_t>
+int64_t gtsv_parallel(
+    int64_t n, int64_t nrhs,
+    scalar_t* DL, scalar_t* D, scalar_t* DU,
+    scalar_t* B, int64_t ldb )
+{
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( ldb < max( 1, n ) );
+
+    int64_t p = internal::spike_partitions( n, 2 );
+    if (p == 1)
+        return lapack::gtsv( n, nrhs, DL, D, DU, B, ldb );
+
+    lapack::vector< scalar_t > DU2( n );
+    lapack::vector< int64_t > ipiv( n );
+    lapack::vector< scalar_t > S( 2*n );
+    lapack::vector< scalar_t > DL_save( n - 1 ), D_save( n ), DU_save( n - 1 );
+    std::vector< scalar_t > T( p*4 ), Y( p*2*nrhs );
+    std::vector< int64_t > info( p, 0 );
+
+    // Restores DL, D, DU from the saved copies, so on failure the caller
+    // can fall back to lapack::gtsv with the original arrays.
+    auto restore = [&]() {
+        std::copy( DL_save.begin(), DL_save.end(), DL );
+        std::copy( D_save.begin(),  D_save.end(),  D  );
+        std::copy( DU_save.begin(), DU_save.end(), DU );
+    };
+
+    // Factor each diagonal block and solve for the spikes. Partition k
+    // reads its couplings DL[ s-1 ] and DU[ e-1 ], which gttrf of its
+    // neighbors does not touch. B is not touched until the block
+    // factorizations and the reduced system are known to be nonsingular.
+    internal::parallel_for( p, 1, [&]( int64_t begin, int64_t end ) {
+        for (int64_t k = begin; k < end; ++k) {
+            int64_t s = internal::spike_begin( n, p, k );
+            int64_t e = internal::spike_begin( n, p, k+1 );
+            int64_t m = e - s;
+            int64_t e1 = min( e, n - 1 );
+            std::copy( &DL[ s ], &DL[ e1 ], &DL_save[ s ] );
+            std::copy( &D[ s ],  &D[ e ],   &D_save[ s ] );
+            std::copy( &DU[ s ], &DU[ e1 ], &DU_save[ s ] );
+
+            scalar_t* Sk = &S[ 2*s ];
+            std::fill( Sk, Sk + 2*m, scalar_t( 0 ) );
+            if (k < p - 1)
+                Sk[ m - 1 ] = DU[ e - 1 ];
+            if (k > 0)
+                Sk[ m ] = DL[ s - 1 ];
+
+            int64_t iinfo = lapack::gttrf(
+                m, &DL[ s ], &D[ s ], &DU[ s ], &DU2[ s ], &ipiv[ s ] );
+            if (iinfo != 0) {
+                info[ k ] = s + iinfo;
+                continue;
+            }
+            lapack::gttrs(
+                Op::NoTrans, m, 2, &DL[ s ], &D[ s ], &DU[ s ], &DU2[ s ],
+                &ipiv[ s ], Sk, m );
+            internal::spike_tips( m, 1, 1, 2, Sk, m, &T[ k*4 ] );
+        }
+    });
+    for (int64_t k = 0; k < p; ++k) {
+        if (info[ k ] != 0) {
+            restore();
+            return info[ k ];
+        }
+    }
+
+    std::vector< scalar_t > AB_r;
+    std::vector< int64_t > ipiv_r;
+    int64_t iinfo = internal::spike_reduced_factor(
+        n, 1, 1, p, T.data(), AB_r, ipiv_r );
+    if (iinfo != 0) {
+        restore();
+        return iinfo;
+    }
+
+    // Solve for y_k.
+    internal::parallel_for( p, 1, [&]( int64_t begin, int64_t end ) {
+        for (int64_t k = begin; k < end; ++k) {
+            int64_t s = internal::spike_begin( n, p, k );
+            int64_t m = internal::spike_begin( n, p, k+1 ) - s;
+            lapack::gttrs(
+                Op::NoTrans, m, nrhs, &DL[ s ], &D[ s ], &DU[ s ], &DU2[ s ],
+                &ipiv[ s ], &B[ s ], ldb );
+            internal::spike_tips( m, 1, 1, nrhs, &B[ s ], ldb, &Y[ k*2*nrhs ] );
+        }
+    });
+
+    std::vector< scalar_t > Z( 2*(p - 1)*nrhs );
+    internal::spike_reduced_solve(
+        1, 1, nrhs, p, AB_r, ipiv_r, Y.data(), Z.data() );
+
+    internal::parallel_for( p, 1, [&]( int64_t begin, int64_t end ) {
+        for (int64_t k = begin; k < end; ++k) {
+            internal::spike_update( n, 1, 1, nrhs, p, k, S.data(), Z.data(), B, ldb );
+        }
+    });
+    return 0;
+}
+
+}  // namespace impl
+
+//------------------------------------------------------------------------------
+/// @ingroup gtsv
+int64_t gtsv_parallel(
+    int64_t n, int64_t nrhs,
+    float* DL, float* D, float* DU,
+    float* B, int64_t ldb )
+{
+    return impl::gtsv_parallel( n, nrhs, DL, D, DU, B, ldb );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gtsv
+int64_t gtsv_parallel(
+    int64_t n, int64_t nrhs,
+    double* DL, double* D, double* DU,
+    double* B, int64_t ldb )
+{
+    return impl::gtsv_parallel( n, nrhs, DL, D, DU, B, ldb );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gtsv
+int64_t gtsv_parallel(
+    int64_t n, int64_t nrhs,
+    std::complex<float>* DL, std::complex<float>* D, std::complex<float>* DU,
+    std::complex<float>* B, int64_t ldb )
+{
+    return impl::gtsv_parallel( n, nrhs, DL, D, DU, B, ldb );
+}
+
+//------------------------------------------------------------------------------
+/// Solves the equation
+/// \[
+///     A X = B,
+/// \]
+/// where A is an n-by-n tridiagonal matrix, in parallel on the LAPACK++
+/// thread pool, using the SPIKE partitioned algorithm. This is meant for
+/// a single very large system, where lapack::gtsv is sequential.
+///
+/// The rows are split into one partition per thread (see
+/// lapack::set_num_threads), each at least several thousand rows.
+/// Each diagonal block is factored by lapack::gttrf, with partial
+/// pivoting inside the block, and solved by lapack::gttrs for B and for
+/// the two "spikes" that couple it to its neighbors. A reduced system of
+/// order 2(p-1), for p partitions, couples the blocks and is solved by
+/// lapack::gbsv. This costs about 2.5 times the flops of lapack::gtsv,
+/// for nrhs = 1, plus workspace of 7n elements.
+///
+/// Pivoting does not cross partition boundaries, so a diagonal block
+/// may be singular even when A is not. This cannot happen if A is
+/// diagonally dominant; otherwise, if the return value is > 0, DL, D,
+/// DU, and B are restored to their values on entry, so the caller can
+/// use lapack::gtsv on them. If n is too small to split, this calls
+/// lapack::gtsv, and the outputs are as from lapack::gtsv.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] n
+///     The order of the matrix A. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides, i.e., the number of columns
+///     of the matrix B. nrhs >= 0.
+///
+/// @param[in,out] DL
+///     The vector DL of length n-1.
+///     On entry, DL must contain the (n-1) subdiagonal elements of A.
+///     On exit, if return value = 0, DL is overwritten by the factors
+///     of the diagonal blocks; if return value > 0, DL is restored.
+///
+/// @param[in,out] D
+///     The vector D of length n.
+///     On entry, D must contain the diagonal elements of A.
+///     On exit, if return value = 0, D is overwritten by the factors
+///     of the diagonal blocks; if return value > 0, D is restored.
+///
+/// @param[in,out] DU
+///     The vector DU of length n-1.
+///     On entry, DU must contain the (n-1) superdiagonal elements of A.
+///     On exit, if return value = 0, DU is overwritten by the factors
+///     of the diagonal blocks; if return value > 0, DU is restored.
+///
+/// @param[in,out] B
+///     The n-by-nrhs matrix B, stored in an ldb-by-nrhs array.
+///     On entry, the n-by-nrhs right hand side matrix B.
+///     On exit, if return value = 0, the n-by-nrhs solution matrix X;
+///     if return value > 0, B is restored.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B. ldb >= max(1,n).
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, the diagonal block holding row i,
+///     or the reduced system, has an exactly zero pivot at row i. The
+///     solution has not been computed, and DL, D, DU, and B are
+///     restored to their values on entry.
+///
+/// @ingroup gtsv
+int64_t gtsv_parallel(
+    int64_t n, int64_t nrhs,
+    std::complex<double>* DL, std::complex<double>* D, std::complex<double>* DU,
+    std::complex<double>* B, int64_t ldb )
+{
+    return impl::gtsv_parallel( n, nrhs, DL, D, DU, B, ldb );
+}
+
+}  // namespace lapack
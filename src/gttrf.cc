@@ -26,6 +26,7 @@ int64_t gttrf(
     float* DU2,
     int64_t* ipiv )
 {
+    internal::StatsScope stats_scope( "sgttrf" );
     lapack_int n_ = to_lapack_int( n );
     #ifndef LAPACK_ILP64
         // 32-bit copy
@@ -62,6 +63,7 @@ int64_t gttrf(
     double* DU2,
     int64_t* ipiv )
 {
+    internal::StatsScope stats_scope( "dgttrf" );
     lapack_int n_ = to_lapack_int( n );
     #ifndef LAPACK_ILP64
         // 32-bit copy
@@ -98,6 +100,7 @@ int64_t gttrf(
     std::complex<float>* DU2,
     int64_t* ipiv )
 {
+    internal::StatsScope stats_scope( "cgttrf" );
     lapack_int n_ = to_lapack_int( n );
     #ifndef LAPACK_ILP64
         // 32-bit copy
@@ -190,6 +193,7 @@ int64_t gttrf(
     std::complex<double>* DU2,
     int64_t* ipiv )
 {
+    internal::StatsScope stats_scope( "zgttrf" );
     lapack_int n_ = to_lapack_int( n );
     #ifndef LAPACK_ILP64
         // 32-bit copy
@@ -216,4 +220,122 @@ int64_t gttrf(
     return info_;
 }
 
+#ifndef LAPACK_ILP64
+
+// -----------------------------------------------------------------------------
+/// @ingroup gtsv_computational
+int64_t gttrf(
+    int64_t n,
+    float* DL,
+    float* D,
+    float* DU,
+    float* DU2,
+    lapack_int* ipiv )
+{
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int* ipiv_ptr = ipiv;
+    lapack_int info_ = 0;
+
+    LAPACK_sgttrf(
+        &n_,
+        DL,
+        D,
+        DU,
+        DU2,
+        ipiv_ptr, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gtsv_computational
+int64_t gttrf(
+    int64_t n,
+    double* DL,
+    double* D,
+    double* DU,
+    double* DU2,
+    lapack_int* ipiv )
+{
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int* ipiv_ptr = ipiv;
+    lapack_int info_ = 0;
+
+    LAPACK_dgttrf(
+        &n_,
+        DL,
+        D,
+        DU,
+        DU2,
+        ipiv_ptr, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gtsv_computational
+int64_t gttrf(
+    int64_t n,
+    std::complex<float>* DL,
+    std::complex<float>* D,
+    std::complex<float>* DU,
+    std::complex<float>* DU2,
+    lapack_int* ipiv )
+{
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int* ipiv_ptr = ipiv;
+    lapack_int info_ = 0;
+
+    LAPACK_cgttrf(
+        &n_,
+        (lapack_complex_float*) DL,
+        (lapack_complex_float*) D,
+        (lapack_complex_float*) DU,
+        (lapack_complex_float*) DU2,
+        ipiv_ptr, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::gttrf that takes ipiv in the native LAPACK integer
+/// type, lapack_int, instead of int64_t, which avoids allocating and
+/// copying a temporary pivot array. Available only when lapack_int is
+/// 32-bit, i.e., LAPACK_ILP64 is not defined; otherwise the int64_t
+/// version is already native.
+///
+/// @ingroup gtsv_computational
+int64_t gttrf(
+    int64_t n,
+    std::complex<double>* DL,
+    std::complex<double>* D,
+    std::complex<double>* DU,
+    std::complex<double>* DU2,
+    lapack_int* ipiv )
+{
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int* ipiv_ptr = ipiv;
+    lapack_int info_ = 0;
+
+    LAPACK_zgttrf(
+        &n_,
+        (lapack_complex_double*) DL,
+        (lapack_complex_double*) D,
+        (lapack_complex_double*) DU,
+        (lapack_complex_double*) DU2,
+        ipiv_ptr, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+#endif  // LAPACK_ILP64
+
 }  // namespace lapack
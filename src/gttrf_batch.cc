@@ -0,0 +1,310 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "batch_internal.hh"
+
+#include <atomic>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper for the strided layout.
+/// @ingroup gtsv_computational
+///
+template <typename scalar_t>
+int64_t gttrf_batch(
+    int64_t n,
+    scalar_t* DL, scalar_t* D, scalar_t* DU, scalar_t* DU2, int64_t strideD,
+    int64_t* ipiv, int64_t batch_size, int64_t* info )
+{
+    lapack_error_if( n < 0 );
+    lapack_error_if( strideD < n );
+    lapack_error_if( batch_size < 0 );
+
+    // Give each thread at least ~64K flops per range.
+    int64_t grain = (int64_t( 1 ) << 16) / max( 1, 8*n );
+
+    std::atomic< int64_t > nfailed { 0 };
+    internal::parallel_for( batch_size, grain, [&]( int64_t begin, int64_t end ) {
+        int64_t count = 0;
+        for (int64_t i = begin; i < end; ++i) {
+            int64_t offset = i * strideD;
+            info[ i ] = lapack::gttrf(
+                n, DL + offset, D + offset, DU + offset, DU2 + offset,
+                ipiv + offset );
+            if (info[ i ] > 0)
+                ++count;
+        }
+        nfailed += count;
+    });
+    return nfailed;
+}
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper for the interleaved layout.
+/// @ingroup gtsv_computational
+///
+template <typename scalar_t>
+int64_t gttrf_batch_interleaved(
+    int64_t n,
+    scalar_t* DL, scalar_t* D, scalar_t* DU, scalar_t* DU2,
+    int64_t* ipiv, int64_t lanes,
+    int64_t batch_size, int64_t* info )
+{
+    lapack_error_if( n < 0 );
+    lapack_error_if( lanes < 1 );
+    lapack_error_if( batch_size < 0 );
+
+    int64_t n1 = max( 0, n - 1 );
+    int64_t n2 = max( 0, n - 2 );
+    int64_t nblocks = (batch_size + lanes - 1) / lanes;
+    int64_t grain = (int64_t( 1 ) << 16) / max( 1, lanes * 8*n );
+
+    std::atomic< int64_t > nfailed { 0 };
+    internal::parallel_for( nblocks, grain, [&]( int64_t begin, int64_t end ) {
+        int64_t count = 0;
+        for (int64_t b = begin; b < end; ++b) {
+            int64_t k = b * lanes;
+            int64_t nlanes = min( lanes, batch_size - k );
+            internal::gttrf_interleaved(
+                n, &DL[ b * n1*lanes ], &D[ b * n*lanes ], &DU[ b * n1*lanes ],
+                &DU2[ b * n2*lanes ], &ipiv[ b * n*lanes ],
+                lanes, nlanes, &info[ k ] );
+            for (int64_t l = 0; l < nlanes; ++l) {
+                if (info[ k + l ] > 0)
+                    ++count;
+            }
+        }
+        nfailed += count;
+    });
+    return nfailed;
+}
+
+}  // namespace impl
+
+//------------------------------------------------------------------------------
+/// @ingroup gtsv_computational
+int64_t gttrf_batch(
+    int64_t n,
+    float* DL, float* D, float* DU, float* DU2, int64_t strideD,
+    int64_t* ipiv,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::gttrf_batch(
+        n, DL, D, DU, DU2, strideD, ipiv, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gtsv_computational
+int64_t gttrf_batch(
+    int64_t n,
+    double* DL, double* D, double* DU, double* DU2, int64_t strideD,
+    int64_t* ipiv,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::gttrf_batch(
+        n, DL, D, DU, DU2, strideD, ipiv, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gtsv_computational
+int64_t gttrf_batch(
+    int64_t n,
+    std::complex<float>* DL, std::complex<float>* D, std::complex<float>* DU, std::complex<float>* DU2, int64_t strideD,
+    int64_t* ipiv,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::gttrf_batch(
+        n, DL, D, DU, DU2, strideD, ipiv, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// Computes LU factorizations with partial pivoting of a batch of
+/// n-by-n tridiagonal matrices A_i, in parallel, as in lapack::gttrf:
+/// \[
+///     A_i = L_i U_i,
+/// \]
+/// where L_i is a product of permutation and unit lower bidiagonal
+/// matrices and U_i is upper triangular with nonzeros in only the main
+/// diagonal and first two superdiagonals.
+///
+/// Strided ("separate arrays") layout: the vectors and pivots of system i
+/// start at DL + i*strideD, D + i*strideD, ..., ipiv + i*strideD.
+/// Each system is handled by LAPACK, in parallel over the batch. For many
+/// small systems, the interleaved layout is faster, since its recurrences
+/// vectorize across systems; see lapack::gttrf_batch_interleaved.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in,out] DL
+///     The vectors DL_i of length n-1, strideD apart.
+///     On entry, the sub-diagonal of A_i.
+///     On exit, the n-1 multipliers that define L_i.
+///
+/// @param[in,out] D
+///     The vectors D_i of length n, strideD apart.
+///     On entry, the diagonal of A_i.
+///     On exit, the diagonal of U_i.
+///
+/// @param[in,out] DU
+///     The vectors DU_i of length n-1, strideD apart.
+///     On entry, the super-diagonal of A_i.
+///     On exit, the first super-diagonal of U_i.
+///
+/// @param[out] DU2
+///     The vectors DU2_i of length n-2, strideD apart.
+///     On exit, the second super-diagonal of U_i.
+///
+/// @param[in] strideD
+///     Distance between the starts of the vectors of consecutive
+///     systems. strideD >= n.
+///
+/// @param[out] ipiv
+///     The pivot vectors ipiv_i of length n, strideD apart; see
+///     lapack::gttrf.
+///
+/// @param[in] batch_size
+///     The number of matrices. batch_size >= 0.
+///
+/// @param[out] info
+///     The vector info of length batch_size.
+///     - info[i] = 0: A_i was factored successfully.
+///     - info[i] = k > 0: U_i(k,k) is exactly zero; see lapack::gttrf.
+///
+/// @return number of matrices with info[i] > 0.
+///
+/// @ingroup gtsv_computational
+int64_t gttrf_batch(
+    int64_t n,
+    std::complex<double>* DL, std::complex<double>* D, std::complex<double>* DU, std::complex<double>* DU2, int64_t strideD,
+    int64_t* ipiv,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::gttrf_batch(
+        n, DL, D, DU, DU2, strideD, ipiv, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gtsv_computational
+int64_t gttrf_batch_interleaved(
+    int64_t n,
+    float* DL, float* D, float* DU, float* DU2,
+    int64_t* ipiv, int64_t lanes,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::gttrf_batch_interleaved(
+        n, DL, D, DU, DU2, ipiv, lanes, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gtsv_computational
+int64_t gttrf_batch_interleaved(
+    int64_t n,
+    double* DL, double* D, double* DU, double* DU2,
+    int64_t* ipiv, int64_t lanes,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::gttrf_batch_interleaved(
+        n, DL, D, DU, DU2, ipiv, lanes, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gtsv_computational
+int64_t gttrf_batch_interleaved(
+    int64_t n,
+    std::complex<float>* DL, std::complex<float>* D, std::complex<float>* DU, std::complex<float>* DU2,
+    int64_t* ipiv, int64_t lanes,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::gttrf_batch_interleaved(
+        n, DL, D, DU, DU2, ipiv, lanes, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// Computes LU factorizations with partial pivoting of a batch of
+/// n-by-n tridiagonal matrices, in parallel; interleaved layout. See the
+/// strided form of lapack::gttrf_batch for details.
+///
+/// Vectors are stored "batch-innermost" in blocks of `lanes` systems:
+/// element j of a length-len vector (e.g., len = n-1 for DL) of system k
+/// is at
+///
+///     X[ (k / lanes)*len*lanes + j*lanes + (k % lanes) ],
+///
+/// and B likewise, with element (i, j) at
+/// B[ (k / lanes)*n*nrhs*lanes + (i + j*n)*lanes + (k % lanes) ].
+/// The same element of `lanes` consecutive systems is contiguous, so the
+/// inherently serial recurrence vectorizes across systems. Use a multiple
+/// of the SIMD width, e.g., lanes = 8 or 16. See lapack::batch_interleave
+/// to convert from the strided layout, treating each vector as a
+/// len-by-1 matrix.
+///
+/// The pivot choice is made per system, so systems in a block may pivot
+/// differently. A singular U_i produces infinities or NaNs in only its
+/// own system in a subsequent solve.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in,out] DL
+///     The interleaved vectors DL_i of length n-1.
+///     On entry, the sub-diagonal of A_i; on exit, the multipliers of L_i.
+///
+/// @param[in,out] D
+///     The interleaved vectors D_i of length n.
+///     On entry, the diagonal of A_i; on exit, the diagonal of U_i.
+///
+/// @param[in,out] DU
+///     The interleaved vectors DU_i of length n-1.
+///     On entry, the super-diagonal of A_i; on exit, the first
+///     super-diagonal of U_i.
+///
+/// @param[out] DU2
+///     The interleaved vectors DU2_i of length n-2.
+///     On exit, the second super-diagonal of U_i.
+///
+/// @param[out] ipiv
+///     The interleaved pivot vectors ipiv_i of length n; see lapack::gttrf.
+///
+/// @param[in] lanes
+///     The number of interleaved systems per block. lanes >= 1.
+///
+/// @param[in] batch_size
+///     The number of matrices. batch_size >= 0.
+///
+/// @param[out] info
+///     The vector info of length batch_size.
+///     - info[i] = 0: A_i was factored successfully.
+///     - info[i] = k > 0: U_i(k,k) is exactly zero.
+///
+/// @return number of matrices with info[i] > 0.
+///
+/// @ingroup gtsv_computational
+int64_t gttrf_batch_interleaved(
+    int64_t n,
+    std::complex<double>* DL, std::complex<double>* D, std::complex<double>* DU, std::complex<double>* DU2,
+    int64_t* ipiv, int64_t lanes,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::gttrf_batch_interleaved(
+        n, DL, D, DU, DU2, ipiv, lanes, batch_size, info );
+}
+
+}  // namespace lapack
@@ -0,0 +1,309 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "batch_internal.hh"
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper for the strided layout.
+/// @ingroup gtsv_computational
+///
+template <typename scalar_t>
+void gttrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    scalar_t const* DL, scalar_t const* D, scalar_t const* DU,
+    scalar_t const* DU2, int64_t strideD,
+    int64_t const* ipiv,
+    scalar_t* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size )
+{
+    lapack_error_if( trans != Op::NoTrans &&
+                     trans != Op::Trans &&
+                     trans != Op::ConjTrans );
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( strideD < n );
+    lapack_error_if( ldb < max( 1, n ) );
+    lapack_error_if( strideB < ldb * nrhs );
+    lapack_error_if( batch_size < 0 );
+    to_lapack_int( ldb );  // check for overflow
+
+    // Give each thread at least ~64K flops per range.
+    int64_t grain = (int64_t( 1 ) << 16) / max( 1, 8*n*nrhs );
+
+    internal::parallel_for( batch_size, grain, [&]( int64_t begin, int64_t end ) {
+        for (int64_t i = begin; i < end; ++i) {
+            int64_t offset = i * strideD;
+            lapack::gttrs(
+                trans, n, nrhs, DL + offset, D + offset, DU + offset,
+                DU2 + offset, ipiv + offset, B + i*strideB, ldb );
+        }
+    });
+}
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper for the interleaved layout.
+/// @ingroup gtsv_computational
+///
+template <typename scalar_t>
+void gttrs_batch_interleaved(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    scalar_t const* DL, scalar_t const* D, scalar_t const* DU,
+    scalar_t const* DU2, int64_t const* ipiv,
+    scalar_t* B, int64_t lanes,
+    int64_t batch_size )
+{
+    lapack_error_if( trans != Op::NoTrans &&
+                     trans != Op::Trans &&
+                     trans != Op::ConjTrans );
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( lanes < 1 );
+    lapack_error_if( batch_size < 0 );
+
+    int64_t n1 = max( 0, n - 1 );
+    int64_t n2 = max( 0, n - 2 );
+    int64_t nblocks = (batch_size + lanes - 1) / lanes;
+    int64_t grain = (int64_t( 1 ) << 16) / max( 1, lanes * 8*n*nrhs );
+
+    internal::parallel_for( nblocks, grain, [&]( int64_t begin, int64_t end ) {
+        for (int64_t b = begin; b < end; ++b) {
+            int64_t nlanes = min( lanes, batch_size - b*lanes );
+            internal::gttrs_interleaved(
+                trans, n, nrhs,
+                &DL[ b * n1*lanes ], &D[ b * n*lanes ], &DU[ b * n1*lanes ],
+                &DU2[ b * n2*lanes ], &ipiv[ b * n*lanes ],
+                &B[ b * n*nrhs*lanes ], lanes, nlanes );
+        }
+    });
+}
+
+}  // namespace impl
+
+//------------------------------------------------------------------------------
+/// @ingroup gtsv_computational
+void gttrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    float const* DL, float const* D, float const* DU, float const* DU2, int64_t strideD,
+    int64_t const* ipiv,
+    float* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size )
+{
+    impl::gttrs_batch(
+        trans, n, nrhs, DL, D, DU, DU2, strideD, ipiv,
+        B, ldb, strideB, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gtsv_computational
+void gttrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    double const* DL, double const* D, double const* DU, double const* DU2, int64_t strideD,
+    int64_t const* ipiv,
+    double* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size )
+{
+    impl::gttrs_batch(
+        trans, n, nrhs, DL, D, DU, DU2, strideD, ipiv,
+        B, ldb, strideB, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gtsv_computational
+void gttrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<float> const* DL, std::complex<float> const* D, std::complex<float> const* DU, std::complex<float> const* DU2, int64_t strideD,
+    int64_t const* ipiv,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size )
+{
+    impl::gttrs_batch(
+        trans, n, nrhs, DL, D, DU, DU2, strideD, ipiv,
+        B, ldb, strideB, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// Solves a batch of tridiagonal systems, in parallel,
+/// \[
+///     A_i X_i = B_i, \quad A_i^T X_i = B_i, \text{ or } A_i^H X_i = B_i,
+/// \]
+/// using the LU factorizations computed by lapack::gttrf_batch, as in
+/// lapack::gttrs.
+///
+/// Strided ("separate arrays") layout: the vectors of system i start at
+/// DL + i*strideD, D + i*strideD, and so on, and B_i at B + i*strideB.
+/// Each system is handled by LAPACK, in parallel over the batch. For many
+/// small systems, the interleaved layout is faster, since its recurrences
+/// vectorize across systems; see lapack::gttrs_batch_interleaved.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] trans
+///     The form of the systems of equations:
+///     - lapack::Op::NoTrans:   $A_i   X_i = B_i$ (No transpose)
+///     - lapack::Op::Trans:     $A_i^T X_i = B_i$ (Transpose)
+///     - lapack::Op::ConjTrans: $A_i^H X_i = B_i$ (Conjugate transpose)
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides, i.e., the number of columns
+///     of each B_i. nrhs >= 0.
+///
+/// @param[in] DL
+///     The vectors DL_i of length n-1, strideD apart, from
+///     lapack::gttrf_batch.
+///
+/// @param[in] D
+///     The vectors D_i of length n, strideD apart.
+///
+/// @param[in] DU
+///     The vectors DU_i of length n-1, strideD apart.
+///
+/// @param[in] DU2
+///     The vectors DU2_i of length n-2, strideD apart.
+///
+/// @param[in] strideD
+///     Distance between the starts of the vectors of consecutive
+///     systems. strideD >= n.
+///
+/// @param[in] ipiv
+///     The pivot vectors ipiv_i of length n, strideD apart.
+///
+/// @param[in,out] B
+///     The batch_size matrices B_i, each ldb-by-nrhs, strideB apart.
+///     On entry, the right hand sides; on exit, the solutions X_i.
+///
+/// @param[in] ldb
+///     The leading dimension of each B_i. ldb >= max(1,n).
+///
+/// @param[in] strideB
+///     Distance between the starts of B_i and B_{i+1}. strideB >= ldb*nrhs.
+///
+/// @param[in] batch_size
+///     The number of systems. batch_size >= 0.
+///
+/// @ingroup gtsv_computational
+void gttrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<double> const* DL, std::complex<double> const* D, std::complex<double> const* DU, std::complex<double> const* DU2, int64_t strideD,
+    int64_t const* ipiv,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size )
+{
+    impl::gttrs_batch(
+        trans, n, nrhs, DL, D, DU, DU2, strideD, ipiv,
+        B, ldb, strideB, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gtsv_computational
+void gttrs_batch_interleaved(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    float const* DL, float const* D, float const* DU, float const* DU2,
+    int64_t const* ipiv,
+    float* B, int64_t lanes,
+    int64_t batch_size )
+{
+    impl::gttrs_batch_interleaved(
+        trans, n, nrhs, DL, D, DU, DU2, ipiv, B, lanes, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gtsv_computational
+void gttrs_batch_interleaved(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    double const* DL, double const* D, double const* DU, double const* DU2,
+    int64_t const* ipiv,
+    double* B, int64_t lanes,
+    int64_t batch_size )
+{
+    impl::gttrs_batch_interleaved(
+        trans, n, nrhs, DL, D, DU, DU2, ipiv, B, lanes, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup gtsv_computational
+void gttrs_batch_interleaved(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<float> const* DL, std::complex<float> const* D, std::complex<float> const* DU, std::complex<float> const* DU2,
+    int64_t const* ipiv,
+    std::complex<float>* B, int64_t lanes,
+    int64_t batch_size )
+{
+    impl::gttrs_batch_interleaved(
+        trans, n, nrhs, DL, D, DU, DU2, ipiv, B, lanes, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// Solves a batch of tridiagonal systems, in parallel, using the LU
+/// factorizations computed by lapack::gttrf_batch_interleaved;
+/// interleaved layout. See the strided form of lapack::gttrs_batch for
+/// details, and lapack::gttrf_batch_interleaved for the layout.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] trans
+///     The form of the systems of equations:
+///     - lapack::Op::NoTrans:   $A_i   X_i = B_i$ (No transpose)
+///     - lapack::Op::Trans:     $A_i^T X_i = B_i$ (Transpose)
+///     - lapack::Op::ConjTrans: $A_i^H X_i = B_i$ (Conjugate transpose)
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides. nrhs >= 0.
+///
+/// @param[in] DL
+///     The interleaved vectors DL_i of length n-1.
+///
+/// @param[in] D
+///     The interleaved vectors D_i of length n.
+///
+/// @param[in] DU
+///     The interleaved vectors DU_i of length n-1.
+///
+/// @param[in] DU2
+///     The interleaved vectors DU2_i of length n-2.
+///
+/// @param[in] ipiv
+///     The interleaved pivot vectors ipiv_i of length n.
+///
+/// @param[in,out] B
+///     The interleaved n-by-nrhs matrices B_i.
+///     On entry, the right hand sides; on exit, the solutions X_i.
+///
+/// @param[in] lanes
+///     The number of interleaved systems per block. lanes >= 1.
+///
+/// @param[in] batch_size
+///     The number of systems. batch_size >= 0.
+///
+/// @ingroup gtsv_computational
+void gttrs_batch_interleaved(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<double> const* DL, std::complex<double> const* D, std::complex<double> const* DU, std::complex<double> const* DU2,
+    int64_t const* ipiv,
+    std::complex<double>* B, int64_t lanes,
+    int64_t batch_size )
+{
+    impl::gttrs_batch_interleaved(
+        trans, n, nrhs, DL, D, DU, DU2, ipiv, B, lanes, batch_size );
+}
+
+}  // namespace lapack
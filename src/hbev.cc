@@ -23,6 +23,7 @@ int64_t hbev(
     float* W,
     std::complex<float>* Z, int64_t ldz )
 {
+    internal::StatsScope stats_scope( "chbev" );
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -56,6 +57,7 @@ int64_t hbev(
     double* W,
     std::complex<double>* Z, int64_t ldz )
 {
+    internal::StatsScope stats_scope( "zhbev" );
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -26,6 +26,7 @@ int64_t hbevx(
     std::complex<float>* Z, int64_t ldz,
     int64_t* ifail )
 {
+    internal::StatsScope stats_scope( "chbevx" );
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     char uplo_ = to_char( uplo );
@@ -84,6 +85,7 @@ int64_t hbevx(
     std::complex<double>* Z, int64_t ldz,
     int64_t* ifail )
 {
+    internal::StatsScope stats_scope( "zhbevx" );
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     char uplo_ = to_char( uplo );
@@ -23,6 +23,7 @@ int64_t hbgst(
     std::complex<float> const* BB, int64_t ldbb,
     std::complex<float>* X, int64_t ldx )
 {
+    internal::StatsScope stats_scope( "chbgst" );
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -58,6 +59,7 @@ int64_t hbgst(
     std::complex<double> const* BB, int64_t ldbb,
     std::complex<double>* X, int64_t ldx )
 {
+    internal::StatsScope stats_scope( "zhbgst" );
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -24,6 +24,7 @@ int64_t hbgv(
     float* W,
     std::complex<float>* Z, int64_t ldz )
 {
+    internal::StatsScope stats_scope( "chbgv" );
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -61,6 +62,7 @@ int64_t hbgv(
     double* W,
     std::complex<double>* Z, int64_t ldz )
 {
+    internal::StatsScope stats_scope( "zhbgv" );
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack_internal.hh"
 #include "lapack/fortran.h"
+#include "work_size_cache.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -17,13 +18,22 @@ using blas::min;
 using blas::real;
 
 // -----------------------------------------------------------------------------
-int64_t hbgvd(
+void hbgvd_work_size(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
     std::complex<float>* AB, int64_t ldab,
     std::complex<float>* BB, int64_t ldbb,
     float* W,
-    std::complex<float>* Z, int64_t ldz )
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* lwork,
+    int64_t* lrwork,
+    int64_t* liwork )
 {
+    internal::StatsScope stats_scope( "chbgvd" );
+    internal::WorkSizeKey key( "chbgvd",
+        { to_char( jobz ), to_char( uplo ), n, ka, kb, ldab, ldbb, ldz } );
+    if (internal::work_size_cache_find( key, lwork, lrwork, liwork ))
+        return;
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -39,6 +49,7 @@ int64_t hbgvd(
     float qry_rwork[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_chbgvd(
         &jobz_, &uplo_, &n_, &ka_, &kb_,
         (lapack_complex_float*) AB, &ldab_,
@@ -49,6 +60,7 @@ int64_t hbgvd(
         qry_rwork, &ineg_one,
         qry_iwork, &ineg_one, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
@@ -59,10 +71,35 @@ int64_t hbgvd(
     // LAPACK <= 3.6.0 needed 2*n, but query returned n. Be safe.
     lrwork_ = max( lrwork_, 2*n_ );
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    *lwork = lwork_;
+    *lrwork = lrwork_;
+    *liwork = liwork_;
+    internal::work_size_cache_insert( key, *lwork, *lrwork, *liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t hbgvd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    std::complex<float>* AB, int64_t ldab,
+    std::complex<float>* BB, int64_t ldbb,
+    float* W,
+    std::complex<float>* Z, int64_t ldz,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    char jobz_ = to_char( jobz );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ka_ = to_lapack_int( ka );
+    lapack_int kb_ = to_lapack_int( kb );
+    lapack_int ldab_ = to_lapack_int( ldab );
+    lapack_int ldbb_ = to_lapack_int( ldbb );
+    lapack_int ldz_ = to_lapack_int( ldz );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int lrwork_ = to_lapack_int( lrwork );
+    lapack_int liwork_ = to_lapack_int( liwork );
+    lapack_int info_ = 0;
 
     LAPACK_chbgvd(
         &jobz_, &uplo_, &n_, &ka_, &kb_,
@@ -70,9 +107,9 @@ int64_t hbgvd(
         (lapack_complex_float*) BB, &ldbb_,
         W,
         (lapack_complex_float*) Z, &ldz_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0], &lrwork_,
-        &iwork[0], &liwork_, &info_
+        (lapack_complex_float*) work, &lwork_,
+        rwork, &lrwork_,
+        iwork, &liwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -82,12 +119,58 @@ int64_t hbgvd(
 
 // -----------------------------------------------------------------------------
 int64_t hbgvd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    std::complex<float>* AB, int64_t ldab,
+    std::complex<float>* BB, int64_t ldbb,
+    float* W,
+    std::complex<float>* Z, int64_t ldz )
+{
+    internal::StatsScope stats_scope( "chbgvd" );
+    int64_t lwork, lrwork, liwork;
+    hbgvd_work_size(
+        jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz,
+        &lwork, &lrwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return hbgvd(
+        jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz,
+        &work[0], lwork, &rwork[0], lrwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::hbgvd with caller-supplied workspace.
+/// Arguments are the same as for lapack::hbgvd; the matrices are not
+/// modified. The sizes can be reused for any call of the same shape.
+///
+/// @param[out] lwork
+///     Required length of the work array.
+///
+/// @param[out] lrwork
+///     Required length of the rwork array.
+///
+/// @param[out] liwork
+///     Required length of the iwork array.
+///
+void hbgvd_work_size(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
     std::complex<double>* AB, int64_t ldab,
     std::complex<double>* BB, int64_t ldbb,
     double* W,
-    std::complex<double>* Z, int64_t ldz )
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* lwork,
+    int64_t* lrwork,
+    int64_t* liwork )
 {
+    internal::StatsScope stats_scope( "zhbgvd" );
+    internal::WorkSizeKey key( "zhbgvd",
+        { to_char( jobz ), to_char( uplo ), n, ka, kb, ldab, ldbb, ldz } );
+    if (internal::work_size_cache_find( key, lwork, lrwork, liwork ))
+        return;
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -103,6 +186,7 @@ int64_t hbgvd(
     double qry_rwork[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_zhbgvd(
         &jobz_, &uplo_, &n_, &ka_, &kb_,
         (lapack_complex_double*) AB, &ldab_,
@@ -113,6 +197,7 @@ int64_t hbgvd(
         qry_rwork, &ineg_one,
         qry_iwork, &ineg_one, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
@@ -123,10 +208,57 @@ int64_t hbgvd(
     // LAPACK <= 3.6.0 needed 2*n, but query returned n. Be safe.
     lrwork_ = max( lrwork_, 2*n_ );
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    *lwork = lwork_;
+    *lrwork = lrwork_;
+    *liwork = liwork_;
+    internal::work_size_cache_insert( key, *lwork, *lrwork, *liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::hbgvd with caller-supplied workspace, which
+/// skips the internal workspace query and allocation. Other arguments
+/// are the same as for lapack::hbgvd.
+///
+/// @param[out] work
+///     Workspace of length lwork.
+///
+/// @param[in] lwork
+///     Length of work, at least as returned by lapack::hbgvd_work_size.
+///
+/// @param[out] rwork
+///     Workspace of length lrwork.
+///
+/// @param[in] lrwork
+///     Length of rwork, at least as returned by lapack::hbgvd_work_size.
+///
+/// @param[out] iwork
+///     Workspace of length liwork.
+///
+/// @param[in] liwork
+///     Length of iwork, at least as returned by lapack::hbgvd_work_size.
+///
+int64_t hbgvd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    std::complex<double>* AB, int64_t ldab,
+    std::complex<double>* BB, int64_t ldbb,
+    double* W,
+    std::complex<double>* Z, int64_t ldz,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    char jobz_ = to_char( jobz );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ka_ = to_lapack_int( ka );
+    lapack_int kb_ = to_lapack_int( kb );
+    lapack_int ldab_ = to_lapack_int( ldab );
+    lapack_int ldbb_ = to_lapack_int( ldbb );
+    lapack_int ldz_ = to_lapack_int( ldz );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int lrwork_ = to_lapack_int( lrwork );
+    lapack_int liwork_ = to_lapack_int( liwork );
+    lapack_int info_ = 0;
 
     LAPACK_zhbgvd(
         &jobz_, &uplo_, &n_, &ka_, &kb_,
@@ -134,9 +266,9 @@ int64_t hbgvd(
         (lapack_complex_double*) BB, &ldbb_,
         W,
         (lapack_complex_double*) Z, &ldz_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0], &lrwork_,
-        &iwork[0], &liwork_, &info_
+        (lapack_complex_double*) work, &lwork_,
+        rwork, &lrwork_,
+        iwork, &liwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -144,4 +276,28 @@ int64_t hbgvd(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+int64_t hbgvd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    std::complex<double>* AB, int64_t ldab,
+    std::complex<double>* BB, int64_t ldbb,
+    double* W,
+    std::complex<double>* Z, int64_t ldz )
+{
+    internal::StatsScope stats_scope( "zhbgvd" );
+    int64_t lwork, lrwork, liwork;
+    hbgvd_work_size(
+        jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz,
+        &lwork, &lrwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return hbgvd(
+        jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz,
+        &work[0], lwork, &rwork[0], lrwork, &iwork[0], liwork );
+}
+
 }  // namespace lapack
@@ -27,6 +27,7 @@ int64_t hbgvx(
     std::complex<float>* Z, int64_t ldz,
     int64_t* ifail )
 {
+    internal::StatsScope stats_scope( "chbgvx" );
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     char uplo_ = to_char( uplo );
@@ -89,6 +90,7 @@ int64_t hbgvx(
     std::complex<double>* Z, int64_t ldz,
     int64_t* ifail )
 {
+    internal::StatsScope stats_scope( "zhbgvx" );
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     char uplo_ = to_char( uplo );
@@ -24,6 +24,7 @@ int64_t hbtrd(
     float* E,
     std::complex<float>* Q, int64_t ldq )
 {
+    internal::StatsScope stats_scope( "chbtrd" );
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -57,6 +58,7 @@ int64_t hbtrd(
     double* E,
     std::complex<double>* Q, int64_t ldq )
 {
+    internal::StatsScope stats_scope( "zhbtrd" );
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -25,6 +25,7 @@ int64_t heequb(
     float* scond,
     float* amax )
 {
+    internal::StatsScope stats_scope( "cheequb" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -99,6 +100,7 @@ int64_t heequb(
     double* scond,
     double* amax )
 {
+    internal::StatsScope stats_scope( "zheequb" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -0,0 +1,312 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "batch_internal.hh"
+
+#include <atomic>
+#include <limits>
+
+namespace lapack {
+
+using blas::max;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Eigendecomposition of one 2-by-2 Hermitian matrix via laev2.
+template <typename scalar_t>
+int64_t heev2(
+    lapack::Job jobz, lapack::Uplo uplo,
+    scalar_t* A, int64_t lda, blas::real_type< scalar_t >* W )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using blas::conj;
+
+    scalar_t b = (uplo == Uplo::Upper ? A[ lda ] : conj( A[ 1 ] ));
+    real_t rt1, rt2, cs;
+    scalar_t sn;
+    internal::laev2_kernel( A[ 0 ], b, A[ 1 + lda ], rt1, rt2, cs, sn );
+
+    // (cs, sn) is the eigenvector for rt1, (-conj( sn ), cs) for rt2.
+    bool swap = (rt1 > rt2);
+    W[ 0 ] = (swap ? rt2 : rt1);
+    W[ 1 ] = (swap ? rt1 : rt2);
+    if (jobz == Job::Vec) {
+        scalar_t v1[ 2 ] = { cs, sn };
+        scalar_t v2[ 2 ] = { -conj( sn ), cs };
+        scalar_t* z0 = (swap ? v2 : v1);
+        scalar_t* z1 = (swap ? v1 : v2);
+        A[ 0 ]       = z0[ 0 ];
+        A[ 1 ]       = z0[ 1 ];
+        A[ lda ]     = z1[ 0 ];
+        A[ 1 + lda ] = z1[ 1 ];
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+/// Eigendecomposition of one 3-by-3 Hermitian matrix by cyclic Jacobi,
+/// with each rotation computed by laev2 on the 2-by-2 pivot submatrix,
+/// so the pivot entry is annihilated exactly. Jacobi is backward stable:
+/// the computed eigenvalues are exact for a matrix within O(eps) ||A||
+/// of A, as for heev. Convergence is quadratic; typically 3 to 5 sweeps.
+/// Returns 1 if it did not converge (only for Inf or NaN input).
+template <typename scalar_t>
+int64_t heev3(
+    lapack::Job jobz, lapack::Uplo uplo,
+    scalar_t* A, int64_t lda, blas::real_type< scalar_t >* W )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using blas::conj;
+    using blas::real;
+    const int max_sweeps = 16;
+    const real_t eps = std::numeric_limits< real_t >::epsilon();
+
+    // Load the full Hermitian matrix, a[ i ][ j ] = A(i, j).
+    scalar_t a[ 3 ][ 3 ];
+    real_t anorm = 0;
+    for (int j = 0; j < 3; ++j) {
+        for (int i = 0; i < 3; ++i) {
+            if (i == j) {
+                a[ i ][ i ] = real( A[ i + i*lda ] );
+            }
+            else if ((uplo == Uplo::Lower) == (i > j)) {
+                a[ i ][ j ] = A[ i + j*lda ];
+                a[ j ][ i ] = conj( a[ i ][ j ] );
+            }
+        }
+    }
+    for (int j = 0; j < 3; ++j)
+        for (int i = 0; i < 3; ++i)
+            anorm += std::norm( a[ i ][ j ] );
+    real_t tol = eps * std::sqrt( anorm );
+
+    scalar_t z[ 3 ][ 3 ] = { { 1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 1 } };
+    bool want_z = (jobz == Job::Vec);
+
+    // Rotation pairs (p, q) and the remaining index r.
+    static const int pqr[ 3 ][ 3 ] = { { 0, 1, 2 }, { 0, 2, 1 }, { 1, 2, 0 } };
+    int64_t info = 1;
+    for (int sweep = 0; sweep < max_sweeps; ++sweep) {
+        bool rotated = false;
+        for (int k = 0; k < 3; ++k) {
+            int p = pqr[ k ][ 0 ], q = pqr[ k ][ 1 ], r = pqr[ k ][ 2 ];
+            if (std::abs( a[ p ][ q ] ) <= tol)  // false for NaN
+                continue;
+            rotated = true;
+
+            // G = [ cs  -conj( sn ); sn  cs ] in (p, q) gives
+            // G^H A G with A(p, q) = 0.
+            real_t rt1, rt2, cs;
+            scalar_t sn;
+            internal::laev2_kernel( a[ p ][ p ], a[ p ][ q ], a[ q ][ q ],
+                                    rt1, rt2, cs, sn );
+            a[ p ][ p ] = rt1;
+            a[ q ][ q ] = rt2;
+            a[ p ][ q ] = 0;
+            a[ q ][ p ] = 0;
+            scalar_t arp = a[ r ][ p ];
+            scalar_t arq = a[ r ][ q ];
+            a[ r ][ p ] = arp*cs + arq*sn;
+            a[ r ][ q ] = arq*cs - arp*conj( sn );
+            a[ p ][ r ] = conj( a[ r ][ p ] );
+            a[ q ][ r ] = conj( a[ r ][ q ] );
+            if (want_z) {
+                for (int i = 0; i < 3; ++i) {
+                    scalar_t zip = z[ i ][ p ];
+                    scalar_t ziq = z[ i ][ q ];
+                    z[ i ][ p ] = zip*cs + ziq*sn;
+                    z[ i ][ q ] = ziq*cs - zip*conj( sn );
+                }
+            }
+        }
+        if (! rotated) {
+            info = 0;
+            break;
+        }
+    }
+
+    // Sort eigenvalues in ascending order, as heev does.
+    int perm[ 3 ] = { 0, 1, 2 };
+    real_t d[ 3 ] = { real( a[ 0 ][ 0 ] ), real( a[ 1 ][ 1 ] ), real( a[ 2 ][ 2 ] ) };
+    if (d[ perm[ 1 ] ] < d[ perm[ 0 ] ]) std::swap( perm[ 0 ], perm[ 1 ] );
+    if (d[ perm[ 2 ] ] < d[ perm[ 1 ] ]) std::swap( perm[ 1 ], perm[ 2 ] );
+    if (d[ perm[ 1 ] ] < d[ perm[ 0 ] ]) std::swap( perm[ 0 ], perm[ 1 ] );
+    for (int j = 0; j < 3; ++j) {
+        W[ j ] = d[ perm[ j ] ];
+        if (want_z) {
+            for (int i = 0; i < 3; ++i)
+                A[ i + j*lda ] = z[ i ][ perm[ j ] ];
+        }
+    }
+    return info;
+}
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper.
+/// @ingroup heev
+///
+template <typename scalar_t>
+int64_t heev_small_batch(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda, int64_t strideA,
+    blas::real_type< scalar_t >* W, int64_t strideW,
+    int64_t batch_size, int64_t* info )
+{
+    lapack_error_if( jobz != Job::NoVec && jobz != Job::Vec );
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 || n > 3 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( strideA < lda * n );
+    lapack_error_if( strideW < n );
+    lapack_error_if( batch_size < 0 );
+
+    // Dispatch on n once, outside the loop.
+    auto body = [&]( auto kernel ) {
+        std::atomic< int64_t > nfailed { 0 };
+        internal::parallel_for( batch_size, 1 << 10, [&]( int64_t begin, int64_t end ) {
+            int64_t count = 0;
+            for (int64_t i = begin; i < end; ++i) {
+                info[ i ] = kernel( &A[ i*strideA ], &W[ i*strideW ] );
+                if (info[ i ] != 0)
+                    ++count;
+            }
+            nfailed += count;
+        });
+        return int64_t( nfailed );
+    };
+
+    using real_t = blas::real_type< scalar_t >;
+    switch (n) {
+        case 0:
+            return body( []( scalar_t*, real_t* ) {
+                return int64_t( 0 );
+            });
+        case 1:
+            return body( [&]( scalar_t* Ai, real_t* Wi ) {
+                Wi[ 0 ] = blas::real( Ai[ 0 ] );
+                if (jobz == Job::Vec)
+                    Ai[ 0 ] = 1;
+                return int64_t( 0 );
+            });
+        case 2:
+            return body( [&]( scalar_t* Ai, real_t* Wi ) {
+                return heev2( jobz, uplo, Ai, lda, Wi );
+            });
+        default:
+            return body( [&]( scalar_t* Ai, real_t* Wi ) {
+                return heev3( jobz, uplo, Ai, lda, Wi );
+            });
+    }
+}
+
+}  // namespace impl
+
+
+/// @ingroup heev
+int64_t heev_small_batch(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, int64_t strideA,
+    float* W, int64_t strideW,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::heev_small_batch(
+        jobz, uplo, n, A, lda, strideA, W, strideW, batch_size, info );
+}
+
+
+/// @ingroup heev
+int64_t heev_small_batch(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, int64_t strideA,
+    double* W, int64_t strideW,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::heev_small_batch(
+        jobz, uplo, n, A, lda, strideA, W, strideW, batch_size, info );
+}
+
+
+/// @ingroup heev
+int64_t heev_small_batch(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    float* W, int64_t strideW,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::heev_small_batch(
+        jobz, uplo, n, A, lda, strideA, W, strideW, batch_size, info );
+}
+
+
+/// Computes all eigenvalues and, optionally, eigenvectors of a batch of
+/// small Hermitian matrices, n <= 3, in parallel; a fast replacement for
+/// calling lapack::heev on each, e.g., for stress or diffusion tensors.
+///
+/// For n = 2, this uses the closed-form lapack::laev2 arithmetic. For
+/// n = 3, it uses cyclic Jacobi with laev2 rotations. Both are backward
+/// stable: eigenvalue errors are O(eps) ||A_i||, and eigenvectors are
+/// orthonormal to O(eps), as with heev. Eigenvalues are in ascending
+/// order, as in heev; eigenvectors may differ from heev's by a phase.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+/// For real matrices, this computes symmetric eigendecompositions.
+///
+/// @param[in] jobz
+///     - lapack::Job::NoVec: Compute eigenvalues only; A is not modified;
+///     - lapack::Job::Vec:   Compute eigenvalues and eigenvectors.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: Upper triangles of A_i are stored;
+///     - lapack::Uplo::Lower: Lower triangles of A_i are stored.
+///
+/// @param[in] n
+///     The order of each matrix A_i. 0 <= n <= 3.
+///
+/// @param[in,out] A
+///     The batch_size matrices A_i, each lda-by-n, strideA apart.
+///     On exit, if jobz = Vec, A_i contains the orthonormal eigenvectors
+///     of A_i.
+///
+/// @param[in] lda
+///     The leading dimension of each A_i. lda >= max(1,n).
+///
+/// @param[in] strideA
+///     Distance between the starts of A_i and A_{i+1}. strideA >= lda*n.
+///
+/// @param[out] W
+///     The eigenvalues of A_i, in ascending order, are in
+///     W[ i*strideW ], ..., W[ i*strideW + n-1 ].
+///
+/// @param[in] strideW
+///     Distance between the eigenvalues of A_i and A_{i+1}. strideW >= n.
+///
+/// @param[in] batch_size
+///     The number of matrices. batch_size >= 0.
+///
+/// @param[out] info
+///     The vector info of length batch_size.
+///     - info[i] = 0: successful exit.
+///     - info[i] > 0: the iteration did not converge; only possible for
+///       input with Inf or NaN.
+///
+/// @return number of matrices with info[i] > 0.
+///
+/// @ingroup heev
+int64_t heev_small_batch(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    double* W, int64_t strideW,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::heev_small_batch(
+        jobz, uplo, n, A, lda, strideA, W, strideW, batch_size, info );
+}
+
+}  // namespace lapack
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack_internal.hh"
 #include "lapack/fortran.h"
+#include "work_size_cache.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -17,15 +18,23 @@ using blas::min;
 using blas::real;
 
 // -----------------------------------------------------------------------------
-int64_t hgeqz(
+void hgeqz_work_size(
     lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
     float* H, int64_t ldh,
     float* T, int64_t ldt,
     std::complex<float>* alpha,
     float* beta,
     float* Q, int64_t ldq,
-    float* Z, int64_t ldz )
+    float* Z, int64_t ldz,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "shgeqz" );
+    internal::WorkSizeKey key( "shgeqz",
+        { to_char( jobschur ), to_char( compq ), to_char( compz ), n, ilo, ihi,
+          ldh, ldt, ldq, ldz } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     char jobschur_ = to_char( jobschur );
     char compq_ = to_char_comp( compq );
     char compz_ = to_char_comp( compz );
@@ -45,6 +54,7 @@ int64_t hgeqz(
     // query for workspace size
     float qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_shgeqz(
         &jobschur_, &compq_, &compz_, &n_, &ilo_, &ihi_,
         H, &ldh_,
@@ -56,13 +66,41 @@ int64_t hgeqz(
         Z, &ldz_,
         qry_work, &ineg_one, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+// -----------------------------------------------------------------------------
+int64_t hgeqz(
+    lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    float* H, int64_t ldh,
+    float* T, int64_t ldt,
+    std::complex<float>* alpha,
+    float* beta,
+    float* Q, int64_t ldq,
+    float* Z, int64_t ldz,
+    float* work, int64_t lwork )
+{
+    char jobschur_ = to_char( jobschur );
+    char compq_ = to_char_comp( compq );
+    char compz_ = to_char_comp( compz );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ilo_ = to_lapack_int( ilo );
+    lapack_int ihi_ = to_lapack_int( ihi );
+    lapack_int ldh_ = to_lapack_int( ldh );
+    lapack_int ldt_ = to_lapack_int( ldt );
+    lapack_int ldq_ = to_lapack_int( ldq );
+    lapack_int ldz_ = to_lapack_int( ldz );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
+
+    // split-complex representation
+    lapack::vector< float > alphar( max( 1, n ) );
+    lapack::vector< float > alphai( max( 1, n ) );
 
     LAPACK_shgeqz(
         &jobschur_, &compq_, &compz_, &n_, &ilo_, &ihi_,
@@ -73,7 +111,7 @@ int64_t hgeqz(
         beta,
         Q, &ldq_,
         Z, &ldz_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -87,14 +125,48 @@ int64_t hgeqz(
 
 // -----------------------------------------------------------------------------
 int64_t hgeqz(
+    lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    float* H, int64_t ldh,
+    float* T, int64_t ldt,
+    std::complex<float>* alpha,
+    float* beta,
+    float* Q, int64_t ldq,
+    float* Z, int64_t ldz )
+{
+    internal::StatsScope stats_scope( "shgeqz" );
+    int64_t lwork;
+    hgeqz_work_size(
+        jobschur, compq, compz, n, ilo, ihi, H, ldh, T, ldt, alpha, beta, Q,
+        ldq, Z, ldz,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return hgeqz(
+        jobschur, compq, compz, n, ilo, ihi, H, ldh, T, ldt, alpha, beta, Q,
+        ldq, Z, ldz,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+void hgeqz_work_size(
     lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
     double* H, int64_t ldh,
     double* T, int64_t ldt,
     std::complex<double>* alpha,
     double* beta,
     double* Q, int64_t ldq,
-    double* Z, int64_t ldz )
+    double* Z, int64_t ldz,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "dhgeqz" );
+    internal::WorkSizeKey key( "dhgeqz",
+        { to_char( jobschur ), to_char( compq ), to_char( compz ), n, ilo, ihi,
+          ldh, ldt, ldq, ldz } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     char jobschur_ = to_char( jobschur );
     char compq_ = to_char_comp( compq );
     char compz_ = to_char_comp( compz );
@@ -114,6 +186,7 @@ int64_t hgeqz(
     // query for workspace size
     double qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_dhgeqz(
         &jobschur_, &compq_, &compz_, &n_, &ilo_, &ihi_,
         H, &ldh_,
@@ -125,13 +198,41 @@ int64_t hgeqz(
         Z, &ldz_,
         qry_work, &ineg_one, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+// -----------------------------------------------------------------------------
+int64_t hgeqz(
+    lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    double* H, int64_t ldh,
+    double* T, int64_t ldt,
+    std::complex<double>* alpha,
+    double* beta,
+    double* Q, int64_t ldq,
+    double* Z, int64_t ldz,
+    double* work, int64_t lwork )
+{
+    char jobschur_ = to_char( jobschur );
+    char compq_ = to_char_comp( compq );
+    char compz_ = to_char_comp( compz );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ilo_ = to_lapack_int( ilo );
+    lapack_int ihi_ = to_lapack_int( ihi );
+    lapack_int ldh_ = to_lapack_int( ldh );
+    lapack_int ldt_ = to_lapack_int( ldt );
+    lapack_int ldq_ = to_lapack_int( ldq );
+    lapack_int ldz_ = to_lapack_int( ldz );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
+
+    // split-complex representation
+    lapack::vector< double > alphar( max( 1, n ) );
+    lapack::vector< double > alphai( max( 1, n ) );
 
     LAPACK_dhgeqz(
         &jobschur_, &compq_, &compz_, &n_, &ilo_, &ihi_,
@@ -142,7 +243,7 @@ int64_t hgeqz(
         beta,
         Q, &ldq_,
         Z, &ldz_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -156,14 +257,49 @@ int64_t hgeqz(
 
 // -----------------------------------------------------------------------------
 int64_t hgeqz(
+    lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    double* H, int64_t ldh,
+    double* T, int64_t ldt,
+    std::complex<double>* alpha,
+    double* beta,
+    double* Q, int64_t ldq,
+    double* Z, int64_t ldz )
+{
+    internal::StatsScope stats_scope( "dhgeqz" );
+    int64_t lwork;
+    hgeqz_work_size(
+        jobschur, compq, compz, n, ilo, ihi, H, ldh, T, ldt, alpha, beta, Q,
+        ldq, Z, ldz,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return hgeqz(
+        jobschur, compq, compz, n, ilo, ihi, H, ldh, T, ldt, alpha, beta, Q,
+        ldq, Z, ldz,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+void hgeqz_work_size(
     lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
     std::complex<float>* H, int64_t ldh,
     std::complex<float>* T, int64_t ldt,
     std::complex<float>* alpha,
     std::complex<float>* beta,
     std::complex<float>* Q, int64_t ldq,
-    std::complex<float>* Z, int64_t ldz )
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* lwork,
+    int64_t* lrwork )
 {
+    internal::StatsScope stats_scope( "chgeqz" );
+    internal::WorkSizeKey key( "chgeqz",
+        { to_char( jobschur ), to_char( compq ), to_char( compz ), n, ilo, ihi,
+          ldh, ldt, ldq, ldz } );
+    if (internal::work_size_cache_find( key, lwork, lrwork ))
+        return;
+
     char jobschur_ = to_char( jobschur );
     char compq_ = to_char_comp( compq );
     char compz_ = to_char_comp( compz );
@@ -180,6 +316,7 @@ int64_t hgeqz(
     std::complex<float> qry_work[1];
     float qry_rwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_chgeqz(
         &jobschur_, &compq_, &compz_, &n_, &ilo_, &ihi_,
         (lapack_complex_float*) H, &ldh_,
@@ -191,14 +328,40 @@ int64_t hgeqz(
         (lapack_complex_float*) qry_work, &ineg_one,
         qry_rwork, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    *lrwork = n;
+    internal::work_size_cache_insert( key, *lwork, *lrwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (n) );
+// -----------------------------------------------------------------------------
+int64_t hgeqz(
+    lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<float>* H, int64_t ldh,
+    std::complex<float>* T, int64_t ldt,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* Z, int64_t ldz,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork )
+{
+    char jobschur_ = to_char( jobschur );
+    char compq_ = to_char_comp( compq );
+    char compz_ = to_char_comp( compz );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ilo_ = to_lapack_int( ilo );
+    lapack_int ihi_ = to_lapack_int( ihi );
+    lapack_int ldh_ = to_lapack_int( ldh );
+    lapack_int ldt_ = to_lapack_int( ldt );
+    lapack_int ldq_ = to_lapack_int( ldq );
+    lapack_int ldz_ = to_lapack_int( ldz );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( lrwork < n );
+    lapack_int info_ = 0;
 
     LAPACK_chgeqz(
         &jobschur_, &compq_, &compz_, &n_, &ilo_, &ihi_,
@@ -208,8 +371,8 @@ int64_t hgeqz(
         (lapack_complex_float*) beta,
         (lapack_complex_float*) Q, &ldq_,
         (lapack_complex_float*) Z, &ldz_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0], &info_
+        (lapack_complex_float*) work, &lwork_,
+        rwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -219,14 +382,60 @@ int64_t hgeqz(
 
 // -----------------------------------------------------------------------------
 int64_t hgeqz(
+    lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<float>* H, int64_t ldh,
+    std::complex<float>* T, int64_t ldt,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* Z, int64_t ldz )
+{
+    internal::StatsScope stats_scope( "chgeqz" );
+    int64_t lwork, lrwork;
+    hgeqz_work_size(
+        jobschur, compq, compz, n, ilo, ihi, H, ldh, T, ldt, alpha, beta, Q,
+        ldq, Z, ldz,
+        &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+
+    return hgeqz(
+        jobschur, compq, compz, n, ilo, ihi, H, ldh, T, ldt, alpha, beta, Q,
+        ldq, Z, ldz,
+        &work[0], lwork, &rwork[0], lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::hgeqz with caller-supplied workspace.
+/// Arguments are the same as for lapack::hgeqz; the matrices are not
+/// modified. The sizes can be reused for any call of the same shape.
+///
+/// @param[out] lwork
+///     Required length of the work array.
+///
+/// @param[out] lrwork
+///     Required length of the rwork array.
+///
+void hgeqz_work_size(
     lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
     std::complex<double>* H, int64_t ldh,
     std::complex<double>* T, int64_t ldt,
     std::complex<double>* alpha,
     std::complex<double>* beta,
     std::complex<double>* Q, int64_t ldq,
-    std::complex<double>* Z, int64_t ldz )
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* lwork,
+    int64_t* lrwork )
 {
+    internal::StatsScope stats_scope( "zhgeqz" );
+    internal::WorkSizeKey key( "zhgeqz",
+        { to_char( jobschur ), to_char( compq ), to_char( compz ), n, ilo, ihi,
+          ldh, ldt, ldq, ldz } );
+    if (internal::work_size_cache_find( key, lwork, lrwork ))
+        return;
+
     char jobschur_ = to_char( jobschur );
     char compq_ = to_char_comp( compq );
     char compz_ = to_char_comp( compz );
@@ -243,6 +452,7 @@ int64_t hgeqz(
     std::complex<double> qry_work[1];
     double qry_rwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_zhgeqz(
         &jobschur_, &compq_, &compz_, &n_, &ilo_, &ihi_,
         (lapack_complex_double*) H, &ldh_,
@@ -254,14 +464,56 @@ int64_t hgeqz(
         (lapack_complex_double*) qry_work, &ineg_one,
         qry_rwork, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    *lrwork = n;
+    internal::work_size_cache_insert( key, *lwork, *lrwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (n) );
+// -----------------------------------------------------------------------------
+/// Variant of lapack::hgeqz with caller-supplied workspace, which
+/// skips the internal workspace query and allocation. Other arguments
+/// are the same as for lapack::hgeqz.
+///
+/// @param[out] work
+///     Workspace of length lwork.
+///
+/// @param[in] lwork
+///     Length of work, at least as returned by lapack::hgeqz_work_size.
+///
+/// @param[out] rwork
+///     Workspace of length lrwork.
+///
+/// @param[in] lrwork
+///     Length of rwork, at least as returned by lapack::hgeqz_work_size.
+///
+int64_t hgeqz(
+    lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<double>* H, int64_t ldh,
+    std::complex<double>* T, int64_t ldt,
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* Z, int64_t ldz,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork )
+{
+    char jobschur_ = to_char( jobschur );
+    char compq_ = to_char_comp( compq );
+    char compz_ = to_char_comp( compz );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ilo_ = to_lapack_int( ilo );
+    lapack_int ihi_ = to_lapack_int( ihi );
+    lapack_int ldh_ = to_lapack_int( ldh );
+    lapack_int ldt_ = to_lapack_int( ldt );
+    lapack_int ldq_ = to_lapack_int( ldq );
+    lapack_int ldz_ = to_lapack_int( ldz );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( lrwork < n );
+    lapack_int info_ = 0;
 
     LAPACK_zhgeqz(
         &jobschur_, &compq_, &compz_, &n_, &ilo_, &ihi_,
@@ -271,8 +523,8 @@ int64_t hgeqz(
         (lapack_complex_double*) beta,
         (lapack_complex_double*) Q, &ldq_,
         (lapack_complex_double*) Z, &ldz_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0], &info_
+        (lapack_complex_double*) work, &lwork_,
+        rwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -280,4 +532,31 @@ int64_t hgeqz(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+int64_t hgeqz(
+    lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<double>* H, int64_t ldh,
+    std::complex<double>* T, int64_t ldt,
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* Z, int64_t ldz )
+{
+    internal::StatsScope stats_scope( "zhgeqz" );
+    int64_t lwork, lrwork;
+    hgeqz_work_size(
+        jobschur, compq, compz, n, ilo, ihi, H, ldh, T, ldt, alpha, beta, Q,
+        ldq, Z, ldz,
+        &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+
+    return hgeqz(
+        jobschur, compq, compz, n, ilo, ihi, H, ldh, T, ldt, alpha, beta, Q,
+        ldq, Z, ldz,
+        &work[0], lwork, &rwork[0], lrwork );
+}
+
 }  // namespace lapack
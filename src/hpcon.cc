@@ -23,11 +23,12 @@ int64_t hpcon(
     int64_t const* ipiv, float anorm,
     float* rcond )
 {
+    internal::StatsScope stats_scope( "chpcon" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -56,11 +57,12 @@ int64_t hpcon(
     int64_t const* ipiv, double anorm,
     double* rcond )
 {
+    internal::StatsScope stats_scope( "zhpcon" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -82,4 +84,64 @@ int64_t hpcon(
     return info_;
 }
 
+#ifndef LAPACK_ILP64
+
+// -----------------------------------------------------------------------------
+int64_t hpcon(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float> const* AP,
+    lapack_int const* ipiv, float anorm,
+    float* rcond )
+{
+    internal::StatsScope stats_scope( "chpcon" );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int const* ipiv_ptr = ipiv;
+    lapack_int info_ = 0;
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( (2*n) );
+
+    LAPACK_chpcon(
+        &uplo_, &n_,
+        (lapack_complex_float*) AP,
+        ipiv_ptr, &anorm, rcond,
+        (lapack_complex_float*) &work[0], &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t hpcon(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double> const* AP,
+    lapack_int const* ipiv, double anorm,
+    double* rcond )
+{
+    internal::StatsScope stats_scope( "zhpcon" );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int const* ipiv_ptr = ipiv;
+    lapack_int info_ = 0;
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( (2*n) );
+
+    LAPACK_zhpcon(
+        &uplo_, &n_,
+        (lapack_complex_double*) AP,
+        ipiv_ptr, &anorm, rcond,
+        (lapack_complex_double*) &work[0], &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+#endif  // LAPACK_ILP64
+
 }  // namespace lapack
@@ -23,6 +23,7 @@ int64_t hpev(
     float* W,
     std::complex<float>* Z, int64_t ldz )
 {
+    internal::StatsScope stats_scope( "chpev" );
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -54,6 +55,7 @@ int64_t hpev(
     double* W,
     std::complex<double>* Z, int64_t ldz )
 {
+    internal::StatsScope stats_scope( "zhpev" );
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -25,6 +25,7 @@ int64_t hpevx(
     std::complex<float>* Z, int64_t ldz,
     int64_t* ifail )
 {
+    internal::StatsScope stats_scope( "chpevx" );
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     char uplo_ = to_char( uplo );
@@ -78,6 +79,7 @@ int64_t hpevx(
     std::complex<double>* Z, int64_t ldz,
     int64_t* ifail )
 {
+    internal::StatsScope stats_scope( "zhpevx" );
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     char uplo_ = to_char( uplo );
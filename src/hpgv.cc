@@ -24,6 +24,7 @@ int64_t hpgv(
     float* W,
     std::complex<float>* Z, int64_t ldz )
 {
+    internal::StatsScope stats_scope( "chpgv" );
     lapack_int itype_ = to_lapack_int( itype );
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
@@ -58,6 +59,7 @@ int64_t hpgv(
     double* W,
     std::complex<double>* Z, int64_t ldz )
 {
+    internal::StatsScope stats_scope( "zhpgv" );
     lapack_int itype_ = to_lapack_int( itype );
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
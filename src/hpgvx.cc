@@ -26,6 +26,7 @@ int64_t hpgvx(
     std::complex<float>* Z, int64_t ldz,
     int64_t* ifail )
 {
+    internal::StatsScope stats_scope( "chpgvx" );
     lapack_int itype_ = to_lapack_int( itype );
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
@@ -82,6 +83,7 @@ int64_t hpgvx(
     std::complex<double>* Z, int64_t ldz,
     int64_t* ifail )
 {
+    internal::StatsScope stats_scope( "zhpgvx" );
     lapack_int itype_ = to_lapack_int( itype );
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
@@ -22,6 +22,7 @@ int64_t hptrf(
     std::complex<float>* AP,
     int64_t* ipiv )
 {
+    internal::StatsScope stats_scope( "chptrf" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     #ifndef LAPACK_ILP64
@@ -53,6 +54,7 @@ int64_t hptrf(
     std::complex<double>* AP,
     int64_t* ipiv )
 {
+    internal::StatsScope stats_scope( "zhptrf" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     #ifndef LAPACK_ILP64
@@ -78,4 +80,52 @@ int64_t hptrf(
     return info_;
 }
 
+#ifndef LAPACK_ILP64
+
+// -----------------------------------------------------------------------------
+int64_t hptrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* AP,
+    lapack_int* ipiv )
+{
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int* ipiv_ptr = ipiv;
+    lapack_int info_ = 0;
+
+    LAPACK_chptrf(
+        &uplo_, &n_,
+        (lapack_complex_float*) AP,
+        ipiv_ptr, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t hptrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* AP,
+    lapack_int* ipiv )
+{
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int* ipiv_ptr = ipiv;
+    lapack_int info_ = 0;
+
+    LAPACK_zhptrf(
+        &uplo_, &n_,
+        (lapack_complex_double*) AP,
+        ipiv_ptr, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+#endif  // LAPACK_ILP64
+
 }  // namespace lapack
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack_internal.hh"
 #include "lapack/fortran.h"
+#include "work_size_cache.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -18,12 +19,19 @@ using blas::real;
 
 // -----------------------------------------------------------------------------
 /// @ingroup geev_computational
-int64_t hseqr(
+void hseqr_work_size(
     lapack::JobSchur jobschur, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
     float* H, int64_t ldh,
     std::complex<float>* W,
-    float* Z, int64_t ldz )
+    float* Z, int64_t ldz,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "shseqr" );
+    internal::WorkSizeKey key( "shseqr",
+        { to_char( jobschur ), to_char( compz ), n, ilo, ihi, ldh, ldz } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     char jobschur_ = to_char( jobschur );
     char compz_ = to_char_comp( compz );
     lapack_int n_ = to_lapack_int( n );
@@ -40,6 +48,7 @@ int64_t hseqr(
     // query for workspace size
     float qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_shseqr(
         &jobschur_, &compz_, &n_, &ilo_, &ihi_,
         H, &ldh_,
@@ -48,13 +57,36 @@ int64_t hseqr(
         Z, &ldz_,
         qry_work, &ineg_one, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+int64_t hseqr(
+    lapack::JobSchur jobschur, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    float* H, int64_t ldh,
+    std::complex<float>* W,
+    float* Z, int64_t ldz,
+    float* work, int64_t lwork )
+{
+    char jobschur_ = to_char( jobschur );
+    char compz_ = to_char_comp( compz );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ilo_ = to_lapack_int( ilo );
+    lapack_int ihi_ = to_lapack_int( ihi );
+    lapack_int ldh_ = to_lapack_int( ldh );
+    lapack_int ldz_ = to_lapack_int( ldz );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
+
+    // split-complex representation
+    lapack::vector< float > WR( max( 1, n ) );
+    lapack::vector< float > WI( max( 1, n ) );
 
     LAPACK_shseqr(
         &jobschur_, &compz_, &n_, &ilo_, &ihi_,
@@ -62,7 +94,7 @@ int64_t hseqr(
         &WR[0],
         &WI[0],
         Z, &ldz_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -77,11 +109,40 @@ int64_t hseqr(
 // -----------------------------------------------------------------------------
 /// @ingroup geev_computational
 int64_t hseqr(
+    lapack::JobSchur jobschur, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    float* H, int64_t ldh,
+    std::complex<float>* W,
+    float* Z, int64_t ldz )
+{
+    internal::StatsScope stats_scope( "shseqr" );
+    int64_t lwork;
+    hseqr_work_size(
+        jobschur, compz, n, ilo, ihi, H, ldh, W, Z, ldz,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return hseqr(
+        jobschur, compz, n, ilo, ihi, H, ldh, W, Z, ldz,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+void hseqr_work_size(
     lapack::JobSchur jobschur, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
     double* H, int64_t ldh,
     std::complex<double>* W,
-    double* Z, int64_t ldz )
+    double* Z, int64_t ldz,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "dhseqr" );
+    internal::WorkSizeKey key( "dhseqr",
+        { to_char( jobschur ), to_char( compz ), n, ilo, ihi, ldh, ldz } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     char jobschur_ = to_char( jobschur );
     char compz_ = to_char_comp( compz );
     lapack_int n_ = to_lapack_int( n );
@@ -98,6 +159,7 @@ int64_t hseqr(
     // query for workspace size
     double qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_dhseqr(
         &jobschur_, &compz_, &n_, &ilo_, &ihi_,
         H, &ldh_,
@@ -106,13 +168,36 @@ int64_t hseqr(
         Z, &ldz_,
         qry_work, &ineg_one, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+int64_t hseqr(
+    lapack::JobSchur jobschur, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    double* H, int64_t ldh,
+    std::complex<double>* W,
+    double* Z, int64_t ldz,
+    double* work, int64_t lwork )
+{
+    char jobschur_ = to_char( jobschur );
+    char compz_ = to_char_comp( compz );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ilo_ = to_lapack_int( ilo );
+    lapack_int ihi_ = to_lapack_int( ihi );
+    lapack_int ldh_ = to_lapack_int( ldh );
+    lapack_int ldz_ = to_lapack_int( ldz );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
+
+    // split-complex representation
+    lapack::vector< double > WR( max( 1, n ) );
+    lapack::vector< double > WI( max( 1, n ) );
 
     LAPACK_dhseqr(
         &jobschur_, &compz_, &n_, &ilo_, &ihi_,
@@ -120,7 +205,7 @@ int64_t hseqr(
         &WR[0],
         &WI[0],
         Z, &ldz_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -135,11 +220,40 @@ int64_t hseqr(
 // -----------------------------------------------------------------------------
 /// @ingroup geev_computational
 int64_t hseqr(
+    lapack::JobSchur jobschur, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    double* H, int64_t ldh,
+    std::complex<double>* W,
+    double* Z, int64_t ldz )
+{
+    internal::StatsScope stats_scope( "dhseqr" );
+    int64_t lwork;
+    hseqr_work_size(
+        jobschur, compz, n, ilo, ihi, H, ldh, W, Z, ldz,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return hseqr(
+        jobschur, compz, n, ilo, ihi, H, ldh, W, Z, ldz,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+void hseqr_work_size(
     lapack::JobSchur jobschur, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
     std::complex<float>* H, int64_t ldh,
     std::complex<float>* W,
-    std::complex<float>* Z, int64_t ldz )
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "chseqr" );
+    internal::WorkSizeKey key( "chseqr",
+        { to_char( jobschur ), to_char( compz ), n, ilo, ihi, ldh, ldz } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     char jobschur_ = to_char( jobschur );
     char compz_ = to_char_comp( compz );
     lapack_int n_ = to_lapack_int( n );
@@ -152,6 +266,7 @@ int64_t hseqr(
     // query for workspace size
     std::complex<float> qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_chseqr(
         &jobschur_, &compz_, &n_, &ilo_, &ihi_,
         (lapack_complex_float*) H, &ldh_,
@@ -159,20 +274,153 @@ int64_t hseqr(
         (lapack_complex_float*) Z, &ldz_,
         (lapack_complex_float*) qry_work, &ineg_one, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+int64_t hseqr(
+    lapack::JobSchur jobschur, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<float>* H, int64_t ldh,
+    std::complex<float>* W,
+    std::complex<float>* Z, int64_t ldz,
+    std::complex<float>* work, int64_t lwork )
+{
+    char jobschur_ = to_char( jobschur );
+    char compz_ = to_char_comp( compz );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ilo_ = to_lapack_int( ilo );
+    lapack_int ihi_ = to_lapack_int( ihi );
+    lapack_int ldh_ = to_lapack_int( ldh );
+    lapack_int ldz_ = to_lapack_int( ldz );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_chseqr(
         &jobschur_, &compz_, &n_, &ilo_, &ihi_,
         (lapack_complex_float*) H, &ldh_,
         (lapack_complex_float*) W,
         (lapack_complex_float*) Z, &ldz_,
-        (lapack_complex_float*) &work[0], &lwork_, &info_
+        (lapack_complex_float*) work, &lwork_, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+int64_t hseqr(
+    lapack::JobSchur jobschur, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<float>* H, int64_t ldh,
+    std::complex<float>* W,
+    std::complex<float>* Z, int64_t ldz )
+{
+    internal::StatsScope stats_scope( "chseqr" );
+    int64_t lwork;
+    hseqr_work_size(
+        jobschur, compz, n, ilo, ihi, H, ldh, W, Z, ldz,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+
+    return hseqr(
+        jobschur, compz, n, ilo, ihi, H, ldh, W, Z, ldz,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::hseqr with caller-supplied workspace.
+/// Arguments are the same as for lapack::hseqr; the matrices are not
+/// modified. The sizes can be reused for any call of the same shape.
+///
+/// @param[out] lwork
+///     Required length of the work array.
+///
+/// @ingroup geev_computational
+void hseqr_work_size(
+    lapack::JobSchur jobschur, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<double>* H, int64_t ldh,
+    std::complex<double>* W,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* lwork )
+{
+    internal::StatsScope stats_scope( "zhseqr" );
+    internal::WorkSizeKey key( "zhseqr",
+        { to_char( jobschur ), to_char( compz ), n, ilo, ihi, ldh, ldz } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
+    char jobschur_ = to_char( jobschur );
+    char compz_ = to_char_comp( compz );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ilo_ = to_lapack_int( ilo );
+    lapack_int ihi_ = to_lapack_int( ihi );
+    lapack_int ldh_ = to_lapack_int( ldh );
+    lapack_int ldz_ = to_lapack_int( ldz );
+    lapack_int info_ = 0;
+
+    // query for workspace size
+    std::complex<double> qry_work[1];
+    lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
+    LAPACK_zhseqr(
+        &jobschur_, &compz_, &n_, &ilo_, &ihi_,
+        (lapack_complex_double*) H, &ldh_,
+        (lapack_complex_double*) W,
+        (lapack_complex_double*) Z, &ldz_,
+        (lapack_complex_double*) qry_work, &ineg_one, &info_
+    );
+    query_timer.stop();
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::hseqr with caller-supplied workspace, which
+/// skips the internal workspace query and allocation. Other arguments
+/// are the same as for lapack::hseqr.
+///
+/// @param[out] work
+///     Workspace of length lwork.
+///
+/// @param[in] lwork
+///     Length of work, at least as returned by lapack::hseqr_work_size.
+///
+/// @ingroup geev_computational
+int64_t hseqr(
+    lapack::JobSchur jobschur, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<double>* H, int64_t ldh,
+    std::complex<double>* W,
+    std::complex<double>* Z, int64_t ldz,
+    std::complex<double>* work, int64_t lwork )
+{
+    char jobschur_ = to_char( jobschur );
+    char compz_ = to_char_comp( compz );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ilo_ = to_lapack_int( ilo );
+    lapack_int ihi_ = to_lapack_int( ihi );
+    lapack_int ldh_ = to_lapack_int( ldh );
+    lapack_int ldz_ = to_lapack_int( ldz );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
+
+    LAPACK_zhseqr(
+        &jobschur_, &compz_, &n_, &ilo_, &ihi_,
+        (lapack_complex_double*) H, &ldh_,
+        (lapack_complex_double*) W,
+        (lapack_complex_double*) Z, &ldz_,
+        (lapack_complex_double*) work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -315,44 +563,18 @@ int64_t hseqr(
     std::complex<double>* W,
     std::complex<double>* Z, int64_t ldz )
 {
-    char jobschur_ = to_char( jobschur );
-    char compz_ = to_char_comp( compz );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int ilo_ = to_lapack_int( ilo );
-    lapack_int ihi_ = to_lapack_int( ihi );
-    lapack_int ldh_ = to_lapack_int( ldh );
-    lapack_int ldz_ = to_lapack_int( ldz );
-    lapack_int info_ = 0;
-
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zhseqr(
-        &jobschur_, &compz_, &n_, &ilo_, &ihi_,
-        (lapack_complex_double*) H, &ldh_,
-        (lapack_complex_double*) W,
-        (lapack_complex_double*) Z, &ldz_,
-        (lapack_complex_double*) qry_work, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    internal::StatsScope stats_scope( "zhseqr" );
+    int64_t lwork;
+    hseqr_work_size(
+        jobschur, compz, n, ilo, ihi, H, ldh, W, Z, ldz,
+        &lwork );
 
     // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+    lapack::vector< std::complex<double> > work( lwork );
 
-    LAPACK_zhseqr(
-        &jobschur_, &compz_, &n_, &ilo_, &ihi_,
-        (lapack_complex_double*) H, &ldh_,
-        (lapack_complex_double*) W,
-        (lapack_complex_double*) Z, &ldz_,
-        (lapack_complex_double*) &work[0], &lwork_, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return hseqr(
+        jobschur, compz, n, ilo, ihi, H, ldh, W, Z, ldz,
+        &work[0], lwork );
 }
 
 }  // namespace lapack
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack_internal.hh"
+#include "batch_internal.hh"
 
 #include <vector>
 
@@ -70,4 +72,78 @@ void lae2(
         &a, &b, &c, rt1, rt2 );
 }
 
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper.
+/// @ingroup heev_computational
+///
+template <typename real_t>
+void lae2_batch(
+    int64_t batch_size,
+    real_t const* a, real_t const* b, real_t const* c,
+    real_t* rt1, real_t* rt2 )
+{
+    lapack_error_if( batch_size < 0 );
+
+    internal::parallel_for( batch_size, 1 << 12, [&]( int64_t begin, int64_t end ) {
+        for (int64_t i = begin; i < end; ++i) {
+            internal::lae2_kernel( a[ i ], b[ i ], c[ i ], rt1[ i ], rt2[ i ] );
+        }
+    });
+}
+
+}  // namespace impl
+
+//------------------------------------------------------------------------------
+/// @ingroup heev_computational
+void lae2_batch(
+    int64_t batch_size,
+    float const* a, float const* b, float const* c,
+    float* rt1, float* rt2 )
+{
+    impl::lae2_batch( batch_size, a, b, c, rt1, rt2 );
+}
+
+//------------------------------------------------------------------------------
+/// Computes the eigenvalues of a batch of 2-by-2 symmetric matrices
+///     [ a_i  b_i ]
+///     [ b_i  c_i ],
+/// in parallel, as in lapack::lae2. The batch is stored as separate
+/// arrays (structure of arrays), so the loop over it vectorizes; the
+/// arithmetic is that of lapack::lae2, with the same accuracy.
+///
+/// Overloaded versions are available for
+/// `float`, `double`.
+///
+/// @param[in] batch_size
+///     The number of matrices. batch_size >= 0.
+///
+/// @param[in] a
+///     The vector a of length batch_size; the (1, 1) elements.
+///
+/// @param[in] b
+///     The vector b of length batch_size; the (1, 2) and (2, 1) elements.
+///
+/// @param[in] c
+///     The vector c of length batch_size; the (2, 2) elements.
+///
+/// @param[out] rt1
+///     The vector rt1 of length batch_size; the eigenvalues of larger
+///     absolute value.
+///
+/// @param[out] rt2
+///     The vector rt2 of length batch_size; the eigenvalues of smaller
+///     absolute value.
+///
+/// @ingroup heev_computational
+void lae2_batch(
+    int64_t batch_size,
+    double const* a, double const* b, double const* c,
+    double* rt1, double* rt2 )
+{
+    impl::lae2_batch( batch_size, a, b, c, rt1, rt2 );
+}
+
 }  // namespace lapack
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack_internal.hh"
+#include "batch_internal.hh"
 
 #include <vector>
 
@@ -120,4 +122,122 @@ void laev2(
         (lapack_complex_double*) sn1 );
 }
 
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper.
+/// @ingroup heev_computational
+///
+template <typename scalar_t>
+void laev2_batch(
+    int64_t batch_size,
+    scalar_t const* a, scalar_t const* b, scalar_t const* c,
+    blas::real_type< scalar_t >* rt1,
+    blas::real_type< scalar_t >* rt2,
+    blas::real_type< scalar_t >* cs1,
+    scalar_t* sn1 )
+{
+    lapack_error_if( batch_size < 0 );
+
+    internal::parallel_for( batch_size, 1 << 12, [&]( int64_t begin, int64_t end ) {
+        for (int64_t i = begin; i < end; ++i) {
+            internal::laev2_kernel( a[ i ], b[ i ], c[ i ],
+                                    rt1[ i ], rt2[ i ], cs1[ i ], sn1[ i ] );
+        }
+    });
+}
+
+}  // namespace impl
+
+//------------------------------------------------------------------------------
+/// @ingroup heev_computational
+void laev2_batch(
+    int64_t batch_size,
+    float const* a, float const* b, float const* c,
+    float* rt1,
+    float* rt2,
+    float* cs1,
+    float* sn1 )
+{
+    impl::laev2_batch( batch_size, a, b, c, rt1, rt2, cs1, sn1 );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup heev_computational
+void laev2_batch(
+    int64_t batch_size,
+    double const* a, double const* b, double const* c,
+    double* rt1,
+    double* rt2,
+    double* cs1,
+    double* sn1 )
+{
+    impl::laev2_batch( batch_size, a, b, c, rt1, rt2, cs1, sn1 );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup heev_computational
+void laev2_batch(
+    int64_t batch_size,
+    std::complex<float> const* a, std::complex<float> const* b, std::complex<float> const* c,
+    float* rt1,
+    float* rt2,
+    float* cs1,
+    std::complex<float>* sn1 )
+{
+    impl::laev2_batch( batch_size, a, b, c, rt1, rt2, cs1, sn1 );
+}
+
+//------------------------------------------------------------------------------
+/// Computes the eigendecompositions of a batch of 2-by-2 Hermitian
+/// matrices
+///     [ a_i          b_i ]
+///     [ conj( b_i )  c_i ],
+/// in parallel, as in lapack::laev2. The batch is stored as separate
+/// arrays (structure of arrays), so the loop over it vectorizes; the
+/// arithmetic is that of lapack::laev2, with the same accuracy.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] batch_size
+///     The number of matrices. batch_size >= 0.
+///
+/// @param[in] a
+///     The vector a of length batch_size; the (1, 1) elements.
+///
+/// @param[in] b
+///     The vector b of length batch_size; the (1, 2) elements.
+///
+/// @param[in] c
+///     The vector c of length batch_size; the (2, 2) elements.
+///
+/// @param[out] rt1
+///     The vector rt1 of length batch_size; the eigenvalues of larger
+///     absolute value.
+///
+/// @param[out] rt2
+///     The vector rt2 of length batch_size; the eigenvalues of smaller
+///     absolute value.
+///
+/// @param[out] cs1
+///     The vector cs1 of length batch_size.
+///
+/// @param[out] sn1
+///     The vector sn1 of length batch_size.
+///     (cs1[i], sn1[i]) is a unit right eigenvector for rt1[i].
+///
+/// @ingroup heev_computational
+void laev2_batch(
+    int64_t batch_size,
+    std::complex<double> const* a, std::complex<double> const* b, std::complex<double> const* c,
+    double* rt1,
+    double* rt2,
+    double* cs1,
+    std::complex<double>* sn1 )
+{
+    impl::laev2_batch( batch_size, a, b, c, rt1, rt2, cs1, sn1 );
+}
+
 }  // namespace lapack
@@ -22,6 +22,7 @@ float langb(
     lapack::Norm norm, int64_t n, int64_t kl, int64_t ku,
     float const* AB, int64_t ldab )
 {
+    internal::StatsScope stats_scope( "slangb" );
     char norm_ = to_char( norm );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
@@ -47,6 +48,7 @@ double langb(
     lapack::Norm norm, int64_t n, int64_t kl, int64_t ku,
     double const* AB, int64_t ldab )
 {
+    internal::StatsScope stats_scope( "dlangb" );
     char norm_ = to_char( norm );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
@@ -72,6 +74,7 @@ float langb(
     lapack::Norm norm, int64_t n, int64_t kl, int64_t ku,
     std::complex<float> const* AB, int64_t ldab )
 {
+    internal::StatsScope stats_scope( "clangb" );
     char norm_ = to_char( norm );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
@@ -131,6 +134,7 @@ double langb(
     lapack::Norm norm, int64_t n, int64_t kl, int64_t ku,
     std::complex<double> const* AB, int64_t ldab )
 {
+    internal::StatsScope stats_scope( "zlangb" );
     char norm_ = to_char( norm );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kl_ = to_lapack_int( kl );
@@ -22,6 +22,7 @@ float lange(
     lapack::Norm norm, int64_t m, int64_t n,
     float const* A, int64_t lda )
 {
+    internal::StatsScope stats_scope( "slange" );
     char norm_ = to_char( norm );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -46,6 +47,7 @@ double lange(
     lapack::Norm norm, int64_t m, int64_t n,
     double const* A, int64_t lda )
 {
+    internal::StatsScope stats_scope( "dlange" );
     char norm_ = to_char( norm );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -70,6 +72,7 @@ float lange(
     lapack::Norm norm, int64_t m, int64_t n,
     std::complex<float> const* A, int64_t lda )
 {
+    internal::StatsScope stats_scope( "clange" );
     char norm_ = to_char( norm );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -121,6 +124,7 @@ double lange(
     lapack::Norm norm, int64_t m, int64_t n,
     std::complex<double> const* A, int64_t lda )
 {
+    internal::StatsScope stats_scope( "zlange" );
     char norm_ = to_char( norm );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -22,6 +22,7 @@ float lanhp(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n,
     std::complex<float> const* AP )
 {
+    internal::StatsScope stats_scope( "clanhp" );
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -81,6 +82,7 @@ double lanhp(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n,
     std::complex<double> const* AP )
 {
+    internal::StatsScope stats_scope( "zlanhp" );
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
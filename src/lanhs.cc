@@ -22,6 +22,7 @@ float lanhs(
     lapack::Norm norm, int64_t n,
     float const* A, int64_t lda )
 {
+    internal::StatsScope stats_scope( "slanhs" );
     char norm_ = to_char( norm );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -45,6 +46,7 @@ double lanhs(
     lapack::Norm norm, int64_t n,
     double const* A, int64_t lda )
 {
+    internal::StatsScope stats_scope( "dlanhs" );
     char norm_ = to_char( norm );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -68,6 +70,7 @@ float lanhs(
     lapack::Norm norm, int64_t n,
     std::complex<float> const* A, int64_t lda )
 {
+    internal::StatsScope stats_scope( "clanhs" );
     char norm_ = to_char( norm );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -117,6 +120,7 @@ double lanhs(
     lapack::Norm norm, int64_t n,
     std::complex<double> const* A, int64_t lda )
 {
+    internal::StatsScope stats_scope( "zlanhs" );
     char norm_ = to_char( norm );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -22,6 +22,7 @@ float lansb(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n, int64_t kd,
     float const* AB, int64_t ldab )
 {
+    internal::StatsScope stats_scope( "slansb" );
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -47,6 +48,7 @@ double lansb(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n, int64_t kd,
     double const* AB, int64_t ldab )
 {
+    internal::StatsScope stats_scope( "dlansb" );
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -72,6 +74,7 @@ float lansb(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n, int64_t kd,
     std::complex<float> const* AB, int64_t ldab )
 {
+    internal::StatsScope stats_scope( "clansb" );
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -138,6 +141,7 @@ double lansb(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n, int64_t kd,
     std::complex<double> const* AB, int64_t ldab )
 {
+    internal::StatsScope stats_scope( "zlansb" );
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
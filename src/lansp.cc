@@ -22,6 +22,7 @@ float lansp(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n,
     float const* AP )
 {
+    internal::StatsScope stats_scope( "slansp" );
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -45,6 +46,7 @@ double lansp(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n,
     double const* AP )
 {
+    internal::StatsScope stats_scope( "dlansp" );
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -68,6 +70,7 @@ float lansp(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n,
     std::complex<float> const* AP )
 {
+    internal::StatsScope stats_scope( "clansp" );
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -125,6 +128,7 @@ double lansp(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n,
     std::complex<double> const* AP )
 {
+    internal::StatsScope stats_scope( "zlansp" );
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
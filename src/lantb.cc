@@ -22,6 +22,7 @@ float lantb(
     lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t n, int64_t k,
     float const* AB, int64_t ldab )
 {
+    internal::StatsScope stats_scope( "slantb" );
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
@@ -48,6 +49,7 @@ double lantb(
     lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t n, int64_t k,
     double const* AB, int64_t ldab )
 {
+    internal::StatsScope stats_scope( "dlantb" );
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
@@ -74,6 +76,7 @@ float lantb(
     lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t n, int64_t k,
     std::complex<float> const* AB, int64_t ldab )
 {
+    internal::StatsScope stats_scope( "clantb" );
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
@@ -147,6 +150,7 @@ double lantb(
     lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t n, int64_t k,
     std::complex<double> const* AB, int64_t ldab )
 {
+    internal::StatsScope stats_scope( "zlantb" );
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
@@ -22,6 +22,7 @@ float lantp(
     lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t n,
     float const* AP )
 {
+    internal::StatsScope stats_scope( "slantp" );
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
@@ -46,6 +47,7 @@ double lantp(
     lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t n,
     double const* AP )
 {
+    internal::StatsScope stats_scope( "dlantp" );
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
@@ -70,6 +72,7 @@ float lantp(
     lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t n,
     std::complex<float> const* AP )
 {
+    internal::StatsScope stats_scope( "clantp" );
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
@@ -133,6 +136,7 @@ double lantp(
     lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t n,
     std::complex<double> const* AP )
 {
+    internal::StatsScope stats_scope( "zlantp" );
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
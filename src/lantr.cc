@@ -22,6 +22,7 @@ float lantr(
     lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t m, int64_t n,
     float const* A, int64_t lda )
 {
+    internal::StatsScope stats_scope( "slantr" );
     lapack_error_if( lda < m );
 
     // Safeguard m, n.
@@ -56,6 +57,7 @@ double lantr(
     lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t m, int64_t n,
     double const* A, int64_t lda )
 {
+    internal::StatsScope stats_scope( "dlantr" );
     lapack_error_if( lda < m );
 
     // Safeguard m, n.
@@ -90,6 +92,7 @@ float lantr(
     lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t m, int64_t n,
     std::complex<float> const* A, int64_t lda )
 {
+    internal::StatsScope stats_scope( "clantr" );
     lapack_error_if( lda < m );
 
     // Safeguard m, n.
@@ -181,6 +184,7 @@ double lantr(
     lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t m, int64_t n,
     std::complex<double> const* A, int64_t lda )
 {
+    internal::StatsScope stats_scope( "zlantr" );
     lapack_error_if( lda < m );
 
     // Safeguard m, n.
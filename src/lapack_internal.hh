@@ -8,6 +8,10 @@
 
 #include "lapack/util.hh"
 
+#include <atomic>
+#include <chrono>
+#include <type_traits>
+
 namespace lapack {
 
 //------------------------------------------------------------------------------
@@ -31,6 +35,128 @@ inline lapack_int to_lapack_int_( int64_t x, const char* x_str )
 ///
 #define to_lapack_int( x ) lapack::to_lapack_int_( x, #x )
 
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// True while instrumentation counters are enabled; see lapack::stats_enable.
+extern std::atomic< bool > stats_active;
+
+//------------------------------------------------------------------------------
+/// Scope of one wrapper call for instrumentation counters.
+/// Constructed at the top of each wrapper that allocates workspace or
+/// queries its size. When counters are disabled, construction is a single
+/// relaxed load. When enabled, the scope becomes the calling thread's
+/// current scope, collecting workspace allocations and query time until
+/// it is destroyed, then adds them to the totals for its routine.
+/// Scopes nest; counts go to the innermost scope, except that a scope
+/// for the same routine as the current one is merged into it.
+class StatsScope
+{
+public:
+    /// @param[in] routine
+    ///     Fortran routine name, a string literal, e.g., "dgeqrf".
+    explicit StatsScope( const char* routine )
+    {
+        if (stats_active.load( std::memory_order_relaxed ))
+            begin( routine );
+    }
+
+    ~StatsScope()
+    {
+        if (routine_ != nullptr)
+            end();
+    }
+
+    StatsScope( StatsScope const& ) = delete;
+    StatsScope& operator = ( StatsScope const& ) = delete;
+
+    void record_alloc( std::size_t bytes )
+    {
+        allocs_ += 1;
+        bytes_  += bytes;
+    }
+
+    void record_query( double seconds )
+    {
+        queries_    += 1;
+        query_time_ += seconds;
+    }
+
+private:
+    void begin( const char* routine );
+    void end();
+
+    const char* routine_ = nullptr;
+    StatsScope* prev_ = nullptr;
+    int64_t allocs_  = 0;
+    int64_t bytes_   = 0;
+    int64_t queries_ = 0;
+    double  query_time_ = 0;
+};
+
+/// @return calling thread's innermost active StatsScope, or null.
+StatsScope* stats_current_scope();
+
+/// Counts a workspace allocation of bytes against the current scope.
+inline void stats_record_alloc( std::size_t bytes )
+{
+    if (stats_active.load( std::memory_order_relaxed )) {
+        StatsScope* scope = stats_current_scope();
+        if (scope)
+            scope->record_alloc( bytes );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Times a workspace query (lwork = -1) for the current StatsScope.
+/// Call stop() right after the query.
+class StatsQueryTimer
+{
+public:
+    StatsQueryTimer()
+    {
+        if (stats_active.load( std::memory_order_relaxed )) {
+            scope_ = stats_current_scope();
+            if (scope_)
+                start_ = std::chrono::steady_clock::now();
+        }
+    }
+
+    void stop()
+    {
+        if (scope_) {
+            std::chrono::duration< double > elapsed
+                = std::chrono::steady_clock::now() - start_;
+            scope_->record_query( elapsed.count() );
+            scope_ = nullptr;
+        }
+    }
+
+private:
+    StatsScope* scope_ = nullptr;
+    std::chrono::steady_clock::time_point start_;
+};
+
+//------------------------------------------------------------------------------
+/// @return Fortran routine name for scalar_t, given names for each precision.
+/// For templated implementations shared by all precisions.
+template <typename scalar_t>
+const char* stats_name(
+    const char* s_name, const char* d_name,
+    const char* c_name, const char* z_name )
+{
+    if constexpr (std::is_same< scalar_t, float >::value)
+        return s_name;
+    else if constexpr (std::is_same< scalar_t, double >::value)
+        return d_name;
+    else if constexpr (std::is_same< scalar_t, std::complex<float> >::value)
+        return c_name;
+    else
+        return z_name;
+}
+
+}  // namespace internal
+
 }  // namespace lapack
 
 #endif // LAPACK_INTERNAL_HH
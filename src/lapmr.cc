@@ -24,13 +24,14 @@ void lapmr(
     float* X, int64_t ldx,
     int64_t* K )
 {
+    internal::StatsScope stats_scope( "slapmr" );
     lapack_int forwrd_ = to_lapack_int( forwrd );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldx_ = to_lapack_int( ldx );
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > K_( &K[0], &K[(m)] );
+        lapack::vector< lapack_int > K_( &K[0], &K[(m)] );
         lapack_int* K_ptr = &K_[0];
     #else
         lapack_int* K_ptr = K;
@@ -51,13 +52,14 @@ void lapmr(
     double* X, int64_t ldx,
     int64_t* K )
 {
+    internal::StatsScope stats_scope( "dlapmr" );
     lapack_int forwrd_ = to_lapack_int( forwrd );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldx_ = to_lapack_int( ldx );
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > K_( &K[0], &K[(m)] );
+        lapack::vector< lapack_int > K_( &K[0], &K[(m)] );
         lapack_int* K_ptr = &K_[0];
     #else
         lapack_int* K_ptr = K;
@@ -78,13 +80,14 @@ void lapmr(
     std::complex<float>* X, int64_t ldx,
     int64_t* K )
 {
+    internal::StatsScope stats_scope( "clapmr" );
     lapack_int forwrd_ = to_lapack_int( forwrd );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldx_ = to_lapack_int( ldx );
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > K_( &K[0], &K[(m)] );
+        lapack::vector< lapack_int > K_( &K[0], &K[(m)] );
         lapack_int* K_ptr = &K_[0];
     #else
         lapack_int* K_ptr = K;
@@ -105,13 +108,14 @@ void lapmr(
     std::complex<double>* X, int64_t ldx,
     int64_t* K )
 {
+    internal::StatsScope stats_scope( "zlapmr" );
     lapack_int forwrd_ = to_lapack_int( forwrd );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldx_ = to_lapack_int( ldx );
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > K_( &K[0], &K[(m)] );
+        lapack::vector< lapack_int > K_( &K[0], &K[(m)] );
         lapack_int* K_ptr = &K_[0];
     #else
         lapack_int* K_ptr = K;
@@ -22,13 +22,14 @@ void lapmt(
     float* X, int64_t ldx,
     int64_t* K )
 {
+    internal::StatsScope stats_scope( "slapmt" );
     lapack_int forwrd_ = to_lapack_int( forwrd );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldx_ = to_lapack_int( ldx );
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > K_( &K[0], &K[(n)] );
+        lapack::vector< lapack_int > K_( &K[0], &K[(n)] );
         lapack_int* K_ptr = &K_[0];
     #else
         lapack_int* K_ptr = K;
@@ -49,13 +50,14 @@ void lapmt(
     double* X, int64_t ldx,
     int64_t* K )
 {
+    internal::StatsScope stats_scope( "dlapmt" );
     lapack_int forwrd_ = to_lapack_int( forwrd );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldx_ = to_lapack_int( ldx );
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > K_( &K[0], &K[(n)] );
+        lapack::vector< lapack_int > K_( &K[0], &K[(n)] );
         lapack_int* K_ptr = &K_[0];
     #else
         lapack_int* K_ptr = K;
@@ -76,13 +78,14 @@ void lapmt(
     std::complex<float>* X, int64_t ldx,
     int64_t* K )
 {
+    internal::StatsScope stats_scope( "clapmt" );
     lapack_int forwrd_ = to_lapack_int( forwrd );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldx_ = to_lapack_int( ldx );
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > K_( &K[0], &K[(n)] );
+        lapack::vector< lapack_int > K_( &K[0], &K[(n)] );
         lapack_int* K_ptr = &K_[0];
     #else
         lapack_int* K_ptr = K;
@@ -103,13 +106,14 @@ void lapmt(
     std::complex<double>* X, int64_t ldx,
     int64_t* K )
 {
+    internal::StatsScope stats_scope( "zlapmt" );
     lapack_int forwrd_ = to_lapack_int( forwrd );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldx_ = to_lapack_int( ldx );
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > K_( &K[0], &K[(n)] );
+        lapack::vector< lapack_int > K_( &K[0], &K[(n)] );
         lapack_int* K_ptr = &K_[0];
     #else
         lapack_int* K_ptr = K;
@@ -23,6 +23,7 @@ void larf(
     float const* v, int64_t incv, float tau,
     float* C, int64_t ldc )
 {
+    internal::StatsScope stats_scope( "slarf" );
     char side_ = to_char( side );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -50,6 +51,7 @@ void larf(
     double const* v, int64_t incv, double tau,
     double* C, int64_t ldc )
 {
+    internal::StatsScope stats_scope( "dlarf" );
     char side_ = to_char( side );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -77,6 +79,7 @@ void larf(
     std::complex<float> const* v, int64_t incv, std::complex<float> tau,
     std::complex<float>* C, int64_t ldc )
 {
+    internal::StatsScope stats_scope( "clarf" );
     char side_ = to_char( side );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -149,6 +152,7 @@ void larf(
     std::complex<double> const* v, int64_t incv, std::complex<double> tau,
     std::complex<double>* C, int64_t ldc )
 {
+    internal::StatsScope stats_scope( "zlarf" );
     char side_ = to_char( side );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -26,6 +26,7 @@ void larfb(
     float const* T, int64_t ldt,
     float* C, int64_t ldc )
 {
+    internal::StatsScope stats_scope( "slarfb" );
     char side_ = to_char( side );
     char trans_ = to_char( trans );
     char direction_ = to_char( direction );
@@ -61,6 +62,7 @@ void larfb(
     double const* T, int64_t ldt,
     double* C, int64_t ldc )
 {
+    internal::StatsScope stats_scope( "dlarfb" );
     char side_ = to_char( side );
     char trans_ = to_char( trans );
     char direction_ = to_char( direction );
@@ -97,6 +99,7 @@ void larfb(
     std::complex<float> const* T, int64_t ldt,
     std::complex<float>* C, int64_t ldc )
 {
+    internal::StatsScope stats_scope( "clarfb" );
     char side_ = to_char( side );
     char trans_ = to_char( trans );
     char direction_ = to_char( direction );
@@ -229,6 +232,7 @@ void larfb(
     std::complex<double> const* T, int64_t ldt,
     std::complex<double>* C, int64_t ldc )
 {
+    internal::StatsScope stats_scope( "zlarfb" );
     char side_ = to_char( side );
     char trans_ = to_char( trans );
     char direction_ = to_char( direction );
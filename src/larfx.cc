@@ -23,6 +23,7 @@ void larfx(
     float const* v, float tau,
     float* C, int64_t ldc )
 {
+    internal::StatsScope stats_scope( "slarfx" );
     char side_ = to_char( side );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -49,6 +50,7 @@ void larfx(
     double const* v, double tau,
     double* C, int64_t ldc )
 {
+    internal::StatsScope stats_scope( "dlarfx" );
     char side_ = to_char( side );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -75,6 +77,7 @@ void larfx(
     std::complex<float> const* v, std::complex<float> tau,
     std::complex<float>* C, int64_t ldc )
 {
+    internal::StatsScope stats_scope( "clarfx" );
     char side_ = to_char( side );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -142,6 +145,7 @@ void larfx(
     std::complex<double> const* v, std::complex<double> tau,
     std::complex<double>* C, int64_t ldc )
 {
+    internal::StatsScope stats_scope( "zlarfx" );
     char side_ = to_char( side );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
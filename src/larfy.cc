@@ -25,6 +25,7 @@ void larfy(
     float const* V, int64_t incv, float tau,
     float* C, int64_t ldc )
 {
+    internal::StatsScope stats_scope( "slarfy" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int incv_ = to_lapack_int( incv );
@@ -48,6 +49,7 @@ void larfy(
     double const* V, int64_t incv, double tau,
     double* C, int64_t ldc )
 {
+    internal::StatsScope stats_scope( "dlarfy" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int incv_ = to_lapack_int( incv );
@@ -71,6 +73,7 @@ void larfy(
     std::complex<float> const* V, int64_t incv, std::complex<float> tau,
     std::complex<float>* C, int64_t ldc )
 {
+    internal::StatsScope stats_scope( "clarfy" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int incv_ = to_lapack_int( incv );
@@ -137,6 +140,7 @@ void larfy(
     std::complex<double> const* V, int64_t incv, std::complex<double> tau,
     std::complex<double>* C, int64_t ldc )
 {
+    internal::StatsScope stats_scope( "zlarfy" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int incv_ = to_lapack_int( incv );
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack_internal.hh"
 #include "lapack/fortran.h"
+#include "NoConstructAllocator.hh"
 
 #include <vector>
 
@@ -22,10 +23,11 @@ void larnv(
     int64_t* iseed, int64_t n,
     float* X )
 {
+    internal::StatsScope stats_scope( "slarnv" );
     lapack_int idist_ = to_lapack_int( idist );
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > iseed_( &iseed[0], &iseed[(4)] );
+        lapack::vector< lapack_int > iseed_( &iseed[0], &iseed[(4)] );
         lapack_int* iseed_ptr = &iseed_[0];
     #else
         lapack_int* iseed_ptr = iseed;
@@ -48,10 +50,11 @@ void larnv(
     int64_t* iseed, int64_t n,
     double* X )
 {
+    internal::StatsScope stats_scope( "dlarnv" );
     lapack_int idist_ = to_lapack_int( idist );
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > iseed_( &iseed[0], &iseed[(4)] );
+        lapack::vector< lapack_int > iseed_( &iseed[0], &iseed[(4)] );
         lapack_int* iseed_ptr = &iseed_[0];
     #else
         lapack_int* iseed_ptr = iseed;
@@ -74,10 +77,11 @@ void larnv(
     int64_t* iseed, int64_t n,
     std::complex<float>* X )
 {
+    internal::StatsScope stats_scope( "clarnv" );
     lapack_int idist_ = to_lapack_int( idist );
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > iseed_( &iseed[0], &iseed[(4)] );
+        lapack::vector< lapack_int > iseed_( &iseed[0], &iseed[(4)] );
         lapack_int* iseed_ptr = &iseed_[0];
     #else
         lapack_int* iseed_ptr = iseed;
@@ -136,10 +140,11 @@ void larnv(
     int64_t* iseed, int64_t n,
     std::complex<double>* X )
 {
+    internal::StatsScope stats_scope( "zlarnv" );
     lapack_int idist_ = to_lapack_int( idist );
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > iseed_( &iseed[0], &iseed[(4)] );
+        lapack::vector< lapack_int > iseed_( &iseed[0], &iseed[(4)] );
         lapack_int* iseed_ptr = &iseed_[0];
     #else
         lapack_int* iseed_ptr = iseed;
@@ -23,13 +23,14 @@ void laswp(
     float* A, int64_t lda, int64_t k1, int64_t k2,
     int64_t const* ipiv, int64_t incx )
 {
+    internal::StatsScope stats_scope( "slaswp" );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int k1_ = to_lapack_int( k1 );
     lapack_int k2_ = to_lapack_int( k2 );
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(k1+(k2-k1)*std::abs(incx))] );
+        lapack::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(k1+(k2-k1)*std::abs(incx))] );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -49,13 +50,14 @@ void laswp(
     double* A, int64_t lda, int64_t k1, int64_t k2,
     int64_t const* ipiv, int64_t incx )
 {
+    internal::StatsScope stats_scope( "dlaswp" );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int k1_ = to_lapack_int( k1 );
     lapack_int k2_ = to_lapack_int( k2 );
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(k1+(k2-k1)*std::abs(incx))] );
+        lapack::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(k1+(k2-k1)*std::abs(incx))] );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -75,13 +77,14 @@ void laswp(
     std::complex<float>* A, int64_t lda, int64_t k1, int64_t k2,
     int64_t const* ipiv, int64_t incx )
 {
+    internal::StatsScope stats_scope( "claswp" );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int k1_ = to_lapack_int( k1 );
     lapack_int k2_ = to_lapack_int( k2 );
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(k1+(k2-k1)*std::abs(incx))] );
+        lapack::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(k1+(k2-k1)*std::abs(incx))] );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -139,13 +142,14 @@ void laswp(
     std::complex<double>* A, int64_t lda, int64_t k1, int64_t k2,
     int64_t const* ipiv, int64_t incx )
 {
+    internal::StatsScope stats_scope( "zlaswp" );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
     lapack_int k1_ = to_lapack_int( k1 );
     lapack_int k2_ = to_lapack_int( k2 );
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(k1+(k2-k1)*std::abs(incx))] );
+        lapack::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(k1+(k2-k1)*std::abs(incx))] );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -158,4 +162,94 @@ void laswp(
         ipiv_ptr, &incx_ );
 }
 
+#ifndef LAPACK_ILP64
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void laswp(
+    int64_t n,
+    float* A, int64_t lda, int64_t k1, int64_t k2,
+    lapack_int const* ipiv, int64_t incx )
+{
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int k1_ = to_lapack_int( k1 );
+    lapack_int k2_ = to_lapack_int( k2 );
+    lapack_int const* ipiv_ptr = ipiv;
+    lapack_int incx_ = to_lapack_int( incx );
+
+    LAPACK_slaswp(
+        &n_,
+        A, &lda_, &k1_, &k2_,
+        ipiv_ptr, &incx_ );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void laswp(
+    int64_t n,
+    double* A, int64_t lda, int64_t k1, int64_t k2,
+    lapack_int const* ipiv, int64_t incx )
+{
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int k1_ = to_lapack_int( k1 );
+    lapack_int k2_ = to_lapack_int( k2 );
+    lapack_int const* ipiv_ptr = ipiv;
+    lapack_int incx_ = to_lapack_int( incx );
+
+    LAPACK_dlaswp(
+        &n_,
+        A, &lda_, &k1_, &k2_,
+        ipiv_ptr, &incx_ );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void laswp(
+    int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t k1, int64_t k2,
+    lapack_int const* ipiv, int64_t incx )
+{
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int k1_ = to_lapack_int( k1 );
+    lapack_int k2_ = to_lapack_int( k2 );
+    lapack_int const* ipiv_ptr = ipiv;
+    lapack_int incx_ = to_lapack_int( incx );
+
+    LAPACK_claswp(
+        &n_,
+        (lapack_complex_float*) A, &lda_, &k1_, &k2_,
+        ipiv_ptr, &incx_ );
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::laswp that takes ipiv in the native LAPACK integer
+/// type, lapack_int, instead of int64_t, which avoids allocating and
+/// copying a temporary pivot array. Available only when lapack_int is
+/// 32-bit, i.e., LAPACK_ILP64 is not defined; otherwise the int64_t
+/// version is already native.
+///
+/// @ingroup gesv_computational
+void laswp(
+    int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t k1, int64_t k2,
+    lapack_int const* ipiv, int64_t incx )
+{
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int k1_ = to_lapack_int( k1 );
+    lapack_int k2_ = to_lapack_int( k2 );
+    lapack_int const* ipiv_ptr = ipiv;
+    lapack_int incx_ = to_lapack_int( incx );
+
+    LAPACK_zlaswp(
+        &n_,
+        (lapack_complex_double*) A, &lda_, &k1_, &k2_,
+        ipiv_ptr, &incx_ );
+}
+
+#endif  // LAPACK_ILP64
+
 }  // namespace lapack
@@ -0,0 +1,310 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_MIXED_INTERNAL_HH
+#define LAPACK_MIXED_INTERNAL_HH
+
+#include "lapack.hh"
+
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <memory>
+#include <vector>
+
+// Helpers for the mixed-precision solvers, gesv_mixed and posv_mixed,
+// which factor A in single precision, then refine the solution to double
+// precision with residuals computed in double, as LAPACK's dsgesv does,
+// and their GMRES-IR variants, gesv_mixed_gmres and posv_mixed_gmres.
+
+namespace lapack {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Most refinement iterations before falling back to double precision,
+/// as ITERMAX in dsgesv.
+const int64_t mixed_itermax = 30;
+
+//------------------------------------------------------------------------------
+/// Lower precision in which mixed-precision solvers factor scalar_t.
+template <typename scalar_t>
+struct lower_precision;
+
+template <>
+struct lower_precision< double >
+{
+    using type = float;
+};
+
+template <>
+struct lower_precision< std::complex<double> >
+{
+    using type = std::complex<float>;
+};
+
+template <typename scalar_t>
+using lower_precision_t = typename lower_precision< scalar_t >::type;
+
+//------------------------------------------------------------------------------
+/// Converts A to lower precision, SA = A, by lag2s or lag2c.
+/// @return 0, or 1 if an entry overflows in lower precision.
+inline int64_t lag2lower(
+    int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    float* SA, int64_t ldsa )
+{
+    return lapack::lag2s( m, n, A, lda, SA, ldsa );
+}
+
+inline int64_t lag2lower(
+    int64_t m, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<float>* SA, int64_t ldsa )
+{
+    return lapack::lag2c( m, n, A, lda, SA, ldsa );
+}
+
+//------------------------------------------------------------------------------
+/// Converts SA back to higher precision, A = SA, by lag2d or lag2z.
+inline void lag2higher(
+    int64_t m, int64_t n,
+    float const* SA, int64_t ldsa,
+    double* A, int64_t lda )
+{
+    lapack::lag2d( m, n, SA, ldsa, A, lda );
+}
+
+inline void lag2higher(
+    int64_t m, int64_t n,
+    std::complex<float> const* SA, int64_t ldsa,
+    std::complex<double>* A, int64_t lda )
+{
+    lapack::lag2z( m, n, SA, ldsa, A, lda );
+}
+
+//------------------------------------------------------------------------------
+/// Refinement test of dsgesv: X has converged if, for each column j,
+/// || R(:, j) ||_inf <= || X(:, j) ||_inf * cte, where cte is
+/// || A ||_inf eps sqrt( n ) and R = B - A X. Norms are cabs1 for
+/// complex, as in i[sz]amax.
+///
+/// @param[out] rnorm
+///     Largest || R(:, j) ||_inf, which refinement must keep reducing.
+///
+/// @param[out] done
+///     If not null, vector of length nrhs; done[ j ] is true if column j
+///     has converged.
+///
+/// @return true if X has converged.
+template <typename scalar_t>
+bool mixed_converged(
+    int64_t n, int64_t nrhs,
+    scalar_t const* X, int64_t ldx,
+    scalar_t const* R, int64_t ldr,
+    blas::real_type< scalar_t > cte,
+    blas::real_type< scalar_t >* rnorm,
+    bool* done = nullptr )
+{
+    using real_t = blas::real_type< scalar_t >;
+    auto cabs1 = []( scalar_t z ) {
+        return std::abs( std::real( z ) ) + std::abs( std::imag( z ) );
+    };
+
+    bool converged = true;
+    real_t rmax = 0;
+    for (int64_t j = 0; j < nrhs; ++j) {
+        scalar_t const* Xj = &X[ j*ldx ];
+        scalar_t const* Rj = &R[ j*ldr ];
+        real_t xnrm = cabs1( Xj[ blas::iamax( n, Xj, 1 ) ] );
+        real_t rnrm = cabs1( Rj[ blas::iamax( n, Rj, 1 ) ] );
+        bool done_j = (rnrm <= xnrm * cte);
+        if (done != nullptr)
+            done[ j ] = done_j;
+        converged = converged && done_j;
+        // NaN propagates, so it stalls refinement.
+        if (! (rnrm <= rmax) && ! std::isnan( rmax ))
+            rmax = rnrm;
+    }
+    *rnorm = rmax;
+    return converged;
+}
+
+//------------------------------------------------------------------------------
+/// Relative residual at which GMRES-IR stops each inner GMRES solve.
+/// The outer refinement recovers full accuracy, so each correction needs
+/// only a few digits.
+const double mixed_gmres_tol = 1e-6;
+
+//------------------------------------------------------------------------------
+/// Solves A d = r by left-preconditioned GMRES, M^{-1} A d = M^{-1} r,
+/// from d = 0, without restarts, as the inner solver of GMRES-IR.
+///
+/// @param[in] m
+///     Most GMRES iterations, i.e., Krylov subspace dimension. m >= 1.
+///
+/// @param[in,out] r
+///     On entry, the right-hand side r. On exit, the solution d.
+///
+/// @param[in] gemm_A
+///     gemm_A( k, alpha, X, ldx, beta, Y, ldy ) sets Y = alpha A X + beta Y
+///     for n-by-k X and Y.
+///
+/// @param[in] precond
+///     precond( k, Y, ldy ) overwrites n-by-k Y with M^{-1} Y.
+///
+/// @param V, H, g, cs, sn
+///     Workspaces of sizes n (m+1), (m+1) m, m+1, m, and m.
+///
+/// @return number of GMRES iterations.
+template <typename scalar_t, typename gemm_A_t, typename precond_t>
+int64_t gmres(
+    int64_t n, int64_t m,
+    scalar_t* r,
+    blas::real_type< scalar_t > tol,
+    gemm_A_t&& gemm_A, precond_t&& precond,
+    scalar_t* V, scalar_t* H, scalar_t* g,
+    blas::real_type< scalar_t >* cs, scalar_t* sn )
+{
+    using blas::conj;
+    using real_t = blas::real_type< scalar_t >;
+    int64_t ldh = m + 1;
+
+    // v_0 = M^{-1} r / beta.
+    blas::copy( n, r, 1, V, 1 );
+    precond( 1, V, n );
+    real_t beta = blas::nrm2( n, V, 1 );
+    std::fill( r, r + n, scalar_t( 0 ) );
+    if (beta == 0)
+        return 0;
+    blas::scal( n, 1 / beta, V, 1 );
+    std::fill( g, g + m + 1, scalar_t( 0 ) );
+    g[ 0 ] = beta;
+
+    int64_t k = 0;
+    while (k < m) {
+        // w = M^{-1} A v_k, orthogonalized by modified Gram-Schmidt.
+        scalar_t* w = &V[ (k+1)*n ];
+        gemm_A( 1, 1.0, &V[ k*n ], n, 0.0, w, n );
+        precond( 1, w, n );
+        scalar_t* Hk = &H[ k*ldh ];
+        for (int64_t i = 0; i <= k; ++i) {
+            Hk[ i ] = blas::dot( n, &V[ i*n ], 1, w, 1 );
+            blas::axpy( n, -Hk[ i ], &V[ i*n ], 1, w, 1 );
+        }
+        real_t h = blas::nrm2( n, w, 1 );
+        Hk[ k+1 ] = h;
+        if (h > 0)
+            blas::scal( n, 1 / h, w, 1 );
+
+        // Apply previous rotations to column k of H, then zero H(k+1, k),
+        // and apply the same rotation to g, whose last entry is then the
+        // residual norm.
+        for (int64_t i = 0; i < k; ++i) {
+            scalar_t t = cs[ i ]*Hk[ i ] + sn[ i ]*Hk[ i+1 ];
+            Hk[ i+1 ] = cs[ i ]*Hk[ i+1 ] - conj( sn[ i ] )*Hk[ i ];
+            Hk[ i ] = t;
+        }
+        scalar_t rkk;
+        lapack::lartg( Hk[ k ], Hk[ k+1 ], &cs[ k ], &sn[ k ], &rkk );
+        Hk[ k ] = rkk;
+        Hk[ k+1 ] = 0;
+        g[ k+1 ] = -conj( sn[ k ] )*g[ k ];
+        g[ k ] = cs[ k ]*g[ k ];
+        ++k;
+
+        if (std::abs( g[ k ] ) <= tol * beta || h == 0)
+            break;
+    }
+
+    // d = V y, where H y = g.
+    blas::trsv( Layout::ColMajor, Uplo::Upper, Op::NoTrans, Diag::NonUnit,
+                k, H, ldh, g, 1 );
+    blas::gemv( Layout::ColMajor, Op::NoTrans, n, k,
+                1.0, V, n, g, 1, 0.0, r, 1 );
+    return k;
+}
+
+//------------------------------------------------------------------------------
+/// GMRES-based iterative refinement (GMRES-IR) of Carson and Higham:
+/// refines X, solving for each correction A d = r with GMRES,
+/// preconditioned by the low precision factorization M of A. Unlike
+/// plain refinement, d = M^{-1} r, which needs kappa( A ) eps_low << 1,
+/// it converges for kappa( A ) well beyond 1 / eps_low.
+///
+/// @param[in,out] X
+///     On entry, an initial solution, e.g., M^{-1} B.
+///     On exit, the refined solution.
+///
+/// @param[in] cte
+///     Convergence threshold, as for mixed_converged.
+///
+/// @param[out] iter
+///     Number of refinement iterations.
+///
+/// @param[out] gmres_iter
+///     Total GMRES iterations, over all refinement iterations and
+///     columns of X.
+///
+/// @return true if X has converged; false if refinement stalled or did
+/// not converge in itermax iterations.
+template <typename scalar_t, typename gemm_A_t, typename precond_t>
+bool gmres_ir(
+    int64_t n, int64_t nrhs,
+    scalar_t const* B, int64_t ldb,
+    scalar_t* X, int64_t ldx,
+    blas::real_type< scalar_t > cte,
+    int64_t itermax, int64_t gmres_itermax,
+    gemm_A_t&& gemm_A, precond_t&& precond,
+    int64_t* iter, int64_t* gmres_iter )
+{
+    using real_t = blas::real_type< scalar_t >;
+    int64_t m = gmres_itermax;
+
+    std::vector< scalar_t > R( n*nrhs );
+    std::vector< scalar_t > V( n*(m+1) );
+    std::vector< scalar_t > H( (m+1)*m );
+    std::vector< scalar_t > g( m+1 );
+    std::vector< real_t > cs( m );
+    std::vector< scalar_t > sn( m );
+    std::unique_ptr< bool[] > done( new bool[ nrhs ] );
+
+    *iter = 0;
+    *gmres_iter = 0;
+    real_t rnorm_prev = std::numeric_limits< real_t >::infinity();
+    for (int64_t it = 0; ; ++it) {
+        // R = B - A X, in higher precision.
+        lapack::lacpy( MatrixType::General, n, nrhs, B, ldb, R.data(), n );
+        gemm_A( nrhs, -1.0, X, ldx, 1.0, R.data(), n );
+
+        real_t rnorm;
+        if (mixed_converged( n, nrhs, X, ldx, R.data(), n, cte, &rnorm,
+                             done.get() )) {
+            *iter = it;
+            return true;
+        }
+        if (it == itermax || ! (rnorm < rnorm_prev)) {
+            *iter = it;
+            return false;
+        }
+        rnorm_prev = rnorm;
+
+        // X += d, where A d = R by preconditioned GMRES, for columns
+        // that have not converged.
+        for (int64_t j = 0; j < nrhs; ++j) {
+            if (done[ j ])
+                continue;
+            scalar_t* Rj = &R[ j*n ];
+            *gmres_iter += gmres( n, m, Rj, real_t( mixed_gmres_tol ),
+                                  gemm_A, precond, V.data(), H.data(),
+                                  g.data(), cs.data(), sn.data() );
+            blas::axpy( n, 1.0, Rj, 1, &X[ j*ldx ], 1 );
+        }
+    }
+}
+
+}  // namespace internal
+}  // namespace lapack
+
+#endif // LAPACK_MIXED_INTERNAL_HH
@@ -23,6 +23,7 @@ int64_t opgtr(
     float const* tau,
     float* Q, int64_t ldq )
 {
+    internal::StatsScope stats_scope( "sopgtr" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldq_ = to_lapack_int( ldq );
@@ -51,6 +52,7 @@ int64_t opgtr(
     double const* tau,
     double* Q, int64_t ldq )
 {
+    internal::StatsScope stats_scope( "dopgtr" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldq_ = to_lapack_int( ldq );
@@ -23,6 +23,7 @@ int64_t opmtr(
     float const* tau,
     float* C, int64_t ldc )
 {
+    internal::StatsScope stats_scope( "sopmtr" );
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
         trans = Op::Trans;
@@ -61,6 +62,7 @@ int64_t opmtr(
     double const* tau,
     double* C, int64_t ldc )
 {
+    internal::StatsScope stats_scope( "dopmtr" );
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
         trans = Op::Trans;
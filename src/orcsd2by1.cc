@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack_internal.hh"
 #include "lapack/fortran.h"
+#include "work_size_cache.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30500  // >= 3.5
@@ -19,15 +20,24 @@ using blas::min;
 using blas::real;
 
 // -----------------------------------------------------------------------------
-int64_t orcsd2by1(
+void orcsd2by1_work_size(
     lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
     float* X11, int64_t ldx11,
     float* X21, int64_t ldx21,
     float* theta,
     float* U1, int64_t ldu1,
     float* U2, int64_t ldu2,
-    float* V1T, int64_t ldv1t )
+    float* V1T, int64_t ldv1t,
+    int64_t* lwork,
+    int64_t* liwork )
 {
+    internal::StatsScope stats_scope( "sorcsd2by1" );
+    internal::WorkSizeKey key( "sorcsd2by1",
+        { to_char( jobu1 ), to_char( jobu2 ), to_char( jobv1t ), m, p, q, ldx11,
+          ldx21, ldu1, ldu2, ldv1t } );
+    if (internal::work_size_cache_find( key, lwork, nullptr, liwork ))
+        return;
+
     char jobu1_ = to_char_csd( jobu1 );
     char jobu2_ = to_char_csd( jobu2 );
     char jobv1t_ = to_char_csd( jobv1t );
@@ -45,6 +55,7 @@ int64_t orcsd2by1(
     float qry_work[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_sorcsd2by1(
         &jobu1_, &jobu2_, &jobv1t_, &m_, &p_, &q_,
         X11, &ldx11_,
@@ -56,14 +67,41 @@ int64_t orcsd2by1(
         qry_work, &ineg_one,
         qry_iwork, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    *liwork = m - min( p, min( m-p, min( q, m-q )));
+    internal::work_size_cache_insert( key, *lwork, 0, *liwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (m - min( p, min( m-p, min( q, m-q )))) );
+// -----------------------------------------------------------------------------
+int64_t orcsd2by1(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
+    float* X11, int64_t ldx11,
+    float* X21, int64_t ldx21,
+    float* theta,
+    float* U1, int64_t ldu1,
+    float* U2, int64_t ldu2,
+    float* V1T, int64_t ldv1t,
+    float* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    char jobu1_ = to_char_csd( jobu1 );
+    char jobu2_ = to_char_csd( jobu2 );
+    char jobv1t_ = to_char_csd( jobv1t );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int q_ = to_lapack_int( q );
+    lapack_int ldx11_ = to_lapack_int( ldx11 );
+    lapack_int ldx21_ = to_lapack_int( ldx21 );
+    lapack_int ldu1_ = to_lapack_int( ldu1 );
+    lapack_int ldu2_ = to_lapack_int( ldu2 );
+    lapack_int ldv1t_ = to_lapack_int( ldv1t );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( liwork < m - min( p, min( m-p, min( q, m-q ))) );
+    lapack_int info_ = 0;
 
     LAPACK_sorcsd2by1(
         &jobu1_, &jobu2_, &jobv1t_, &m_, &p_, &q_,
@@ -73,8 +111,8 @@ int64_t orcsd2by1(
         U1, &ldu1_,
         U2, &ldu2_,
         V1T, &ldv1t_,
-        &work[0], &lwork_,
-        &iwork[0], &info_
+        work, &lwork_,
+        iwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -84,14 +122,60 @@ int64_t orcsd2by1(
 
 // -----------------------------------------------------------------------------
 int64_t orcsd2by1(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
+    float* X11, int64_t ldx11,
+    float* X21, int64_t ldx21,
+    float* theta,
+    float* U1, int64_t ldu1,
+    float* U2, int64_t ldu2,
+    float* V1T, int64_t ldv1t )
+{
+    internal::StatsScope stats_scope( "sorcsd2by1" );
+    int64_t lwork, liwork;
+    orcsd2by1_work_size(
+        jobu1, jobu2, jobv1t, m, p, q, X11, ldx11, X21, ldx21, theta, U1, ldu1,
+        U2, ldu2, V1T, ldv1t,
+        &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return orcsd2by1(
+        jobu1, jobu2, jobv1t, m, p, q, X11, ldx11, X21, ldx21, theta, U1, ldu1,
+        U2, ldu2, V1T, ldv1t,
+        &work[0], lwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::orcsd2by1 with caller-supplied workspace.
+/// Arguments are the same as for lapack::orcsd2by1; the matrices are not
+/// modified. The sizes can be reused for any call of the same shape.
+///
+/// @param[out] lwork
+///     Required length of the work array.
+///
+/// @param[out] liwork
+///     Required length of the iwork array.
+///
+void orcsd2by1_work_size(
     lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
     double* X11, int64_t ldx11,
     double* X21, int64_t ldx21,
     double* theta,
     double* U1, int64_t ldu1,
     double* U2, int64_t ldu2,
-    double* V1T, int64_t ldv1t )
+    double* V1T, int64_t ldv1t,
+    int64_t* lwork,
+    int64_t* liwork )
 {
+    internal::StatsScope stats_scope( "dorcsd2by1" );
+    internal::WorkSizeKey key( "dorcsd2by1",
+        { to_char( jobu1 ), to_char( jobu2 ), to_char( jobv1t ), m, p, q, ldx11,
+          ldx21, ldu1, ldu2, ldv1t } );
+    if (internal::work_size_cache_find( key, lwork, nullptr, liwork ))
+        return;
+
     char jobu1_ = to_char_csd( jobu1 );
     char jobu2_ = to_char_csd( jobu2 );
     char jobv1t_ = to_char_csd( jobv1t );
@@ -109,6 +193,7 @@ int64_t orcsd2by1(
     double qry_work[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_dorcsd2by1(
         &jobu1_, &jobu2_, &jobv1t_, &m_, &p_, &q_,
         X11, &ldx11_,
@@ -120,14 +205,57 @@ int64_t orcsd2by1(
         qry_work, &ineg_one,
         qry_iwork, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    *liwork = m - min( p, min( m-p, min( q, m-q )));
+    internal::work_size_cache_insert( key, *lwork, 0, *liwork );
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (m - min( p, min( m-p, min( q, m-q )))) );
+// -----------------------------------------------------------------------------
+/// Variant of lapack::orcsd2by1 with caller-supplied workspace, which
+/// skips the internal workspace query and allocation. Other arguments
+/// are the same as for lapack::orcsd2by1.
+///
+/// @param[out] work
+///     Workspace of length lwork.
+///
+/// @param[in] lwork
+///     Length of work, at least as returned by lapack::orcsd2by1_work_size.
+///
+/// @param[out] iwork
+///     Workspace of length liwork.
+///
+/// @param[in] liwork
+///     Length of iwork, at least as returned by lapack::orcsd2by1_work_size.
+///
+int64_t orcsd2by1(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
+    double* X11, int64_t ldx11,
+    double* X21, int64_t ldx21,
+    double* theta,
+    double* U1, int64_t ldu1,
+    double* U2, int64_t ldu2,
+    double* V1T, int64_t ldv1t,
+    double* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    char jobu1_ = to_char_csd( jobu1 );
+    char jobu2_ = to_char_csd( jobu2 );
+    char jobv1t_ = to_char_csd( jobv1t );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int p_ = to_lapack_int( p );
+    lapack_int q_ = to_lapack_int( q );
+    lapack_int ldx11_ = to_lapack_int( ldx11 );
+    lapack_int ldx21_ = to_lapack_int( ldx21 );
+    lapack_int ldu1_ = to_lapack_int( ldu1 );
+    lapack_int ldu2_ = to_lapack_int( ldu2 );
+    lapack_int ldv1t_ = to_lapack_int( ldv1t );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( liwork < m - min( p, min( m-p, min( q, m-q ))) );
+    lapack_int info_ = 0;
 
     LAPACK_dorcsd2by1(
         &jobu1_, &jobu2_, &jobv1t_, &m_, &p_, &q_,
@@ -137,8 +265,8 @@ int64_t orcsd2by1(
         U1, &ldu1_,
         U2, &ldu2_,
         V1T, &ldv1t_,
-        &work[0], &lwork_,
-        &iwork[0], &info_
+        work, &lwork_,
+        iwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -146,6 +274,33 @@ int64_t orcsd2by1(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+int64_t orcsd2by1(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
+    double* X11, int64_t ldx11,
+    double* X21, int64_t ldx21,
+    double* theta,
+    double* U1, int64_t ldu1,
+    double* U2, int64_t ldu2,
+    double* V1T, int64_t ldv1t )
+{
+    internal::StatsScope stats_scope( "dorcsd2by1" );
+    int64_t lwork, liwork;
+    orcsd2by1_work_size(
+        jobu1, jobu2, jobv1t, m, p, q, X11, ldx11, X21, ldx21, theta, U1, ldu1,
+        U2, ldu2, V1T, ldv1t,
+        &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return orcsd2by1(
+        jobu1, jobu2, jobv1t, m, p, q, X11, ldx11, X21, ldx21, theta, U1, ldu1,
+        U2, ldu2, V1T, ldv1t,
+        &work[0], lwork, &iwork[0], liwork );
+}
+
 }  // namespace lapack
 
 #endif  // LAPACK >= 3.5.0
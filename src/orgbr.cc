@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack_internal.hh"
 #include "lapack/fortran.h"
+#include "work_size_cache.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -18,11 +19,17 @@ using blas::real;
 
 // -----------------------------------------------------------------------------
 /// @ingroup gesvd_computational
-int64_t orgbr(
+void orgbr_work_size(
     lapack::Vect vect, int64_t m, int64_t n, int64_t k,
     float* A, int64_t lda,
-    float const* tau )
+    float const* tau,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "sorgbr" );
+    internal::WorkSizeKey key( "sorgbr", { to_char( vect ), m, n, k, lda } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     char vect_ = to_char( vect );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -33,25 +40,42 @@ int64_t orgbr(
     // query for workspace size
     float qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_sorgbr(
         &vect_, &m_, &n_, &k_,
         A, &lda_,
         tau,
         qry_work, &ineg_one, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd_computational
+int64_t orgbr(
+    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau,
+    float* work, int64_t lwork )
+{
+    char vect_ = to_char( vect );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int k_ = to_lapack_int( k );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_sorgbr(
         &vect_, &m_, &n_, &k_,
         A, &lda_,
         tau,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -60,13 +84,46 @@ int64_t orgbr(
 }
 
 // -----------------------------------------------------------------------------
-/// @see lapack::ungbr
 /// @ingroup gesvd_computational
 int64_t orgbr(
+    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* tau )
+{
+    internal::StatsScope stats_scope( "sorgbr" );
+    int64_t lwork;
+    orgbr_work_size(
+        vect, m, n, k, A, lda, tau,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return orgbr(
+        vect, m, n, k, A, lda, tau,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::orgbr with caller-supplied workspace.
+/// Arguments are the same as for lapack::orgbr; the matrices are not
+/// modified. The sizes can be reused for any call of the same shape.
+///
+/// @param[out] lwork
+///     Required length of the work array.
+///
+/// @ingroup gesvd_computational
+void orgbr_work_size(
     lapack::Vect vect, int64_t m, int64_t n, int64_t k,
     double* A, int64_t lda,
-    double const* tau )
+    double const* tau,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "dorgbr" );
+    internal::WorkSizeKey key( "dorgbr", { to_char( vect ), m, n, k, lda } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     char vect_ = to_char( vect );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
@@ -77,25 +134,52 @@ int64_t orgbr(
     // query for workspace size
     double qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_dorgbr(
         &vect_, &m_, &n_, &k_,
         A, &lda_,
         tau,
         qry_work, &ineg_one, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// Variant of lapack::orgbr with caller-supplied workspace, which
+/// skips the internal workspace query and allocation. Other arguments
+/// are the same as for lapack::orgbr.
+///
+/// @param[out] work
+///     Workspace of length lwork.
+///
+/// @param[in] lwork
+///     Length of work, at least as returned by lapack::orgbr_work_size.
+///
+/// @ingroup gesvd_computational
+int64_t orgbr(
+    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau,
+    double* work, int64_t lwork )
+{
+    char vect_ = to_char( vect );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int k_ = to_lapack_int( k );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_dorgbr(
         &vect_, &m_, &n_, &k_,
         A, &lda_,
         tau,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -103,4 +187,26 @@ int64_t orgbr(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @see lapack::ungbr
+/// @ingroup gesvd_computational
+int64_t orgbr(
+    lapack::Vect vect, int64_t m, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* tau )
+{
+    internal::StatsScope stats_scope( "dorgbr" );
+    int64_t lwork;
+    orgbr_work_size(
+        vect, m, n, k, A, lda, tau,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return orgbr(
+        vect, m, n, k, A, lda, tau,
+        &work[0], lwork );
+}
+
 }  // namespace lapack
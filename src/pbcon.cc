@@ -23,6 +23,7 @@ int64_t pbcon(
     float const* AB, int64_t ldab, float anorm,
     float* rcond )
 {
+    internal::StatsScope stats_scope( "spbcon" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kd_ = to_lapack_int( kd );
@@ -52,6 +53,7 @@ int64_t pbcon(
     double const* AB, int64_t ldab, double anorm,
     double* rcond )
 {
+    internal::StatsScope stats_scope( "dpbcon" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kd_ = to_lapack_int( kd );
@@ -81,6 +83,7 @@ int64_t pbcon(
     std::complex<float> const* AB, int64_t ldab, float anorm,
     float* rcond )
 {
+    internal::StatsScope stats_scope( "cpbcon" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kd_ = to_lapack_int( kd );
@@ -155,6 +158,7 @@ int64_t pbcon(
     std::complex<double> const* AB, int64_t ldab, double anorm,
     double* rcond )
 {
+    internal::StatsScope stats_scope( "zpbcon" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kd_ = to_lapack_int( kd );
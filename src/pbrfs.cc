@@ -27,6 +27,7 @@ int64_t pbrfs(
     float* ferr,
     float* berr )
 {
+    internal::StatsScope stats_scope( "spbrfs" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kd_ = to_lapack_int( kd );
@@ -69,6 +70,7 @@ int64_t pbrfs(
     double* ferr,
     double* berr )
 {
+    internal::StatsScope stats_scope( "dpbrfs" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kd_ = to_lapack_int( kd );
@@ -111,6 +113,7 @@ int64_t pbrfs(
     float* ferr,
     float* berr )
 {
+    internal::StatsScope stats_scope( "cpbrfs" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kd_ = to_lapack_int( kd );
@@ -231,6 +234,7 @@ int64_t pbrfs(
     double* ferr,
     double* berr )
 {
+    internal::StatsScope stats_scope( "zpbrfs" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int kd_ = to_lapack_int( kd );
@@ -0,0 +1,303 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "spike_internal.hh"
+#include "NoConstructAllocator.hh"
+
+#include <algorithm>
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper.
+/// @ingroup pbsv
+///
+template <typename scalar_t>
+int64_t pbsv_parallel(
+    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
+    scalar_t* AB, int64_t ldab,
+    scalar_t* B, int64_t ldb )
+{
+    using blas::conj;
+
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( kd < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( ldab < kd + 1 );
+    lapack_error_if( ldb < max( 1, n ) );
+
+    int64_t q = 2*kd;
+    int64_t p = internal::spike_partitions( n, q );
+    if (p == 1 || q == 0)
+        return lapack::pbsv( uplo, n, kd, nrhs, AB, ldab, B, ldb );
+
+    // Spike columns solved at a time, to bound workspace.
+    const int64_t nb = 16;
+
+    // A( i, j ), from the stored triangle.
+    auto A = [&]( int64_t i, int64_t j ) {
+        if (uplo == Uplo::Upper) {
+            return i <= j ? AB[ kd + i - j + j*ldab ]
+                          : conj( AB[ kd + j - i + i*ldab ] );
+        }
+        else {
+            return i >= j ? AB[ i - j + j*ldab ]
+                          : conj( AB[ j - i + i*ldab ] );
+        }
+    };
+
+    // Coupling blocks B_k (upper triangular) and C_k = B_{k-1}^H
+    // (lower triangular), read before factoring.
+    std::vector< scalar_t > Bc( p*kd*kd ), Cc( p*kd*kd );
+    for (int64_t k = 0; k < p; ++k) {
+        int64_t s = internal::spike_begin( n, p, k );
+        int64_t e = internal::spike_begin( n, p, k+1 );
+        if (k < p - 1) {
+            for (int64_t j = 0; j < kd; ++j)
+                for (int64_t i = j; i < kd; ++i)
+                    Bc[ k*kd*kd + i + j*kd ] = A( e - kd + i, e + j );
+        }
+        if (k > 0) {
+            for (int64_t j = 0; j < kd; ++j)
+                for (int64_t i = 0; i <= j; ++i)
+                    Cc[ k*kd*kd + i + j*kd ] = A( s + i, s - kd + j );
+        }
+    }
+
+    std::vector< scalar_t > T( p*q*q ), Y( p*q*nrhs );
+    std::vector< int64_t > info( p, 0 );
+
+    // Copy of rows 0 to kd of AB, restored on failure so the caller can
+    // fall back to lapack::pbsv with the original arrays.
+    int64_t ldsave = kd + 1;
+    lapack::vector< scalar_t > AB_save( ldsave*n );
+    auto restore = [&]() {
+        lapack::lacpy( MatrixType::General, ldsave, n, AB_save.data(), ldsave,
+                       AB, ldab );
+    };
+
+    // Factor each diagonal block and solve for the spike tips. pbtrf of
+    // partition k touches only columns [ s_k, e_k ) of AB. B is not
+    // touched until the block factorizations and the reduced system are
+    // known to be nonsingular.
+    internal::parallel_for( p, 1, [&]( int64_t begin, int64_t end ) {
+        std::vector< scalar_t > work;
+        for (int64_t k = begin; k < end; ++k) {
+            int64_t s = internal::spike_begin( n, p, k );
+            int64_t m = internal::spike_begin( n, p, k+1 ) - s;
+            scalar_t* ABk = &AB[ s*ldab ];
+            lapack::lacpy( MatrixType::General, ldsave, m, ABk, ldab,
+                           &AB_save[ s*ldsave ], ldsave );
+
+            int64_t iinfo = lapack::pbtrf( uplo, m, kd, ABk, ldab );
+            if (iinfo != 0) {
+                info[ k ] = s + iinfo;
+                continue;
+            }
+
+            // Columns of [ V_k, W_k ], skipping W_0 and V_{p-1}, which
+            // are zero.
+            int64_t jbegin = (k < p - 1 ? 0 : kd);
+            int64_t jend   = (k > 0     ? q : kd);
+            work.resize( m*nb );
+            for (int64_t j = jbegin; j < jend; j += nb) {
+                int64_t jb = min( nb, jend - j );
+                std::fill( work.begin(), work.begin() + m*jb, scalar_t( 0 ) );
+                for (int64_t jj = 0; jj < jb; ++jj) {
+                    int64_t c = j + jj;
+                    scalar_t* w = &work[ jj*m ];
+                    if (c < kd) {
+                        for (int64_t i = 0; i < kd; ++i)
+                            w[ m - kd + i ] = Bc[ k*kd*kd + i + c*kd ];
+                    }
+                    else {
+                        for (int64_t i = 0; i < kd; ++i)
+                            w[ i ] = Cc[ k*kd*kd + i + (c - kd)*kd ];
+                    }
+                }
+                lapack::pbtrs( uplo, m, kd, jb, ABk, ldab, work.data(), m );
+                internal::spike_tips( m, kd, kd, jb, work.data(), m,
+                                      &T[ k*q*q + j*q ] );
+            }
+        }
+    });
+    for (int64_t k = 0; k < p; ++k) {
+        if (info[ k ] != 0) {
+            restore();
+            return info[ k ];
+        }
+    }
+
+    std::vector< scalar_t > AB_r;
+    std::vector< int64_t > ipiv_r;
+    int64_t iinfo = internal::spike_reduced_factor(
+        n, kd, kd, p, T.data(), AB_r, ipiv_r );
+    if (iinfo != 0) {
+        restore();
+        return iinfo;
+    }
+
+    // Solve for y_k.
+    internal::parallel_for( p, 1, [&]( int64_t begin, int64_t end ) {
+        for (int64_t k = begin; k < end; ++k) {
+            int64_t s = internal::spike_begin( n, p, k );
+            int64_t m = internal::spike_begin( n, p, k+1 ) - s;
+            lapack::pbtrs( uplo, m, kd, nrhs, &AB[ s*ldab ], ldab,
+                           &B[ s ], ldb );
+            internal::spike_tips( m, kd, kd, nrhs, &B[ s ], ldb,
+                                  &Y[ k*q*nrhs ] );
+        }
+    });
+
+    std::vector< scalar_t > Z( (p - 1)*q*nrhs );
+    internal::spike_reduced_solve(
+        kd, kd, nrhs, p, AB_r, ipiv_r, Y.data(), Z.data() );
+
+    // x_k = y_k - A_k^{-1} [ C_k xb_{k-1}; 0; B_k xt_{k+1} ].
+    internal::parallel_for( p, 1, [&]( int64_t begin, int64_t end ) {
+        std::vector< scalar_t > work;
+        for (int64_t k = begin; k < end; ++k) {
+            int64_t s = internal::spike_begin( n, p, k );
+            int64_t m = internal::spike_begin( n, p, k+1 ) - s;
+            scalar_t* ABk = &AB[ s*ldab ];
+
+            work.resize( m*nrhs );
+            internal::spike_correction(
+                m, kd, kd, nrhs, p, k, &Bc[ k*kd*kd ], &Cc[ k*kd*kd ],
+                Z.data(), work.data(), m );
+            lapack::pbtrs( uplo, m, kd, nrhs, ABk, ldab, work.data(), m );
+            for (int64_t c = 0; c < nrhs; ++c) {
+                for (int64_t i = 0; i < m; ++i)
+                    B[ s + i + c*ldb ] -= work[ i + c*m ];
+            }
+        }
+    });
+    return 0;
+}
+
+}  // namespace impl
+
+//------------------------------------------------------------------------------
+/// @ingroup pbsv
+int64_t pbsv_parallel(
+    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
+    float* AB, int64_t ldab,
+    float* B, int64_t ldb )
+{
+    return impl::pbsv_parallel( uplo, n, kd, nrhs, AB, ldab, B, ldb );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup pbsv
+int64_t pbsv_parallel(
+    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
+    double* AB, int64_t ldab,
+    double* B, int64_t ldb )
+{
+    return impl::pbsv_parallel( uplo, n, kd, nrhs, AB, ldab, B, ldb );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup pbsv
+int64_t pbsv_parallel(
+    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
+    std::complex<float>* AB, int64_t ldab,
+    std::complex<float>* B, int64_t ldb )
+{
+    return impl::pbsv_parallel( uplo, n, kd, nrhs, AB, ldab, B, ldb );
+}
+
+//------------------------------------------------------------------------------
+/// Computes the solution to a system of linear equations
+/// $A X = B,$ where A is an n-by-n Hermitian positive definite band
+/// matrix with kd super- and subdiagonals, in parallel on the LAPACK++
+/// thread pool, using the SPIKE partitioned algorithm. This is meant for
+/// a single large system with a narrow band, where lapack::pbsv is
+/// nearly sequential. A and B use the same storage as in lapack::pbsv.
+///
+/// The rows are split into one partition per thread (see
+/// lapack::set_num_threads), each at least several thousand rows and
+/// several bandwidths. Each diagonal block, itself positive definite, is
+/// factored by lapack::pbtrf and solved by lapack::pbtrs for B and for
+/// the 2 kd "spike" columns that couple it to its neighbors. A banded
+/// reduced system of order 2 kd (p-1), for p partitions, couples the
+/// blocks and is solved by lapack::gbsv; then each block is solved once
+/// more for its correction. Only the first and last kd rows of each
+/// spike are kept, so besides a copy of AB, to restore it on failure,
+/// the workspace is about (16 + nrhs) n elements, rather than 2 kd n. The spike solves cost about 8 times the flops
+/// of the factorization, which the threads must make up, so this pays
+/// off with more than about 10 threads.
+/// If the return value is > 0, AB and B are restored to their values on
+/// entry. If n is too small to split, this calls lapack::pbsv, and the
+/// outputs are as from lapack::pbsv.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: Upper triangle of A is stored;
+///     - lapack::Uplo::Lower: Lower triangle of A is stored.
+///
+/// @param[in] n
+///     The number of linear equations, i.e., the order of the
+///     matrix A. n >= 0.
+///
+/// @param[in] kd
+///     - If uplo = Upper, the number of superdiagonals of the matrix A;
+///     - if uplo = Lower, the number of subdiagonals.
+///     - kd >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides, i.e., the number of columns
+///     of the matrix B. nrhs >= 0.
+///
+/// @param[in,out] AB
+///     The n-by-n band matrix AB, stored in an ldab-by-n array.
+///     - On entry, the upper or lower triangle of the Hermitian band
+///     matrix A, stored in the first kd+1 rows of the array, as in
+///     lapack::pbsv.
+///
+///     - On exit, if return value = 0, the Cholesky factors of the
+///     diagonal blocks, each in the format of lapack::pbtrf; if return
+///     value > 0, AB is restored.
+///
+/// @param[in] ldab
+///     The leading dimension of the array AB. ldab >= kd+1.
+///
+/// @param[in,out] B
+///     The n-by-nrhs matrix B, stored in an ldb-by-nrhs array.
+///     On entry, the n-by-nrhs right hand side matrix B.
+///     On exit, if return value = 0, the n-by-nrhs solution matrix X;
+///     if return value > 0, B is unchanged.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B. ldb >= max(1,n).
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, A is not positive definite: the
+///     diagonal block holding row i, or the reduced system, could not
+///     be factored at row i; the solution has not been computed, and AB
+///     and B are restored to their values on entry.
+///
+/// @ingroup pbsv
+int64_t pbsv_parallel(
+    lapack::Uplo uplo, int64_t n, int64_t kd, int64_t nrhs,
+    std::complex<double>* AB, int64_t ldab,
+    std::complex<double>* B, int64_t ldb )
+{
+    return impl::pbsv_parallel( uplo, n, kd, nrhs, AB, ldab, B, ldb );
+}
+
+}  // namespace lapack
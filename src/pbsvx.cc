@@ -30,6 +30,7 @@ int64_t pbsvx(
     float* ferr,
     float* berr )
 {
+    internal::StatsScope stats_scope( "spbsvx" );
     char fact_ = to_char( fact );
     char uplo_ = to_char( uplo );
     char equed_ = to_char( *equed );
@@ -80,6 +81,7 @@ int64_t pbsvx(
     double* ferr,
     double* berr )
 {
+    internal::StatsScope stats_scope( "dpbsvx" );
     char fact_ = to_char( fact );
     char uplo_ = to_char( uplo );
     char equed_ = to_char( *equed );
@@ -130,6 +132,7 @@ int64_t pbsvx(
     float* ferr,
     float* berr )
 {
+    internal::StatsScope stats_scope( "cpbsvx" );
     char fact_ = to_char( fact );
     char uplo_ = to_char( uplo );
     char equed_ = to_char( *equed );
@@ -378,6 +381,7 @@ int64_t pbsvx(
     double* ferr,
     double* berr )
 {
+    internal::StatsScope stats_scope( "zpbsvx" );
     char fact_ = to_char( fact );
     char uplo_ = to_char( uplo );
     char equed_ = to_char( *equed );
@@ -23,6 +23,7 @@ int64_t pocon(
     float const* A, int64_t lda, float anorm,
     float* rcond )
 {
+    internal::StatsScope stats_scope( "spocon" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -51,6 +52,7 @@ int64_t pocon(
     double const* A, int64_t lda, double anorm,
     double* rcond )
 {
+    internal::StatsScope stats_scope( "dpocon" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -79,6 +81,7 @@ int64_t pocon(
     std::complex<float> const* A, int64_t lda, float anorm,
     float* rcond )
 {
+    internal::StatsScope stats_scope( "cpocon" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -142,6 +145,7 @@ int64_t pocon(
     std::complex<double> const* A, int64_t lda, double anorm,
     double* rcond )
 {
+    internal::StatsScope stats_scope( "zpocon" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -27,6 +27,7 @@ int64_t porfs(
     float* ferr,
     float* berr )
 {
+    internal::StatsScope stats_scope( "sporfs" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -68,6 +69,7 @@ int64_t porfs(
     double* ferr,
     double* berr )
 {
+    internal::StatsScope stats_scope( "dporfs" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -109,6 +111,7 @@ int64_t porfs(
     float* ferr,
     float* berr )
 {
+    internal::StatsScope stats_scope( "cporfs" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -227,6 +230,7 @@ int64_t porfs(
     double* ferr,
     double* berr )
 {
+    internal::StatsScope stats_scope( "zporfs" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -33,6 +33,7 @@ int64_t porfsx(
     float* err_bnds_comp, int64_t nparams,
     float* params )
 {
+    internal::StatsScope stats_scope( "sporfsx" );
     char uplo_ = to_char( uplo );
     char equed_ = to_char( equed );
     lapack_int n_ = to_lapack_int( n );
@@ -84,6 +85,7 @@ int64_t porfsx(
     double* err_bnds_comp, int64_t nparams,
     double* params )
 {
+    internal::StatsScope stats_scope( "dporfsx" );
     char uplo_ = to_char( uplo );
     char equed_ = to_char( equed );
     lapack_int n_ = to_lapack_int( n );
@@ -135,6 +137,7 @@ int64_t porfsx(
     float* err_bnds_comp, int64_t nparams,
     float* params )
 {
+    internal::StatsScope stats_scope( "cporfsx" );
     char uplo_ = to_char( uplo );
     char equed_ = to_char( equed );
     lapack_int n_ = to_lapack_int( n );
@@ -446,6 +449,7 @@ int64_t porfsx(
     double* err_bnds_comp, int64_t nparams,
     double* params )
 {
+    internal::StatsScope stats_scope( "zporfsx" );
     char uplo_ = to_char( uplo );
     char equed_ = to_char( equed );
     lapack_int n_ = to_lapack_int( n );
@@ -183,6 +183,7 @@ int64_t posv(
     double* X, int64_t ldx,
     int64_t* iter )
 {
+    internal::StatsScope stats_scope( "dsposv" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -219,6 +220,7 @@ int64_t posv(
     std::complex<double>* X, int64_t ldx,
     int64_t* iter )
 {
+    internal::StatsScope stats_scope( "zcposv" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
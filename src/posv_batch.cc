@@ -0,0 +1,400 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "batch_internal.hh"
+
+#include <atomic>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// One problem in a posv batch.
+template <typename scalar_t>
+struct PosvProblem
+{
+    scalar_t* A;
+    int64_t lda;
+    scalar_t* B;
+    int64_t ldb;
+};
+
+//------------------------------------------------------------------------------
+/// Mid-level templated batch driver for separately stored matrices.
+/// problem( i ) returns the PosvProblem for system i.
+/// @ingroup posv
+///
+template <typename scalar_t, typename problem_t>
+int64_t posv_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs, int64_t lda, int64_t ldb,
+    int64_t batch_size, problem_t const& problem, int64_t* info )
+{
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( ldb < max( 1, n ) );
+    lapack_error_if( batch_size < 0 );
+    to_lapack_int( lda );  // check for overflow
+    to_lapack_int( ldb );
+
+    // Give each thread at least ~64K flops per range.
+    int64_t grain = (int64_t( 1 ) << 16) / max( 1, n*n*n / 3 + 2*n*n*nrhs );
+
+    std::atomic< int64_t > nfailed { 0 };
+    internal::parallel_for( batch_size, grain, [&]( int64_t begin, int64_t end ) {
+        int64_t count = 0;
+        for (int64_t i = begin; i < end; ++i) {
+            PosvProblem< scalar_t > p = problem( i );
+            info[ i ] = lapack::posv( uplo, n, nrhs, p.A, p.lda, p.B, p.ldb );
+            if (info[ i ] > 0)
+                ++count;
+        }
+        nfailed += count;
+    });
+    return nfailed;
+}
+
+//------------------------------------------------------------------------------
+/// Pointer-array form.
+/// @ingroup posv
+///
+template <typename scalar_t>
+int64_t posv_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t* const* Aarray, int64_t lda,
+    scalar_t* const* Barray, int64_t ldb,
+    int64_t batch_size, int64_t* info )
+{
+    return posv_batch< scalar_t >(
+        uplo, n, nrhs, lda, ldb, batch_size,
+        [&]( int64_t i ) {
+            return PosvProblem< scalar_t >
+                { Aarray[ i ], lda, Barray[ i ], ldb };
+        },
+        info );
+}
+
+//------------------------------------------------------------------------------
+/// Strided form.
+/// @ingroup posv
+///
+template <typename scalar_t>
+int64_t posv_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t* A, int64_t lda, int64_t strideA,
+    scalar_t* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size, int64_t* info )
+{
+    lapack_error_if( strideA < lda * n );
+    lapack_error_if( strideB < ldb * nrhs );
+
+    return posv_batch< scalar_t >(
+        uplo, n, nrhs, lda, ldb, batch_size,
+        [&]( int64_t i ) {
+            return PosvProblem< scalar_t >
+                { A + i*strideA, lda, B + i*strideB, ldb };
+        },
+        info );
+}
+
+//------------------------------------------------------------------------------
+/// Interleaved layout. Factors and solves each block in one pass, while
+/// it is in cache.
+/// @ingroup posv
+///
+template <typename scalar_t>
+int64_t posv_batch_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t* A, scalar_t* B, int64_t lanes,
+    int64_t batch_size, int64_t* info )
+{
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( lanes < 1 );
+    lapack_error_if( batch_size < 0 );
+
+    int64_t nblocks = (batch_size + lanes - 1) / lanes;
+    int64_t grain = (int64_t( 1 ) << 16)
+                  / max( 1, lanes * (n*n*n / 3 + 2*n*n*nrhs) );
+
+    std::atomic< int64_t > nfailed { 0 };
+    internal::parallel_for( nblocks, grain, [&]( int64_t begin, int64_t end ) {
+        int64_t count = 0;
+        for (int64_t b = begin; b < end; ++b) {
+            int64_t k = b * lanes;
+            int64_t nlanes = min( lanes, batch_size - k );
+            scalar_t* Ab = &A[ b * n*n*lanes ];
+            internal::potrf_interleaved( uplo, n, Ab, lanes, nlanes, &info[ k ] );
+            internal::potrs_interleaved(
+                uplo, n, nrhs, Ab, &B[ b * n*nrhs*lanes ], lanes, nlanes );
+            for (int64_t l = 0; l < nlanes; ++l) {
+                if (info[ k + l ] > 0)
+                    ++count;
+            }
+        }
+        nfailed += count;
+    });
+    return nfailed;
+}
+
+}  // namespace impl
+
+//------------------------------------------------------------------------------
+/// @ingroup posv
+int64_t posv_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* const* Aarray, int64_t lda,
+    float* const* Barray, int64_t ldb,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::posv_batch(
+        uplo, n, nrhs, Aarray, lda, Barray, ldb, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup posv
+int64_t posv_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* const* Aarray, int64_t lda,
+    double* const* Barray, int64_t ldb,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::posv_batch(
+        uplo, n, nrhs, Aarray, lda, Barray, ldb, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup posv
+int64_t posv_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* const* Aarray, int64_t lda,
+    std::complex<float>* const* Barray, int64_t ldb,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::posv_batch(
+        uplo, n, nrhs, Aarray, lda, Barray, ldb, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// Solves a batch of systems of linear equations
+/// \[
+///     A_i X_i = B_i,
+/// \]
+/// in parallel, where each A_i is an n-by-n Hermitian positive definite
+/// matrix, as in lapack::posv. Pointer-array form: all matrices have the
+/// same size and leading dimension. See also the strided and interleaved
+/// forms.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: Upper triangles of A_i are stored;
+///     - lapack::Uplo::Lower: Lower triangles of A_i are stored.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides of each system. nrhs >= 0.
+///
+/// @param[in,out] Aarray
+///     Array of batch_size pointers. Each A_i is an lda-by-n array.
+///     On entry, the Hermitian matrix A_i.
+///     On successful exit (info[i] = 0), the factor U_i or L_i.
+///
+/// @param[in] lda
+///     The leading dimension of each A_i. lda >= max(1,n).
+///
+/// @param[in,out] Barray
+///     Array of batch_size pointers. Each B_i is an ldb-by-nrhs array.
+///     On entry, the right hand side matrix B_i.
+///     On successful exit (info[i] = 0), the solution matrix X_i.
+///
+/// @param[in] ldb
+///     The leading dimension of each B_i. ldb >= max(1,n).
+///
+/// @param[in] batch_size
+///     The number of systems. batch_size >= 0.
+///
+/// @param[out] info
+///     The vector info of length batch_size.
+///     - info[i] = 0: system i was solved successfully.
+///     - info[i] = k > 0: the leading minor of order k of A_i is not
+///       positive definite, and the solution was not computed.
+///
+/// @return number of systems with info[i] > 0.
+///
+/// @ingroup posv
+int64_t posv_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* const* Aarray, int64_t lda,
+    std::complex<double>* const* Barray, int64_t ldb,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::posv_batch(
+        uplo, n, nrhs, Aarray, lda, Barray, ldb, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup posv
+int64_t posv_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda, int64_t strideA,
+    float* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::posv_batch(
+        uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup posv
+int64_t posv_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda, int64_t strideA,
+    double* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::posv_batch(
+        uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup posv
+int64_t posv_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::posv_batch(
+        uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// Solves a batch of Hermitian positive definite systems A_i X_i = B_i,
+/// in parallel; strided form. A_i starts at A + i*strideA and B_i at
+/// B + i*strideB. See the pointer-array form of lapack::posv_batch for
+/// details.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] strideA
+///     Distance between the starts of A_i and A_{i+1}. strideA >= lda*n.
+///
+/// @param[in] strideB
+///     Distance between the starts of B_i and B_{i+1}. strideB >= ldb*nrhs.
+///
+/// @return number of systems with info[i] > 0.
+///
+/// @ingroup posv
+int64_t posv_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::posv_batch(
+        uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup posv
+int64_t posv_batch_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, float* B, int64_t lanes,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::posv_batch_interleaved(
+        uplo, n, nrhs, A, B, lanes, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup posv
+int64_t posv_batch_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, double* B, int64_t lanes,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::posv_batch_interleaved(
+        uplo, n, nrhs, A, B, lanes, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup posv
+int64_t posv_batch_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, std::complex<float>* B, int64_t lanes,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::posv_batch_interleaved(
+        uplo, n, nrhs, A, B, lanes, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// Solves a batch of Hermitian positive definite systems A_i X_i = B_i,
+/// in parallel; interleaved layout. Each block of `lanes` systems is
+/// factored and solved in one pass. See lapack::potrf_batch_interleaved
+/// for the layout.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: Upper triangles of A_i are stored;
+///     - lapack::Uplo::Lower: Lower triangles of A_i are stored.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides of each system. nrhs >= 0.
+///
+/// @param[in,out] A
+///     The array A of length ceil( batch_size / lanes ) * n*n*lanes,
+///     holding the matrices A_i in interleaved layout.
+///     On successful exit (info[i] = 0), the factor U_i or L_i.
+///
+/// @param[in,out] B
+///     The array B of length ceil( batch_size / lanes ) * n*nrhs*lanes,
+///     holding the n-by-nrhs matrices B_i in interleaved layout.
+///     On successful exit (info[i] = 0), the solution X_i.
+///
+/// @param[in] lanes
+///     The number of interleaved matrices per block. lanes >= 1.
+///
+/// @param[in] batch_size
+///     The number of systems. batch_size >= 0.
+///
+/// @param[out] info
+///     The vector info of length batch_size.
+///     - info[i] = 0: system i was solved successfully.
+///     - info[i] = k > 0: the leading minor of order k of A_i is not
+///       positive definite; A_i and B_i are then unspecified on exit.
+///
+/// @return number of systems with info[i] > 0.
+///
+/// @ingroup posv
+int64_t posv_batch_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, std::complex<double>* B, int64_t lanes,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::posv_batch_interleaved(
+        uplo, n, nrhs, A, B, lanes, batch_size, info );
+}
+
+}  // namespace lapack
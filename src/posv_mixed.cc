@@ -0,0 +1,213 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "mixed_internal.hh"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper.
+/// @ingroup posv
+///
+template <typename scalar_t>
+int64_t posv_mixed(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t* A, int64_t lda,
+    scalar_t const* B, int64_t ldb,
+    scalar_t* X, int64_t ldx,
+    int64_t* iter )
+{
+    using low_t = internal::lower_precision_t< scalar_t >;
+    using real_t = blas::real_type< scalar_t >;
+
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( ldb < max( 1, n ) );
+    lapack_error_if( ldx < max( 1, n ) );
+
+    *iter = 0;
+    if (n == 0 || nrhs == 0)
+        return 0;
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t anorm = lapack::lanhe( Norm::Inf, uplo, n, A, lda );
+    real_t cte = anorm * eps * std::sqrt( real_t( n ) );
+
+    std::vector< low_t > SA( n*n );
+    std::vector< low_t > SX( n*nrhs );
+    std::vector< scalar_t > R( n*nrhs );
+
+    // Convert only the uplo triangle of A, one column at a time, since
+    // the other triangle may hold anything, even values that overflow.
+    bool overflow = false;
+    for (int64_t j = 0; j < n && ! overflow; ++j) {
+        int64_t i0 = (uplo == Uplo::Lower ? j : 0);
+        int64_t mj = (uplo == Uplo::Lower ? n - j : j + 1);
+        overflow = internal::lag2lower( mj, 1, &A[ i0 + j*lda ], lda,
+                                        &SA[ i0 + j*n ], n ) != 0;
+    }
+
+    // Factor and solve in lower precision, unless A or B overflows there.
+    if (overflow
+        || internal::lag2lower( n, nrhs, B, ldb, SX.data(), n ) != 0) {
+        *iter = -2;
+    }
+    else if (lapack::potrf( uplo, n, SA.data(), n ) != 0) {
+        *iter = -3;
+    }
+    else {
+        lapack::potrs( uplo, n, nrhs, SA.data(), n, SX.data(), n );
+        internal::lag2higher( n, nrhs, SX.data(), n, X, ldx );
+
+        // Refine while the residual keeps decreasing, as in gesv_mixed.
+        real_t rnorm_prev = std::numeric_limits< real_t >::infinity();
+        for (int64_t it = 0; ; ++it) {
+            // R = B - A X, in higher precision.
+            lapack::lacpy( MatrixType::General, n, nrhs, B, ldb, R.data(), n );
+            blas::hemm( Layout::ColMajor, Side::Left, uplo, n, nrhs,
+                        -1.0, A, lda,
+                              X, ldx,
+                         1.0, R.data(), n );
+
+            real_t rnorm;
+            if (internal::mixed_converged( n, nrhs, X, ldx, R.data(), n,
+                                           cte, &rnorm )) {
+                *iter = it;
+                return 0;
+            }
+            if (it == internal::mixed_itermax || ! (rnorm < rnorm_prev)) {
+                *iter = -(internal::mixed_itermax + 1);
+                break;
+            }
+            if (internal::lag2lower( n, nrhs, R.data(), n,
+                                     SX.data(), n ) != 0) {
+                *iter = -2;
+                break;
+            }
+            rnorm_prev = rnorm;
+
+            // X += A^{-1} R, with the correction solved in lower precision.
+            lapack::potrs( uplo, n, nrhs, SA.data(), n, SX.data(), n );
+            internal::lag2higher( n, nrhs, SX.data(), n, R.data(), n );
+            for (int64_t j = 0; j < nrhs; ++j)
+                blas::axpy( n, 1.0, &R[ j*n ], 1, &X[ j*ldx ], 1 );
+        }
+    }
+
+    // Fall back to factoring and solving in higher precision.
+    lapack::lacpy( MatrixType::General, n, nrhs, B, ldb, X, ldx );
+    return lapack::posv( uplo, n, nrhs, A, lda, X, ldx );
+}
+
+}  // namespace impl
+
+//------------------------------------------------------------------------------
+/// @ingroup posv
+int64_t posv_mixed(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    int64_t* iter )
+{
+    return impl::posv_mixed( uplo, n, nrhs, A, lda, B, ldb, X, ldx, iter );
+}
+
+//------------------------------------------------------------------------------
+/// Computes the solution to a system of linear equations
+///     $A X = B$,
+/// where A is an n-by-n Hermitian positive definite matrix and X and B
+/// are n-by-nrhs matrices, using mixed precision iterative refinement.
+///
+/// A is factored by lapack::potrf in single precision, and the solution
+/// is refined to double precision accuracy, with residuals
+/// $R = B - A X$ computed in double, as in lapack::gesv_mixed. Refinement
+/// falls back to lapack::posv in double precision if A or B overflows
+/// in single precision, if A is not positive definite in single
+/// precision, or if the residual stops decreasing.
+///
+/// This is a native implementation, not a wrapper for dsposv or zcposv.
+///
+/// Overloaded versions are available for
+/// `double` and `std::complex<double>`,
+/// factoring in `float` and `std::complex<float>`, respectively.
+///
+/// @see gesv_mixed
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: Upper triangle of A is stored;
+///     - lapack::Uplo::Lower: Lower triangle of A is stored.
+///
+/// @param[in] n
+///     The number of linear equations, i.e., the order of the
+///     matrix A. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides, i.e., the number of columns
+///     of the matrix B. nrhs >= 0.
+///
+/// @param[in,out] A
+///     The n-by-n matrix A, stored in an lda-by-n array.
+///     On entry, the Hermitian matrix A; only its uplo triangle is
+///     referenced.
+///     On exit, if iter >= 0, unchanged; if iter < 0 and the return
+///     value is 0, the factor U or L from the double precision Cholesky
+///     factorization $A = U^H U$ or $A = L L^H$.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @param[in] B
+///     The n-by-nrhs right hand side matrix B, stored in an ldb-by-nrhs
+///     array.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B. ldb >= max(1,n).
+///
+/// @param[out] X
+///     The n-by-nrhs solution matrix X, stored in an ldx-by-nrhs array.
+///
+/// @param[in] ldx
+///     The leading dimension of the array X. ldx >= max(1,n).
+///
+/// @param[out] iter
+///     - >= 0: the number of refinement iterations; A was factored
+///             only in single precision.
+///     - < 0: refinement failed, and A was factored in double precision:
+///         - -2: A, B, or a residual overflows in single precision;
+///         - -3: A is not positive definite in single precision;
+///         - -31: refinement stalled or did not converge in 30 iterations.
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, the leading minor of order i of A
+///              is not positive definite in double precision, so the
+///              factorization could not be completed, and the solution
+///              has not been computed.
+///
+/// @ingroup posv
+int64_t posv_mixed(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    int64_t* iter )
+{
+    return impl::posv_mixed( uplo, n, nrhs, A, lda, B, ldb, X, ldx, iter );
+}
+
+}  // namespace lapack
@@ -0,0 +1,230 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "mixed_internal.hh"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper.
+/// @ingroup posv
+///
+template <typename scalar_t>
+int64_t posv_mixed_gmres(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t* A, int64_t lda,
+    scalar_t const* B, int64_t ldb,
+    scalar_t* X, int64_t ldx,
+    blas::real_type< scalar_t > tol,
+    int64_t itermax, int64_t gmres_itermax,
+    int64_t* iter, int64_t* gmres_iter )
+{
+    using low_t = internal::lower_precision_t< scalar_t >;
+    using real_t = blas::real_type< scalar_t >;
+
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( ldb < max( 1, n ) );
+    lapack_error_if( ldx < max( 1, n ) );
+    lapack_error_if( itermax < 0 );
+    lapack_error_if( gmres_itermax < 1 );
+
+    *iter = 0;
+    *gmres_iter = 0;
+    if (n == 0 || nrhs == 0)
+        return 0;
+
+    if (tol <= 0)
+        tol = std::numeric_limits< real_t >::epsilon() * std::sqrt( real_t( n ) );
+    real_t anorm = lapack::lanhe( Norm::Inf, uplo, n, A, lda );
+    real_t cte = anorm * tol;
+
+    // Factor in lower precision; if A overflows there or is not positive
+    // definite, fall back to posv below. Otherwise, promote the factor
+    // to higher precision, so GMRES applies the preconditioner at
+    // working precision. Convert only the uplo triangle of A.
+    std::vector< scalar_t > LL;
+    {
+        std::vector< low_t > SA( n*n );
+        bool overflow = false;
+        for (int64_t j = 0; j < n && ! overflow; ++j) {
+            int64_t i0 = (uplo == Uplo::Lower ? j : 0);
+            int64_t mj = (uplo == Uplo::Lower ? n - j : j + 1);
+            overflow = internal::lag2lower( mj, 1, &A[ i0 + j*lda ], lda,
+                                            &SA[ i0 + j*n ], n ) != 0;
+        }
+        if (overflow) {
+            *iter = -2;
+        }
+        else if (lapack::potrf( uplo, n, SA.data(), n ) != 0) {
+            *iter = -3;
+        }
+        else {
+            LL.resize( n*n );
+            internal::lag2higher( n, n, SA.data(), n, LL.data(), n );
+        }
+    }
+
+    if (*iter == 0) {
+        auto gemm_A = [&]( int64_t k, scalar_t alpha,
+                           scalar_t const* Xk, int64_t ldxk,
+                           scalar_t beta, scalar_t* Y, int64_t ldy ) {
+            blas::hemm( Layout::ColMajor, Side::Left, uplo, n, k,
+                        alpha, A, lda,
+                               Xk, ldxk,
+                        beta,  Y, ldy );
+        };
+        auto precond = [&]( int64_t k, scalar_t* Y, int64_t ldy ) {
+            lapack::potrs( uplo, n, k, LL.data(), n, Y, ldy );
+        };
+
+        lapack::lacpy( MatrixType::General, n, nrhs, B, ldb, X, ldx );
+        precond( nrhs, X, ldx );
+        if (internal::gmres_ir( n, nrhs, B, ldb, X, ldx, cte,
+                                itermax, gmres_itermax, gemm_A, precond,
+                                iter, gmres_iter ))
+            return 0;
+        *iter = -(itermax + 1);
+    }
+
+    // Fall back to factoring and solving in higher precision.
+    lapack::lacpy( MatrixType::General, n, nrhs, B, ldb, X, ldx );
+    return lapack::posv( uplo, n, nrhs, A, lda, X, ldx );
+}
+
+}  // namespace impl
+
+//------------------------------------------------------------------------------
+/// @ingroup posv
+int64_t posv_mixed_gmres(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double const* B, int64_t ldb,
+    double* X, int64_t ldx,
+    double tol, int64_t itermax, int64_t gmres_itermax,
+    int64_t* iter, int64_t* gmres_iter )
+{
+    return impl::posv_mixed_gmres( uplo, n, nrhs, A, lda, B, ldb, X, ldx,
+                                   tol, itermax, gmres_itermax,
+                                   iter, gmres_iter );
+}
+
+//------------------------------------------------------------------------------
+/// Computes the solution to a system of linear equations
+///     $A X = B$,
+/// where A is an n-by-n Hermitian positive definite matrix and X and B
+/// are n-by-nrhs matrices, using GMRES-based mixed precision iterative
+/// refinement (GMRES-IR).
+///
+/// As in lapack::gesv_mixed_gmres, but A is factored by lapack::potrf in
+/// single precision, and that Cholesky factor preconditions GMRES.
+/// Falls back to lapack::posv in double precision if A overflows in
+/// single precision, if A is not positive definite in single precision,
+/// which potrf may find for $\kappa(A) > 10^7$ or so, or if refinement stalls or does not converge in itermax iterations.
+///
+/// Overloaded versions are available for
+/// `double` and `std::complex<double>`,
+/// factoring in `float` and `std::complex<float>`, respectively.
+///
+/// @see posv_mixed
+/// @see gesv_mixed_gmres
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: Upper triangle of A is stored;
+///     - lapack::Uplo::Lower: Lower triangle of A is stored.
+///
+/// @param[in] n
+///     The number of linear equations, i.e., the order of the
+///     matrix A. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides, i.e., the number of columns
+///     of the matrix B. nrhs >= 0.
+///
+/// @param[in,out] A
+///     The n-by-n matrix A, stored in an lda-by-n array.
+///     On entry, the Hermitian matrix A; only its uplo triangle is
+///     referenced.
+///     On exit, if iter >= 0, unchanged; if iter < 0 and the return
+///     value is 0, the factor U or L from the double precision Cholesky
+///     factorization $A = U^H U$ or $A = L L^H$.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @param[in] B
+///     The n-by-nrhs right hand side matrix B, stored in an ldb-by-nrhs
+///     array.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B. ldb >= max(1,n).
+///
+/// @param[out] X
+///     The n-by-nrhs solution matrix X, stored in an ldx-by-nrhs array.
+///
+/// @param[in] ldx
+///     The leading dimension of the array X. ldx >= max(1,n).
+///
+/// @param[in] tol
+///     Refinement has converged when, for each column,
+///     $\|r\|_{\infty} \le \|x\|_{\infty} \|A\|_{\infty} \, tol$.
+///     If tol <= 0, uses $\epsilon \sqrt{n}$, as posv_mixed does.
+///
+/// @param[in] itermax
+///     Most refinement iterations. itermax >= 0.
+///
+/// @param[in] gmres_itermax
+///     Most GMRES iterations per refinement iteration and right hand
+///     side, i.e., the Krylov subspace dimension. gmres_itermax >= 1.
+///     Workspace is n*(gmres_itermax + 1).
+///
+/// @param[out] iter
+///     - >= 0: the number of refinement iterations; A was factored
+///             only in single precision.
+///     - < 0: refinement failed, and A was factored in double precision:
+///         - -2: A overflows in single precision;
+///         - -3: A is not positive definite in single precision;
+///         - -itermax-1: refinement stalled or did not converge in
+///           itermax iterations.
+///
+/// @param[out] gmres_iter
+///     Total number of GMRES iterations, over all refinement iterations
+///     and right hand sides, each costing one matrix-vector product and
+///     one pair of triangular solves; counted even if refinement failed.
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, the leading minor of order i of A
+///              is not positive definite in double precision, so the
+///              factorization could not be completed, and the solution
+///              has not been computed.
+///
+/// @ingroup posv
+int64_t posv_mixed_gmres(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* X, int64_t ldx,
+    double tol, int64_t itermax, int64_t gmres_itermax,
+    int64_t* iter, int64_t* gmres_iter )
+{
+    return impl::posv_mixed_gmres( uplo, n, nrhs, A, lda, B, ldb, X, ldx,
+                                   tol, itermax, gmres_itermax,
+                                   iter, gmres_iter );
+}
+
+}  // namespace lapack
@@ -30,6 +30,7 @@ int64_t posvx(
     float* ferr,
     float* berr )
 {
+    internal::StatsScope stats_scope( "sposvx" );
     char fact_ = to_char( fact );
     char uplo_ = to_char( uplo );
     char equed_ = to_char( *equed );
@@ -79,6 +80,7 @@ int64_t posvx(
     double* ferr,
     double* berr )
 {
+    internal::StatsScope stats_scope( "dposvx" );
     char fact_ = to_char( fact );
     char uplo_ = to_char( uplo );
     char equed_ = to_char( *equed );
@@ -128,6 +130,7 @@ int64_t posvx(
     float* ferr,
     float* berr )
 {
+    internal::StatsScope stats_scope( "cposvx" );
     char fact_ = to_char( fact );
     char uplo_ = to_char( uplo );
     char equed_ = to_char( *equed );
@@ -346,6 +349,7 @@ int64_t posvx(
     double* ferr,
     double* berr )
 {
+    internal::StatsScope stats_scope( "zposvx" );
     char fact_ = to_char( fact );
     char uplo_ = to_char( uplo );
     char equed_ = to_char( *equed );
@@ -0,0 +1,388 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "batch_internal.hh"
+
+#include <atomic>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// One problem in a potrf batch.
+template <typename scalar_t>
+struct PotrfProblem
+{
+    scalar_t* A;
+    int64_t lda;
+};
+
+//------------------------------------------------------------------------------
+/// Mid-level templated batch driver for separately stored matrices.
+/// problem( i ) returns the PotrfProblem for matrix i.
+/// @ingroup posv_computational
+///
+template <typename scalar_t, typename problem_t>
+int64_t potrf_batch(
+    lapack::Uplo uplo, int64_t n, int64_t lda,
+    int64_t batch_size, problem_t const& problem, int64_t* info )
+{
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( batch_size < 0 );
+    to_lapack_int( lda );  // check for overflow
+
+    // Give each thread at least ~64K flops per range.
+    int64_t grain = (int64_t( 1 ) << 16) / max( 1, n*n*n / 3 );
+
+    std::atomic< int64_t > nfailed { 0 };
+    internal::parallel_for( batch_size, grain, [&]( int64_t begin, int64_t end ) {
+        int64_t count = 0;
+        for (int64_t i = begin; i < end; ++i) {
+            PotrfProblem< scalar_t > p = problem( i );
+            info[ i ] = lapack::potrf( uplo, n, p.A, p.lda );
+            if (info[ i ] > 0)
+                ++count;
+        }
+        nfailed += count;
+    });
+    return nfailed;
+}
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper for the interleaved layout.
+/// @ingroup posv_computational
+///
+template <typename scalar_t>
+int64_t potrf_batch_interleaved(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lanes,
+    int64_t batch_size, int64_t* info )
+{
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lanes < 1 );
+    lapack_error_if( batch_size < 0 );
+
+    int64_t nblocks = (batch_size + lanes - 1) / lanes;
+    int64_t grain = (int64_t( 1 ) << 16) / max( 1, lanes * n*n*n / 3 );
+
+    std::atomic< int64_t > nfailed { 0 };
+    internal::parallel_for( nblocks, grain, [&]( int64_t begin, int64_t end ) {
+        int64_t count = 0;
+        for (int64_t b = begin; b < end; ++b) {
+            int64_t k = b * lanes;
+            int64_t nlanes = min( lanes, batch_size - k );
+            internal::potrf_interleaved(
+                uplo, n, &A[ b * n*n*lanes ], lanes, nlanes, &info[ k ] );
+            for (int64_t l = 0; l < nlanes; ++l) {
+                if (info[ k + l ] > 0)
+                    ++count;
+            }
+        }
+        nfailed += count;
+    });
+    return nfailed;
+}
+
+//------------------------------------------------------------------------------
+/// Pointer-array form.
+/// @ingroup posv_computational
+///
+template <typename scalar_t>
+int64_t potrf_batch(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* const* Aarray, int64_t lda,
+    int64_t batch_size, int64_t* info )
+{
+    return potrf_batch< scalar_t >(
+        uplo, n, lda, batch_size,
+        [&]( int64_t i ) {
+            return PotrfProblem< scalar_t >{ Aarray[ i ], lda };
+        },
+        info );
+}
+
+//------------------------------------------------------------------------------
+/// Strided form.
+/// @ingroup posv_computational
+///
+template <typename scalar_t>
+int64_t potrf_batch(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda, int64_t strideA,
+    int64_t batch_size, int64_t* info )
+{
+    lapack_error_if( strideA < lda * n );
+
+    return potrf_batch< scalar_t >(
+        uplo, n, lda, batch_size,
+        [&]( int64_t i ) {
+            return PotrfProblem< scalar_t >{ A + i*strideA, lda };
+        },
+        info );
+}
+
+}  // namespace impl
+
+//------------------------------------------------------------------------------
+/// @ingroup posv_computational
+int64_t potrf_batch(
+    lapack::Uplo uplo, int64_t n,
+    float* const* Aarray, int64_t lda,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::potrf_batch(
+        uplo, n, Aarray, lda, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup posv_computational
+int64_t potrf_batch(
+    lapack::Uplo uplo, int64_t n,
+    double* const* Aarray, int64_t lda,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::potrf_batch(
+        uplo, n, Aarray, lda, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup posv_computational
+int64_t potrf_batch(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* const* Aarray, int64_t lda,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::potrf_batch(
+        uplo, n, Aarray, lda, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// Computes Cholesky factorizations of a batch of Hermitian positive
+/// definite n-by-n matrices, in parallel:
+/// \[
+///     A_i = U_i^H U_i \text{ or } A_i = L_i L_i^H,
+/// \]
+/// as in lapack::potrf. Pointer-array form: all matrices have the same
+/// size and leading dimension. See also the strided and interleaved forms.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: Upper triangles of A_i are stored;
+///     - lapack::Uplo::Lower: Lower triangles of A_i are stored.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in,out] Aarray
+///     Array of batch_size pointers. Each A_i is an lda-by-n array.
+///     On entry, the Hermitian matrix A_i, as in lapack::potrf.
+///     On successful exit (info[i] = 0), the factor U_i or L_i.
+///
+/// @param[in] lda
+///     The leading dimension of each A_i. lda >= max(1,n).
+///
+/// @param[in] batch_size
+///     The number of matrices. batch_size >= 0.
+///
+/// @param[out] info
+///     The vector info of length batch_size.
+///     - info[i] = 0: A_i was factored successfully.
+///     - info[i] = k > 0: the leading minor of order k of A_i is not
+///       positive definite; see lapack::potrf.
+///
+/// @return number of matrices with info[i] > 0.
+///
+/// @ingroup posv_computational
+int64_t potrf_batch(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* const* Aarray, int64_t lda,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::potrf_batch(
+        uplo, n, Aarray, lda, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup posv_computational
+int64_t potrf_batch(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, int64_t strideA,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::potrf_batch(
+        uplo, n, A, lda, strideA, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup posv_computational
+int64_t potrf_batch(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, int64_t strideA,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::potrf_batch(
+        uplo, n, A, lda, strideA, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup posv_computational
+int64_t potrf_batch(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::potrf_batch(
+        uplo, n, A, lda, strideA, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// Computes Cholesky factorizations of a batch of Hermitian positive
+/// definite n-by-n matrices, in parallel; strided form. Matrix A_i starts
+/// at A + i*strideA. See the pointer-array form of lapack::potrf_batch
+/// for details.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: Upper triangles of A_i are stored;
+///     - lapack::Uplo::Lower: Lower triangles of A_i are stored.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in,out] A
+///     The batch_size matrices A_i, each lda-by-n, strideA apart.
+///
+/// @param[in] lda
+///     The leading dimension of each A_i. lda >= max(1,n).
+///
+/// @param[in] strideA
+///     Distance between the starts of A_i and A_{i+1}. strideA >= lda*n.
+///
+/// @param[in] batch_size
+///     The number of matrices. batch_size >= 0.
+///
+/// @param[out] info
+///     The vector info of length batch_size; see lapack::potrf.
+///
+/// @return number of matrices with info[i] > 0.
+///
+/// @ingroup posv_computational
+int64_t potrf_batch(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::potrf_batch(
+        uplo, n, A, lda, strideA, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup posv_computational
+int64_t potrf_batch_interleaved(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lanes,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::potrf_batch_interleaved(
+        uplo, n, A, lanes, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup posv_computational
+int64_t potrf_batch_interleaved(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lanes,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::potrf_batch_interleaved(
+        uplo, n, A, lanes, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup posv_computational
+int64_t potrf_batch_interleaved(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lanes,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::potrf_batch_interleaved(
+        uplo, n, A, lanes, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// Computes Cholesky factorizations of a batch of Hermitian positive
+/// definite n-by-n matrices, in parallel; interleaved layout.
+///
+/// Matrices are stored "batch-innermost" in blocks of `lanes` matrices:
+/// element (i, j) of matrix k is at
+///
+///     A[ (k / lanes)*n*n*lanes + (i + j*n)*lanes + (k % lanes) ],
+///
+/// so the same element of `lanes` consecutive matrices is contiguous.
+/// The factorization then vectorizes across matrices, which is much
+/// faster than factoring small matrices one at a time. Use a multiple of
+/// the SIMD width, e.g., lanes = 8 or 16. See lapack::batch_interleave
+/// to convert from the strided layout.
+///
+/// Unlike lapack::potrf, when a matrix is not positive definite the
+/// factorization of that matrix continues (with a unit pivot) so the
+/// other lanes are unaffected; such a matrix's contents on exit are
+/// unspecified.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: Upper triangles of A_i are stored;
+///     - lapack::Uplo::Lower: Lower triangles of A_i are stored.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in,out] A
+///     The array A of length ceil( batch_size / lanes ) * n*n*lanes,
+///     holding the matrices A_i in interleaved layout.
+///     Lanes past batch_size in the last block are not referenced.
+///     On successful exit (info[i] = 0), the factor U_i or L_i.
+///
+/// @param[in] lanes
+///     The number of interleaved matrices per block. lanes >= 1.
+///
+/// @param[in] batch_size
+///     The number of matrices. batch_size >= 0.
+///
+/// @param[out] info
+///     The vector info of length batch_size.
+///     - info[i] = 0: A_i was factored successfully.
+///     - info[i] = k > 0: the leading minor of order k of A_i is not
+///       positive definite.
+///
+/// @return number of matrices with info[i] > 0.
+///
+/// @ingroup posv_computational
+int64_t potrf_batch_interleaved(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lanes,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::potrf_batch_interleaved(
+        uplo, n, A, lanes, batch_size, info );
+}
+
+}  // namespace lapack
@@ -0,0 +1,258 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "task_graph.hh"
+#include "thread_pool.hh"
+
+#include <atomic>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper.
+/// @ingroup posv_computational
+///
+template <typename scalar_t>
+int64_t potrf_parallel(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using blas::Layout;
+    using blas::Side;
+    using blas::Diag;
+
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+
+    // Tiles big enough for efficient BLAS-3 kernels, yet several per
+    // thread in each dimension.
+    int64_t nthreads = internal::ThreadPool::instance().num_threads();
+    int64_t nb = (n >= 4096 ? 256 : 128);
+    int64_t nt = (n + nb - 1) / nb;
+    if (nthreads == 1 || nt <= 2)
+        return lapack::potrf( uplo, n, A, lda );
+
+    const scalar_t one = 1;
+    const real_t r_one = 1;
+
+    auto tile = [&]( int64_t i, int64_t j ) {
+        return &A[ i*nb + j*nb*lda ];
+    };
+    auto size = [&]( int64_t i ) {
+        return min( nb, n - i*nb );
+    };
+    auto key = [&]( int64_t i, int64_t j ) {
+        return i + j*nt;
+    };
+    // Lookahead: tasks for tile column j (row j, if upper) run before
+    // those for later columns, so each panel is factored as soon as its
+    // updates finish, overlapping the trailing updates. Panel tasks go
+    // before updates in the same column.
+    auto priority = [&]( int64_t j, bool panel ) {
+        return 2*(nt - j) + (panel ? 1 : 0);
+    };
+
+    // First failing column, as in potrf; tasks after a failure do nothing.
+    std::atomic< int64_t > info { 0 };
+    auto failed = [&] {
+        return info.load() != 0;
+    };
+
+    internal::TaskGraph graph;
+    for (int64_t k = 0; k < nt; ++k) {
+        int64_t kb = size( k );
+        graph.add( priority( k, true ), {}, { key( k, k ) }, [=, &info] {
+            if (failed())
+                return;
+            int64_t iinfo = lapack::potrf( uplo, kb, tile( k, k ), lda );
+            if (iinfo != 0) {
+                int64_t expected = 0;
+                info.compare_exchange_strong( expected, k*nb + iinfo );
+            }
+        });
+
+        if (uplo == Uplo::Lower) {
+            // A(i,k) = A(i,k) L(k,k)^{-H}
+            for (int64_t i = k+1; i < nt; ++i) {
+                graph.add( priority( k, true ),
+                           { key( k, k ) }, { key( i, k ) }, [=] {
+                    if (failed())
+                        return;
+                    blas::trsm( Layout::ColMajor, Side::Right, Uplo::Lower,
+                                Op::ConjTrans, Diag::NonUnit,
+                                size( i ), kb, one, tile( k, k ), lda,
+                                tile( i, k ), lda );
+                });
+            }
+            // A(j:nt, j) -= A(j:nt, k) A(j, k)^H
+            for (int64_t j = k+1; j < nt; ++j) {
+                graph.add( priority( j, false ),
+                           { key( j, k ) }, { key( j, j ) }, [=] {
+                    if (failed())
+                        return;
+                    blas::herk( Layout::ColMajor, Uplo::Lower, Op::NoTrans,
+                                size( j ), kb, -r_one, tile( j, k ), lda,
+                                r_one, tile( j, j ), lda );
+                });
+                for (int64_t i = j+1; i < nt; ++i) {
+                    graph.add( priority( j, false ),
+                               { key( i, k ), key( j, k ) }, { key( i, j ) },
+                               [=] {
+                        if (failed())
+                            return;
+                        blas::gemm( Layout::ColMajor, Op::NoTrans, Op::ConjTrans,
+                                    size( i ), size( j ), kb,
+                                    -one, tile( i, k ), lda,
+                                          tile( j, k ), lda,
+                                     one, tile( i, j ), lda );
+                    });
+                }
+            }
+        }
+        else {
+            // A(k,i) = U(k,k)^{-H} A(k,i)
+            for (int64_t i = k+1; i < nt; ++i) {
+                graph.add( priority( k, true ),
+                           { key( k, k ) }, { key( k, i ) }, [=] {
+                    if (failed())
+                        return;
+                    blas::trsm( Layout::ColMajor, Side::Left, Uplo::Upper,
+                                Op::ConjTrans, Diag::NonUnit,
+                                kb, size( i ), one, tile( k, k ), lda,
+                                tile( k, i ), lda );
+                });
+            }
+            // A(j, j:nt) -= A(k, j)^H A(k, j:nt)
+            for (int64_t j = k+1; j < nt; ++j) {
+                graph.add( priority( j, false ),
+                           { key( k, j ) }, { key( j, j ) }, [=] {
+                    if (failed())
+                        return;
+                    blas::herk( Layout::ColMajor, Uplo::Upper, Op::ConjTrans,
+                                size( j ), kb, -r_one, tile( k, j ), lda,
+                                r_one, tile( j, j ), lda );
+                });
+                for (int64_t i = j+1; i < nt; ++i) {
+                    graph.add( priority( j, false ),
+                               { key( k, j ), key( k, i ) }, { key( j, i ) },
+                               [=] {
+                        if (failed())
+                            return;
+                        blas::gemm( Layout::ColMajor, Op::ConjTrans, Op::NoTrans,
+                                    size( j ), size( i ), kb,
+                                    -one, tile( k, j ), lda,
+                                          tile( k, i ), lda,
+                                     one, tile( j, i ), lda );
+                    });
+                }
+            }
+        }
+    }
+    graph.run();
+    return info.load();
+}
+
+}  // namespace impl
+
+//------------------------------------------------------------------------------
+/// @ingroup posv_computational
+int64_t potrf_parallel(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda )
+{
+    return impl::potrf_parallel( uplo, n, A, lda );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup posv_computational
+int64_t potrf_parallel(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda )
+{
+    return impl::potrf_parallel( uplo, n, A, lda );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup posv_computational
+int64_t potrf_parallel(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda )
+{
+    return impl::potrf_parallel( uplo, n, A, lda );
+}
+
+//------------------------------------------------------------------------------
+/// Computes the Cholesky factorization of a Hermitian
+/// positive definite matrix A, as lapack::potrf does, but as a graph of
+/// tile tasks run in parallel on the LAPACK++ thread pool (see
+/// lapack::set_num_threads). This helps when the LAPACK library
+/// parallelizes only within each BLAS call, e.g., reference LAPACK with
+/// OpenBLAS, which leaves threads idle in the panels.
+///
+/// A is split into nb-by-nb tiles, in place, with nb = 128, or 256 for
+/// n >= 4096. The factorization is a graph of potrf, trsm, herk, and gemm
+/// tile tasks, with dependencies tracked per tile, executed by
+/// work-stealing threads. Tasks are prioritized by tile column, giving
+/// lookahead: the next panel is factored while the trailing updates of
+/// the previous one proceed. For best results, use a single-threaded BLAS
+/// so the tile kernels do not oversubscribe the cores.
+/// If there is one thread, or A is only a few tiles, this calls
+/// lapack::potrf.
+///
+/// The factorization has the form
+///     $A = U^H U,$ if uplo = Upper, or
+///     $A = L   L^H,$ if uplo = Lower,
+/// where U is an upper triangular matrix and L is lower triangular.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: Upper triangle of A is stored;
+///     - lapack::Uplo::Lower: Lower triangle of A is stored.
+///
+/// @param[in] n
+///     The order of the matrix A. n >= 0.
+///
+/// @param[in,out] A
+///     The n-by-n matrix A, stored in an lda-by-n array.
+///     On entry, the Hermitian matrix A. If uplo = Upper, the leading
+///     n-by-n upper triangular part of A contains the upper
+///     triangular part of the matrix A, and the strictly lower
+///     triangular part of A is not referenced. If uplo = Lower, the
+///     leading n-by-n lower triangular part of A contains the lower
+///     triangular part of the matrix A, and the strictly upper
+///     triangular part of A is not referenced.
+///     \n
+///     On successful exit, the factor U or L from the Cholesky
+///     factorization $A = U^H U$ or $A = L L^H.$
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, the leading minor of order i is not
+///     positive definite, and the factorization could not be
+///     completed.
+///
+/// @ingroup posv_computational
+int64_t potrf_parallel(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda )
+{
+    return impl::potrf_parallel( uplo, n, A, lda );
+}
+
+}  // namespace lapack
@@ -0,0 +1,303 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+
+#include <cmath>
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+using blas::conj;
+using blas::real;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper.
+/// @ingroup posv_computational
+///
+template <typename scalar_t>
+int64_t potrf_update(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    scalar_t* A, int64_t lda,
+    scalar_t const* X, int64_t ldx )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( k < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( ldx < max( 1, n ) );
+
+    if (n == 0 || k == 0)
+        return 0;
+
+    // Rotate each column of X into the factor, as in LINPACK chud.
+    // Columns j of L = rows j of U = U^H; for upper, work on conj( X ),
+    // so the same rotations apply.
+    bool lower = (uplo == Uplo::Lower);
+    std::vector< scalar_t > Y( n*k );
+    lapack::lacpy( MatrixType::General, n, k, X, ldx, Y.data(), n );
+    if (! lower)
+        lapack::lacgv( n*k, Y.data(), 1 );
+
+    int64_t inc = (lower ? 1 : lda);
+    // Column j of the factor, in all k rotations, before moving on; the
+    // rotations of each column of Y are still applied in order.
+    for (int64_t j = 0; j < n; ++j) {
+        scalar_t* Ajj = &A[ j + j*lda ];
+        scalar_t* Aj = (lower ? &A[ (j+1) + j*lda ] : &A[ j + (j+1)*lda ]);
+        for (int64_t p = 0; p < k; ++p) {
+            real_t c;
+            scalar_t s, r;
+            lapack::lartg( real( *Ajj ), Y[ j + p*n ], &c, &s, &r );
+            *Ajj = r;
+            blas::rot( n-j-1, Aj, inc, &Y[ (j+1) + p*n ], 1, c, s );
+        }
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper.
+/// @ingroup posv_computational
+///
+template <typename scalar_t>
+int64_t potrf_downdate(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    scalar_t* A, int64_t lda,
+    scalar_t const* X, int64_t ldx )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( k < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( ldx < max( 1, n ) );
+
+    bool lower = (uplo == Uplo::Lower);
+    std::vector< scalar_t > s( n );
+    std::vector< real_t > c( n );
+
+    // One column of X at a time, as in LINPACK chdd, with R = U = L^H:
+    // R^H R - x x^H = R^H (I - s s^H) R, where R^H s = x, is positive
+    // definite iff || s || < 1. Then rotations reduce [ s; alpha ] to
+    // e_{n+1}, and, applied to [ R; 0 ], give the downdated R.
+    for (int64_t p = 0; p < k; ++p) {
+        blas::copy( n, &X[ p*ldx ], 1, s.data(), 1 );
+        blas::trsv( blas::Layout::ColMajor, uplo,
+                    (lower ? Op::NoTrans : Op::ConjTrans),
+                    Diag::NonUnit, n, A, lda, s.data(), 1 );
+        real_t norm = blas::nrm2( n, s.data(), 1 );
+        if (! (norm < 1))
+            return p + 1;
+        real_t alpha = std::sqrt( (1 - norm) * (1 + norm) );
+
+        for (int64_t i = n-1; i >= 0; --i) {
+            real_t scale = alpha + std::abs( s[ i ] );
+            real_t a = alpha / scale;
+            scalar_t b = s[ i ] / scale;
+            real_t r = std::sqrt( a*a + std::norm( b ) );
+            c[ i ] = a / r;
+            s[ i ] = conj( b ) / r;
+            alpha = scale * r;
+        }
+
+        // R(i,j) is A(i,j) if upper, conj( A(j,i) ) if lower; conjugate
+        // the rotations to apply them to L directly.
+        for (int64_t j = 0; j < n; ++j) {
+            scalar_t xx = 0;
+            for (int64_t i = j; i >= 0; --i) {
+                scalar_t& Rij = (lower ? A[ j + i*lda ] : A[ i + j*lda ]);
+                scalar_t si = (lower ? conj( s[ i ] ) : s[ i ]);
+                scalar_t t = c[ i ]*xx + si*Rij;
+                Rij = c[ i ]*Rij - conj( si )*xx;
+                xx = t;
+            }
+        }
+    }
+    return 0;
+}
+
+}  // namespace impl
+
+//------------------------------------------------------------------------------
+/// @ingroup posv_computational
+int64_t potrf_update(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* X, int64_t ldx )
+{
+    return impl::potrf_update( uplo, n, k, A, lda, X, ldx );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup posv_computational
+int64_t potrf_update(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* X, int64_t ldx )
+{
+    return impl::potrf_update( uplo, n, k, A, lda, X, ldx );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup posv_computational
+int64_t potrf_update(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* X, int64_t ldx )
+{
+    return impl::potrf_update( uplo, n, k, A, lda, X, ldx );
+}
+
+//------------------------------------------------------------------------------
+/// Updates the Cholesky factorization of a Hermitian positive definite
+/// matrix A, computed by lapack::potrf, to that of the rank-k update
+/// \[
+///     A + X X^H,
+/// \]
+/// in $O(k n^2)$ operations instead of the $O(n^3)$ of refactoring.
+/// Each column of X is rotated into the factor by Givens rotations
+/// (lartg and rot), as in LINPACK's chud, which is backward stable.
+/// The rotations for all k columns are applied to each column of L
+/// (row of U) in turn, while it is in cache.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @see potrf_downdate
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: A = U^H U, and U is stored;
+///     - lapack::Uplo::Lower: A = L L^H, and L is stored.
+///
+/// @param[in] n
+///     The order of the matrix A. n >= 0.
+///
+/// @param[in] k
+///     The number of columns of X. k >= 0.
+///
+/// @param[in,out] A
+///     The n-by-n matrix A, stored in an lda-by-n array.
+///     On entry, the factor U or L from lapack::potrf.
+///     On exit, the factor U or L of $A + X X^H.$
+///     The other triangle is not referenced.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @param[in] X
+///     The n-by-k matrix X, stored in an ldx-by-k array.
+///
+/// @param[in] ldx
+///     The leading dimension of the array X. ldx >= max(1,n).
+///
+/// @return = 0: successful exit
+///
+/// @ingroup posv_computational
+int64_t potrf_update(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* X, int64_t ldx )
+{
+    return impl::potrf_update( uplo, n, k, A, lda, X, ldx );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup posv_computational
+int64_t potrf_downdate(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    float* A, int64_t lda,
+    float const* X, int64_t ldx )
+{
+    return impl::potrf_downdate( uplo, n, k, A, lda, X, ldx );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup posv_computational
+int64_t potrf_downdate(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    double* A, int64_t lda,
+    double const* X, int64_t ldx )
+{
+    return impl::potrf_downdate( uplo, n, k, A, lda, X, ldx );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup posv_computational
+int64_t potrf_downdate(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* X, int64_t ldx )
+{
+    return impl::potrf_downdate( uplo, n, k, A, lda, X, ldx );
+}
+
+//------------------------------------------------------------------------------
+/// Downdates the Cholesky factorization of a Hermitian positive definite
+/// matrix A, computed by lapack::potrf, to that of the rank-k downdate
+/// \[
+///     A - X X^H,
+/// \]
+/// in $O(k n^2)$ operations, if it is positive definite.
+/// Columns of X are removed one at a time, as in LINPACK's chdd: with
+/// $A = R^H R,$ solving $R^H s = x$ tests positive definiteness,
+/// $\|s\| < 1,$ before A is modified; then Givens rotations, which are
+/// more stable than the equivalent hyperbolic rotations, downdate R.
+/// Downdating is inherently less stable than updating: the error grows
+/// with the condition number of $A - X X^H.$
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @see potrf_update
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: A = U^H U, and U is stored;
+///     - lapack::Uplo::Lower: A = L L^H, and L is stored.
+///
+/// @param[in] n
+///     The order of the matrix A. n >= 0.
+///
+/// @param[in] k
+///     The number of columns of X. k >= 0.
+///
+/// @param[in,out] A
+///     The n-by-n matrix A, stored in an lda-by-n array.
+///     On entry, the factor U or L from lapack::potrf.
+///     On successful exit, the factor U or L of $A - X X^H.$
+///     The other triangle is not referenced.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @param[in] X
+///     The n-by-k matrix X, stored in an ldx-by-k array.
+///
+/// @param[in] ldx
+///     The leading dimension of the array X. ldx >= max(1,n).
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, removing column i of X would make
+///     the matrix not positive definite. A holds the factor of
+///     $A - X(:, 1:i-1) X(:, 1:i-1)^H,$ with columns 1, ..., i-1 removed.
+///
+/// @ingroup posv_computational
+int64_t potrf_downdate(
+    lapack::Uplo uplo, int64_t n, int64_t k,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* X, int64_t ldx )
+{
+    return impl::potrf_downdate( uplo, n, k, A, lda, X, ldx );
+}
+
+}  // namespace lapack
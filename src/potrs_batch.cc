@@ -0,0 +1,357 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "batch_internal.hh"
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// One problem in a potrs batch.
+template <typename scalar_t>
+struct PotrsProblem
+{
+    scalar_t const* A;
+    int64_t lda;
+    scalar_t* B;
+    int64_t ldb;
+};
+
+//------------------------------------------------------------------------------
+/// Mid-level templated batch driver for separately stored matrices.
+/// problem( i ) returns the PotrsProblem for system i.
+/// @ingroup posv_computational
+///
+template <typename scalar_t, typename problem_t>
+void potrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs, int64_t lda, int64_t ldb,
+    int64_t batch_size, problem_t const& problem )
+{
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( ldb < max( 1, n ) );
+    lapack_error_if( batch_size < 0 );
+    to_lapack_int( lda );  // check for overflow
+    to_lapack_int( ldb );
+
+    // Give each thread at least ~64K flops per range.
+    int64_t grain = (int64_t( 1 ) << 16) / max( 1, 2*n*n*nrhs );
+
+    internal::parallel_for( batch_size, grain, [&]( int64_t begin, int64_t end ) {
+        for (int64_t i = begin; i < end; ++i) {
+            PotrsProblem< scalar_t > p = problem( i );
+            lapack::potrs( uplo, n, nrhs, p.A, p.lda, p.B, p.ldb );
+        }
+    });
+}
+
+//------------------------------------------------------------------------------
+/// Pointer-array form.
+/// @ingroup posv_computational
+///
+template <typename scalar_t>
+void potrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t const* const* Aarray, int64_t lda,
+    scalar_t* const* Barray, int64_t ldb,
+    int64_t batch_size )
+{
+    potrs_batch< scalar_t >(
+        uplo, n, nrhs, lda, ldb, batch_size,
+        [&]( int64_t i ) {
+            return PotrsProblem< scalar_t >
+                { Aarray[ i ], lda, Barray[ i ], ldb };
+        });
+}
+
+//------------------------------------------------------------------------------
+/// Strided form.
+/// @ingroup posv_computational
+///
+template <typename scalar_t>
+void potrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t const* A, int64_t lda, int64_t strideA,
+    scalar_t* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size )
+{
+    lapack_error_if( strideA < lda * n );
+    lapack_error_if( strideB < ldb * nrhs );
+
+    potrs_batch< scalar_t >(
+        uplo, n, nrhs, lda, ldb, batch_size,
+        [&]( int64_t i ) {
+            return PotrsProblem< scalar_t >
+                { A + i*strideA, lda, B + i*strideB, ldb };
+        });
+}
+
+//------------------------------------------------------------------------------
+/// Interleaved layout.
+/// @ingroup posv_computational
+///
+template <typename scalar_t>
+void potrs_batch_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t const* A, scalar_t* B, int64_t lanes,
+    int64_t batch_size )
+{
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( lanes < 1 );
+    lapack_error_if( batch_size < 0 );
+
+    int64_t nblocks = (batch_size + lanes - 1) / lanes;
+    int64_t grain = (int64_t( 1 ) << 16) / max( 1, lanes * 2*n*n*nrhs );
+
+    internal::parallel_for( nblocks, grain, [&]( int64_t begin, int64_t end ) {
+        for (int64_t b = begin; b < end; ++b) {
+            int64_t nlanes = min( lanes, batch_size - b*lanes );
+            internal::potrs_interleaved(
+                uplo, n, nrhs, &A[ b * n*n*lanes ], &B[ b * n*nrhs*lanes ],
+                lanes, nlanes );
+        }
+    });
+}
+
+}  // namespace impl
+
+//------------------------------------------------------------------------------
+/// @ingroup posv_computational
+void potrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* const* Aarray, int64_t lda,
+    float* const* Barray, int64_t ldb,
+    int64_t batch_size )
+{
+    impl::potrs_batch(
+        uplo, n, nrhs, Aarray, lda, Barray, ldb, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup posv_computational
+void potrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* const* Aarray, int64_t lda,
+    double* const* Barray, int64_t ldb,
+    int64_t batch_size )
+{
+    impl::potrs_batch(
+        uplo, n, nrhs, Aarray, lda, Barray, ldb, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup posv_computational
+void potrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* const* Aarray, int64_t lda,
+    std::complex<float>* const* Barray, int64_t ldb,
+    int64_t batch_size )
+{
+    impl::potrs_batch(
+        uplo, n, nrhs, Aarray, lda, Barray, ldb, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// Solves a batch of systems of linear equations
+/// \[
+///     A_i X_i = B_i,
+/// \]
+/// in parallel, where each A_i is Hermitian positive definite, using the
+/// Cholesky factorization computed by lapack::potrf_batch (or
+/// lapack::potrf). Pointer-array form: all matrices have the same size
+/// and leading dimension. See also the strided and interleaved forms.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: Upper triangles of A_i are stored;
+///     - lapack::Uplo::Lower: Lower triangles of A_i are stored.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides of each system. nrhs >= 0.
+///
+/// @param[in] Aarray
+///     Array of batch_size pointers. Each A_i is an lda-by-n array,
+///     holding the factor U_i or L_i from lapack::potrf_batch.
+///
+/// @param[in] lda
+///     The leading dimension of each A_i. lda >= max(1,n).
+///
+/// @param[in,out] Barray
+///     Array of batch_size pointers. Each B_i is an ldb-by-nrhs array.
+///     On entry, the right hand side matrix B_i.
+///     On exit, the solution matrix X_i.
+///
+/// @param[in] ldb
+///     The leading dimension of each B_i. ldb >= max(1,n).
+///
+/// @param[in] batch_size
+///     The number of systems. batch_size >= 0.
+///
+/// @ingroup posv_computational
+void potrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* const* Aarray, int64_t lda,
+    std::complex<double>* const* Barray, int64_t ldb,
+    int64_t batch_size )
+{
+    impl::potrs_batch(
+        uplo, n, nrhs, Aarray, lda, Barray, ldb, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup posv_computational
+void potrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda, int64_t strideA,
+    float* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size )
+{
+    impl::potrs_batch(
+        uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup posv_computational
+void potrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda, int64_t strideA,
+    double* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size )
+{
+    impl::potrs_batch(
+        uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup posv_computational
+void potrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda, int64_t strideA,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size )
+{
+    impl::potrs_batch(
+        uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// Solves a batch of Hermitian positive definite systems A_i X_i = B_i,
+/// in parallel, using Cholesky factors; strided form. A_i starts at
+/// A + i*strideA and B_i at B + i*strideB. See the pointer-array form of
+/// lapack::potrs_batch for details.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] strideA
+///     Distance between the starts of A_i and A_{i+1}. strideA >= lda*n.
+///
+/// @param[in] strideB
+///     Distance between the starts of B_i and B_{i+1}. strideB >= ldb*nrhs.
+///
+/// @ingroup posv_computational
+void potrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda, int64_t strideA,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size )
+{
+    impl::potrs_batch(
+        uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup posv_computational
+void potrs_batch_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, float* B, int64_t lanes,
+    int64_t batch_size )
+{
+    impl::potrs_batch_interleaved(
+        uplo, n, nrhs, A, B, lanes, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup posv_computational
+void potrs_batch_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, double* B, int64_t lanes,
+    int64_t batch_size )
+{
+    impl::potrs_batch_interleaved(
+        uplo, n, nrhs, A, B, lanes, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup posv_computational
+void potrs_batch_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, std::complex<float>* B, int64_t lanes,
+    int64_t batch_size )
+{
+    impl::potrs_batch_interleaved(
+        uplo, n, nrhs, A, B, lanes, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// Solves a batch of Hermitian positive definite systems A_i X_i = B_i,
+/// in parallel, using Cholesky factors from lapack::potrf_batch_interleaved;
+/// interleaved layout. See lapack::potrf_batch_interleaved for the layout.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: Upper triangles of A_i are stored;
+///     - lapack::Uplo::Lower: Lower triangles of A_i are stored.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides of each system. nrhs >= 0.
+///
+/// @param[in] A
+///     The array A of length ceil( batch_size / lanes ) * n*n*lanes,
+///     holding the factors in interleaved layout.
+///
+/// @param[in,out] B
+///     The array B of length ceil( batch_size / lanes ) * n*nrhs*lanes,
+///     holding the n-by-nrhs matrices B_i in interleaved layout.
+///     On exit, the solutions X_i.
+///
+/// @param[in] lanes
+///     The number of interleaved matrices per block. lanes >= 1.
+///
+/// @param[in] batch_size
+///     The number of systems. batch_size >= 0.
+///
+/// @ingroup posv_computational
+void potrs_batch_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, std::complex<double>* B, int64_t lanes,
+    int64_t batch_size )
+{
+    impl::potrs_batch_interleaved(
+        uplo, n, nrhs, A, B, lanes, batch_size );
+}
+
+}  // namespace lapack
@@ -23,6 +23,7 @@ int64_t ppcon(
     float const* AP, float anorm,
     float* rcond )
 {
+    internal::StatsScope stats_scope( "sppcon" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
@@ -50,6 +51,7 @@ int64_t ppcon(
     double const* AP, double anorm,
     double* rcond )
 {
+    internal::StatsScope stats_scope( "dppcon" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
@@ -77,6 +79,7 @@ int64_t ppcon(
     std::complex<float> const* AP, float anorm,
     float* rcond )
 {
+    internal::StatsScope stats_scope( "cppcon" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
@@ -141,6 +144,7 @@ int64_t ppcon(
     std::complex<double> const* AP, double anorm,
     double* rcond )
 {
+    internal::StatsScope stats_scope( "zppcon" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
@@ -27,6 +27,7 @@ int64_t pprfs(
     float* ferr,
     float* berr )
 {
+    internal::StatsScope stats_scope( "spprfs" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -66,6 +67,7 @@ int64_t pprfs(
     double* ferr,
     double* berr )
 {
+    internal::StatsScope stats_scope( "dpprfs" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -105,6 +107,7 @@ int64_t pprfs(
     float* ferr,
     float* berr )
 {
+    internal::StatsScope stats_scope( "cpprfs" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -212,6 +215,7 @@ int64_t pprfs(
     double* ferr,
     double* berr )
 {
+    internal::StatsScope stats_scope( "zpprfs" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
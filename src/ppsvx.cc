@@ -30,6 +30,7 @@ int64_t ppsvx(
     float* ferr,
     float* berr )
 {
+    internal::StatsScope stats_scope( "sppsvx" );
     char fact_ = to_char( fact );
     char uplo_ = to_char( uplo );
     char equed_ = to_char( *equed );
@@ -77,6 +78,7 @@ int64_t ppsvx(
     double* ferr,
     double* berr )
 {
+    internal::StatsScope stats_scope( "dppsvx" );
     char fact_ = to_char( fact );
     char uplo_ = to_char( uplo );
     char equed_ = to_char( *equed );
@@ -124,6 +126,7 @@ int64_t ppsvx(
     float* ferr,
     float* berr )
 {
+    internal::StatsScope stats_scope( "cppsvx" );
     char fact_ = to_char( fact );
     char uplo_ = to_char( uplo );
     char equed_ = to_char( *equed );
@@ -348,6 +351,7 @@ int64_t ppsvx(
     double* ferr,
     double* berr )
 {
+    internal::StatsScope stats_scope( "zppsvx" );
     char fact_ = to_char( fact );
     char uplo_ = to_char( uplo );
     char equed_ = to_char( *equed );
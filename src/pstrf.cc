@@ -23,6 +23,7 @@ int64_t pstrf(
     int64_t* piv,
     int64_t* rank, float tol )
 {
+    internal::StatsScope stats_scope( "spstrf" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -62,6 +63,7 @@ int64_t pstrf(
     int64_t* piv,
     int64_t* rank, double tol )
 {
+    internal::StatsScope stats_scope( "dpstrf" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -101,6 +103,7 @@ int64_t pstrf(
     int64_t* piv,
     int64_t* rank, float tol )
 {
+    internal::StatsScope stats_scope( "cpstrf" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -140,6 +143,7 @@ int64_t pstrf(
     int64_t* piv,
     int64_t* rank, double tol )
 {
+    internal::StatsScope stats_scope( "zpstrf" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -24,6 +24,7 @@ int64_t ptcon(
     float const* E, float anorm,
     float* rcond )
 {
+    internal::StatsScope stats_scope( "sptcon" );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
 
@@ -49,6 +50,7 @@ int64_t ptcon(
     double const* E, double anorm,
     double* rcond )
 {
+    internal::StatsScope stats_scope( "dptcon" );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
 
@@ -74,6 +76,7 @@ int64_t ptcon(
     std::complex<float> const* E, float anorm,
     float* rcond )
 {
+    internal::StatsScope stats_scope( "cptcon" );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
 
@@ -143,6 +146,7 @@ int64_t ptcon(
     std::complex<double> const* E, double anorm,
     double* rcond )
 {
+    internal::StatsScope stats_scope( "zptcon" );
     lapack_int n_ = to_lapack_int( n );
     lapack_int info_ = 0;
 
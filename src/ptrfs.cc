@@ -29,6 +29,7 @@ int64_t ptrfs(
     float* ferr,
     float* berr )
 {
+    internal::StatsScope stats_scope( "sptrfs" );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int ldb_ = to_lapack_int( ldb );
@@ -68,6 +69,7 @@ int64_t ptrfs(
     double* ferr,
     double* berr )
 {
+    internal::StatsScope stats_scope( "dptrfs" );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int ldb_ = to_lapack_int( ldb );
@@ -107,6 +109,7 @@ int64_t ptrfs(
     float* ferr,
     float* berr )
 {
+    internal::StatsScope stats_scope( "cptrfs" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -226,6 +229,7 @@ int64_t ptrfs(
     double* ferr,
     double* berr )
 {
+    internal::StatsScope stats_scope( "zptrfs" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
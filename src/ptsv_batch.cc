@@ -0,0 +1,300 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "batch_internal.hh"
+
+#include <atomic>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper for the strided layout.
+/// @ingroup ptsv
+///
+template <typename scalar_t>
+int64_t ptsv_batch(
+    int64_t n, int64_t nrhs,
+    blas::real_type< scalar_t >* D, scalar_t* E, int64_t strideD,
+    scalar_t* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size, int64_t* info )
+{
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( strideD < n );
+    lapack_error_if( ldb < max( 1, n ) );
+    lapack_error_if( strideB < ldb * nrhs );
+    lapack_error_if( batch_size < 0 );
+    to_lapack_int( ldb );  // check for overflow
+
+    // Give each thread at least ~64K flops per range.
+    int64_t grain = (int64_t( 1 ) << 16) / max( 1, n*(4 + 6*nrhs) );
+
+    std::atomic< int64_t > nfailed { 0 };
+    internal::parallel_for( batch_size, grain, [&]( int64_t begin, int64_t end ) {
+        int64_t count = 0;
+        for (int64_t i = begin; i < end; ++i) {
+            info[ i ] = lapack::ptsv(
+                n, nrhs, D + i*strideD, E + i*strideD, B + i*strideB, ldb );
+            if (info[ i ] > 0)
+                ++count;
+        }
+        nfailed += count;
+    });
+    return nfailed;
+}
+
+//------------------------------------------------------------------------------
+/// Interleaved layout. Factors and solves each block in one pass, while
+/// it is in cache.
+/// @ingroup ptsv
+///
+template <typename scalar_t>
+int64_t ptsv_batch_interleaved(
+    int64_t n, int64_t nrhs,
+    blas::real_type< scalar_t >* D, scalar_t* E,
+    scalar_t* B, int64_t lanes,
+    int64_t batch_size, int64_t* info )
+{
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( lanes < 1 );
+    lapack_error_if( batch_size < 0 );
+
+    int64_t n1 = max( 0, n - 1 );
+    int64_t nblocks = (batch_size + lanes - 1) / lanes;
+    int64_t grain = (int64_t( 1 ) << 16) / max( 1, lanes * n*(4 + 6*nrhs) );
+
+    std::atomic< int64_t > nfailed { 0 };
+    internal::parallel_for( nblocks, grain, [&]( int64_t begin, int64_t end ) {
+        int64_t count = 0;
+        for (int64_t b = begin; b < end; ++b) {
+            int64_t k = b * lanes;
+            int64_t nlanes = min( lanes, batch_size - k );
+            auto* Db = &D[ b * n*lanes ];
+            scalar_t* Eb = &E[ b * n1*lanes ];
+            internal::pttrf_interleaved( n, Db, Eb, lanes, nlanes, &info[ k ] );
+            internal::pttrs_interleaved(
+                Uplo::Lower, n, nrhs, Db, Eb, &B[ b * n*nrhs*lanes ],
+                lanes, nlanes );
+            for (int64_t l = 0; l < nlanes; ++l) {
+                if (info[ k + l ] > 0)
+                    ++count;
+            }
+        }
+        nfailed += count;
+    });
+    return nfailed;
+}
+
+}  // namespace impl
+
+//------------------------------------------------------------------------------
+/// @ingroup ptsv
+int64_t ptsv_batch(
+    int64_t n, int64_t nrhs,
+    float* D, float* E, int64_t strideD,
+    float* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::ptsv_batch(
+        n, nrhs, D, E, strideD, B, ldb, strideB, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup ptsv
+int64_t ptsv_batch(
+    int64_t n, int64_t nrhs,
+    double* D, double* E, int64_t strideD,
+    double* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::ptsv_batch(
+        n, nrhs, D, E, strideD, B, ldb, strideB, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup ptsv
+int64_t ptsv_batch(
+    int64_t n, int64_t nrhs,
+    float* D, std::complex<float>* E, int64_t strideD,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::ptsv_batch(
+        n, nrhs, D, E, strideD, B, ldb, strideB, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// Solves a batch of Hermitian positive definite tridiagonal systems of
+/// linear equations, in parallel,
+/// \[
+///     A_i X_i = B_i,
+/// \]
+/// using the factorization $A_i = L_i D_i L_i^H$, as in lapack::ptsv.
+///
+/// Strided ("separate arrays") layout: D_i starts at D + i*strideD, E_i
+/// at E + i*strideD, and B_i at B + i*strideB. Each system is handled by
+/// LAPACK, in parallel over the batch. For many small systems, the
+/// interleaved layout is faster, since its recurrences vectorize across
+/// systems; see lapack::ptsv_batch_interleaved.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides, i.e., the number of columns
+///     of each B_i. nrhs >= 0.
+///
+/// @param[in,out] D
+///     The real vectors D_i of length n, strideD apart.
+///     On entry, the diagonal of A_i.
+///     On successful exit (info[i] = 0), the diagonal of D_i.
+///
+/// @param[in,out] E
+///     The vectors E_i of length n-1, strideD apart.
+///     On entry, the sub-diagonal of A_i.
+///     On successful exit (info[i] = 0), the sub-diagonal of L_i.
+///
+/// @param[in] strideD
+///     Distance between the starts of the vectors of consecutive
+///     systems. strideD >= n.
+///
+/// @param[in,out] B
+///     The batch_size matrices B_i, each ldb-by-nrhs, strideB apart.
+///     On entry, the right hand sides; on exit, if info[i] = 0, the
+///     solutions X_i.
+///
+/// @param[in] ldb
+///     The leading dimension of each B_i. ldb >= max(1,n).
+///
+/// @param[in] strideB
+///     Distance between the starts of B_i and B_{i+1}. strideB >= ldb*nrhs.
+///
+/// @param[in] batch_size
+///     The number of systems. batch_size >= 0.
+///
+/// @param[out] info
+///     The vector info of length batch_size.
+///     - info[i] = 0: system i was solved successfully.
+///     - info[i] = k > 0: the leading minor of order k of A_i is not
+///       positive definite, and X_i was not computed.
+///
+/// @return number of systems with info[i] > 0.
+///
+/// @ingroup ptsv
+int64_t ptsv_batch(
+    int64_t n, int64_t nrhs,
+    double* D, std::complex<double>* E, int64_t strideD,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::ptsv_batch(
+        n, nrhs, D, E, strideD, B, ldb, strideB, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup ptsv
+int64_t ptsv_batch_interleaved(
+    int64_t n, int64_t nrhs,
+    float* D, float* E,
+    float* B, int64_t lanes,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::ptsv_batch_interleaved(
+        n, nrhs, D, E, B, lanes, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup ptsv
+int64_t ptsv_batch_interleaved(
+    int64_t n, int64_t nrhs,
+    double* D, double* E,
+    double* B, int64_t lanes,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::ptsv_batch_interleaved(
+        n, nrhs, D, E, B, lanes, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup ptsv
+int64_t ptsv_batch_interleaved(
+    int64_t n, int64_t nrhs,
+    float* D, std::complex<float>* E,
+    std::complex<float>* B, int64_t lanes,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::ptsv_batch_interleaved(
+        n, nrhs, D, E, B, lanes, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// Solves a batch of Hermitian positive definite tridiagonal systems of
+/// linear equations, in parallel; interleaved layout. Each block of
+/// `lanes` systems is factored and solved in one pass. See the strided
+/// form of lapack::ptsv_batch for details, and
+/// lapack::pttrf_batch_interleaved for the layout.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides. nrhs >= 0.
+///
+/// @param[in,out] D
+///     The interleaved real vectors D_i of length n.
+///     On entry, the diagonal of A_i; on successful exit, the diagonal
+///     of D_i.
+///
+/// @param[in,out] E
+///     The interleaved vectors E_i of length n-1.
+///     On entry, the sub-diagonal of A_i; on successful exit, the
+///     sub-diagonal of L_i.
+///
+/// @param[in,out] B
+///     The interleaved n-by-nrhs matrices B_i.
+///     On entry, the right hand sides; on exit, if info[i] = 0, the
+///     solutions X_i.
+///
+/// @param[in] lanes
+///     The number of interleaved systems per block. lanes >= 1.
+///
+/// @param[in] batch_size
+///     The number of systems. batch_size >= 0.
+///
+/// @param[out] info
+///     The vector info of length batch_size.
+///     - info[i] = 0: system i was solved successfully.
+///     - info[i] = k > 0: the leading minor of order k of A_i is not
+///       positive definite.
+///
+/// @return number of systems with info[i] > 0.
+///
+/// @ingroup ptsv
+int64_t ptsv_batch_interleaved(
+    int64_t n, int64_t nrhs,
+    double* D, std::complex<double>* E,
+    std::complex<double>* B, int64_t lanes,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::ptsv_batch_interleaved(
+        n, nrhs, D, E, B, lanes, batch_size, info );
+}
+
+}  // namespace lapack
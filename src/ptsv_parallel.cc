@@ -0,0 +1,219 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "spike_internal.hh"
+#include "NoConstructAllocator.hh"
+
+#include <algorithm>
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper.
+/// @ingroup ptsv
+///
+template <typename scalar_t>
+int64_t ptsv_parallel(
+    int64_t n, int64_t nrhs,
+    blas::real_type< scalar_t >* D, scalar_t* E,
+    scalar_t* B, int64_t ldb )
+{
+    using blas::conj;
+
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( ldb < max( 1, n ) );
+
+    int64_t p = internal::spike_partitions( n, 2 );
+    if (p == 1)
+        return lapack::ptsv( n, nrhs, D, E, B, ldb );
+
+    using real_t = blas::real_type< scalar_t >;
+    lapack::vector< scalar_t > S( 2*n );
+    lapack::vector< real_t > D_save( n );
+    lapack::vector< scalar_t > E_save( n - 1 );
+    std::vector< scalar_t > T( p*4 ), Y( p*2*nrhs );
+    std::vector< int64_t > info( p, 0 );
+
+    // Restores D and E from the saved copies, so on failure the caller
+    // can fall back to lapack::ptsv with the original arrays.
+    auto restore = [&]() {
+        std::copy( D_save.begin(), D_save.end(), D );
+        std::copy( E_save.begin(), E_save.end(), E );
+    };
+
+    // Factor each diagonal block and solve for the spikes. Partition k
+    // reads its couplings E[ s-1 ] and E[ e-1 ], which pttrf of its
+    // neighbors does not touch. B is not touched until the block
+    // factorizations and the reduced system are known to succeed.
+    internal::parallel_for( p, 1, [&]( int64_t begin, int64_t end ) {
+        for (int64_t k = begin; k < end; ++k) {
+            int64_t s = internal::spike_begin( n, p, k );
+            int64_t e = internal::spike_begin( n, p, k+1 );
+            int64_t m = e - s;
+            std::copy( &D[ s ], &D[ e ], &D_save[ s ] );
+            std::copy( &E[ s ], &E[ min( e, n - 1 ) ], &E_save[ s ] );
+
+            scalar_t* Sk = &S[ 2*s ];
+            std::fill( Sk, Sk + 2*m, scalar_t( 0 ) );
+            if (k < p - 1)
+                Sk[ m - 1 ] = conj( E[ e - 1 ] );
+            if (k > 0)
+                Sk[ m ] = E[ s - 1 ];
+
+            int64_t iinfo = lapack::pttrf( m, &D[ s ], &E[ s ] );
+            if (iinfo != 0) {
+                info[ k ] = s + iinfo;
+                continue;
+            }
+            lapack::pttrs( Uplo::Lower, m, 2, &D[ s ], &E[ s ], Sk, m );
+            internal::spike_tips( m, 1, 1, 2, Sk, m, &T[ k*4 ] );
+        }
+    });
+    for (int64_t k = 0; k < p; ++k) {
+        if (info[ k ] != 0) {
+            restore();
+            return info[ k ];
+        }
+    }
+
+    std::vector< scalar_t > AB_r;
+    std::vector< int64_t > ipiv_r;
+    int64_t iinfo = internal::spike_reduced_factor(
+        n, 1, 1, p, T.data(), AB_r, ipiv_r );
+    if (iinfo != 0) {
+        restore();
+        return iinfo;
+    }
+
+    // Solve for y_k.
+    internal::parallel_for( p, 1, [&]( int64_t begin, int64_t end ) {
+        for (int64_t k = begin; k < end; ++k) {
+            int64_t s = internal::spike_begin( n, p, k );
+            int64_t m = internal::spike_begin( n, p, k+1 ) - s;
+            lapack::pttrs( Uplo::Lower, m, nrhs, &D[ s ], &E[ s ], &B[ s ], ldb );
+            internal::spike_tips( m, 1, 1, nrhs, &B[ s ], ldb, &Y[ k*2*nrhs ] );
+        }
+    });
+
+    std::vector< scalar_t > Z( 2*(p - 1)*nrhs );
+    internal::spike_reduced_solve(
+        1, 1, nrhs, p, AB_r, ipiv_r, Y.data(), Z.data() );
+
+    internal::parallel_for( p, 1, [&]( int64_t begin, int64_t end ) {
+        for (int64_t k = begin; k < end; ++k) {
+            internal::spike_update( n, 1, 1, nrhs, p, k, S.data(), Z.data(), B, ldb );
+        }
+    });
+    return 0;
+}
+
+}  // namespace impl
+
+//------------------------------------------------------------------------------
+/// @ingroup ptsv
+int64_t ptsv_parallel(
+    int64_t n, int64_t nrhs,
+    float* D, float* E,
+    float* B, int64_t ldb )
+{
+    return impl::ptsv_parallel( n, nrhs, D, E, B, ldb );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup ptsv
+int64_t ptsv_parallel(
+    int64_t n, int64_t nrhs,
+    double* D, double* E,
+    double* B, int64_t ldb )
+{
+    return impl::ptsv_parallel( n, nrhs, D, E, B, ldb );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup ptsv
+int64_t ptsv_parallel(
+    int64_t n, int64_t nrhs,
+    float* D, std::complex<float>* E,
+    std::complex<float>* B, int64_t ldb )
+{
+    return impl::ptsv_parallel( n, nrhs, D, E, B, ldb );
+}
+
+//------------------------------------------------------------------------------
+/// Computes the solution to a system of linear equations
+/// $A X = B,$ where A is an n-by-n Hermitian positive definite tridiagonal
+/// matrix, in parallel on the LAPACK++ thread pool, using the SPIKE
+/// partitioned algorithm. This is meant for a single very large system,
+/// where lapack::ptsv is sequential.
+///
+/// The rows are split into one partition per thread (see
+/// lapack::set_num_threads), each at least several thousand rows.
+/// Each diagonal block, itself positive definite, is factored by
+/// lapack::pttrf and solved by lapack::pttrs for B and for the two
+/// "spikes" that couple it to its neighbors. A reduced system of order
+/// 2(p-1), for p partitions, couples the blocks and is solved by
+/// lapack::gbsv. This costs about 2.5 times the flops of lapack::ptsv,
+/// for nrhs = 1, plus workspace of 4n elements.
+/// If the return value is > 0, D, E, and B are restored to their values
+/// on entry. If n is too small to split, this calls lapack::ptsv, and
+/// the outputs are as from lapack::ptsv.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] n
+///     The order of the matrix A. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides, i.e., the number of columns
+///     of the matrix B. nrhs >= 0.
+///
+/// @param[in,out] D
+///     The vector D of length n.
+///     On entry, the n diagonal elements of the tridiagonal matrix A.
+///     On exit, if return value = 0, overwritten by the factors of the
+///     diagonal blocks; if return value > 0, restored.
+///
+/// @param[in,out] E
+///     The vector E of length n-1.
+///     On entry, the (n-1) subdiagonal elements of the tridiagonal
+///     matrix A. On exit, if return value = 0, overwritten by the
+///     factors of the diagonal blocks; if return value > 0, restored.
+///
+/// @param[in,out] B
+///     The n-by-nrhs matrix B, stored in an ldb-by-nrhs array.
+///     On entry, the n-by-nrhs right hand side matrix B.
+///     On exit, if return value = 0, the n-by-nrhs solution matrix X;
+///     if return value > 0, B is restored.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B. ldb >= max(1,n).
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, A is not positive definite: the
+///     diagonal block holding row i, or the reduced system, has a
+///     non-positive or zero pivot at row i. The solution has not been
+///     computed, and D, E, and B are restored to their values on entry.
+///
+/// @ingroup ptsv
+int64_t ptsv_parallel(
+    int64_t n, int64_t nrhs,
+    double* D, std::complex<double>* E,
+    std::complex<double>* B, int64_t ldb )
+{
+    return impl::ptsv_parallel( n, nrhs, D, E, B, ldb );
+}
+
+}  // namespace lapack
@@ -30,6 +30,7 @@ int64_t ptsvx(
     float* ferr,
     float* berr )
 {
+    internal::StatsScope stats_scope( "sptsvx" );
     char fact_ = to_char( fact );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -72,6 +73,7 @@ int64_t ptsvx(
     double* ferr,
     double* berr )
 {
+    internal::StatsScope stats_scope( "dptsvx" );
     char fact_ = to_char( fact );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -114,6 +116,7 @@ int64_t ptsvx(
     float* ferr,
     float* berr )
 {
+    internal::StatsScope stats_scope( "cptsvx" );
     char fact_ = to_char( fact );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -261,6 +264,7 @@ int64_t ptsvx(
     double* ferr,
     double* berr )
 {
+    internal::StatsScope stats_scope( "zptsvx" );
     char fact_ = to_char( fact );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
@@ -0,0 +1,261 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "batch_internal.hh"
+
+#include <atomic>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper for the strided layout.
+/// @ingroup ptsv_computational
+///
+template <typename scalar_t>
+int64_t pttrf_batch(
+    int64_t n,
+    blas::real_type< scalar_t >* D, scalar_t* E, int64_t strideD,
+    int64_t batch_size, int64_t* info )
+{
+    lapack_error_if( n < 0 );
+    lapack_error_if( strideD < n );
+    lapack_error_if( batch_size < 0 );
+
+    // Give each thread at least ~64K flops per range.
+    int64_t grain = (int64_t( 1 ) << 16) / max( 1, 4*n );
+
+    std::atomic< int64_t > nfailed { 0 };
+    internal::parallel_for( batch_size, grain, [&]( int64_t begin, int64_t end ) {
+        int64_t count = 0;
+        for (int64_t i = begin; i < end; ++i) {
+            info[ i ] = lapack::pttrf( n, D + i*strideD, E + i*strideD );
+            if (info[ i ] > 0)
+                ++count;
+        }
+        nfailed += count;
+    });
+    return nfailed;
+}
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper for the interleaved layout.
+/// @ingroup ptsv_computational
+///
+template <typename scalar_t>
+int64_t pttrf_batch_interleaved(
+    int64_t n,
+    blas::real_type< scalar_t >* D, scalar_t* E, int64_t lanes,
+    int64_t batch_size, int64_t* info )
+{
+    lapack_error_if( n < 0 );
+    lapack_error_if( lanes < 1 );
+    lapack_error_if( batch_size < 0 );
+
+    int64_t n1 = max( 0, n - 1 );
+    int64_t nblocks = (batch_size + lanes - 1) / lanes;
+    int64_t grain = (int64_t( 1 ) << 16) / max( 1, lanes * 4*n );
+
+    std::atomic< int64_t > nfailed { 0 };
+    internal::parallel_for( nblocks, grain, [&]( int64_t begin, int64_t end ) {
+        int64_t count = 0;
+        for (int64_t b = begin; b < end; ++b) {
+            int64_t k = b * lanes;
+            int64_t nlanes = min( lanes, batch_size - k );
+            internal::pttrf_interleaved(
+                n, &D[ b * n*lanes ], &E[ b * n1*lanes ],
+                lanes, nlanes, &info[ k ] );
+            for (int64_t l = 0; l < nlanes; ++l) {
+                if (info[ k + l ] > 0)
+                    ++count;
+            }
+        }
+        nfailed += count;
+    });
+    return nfailed;
+}
+
+}  // namespace impl
+
+//------------------------------------------------------------------------------
+/// @ingroup ptsv_computational
+int64_t pttrf_batch(
+    int64_t n,
+    float* D, float* E, int64_t strideD,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::pttrf_batch( n, D, E, strideD, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup ptsv_computational
+int64_t pttrf_batch(
+    int64_t n,
+    double* D, double* E, int64_t strideD,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::pttrf_batch( n, D, E, strideD, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup ptsv_computational
+int64_t pttrf_batch(
+    int64_t n,
+    float* D, std::complex<float>* E, int64_t strideD,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::pttrf_batch( n, D, E, strideD, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// Computes L D L^H factorizations of a batch of n-by-n Hermitian
+/// positive definite tridiagonal matrices A_i, in parallel, as in
+/// lapack::pttrf.
+///
+/// Strided ("separate arrays") layout: D_i starts at D + i*strideD and
+/// E_i at E + i*strideD. Each system is handled by LAPACK, in parallel
+/// over the batch. For many small systems, the interleaved layout is
+/// faster, since its recurrence vectorizes across systems; see
+/// lapack::pttrf_batch_interleaved.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in,out] D
+///     The real vectors D_i of length n, strideD apart.
+///     On entry, the diagonal of A_i.
+///     On successful exit (info[i] = 0), the diagonal of D_i.
+///
+/// @param[in,out] E
+///     The vectors E_i of length n-1, strideD apart.
+///     On entry, the sub-diagonal of A_i.
+///     On successful exit (info[i] = 0), the sub-diagonal of the unit
+///     bidiagonal factor L_i.
+///
+/// @param[in] strideD
+///     Distance between the starts of the vectors of consecutive
+///     systems. strideD >= n.
+///
+/// @param[in] batch_size
+///     The number of matrices. batch_size >= 0.
+///
+/// @param[out] info
+///     The vector info of length batch_size.
+///     - info[i] = 0: A_i was factored successfully.
+///     - info[i] = k > 0: the leading minor of order k of A_i is not
+///       positive definite; its factorization is meaningless.
+///
+/// @return number of matrices with info[i] > 0.
+///
+/// @ingroup ptsv_computational
+int64_t pttrf_batch(
+    int64_t n,
+    double* D, std::complex<double>* E, int64_t strideD,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::pttrf_batch( n, D, E, strideD, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup ptsv_computational
+int64_t pttrf_batch_interleaved(
+    int64_t n,
+    float* D, float* E, int64_t lanes,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::pttrf_batch_interleaved( n, D, E, lanes, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup ptsv_computational
+int64_t pttrf_batch_interleaved(
+    int64_t n,
+    double* D, double* E, int64_t lanes,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::pttrf_batch_interleaved( n, D, E, lanes, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup ptsv_computational
+int64_t pttrf_batch_interleaved(
+    int64_t n,
+    float* D, std::complex<float>* E, int64_t lanes,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::pttrf_batch_interleaved( n, D, E, lanes, batch_size, info );
+}
+
+//------------------------------------------------------------------------------
+/// Computes L D L^H factorizations of a batch of n-by-n Hermitian
+/// positive definite tridiagonal matrices, in parallel; interleaved
+/// layout. See the strided form of lapack::pttrf_batch for details.
+///
+/// Vectors are stored "batch-innermost" in blocks of `lanes` systems:
+/// element j of a length-len vector (len = n for D, n-1 for E) of
+/// system k is at
+///
+///     X[ (k / lanes)*len*lanes + j*lanes + (k % lanes) ],
+///
+/// so the same element of `lanes` consecutive systems is contiguous, and
+/// the inherently serial recurrence vectorizes across systems. Use a
+/// multiple of the SIMD width, e.g., lanes = 8 or 16. See
+/// lapack::batch_interleave to convert from the strided layout, treating
+/// each vector as a len-by-1 matrix. Right hand sides B are interleaved
+/// as n-by-nrhs matrices, as in lapack::potrf_batch_interleaved.
+///
+/// When a matrix is not positive definite, its factorization continues
+/// (with a unit pivot) so the other lanes are unaffected.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in,out] D
+///     The interleaved real vectors D_i of length n.
+///     On entry, the diagonal of A_i; on successful exit, the diagonal
+///     of D_i.
+///
+/// @param[in,out] E
+///     The interleaved vectors E_i of length n-1.
+///     On entry, the sub-diagonal of A_i; on successful exit, the
+///     sub-diagonal of L_i.
+///
+/// @param[in] lanes
+///     The number of interleaved systems per block. lanes >= 1.
+///
+/// @param[in] batch_size
+///     The number of matrices. batch_size >= 0.
+///
+/// @param[out] info
+///     The vector info of length batch_size.
+///     - info[i] = 0: A_i was factored successfully.
+///     - info[i] = k > 0: the leading minor of order k of A_i is not
+///       positive definite.
+///
+/// @return number of matrices with info[i] > 0.
+///
+/// @ingroup ptsv_computational
+int64_t pttrf_batch_interleaved(
+    int64_t n,
+    double* D, std::complex<double>* E, int64_t lanes,
+    int64_t batch_size, int64_t* info )
+{
+    return impl::pttrf_batch_interleaved( n, D, E, lanes, batch_size, info );
+}
+
+}  // namespace lapack
@@ -0,0 +1,263 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "batch_internal.hh"
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper for the strided layout.
+/// @ingroup ptsv_computational
+///
+template <typename scalar_t>
+void pttrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    blas::real_type< scalar_t > const* D, scalar_t const* E, int64_t strideD,
+    scalar_t* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size )
+{
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( strideD < n );
+    lapack_error_if( ldb < max( 1, n ) );
+    lapack_error_if( strideB < ldb * nrhs );
+    lapack_error_if( batch_size < 0 );
+    to_lapack_int( ldb );  // check for overflow
+
+    // Give each thread at least ~64K flops per range.
+    int64_t grain = (int64_t( 1 ) << 16) / max( 1, 6*n*nrhs );
+
+    internal::parallel_for( batch_size, grain, [&]( int64_t begin, int64_t end ) {
+        for (int64_t i = begin; i < end; ++i) {
+            lapack::pttrs( uplo, n, nrhs, D + i*strideD, E + i*strideD,
+                           B + i*strideB, ldb );
+        }
+    });
+}
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper for the interleaved layout.
+/// @ingroup ptsv_computational
+///
+template <typename scalar_t>
+void pttrs_batch_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    blas::real_type< scalar_t > const* D, scalar_t const* E,
+    scalar_t* B, int64_t lanes,
+    int64_t batch_size )
+{
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( lanes < 1 );
+    lapack_error_if( batch_size < 0 );
+
+    int64_t n1 = max( 0, n - 1 );
+    int64_t nblocks = (batch_size + lanes - 1) / lanes;
+    int64_t grain = (int64_t( 1 ) << 16) / max( 1, lanes * 6*n*nrhs );
+
+    internal::parallel_for( nblocks, grain, [&]( int64_t begin, int64_t end ) {
+        for (int64_t b = begin; b < end; ++b) {
+            int64_t nlanes = min( lanes, batch_size - b*lanes );
+            internal::pttrs_interleaved(
+                uplo, n, nrhs, &D[ b * n*lanes ], &E[ b * n1*lanes ],
+                &B[ b * n*nrhs*lanes ], lanes, nlanes );
+        }
+    });
+}
+
+}  // namespace impl
+
+//------------------------------------------------------------------------------
+/// @ingroup ptsv_computational
+void pttrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* D, float const* E, int64_t strideD,
+    float* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size )
+{
+    impl::pttrs_batch(
+        uplo, n, nrhs, D, E, strideD, B, ldb, strideB, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup ptsv_computational
+void pttrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* D, double const* E, int64_t strideD,
+    double* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size )
+{
+    impl::pttrs_batch(
+        uplo, n, nrhs, D, E, strideD, B, ldb, strideB, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup ptsv_computational
+void pttrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* D, std::complex<float> const* E, int64_t strideD,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size )
+{
+    impl::pttrs_batch(
+        uplo, n, nrhs, D, E, strideD, B, ldb, strideB, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// Solves a batch of tridiagonal systems $A_i X_i = B_i$, in parallel,
+/// using the L D L^H factorizations computed by lapack::pttrf_batch, as
+/// in lapack::pttrs.
+///
+/// Strided ("separate arrays") layout: D_i starts at D + i*strideD, E_i
+/// at E + i*strideD, and B_i at B + i*strideB. Each system is handled by
+/// LAPACK, in parallel over the batch. For many small systems, the
+/// interleaved layout is faster, since its recurrences vectorize across
+/// systems; see lapack::pttrs_batch_interleaved.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] uplo
+///     Whether E_i is the super-diagonal or sub-diagonal of A_i,
+///     as in lapack::pttrs. Ignored for real types.
+///     - lapack::Uplo::Upper: A_i = U_i^H D_i U_i, E_i is the
+///       super-diagonal of U_i;
+///     - lapack::Uplo::Lower: A_i = L_i D_i L_i^H, E_i is the
+///       sub-diagonal of L_i, as computed by lapack::pttrf_batch.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides, i.e., the number of columns
+///     of each B_i. nrhs >= 0.
+///
+/// @param[in] D
+///     The real vectors D_i of length n, strideD apart.
+///
+/// @param[in] E
+///     The vectors E_i of length n-1, strideD apart.
+///
+/// @param[in] strideD
+///     Distance between the starts of the vectors of consecutive
+///     systems. strideD >= n.
+///
+/// @param[in,out] B
+///     The batch_size matrices B_i, each ldb-by-nrhs, strideB apart.
+///     On entry, the right hand sides; on exit, the solutions X_i.
+///
+/// @param[in] ldb
+///     The leading dimension of each B_i. ldb >= max(1,n).
+///
+/// @param[in] strideB
+///     Distance between the starts of B_i and B_{i+1}. strideB >= ldb*nrhs.
+///
+/// @param[in] batch_size
+///     The number of systems. batch_size >= 0.
+///
+/// @ingroup ptsv_computational
+void pttrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* D, std::complex<double> const* E, int64_t strideD,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    int64_t batch_size )
+{
+    impl::pttrs_batch(
+        uplo, n, nrhs, D, E, strideD, B, ldb, strideB, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup ptsv_computational
+void pttrs_batch_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* D, float const* E,
+    float* B, int64_t lanes,
+    int64_t batch_size )
+{
+    impl::pttrs_batch_interleaved(
+        uplo, n, nrhs, D, E, B, lanes, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup ptsv_computational
+void pttrs_batch_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* D, double const* E,
+    double* B, int64_t lanes,
+    int64_t batch_size )
+{
+    impl::pttrs_batch_interleaved(
+        uplo, n, nrhs, D, E, B, lanes, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup ptsv_computational
+void pttrs_batch_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* D, std::complex<float> const* E,
+    std::complex<float>* B, int64_t lanes,
+    int64_t batch_size )
+{
+    impl::pttrs_batch_interleaved(
+        uplo, n, nrhs, D, E, B, lanes, batch_size );
+}
+
+//------------------------------------------------------------------------------
+/// Solves a batch of tridiagonal systems $A_i X_i = B_i$, in parallel,
+/// using the factorizations computed by lapack::pttrf_batch_interleaved;
+/// interleaved layout. See the strided form of lapack::pttrs_batch for
+/// details, and lapack::pttrf_batch_interleaved for the layout.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] uplo
+///     Whether E_i is the super-diagonal or sub-diagonal of A_i;
+///     see lapack::pttrs_batch. Ignored for real types.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides. nrhs >= 0.
+///
+/// @param[in] D
+///     The interleaved real vectors D_i of length n.
+///
+/// @param[in] E
+///     The interleaved vectors E_i of length n-1.
+///
+/// @param[in,out] B
+///     The interleaved n-by-nrhs matrices B_i.
+///     On entry, the right hand sides; on exit, the solutions X_i.
+///
+/// @param[in] lanes
+///     The number of interleaved systems per block. lanes >= 1.
+///
+/// @param[in] batch_size
+///     The number of systems. batch_size >= 0.
+///
+/// @ingroup ptsv_computational
+void pttrs_batch_interleaved(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* D, std::complex<double> const* E,
+    std::complex<double>* B, int64_t lanes,
+    int64_t batch_size )
+{
+    impl::pttrs_batch_interleaved(
+        uplo, n, nrhs, D, E, B, lanes, batch_size );
+}
+
+}  // namespace lapack
@@ -0,0 +1,586 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+using blas::conj;
+
+//==============================================================================
+namespace impl {
+
+// All four routines keep A = Q R with Q unitary, so a rotation G applied
+// to rows k1, k2 of R is applied as G^H to columns k1, k2 of Q. With
+// blas::rot( x, y, c, s ) = [ c s; -conj(s) c ] [ x; y ], that is
+// rot on the columns of Q with sine conj( s ).
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper.
+/// @ingroup geqrf
+///
+template <typename scalar_t>
+int64_t qr_insert_col(
+    int64_t m, int64_t n, int64_t j,
+    scalar_t* Q, int64_t ldq,
+    scalar_t* R, int64_t ldr,
+    scalar_t const* x, int64_t incx )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( j < 1 || j > n+1 );
+    lapack_error_if( ldq < max( 1, m ) );
+    lapack_error_if( ldr < max( 1, m ) );
+    lapack_error_if( incx == 0 );
+
+    if (m == 0)
+        return 0;
+
+    // Shift columns j : n of R right, and put w = Q^H x in column j.
+    int64_t j0 = j - 1;
+    for (int64_t c = n-1; c >= j0; --c)
+        blas::copy( m, &R[ c*ldr ], 1, &R[ (c+1)*ldr ], 1 );
+    blas::gemv( Layout::ColMajor, Op::ConjTrans, m, m,
+                1.0, Q, ldq, x, incx, 0.0, &R[ j0*ldr ], 1 );
+
+    // Zero w below the diagonal, bottom up. Shifted column c had rows
+    // 0 : c-1, so rotating rows i-1, i touches only columns c >= i and
+    // keeps R upper trapezoidal.
+    for (int64_t i = m-1; i > j0; --i) {
+        real_t c;
+        scalar_t s, r;
+        lapack::lartg( R[ (i-1) + j0*ldr ], R[ i + j0*ldr ], &c, &s, &r );
+        R[ (i-1) + j0*ldr ] = r;
+        R[ i + j0*ldr ] = 0;
+        if (i <= n) {
+            blas::rot( n+1 - i, &R[ (i-1) + i*ldr ], ldr,
+                                &R[ i + i*ldr ], ldr, c, s );
+        }
+        blas::rot( m, &Q[ (i-1)*ldq ], 1, &Q[ i*ldq ], 1, c, conj( s ) );
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper.
+/// @ingroup geqrf
+///
+template <typename scalar_t>
+int64_t qr_delete_col(
+    int64_t m, int64_t n, int64_t j,
+    scalar_t* Q, int64_t ldq,
+    scalar_t* R, int64_t ldr )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 1 );
+    lapack_error_if( j < 1 || j > n );
+    lapack_error_if( Q != nullptr && ldq < max( 1, m ) );
+    lapack_error_if( ldr < max( 1, m ) );
+
+    if (m == 0)
+        return 0;
+
+    // Shift columns j+1 : n of R left, leaving R upper Hessenberg in
+    // columns j : n-1.
+    int64_t j0 = j - 1;
+    for (int64_t c = j0+1; c < n; ++c)
+        blas::copy( m, &R[ c*ldr ], 1, &R[ (c-1)*ldr ], 1 );
+
+    // Zero the subdiagonal, top down.
+    int64_t kmax = min( n-1, m-1 );
+    for (int64_t k = j0; k < kmax; ++k) {
+        real_t c;
+        scalar_t s, r;
+        lapack::lartg( R[ k + k*ldr ], R[ (k+1) + k*ldr ], &c, &s, &r );
+        R[ k + k*ldr ] = r;
+        R[ (k+1) + k*ldr ] = 0;
+        blas::rot( n-2 - k, &R[ k + (k+1)*ldr ], ldr,
+                            &R[ (k+1) + (k+1)*ldr ], ldr, c, s );
+        if (Q != nullptr)
+            blas::rot( m, &Q[ k*ldq ], 1, &Q[ (k+1)*ldq ], 1, c, conj( s ) );
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper.
+/// @ingroup geqrf
+///
+template <typename scalar_t>
+int64_t qr_insert_row(
+    int64_t m, int64_t n, int64_t i,
+    scalar_t* Q, int64_t ldq,
+    scalar_t* R, int64_t ldr,
+    scalar_t const* x, int64_t incx )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( i < 1 || i > m+1 );
+    lapack_error_if( Q != nullptr && ldq < m+1 );
+    lapack_error_if( ldr < m+1 );
+    lapack_error_if( incx == 0 );
+
+    // Append x as row m of R, and border Q with e_m:
+    // [ A; x ] = [ Q 0; 0 1 ] [ R; x ].
+    blas::copy( n, x, incx, &R[ m ], ldr );
+    if (Q != nullptr) {
+        for (int64_t k = 0; k < m; ++k) {
+            Q[ k + m*ldq ] = 0;
+            Q[ m + k*ldq ] = 0;
+        }
+        Q[ m + m*ldq ] = 1;
+    }
+
+    // Rotate x into each row of R.
+    for (int64_t k = 0; k < min( m, n ); ++k) {
+        real_t c;
+        scalar_t s, r;
+        lapack::lartg( R[ k + k*ldr ], R[ m + k*ldr ], &c, &s, &r );
+        R[ k + k*ldr ] = r;
+        R[ m + k*ldr ] = 0;
+        blas::rot( n-1 - k, &R[ k + (k+1)*ldr ], ldr,
+                            &R[ m + (k+1)*ldr ], ldr, c, s );
+        if (Q != nullptr)
+            blas::rot( m+1, &Q[ k*ldq ], 1, &Q[ m*ldq ], 1, c, conj( s ) );
+    }
+
+    // Move row m of Q to row i, so x is row i of the new A.
+    if (Q != nullptr) {
+        int64_t i0 = i - 1;
+        for (int64_t c = 0; c <= m; ++c) {
+            scalar_t* Qc = &Q[ c*ldq ];
+            scalar_t t = Qc[ m ];
+            for (int64_t k = m; k > i0; --k)
+                Qc[ k ] = Qc[ k-1 ];
+            Qc[ i0 ] = t;
+        }
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper.
+/// @ingroup geqrf
+///
+template <typename scalar_t>
+int64_t qr_delete_row(
+    int64_t m, int64_t n, int64_t i,
+    scalar_t* Q, int64_t ldq,
+    scalar_t* R, int64_t ldr )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    lapack_error_if( m < 1 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( i < 1 || i > m );
+    lapack_error_if( Q == nullptr );
+    lapack_error_if( ldq < m );
+    lapack_error_if( ldr < m );
+
+    // Rotate row i of Q to a multiple of e_1, bottom up. The same
+    // rotations make R upper Hessenberg; then column 1 of Q is zero
+    // except in row i, so dropping row i of Q and A, column 1 of Q, and
+    // row 1 of R leaves a QR factorization.
+    int64_t i0 = i - 1;
+    for (int64_t k = m-2; k >= 0; --k) {
+        real_t c;
+        scalar_t s, r;
+        lapack::lartg( conj( Q[ i0 + k*ldq ] ), conj( Q[ i0 + (k+1)*ldq ] ),
+                       &c, &s, &r );
+        blas::rot( m, &Q[ k*ldq ], 1, &Q[ (k+1)*ldq ], 1, c, conj( s ) );
+        Q[ i0 + (k+1)*ldq ] = 0;
+        if (k < n) {
+            blas::rot( n - k, &R[ k + k*ldr ], ldr,
+                              &R[ (k+1) + k*ldr ], ldr, c, s );
+        }
+    }
+
+    // Drop row 1 of R.
+    for (int64_t c = 0; c < n; ++c) {
+        scalar_t* Rc = &R[ c*ldr ];
+        for (int64_t k = 1; k < m; ++k)
+            Rc[ k-1 ] = Rc[ k ];
+    }
+
+    // Drop row i and column 1 of Q.
+    for (int64_t c = 1; c < m; ++c) {
+        scalar_t const* Qc = &Q[ c*ldq ];
+        scalar_t* Qd = &Q[ (c-1)*ldq ];
+        for (int64_t k = 0; k < i0; ++k)
+            Qd[ k ] = Qc[ k ];
+        for (int64_t k = i0+1; k < m; ++k)
+            Qd[ k-1 ] = Qc[ k ];
+    }
+    return 0;
+}
+
+}  // namespace impl
+
+//------------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t qr_insert_col(
+    int64_t m, int64_t n, int64_t j,
+    float* Q, int64_t ldq,
+    float* R, int64_t ldr,
+    float const* x, int64_t incx )
+{
+    return impl::qr_insert_col( m, n, j, Q, ldq, R, ldr, x, incx );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t qr_insert_col(
+    int64_t m, int64_t n, int64_t j,
+    double* Q, int64_t ldq,
+    double* R, int64_t ldr,
+    double const* x, int64_t incx )
+{
+    return impl::qr_insert_col( m, n, j, Q, ldq, R, ldr, x, incx );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t qr_insert_col(
+    int64_t m, int64_t n, int64_t j,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* R, int64_t ldr,
+    std::complex<float> const* x, int64_t incx )
+{
+    return impl::qr_insert_col( m, n, j, Q, ldq, R, ldr, x, incx );
+}
+
+//------------------------------------------------------------------------------
+/// Updates the full QR factorization $A = Q R$ of an m-by-n matrix A to
+/// that of the m-by-(n+1) matrix
+/// \[
+///     \tilde{A} = [ A(:, 1:j-1),\; x,\; A(:, j:n) ],
+/// \]
+/// with x inserted as column j, in $O(m^2)$ operations instead of the
+/// $O(m n^2)$ of refactoring. With $w = Q^H x$ in column j of R,
+/// Givens rotations (lartg and rot) zero w below the diagonal, bottom
+/// up, as in MATLAB's qrinsert.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @see qr_delete_col, qr_insert_row, qr_delete_row
+///
+/// @param[in] m
+///     The number of rows of the matrix A. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of the matrix A. n >= 0.
+///
+/// @param[in] j
+///     The index of the new column, 1 <= j <= n+1.
+///
+/// @param[in,out] Q
+///     The m-by-m array Q, stored in an ldq-by-m array.
+///     On entry, the unitary factor Q of A, e.g., from lapack::ungqr
+///     with m columns.
+///     On exit, the unitary factor of $\tilde{A}$.
+///
+/// @param[in] ldq
+///     The leading dimension of the array Q. ldq >= max(1,m).
+///
+/// @param[in,out] R
+///     The array R, of dimension (ldr,n+1).
+///     On entry, the m-by-n upper trapezoidal factor R of A; entries
+///     below the diagonal must be zero.
+///     On exit, the m-by-(n+1) upper trapezoidal factor of $\tilde{A}$.
+///
+/// @param[in] ldr
+///     The leading dimension of the array R. ldr >= max(1,m).
+///
+/// @param[in] x
+///     The new column, of length m, with stride incx.
+///
+/// @param[in] incx
+///     The stride of x. incx != 0.
+///
+/// @return = 0: successful exit
+///
+/// @ingroup geqrf
+int64_t qr_insert_col(
+    int64_t m, int64_t n, int64_t j,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* R, int64_t ldr,
+    std::complex<double> const* x, int64_t incx )
+{
+    return impl::qr_insert_col( m, n, j, Q, ldq, R, ldr, x, incx );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t qr_delete_col(
+    int64_t m, int64_t n, int64_t j,
+    float* Q, int64_t ldq,
+    float* R, int64_t ldr )
+{
+    return impl::qr_delete_col( m, n, j, Q, ldq, R, ldr );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t qr_delete_col(
+    int64_t m, int64_t n, int64_t j,
+    double* Q, int64_t ldq,
+    double* R, int64_t ldr )
+{
+    return impl::qr_delete_col( m, n, j, Q, ldq, R, ldr );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t qr_delete_col(
+    int64_t m, int64_t n, int64_t j,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* R, int64_t ldr )
+{
+    return impl::qr_delete_col( m, n, j, Q, ldq, R, ldr );
+}
+
+//------------------------------------------------------------------------------
+/// Updates the full QR factorization $A = Q R$ of an m-by-n matrix A to
+/// that of the m-by-(n-1) matrix $\tilde{A} = [ A(:, 1:j-1),\; A(:, j+1:n) ]$,
+/// with column j removed, in $O(m (n-j))$ operations. Removing the
+/// column leaves R upper Hessenberg in columns j to n-1; Givens
+/// rotations restore it to upper trapezoidal, as in MATLAB's qrdelete.
+///
+/// Q is only rotated, never read, so it may be null to update R alone,
+/// e.g., for seminormal equations or a factor from lapack::geqrf whose
+/// Householder vectors are not needed. Then the cost is $O(n (n-j))$.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @see qr_insert_col, qr_insert_row, qr_delete_row
+///
+/// @param[in] m
+///     The number of rows of the matrix A. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of the matrix A. n >= 1.
+///
+/// @param[in] j
+///     The index of the column to remove, 1 <= j <= n.
+///
+/// @param[in,out] Q
+///     The m-by-m array Q, stored in an ldq-by-m array, or null.
+///     On entry, the unitary factor Q of A.
+///     On exit, the unitary factor of $\tilde{A}$.
+///
+/// @param[in] ldq
+///     The leading dimension of the array Q. ldq >= max(1,m) if Q is
+///     not null.
+///
+/// @param[in,out] R
+///     The array R, of dimension (ldr,n).
+///     On entry, the m-by-n upper trapezoidal factor R of A; entries
+///     below the diagonal must be zero.
+///     On exit, the m-by-(n-1) upper trapezoidal factor of $\tilde{A}$.
+///     Column n is not referenced.
+///
+/// @param[in] ldr
+///     The leading dimension of the array R. ldr >= max(1,m).
+///
+/// @return = 0: successful exit
+///
+/// @ingroup geqrf
+int64_t qr_delete_col(
+    int64_t m, int64_t n, int64_t j,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* R, int64_t ldr )
+{
+    return impl::qr_delete_col( m, n, j, Q, ldq, R, ldr );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t qr_insert_row(
+    int64_t m, int64_t n, int64_t i,
+    float* Q, int64_t ldq,
+    float* R, int64_t ldr,
+    float const* x, int64_t incx )
+{
+    return impl::qr_insert_row( m, n, i, Q, ldq, R, ldr, x, incx );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t qr_insert_row(
+    int64_t m, int64_t n, int64_t i,
+    double* Q, int64_t ldq,
+    double* R, int64_t ldr,
+    double const* x, int64_t incx )
+{
+    return impl::qr_insert_row( m, n, i, Q, ldq, R, ldr, x, incx );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t qr_insert_row(
+    int64_t m, int64_t n, int64_t i,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* R, int64_t ldr,
+    std::complex<float> const* x, int64_t incx )
+{
+    return impl::qr_insert_row( m, n, i, Q, ldq, R, ldr, x, incx );
+}
+
+//------------------------------------------------------------------------------
+/// Updates the full QR factorization $A = Q R$ of an m-by-n matrix A to
+/// that of the (m+1)-by-n matrix $\tilde{A}$ with the row $x^T$ inserted
+/// as row i, in $O(m^2 + n^2)$ operations. With
+/// $[ A; x^T ] = \text{diag}( Q, 1 ) [ R; x^T ],$ Givens rotations
+/// rotate x into each row of R, then the last row of Q is moved to row i.
+///
+/// Q may be null to update R alone, e.g., to add an observation to a
+/// least squares problem factored by lapack::geqrf. Then the cost is
+/// $O(n^2)$.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @see qr_delete_row, qr_insert_col, qr_delete_col
+///
+/// @param[in] m
+///     The number of rows of the matrix A. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of the matrix A. n >= 0.
+///
+/// @param[in] i
+///     The index of the new row, 1 <= i <= m+1.
+///
+/// @param[in,out] Q
+///     The array Q, of dimension (ldq,m+1), or null.
+///     On entry, the m-by-m unitary factor Q of A.
+///     On exit, the (m+1)-by-(m+1) unitary factor of $\tilde{A}$.
+///
+/// @param[in] ldq
+///     The leading dimension of the array Q. ldq >= m+1 if Q is not null.
+///
+/// @param[in,out] R
+///     The array R, of dimension (ldr,n).
+///     On entry, the m-by-n upper trapezoidal factor R of A; entries
+///     below the diagonal must be zero.
+///     On exit, the (m+1)-by-n upper trapezoidal factor of $\tilde{A}$.
+///
+/// @param[in] ldr
+///     The leading dimension of the array R. ldr >= m+1.
+///
+/// @param[in] x
+///     The new row, of length n, with stride incx.
+///
+/// @param[in] incx
+///     The stride of x. incx != 0.
+///
+/// @return = 0: successful exit
+///
+/// @ingroup geqrf
+int64_t qr_insert_row(
+    int64_t m, int64_t n, int64_t i,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* R, int64_t ldr,
+    std::complex<double> const* x, int64_t incx )
+{
+    return impl::qr_insert_row( m, n, i, Q, ldq, R, ldr, x, incx );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t qr_delete_row(
+    int64_t m, int64_t n, int64_t i,
+    float* Q, int64_t ldq,
+    float* R, int64_t ldr )
+{
+    return impl::qr_delete_row( m, n, i, Q, ldq, R, ldr );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t qr_delete_row(
+    int64_t m, int64_t n, int64_t i,
+    double* Q, int64_t ldq,
+    double* R, int64_t ldr )
+{
+    return impl::qr_delete_row( m, n, i, Q, ldq, R, ldr );
+}
+
+//------------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t qr_delete_row(
+    int64_t m, int64_t n, int64_t i,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* R, int64_t ldr )
+{
+    return impl::qr_delete_row( m, n, i, Q, ldq, R, ldr );
+}
+
+//------------------------------------------------------------------------------
+/// Updates the full QR factorization $A = Q R$ of an m-by-n matrix A to
+/// that of the (m-1)-by-n matrix $\tilde{A}$ with row i removed, in
+/// $O(m^2 + m n)$ operations. Givens rotations reduce row i of Q to a
+/// multiple of $e_1^T$, bottom up; applied to R, they make it upper
+/// Hessenberg. Then row i and column 1 of Q, and row 1 of R, are dropped,
+/// as in Golub and Van Loan, section 6.5.
+///
+/// Unlike qr_delete_col and qr_insert_row, this needs row i of Q, so Q
+/// cannot be null.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @see qr_insert_row, qr_insert_col, qr_delete_col
+///
+/// @param[in] m
+///     The number of rows of the matrix A. m >= 1.
+///
+/// @param[in] n
+///     The number of columns of the matrix A. n >= 0.
+///
+/// @param[in] i
+///     The index of the row to remove, 1 <= i <= m.
+///
+/// @param[in,out] Q
+///     The m-by-m array Q, stored in an ldq-by-m array.
+///     On entry, the unitary factor Q of A.
+///     On exit, the (m-1)-by-(m-1) unitary factor of $\tilde{A}$, with
+///     leading dimension ldq. Row and column m are not referenced.
+///
+/// @param[in] ldq
+///     The leading dimension of the array Q. ldq >= m.
+///
+/// @param[in,out] R
+///     The array R, of dimension (ldr,n).
+///     On entry, the m-by-n upper trapezoidal factor R of A; entries
+///     below the diagonal must be zero.
+///     On exit, the (m-1)-by-n upper trapezoidal factor of $\tilde{A}$.
+///
+/// @param[in] ldr
+///     The leading dimension of the array R. ldr >= m.
+///
+/// @return = 0: successful exit
+///
+/// @ingroup geqrf
+int64_t qr_delete_row(
+    int64_t m, int64_t n, int64_t i,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* R, int64_t ldr )
+{
+    return impl::qr_delete_row( m, n, i, Q, ldq, R, ldr );
+}
+
+}  // namespace lapack
@@ -23,6 +23,7 @@ int64_t sbev(
     float* W,
     float* Z, int64_t ldz )
 {
+    internal::StatsScope stats_scope( "ssbev" );
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -54,6 +55,7 @@ int64_t sbev(
     double* W,
     double* Z, int64_t ldz )
 {
+    internal::StatsScope stats_scope( "dsbev" );
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
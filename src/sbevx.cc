@@ -26,6 +26,7 @@ int64_t sbevx(
     float* Z, int64_t ldz,
     int64_t* ifail )
 {
+    internal::StatsScope stats_scope( "ssbevx" );
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     char uplo_ = to_char( uplo );
@@ -82,6 +83,7 @@ int64_t sbevx(
     double* Z, int64_t ldz,
     int64_t* ifail )
 {
+    internal::StatsScope stats_scope( "dsbevx" );
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     char uplo_ = to_char( uplo );
@@ -23,6 +23,7 @@ int64_t sbgst(
     float const* BB, int64_t ldbb,
     float* X, int64_t ldx )
 {
+    internal::StatsScope stats_scope( "ssbgst" );
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -56,6 +57,7 @@ int64_t sbgst(
     double const* BB, int64_t ldbb,
     double* X, int64_t ldx )
 {
+    internal::StatsScope stats_scope( "dsbgst" );
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -24,6 +24,7 @@ int64_t sbgv(
     float* W,
     float* Z, int64_t ldz )
 {
+    internal::StatsScope stats_scope( "ssbgv" );
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -59,6 +60,7 @@ int64_t sbgv(
     double* W,
     double* Z, int64_t ldz )
 {
+    internal::StatsScope stats_scope( "dsbgv" );
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
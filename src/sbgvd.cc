@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack_internal.hh"
 #include "lapack/fortran.h"
+#include "work_size_cache.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -17,13 +18,21 @@ using blas::min;
 using blas::real;
 
 // -----------------------------------------------------------------------------
-int64_t sbgvd(
+void sbgvd_work_size(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
     float* AB, int64_t ldab,
     float* BB, int64_t ldbb,
     float* W,
-    float* Z, int64_t ldz )
+    float* Z, int64_t ldz,
+    int64_t* lwork,
+    int64_t* liwork )
 {
+    internal::StatsScope stats_scope( "ssbgvd" );
+    internal::WorkSizeKey key( "ssbgvd",
+        { to_char( jobz ), to_char( uplo ), n, ka, kb, ldab, ldbb, ldz } );
+    if (internal::work_size_cache_find( key, lwork, nullptr, liwork ))
+        return;
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -38,6 +47,7 @@ int64_t sbgvd(
     float qry_work[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_ssbgvd(
         &jobz_, &uplo_, &n_, &ka_, &kb_,
         AB, &ldab_,
@@ -47,6 +57,7 @@ int64_t sbgvd(
         qry_work, &ineg_one,
         qry_iwork, &ineg_one, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
@@ -56,9 +67,32 @@ int64_t sbgvd(
     // LAPACK <= 3.6.0 needed 3*n, but query returned 2*n. Be safe.
     lwork_ = max( lwork_, 3*n_ );
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    *lwork = lwork_;
+    *liwork = liwork_;
+    internal::work_size_cache_insert( key, *lwork, 0, *liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t sbgvd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    float* AB, int64_t ldab,
+    float* BB, int64_t ldbb,
+    float* W,
+    float* Z, int64_t ldz,
+    float* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    char jobz_ = to_char( jobz );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ka_ = to_lapack_int( ka );
+    lapack_int kb_ = to_lapack_int( kb );
+    lapack_int ldab_ = to_lapack_int( ldab );
+    lapack_int ldbb_ = to_lapack_int( ldbb );
+    lapack_int ldz_ = to_lapack_int( ldz );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int liwork_ = to_lapack_int( liwork );
+    lapack_int info_ = 0;
 
     LAPACK_ssbgvd(
         &jobz_, &uplo_, &n_, &ka_, &kb_,
@@ -66,8 +100,8 @@ int64_t sbgvd(
         BB, &ldbb_,
         W,
         Z, &ldz_,
-        &work[0], &lwork_,
-        &iwork[0], &liwork_, &info_
+        work, &lwork_,
+        iwork, &liwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -77,12 +111,53 @@ int64_t sbgvd(
 
 // -----------------------------------------------------------------------------
 int64_t sbgvd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    float* AB, int64_t ldab,
+    float* BB, int64_t ldbb,
+    float* W,
+    float* Z, int64_t ldz )
+{
+    internal::StatsScope stats_scope( "ssbgvd" );
+    int64_t lwork, liwork;
+    sbgvd_work_size(
+        jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz,
+        &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return sbgvd(
+        jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz,
+        &work[0], lwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::sbgvd with caller-supplied workspace.
+/// Arguments are the same as for lapack::sbgvd; the matrices are not
+/// modified. The sizes can be reused for any call of the same shape.
+///
+/// @param[out] lwork
+///     Required length of the work array.
+///
+/// @param[out] liwork
+///     Required length of the iwork array.
+///
+void sbgvd_work_size(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
     double* AB, int64_t ldab,
     double* BB, int64_t ldbb,
     double* W,
-    double* Z, int64_t ldz )
+    double* Z, int64_t ldz,
+    int64_t* lwork,
+    int64_t* liwork )
 {
+    internal::StatsScope stats_scope( "dsbgvd" );
+    internal::WorkSizeKey key( "dsbgvd",
+        { to_char( jobz ), to_char( uplo ), n, ka, kb, ldab, ldbb, ldz } );
+    if (internal::work_size_cache_find( key, lwork, nullptr, liwork ))
+        return;
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -97,6 +172,7 @@ int64_t sbgvd(
     double qry_work[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_dsbgvd(
         &jobz_, &uplo_, &n_, &ka_, &kb_,
         AB, &ldab_,
@@ -106,6 +182,7 @@ int64_t sbgvd(
         qry_work, &ineg_one,
         qry_iwork, &ineg_one, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
@@ -115,9 +192,48 @@ int64_t sbgvd(
     // LAPACK <= 3.6.0 needed 3*n, but query returned 2*n. Be safe.
     lwork_ = max( lwork_, 3*n_ );
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+    *lwork = lwork_;
+    *liwork = liwork_;
+    internal::work_size_cache_insert( key, *lwork, 0, *liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::sbgvd with caller-supplied workspace, which
+/// skips the internal workspace query and allocation. Other arguments
+/// are the same as for lapack::sbgvd.
+///
+/// @param[out] work
+///     Workspace of length lwork.
+///
+/// @param[in] lwork
+///     Length of work, at least as returned by lapack::sbgvd_work_size.
+///
+/// @param[out] iwork
+///     Workspace of length liwork.
+///
+/// @param[in] liwork
+///     Length of iwork, at least as returned by lapack::sbgvd_work_size.
+///
+int64_t sbgvd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    double* AB, int64_t ldab,
+    double* BB, int64_t ldbb,
+    double* W,
+    double* Z, int64_t ldz,
+    double* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    char jobz_ = to_char( jobz );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ka_ = to_lapack_int( ka );
+    lapack_int kb_ = to_lapack_int( kb );
+    lapack_int ldab_ = to_lapack_int( ldab );
+    lapack_int ldbb_ = to_lapack_int( ldbb );
+    lapack_int ldz_ = to_lapack_int( ldz );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int liwork_ = to_lapack_int( liwork );
+    lapack_int info_ = 0;
 
     LAPACK_dsbgvd(
         &jobz_, &uplo_, &n_, &ka_, &kb_,
@@ -125,8 +241,8 @@ int64_t sbgvd(
         BB, &ldbb_,
         W,
         Z, &ldz_,
-        &work[0], &lwork_,
-        &iwork[0], &liwork_, &info_
+        work, &lwork_,
+        iwork, &liwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -134,4 +250,27 @@ int64_t sbgvd(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+int64_t sbgvd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t ka, int64_t kb,
+    double* AB, int64_t ldab,
+    double* BB, int64_t ldbb,
+    double* W,
+    double* Z, int64_t ldz )
+{
+    internal::StatsScope stats_scope( "dsbgvd" );
+    int64_t lwork, liwork;
+    sbgvd_work_size(
+        jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz,
+        &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return sbgvd(
+        jobz, uplo, n, ka, kb, AB, ldab, BB, ldbb, W, Z, ldz,
+        &work[0], lwork, &iwork[0], liwork );
+}
+
 }  // namespace lapack
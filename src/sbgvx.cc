@@ -27,6 +27,7 @@ int64_t sbgvx(
     float* Z, int64_t ldz,
     int64_t* ifail )
 {
+    internal::StatsScope stats_scope( "ssbgvx" );
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     char uplo_ = to_char( uplo );
@@ -87,6 +88,7 @@ int64_t sbgvx(
     double* Z, int64_t ldz,
     int64_t* ifail )
 {
+    internal::StatsScope stats_scope( "dsbgvx" );
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     char uplo_ = to_char( uplo );
@@ -24,6 +24,7 @@ int64_t sbtrd(
     float* E,
     float* Q, int64_t ldq )
 {
+    internal::StatsScope stats_scope( "ssbtrd" );
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -57,6 +58,7 @@ int64_t sbtrd(
     double* E,
     double* Q, int64_t ldq )
 {
+    internal::StatsScope stats_scope( "dsbtrd" );
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
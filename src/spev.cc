@@ -23,6 +23,7 @@ int64_t spev(
     float* W,
     float* Z, int64_t ldz )
 {
+    internal::StatsScope stats_scope( "sspev" );
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -52,6 +53,7 @@ int64_t spev(
     double* W,
     double* Z, int64_t ldz )
 {
+    internal::StatsScope stats_scope( "dspev" );
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -25,6 +25,7 @@ int64_t spevx(
     float* Z, int64_t ldz,
     int64_t* ifail )
 {
+    internal::StatsScope stats_scope( "sspevx" );
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     char uplo_ = to_char( uplo );
@@ -76,6 +77,7 @@ int64_t spevx(
     double* Z, int64_t ldz,
     int64_t* ifail )
 {
+    internal::StatsScope stats_scope( "dspevx" );
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
     char uplo_ = to_char( uplo );
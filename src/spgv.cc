@@ -24,6 +24,7 @@ int64_t spgv(
     float* W,
     float* Z, int64_t ldz )
 {
+    internal::StatsScope stats_scope( "sspgv" );
     lapack_int itype_ = to_lapack_int( itype );
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
@@ -56,6 +57,7 @@ int64_t spgv(
     double* W,
     double* Z, int64_t ldz )
 {
+    internal::StatsScope stats_scope( "dspgv" );
     lapack_int itype_ = to_lapack_int( itype );
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
@@ -26,6 +26,7 @@ int64_t spgvx(
     float* Z, int64_t ldz,
     int64_t* ifail )
 {
+    internal::StatsScope stats_scope( "sspgvx" );
     lapack_int itype_ = to_lapack_int( itype );
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
@@ -80,6 +81,7 @@ int64_t spgvx(
     double* Z, int64_t ldz,
     int64_t* ifail )
 {
+    internal::StatsScope stats_scope( "dspgvx" );
     lapack_int itype_ = to_lapack_int( itype );
     char jobz_ = to_char( jobz );
     char range_ = to_char( range );
@@ -0,0 +1,279 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_SPIKE_INTERNAL_HH
+#define LAPACK_SPIKE_INTERNAL_HH
+
+#include "lapack.hh"
+#include "thread_pool.hh"
+
+#include <algorithm>
+#include <vector>
+
+// Helpers for the SPIKE partitioned solvers for banded matrices with
+// kl sub-diagonals and ku super-diagonals: gbsv_parallel, pbsv_parallel,
+// and, with kl = ku = 1, gtsv_parallel and ptsv_parallel.
+//
+// Rows of A are split into p partitions; partition k holds rows
+// [ s_k, e_k ) with m_k = e_k - s_k >= kl + ku. With A_k the diagonal
+// block of partition k, its couplings to the neighboring partitions are
+// the ku-by-ku block B_k = A( e_k - ku : e_k - 1, e_k : e_k + ku - 1 ) and
+// the kl-by-kl block C_k = A( s_k : s_k + kl - 1, s_k - kl : s_k - 1 ).
+// Each partition computes
+//
+//     y_k = A_k^{-1} b_k,
+//     V_k = A_k^{-1} [ 0; B_k ],    (right spike, m_k-by-ku; zero for k = p-1)
+//     W_k = A_k^{-1} [ C_k; 0 ],    (left spike,  m_k-by-kl; zero for k = 0)
+//
+// so x_k = y_k - V_k xt_{k+1} - W_k xb_{k-1}, where xt_k is the first ku
+// and xb_k the last kl rows of x_k. The (p-1)(kl + ku) unknowns at
+// partition boundaries satisfy a small banded reduced system, built from
+// the tips of y_k, V_k, W_k -- their first ku and last kl rows -- and
+// solved with gbsv. Each partition is then updated in parallel.
+
+namespace lapack {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Fewest rows per partition. Below this, thread start-up and the extra
+/// spike solves cost more than the parallelism saves.
+const int64_t spike_min_rows = 4096;
+
+//------------------------------------------------------------------------------
+/// @return number of partitions for a banded system of order n with
+/// q = kl + ku off-diagonals: one per thread, with at least
+/// spike_min_rows rows, and several bandwidths, each.
+inline int64_t spike_partitions( int64_t n, int64_t q )
+{
+    int64_t p = ThreadPool::instance().num_threads();
+    int64_t min_rows = std::max( spike_min_rows, 4*q );
+    return std::max( int64_t( 1 ), std::min( p, n / min_rows ) );
+}
+
+//------------------------------------------------------------------------------
+/// @return first row of partition k of p, for 0 <= k <= p;
+/// partition k is rows [ spike_begin( k ), spike_begin( k+1 ) ).
+inline int64_t spike_begin( int64_t n, int64_t p, int64_t k )
+{
+    return n / p * k + std::min( k, n % p );
+}
+
+//------------------------------------------------------------------------------
+/// Copies the tips of the m-by-ncols matrix X -- its first ku rows,
+/// then its last kl rows -- to the (kl + ku)-by-ncols matrix T.
+template <typename scalar_t>
+void spike_tips(
+    int64_t m, int64_t kl, int64_t ku, int64_t ncols,
+    scalar_t const* X, int64_t ldx,
+    scalar_t* T )
+{
+    int64_t q = kl + ku;
+    for (int64_t j = 0; j < ncols; ++j) {
+        std::copy( &X[ j*ldx ], &X[ ku + j*ldx ], &T[ j*q ] );
+        std::copy( &X[ m - kl + j*ldx ], &X[ m + j*ldx ], &T[ ku + j*q ] );
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Builds and factors the reduced system for the boundary unknowns,
+/// before B is touched, so a singular reduced system leaves B unchanged.
+/// Its (p-1)q unknowns, with q = kl + ku, are ordered as in
+/// spike_reduced_solve.
+///
+/// @param[in] T
+///     Spike tips; for partition k, the q-by-q tips of [ V_k, W_k ] at
+///     T + k*q*q, from spike_tips.
+///
+/// @param[out] AB
+///     The LU factors of the reduced system, from gbtrf, in band storage
+///     with q + kl - 1 subdiagonals and q + ku - 1 superdiagonals.
+///
+/// @param[out] ipiv
+///     The pivots of the reduced system, from gbtrf.
+///
+/// @return 0, or i+1 if the reduced system is singular, where i is the
+///     row of A of the zero pivot.
+///
+template <typename scalar_t>
+int64_t spike_reduced_factor(
+    int64_t n, int64_t kl, int64_t ku, int64_t p,
+    scalar_t const* T,
+    std::vector< scalar_t >& AB, std::vector< int64_t >& ipiv )
+{
+    int64_t q = kl + ku;
+    int64_t r = (p - 1)*q;
+    int64_t klr = q + kl - 1;
+    int64_t kur = q + ku - 1;
+    int64_t ldab = 2*klr + kur + 1;
+    AB.assign( ldab * r, scalar_t( 0 ) );
+    ipiv.resize( r );
+
+    // A( i, j ) is stored in AB( klr + kur + i - j, j ).
+    auto A = [&]( int64_t i, int64_t j ) -> scalar_t& {
+        return AB[ klr + kur + i - j + j*ldab ];
+    };
+    for (int64_t k = 0; k < p - 1; ++k) {
+        scalar_t const* T0 = &T[ k*q*q ];        // tips of [ V_k, W_k ]
+        scalar_t const* T1 = &T[ (k + 1)*q*q ];  // tips of [ V_{k+1}, W_{k+1} ]
+        int64_t rb = k*q;
+
+        // Last kl rows of partition k:
+        // xb_k + V_k^b xt_{k+1} + W_k^b xb_{k-1} = y_k^b.
+        for (int64_t i = 0; i < kl; ++i) {
+            A( rb + i, rb + i ) = 1;
+            for (int64_t j = 0; j < ku; ++j)
+                A( rb + i, rb + kl + j ) = T0[ ku + i + j*q ];
+            if (k > 0) {
+                for (int64_t j = 0; j < kl; ++j)
+                    A( rb + i, rb - q + j ) = T0[ ku + i + (ku + j)*q ];
+            }
+        }
+
+        // First ku rows of partition k+1:
+        // xt_{k+1} + V_{k+1}^t xt_{k+2} + W_{k+1}^t xb_k = y_{k+1}^t.
+        for (int64_t i = 0; i < ku; ++i) {
+            A( rb + kl + i, rb + kl + i ) = 1;
+            for (int64_t j = 0; j < kl; ++j)
+                A( rb + kl + i, rb + j ) = T1[ i + (ku + j)*q ];
+            if (k < p - 2) {
+                for (int64_t j = 0; j < ku; ++j)
+                    A( rb + kl + i, rb + q + kl + j ) = T1[ i + j*q ];
+            }
+        }
+    }
+
+    int64_t info = lapack::gbtrf( r, r, klr, kur, AB.data(), ldab,
+                                  ipiv.data() );
+    if (info > 0) {
+        int64_t k = (info - 1) / q;
+        int64_t i = (info - 1) % q;
+        int64_t s1 = spike_begin( n, p, k+1 );
+        info = (i < kl ? s1 - kl + i : s1 + i - kl) + 1;
+    }
+    return info;
+}
+
+//------------------------------------------------------------------------------
+/// Solves the reduced system factored by spike_reduced_factor for the
+/// boundary unknowns. For boundary k = 0, ..., p-2, with q = kl + ku,
+///     Z( k*q + i,      : ) = xb_k( i, : ), i < kl,
+///     Z( k*q + kl + i, : ) = xt_{k+1}( i, : ), i < ku.
+///
+/// @param[in] Y
+///     Solution tips; for partition k, the q-by-nrhs tips of y_k at
+///     Y + k*q*nrhs, from spike_tips.
+///
+/// @param[out] Z
+///     The (p-1)q-by-nrhs boundary unknowns, with leading dimension (p-1)q.
+///
+template <typename scalar_t>
+void spike_reduced_solve(
+    int64_t kl, int64_t ku, int64_t nrhs, int64_t p,
+    std::vector< scalar_t > const& AB, std::vector< int64_t > const& ipiv,
+    scalar_t const* Y,
+    scalar_t* Z )
+{
+    int64_t q = kl + ku;
+    int64_t r = (p - 1)*q;
+    int64_t klr = q + kl - 1;
+    int64_t kur = q + ku - 1;
+    int64_t ldab = 2*klr + kur + 1;
+    for (int64_t k = 0; k < p - 1; ++k) {
+        scalar_t const* Y0 = &Y[ k*q*nrhs ];
+        scalar_t const* Y1 = &Y[ (k + 1)*q*nrhs ];
+        int64_t rb = k*q;
+        for (int64_t c = 0; c < nrhs; ++c) {
+            for (int64_t i = 0; i < kl; ++i)
+                Z[ rb + i + c*r ] = Y0[ ku + i + c*q ];
+            for (int64_t i = 0; i < ku; ++i)
+                Z[ rb + kl + i + c*r ] = Y1[ i + c*q ];
+        }
+    }
+    lapack::gbtrs( Op::NoTrans, r, klr, kur, nrhs, AB.data(), ldab,
+                   ipiv.data(), Z, r );
+}
+
+//------------------------------------------------------------------------------
+/// Updates partition k of the solution,
+///     x_k = y_k - V_k xt_{k+1} - W_k xb_{k-1},
+/// given the full spikes, with [ V_k, W_k ] the m_k-by-(kl + ku) matrix
+/// at S + (kl + ku)*s_k, and the boundary unknowns Z from
+/// spike_reduced_solve.
+///
+template <typename scalar_t>
+void spike_update(
+    int64_t n, int64_t kl, int64_t ku, int64_t nrhs, int64_t p, int64_t k,
+    scalar_t const* S, scalar_t const* Z,
+    scalar_t* B, int64_t ldb )
+{
+    int64_t q = kl + ku;
+    int64_t r = (p - 1)*q;
+    int64_t s = spike_begin( n, p, k );
+    int64_t m = spike_begin( n, p, k+1 ) - s;
+    scalar_t const* V = &S[ q*s ];
+    scalar_t const* W = &S[ q*s + m*ku ];
+    for (int64_t c = 0; c < nrhs; ++c) {
+        scalar_t* x = &B[ s + c*ldb ];
+        if (k < p - 1) {
+            for (int64_t j = 0; j < ku; ++j) {
+                scalar_t xt = Z[ k*q + kl + j + c*r ];
+                for (int64_t i = 0; i < m; ++i)
+                    x[ i ] -= V[ i + j*m ] * xt;
+            }
+        }
+        if (k > 0) {
+            for (int64_t j = 0; j < kl; ++j) {
+                scalar_t xb = Z[ (k - 1)*q + j + c*r ];
+                for (int64_t i = 0; i < m; ++i)
+                    x[ i ] -= W[ i + j*m ] * xb;
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Sets the m_k-by-nrhs correction for partition k,
+///     D = [ C_k xb_{k-1}; 0; B_k xt_{k+1} ],
+/// so that x_k = y_k - A_k^{-1} D, for solvers that keep only the
+/// spike tips.
+///
+/// @param[in] Bk
+///     The ku-by-ku coupling block B_k, if k < p-1.
+///
+/// @param[in] Ck
+///     The kl-by-kl coupling block C_k, if k > 0.
+///
+template <typename scalar_t>
+void spike_correction(
+    int64_t m, int64_t kl, int64_t ku, int64_t nrhs, int64_t p, int64_t k,
+    scalar_t const* Bk, scalar_t const* Ck, scalar_t const* Z,
+    scalar_t* D, int64_t ldd )
+{
+    int64_t q = kl + ku;
+    int64_t r = (p - 1)*q;
+    for (int64_t c = 0; c < nrhs; ++c) {
+        scalar_t* d = &D[ c*ldd ];
+        std::fill( d, d + m, scalar_t( 0 ) );
+        if (k > 0) {
+            for (int64_t j = 0; j < kl; ++j) {
+                scalar_t xb = Z[ (k - 1)*q + j + c*r ];
+                for (int64_t i = 0; i < kl; ++i)
+                    d[ i ] += Ck[ i + j*kl ] * xb;
+            }
+        }
+        if (k < p - 1) {
+            for (int64_t j = 0; j < ku; ++j) {
+                scalar_t xt = Z[ k*q + kl + j + c*r ];
+                for (int64_t i = 0; i < ku; ++i)
+                    d[ m - ku + i ] += Bk[ i + j*ku ] * xt;
+            }
+        }
+    }
+}
+
+}  // namespace internal
+}  // namespace lapack
+
+#endif // LAPACK_SPIKE_INTERNAL_HH
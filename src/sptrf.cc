@@ -22,6 +22,7 @@ int64_t sptrf(
     float* AP,
     int64_t* ipiv )
 {
+    internal::StatsScope stats_scope( "ssptrf" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     #ifndef LAPACK_ILP64
@@ -53,6 +54,7 @@ int64_t sptrf(
     double* AP,
     int64_t* ipiv )
 {
+    internal::StatsScope stats_scope( "dsptrf" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     #ifndef LAPACK_ILP64
@@ -84,6 +86,7 @@ int64_t sptrf(
     std::complex<float>* AP,
     int64_t* ipiv )
 {
+    internal::StatsScope stats_scope( "csptrf" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     #ifndef LAPACK_ILP64
@@ -115,6 +118,7 @@ int64_t sptrf(
     std::complex<double>* AP,
     int64_t* ipiv )
 {
+    internal::StatsScope stats_scope( "zsptrf" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     #ifndef LAPACK_ILP64
@@ -140,4 +144,96 @@ int64_t sptrf(
     return info_;
 }
 
+#ifndef LAPACK_ILP64
+
+// -----------------------------------------------------------------------------
+int64_t sptrf(
+    lapack::Uplo uplo, int64_t n,
+    float* AP,
+    lapack_int* ipiv )
+{
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int* ipiv_ptr = ipiv;
+    lapack_int info_ = 0;
+
+    LAPACK_ssptrf(
+        &uplo_, &n_,
+        AP,
+        ipiv_ptr, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t sptrf(
+    lapack::Uplo uplo, int64_t n,
+    double* AP,
+    lapack_int* ipiv )
+{
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int* ipiv_ptr = ipiv;
+    lapack_int info_ = 0;
+
+    LAPACK_dsptrf(
+        &uplo_, &n_,
+        AP,
+        ipiv_ptr, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t sptrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* AP,
+    lapack_int* ipiv )
+{
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int* ipiv_ptr = ipiv;
+    lapack_int info_ = 0;
+
+    LAPACK_csptrf(
+        &uplo_, &n_,
+        (lapack_complex_float*) AP,
+        ipiv_ptr, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t sptrf(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* AP,
+    lapack_int* ipiv )
+{
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int* ipiv_ptr = ipiv;
+    lapack_int info_ = 0;
+
+    LAPACK_zsptrf(
+        &uplo_, &n_,
+        (lapack_complex_double*) AP,
+        ipiv_ptr, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+#endif  // LAPACK_ILP64
+
 }  // namespace lapack
@@ -0,0 +1,163 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/workspace.hh"
+#include "lapack_internal.hh"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+
+namespace lapack {
+
+namespace internal {
+
+std::atomic< bool > stats_active { false };
+
+//------------------------------------------------------------------------------
+// Process-wide totals, keyed by routine name. Scopes update their own
+// counters without locking, and take the lock once, on exit.
+class StatsTable
+{
+public:
+    void add( const char* routine, RoutineStats const& call )
+    {
+        std::lock_guard< std::mutex > lock( mutex_ );
+        RoutineStats& total = map_[ routine ];
+        total.calls      += call.calls;
+        total.allocs     += call.allocs;
+        total.bytes      += call.bytes;
+        total.peak_bytes  = std::max( total.peak_bytes, call.peak_bytes );
+        total.queries    += call.queries;
+        total.query_time += call.query_time;
+    }
+
+    void clear()
+    {
+        std::lock_guard< std::mutex > lock( mutex_ );
+        map_.clear();
+    }
+
+    std::map< std::string, RoutineStats > copy()
+    {
+        std::lock_guard< std::mutex > lock( mutex_ );
+        return map_;
+    }
+
+private:
+    std::mutex mutex_;
+    std::map< std::string, RoutineStats > map_;
+};
+
+StatsTable s_stats_table;
+
+thread_local StatsScope* s_current_scope = nullptr;
+
+//------------------------------------------------------------------------------
+StatsScope* stats_current_scope()
+{
+    return s_current_scope;
+}
+
+//------------------------------------------------------------------------------
+void StatsScope::begin( const char* routine )
+{
+    // A wrapper calling another overload of the same routine, e.g., to
+    // query workspace, is counted as part of the outer call.
+    if (s_current_scope != nullptr
+        && std::strcmp( s_current_scope->routine_, routine ) == 0)
+        return;
+
+    routine_ = routine;
+    prev_ = s_current_scope;
+    s_current_scope = this;
+}
+
+//------------------------------------------------------------------------------
+void StatsScope::end()
+{
+    s_current_scope = prev_;
+
+    RoutineStats call;
+    call.calls      = 1;
+    call.allocs     = allocs_;
+    call.bytes      = bytes_;
+    call.peak_bytes = bytes_;
+    call.queries    = queries_;
+    call.query_time = query_time_;
+    s_stats_table.add( routine_, call );
+}
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+/// Enables or disables instrumentation counters for all threads.
+/// Disabling keeps the counts collected so far; use stats_reset to
+/// discard them. Calls in progress when counters are enabled are not
+/// counted.
+///
+void stats_enable( bool enable )
+{
+    internal::stats_active = enable;
+}
+
+//------------------------------------------------------------------------------
+/// @return true if instrumentation counters are enabled.
+///
+bool stats_enabled()
+{
+    return internal::stats_active;
+}
+
+//------------------------------------------------------------------------------
+/// Discards all instrumentation counts.
+///
+void stats_reset()
+{
+    internal::s_stats_table.clear();
+}
+
+//------------------------------------------------------------------------------
+/// @return snapshot of instrumentation counters, keyed by Fortran routine
+/// name, e.g., "dgesdd". Only routines called while counters were enabled
+/// appear.
+///
+std::map< std::string, RoutineStats > stats()
+{
+    return internal::s_stats_table.copy();
+}
+
+//------------------------------------------------------------------------------
+/// @return instrumentation counters as a JSON object, keyed by Fortran
+/// routine name, for example:
+///
+///     { "dgesdd": { "calls": 1, "allocs": 2, "bytes": 86016,
+///                   "peak_bytes": 86016, "queries": 1,
+///                   "query_time": 1.2e-06 } }
+///
+std::string stats_json()
+{
+    std::string json = "{";
+    const char* sep = "";
+    char buf[ 256 ];
+    for (auto const& entry : stats()) {
+        RoutineStats const& s = entry.second;
+        snprintf( buf, sizeof( buf ),
+                  "%s\n  \"%s\": { \"calls\": %lld, \"allocs\": %lld, "
+                  "\"bytes\": %lld, \"peak_bytes\": %lld, "
+                  "\"queries\": %lld, \"query_time\": %.3e }",
+                  sep, entry.first.c_str(),
+                  (long long) s.calls, (long long) s.allocs,
+                  (long long) s.bytes, (long long) s.peak_bytes,
+                  (long long) s.queries, s.query_time );
+        json += buf;
+        sep = ",";
+    }
+    json += (*sep == '\0' ? "}" : "\n}");
+    return json;
+}
+
+}  // namespace lapack
@@ -0,0 +1,244 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack_internal.hh"
+#include "thread_pool.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+//==============================================================================
+namespace impl {
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper.
+/// @ingroup heev_computational
+///
+template <typename real_t>
+int64_t stebz_parallel(
+    lapack::Range range, int64_t n,
+    real_t const* D, real_t const* E,
+    real_t vl, real_t vu, int64_t il, int64_t iu, real_t abstol,
+    int64_t* m,
+    real_t* W )
+{
+    lapack_error_if( range != Range::All &&
+                     range != Range::Value &&
+                     range != Range::Index );
+    lapack_error_if( n < 0 );
+    lapack_error_if( range == Range::Value && n > 0 && vl >= vu );
+    lapack_error_if( range == Range::Index &&
+                     (il < 1 || il > max( 1, n )) );
+    lapack_error_if( range == Range::Index &&
+                     (iu < min( n, il ) || iu > n) );
+
+    *m = 0;
+    if (n == 0)
+        return 0;
+
+    // Eigenvalues bisected together, one shift each per Sturm sweep.
+    const int64_t nb = 16;
+    const real_t ulp = std::numeric_limits< real_t >::epsilon();
+    const real_t safe_min = std::numeric_limits< real_t >::min();
+    const real_t fudge = 2.1;
+
+    // Gershgorin bounds, widened as in stebz so the Sturm counts at the
+    // ends are 0 and n.
+    real_t gl = D[ 0 ], gu = D[ 0 ];
+    for (int64_t i = 0; i < n; ++i) {
+        real_t r = (i > 0     ? std::abs( E[ i-1 ] ) : real_t( 0 ))
+                 + (i < n - 1 ? std::abs( E[ i ] )   : real_t( 0 ));
+        gl = min( gl, D[ i ] - r );
+        gu = max( gu, D[ i ] + r );
+    }
+    real_t tnorm = max( std::abs( gl ), std::abs( gu ) );
+    gl -= fudge*tnorm*ulp*n + 2*fudge*safe_min;
+    gu += fudge*tnorm*ulp*n + 2*fudge*safe_min;
+
+    // Convert a value range to indices. sturm counts eigenvalues < u,
+    // so counting below the next float up gives those <= vl and <= vu.
+    if (range == Range::All) {
+        il = 1;
+        iu = n;
+    }
+    else if (range == Range::Value) {
+        const real_t inf = std::numeric_limits< real_t >::infinity();
+        real_t vl_up = std::nextafter( vl, inf );
+        real_t vu_up = std::nextafter( vu, inf );
+        il = lapack::sturm( n, D, E, vl_up ) + 1;
+        iu = lapack::sturm( n, D, E, vu_up );
+        gl = max( gl, vl );
+        gu = min( gu, vu_up );
+    }
+    int64_t neig = iu - il + 1;
+    *m = max( 0, neig );
+    if (neig <= 0)
+        return 0;
+
+    real_t atol = (abstol > 0 ? abstol : ulp*tnorm);
+    real_t rtol = 2*ulp;
+
+    // Fewer eigenvalues per group when there are few, to keep the threads
+    // busy; more to use the full vector width of the multi-shift sturm.
+    int64_t nthreads = internal::ThreadPool::instance().num_threads();
+    int64_t gsize = max( 1, min( nb, (neig + nthreads - 1) / nthreads ) );
+    int64_t ngroups = (neig + gsize - 1) / gsize;
+
+    internal::parallel_for( ngroups, 1, [&]( int64_t begin, int64_t end ) {
+        real_t a[ nb ], b[ nb ], x[ nb ];
+        int64_t count[ nb ];
+        for (int64_t g = begin; g < end; ++g) {
+            int64_t j0 = g*gsize;
+            int64_t jb = min( gsize, neig - j0 );
+
+            // Invariant: sturm( a_j ) < il + j0 + j <= sturm( b_j ).
+            std::fill( a, a + jb, gl );
+            std::fill( b, b + jb, gu );
+            while (true) {
+                int64_t nact = 0;
+                for (int64_t j = 0; j < jb; ++j) {
+                    real_t tol = max( atol, rtol*max( std::abs( a[ j ] ),
+                                                      std::abs( b[ j ] ) ) );
+                    real_t mid = (a[ j ] + b[ j ]) / 2;
+                    if (b[ j ] - a[ j ] > tol && mid > a[ j ] && mid < b[ j ]) {
+                        x[ nact++ ] = mid;
+                    }
+                }
+                if (nact == 0)
+                    break;
+
+                lapack::sturm( n, D, E, nact, x, count );
+
+                // Each count narrows every interval in the group, not
+                // only the one whose midpoint it was.
+                for (int64_t t = 0; t < nact; ++t) {
+                    for (int64_t j = 0; j < jb; ++j) {
+                        if (count[ t ] >= il + j0 + j)
+                            b[ j ] = min( b[ j ], x[ t ] );
+                        else
+                            a[ j ] = max( a[ j ], x[ t ] );
+                    }
+                }
+            }
+            for (int64_t j = 0; j < jb; ++j)
+                W[ j0 + j ] = (a[ j ] + b[ j ]) / 2;
+        }
+    });
+    return 0;
+}
+
+}  // namespace impl
+
+//------------------------------------------------------------------------------
+/// @ingroup heev_computational
+int64_t stebz_parallel(
+    lapack::Range range, int64_t n,
+    float const* D, float const* E,
+    float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W )
+{
+    return impl::stebz_parallel( range, n, D, E, vl, vu, il, iu, abstol,
+                                 m, W );
+}
+
+//------------------------------------------------------------------------------
+/// Computes selected eigenvalues of a real symmetric tridiagonal matrix T
+/// by bisection, in parallel on the LAPACK++ thread pool (see
+/// lapack::set_num_threads). Eigenvalues can be selected by a range of
+/// values or a range of indices, as in lapack::stevx; T is not modified.
+///
+/// Each eigenvalue is bracketed by Sturm counts, and groups of up to 16
+/// eigenvalues are bisected together with the multi-shift lapack::sturm,
+/// which evaluates all their midpoints in one pass over T, vectorized
+/// across shifts. The count at each midpoint narrows every interval in
+/// its group. Groups are spread over threads, so selecting many
+/// eigenvalues of a large T scales with cores; the cost is about
+/// O( n m log(||T|| / abstol) ) for m eigenvalues, with no O(n^2) or
+/// eigenvector work.
+///
+/// Overloaded versions are available for
+/// `float` and `double`.
+///
+/// @param[in] range
+///     - lapack::Range::All:
+///             all eigenvalues will be found.
+///     - lapack::Range::Value:
+///             all eigenvalues in the half-open interval (vl,vu]
+///             will be found.
+///     - lapack::Range::Index:
+///             the il-th through iu-th eigenvalues will be found.
+///
+/// @param[in] n
+///     The order of the matrix. n >= 0.
+///
+/// @param[in] D
+///     The vector D of length n.
+///     The n diagonal elements of the tridiagonal matrix T.
+///
+/// @param[in] E
+///     The vector E of length n-1.
+///     The (n-1) subdiagonal elements of the tridiagonal matrix T.
+///
+/// @param[in] vl
+///     If range=Value, the lower bound of the interval to
+///     be searched for eigenvalues. vl < vu.
+///     Not referenced if range = All or Index.
+///
+/// @param[in] vu
+///     If range=Value, the upper bound of the interval to
+///     be searched for eigenvalues. vl < vu.
+///     Not referenced if range = All or Index.
+///
+/// @param[in] il
+///     If range=Index, the index of the
+///     smallest eigenvalue to be returned.
+///     1 <= il <= iu <= n, if n > 0; il = 1 and iu = 0 if n = 0.
+///     Not referenced if range = All or Value.
+///
+/// @param[in] iu
+///     If range=Index, the index of the
+///     largest eigenvalue to be returned.
+///     1 <= il <= iu <= n, if n > 0; il = 1 and iu = 0 if n = 0.
+///     Not referenced if range = All or Value.
+///
+/// @param[in] abstol
+///     The absolute error tolerance for the eigenvalues.
+///     An eigenvalue is accepted when it is bracketed by an interval
+///     of width at most max( abstol, 2 eps max( |a|, |b| ) ), for the
+///     interval [a,b]. If abstol <= 0, eps ||T|| is used in its place.
+///
+/// @param[out] m
+///     The total number of eigenvalues found. 0 <= m <= n.
+///     If range = All, m = n, and if range = Index, m = iu-il+1.
+///
+/// @param[out] W
+///     The vector W of length n.
+///     The first m elements contain the selected eigenvalues in
+///     ascending order.
+///
+/// @return = 0: successful exit
+///
+/// @ingroup heev_computational
+int64_t stebz_parallel(
+    lapack::Range range, int64_t n,
+    double const* D, double const* E,
+    double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W )
+{
+    return impl::stebz_parallel( range, n, D, E, vl, vu, il, iu, abstol,
+                                 m, W );
+}
+
+}  // namespace lapack
@@ -27,18 +27,19 @@ int64_t stein(
     float* Z, int64_t ldz,
     int64_t* ifail )
 {
+    internal::StatsScope stats_scope( "sstein" );
     lapack_int n_ = to_lapack_int( n );
     lapack_int m_ = to_lapack_int( m );
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > iblock_( &iblock[0], &iblock[(n)] );
+        lapack::vector< lapack_int > iblock_( &iblock[0], &iblock[(n)] );
         lapack_int const* iblock_ptr = &iblock_[0];
     #else
         lapack_int const* iblock_ptr = iblock;
     #endif
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > isplit_( &isplit[0], &isplit[(n)] );
+        lapack::vector< lapack_int > isplit_( &isplit[0], &isplit[(n)] );
         lapack_int const* isplit_ptr = &isplit_[0];
     #else
         lapack_int const* isplit_ptr = isplit;
@@ -88,18 +89,19 @@ int64_t stein(
     double* Z, int64_t ldz,
     int64_t* ifail )
 {
+    internal::StatsScope stats_scope( "dstein" );
     lapack_int n_ = to_lapack_int( n );
     lapack_int m_ = to_lapack_int( m );
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > iblock_( &iblock[0], &iblock[(n)] );
+        lapack::vector< lapack_int > iblock_( &iblock[0], &iblock[(n)] );
         lapack_int const* iblock_ptr = &iblock_[0];
     #else
         lapack_int const* iblock_ptr = iblock;
     #endif
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > isplit_( &isplit[0], &isplit[(n)] );
+        lapack::vector< lapack_int > isplit_( &isplit[0], &isplit[(n)] );
         lapack_int const* isplit_ptr = &isplit_[0];
     #else
         lapack_int const* isplit_ptr = isplit;
@@ -149,18 +151,19 @@ int64_t stein(
     std::complex<float>* Z, int64_t ldz,
     int64_t* ifail )
 {
+    internal::StatsScope stats_scope( "cstein" );
     lapack_int n_ = to_lapack_int( n );
     lapack_int m_ = to_lapack_int( m );
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > iblock_( &iblock[0], &iblock[(n)] );
+        lapack::vector< lapack_int > iblock_( &iblock[0], &iblock[(n)] );
         lapack_int const* iblock_ptr = &iblock_[0];
     #else
         lapack_int const* iblock_ptr = iblock;
     #endif
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > isplit_( &isplit[0], &isplit[(n)] );
+        lapack::vector< lapack_int > isplit_( &isplit[0], &isplit[(n)] );
         lapack_int const* isplit_ptr = &isplit_[0];
     #else
         lapack_int const* isplit_ptr = isplit;
@@ -210,18 +213,19 @@ int64_t stein(
     std::complex<double>* Z, int64_t ldz,
     int64_t* ifail )
 {
+    internal::StatsScope stats_scope( "zstein" );
     lapack_int n_ = to_lapack_int( n );
     lapack_int m_ = to_lapack_int( m );
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > iblock_( &iblock[0], &iblock[(n)] );
+        lapack::vector< lapack_int > iblock_( &iblock[0], &iblock[(n)] );
         lapack_int const* iblock_ptr = &iblock_[0];
     #else
         lapack_int const* iblock_ptr = iblock;
     #endif
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > isplit_( &isplit[0], &isplit[(n)] );
+        lapack::vector< lapack_int > isplit_( &isplit[0], &isplit[(n)] );
         lapack_int const* isplit_ptr = &isplit_[0];
     #else
         lapack_int const* isplit_ptr = isplit;
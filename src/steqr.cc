@@ -23,6 +23,7 @@ int64_t steqr(
     float* E,
     float* Z, int64_t ldz )
 {
+    internal::StatsScope stats_scope( "ssteqr" );
     char compz_ = to_char_comp( compz );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldz_ = to_lapack_int( ldz );
@@ -51,6 +52,7 @@ int64_t steqr(
     double* E,
     double* Z, int64_t ldz )
 {
+    internal::StatsScope stats_scope( "dsteqr" );
     char compz_ = to_char_comp( compz );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldz_ = to_lapack_int( ldz );
@@ -79,6 +81,7 @@ int64_t steqr(
     float* E,
     std::complex<float>* Z, int64_t ldz )
 {
+    internal::StatsScope stats_scope( "csteqr" );
     char compz_ = to_char_comp( compz );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldz_ = to_lapack_int( ldz );
@@ -107,6 +110,7 @@ int64_t steqr(
     double* E,
     std::complex<double>* Z, int64_t ldz )
 {
+    internal::StatsScope stats_scope( "zsteqr" );
     char compz_ = to_char_comp( compz );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldz_ = to_lapack_int( ldz );
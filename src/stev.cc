@@ -23,6 +23,7 @@ int64_t stev(
     float* E,
     float* Z, int64_t ldz )
 {
+    internal::StatsScope stats_scope( "sstev" );
     char jobz_ = to_char( jobz );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldz_ = to_lapack_int( ldz );
@@ -51,6 +52,7 @@ int64_t stev(
     double* E,
     double* Z, int64_t ldz )
 {
+    internal::StatsScope stats_scope( "dstev" );
     char jobz_ = to_char( jobz );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldz_ = to_lapack_int( ldz );
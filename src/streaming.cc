@@ -0,0 +1,289 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/streaming.hh"
+#include "lapack_internal.hh"
+
+#if LAPACK_VERSION >= 30400  // >= 3.4.0
+
+#include <cmath>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+using blas::conj;
+
+//------------------------------------------------------------------------------
+/// Creates an empty least squares problem with n unknowns and nrhs
+/// right-hand sides.
+///
+/// @param[in] n
+///     The number of columns of A. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of columns of B. nrhs >= 0.
+///
+/// @param[in] lambda
+///     The forgetting factor, 0 < lambda <= 1. With lambda = 1, the
+///     default, all rows have equal weight.
+///
+template <typename scalar_t>
+StreamingQR< scalar_t >::StreamingQR(
+    int64_t n, int64_t nrhs, real_t lambda )
+    : n_( n ),
+      nrhs_( nrhs ),
+      rows_( 0 ),
+      lambda_( lambda )
+{
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( ! (lambda > 0 && lambda <= 1) );
+
+    R_.resize( max( 1, n*n ) );
+    D_.resize( max( 1, n*nrhs ) );
+    rnorm_.resize( nrhs );
+    reset();
+}
+
+//------------------------------------------------------------------------------
+/// Discards all rows, returning to the state after construction.
+///
+template <typename scalar_t>
+void StreamingQR< scalar_t >::reset()
+{
+    std::fill( R_.begin(), R_.end(), scalar_t( 0 ) );
+    std::fill( D_.begin(), D_.end(), scalar_t( 0 ) );
+    std::fill( rnorm_.begin(), rnorm_.end(), real_t( 0 ) );
+    rows_ = 0;
+}
+
+//------------------------------------------------------------------------------
+/// Sets the forgetting factor, 0 < lambda <= 1, for rows added from now
+/// on; rows already added keep their current weights.
+///
+template <typename scalar_t>
+void StreamingQR< scalar_t >::lambda( real_t lambda )
+{
+    lapack_error_if( ! (lambda > 0 && lambda <= 1) );
+    lambda_ = lambda;
+}
+
+//------------------------------------------------------------------------------
+/// Adds the rows of A and B to the least squares problem:
+/// \[
+///     \begin{bmatrix} R & D \\ A & B \end{bmatrix}
+///     \to
+///     \begin{bmatrix} R' & D' \\ 0 & B' \end{bmatrix}
+/// \]
+/// by tpqrt and tpmqrt, and the residual norms grow by the column norms
+/// of B'. Rows within the block are weighted as if added one at a time,
+/// so the result does not depend on how rows are split into blocks.
+///
+/// @param[in] mb
+///     The number of rows to add. mb >= 0.
+///
+/// @param[in] A
+///     The mb-by-n matrix A, stored in an lda-by-n array.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,mb).
+///
+/// @param[in] B
+///     The mb-by-nrhs matrix B, stored in an ldb-by-nrhs array.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B. ldb >= max(1,mb).
+///
+template <typename scalar_t>
+void StreamingQR< scalar_t >::add_rows(
+    int64_t mb,
+    scalar_t const* A, int64_t lda,
+    scalar_t const* B, int64_t ldb )
+{
+    lapack_error_if( mb < 0 );
+    lapack_error_if( lda < max( 1, mb ) );
+    lapack_error_if( ldb < max( 1, mb ) );
+
+    if (mb == 0)
+        return;
+
+    // tpqrt overwrites the block, so work on copies.
+    std::vector< scalar_t > W( mb*n_ ), V( mb*nrhs_ );
+    lapack::lacpy( MatrixType::General, mb, n_, A, lda, W.data(), mb );
+    lapack::lacpy( MatrixType::General, mb, nrhs_, B, ldb, V.data(), mb );
+
+    if (lambda_ < 1) {
+        // Row i of the block ages mb-1-i more rows; earlier rows age mb.
+        real_t sqrt_lambda = std::sqrt( lambda_ );
+        real_t scale = 1;
+        for (int64_t i = mb-1; i >= 0; --i) {
+            if (scale != 1) {
+                blas::scal( n_, scale, &W[ i ], mb );
+                blas::scal( nrhs_, scale, &V[ i ], mb );
+            }
+            scale *= sqrt_lambda;
+        }
+        for (int64_t j = 0; j < n_; ++j)
+            blas::scal( j+1, scale, &R_[ j*n_ ], 1 );
+        for (int64_t j = 0; j < nrhs_; ++j) {
+            blas::scal( n_, scale, &D_[ j*n_ ], 1 );
+            rnorm_[ j ] *= scale;
+        }
+    }
+
+    if (n_ > 0) {
+        int64_t nb = min( n_, 32 );
+        std::vector< scalar_t > T( nb*n_ );
+        lapack::tpqrt( mb, n_, 0, nb, R_.data(), n_, W.data(), mb,
+                       T.data(), nb );
+        if (nrhs_ > 0) {
+            lapack::tpmqrt( Side::Left, Op::ConjTrans, mb, nrhs_, n_, 0, nb,
+                            W.data(), mb, T.data(), nb,
+                            D_.data(), n_, V.data(), mb );
+        }
+    }
+    for (int64_t j = 0; j < nrhs_; ++j)
+        rnorm_[ j ] = std::hypot( rnorm_[ j ], blas::nrm2( mb, &V[ j*mb ], 1 ) );
+
+    rows_ += mb;
+}
+
+//------------------------------------------------------------------------------
+/// Removes rows of A and B previously added, downdating R, D, and the
+/// residual norms one row at a time by Givens rotations, as LINPACK's
+/// chdd does, at O( n (n + nrhs) ) cost per row. Rows are removed at
+/// weight 1; with lambda < 1, scale each row by its current weight,
+/// lambda^(age/2), before removing it.
+///
+/// Downdating is less stable than updating: its error grows with the
+/// condition number of the remaining rows.
+///
+/// @param[in] mb
+///     The number of rows to remove. mb >= 0.
+///
+/// @param[in] A
+///     The mb-by-n matrix A, stored in an lda-by-n array.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,mb).
+///
+/// @param[in] B
+///     The mb-by-nrhs matrix B, stored in an ldb-by-nrhs array.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B. ldb >= max(1,mb).
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, removing row i would leave
+///     A^H A indefinite, i.e., the row was not in the problem;
+///     rows 1, ..., i-1 were removed, and rows i, ..., mb were not.
+///
+template <typename scalar_t>
+int64_t StreamingQR< scalar_t >::remove_rows(
+    int64_t mb,
+    scalar_t const* A, int64_t lda,
+    scalar_t const* B, int64_t ldb )
+{
+    lapack_error_if( mb < 0 );
+    lapack_error_if( lda < max( 1, mb ) );
+    lapack_error_if( ldb < max( 1, mb ) );
+
+    int64_t n = n_;
+    scalar_t* R = R_.data();
+    std::vector< scalar_t > s( n );
+    std::vector< real_t > c( n );
+
+    for (int64_t row = 0; row < mb; ++row) {
+        // Solve R^H s = a^H, for row a of A.
+        for (int64_t j = 0; j < n; ++j)
+            s[ j ] = conj( A[ row + j*lda ] );
+        blas::trsv( blas::Layout::ColMajor, Uplo::Upper, Op::ConjTrans,
+                    Diag::NonUnit, n, R, n, s.data(), 1 );
+        real_t norm = blas::nrm2( n, s.data(), 1 );
+        if (! (norm < 1))
+            return row + 1;
+        real_t alpha = std::sqrt( (1 - norm) * (1 + norm) );
+
+        // Rotations that zero s against alpha, from the bottom up.
+        for (int64_t i = n-1; i >= 0; --i) {
+            real_t scale = alpha + std::abs( s[ i ] );
+            real_t a = alpha / scale;
+            scalar_t b = s[ i ] / scale;
+            real_t r = std::sqrt( a*a + std::norm( b ) );
+            c[ i ] = a / r;
+            s[ i ] = conj( b ) / r;
+            alpha = scale * r;
+        }
+
+        // Apply them to R.
+        for (int64_t j = 0; j < n; ++j) {
+            scalar_t xx = 0;
+            for (int64_t i = j; i >= 0; --i) {
+                scalar_t t = c[ i ]*xx + s[ i ]*R[ i + j*n ];
+                R[ i + j*n ] = c[ i ]*R[ i + j*n ] - conj( s[ i ] )*xx;
+                xx = t;
+            }
+        }
+
+        // Downdate D and the residual norms.
+        for (int64_t j = 0; j < nrhs_; ++j) {
+            scalar_t* D = &D_[ j*n ];
+            scalar_t zeta = B[ row + j*ldb ];
+            for (int64_t i = 0; i < n; ++i) {
+                D[ i ] = (D[ i ] - conj( s[ i ] )*zeta) / c[ i ];
+                zeta = c[ i ]*zeta - s[ i ]*D[ i ];
+            }
+            real_t azeta = std::abs( zeta );
+            if (azeta < rnorm_[ j ]) {
+                real_t ratio = azeta / rnorm_[ j ];
+                rnorm_[ j ] *= std::sqrt( (1 - ratio) * (1 + ratio) );
+            }
+            else {
+                rnorm_[ j ] = 0;  // lost to rounding
+            }
+        }
+        rows_ -= 1;
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+/// Solves the current least squares problem, X = R^{-1} D,
+/// at O( n^2 nrhs ) cost.
+///
+/// @param[out] X
+///     The n-by-nrhs solution X, stored in an ldx-by-nrhs array.
+///
+/// @param[in] ldx
+///     The leading dimension of the array X. ldx >= max(1,n).
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, R(i,i) is exactly zero, so A does
+///     not have full rank, e.g., fewer than n rows were added;
+///     X is not computed.
+///
+template <typename scalar_t>
+int64_t StreamingQR< scalar_t >::solve(
+    scalar_t* X, int64_t ldx ) const
+{
+    lapack_error_if( ldx < max( 1, n_ ) );
+
+    lapack::lacpy( MatrixType::General, n_, nrhs_, D_.data(), n_, X, ldx );
+    return lapack::trtrs( Uplo::Upper, Op::NoTrans, Diag::NonUnit,
+                          n_, nrhs_, R_.data(), n_, X, ldx );
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template class StreamingQR< float >;
+template class StreamingQR< double >;
+template class StreamingQR< std::complex<float> >;
+template class StreamingQR< std::complex<double> >;
+
+}  // namespace lapack
+
+#endif  // LAPACK >= 3.4.0
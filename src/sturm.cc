@@ -6,14 +6,31 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <vector>
 
 namespace lapack {
+
+//------------------------------------------------------------------------------
+/// @return the scaling threshold phi for the scaled Sturm sequence;
+/// upsilon = 1/phi. phi is a power of 2, so scaling is exact, and uses 1/4
+/// of the exponent range, leaving the rest as headroom for the one-step
+/// lag in scaling. This is 2^32 in single, close to the former fixed
+/// 2^34, and 2^256 in double, which rescales far less often.
+template <typename scalar_t>
+static scalar_t sturm_phi()
+{
+    return std::ldexp( scalar_t( 1 ),
+                       std::numeric_limits< scalar_t >::max_exponent / 4 );
+}
+
 //------------------------------------------------------------------------------
 /// @ingroup heev_computational
 /// sturm computes a Scaled Sturm Sequence using a real symmetric tri-diagonal
 /// matrix. NOTE this calls no LAPACK routine; the code is here. Only single
-/// and double precision code exist.
+/// and double precision code exist. See also the multi-shift variant below.
 ///
 /// Parameters: All parameters are read-only by this routine.
 ///  @param[in]  diag: a vector of 'n' diagonal elements.
@@ -72,7 +89,7 @@ namespace lapack {
 // sign changes.
 //
 // s is computed given the vector X[] = M[i]*P[i-1] above.
-// PHI is set to 10^{10}, UPSILON is set to 10^{-10}. Then:
+// PHI is set by sturm_phi, UPSILON = 1/PHI. Then:
 //    w = max(fabs(X[0]), fabs(X[1])).
 //    if w > PHI then s = PHI/w;
 //    else if w < UPSILON then s = UPSILON/w;
@@ -105,8 +122,7 @@ int64_t sturm(
     if (n == 0)
         return 0;
 
-    // todo: adjust for float. Use constants like epsilon.
-    phi = scalar_t( int64_t( 1 ) << 34 );  // Roughly 1.718e+10.
+    phi = sturm_phi< scalar_t >();
     const scalar_t one=1.0;
     upsilon = one/phi;
 
@@ -150,6 +166,71 @@ int64_t sturm(
     return isneg;
 }
 
+//------------------------------------------------------------------------------
+/// @ingroup heev_computational
+/// Multi-shift variant of sturm: counts, for each of nshift shifts u[j],
+/// the eigenvalues of the real symmetric tri-diagonal matrix strictly less
+/// than u[j]. Shifts are processed in blocks of 16, so each pass over diag
+/// and offd serves the whole block, and the recurrence, with its
+/// scaling done by selects rather than branches, vectorizes across
+/// the shifts. Each count equals that of the single-shift sturm.
+///
+/// Parameters:
+///  @param[in]       n: The order of the matrix.
+///  @param[in]    diag: a vector of 'n' diagonal elements.
+///  @param[in]    offd: a vector of 'n-1' off-diagonal elements.
+///  @param[in]  nshift: The number of shifts.
+///  @param[in]       u: a vector of 'nshift' sigma test points.
+///  @param[out]  count: a vector of 'nshift' counts; count[j] is the number
+///                      of eigenvalues strictly less than u[j].
+///
+template <typename scalar_t>
+void sturm(
+    int64_t n, scalar_t const* diag, scalar_t const* offd,
+    int64_t nshift, scalar_t const* u, int64_t* count )
+{
+    const int64_t nb = 16;
+    const scalar_t one = 1.0;
+    const scalar_t phi = sturm_phi< scalar_t >();
+    const scalar_t upsilon = one/phi;
+
+    if (n == 0) {
+        std::fill( count, count + nshift, 0 );
+        return;
+    }
+
+    scalar_t Pm1_0[ nb ], Pm1_1[ nb ], uj[ nb ];
+    int64_t isneg[ nb ];
+    for (int64_t j0 = 0; j0 < nshift; j0 += nb) {
+        int64_t jb = std::min( nb, nshift - j0 );
+        for (int64_t j = 0; j < jb; ++j) {
+            uj[ j ] = u[ j0 + j ];
+            Pm1_1[ j ] = one;
+            Pm1_0[ j ] = diag[ 0 ] - uj[ j ];
+            isneg[ j ] = (Pm1_0[ j ] < 0);
+        }
+        for (int64_t i = 1; i < n; ++i) {
+            scalar_t d = diag[ i ];
+            scalar_t e = offd[ i-1 ];
+            for (int64_t j = 0; j < jb; ++j) {
+                // Same steps as the single-shift loop above.
+                scalar_t w = std::max( std::abs( Pm1_0[ j ] ),
+                                       std::abs( Pm1_1[ j ] ) );
+                scalar_t s = Pm1_0[ j ];
+                Pm1_0[ j ] = (d - uj[ j ])*Pm1_0[ j ] - ((e*e)*Pm1_1[ j ]);
+                Pm1_1[ j ] = s;
+
+                s = (w > phi ? phi/w : (w < upsilon ? upsilon/w : one));
+                Pm1_0[ j ] *= s;
+                Pm1_1[ j ] *= s;
+
+                isneg[ j ] += ((Pm1_0[ j ] < 0) != (Pm1_1[ j ] < 0));
+            }
+        }
+        std::copy( isneg, isneg + jb, &count[ j0 ] );
+    }
+}
+
 //------------------------------------------------------------------------------
 // Explicit instantiations.
 template
@@ -160,4 +241,14 @@ template
 int64_t sturm<double>(
     int64_t n, double const* diag, double const* offd, double u );
 
+template
+void sturm<float>(
+    int64_t n, float const* diag, float const* offd,
+    int64_t nshift, float const* u, int64_t* count );
+
+template
+void sturm<double>(
+    int64_t n, double const* diag, double const* offd,
+    int64_t nshift, double const* u, int64_t* count );
+
 } // namespace lapack
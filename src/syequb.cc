@@ -25,6 +25,7 @@ int64_t syequb(
     float* scond,
     float* amax )
 {
+    internal::StatsScope stats_scope( "ssyequb" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -54,6 +55,7 @@ int64_t syequb(
     double* scond,
     double* amax )
 {
+    internal::StatsScope stats_scope( "dsyequb" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -83,6 +85,7 @@ int64_t syequb(
     float* scond,
     float* amax )
 {
+    internal::StatsScope stats_scope( "csyequb" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
@@ -157,6 +160,7 @@ int64_t syequb(
     double* scond,
     double* amax )
 {
+    internal::StatsScope stats_scope( "zsyequb" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int lda_ = to_lapack_int( lda );
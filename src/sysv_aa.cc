@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack_internal.hh"
 #include "lapack/fortran.h"
+#include "work_size_cache.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7
@@ -20,36 +21,36 @@ using blas::real;
 
 // -----------------------------------------------------------------------------
 /// @ingroup sysv
-int64_t sysv_aa(
+void sysv_aa_work_size(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
     float* A, int64_t lda,
-    int64_t* ipiv,
-    float* B, int64_t ldb )
+    float* B, int64_t ldb,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "ssysv_aa" );
+    internal::WorkSizeKey key( "ssysv_aa", { to_char( uplo ), n, nrhs, lda, ldb } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int nrhs_ = to_lapack_int( nrhs );
     lapack_int lda_ = to_lapack_int( lda );
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( (n) );
-        lapack_int* ipiv_ptr = &ipiv_[0];
-    #else
-        lapack_int* ipiv_ptr = ipiv;
-    #endif
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
 
     // query for workspace size
+    lapack_int qry_ipiv[1];
     float qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     // MKL (seen in 2019-2021) has bug in sysv_aa query;
     // query sytrf_aa and sytrs_aa instead.
     #ifdef BLAS_HAVE_MKL
         LAPACK_ssytrf_aa(
             &uplo_, &n_,
             A, &lda_,
-            ipiv_ptr,
+            qry_ipiv,
             qry_work, &ineg_one, &info_
         );
         if (info_ < 0) {
@@ -59,10 +60,11 @@ int64_t sysv_aa(
         LAPACK_ssytrs_aa(
             &uplo_, &n_, &nrhs_,
             A, &lda_,
-            ipiv_ptr,
+            qry_ipiv,
             B, &ldb_,
             qry_work, &ineg_one, &info_
         );
+        query_timer.stop();
         if (info_ < 0) {
             throw Error();
         }
@@ -71,32 +73,47 @@ int64_t sysv_aa(
         LAPACK_ssysv_aa(
             &uplo_, &n_, &nrhs_,
             A, &lda_,
-            ipiv_ptr,
+            qry_ipiv,
             B, &ldb_,
             qry_work, &ineg_one, &info_
         );
+        query_timer.stop();
         if (info_ < 0) {
             throw Error();
         }
         lapack_int lwork_ = real(qry_work[0]);
     #endif
+    *lwork = lwork_;
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup sysv
+int64_t sysv_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    lapack_int* ipiv,
+    float* B, int64_t ldb,
+    float* work, int64_t lwork )
+{
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_ssysv_aa(
         &uplo_, &n_, &nrhs_,
         A, &lda_,
-        ipiv_ptr,
+        ipiv,
         B, &ldb_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
-    #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
-    #endif
     return info_;
 }
 
@@ -104,14 +121,11 @@ int64_t sysv_aa(
 /// @ingroup sysv
 int64_t sysv_aa(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double* A, int64_t lda,
+    float* A, int64_t lda,
     int64_t* ipiv,
-    double* B, int64_t ldb )
+    float* B, int64_t ldb )
 {
-    char uplo_ = to_char( uplo );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int nrhs_ = to_lapack_int( nrhs );
-    lapack_int lda_ = to_lapack_int( lda );
+    internal::StatsScope stats_scope( "ssysv_aa" );
     #ifndef LAPACK_ILP64
         // 32-bit copy
         lapack::vector< lapack_int > ipiv_( (n) );
@@ -119,19 +133,56 @@ int64_t sysv_aa(
     #else
         lapack_int* ipiv_ptr = ipiv;
     #endif
+
+    int64_t lwork;
+    sysv_aa_work_size(
+        uplo, n, nrhs, A, lda, B, ldb,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    int64_t info = sysv_aa(
+        uplo, n, nrhs, A, lda, ipiv_ptr, B, ldb,
+        &work[0], lwork );
+    #ifndef LAPACK_ILP64
+        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+    #endif
+    return info;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv
+void sysv_aa_work_size(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    int64_t* lwork )
+{
+    internal::StatsScope stats_scope( "dsysv_aa" );
+    internal::WorkSizeKey key( "dsysv_aa", { to_char( uplo ), n, nrhs, lda, ldb } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
 
     // query for workspace size
+    lapack_int qry_ipiv[1];
     double qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     // MKL (seen in 2019-2021) has bug in sysv_aa query;
     // query sytrf_aa and sytrs_aa instead.
     #ifdef BLAS_HAVE_MKL
         LAPACK_dsytrf_aa(
             &uplo_, &n_,
             A, &lda_,
-            ipiv_ptr,
+            qry_ipiv,
             qry_work, &ineg_one, &info_
         );
         if (info_ < 0) {
@@ -141,10 +192,11 @@ int64_t sysv_aa(
         LAPACK_dsytrs_aa(
             &uplo_, &n_, &nrhs_,
             A, &lda_,
-            ipiv_ptr,
+            qry_ipiv,
             B, &ldb_,
             qry_work, &ineg_one, &info_
         );
+        query_timer.stop();
         if (info_ < 0) {
             throw Error();
         }
@@ -153,33 +205,47 @@ int64_t sysv_aa(
         LAPACK_dsysv_aa(
             &uplo_, &n_, &nrhs_,
             A, &lda_,
-            ipiv_ptr,
+            qry_ipiv,
             B, &ldb_,
             qry_work, &ineg_one, &info_
         );
+        query_timer.stop();
         if (info_ < 0) {
             throw Error();
         }
         lapack_int lwork_ = real(qry_work[0]);
     #endif
+    *lwork = lwork_;
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup sysv
+int64_t sysv_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    lapack_int* ipiv,
+    double* B, int64_t ldb,
+    double* work, int64_t lwork )
+{
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_dsysv_aa(
         &uplo_, &n_, &nrhs_,
         A, &lda_,
-        ipiv_ptr,
+        ipiv,
         B, &ldb_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
-    #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
-    #endif
     return info_;
 }
 
@@ -187,14 +253,11 @@ int64_t sysv_aa(
 /// @ingroup sysv
 int64_t sysv_aa(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float>* A, int64_t lda,
+    double* A, int64_t lda,
     int64_t* ipiv,
-    std::complex<float>* B, int64_t ldb )
+    double* B, int64_t ldb )
 {
-    char uplo_ = to_char( uplo );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int nrhs_ = to_lapack_int( nrhs );
-    lapack_int lda_ = to_lapack_int( lda );
+    internal::StatsScope stats_scope( "dsysv_aa" );
     #ifndef LAPACK_ILP64
         // 32-bit copy
         lapack::vector< lapack_int > ipiv_( (n) );
@@ -202,19 +265,56 @@ int64_t sysv_aa(
     #else
         lapack_int* ipiv_ptr = ipiv;
     #endif
+
+    int64_t lwork;
+    sysv_aa_work_size(
+        uplo, n, nrhs, A, lda, B, ldb,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    int64_t info = sysv_aa(
+        uplo, n, nrhs, A, lda, ipiv_ptr, B, ldb,
+        &work[0], lwork );
+    #ifndef LAPACK_ILP64
+        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+    #endif
+    return info;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv
+void sysv_aa_work_size(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* lwork )
+{
+    internal::StatsScope stats_scope( "csysv_aa" );
+    internal::WorkSizeKey key( "csysv_aa", { to_char( uplo ), n, nrhs, lda, ldb } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
     lapack_int ldb_ = to_lapack_int( ldb );
     lapack_int info_ = 0;
 
     // query for workspace size
+    lapack_int qry_ipiv[1];
     std::complex<float> qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     // MKL (seen in 2019-2021) has bug in sysv_aa query;
     // query sytrf_aa and sytrs_aa instead.
     #ifdef BLAS_HAVE_MKL
         LAPACK_csytrf_aa(
             &uplo_, &n_,
             (lapack_complex_float*) A, &lda_,
-            ipiv_ptr,
+            qry_ipiv,
             (lapack_complex_float*) qry_work, &ineg_one, &info_
         );
         if (info_ < 0) {
@@ -224,10 +324,11 @@ int64_t sysv_aa(
         LAPACK_csytrs_aa(
             &uplo_, &n_, &nrhs_,
             (lapack_complex_float*) A, &lda_,
-            ipiv_ptr,
+            qry_ipiv,
             (lapack_complex_float*) B, &ldb_,
             (lapack_complex_float*) qry_work, &ineg_one, &info_
         );
+        query_timer.stop();
         if (info_ < 0) {
             throw Error();
         }
@@ -236,32 +337,198 @@ int64_t sysv_aa(
         LAPACK_csysv_aa(
             &uplo_, &n_, &nrhs_,
             (lapack_complex_float*) A, &lda_,
-            ipiv_ptr,
+            qry_ipiv,
             (lapack_complex_float*) B, &ldb_,
             (lapack_complex_float*) qry_work, &ineg_one, &info_
         );
+        query_timer.stop();
         if (info_ < 0) {
             throw Error();
         }
         lapack_int lwork_ = real(qry_work[0]);
     #endif
+    *lwork = lwork_;
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup sysv
+int64_t sysv_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    lapack_int* ipiv,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* work, int64_t lwork )
+{
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_csysv_aa(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
-        ipiv_ptr,
+        ipiv,
         (lapack_complex_float*) B, &ldb_,
-        (lapack_complex_float*) &work[0], &lwork_, &info_
+        (lapack_complex_float*) work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
     }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv
+int64_t sysv_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb )
+{
+    internal::StatsScope stats_scope( "csysv_aa" );
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack::vector< lapack_int > ipiv_( (n) );
+        lapack_int* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int* ipiv_ptr = ipiv;
+    #endif
+
+    int64_t lwork;
+    sysv_aa_work_size(
+        uplo, n, nrhs, A, lda, B, ldb,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+
+    int64_t info = sysv_aa(
+        uplo, n, nrhs, A, lda, ipiv_ptr, B, ldb,
+        &work[0], lwork );
     #ifndef LAPACK_ILP64
         std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
     #endif
+    return info;
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::sysv_aa with caller-supplied workspace.
+/// Arguments are the same as for lapack::sysv_aa, without ipiv; the
+/// matrices are not modified. The sizes can be reused for any call of
+/// the same shape.
+///
+/// @param[out] lwork
+///     Required length of the work array.
+///
+/// @ingroup sysv
+void sysv_aa_work_size(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    int64_t* lwork )
+{
+    internal::StatsScope stats_scope( "zsysv_aa" );
+    internal::WorkSizeKey key( "zsysv_aa", { to_char( uplo ), n, nrhs, lda, ldb } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int info_ = 0;
+
+    // query for workspace size
+    lapack_int qry_ipiv[1];
+    std::complex<double> qry_work[1];
+    lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
+    // MKL (seen in 2019-2021) has bug in sysv_aa query;
+    // query sytrf_aa and sytrs_aa instead.
+    #ifdef BLAS_HAVE_MKL
+        LAPACK_zsytrf_aa(
+            &uplo_, &n_,
+            (lapack_complex_double*) A, &lda_,
+            qry_ipiv,
+            (lapack_complex_double*) qry_work, &ineg_one, &info_
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        lapack_int lwork_ = real(qry_work[0]);
+        LAPACK_zsytrs_aa(
+            &uplo_, &n_, &nrhs_,
+            (lapack_complex_double*) A, &lda_,
+            qry_ipiv,
+            (lapack_complex_double*) B, &ldb_,
+            (lapack_complex_double*) qry_work, &ineg_one, &info_
+        );
+        query_timer.stop();
+        if (info_ < 0) {
+            throw Error();
+        }
+        lwork_ = max( lwork_, real(qry_work[0]) );
+    #else
+        LAPACK_zsysv_aa(
+            &uplo_, &n_, &nrhs_,
+            (lapack_complex_double*) A, &lda_,
+            qry_ipiv,
+            (lapack_complex_double*) B, &ldb_,
+            (lapack_complex_double*) qry_work, &ineg_one, &info_
+        );
+        query_timer.stop();
+        if (info_ < 0) {
+            throw Error();
+        }
+        lapack_int lwork_ = real(qry_work[0]);
+    #endif
+    *lwork = lwork_;
+    internal::work_size_cache_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::sysv_aa with caller-supplied workspace, which
+/// skips the internal workspace query and allocation. ipiv is in the
+/// native LAPACK integer type, lapack_int, so no pivot copy is needed
+/// either. Other arguments are the same as for lapack::sysv_aa.
+///
+/// @param[out] work
+///     Workspace of length lwork.
+///
+/// @param[in] lwork
+///     Length of work, at least as returned by lapack::sysv_aa_work_size.
+///
+/// @ingroup sysv
+int64_t sysv_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    lapack_int* ipiv,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* work, int64_t lwork )
+{
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int nrhs_ = to_lapack_int( nrhs );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
+
+    LAPACK_zsysv_aa(
+        &uplo_, &n_, &nrhs_,
+        (lapack_complex_double*) A, &lda_,
+        ipiv,
+        (lapack_complex_double*) B, &ldb_,
+        (lapack_complex_double*) work, &lwork_, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
     return info_;
 }
 
@@ -342,10 +609,7 @@ int64_t sysv_aa(
     int64_t* ipiv,
     std::complex<double>* B, int64_t ldb )
 {
-    char uplo_ = to_char( uplo );
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int nrhs_ = to_lapack_int( nrhs );
-    lapack_int lda_ = to_lapack_int( lda );
+    internal::StatsScope stats_scope( "zsysv_aa" );
     #ifndef LAPACK_ILP64
         // 32-bit copy
         lapack::vector< lapack_int > ipiv_( (n) );
@@ -353,69 +617,122 @@ int64_t sysv_aa(
     #else
         lapack_int* ipiv_ptr = ipiv;
     #endif
-    lapack_int ldb_ = to_lapack_int( ldb );
-    lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    lapack_int ineg_one = -1;
-    // MKL (seen in 2019-2021) has bug in sysv_aa query;
-    // query sytrf_aa and sytrs_aa instead.
-    #ifdef BLAS_HAVE_MKL
-        LAPACK_zsytrf_aa(
-            &uplo_, &n_,
-            (lapack_complex_double*) A, &lda_,
-            ipiv_ptr,
-            (lapack_complex_double*) qry_work, &ineg_one, &info_
-        );
-        if (info_ < 0) {
-            throw Error();
-        }
-        lapack_int lwork_ = real(qry_work[0]);
-        LAPACK_zsytrs_aa(
-            &uplo_, &n_, &nrhs_,
-            (lapack_complex_double*) A, &lda_,
-            ipiv_ptr,
-            (lapack_complex_double*) B, &ldb_,
-            (lapack_complex_double*) qry_work, &ineg_one, &info_
-        );
-        if (info_ < 0) {
-            throw Error();
-        }
-        lwork_ = max( lwork_, real(qry_work[0]) );
-    #else
-        LAPACK_zsysv_aa(
-            &uplo_, &n_, &nrhs_,
-            (lapack_complex_double*) A, &lda_,
-            ipiv_ptr,
-            (lapack_complex_double*) B, &ldb_,
-            (lapack_complex_double*) qry_work, &ineg_one, &info_
-        );
-        if (info_ < 0) {
-            throw Error();
-        }
-        lapack_int lwork_ = real(qry_work[0]);
-    #endif
+    int64_t lwork;
+    sysv_aa_work_size(
+        uplo, n, nrhs, A, lda, B, ldb,
+        &lwork );
 
     // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+    lapack::vector< std::complex<double> > work( lwork );
 
-    LAPACK_zsysv_aa(
-        &uplo_, &n_, &nrhs_,
-        (lapack_complex_double*) A, &lda_,
-        ipiv_ptr,
-        (lapack_complex_double*) B, &ldb_,
-        (lapack_complex_double*) &work[0], &lwork_, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
+    int64_t info = sysv_aa(
+        uplo, n, nrhs, A, lda, ipiv_ptr, B, ldb,
+        &work[0], lwork );
     #ifndef LAPACK_ILP64
         std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
     #endif
-    return info_;
+    return info;
 }
 
+#ifndef LAPACK_ILP64
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv
+int64_t sysv_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    lapack_int* ipiv,
+    float* B, int64_t ldb )
+{
+    internal::StatsScope stats_scope( "ssysv_aa" );
+    int64_t lwork;
+    sysv_aa_work_size(
+        uplo, n, nrhs, A, lda, B, ldb,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return sysv_aa(
+        uplo, n, nrhs, A, lda, ipiv, B, ldb,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv
+int64_t sysv_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    lapack_int* ipiv,
+    double* B, int64_t ldb )
+{
+    internal::StatsScope stats_scope( "dsysv_aa" );
+    int64_t lwork;
+    sysv_aa_work_size(
+        uplo, n, nrhs, A, lda, B, ldb,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return sysv_aa(
+        uplo, n, nrhs, A, lda, ipiv, B, ldb,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv
+int64_t sysv_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    lapack_int* ipiv,
+    std::complex<float>* B, int64_t ldb )
+{
+    internal::StatsScope stats_scope( "csysv_aa" );
+    int64_t lwork;
+    sysv_aa_work_size(
+        uplo, n, nrhs, A, lda, B, ldb,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+
+    return sysv_aa(
+        uplo, n, nrhs, A, lda, ipiv, B, ldb,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::sysv_aa that takes ipiv in the native LAPACK integer
+/// type, lapack_int, instead of int64_t, which avoids allocating and
+/// copying a temporary pivot array. Available only when lapack_int is
+/// 32-bit, i.e., LAPACK_ILP64 is not defined; otherwise the int64_t
+/// version is already native.
+///
+/// @ingroup sysv
+int64_t sysv_aa(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    lapack_int* ipiv,
+    std::complex<double>* B, int64_t ldb )
+{
+    internal::StatsScope stats_scope( "zsysv_aa" );
+    int64_t lwork;
+    sysv_aa_work_size(
+        uplo, n, nrhs, A, lda, B, ldb,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+
+    return sysv_aa(
+        uplo, n, nrhs, A, lda, ipiv, B, ldb,
+        &work[0], lwork );
+}
+
+#endif  // LAPACK_ILP64
+
 }  // namespace lapack
 
 #endif  // LAPACK >= 3.7
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack_internal.hh"
 #include "lapack/fortran.h"
+#include "work_size_cache.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30700  // >= v3.7
@@ -20,14 +21,21 @@ using blas::real;
 
 // -----------------------------------------------------------------------------
 /// @ingroup heev_computational
-int64_t sytrd_2stage(
+void sytrd_2stage_work_size(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda,
     float* D,
     float* E,
     float* tau,
-    float* hous2, int64_t lhous2 )
+    float* hous2, int64_t lhous2,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "ssytrd_2stage" );
+    internal::WorkSizeKey key( "ssytrd_2stage",
+        { to_char( jobz ), to_char( uplo ), n, lda, lhous2 } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -38,6 +46,7 @@ int64_t sytrd_2stage(
     // query for workspace size
     float qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_ssytrd_2stage(
         &jobz_, &uplo_, &n_,
         A, &lda_,
@@ -47,13 +56,32 @@ int64_t sytrd_2stage(
         hous2, &lhous2_,
         qry_work, &ineg_one, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup heev_computational
+int64_t sytrd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* D,
+    float* E,
+    float* tau,
+    float* hous2, int64_t lhous2,
+    float* work, int64_t lwork )
+{
+    char jobz_ = to_char( jobz );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int lhous2_ = to_lapack_int( lhous2 );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_ssytrd_2stage(
         &jobz_, &uplo_, &n_,
@@ -62,7 +90,7 @@ int64_t sytrd_2stage(
         E,
         tau,
         hous2, &lhous2_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -71,16 +99,53 @@ int64_t sytrd_2stage(
 }
 
 // -----------------------------------------------------------------------------
-/// @see lapack::hetrd_2stage
 /// @ingroup heev_computational
 int64_t sytrd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* D,
+    float* E,
+    float* tau,
+    float* hous2, int64_t lhous2 )
+{
+    internal::StatsScope stats_scope( "ssytrd_2stage" );
+    int64_t lwork;
+    sytrd_2stage_work_size(
+        jobz, uplo, n, A, lda, D, E, tau, hous2, lhous2,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return sytrd_2stage(
+        jobz, uplo, n, A, lda, D, E, tau, hous2, lhous2,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::sytrd_2stage with caller-supplied workspace.
+/// Arguments are the same as for lapack::sytrd_2stage; the matrices are not
+/// modified. The sizes can be reused for any call of the same shape.
+///
+/// @param[out] lwork
+///     Required length of the work array.
+///
+/// @ingroup heev_computational
+void sytrd_2stage_work_size(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda,
     double* D,
     double* E,
     double* tau,
-    double* hous2, int64_t lhous2 )
+    double* hous2, int64_t lhous2,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "dsytrd_2stage" );
+    internal::WorkSizeKey key( "dsytrd_2stage",
+        { to_char( jobz ), to_char( uplo ), n, lda, lhous2 } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     char jobz_ = to_char( jobz );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
@@ -91,6 +156,7 @@ int64_t sytrd_2stage(
     // query for workspace size
     double qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_dsytrd_2stage(
         &jobz_, &uplo_, &n_,
         A, &lda_,
@@ -100,13 +166,42 @@ int64_t sytrd_2stage(
         hous2, &lhous2_,
         qry_work, &ineg_one, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// Variant of lapack::sytrd_2stage with caller-supplied workspace, which
+/// skips the internal workspace query and allocation. Other arguments
+/// are the same as for lapack::sytrd_2stage.
+///
+/// @param[out] work
+///     Workspace of length lwork.
+///
+/// @param[in] lwork
+///     Length of work, at least as returned by lapack::sytrd_2stage_work_size.
+///
+/// @ingroup heev_computational
+int64_t sytrd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* D,
+    double* E,
+    double* tau,
+    double* hous2, int64_t lhous2,
+    double* work, int64_t lwork )
+{
+    char jobz_ = to_char( jobz );
+    char uplo_ = to_char( uplo );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int lhous2_ = to_lapack_int( lhous2 );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_dsytrd_2stage(
         &jobz_, &uplo_, &n_,
@@ -115,7 +210,7 @@ int64_t sytrd_2stage(
         E,
         tau,
         hous2, &lhous2_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -123,6 +218,31 @@ int64_t sytrd_2stage(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @see lapack::hetrd_2stage
+/// @ingroup heev_computational
+int64_t sytrd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* D,
+    double* E,
+    double* tau,
+    double* hous2, int64_t lhous2 )
+{
+    internal::StatsScope stats_scope( "dsytrd_2stage" );
+    int64_t lwork;
+    sytrd_2stage_work_size(
+        jobz, uplo, n, A, lda, D, E, tau, hous2, lhous2,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return sytrd_2stage(
+        jobz, uplo, n, A, lda, D, E, tau, hous2, lhous2,
+        &work[0], lwork );
+}
+
 }  // namespace lapack
 
 #endif  // LAPACK >= v3.7
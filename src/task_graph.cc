@@ -0,0 +1,139 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "task_graph.hh"
+#include "thread_pool.hh"
+
+#include <algorithm>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace lapack {
+namespace internal {
+
+//------------------------------------------------------------------------------
+void TaskGraph::depend( int64_t pred, int64_t succ )
+{
+    // Edges into succ are added while it is the newest task, so a
+    // duplicate edge is always the last one.
+    std::vector< int64_t >& s = tasks_[ pred ].succ;
+    if (pred != succ && (s.empty() || s.back() != succ)) {
+        s.push_back( succ );
+        tasks_[ succ ].ndeps += 1;
+    }
+}
+
+//------------------------------------------------------------------------------
+int64_t TaskGraph::add(
+    int64_t priority,
+    std::vector< int64_t > const& reads,
+    std::vector< int64_t > const& writes,
+    Body body )
+{
+    int64_t id = size();
+    tasks_.emplace_back();
+    tasks_.back().body = std::move( body );
+    tasks_.back().priority = priority;
+
+    for (int64_t key : reads) {
+        Access& a = access_[ key ];
+        if (a.writer >= 0)
+            depend( a.writer, id );
+        a.readers.push_back( id );
+    }
+    for (int64_t key : writes) {
+        Access& a = access_[ key ];
+        if (a.writer >= 0)
+            depend( a.writer, id );
+        for (int64_t r : a.readers)
+            depend( r, id );
+        a.readers.clear();
+        a.writer = id;
+    }
+    return id;
+}
+
+//------------------------------------------------------------------------------
+void TaskGraph::run()
+{
+    int64_t ntasks = size();
+    if (ntasks == 0)
+        return;
+
+    // Ready queue per worker: a max-heap on priority, ties to lower id.
+    struct Queue {
+        std::mutex mutex;
+        std::vector< int64_t > heap;
+    };
+    auto less = [this]( int64_t a, int64_t b ) {
+        return tasks_[ a ].priority <  tasks_[ b ].priority
+           || (tasks_[ a ].priority == tasks_[ b ].priority && a > b);
+    };
+    auto push = [&]( Queue& q, int64_t id ) {
+        std::lock_guard< std::mutex > lock( q.mutex );
+        q.heap.push_back( id );
+        std::push_heap( q.heap.begin(), q.heap.end(), less );
+    };
+    auto pop = [&]( Queue& q ) -> int64_t {
+        std::lock_guard< std::mutex > lock( q.mutex );
+        if (q.heap.empty())
+            return -1;
+        std::pop_heap( q.heap.begin(), q.heap.end(), less );
+        int64_t id = q.heap.back();
+        q.heap.pop_back();
+        return id;
+    };
+
+    int64_t nworkers = ThreadPool::instance().num_threads();
+    std::vector< Queue > queues( nworkers );
+    int64_t w = 0;
+    for (int64_t id = 0; id < ntasks; ++id) {
+        if (tasks_[ id ].ndeps == 0) {
+            push( queues[ w ], id );
+            w = (w + 1) % nworkers;
+        }
+    }
+
+    std::atomic< int64_t > remaining { ntasks };
+    std::mutex error_mutex;
+    std::exception_ptr error;
+
+    // One worker loop per thread. If the pool is busy, the loops run
+    // serially, and the first executes the whole graph.
+    ThreadPool::instance().run( nworkers, [&]( int64_t self ) {
+        while (remaining.load() > 0) {
+            // Own queue first, then steal, starting from the next worker.
+            int64_t id = pop( queues[ self ] );
+            for (int64_t v = 1; id < 0 && v < nworkers; ++v)
+                id = pop( queues[ (self + v) % nworkers ] );
+            if (id < 0) {
+                std::this_thread::yield();
+                continue;
+            }
+
+            Task& task = tasks_[ id ];
+            try {
+                task.body();
+            }
+            catch (...) {
+                std::lock_guard< std::mutex > lock( error_mutex );
+                if (! error)
+                    error = std::current_exception();
+            }
+            for (int64_t s : task.succ) {
+                if (tasks_[ s ].ndeps.fetch_sub( 1 ) == 1)
+                    push( queues[ self ], s );
+            }
+            remaining.fetch_sub( 1 );
+        }
+    });
+
+    if (error)
+        std::rethrow_exception( error );
+}
+
+}  // namespace internal
+}  // namespace lapack
@@ -0,0 +1,82 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_TASK_GRAPH_HH
+#define LAPACK_TASK_GRAPH_HH
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+namespace lapack {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Graph of tasks with data dependencies, executed on the ThreadPool by
+/// work-stealing workers, for tiled algorithms such as potrf_parallel.
+///
+/// Tasks are added in a valid sequential order, each naming the data
+/// (e.g., tiles, by any integer key) it reads and writes. Dependencies
+/// follow from that order, as read-after-write, write-after-read, and
+/// write-after-write on the same key. run() then executes tasks as soon
+/// as their dependencies finish. Each worker keeps its own queue of ready
+/// tasks, ordered by priority, and steals from the others when it runs
+/// dry, so higher-priority tasks, e.g., the next panel, run first.
+///
+/// Usage:
+///
+///     TaskGraph g;
+///     g.add( priority, { reads... }, { writes... }, [=] { ... } );
+///     ...
+///     g.run();
+///
+class TaskGraph
+{
+public:
+    using Body = std::function< void () >;
+
+    /// Adds a task, which depends on earlier tasks that touch the same keys.
+    /// Higher priority tasks are preferred when several are ready.
+    /// @return the task's id.
+    int64_t add( int64_t priority,
+                 std::vector< int64_t > const& reads,
+                 std::vector< int64_t > const& writes,
+                 Body body );
+
+    /// @return number of tasks added.
+    int64_t size() const { return int64_t( tasks_.size() ); }
+
+    /// Executes all tasks and waits for them. If a task throws, the tasks
+    /// after it still run and the first exception is rethrown.
+    /// The graph can be run only once.
+    void run();
+
+private:
+    struct Task {
+        Body body;
+        int64_t priority;
+        std::vector< int64_t > succ;   ///< tasks that depend on this one
+        std::atomic< int64_t > ndeps { 0 };
+    };
+
+    /// Last writer of, and readers since then, of a key.
+    struct Access {
+        int64_t writer = -1;
+        std::vector< int64_t > readers;
+    };
+
+    void depend( int64_t pred, int64_t succ );
+
+    std::deque< Task > tasks_;    // deque keeps Task addresses stable
+    std::unordered_map< int64_t, Access > access_;
+};
+
+}  // namespace internal
+}  // namespace lapack
+
+#endif // LAPACK_TASK_GRAPH_HH
@@ -22,6 +22,7 @@ int64_t tbcon(
     float const* AB, int64_t ldab,
     float* rcond )
 {
+    internal::StatsScope stats_scope( "stbcon" );
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
@@ -52,6 +53,7 @@ int64_t tbcon(
     double const* AB, int64_t ldab,
     double* rcond )
 {
+    internal::StatsScope stats_scope( "dtbcon" );
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
@@ -82,6 +84,7 @@ int64_t tbcon(
     std::complex<float> const* AB, int64_t ldab,
     float* rcond )
 {
+    internal::StatsScope stats_scope( "ctbcon" );
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
@@ -112,6 +115,7 @@ int64_t tbcon(
     std::complex<double> const* AB, int64_t ldab,
     double* rcond )
 {
+    internal::StatsScope stats_scope( "ztbcon" );
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
@@ -25,6 +25,7 @@ int64_t tbrfs(
     float* ferr,
     float* berr )
 {
+    internal::StatsScope stats_scope( "stbrfs" );
     char uplo_ = to_char( uplo );
     char trans_ = to_char( trans );
     char diag_ = to_char( diag );
@@ -65,6 +66,7 @@ int64_t tbrfs(
     double* ferr,
     double* berr )
 {
+    internal::StatsScope stats_scope( "dtbrfs" );
     char uplo_ = to_char( uplo );
     char trans_ = to_char( trans );
     char diag_ = to_char( diag );
@@ -105,6 +107,7 @@ int64_t tbrfs(
     float* ferr,
     float* berr )
 {
+    internal::StatsScope stats_scope( "ctbrfs" );
     char uplo_ = to_char( uplo );
     char trans_ = to_char( trans );
     char diag_ = to_char( diag );
@@ -145,6 +148,7 @@ int64_t tbrfs(
     double* ferr,
     double* berr )
 {
+    internal::StatsScope stats_scope( "ztbrfs" );
     char uplo_ = to_char( uplo );
     char trans_ = to_char( trans );
     char diag_ = to_char( diag );
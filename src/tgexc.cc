@@ -6,6 +6,8 @@
 #include "lapack.hh"
 #include "lapack_internal.hh"
 #include "lapack/fortran.h"
+#include "work_size_cache.hh"
+#include "NoConstructAllocator.hh"
 
 #include <vector>
 
@@ -104,9 +106,62 @@ inline void tgexc(
 //==============================================================================
 namespace impl {
 
+//------------------------------------------------------------------------------
+/// Mid-level templated workspace query; real only, as complex tgexc
+/// needs no workspace.
+/// @ingroup gges_internal
+///
+template <typename scalar_t>
+void tgexc_work_size(
+    bool wantq, bool wantz, int64_t n,
+    scalar_t* A, int64_t lda,
+    scalar_t* B, int64_t ldb,
+    scalar_t* Q, int64_t ldq,
+    scalar_t* Z, int64_t ldz,
+    int64_t* ifst, int64_t* ilst,
+    int64_t* lwork )
+{
+    static_assert( ! is_complex<scalar_t>::value,
+                   "complex tgexc has no workspace" );
+    const char* name = internal::stats_name< scalar_t >(
+        "stgexc", "dtgexc", "ctgexc", "ztgexc" );
+    internal::StatsScope stats_scope( name );
+    internal::WorkSizeKey key( name,
+        { wantq, wantz, n, lda, ldb, ldq, ldz } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
+    lapack_int wantq_ = to_lapack_int( wantq );
+    lapack_int wantz_ = to_lapack_int( wantz );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int ldq_ = to_lapack_int( ldq );
+    lapack_int ldz_ = to_lapack_int( ldz );
+    lapack_int ifst_ = to_lapack_int( *ifst );
+    lapack_int ilst_ = to_lapack_int( *ilst );
+    lapack_int info_ = 0;
+
+    // query for workspace size
+    scalar_t qry_work[1];
+    lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
+    internal::tgexc(
+        wantq_, wantz_, n_,
+        A, lda_, B, ldb_, Q, ldq_, Z, ldz_, &ifst_, &ilst_,
+        qry_work, ineg_one, &info_ );
+    query_timer.stop();
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real( qry_work[ 0 ] );
+    internal::work_size_cache_insert( key, *lwork );
+}
+
 //------------------------------------------------------------------------------
 /// Mid-level templated wrapper checks and converts arguments,
-/// then calls low-level wrapper.
+/// then calls low-level wrapper. For real types, work is used as the
+/// workspace; for complex types, work is ignored and may be null.
 /// @ingroup gges_internal
 ///
 template <typename scalar_t>
@@ -116,7 +171,8 @@ int64_t tgexc(
     scalar_t* B, int64_t ldb,
     scalar_t* Q, int64_t ldq,
     scalar_t* Z, int64_t ldz,
-    int64_t* ifst, int64_t* ilst )
+    int64_t* ifst, int64_t* ilst,
+    scalar_t* work, int64_t lwork )
 {
     lapack_int wantq_ = to_lapack_int( wantq );
     lapack_int wantz_ = to_lapack_int( wantz );
@@ -131,26 +187,13 @@ int64_t tgexc(
 
     if constexpr (! is_complex<scalar_t>::value) {
         // Real needs workspace.
-        // query for workspace size
-        scalar_t qry_work[1];
-        lapack_int ineg_one = -1;
-        internal::tgexc(
-            wantq_, wantz_, n_,
-            A, lda_, B, ldb_, Q, ldq_, Z, ldz_, &ifst_, &ilst_,
-            qry_work, ineg_one, &info_ );
-        if (info_ < 0) {
-            throw Error();
-        }
-        lapack_int lwork_ = real( qry_work[ 0 ] );
-
-        // allocate workspace
-        std::vector< scalar_t > work( lwork_ );
+        lapack_int lwork_ = to_lapack_int( lwork );
 
         // call low-level wrapper
         internal::tgexc(
             wantq_, wantz_, n_,
             A, lda_, B, ldb_, Q, ldq_, Z, ldz_, &ifst_, &ilst_,
-            &work[0], lwork_, &info_ );
+            work, lwork_, &info_ );
     }
     else {
         // call low-level wrapper
@@ -166,8 +209,95 @@ int64_t tgexc(
     return info_;
 }
 
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper queries and allocates workspace,
+/// then calls the wrapper above.
+/// @ingroup gges_internal
+///
+template <typename scalar_t>
+int64_t tgexc(
+    bool wantq, bool wantz, int64_t n,
+    scalar_t* A, int64_t lda,
+    scalar_t* B, int64_t ldb,
+    scalar_t* Q, int64_t ldq,
+    scalar_t* Z, int64_t ldz,
+    int64_t* ifst, int64_t* ilst )
+{
+    internal::StatsScope stats_scope(
+        internal::stats_name< scalar_t >( "stgexc", "dtgexc", "ctgexc", "ztgexc" ) );
+    if constexpr (! is_complex<scalar_t>::value) {
+        // Real needs workspace.
+        int64_t lwork;
+        tgexc_work_size(
+            wantq, wantz, n, A, lda, B, ldb, Q, ldq, Z, ldz, ifst, ilst,
+            &lwork );
+
+        // allocate workspace
+        lapack::vector< scalar_t > work( lwork );
+
+        return tgexc(
+            wantq, wantz, n, A, lda, B, ldb, Q, ldq, Z, ldz, ifst, ilst,
+            &work[0], lwork );
+    }
+    else {
+        return tgexc(
+            wantq, wantz, n, A, lda, B, ldb, Q, ldq, Z, ldz, ifst, ilst,
+            (scalar_t*) nullptr, 0 );
+    }
+}
+
 }  // namespace impl
 
+//------------------------------------------------------------------------------
+/// Workspace query for lapack::tgexc with caller-supplied workspace,
+/// float version. Arguments are the same as for lapack::tgexc; the
+/// matrices, ifst, and ilst are not modified. Only the real versions
+/// take workspace; complex tgexc needs none.
+///
+/// @param[out] lwork
+///     Required length of the work array.
+///
+/// @ingroup gges
+void tgexc_work_size(
+    bool wantq, bool wantz, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* Q, int64_t ldq,
+    float* Z, int64_t ldz,
+    int64_t* ifst, int64_t* ilst,
+    int64_t* lwork )
+{
+    impl::tgexc_work_size(
+        wantq, wantz, n, A, lda, B, ldb, Q, ldq, Z, ldz, ifst, ilst,
+        lwork );
+}
+
+//------------------------------------------------------------------------------
+/// Variant of lapack::tgexc with caller-supplied workspace, float
+/// version, which skips the internal workspace query and allocation.
+/// Other arguments are the same as for lapack::tgexc.
+///
+/// @param[out] work
+///     Workspace of length lwork.
+///
+/// @param[in] lwork
+///     Length of work, at least as returned by lapack::tgexc_work_size.
+///
+/// @ingroup gges
+int64_t tgexc(
+    bool wantq, bool wantz, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* Q, int64_t ldq,
+    float* Z, int64_t ldz,
+    int64_t* ifst, int64_t* ilst,
+    float* work, int64_t lwork )
+{
+    return impl::tgexc(
+        wantq, wantz, n, A, lda, B, ldb, Q, ldq, Z, ldz, ifst, ilst,
+        work, lwork );
+}
+
 //==============================================================================
 /// Reorders the generalized Schur decomposition of a complex
 /// matrix pair (A,B), using an unitary equivalence transformation
@@ -274,6 +404,40 @@ int64_t tgexc(
         wantq, wantz, n, A, lda, B, ldb, Q, ldq, Z, ldz, ifst, ilst );
 }
 
+//------------------------------------------------------------------------------
+/// Workspace query, double version.
+/// @ingroup gges
+void tgexc_work_size(
+    bool wantq, bool wantz, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* Q, int64_t ldq,
+    double* Z, int64_t ldz,
+    int64_t* ifst, int64_t* ilst,
+    int64_t* lwork )
+{
+    impl::tgexc_work_size(
+        wantq, wantz, n, A, lda, B, ldb, Q, ldq, Z, ldz, ifst, ilst,
+        lwork );
+}
+
+//------------------------------------------------------------------------------
+/// Caller-supplied workspace variant, double version.
+/// @ingroup gges
+int64_t tgexc(
+    bool wantq, bool wantz, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* Q, int64_t ldq,
+    double* Z, int64_t ldz,
+    int64_t* ifst, int64_t* ilst,
+    double* work, int64_t lwork )
+{
+    return impl::tgexc(
+        wantq, wantz, n, A, lda, B, ldb, Q, ldq, Z, ldz, ifst, ilst,
+        work, lwork );
+}
+
 //------------------------------------------------------------------------------
 /// High-level overloaded wrapper, double version.
 /// @ingroup gges
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack_internal.hh"
 #include "lapack/fortran.h"
+#include "NoConstructAllocator.hh"
 
 #include <vector>
 
@@ -134,12 +135,13 @@ inline void tgsen(
 namespace impl {
 
 //------------------------------------------------------------------------------
-/// Mid-level templated wrapper checks and converts arguments,
-/// then calls low-level wrapper.
+/// Mid-level templated workspace query.
+/// The sizes depend on the number of selected eigenvalues, so they are
+/// not cached.
 /// @ingroup gges_internal
 ///
 template <typename scalar_t>
-int64_t tgsen(
+void tgsen_work_size(
     int64_t ijob, bool wantq, bool wantz,
     lapack_logical const* select, int64_t n,
     scalar_t* A, int64_t lda,
@@ -150,8 +152,11 @@ int64_t tgsen(
     scalar_t* Z, int64_t ldz,
     int64_t* nfound,
     real_type<scalar_t>* pl, real_type<scalar_t>* pr,
-    real_type<scalar_t>* dif )
+    real_type<scalar_t>* dif,
+    int64_t* lwork, int64_t* liwork )
 {
+    internal::StatsScope stats_scope(
+        internal::stats_name< scalar_t >( "stgsen", "dtgsen", "ctgsen", "ztgsen" ) );
     lapack_int ijob_ = to_lapack_int( ijob );
     lapack_int wantq_ = to_lapack_int( wantq );
     lapack_int wantz_ = to_lapack_int( wantz );
@@ -163,24 +168,19 @@ int64_t tgsen(
     lapack_int nfound_ = 0;  // out
     lapack_int info_ = 0;
 
-    // For real, create vectors for split-complex representation.
-    // For complex, creates as dummy `int` type to be optimized away.
-    std::conditional_t< is_complex<scalar_t>::value, int, std::vector<scalar_t> >
-        alphar, alphai;
-    blas_unused( alphar );  // unused in complex
-    blas_unused( alphai );
-
     // query for workspace size
     scalar_t qry_work[ 1 ];
     lapack_int qry_iwork[ 1 ];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     if constexpr (! is_complex<scalar_t>::value) {
-        // For real, use split-complex alpha.
-        alphar.resize( n );
-        alphai.resize( n );
+        // For real, use split-complex alpha; it is not referenced by
+        // the query.
+        scalar_t qry_alphar[ 1 ];
+        scalar_t qry_alphai[ 1 ];
         internal::tgsen(
             ijob_, wantq_, wantz_, select, n_,
-            A, lda_, B, ldb_, &alphar[ 0 ], &alphai[ 0 ], beta,
+            A, lda_, B, ldb_, qry_alphar, qry_alphai, beta,
             Q, ldq_, Z, ldz_, &nfound_, pl, pr, dif,
             qry_work, ineg_one, qry_iwork, ineg_one, &info_ );
     }
@@ -191,25 +191,61 @@ int64_t tgsen(
             Q, ldq_, Z, ldz_, &nfound_, pl, pr, dif,
             qry_work, ineg_one, qry_iwork, ineg_one, &info_ );
     }
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
     // LAPACK <= 3.11 has query & documentation error in workspace size; add 1.
-    lapack_int lwork_  = real( qry_work[ 0 ] ) + 1;
-    lapack_int liwork_ = real( qry_iwork[ 0 ] );
+    *lwork  = real( qry_work[ 0 ] ) + 1;
+    *liwork = real( qry_iwork[ 0 ] );
+}
 
-    // allocate workspace
-    std::vector< scalar_t > work( lwork_ );
-    std::vector< lapack_int > iwork( liwork_ );
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks and converts arguments,
+/// then calls low-level wrapper with caller-supplied workspace.
+/// @ingroup gges_internal
+///
+template <typename scalar_t>
+int64_t tgsen(
+    int64_t ijob, bool wantq, bool wantz,
+    lapack_logical const* select, int64_t n,
+    scalar_t* A, int64_t lda,
+    scalar_t* B, int64_t ldb,
+    complex_type<scalar_t>* alpha,
+    scalar_t* beta,
+    scalar_t* Q, int64_t ldq,
+    scalar_t* Z, int64_t ldz,
+    int64_t* nfound,
+    real_type<scalar_t>* pl, real_type<scalar_t>* pr,
+    real_type<scalar_t>* dif,
+    scalar_t* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    internal::StatsScope stats_scope(
+        internal::stats_name< scalar_t >( "stgsen", "dtgsen", "ctgsen", "ztgsen" ) );
+    lapack_int ijob_ = to_lapack_int( ijob );
+    lapack_int wantq_ = to_lapack_int( wantq );
+    lapack_int wantz_ = to_lapack_int( wantz );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int ldq_ = to_lapack_int( ldq );
+    lapack_int ldz_ = to_lapack_int( ldz );
+    lapack_int nfound_ = 0;  // out
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int liwork_ = to_lapack_int( liwork );
+    lapack_int info_ = 0;
 
     // call low-level wrapper
     if constexpr (! is_complex<scalar_t>::value) {
         // For real, use split-complex alpha.
+        lapack::vector< scalar_t > alphar( n );
+        lapack::vector< scalar_t > alphai( n );
         internal::tgsen(
             ijob_, wantq_, wantz_, select, n_,
             A, lda_, B, ldb_, &alphar[0], &alphai[0], beta,
             Q, ldq_, Z, ldz_, &nfound_, pl, pr, dif,
-            &work[0], lwork_, &iwork[0], liwork_, &info_ );
+            work, lwork_, iwork, liwork_, &info_ );
         // Merge split-complex representation.
         for (int64_t i = 0; i < n; ++i) {
             alpha[ i ] = std::complex<scalar_t>( alphar[ i ], alphai[ i ] );
@@ -220,7 +256,7 @@ int64_t tgsen(
             ijob_, wantq_, wantz_, select, n_,
             A, lda_, B, ldb_, alpha, beta,
             Q, ldq_, Z, ldz_, &nfound_, pl, pr, dif,
-            &work[0], lwork_, &iwork[0], liwork_, &info_ );
+            work, lwork_, iwork, liwork_, &info_ );
     }
     if (info_ < 0) {
         throw Error();
@@ -229,8 +265,121 @@ int64_t tgsen(
     return info_;
 }
 
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper queries and allocates workspace,
+/// then calls the wrapper above.
+/// @ingroup gges_internal
+///
+template <typename scalar_t>
+int64_t tgsen(
+    int64_t ijob, bool wantq, bool wantz,
+    lapack_logical const* select, int64_t n,
+    scalar_t* A, int64_t lda,
+    scalar_t* B, int64_t ldb,
+    complex_type<scalar_t>* alpha,
+    scalar_t* beta,
+    scalar_t* Q, int64_t ldq,
+    scalar_t* Z, int64_t ldz,
+    int64_t* nfound,
+    real_type<scalar_t>* pl, real_type<scalar_t>* pr,
+    real_type<scalar_t>* dif )
+{
+    internal::StatsScope stats_scope(
+        internal::stats_name< scalar_t >( "stgsen", "dtgsen", "ctgsen", "ztgsen" ) );
+    int64_t lwork, liwork;
+    tgsen_work_size(
+        ijob, wantq, wantz, select, n,
+        A, lda, B, ldb, alpha, beta,
+        Q, ldq, Z, ldz, nfound, pl, pr, dif,
+        &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< scalar_t > work( lwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return tgsen(
+        ijob, wantq, wantz, select, n,
+        A, lda, B, ldb, alpha, beta,
+        Q, ldq, Z, ldz, nfound, pl, pr, dif,
+        &work[0], lwork, &iwork[0], liwork );
+}
+
 }  // namespace impl
 
+//------------------------------------------------------------------------------
+/// Workspace query for lapack::tgsen with caller-supplied workspace,
+/// float version. Arguments are the same as for lapack::tgsen; the
+/// matrices are not modified. The sizes depend on the number of
+/// selected eigenvalues, so they are not cached.
+///
+/// @param[out] lwork
+///     Required length of the work array.
+///
+/// @param[out] liwork
+///     Required length of the iwork array.
+///
+/// @ingroup gges
+void tgsen_work_size(
+    int64_t ijob, bool wantq, bool wantz,
+    lapack_logical const* select, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    std::complex<float>* alpha,
+    float* beta,
+    float* Q, int64_t ldq,
+    float* Z, int64_t ldz,
+    int64_t* nfound,
+    float* pl, float* pr,
+    float* dif,
+    int64_t* lwork, int64_t* liwork )
+{
+    impl::tgsen_work_size(
+        ijob, wantq, wantz, select, n,
+        A, lda, B, ldb, alpha, beta,
+        Q, ldq, Z, ldz, nfound, pl, pr, dif,
+        lwork, liwork );
+}
+
+//------------------------------------------------------------------------------
+/// Variant of lapack::tgsen with caller-supplied workspace, float
+/// version, which skips the internal workspace query and allocation.
+/// Other arguments are the same as for lapack::tgsen.
+///
+/// @param[out] work
+///     Workspace of length lwork.
+///
+/// @param[in] lwork
+///     Length of work, at least as returned by lapack::tgsen_work_size.
+///
+/// @param[out] iwork
+///     Integer workspace of length liwork.
+///
+/// @param[in] liwork
+///     Length of iwork, at least as returned by lapack::tgsen_work_size.
+///
+/// @ingroup gges
+int64_t tgsen(
+    int64_t ijob, bool wantq, bool wantz,
+    lapack_logical const* select, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    std::complex<float>* alpha,
+    float* beta,
+    float* Q, int64_t ldq,
+    float* Z, int64_t ldz,
+    int64_t* nfound,
+    float* pl, float* pr,
+    float* dif,
+    float* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    return impl::tgsen(
+        ijob, wantq, wantz, select, n,
+        A, lda, B, ldb, alpha, beta,
+        Q, ldq, Z, ldz, nfound, pl, pr, dif,
+        work, lwork, iwork, liwork );
+}
+
 //==============================================================================
 /// Reorders the generalized Schur decomposition of a complex
 /// matrix pair (A, B) (in terms of an unitary equivalence trans-
@@ -506,6 +655,55 @@ int64_t tgsen(
         Q, ldq, Z, ldz, nfound, pl, pr, dif );
 }
 
+//------------------------------------------------------------------------------
+/// Workspace query, double version.
+/// @ingroup gges
+void tgsen_work_size(
+    int64_t ijob, bool wantq, bool wantz,
+    lapack_logical const* select, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    std::complex<double>* alpha,
+    double* beta,
+    double* Q, int64_t ldq,
+    double* Z, int64_t ldz,
+    int64_t* nfound,
+    double* pl, double* pr,
+    double* dif,
+    int64_t* lwork, int64_t* liwork )
+{
+    impl::tgsen_work_size(
+        ijob, wantq, wantz, select, n,
+        A, lda, B, ldb, alpha, beta,
+        Q, ldq, Z, ldz, nfound, pl, pr, dif,
+        lwork, liwork );
+}
+
+//------------------------------------------------------------------------------
+/// Caller-supplied workspace variant, double version.
+/// @ingroup gges
+int64_t tgsen(
+    int64_t ijob, bool wantq, bool wantz,
+    lapack_logical const* select, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    std::complex<double>* alpha,
+    double* beta,
+    double* Q, int64_t ldq,
+    double* Z, int64_t ldz,
+    int64_t* nfound,
+    double* pl, double* pr,
+    double* dif,
+    double* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    return impl::tgsen(
+        ijob, wantq, wantz, select, n,
+        A, lda, B, ldb, alpha, beta,
+        Q, ldq, Z, ldz, nfound, pl, pr, dif,
+        work, lwork, iwork, liwork );
+}
+
 //------------------------------------------------------------------------------
 /// High-level overloaded wrapper, double version.
 /// @ingroup gges
@@ -528,6 +726,55 @@ int64_t tgsen(
         Q, ldq, Z, ldz, nfound, pl, pr, dif );
 }
 
+//------------------------------------------------------------------------------
+/// Workspace query, complex<float> version.
+/// @ingroup gges
+void tgsen_work_size(
+    int64_t ijob, bool wantq, bool wantz,
+    lapack_logical const* select, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* nfound,
+    float* pl, float* pr,
+    float* dif,
+    int64_t* lwork, int64_t* liwork )
+{
+    impl::tgsen_work_size(
+        ijob, wantq, wantz, select, n,
+        A, lda, B, ldb, alpha, beta,
+        Q, ldq, Z, ldz, nfound, pl, pr, dif,
+        lwork, liwork );
+}
+
+//------------------------------------------------------------------------------
+/// Caller-supplied workspace variant, complex<float> version.
+/// @ingroup gges
+int64_t tgsen(
+    int64_t ijob, bool wantq, bool wantz,
+    lapack_logical const* select, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* nfound,
+    float* pl, float* pr,
+    float* dif,
+    std::complex<float>* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    return impl::tgsen(
+        ijob, wantq, wantz, select, n,
+        A, lda, B, ldb, alpha, beta,
+        Q, ldq, Z, ldz, nfound, pl, pr, dif,
+        work, lwork, iwork, liwork );
+}
+
 //------------------------------------------------------------------------------
 /// High-level overloaded wrapper, complex<float> version.
 /// @ingroup gges
@@ -550,6 +797,55 @@ int64_t tgsen(
         Q, ldq, Z, ldz, nfound, pl, pr, dif );
 }
 
+//------------------------------------------------------------------------------
+/// Workspace query, complex<double> version.
+/// @ingroup gges
+void tgsen_work_size(
+    int64_t ijob, bool wantq, bool wantz,
+    lapack_logical const* select, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* nfound,
+    double* pl, double* pr,
+    double* dif,
+    int64_t* lwork, int64_t* liwork )
+{
+    impl::tgsen_work_size(
+        ijob, wantq, wantz, select, n,
+        A, lda, B, ldb, alpha, beta,
+        Q, ldq, Z, ldz, nfound, pl, pr, dif,
+        lwork, liwork );
+}
+
+//------------------------------------------------------------------------------
+/// Caller-supplied workspace variant, complex<double> version.
+/// @ingroup gges
+int64_t tgsen(
+    int64_t ijob, bool wantq, bool wantz,
+    lapack_logical const* select, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* nfound,
+    double* pl, double* pr,
+    double* dif,
+    std::complex<double>* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    return impl::tgsen(
+        ijob, wantq, wantz, select, n,
+        A, lda, B, ldb, alpha, beta,
+        Q, ldq, Z, ldz, nfound, pl, pr, dif,
+        work, lwork, iwork, liwork );
+}
+
 //------------------------------------------------------------------------------
 /// High-level overloaded wrapper, complex<double> version.
 /// @ingroup gges
@@ -28,6 +28,7 @@ int64_t tgsja(
     float* Q, int64_t ldq,
     int64_t* ncycle )
 {
+    internal::StatsScope stats_scope( "stgsja" );
     char jobu_ = to_char_compu( jobu );
     char jobv_ = to_char_comp( jobv );
     char jobq_ = to_char_compq( jobq );
@@ -77,6 +78,7 @@ int64_t tgsja(
     double* Q, int64_t ldq,
     int64_t* ncycle )
 {
+    internal::StatsScope stats_scope( "dtgsja" );
     char jobu_ = to_char_compu( jobu );
     char jobv_ = to_char_comp( jobv );
     char jobq_ = to_char_compq( jobq );
@@ -126,6 +128,7 @@ int64_t tgsja(
     std::complex<float>* Q, int64_t ldq,
     int64_t* ncycle )
 {
+    internal::StatsScope stats_scope( "ctgsja" );
     char jobu_ = to_char_compu( jobu );
     char jobv_ = to_char_comp( jobv );
     char jobq_ = to_char_compq( jobq );
@@ -175,6 +178,7 @@ int64_t tgsja(
     std::complex<double>* Q, int64_t ldq,
     int64_t* ncycle )
 {
+    internal::StatsScope stats_scope( "ztgsja" );
     char jobu_ = to_char_compu( jobu );
     char jobv_ = to_char_comp( jobv );
     char jobq_ = to_char_compq( jobq );
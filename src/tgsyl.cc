@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack_internal.hh"
 #include "lapack/fortran.h"
+#include "work_size_cache.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -17,7 +18,7 @@ using blas::min;
 using blas::real;
 
 // -----------------------------------------------------------------------------
-int64_t tgsyl(
+void tgsyl_work_size(
     lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
     float const* A, int64_t lda,
     float const* B, int64_t ldb,
@@ -26,8 +27,16 @@ int64_t tgsyl(
     float const* E, int64_t lde,
     float* F, int64_t ldf,
     float* dif,
-    float* scale )
+    float* scale,
+    int64_t* lwork,
+    int64_t* liwork )
 {
+    internal::StatsScope stats_scope( "stgsyl" );
+    internal::WorkSizeKey key( "stgsyl",
+        { to_char( trans ), ijob, m, n, lda, ldb, ldc, ldd, lde, ldf } );
+    if (internal::work_size_cache_find( key, lwork, nullptr, liwork ))
+        return;
+
     char trans_ = to_char( trans );
     lapack_int ijob_ = to_lapack_int( ijob );
     lapack_int m_ = to_lapack_int( m );
@@ -44,6 +53,7 @@ int64_t tgsyl(
     float qry_work[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_stgsyl(
         &trans_, &ijob_, &m_, &n_,
         A, &lda_,
@@ -55,14 +65,42 @@ int64_t tgsyl(
         qry_work, &ineg_one,
         qry_iwork, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    *liwork = m+n+6;
+    internal::work_size_cache_insert( key, *lwork, 0, *liwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (m+n+6) );
+// -----------------------------------------------------------------------------
+int64_t tgsyl(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    float const* B, int64_t ldb,
+    float* C, int64_t ldc,
+    float const* D, int64_t ldd,
+    float const* E, int64_t lde,
+    float* F, int64_t ldf,
+    float* dif,
+    float* scale,
+    float* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    char trans_ = to_char( trans );
+    lapack_int ijob_ = to_lapack_int( ijob );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int ldc_ = to_lapack_int( ldc );
+    lapack_int ldd_ = to_lapack_int( ldd );
+    lapack_int lde_ = to_lapack_int( lde );
+    lapack_int ldf_ = to_lapack_int( ldf );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( liwork < m+n+6 );
+    lapack_int info_ = 0;
 
     LAPACK_stgsyl(
         &trans_, &ijob_, &m_, &n_,
@@ -72,8 +110,8 @@ int64_t tgsyl(
         D, &ldd_,
         E, &lde_,
         F, &ldf_, dif, scale,
-        &work[0], &lwork_,
-        &iwork[0], &info_
+        work, &lwork_,
+        iwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -83,6 +121,35 @@ int64_t tgsyl(
 
 // -----------------------------------------------------------------------------
 int64_t tgsyl(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    float const* B, int64_t ldb,
+    float* C, int64_t ldc,
+    float const* D, int64_t ldd,
+    float const* E, int64_t lde,
+    float* F, int64_t ldf,
+    float* dif,
+    float* scale )
+{
+    internal::StatsScope stats_scope( "stgsyl" );
+    int64_t lwork, liwork;
+    tgsyl_work_size(
+        trans, ijob, m, n, A, lda, B, ldb, C, ldc, D, ldd, E, lde, F, ldf, dif,
+        scale,
+        &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return tgsyl(
+        trans, ijob, m, n, A, lda, B, ldb, C, ldc, D, ldd, E, lde, F, ldf, dif,
+        scale,
+        &work[0], lwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+void tgsyl_work_size(
     lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
     double const* A, int64_t lda,
     double const* B, int64_t ldb,
@@ -91,8 +158,16 @@ int64_t tgsyl(
     double const* E, int64_t lde,
     double* F, int64_t ldf,
     double* dif,
-    double* scale )
+    double* scale,
+    int64_t* lwork,
+    int64_t* liwork )
 {
+    internal::StatsScope stats_scope( "dtgsyl" );
+    internal::WorkSizeKey key( "dtgsyl",
+        { to_char( trans ), ijob, m, n, lda, ldb, ldc, ldd, lde, ldf } );
+    if (internal::work_size_cache_find( key, lwork, nullptr, liwork ))
+        return;
+
     char trans_ = to_char( trans );
     lapack_int ijob_ = to_lapack_int( ijob );
     lapack_int m_ = to_lapack_int( m );
@@ -109,6 +184,7 @@ int64_t tgsyl(
     double qry_work[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_dtgsyl(
         &trans_, &ijob_, &m_, &n_,
         A, &lda_,
@@ -120,14 +196,42 @@ int64_t tgsyl(
         qry_work, &ineg_one,
         qry_iwork, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    *liwork = m+n+6;
+    internal::work_size_cache_insert( key, *lwork, 0, *liwork );
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (m+n+6) );
+// -----------------------------------------------------------------------------
+int64_t tgsyl(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    double const* B, int64_t ldb,
+    double* C, int64_t ldc,
+    double const* D, int64_t ldd,
+    double const* E, int64_t lde,
+    double* F, int64_t ldf,
+    double* dif,
+    double* scale,
+    double* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    char trans_ = to_char( trans );
+    lapack_int ijob_ = to_lapack_int( ijob );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int ldc_ = to_lapack_int( ldc );
+    lapack_int ldd_ = to_lapack_int( ldd );
+    lapack_int lde_ = to_lapack_int( lde );
+    lapack_int ldf_ = to_lapack_int( ldf );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( liwork < m+n+6 );
+    lapack_int info_ = 0;
 
     LAPACK_dtgsyl(
         &trans_, &ijob_, &m_, &n_,
@@ -137,8 +241,8 @@ int64_t tgsyl(
         D, &ldd_,
         E, &lde_,
         F, &ldf_, dif, scale,
-        &work[0], &lwork_,
-        &iwork[0], &info_
+        work, &lwork_,
+        iwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -148,6 +252,35 @@ int64_t tgsyl(
 
 // -----------------------------------------------------------------------------
 int64_t tgsyl(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    double const* B, int64_t ldb,
+    double* C, int64_t ldc,
+    double const* D, int64_t ldd,
+    double const* E, int64_t lde,
+    double* F, int64_t ldf,
+    double* dif,
+    double* scale )
+{
+    internal::StatsScope stats_scope( "dtgsyl" );
+    int64_t lwork, liwork;
+    tgsyl_work_size(
+        trans, ijob, m, n, A, lda, B, ldb, C, ldc, D, ldd, E, lde, F, ldf, dif,
+        scale,
+        &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return tgsyl(
+        trans, ijob, m, n, A, lda, B, ldb, C, ldc, D, ldd, E, lde, F, ldf, dif,
+        scale,
+        &work[0], lwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+void tgsyl_work_size(
     lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
     std::complex<float> const* A, int64_t lda,
     std::complex<float> const* B, int64_t ldb,
@@ -156,8 +289,16 @@ int64_t tgsyl(
     std::complex<float> const* E, int64_t lde,
     std::complex<float>* F, int64_t ldf,
     float* dif,
-    float* scale )
+    float* scale,
+    int64_t* lwork,
+    int64_t* liwork )
 {
+    internal::StatsScope stats_scope( "ctgsyl" );
+    internal::WorkSizeKey key( "ctgsyl",
+        { to_char( trans ), ijob, m, n, lda, ldb, ldc, ldd, lde, ldf } );
+    if (internal::work_size_cache_find( key, lwork, nullptr, liwork ))
+        return;
+
     char trans_ = to_char( trans );
     lapack_int ijob_ = to_lapack_int( ijob );
     lapack_int m_ = to_lapack_int( m );
@@ -174,6 +315,7 @@ int64_t tgsyl(
     std::complex<float> qry_work[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_ctgsyl(
         &trans_, &ijob_, &m_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -185,14 +327,42 @@ int64_t tgsyl(
         (lapack_complex_float*) qry_work, &ineg_one,
         qry_iwork, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    *liwork = m+n+2;
+    internal::work_size_cache_insert( key, *lwork, 0, *liwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (m+n+2) );
+// -----------------------------------------------------------------------------
+int64_t tgsyl(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* C, int64_t ldc,
+    std::complex<float> const* D, int64_t ldd,
+    std::complex<float> const* E, int64_t lde,
+    std::complex<float>* F, int64_t ldf,
+    float* dif,
+    float* scale,
+    std::complex<float>* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    char trans_ = to_char( trans );
+    lapack_int ijob_ = to_lapack_int( ijob );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int ldc_ = to_lapack_int( ldc );
+    lapack_int ldd_ = to_lapack_int( ldd );
+    lapack_int lde_ = to_lapack_int( lde );
+    lapack_int ldf_ = to_lapack_int( ldf );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( liwork < m+n+2 );
+    lapack_int info_ = 0;
 
     LAPACK_ctgsyl(
         &trans_, &ijob_, &m_, &n_,
@@ -202,8 +372,8 @@ int64_t tgsyl(
         (lapack_complex_float*) D, &ldd_,
         (lapack_complex_float*) E, &lde_,
         (lapack_complex_float*) F, &ldf_, dif, scale,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &iwork[0], &info_
+        (lapack_complex_float*) work, &lwork_,
+        iwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -213,6 +383,45 @@ int64_t tgsyl(
 
 // -----------------------------------------------------------------------------
 int64_t tgsyl(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* C, int64_t ldc,
+    std::complex<float> const* D, int64_t ldd,
+    std::complex<float> const* E, int64_t lde,
+    std::complex<float>* F, int64_t ldf,
+    float* dif,
+    float* scale )
+{
+    internal::StatsScope stats_scope( "ctgsyl" );
+    int64_t lwork, liwork;
+    tgsyl_work_size(
+        trans, ijob, m, n, A, lda, B, ldb, C, ldc, D, ldd, E, lde, F, ldf, dif,
+        scale,
+        &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return tgsyl(
+        trans, ijob, m, n, A, lda, B, ldb, C, ldc, D, ldd, E, lde, F, ldf, dif,
+        scale,
+        &work[0], lwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::tgsyl with caller-supplied workspace.
+/// Arguments are the same as for lapack::tgsyl; the matrices are not
+/// modified. The sizes can be reused for any call of the same shape.
+///
+/// @param[out] lwork
+///     Required length of the work array.
+///
+/// @param[out] liwork
+///     Required length of the iwork array.
+///
+void tgsyl_work_size(
     lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
     std::complex<double> const* A, int64_t lda,
     std::complex<double> const* B, int64_t ldb,
@@ -221,8 +430,16 @@ int64_t tgsyl(
     std::complex<double> const* E, int64_t lde,
     std::complex<double>* F, int64_t ldf,
     double* dif,
-    double* scale )
+    double* scale,
+    int64_t* lwork,
+    int64_t* liwork )
 {
+    internal::StatsScope stats_scope( "ztgsyl" );
+    internal::WorkSizeKey key( "ztgsyl",
+        { to_char( trans ), ijob, m, n, lda, ldb, ldc, ldd, lde, ldf } );
+    if (internal::work_size_cache_find( key, lwork, nullptr, liwork ))
+        return;
+
     char trans_ = to_char( trans );
     lapack_int ijob_ = to_lapack_int( ijob );
     lapack_int m_ = to_lapack_int( m );
@@ -239,6 +456,7 @@ int64_t tgsyl(
     std::complex<double> qry_work[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_ztgsyl(
         &trans_, &ijob_, &m_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -250,14 +468,58 @@ int64_t tgsyl(
         (lapack_complex_double*) qry_work, &ineg_one,
         qry_iwork, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    *liwork = m+n+2;
+    internal::work_size_cache_insert( key, *lwork, 0, *liwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (m+n+2) );
+// -----------------------------------------------------------------------------
+/// Variant of lapack::tgsyl with caller-supplied workspace, which
+/// skips the internal workspace query and allocation. Other arguments
+/// are the same as for lapack::tgsyl.
+///
+/// @param[out] work
+///     Workspace of length lwork.
+///
+/// @param[in] lwork
+///     Length of work, at least as returned by lapack::tgsyl_work_size.
+///
+/// @param[out] iwork
+///     Workspace of length liwork.
+///
+/// @param[in] liwork
+///     Length of iwork, at least as returned by lapack::tgsyl_work_size.
+///
+int64_t tgsyl(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* C, int64_t ldc,
+    std::complex<double> const* D, int64_t ldd,
+    std::complex<double> const* E, int64_t lde,
+    std::complex<double>* F, int64_t ldf,
+    double* dif,
+    double* scale,
+    std::complex<double>* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    char trans_ = to_char( trans );
+    lapack_int ijob_ = to_lapack_int( ijob );
+    lapack_int m_ = to_lapack_int( m );
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int lda_ = to_lapack_int( lda );
+    lapack_int ldb_ = to_lapack_int( ldb );
+    lapack_int ldc_ = to_lapack_int( ldc );
+    lapack_int ldd_ = to_lapack_int( ldd );
+    lapack_int lde_ = to_lapack_int( lde );
+    lapack_int ldf_ = to_lapack_int( ldf );
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_error_if( liwork < m+n+2 );
+    lapack_int info_ = 0;
 
     LAPACK_ztgsyl(
         &trans_, &ijob_, &m_, &n_,
@@ -267,8 +529,8 @@ int64_t tgsyl(
         (lapack_complex_double*) D, &ldd_,
         (lapack_complex_double*) E, &lde_,
         (lapack_complex_double*) F, &ldf_, dif, scale,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &iwork[0], &info_
+        (lapack_complex_double*) work, &lwork_,
+        iwork, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -276,4 +538,33 @@ int64_t tgsyl(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+int64_t tgsyl(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* C, int64_t ldc,
+    std::complex<double> const* D, int64_t ldd,
+    std::complex<double> const* E, int64_t lde,
+    std::complex<double>* F, int64_t ldf,
+    double* dif,
+    double* scale )
+{
+    internal::StatsScope stats_scope( "ztgsyl" );
+    int64_t lwork, liwork;
+    tgsyl_work_size(
+        trans, ijob, m, n, A, lda, B, ldb, C, ldc, D, ldd, E, lde, F, ldf, dif,
+        scale,
+        &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return tgsyl(
+        trans, ijob, m, n, A, lda, B, ldb, C, ldc, D, ldd, E, lde, F, ldf, dif,
+        scale,
+        &work[0], lwork, &iwork[0], liwork );
+}
+
 }  // namespace lapack
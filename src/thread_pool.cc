@@ -0,0 +1,218 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/parallel.hh"
+#include "lapack_internal.hh"
+#include "thread_pool.hh"
+
+#include <atomic>
+#include <cstdlib>
+#include <exception>
+
+namespace lapack {
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+// True on pool workers, and on a thread while it runs a job, so nested
+// parallel regions run serially instead of deadlocking.
+thread_local bool t_in_pool = false;
+
+//------------------------------------------------------------------------------
+struct ThreadPool::Job
+{
+    Job( int64_t ntasks_, std::function< void (int64_t) > const& body_ )
+        : ntasks( ntasks_ ),
+          body( body_ )
+    {}
+
+    /// Claims and executes tasks until none remain.
+    void work()
+    {
+        int64_t i;
+        while ((i = next.fetch_add( 1 )) < ntasks) {
+            try {
+                body( i );
+            }
+            catch (...) {
+                std::lock_guard< std::mutex > lock( error_mutex );
+                if (! error)
+                    error = std::current_exception();
+            }
+        }
+    }
+
+    int64_t ntasks;
+    std::function< void (int64_t) > const& body;
+    std::atomic< int64_t > next { 0 };
+    std::mutex error_mutex;
+    std::exception_ptr error;
+};
+
+//------------------------------------------------------------------------------
+/// Default number of threads: $LAPACKPP_NUM_THREADS if set,
+/// otherwise the number of hardware threads.
+static int default_num_threads()
+{
+    const char* env = std::getenv( "LAPACKPP_NUM_THREADS" );
+    if (env != nullptr) {
+        int num_threads = std::atoi( env );
+        if (num_threads >= 1)
+            return num_threads;
+    }
+    return std::max( 1, int( std::thread::hardware_concurrency() ) );
+}
+
+//------------------------------------------------------------------------------
+ThreadPool& ThreadPool::instance()
+{
+    static ThreadPool pool;
+    return pool;
+}
+
+//------------------------------------------------------------------------------
+ThreadPool::ThreadPool()
+{
+    start( default_num_threads() );
+}
+
+//------------------------------------------------------------------------------
+ThreadPool::~ThreadPool()
+{
+    stop();
+}
+
+//------------------------------------------------------------------------------
+void ThreadPool::resize( int num_threads )
+{
+    num_threads = std::max( 1, num_threads );
+    std::lock_guard< std::mutex > submit_lock( submit_mutex_ );
+    if (num_threads != num_threads_) {
+        stop();
+        start( num_threads );
+    }
+}
+
+//------------------------------------------------------------------------------
+void ThreadPool::start( int num_threads )
+{
+    stop_ = false;
+    num_threads_ = num_threads;
+    workers_.reserve( num_threads - 1 );
+    for (int i = 1; i < num_threads; ++i) {
+        workers_.emplace_back( &ThreadPool::worker, this );
+    }
+}
+
+//------------------------------------------------------------------------------
+void ThreadPool::stop()
+{
+    {
+        std::lock_guard< std::mutex > lock( mutex_ );
+        stop_ = true;
+    }
+    wake_.notify_all();
+    for (auto& thread : workers_) {
+        thread.join();
+    }
+    workers_.clear();
+    num_threads_ = 1;
+}
+
+//------------------------------------------------------------------------------
+void ThreadPool::worker()
+{
+    t_in_pool = true;
+    int64_t seen = 0;
+    std::unique_lock< std::mutex > lock( mutex_ );
+    while (true) {
+        wake_.wait( lock, [&] { return stop_ || generation_ != seen; } );
+        if (stop_)
+            return;
+
+        seen = generation_;
+        Job* job = job_;
+        if (job == nullptr)
+            continue;  // job already finished
+
+        ++active_;
+        lock.unlock();
+        job->work();
+        lock.lock();
+        if (--active_ == 0)
+            done_.notify_all();
+    }
+}
+
+//------------------------------------------------------------------------------
+void ThreadPool::run(
+    int64_t ntasks, std::function< void (int64_t) > const& body )
+{
+    std::unique_lock< std::mutex > submit_lock( submit_mutex_, std::defer_lock );
+    if (ntasks <= 1 || t_in_pool || ! submit_lock.try_lock()
+        || num_threads_ <= 1)
+    {
+        // Run serially. Release the pool first, since body may itself
+        // call run.
+        if (submit_lock.owns_lock())
+            submit_lock.unlock();
+        for (int64_t i = 0; i < ntasks; ++i) {
+            body( i );
+        }
+        return;
+    }
+
+    Job job( ntasks, body );
+    {
+        std::lock_guard< std::mutex > lock( mutex_ );
+        job_ = &job;
+        ++generation_;
+    }
+    wake_.notify_all();
+
+    t_in_pool = true;
+    job.work();
+    t_in_pool = false;
+
+    {
+        // Wait for workers still executing tasks, then retract the job
+        // so late-waking workers do not see it.
+        std::unique_lock< std::mutex > lock( mutex_ );
+        done_.wait( lock, [&] { return active_ == 0; } );
+        job_ = nullptr;
+    }
+
+    if (job.error)
+        std::rethrow_exception( job.error );
+}
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+/// Sets the number of threads used by host-parallel LAPACK++ routines,
+/// such as getrf_batch, including the calling thread. Waits for any
+/// running parallel routine to finish.
+/// Does not affect threading inside the BLAS or LAPACK library.
+/// The default is $LAPACKPP_NUM_THREADS if set, otherwise the number of
+/// hardware threads.
+///
+/// @param[in] num_threads
+///     Number of threads, >= 1.
+///
+void set_num_threads( int num_threads )
+{
+    lapack_error_if( num_threads < 1 );
+    internal::ThreadPool::instance().resize( num_threads );
+}
+
+//------------------------------------------------------------------------------
+/// @return number of threads used by host-parallel LAPACK++ routines.
+///
+int get_num_threads()
+{
+    return internal::ThreadPool::instance().num_threads();
+}
+
+}  // namespace lapack
@@ -0,0 +1,100 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_THREAD_POOL_HH
+#define LAPACK_THREAD_POOL_HH
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace lapack {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Process-wide pool of worker threads for host-parallel routines such as
+/// the batched factorizations. The calling thread also executes tasks, so
+/// a pool of num_threads() uses num_threads() - 1 workers.
+///
+/// Only one job runs on the pool at a time. If the pool is busy, because
+/// another application thread is using it or because run is called from
+/// inside a task, the job is executed serially by the calling thread.
+class ThreadPool
+{
+public:
+    static ThreadPool& instance();
+
+    ~ThreadPool();
+
+    ThreadPool( ThreadPool const& ) = delete;
+    ThreadPool& operator = ( ThreadPool const& ) = delete;
+
+    /// @return number of threads, including the calling thread.
+    int num_threads() const { return num_threads_; }
+
+    void resize( int num_threads );
+
+    /// Executes body( i ) for i = 0, ..., ntasks-1, in any order, and waits
+    /// for all to finish. If a task throws, remaining tasks still run and
+    /// the first exception is rethrown.
+    void run( int64_t ntasks, std::function< void (int64_t) > const& body );
+
+private:
+    struct Job;
+
+    ThreadPool();
+    void start( int num_threads );
+    void stop();
+    void worker();
+
+    int num_threads_ = 1;
+    std::vector< std::thread > workers_;
+
+    std::mutex submit_mutex_;     ///< held while a job runs on the pool
+    std::mutex mutex_;            ///< guards job_, generation_, active_, stop_
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    Job* job_ = nullptr;
+    int64_t generation_ = 0;
+    int active_ = 0;
+    bool stop_ = false;
+};
+
+//------------------------------------------------------------------------------
+/// Splits [0, n) into contiguous ranges of at least grain items and calls
+/// body( begin, end ) for each, in parallel on the ThreadPool.
+/// Ranges are handed out dynamically, so uneven work is balanced.
+template <typename Body>
+void parallel_for( int64_t n, int64_t grain, Body&& body )
+{
+    if (n <= 0)
+        return;
+
+    ThreadPool& pool = ThreadPool::instance();
+    grain = std::max( grain, int64_t( 1 ) );
+    // A few ranges per thread, for load balance.
+    int64_t nranges = std::min( (n + grain - 1) / grain,
+                                int64_t( 4 ) * pool.num_threads() );
+    if (nranges <= 1) {
+        body( int64_t( 0 ), n );
+        return;
+    }
+
+    int64_t chunk = (n + nranges - 1) / nranges;
+    nranges = (n + chunk - 1) / chunk;
+    pool.run( nranges, [&]( int64_t r ) {
+        int64_t begin = r * chunk;
+        body( begin, std::min( begin + chunk, n ) );
+    });
+}
+
+}  // namespace internal
+}  // namespace lapack
+
+#endif // LAPACK_THREAD_POOL_HH
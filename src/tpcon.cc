@@ -22,6 +22,7 @@ int64_t tpcon(
     float const* AP,
     float* rcond )
 {
+    internal::StatsScope stats_scope( "stpcon" );
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
@@ -50,6 +51,7 @@ int64_t tpcon(
     double const* AP,
     double* rcond )
 {
+    internal::StatsScope stats_scope( "dtpcon" );
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
@@ -78,6 +80,7 @@ int64_t tpcon(
     std::complex<float> const* AP,
     float* rcond )
 {
+    internal::StatsScope stats_scope( "ctpcon" );
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
@@ -106,6 +109,7 @@ int64_t tpcon(
     std::complex<double> const* AP,
     double* rcond )
 {
+    internal::StatsScope stats_scope( "ztpcon" );
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
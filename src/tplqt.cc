@@ -26,6 +26,7 @@ int64_t tplqt(
     float* B, int64_t ldb,
     float* T, int64_t ldt )
 {
+    internal::StatsScope stats_scope( "stplqt" );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int l_ = to_lapack_int( l );
@@ -58,6 +59,7 @@ int64_t tplqt(
     double* B, int64_t ldb,
     double* T, int64_t ldt )
 {
+    internal::StatsScope stats_scope( "dtplqt" );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int l_ = to_lapack_int( l );
@@ -90,6 +92,7 @@ int64_t tplqt(
     std::complex<float>* B, int64_t ldb,
     std::complex<float>* T, int64_t ldt )
 {
+    internal::StatsScope stats_scope( "ctplqt" );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int l_ = to_lapack_int( l );
@@ -218,6 +221,7 @@ int64_t tplqt(
     std::complex<double>* B, int64_t ldb,
     std::complex<double>* T, int64_t ldt )
 {
+    internal::StatsScope stats_scope( "ztplqt" );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int l_ = to_lapack_int( l );
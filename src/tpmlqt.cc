@@ -27,6 +27,7 @@ int64_t tpmlqt(
     float* A, int64_t lda,
     float* B, int64_t ldb )
 {
+    internal::StatsScope stats_scope( "stpmlqt" );
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
         trans = Op::Trans;
@@ -71,6 +72,7 @@ int64_t tpmlqt(
     double* A, int64_t lda,
     double* B, int64_t ldb )
 {
+    internal::StatsScope stats_scope( "dtpmlqt" );
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
         trans = Op::Trans;
@@ -115,6 +117,7 @@ int64_t tpmlqt(
     std::complex<float>* A, int64_t lda,
     std::complex<float>* B, int64_t ldb )
 {
+    internal::StatsScope stats_scope( "ctpmlqt" );
     char side_ = to_char( side );
     char trans_ = to_char( trans );
     lapack_int m_ = to_lapack_int( m );
@@ -270,6 +273,7 @@ int64_t tpmlqt(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* B, int64_t ldb )
 {
+    internal::StatsScope stats_scope( "ztpmlqt" );
     char side_ = to_char( side );
     char trans_ = to_char( trans );
     lapack_int m_ = to_lapack_int( m );
@@ -27,6 +27,7 @@ int64_t tpmqrt(
     float* A, int64_t lda,
     float* B, int64_t ldb )
 {
+    internal::StatsScope stats_scope( "stpmqrt" );
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
         trans = Op::Trans;
@@ -71,6 +72,7 @@ int64_t tpmqrt(
     double* A, int64_t lda,
     double* B, int64_t ldb )
 {
+    internal::StatsScope stats_scope( "dtpmqrt" );
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
         trans = Op::Trans;
@@ -115,6 +117,7 @@ int64_t tpmqrt(
     std::complex<float>* A, int64_t lda,
     std::complex<float>* B, int64_t ldb )
 {
+    internal::StatsScope stats_scope( "ctpmqrt" );
     char side_ = to_char( side );
     char trans_ = to_char( trans );
     lapack_int m_ = to_lapack_int( m );
@@ -273,6 +276,7 @@ int64_t tpmqrt(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* B, int64_t ldb )
 {
+    internal::StatsScope stats_scope( "ztpmqrt" );
     char side_ = to_char( side );
     char trans_ = to_char( trans );
     lapack_int m_ = to_lapack_int( m );
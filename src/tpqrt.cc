@@ -26,6 +26,7 @@ int64_t tpqrt(
     float* B, int64_t ldb,
     float* T, int64_t ldt )
 {
+    internal::StatsScope stats_scope( "stpqrt" );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int l_ = to_lapack_int( l );
@@ -58,6 +59,7 @@ int64_t tpqrt(
     double* B, int64_t ldb,
     double* T, int64_t ldt )
 {
+    internal::StatsScope stats_scope( "dtpqrt" );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int l_ = to_lapack_int( l );
@@ -90,6 +92,7 @@ int64_t tpqrt(
     std::complex<float>* B, int64_t ldb,
     std::complex<float>* T, int64_t ldt )
 {
+    internal::StatsScope stats_scope( "ctpqrt" );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int l_ = to_lapack_int( l );
@@ -122,6 +125,7 @@ int64_t tpqrt(
     std::complex<double>* B, int64_t ldb,
     std::complex<double>* T, int64_t ldt )
 {
+    internal::StatsScope stats_scope( "ztpqrt" );
     lapack_int m_ = to_lapack_int( m );
     lapack_int n_ = to_lapack_int( n );
     lapack_int l_ = to_lapack_int( l );
@@ -29,6 +29,7 @@ void tprfb(
     float* A, int64_t lda,
     float* B, int64_t ldb )
 {
+    internal::StatsScope stats_scope( "stprfb" );
     char side_ = to_char( side );
     char trans_ = to_char( trans );
     char direction_ = to_char( direction );
@@ -68,6 +69,7 @@ void tprfb(
     double* A, int64_t lda,
     double* B, int64_t ldb )
 {
+    internal::StatsScope stats_scope( "dtprfb" );
     char side_ = to_char( side );
     char trans_ = to_char( trans );
     char direction_ = to_char( direction );
@@ -107,6 +109,7 @@ void tprfb(
     std::complex<float>* A, int64_t lda,
     std::complex<float>* B, int64_t ldb )
 {
+    internal::StatsScope stats_scope( "ctprfb" );
     char side_ = to_char( side );
     char trans_ = to_char( trans );
     char direction_ = to_char( direction );
@@ -312,6 +315,7 @@ void tprfb(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* B, int64_t ldb )
 {
+    internal::StatsScope stats_scope( "ztprfb" );
     char side_ = to_char( side );
     char trans_ = to_char( trans );
     char direction_ = to_char( direction );
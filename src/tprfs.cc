@@ -25,6 +25,7 @@ int64_t tprfs(
     float* ferr,
     float* berr )
 {
+    internal::StatsScope stats_scope( "stprfs" );
     char uplo_ = to_char( uplo );
     char trans_ = to_char( trans );
     char diag_ = to_char( diag );
@@ -63,6 +64,7 @@ int64_t tprfs(
     double* ferr,
     double* berr )
 {
+    internal::StatsScope stats_scope( "dtprfs" );
     char uplo_ = to_char( uplo );
     char trans_ = to_char( trans );
     char diag_ = to_char( diag );
@@ -101,6 +103,7 @@ int64_t tprfs(
     float* ferr,
     float* berr )
 {
+    internal::StatsScope stats_scope( "ctprfs" );
     char uplo_ = to_char( uplo );
     char trans_ = to_char( trans );
     char diag_ = to_char( diag );
@@ -139,6 +142,7 @@ int64_t tprfs(
     double* ferr,
     double* berr )
 {
+    internal::StatsScope stats_scope( "ztprfs" );
     char uplo_ = to_char( uplo );
     char trans_ = to_char( trans );
     char diag_ = to_char( diag );
@@ -22,6 +22,7 @@ int64_t trcon(
     float const* A, int64_t lda,
     float* rcond )
 {
+    internal::StatsScope stats_scope( "strcon" );
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
@@ -51,6 +52,7 @@ int64_t trcon(
     double const* A, int64_t lda,
     double* rcond )
 {
+    internal::StatsScope stats_scope( "dtrcon" );
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
@@ -80,6 +82,7 @@ int64_t trcon(
     std::complex<float> const* A, int64_t lda,
     float* rcond )
 {
+    internal::StatsScope stats_scope( "ctrcon" );
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
@@ -109,6 +112,7 @@ int64_t trcon(
     std::complex<double> const* A, int64_t lda,
     double* rcond )
 {
+    internal::StatsScope stats_scope( "ztrcon" );
     char norm_ = to_char( norm );
     char uplo_ = to_char( uplo );
     char diag_ = to_char( diag );
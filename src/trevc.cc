@@ -26,11 +26,12 @@ int64_t trevc(
     float* VR, int64_t ldvr, int64_t mm,
     int64_t* nfound )
 {
+    internal::StatsScope stats_scope( "strevc" );
     char sides_ = to_char( sides );
     char howmany_ = to_char( howmany );
 
     // lapack_logical (32 or 64-bit) copy
-    std::vector< lapack_logical > select_( &select[0], &select[(n)] );
+    lapack::vector< lapack_logical > select_( &select[0], &select[(n)] );
     lapack_logical* select_ptr = &select_[0];
 
     lapack_int n_ = to_lapack_int( n );
@@ -71,11 +72,12 @@ int64_t trevc(
     double* VR, int64_t ldvr, int64_t mm,
     int64_t* nfound )
 {
+    internal::StatsScope stats_scope( "dtrevc" );
     char sides_ = to_char( sides );
     char howmany_ = to_char( howmany );
 
     // lapack_logical (32 or 64-bit) copy
-    std::vector< lapack_logical > select_( &select[0], &select[(n)] );
+    lapack::vector< lapack_logical > select_( &select[0], &select[(n)] );
     lapack_logical* select_ptr = &select_[0];
 
     lapack_int n_ = to_lapack_int( n );
@@ -116,11 +118,12 @@ int64_t trevc(
     std::complex<float>* VR, int64_t ldvr, int64_t mm,
     int64_t* nfound )
 {
+    internal::StatsScope stats_scope( "ctrevc" );
     char sides_ = to_char( sides );
     char howmany_ = to_char( howmany );
 
     // lapack_logical (32 or 64-bit) copy
-    std::vector< lapack_logical > select_( &select[0], &select[(n)] );
+    lapack::vector< lapack_logical > select_( &select[0], &select[(n)] );
     lapack_logical const* select_ptr = &select_[0];
 
     lapack_int n_ = to_lapack_int( n );
@@ -283,11 +286,12 @@ int64_t trevc(
     std::complex<double>* VR, int64_t ldvr, int64_t mm,
     int64_t* nfound )
 {
+    internal::StatsScope stats_scope( "ztrevc" );
     char sides_ = to_char( sides );
     char howmany_ = to_char( howmany );
 
     // lapack_logical (32 or 64-bit) copy
-    std::vector< lapack_logical > select_( &select[0], &select[(n)] );
+    lapack::vector< lapack_logical > select_( &select[0], &select[(n)] );
     lapack_logical const* select_ptr = &select_[0];
 
     lapack_int n_ = to_lapack_int( n );
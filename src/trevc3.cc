@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack_internal.hh"
 #include "lapack/fortran.h"
+#include "work_size_cache.hh"
 #include "NoConstructAllocator.hh"
 
 #if LAPACK_VERSION >= 30601  // >= 3.6.1
@@ -21,19 +22,26 @@ using blas::real;
 
 // -----------------------------------------------------------------------------
 /// @ingroup geev_computational
-int64_t trevc3(
+void trevc3_work_size(
     lapack::Sides sides, lapack::HowMany howmany,
     bool* select, int64_t n,
     float const* T, int64_t ldt,
     float* VL, int64_t ldvl,
     float* VR, int64_t ldvr, int64_t mm,
-    int64_t* nfound )
+    int64_t* nfound,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "strevc3" );
+    internal::WorkSizeKey key( "strevc3",
+        { to_char( sides ), to_char( howmany ), n, ldt, ldvl, ldvr, mm } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     char sides_ = to_char( sides );
     char howmany_ = to_char( howmany );
 
     // lapack_logical (32 or 64-bit) copy
-    std::vector< lapack_logical > select_( &select[0], &select[(n)] );
+    lapack::vector< lapack_logical > select_( &select[0], &select[(n)] );
     lapack_logical* select_ptr = &select_[0];
 
     lapack_int n_ = to_lapack_int( n );
@@ -47,6 +55,7 @@ int64_t trevc3(
     // query for workspace size
     float qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_strevc3(
         &sides_, &howmany_,
         select_ptr, &n_,
@@ -55,13 +64,40 @@ int64_t trevc3(
         VR, &ldvr_, &mm_, &nfound_,
         qry_work, &ineg_one, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+int64_t trevc3(
+    lapack::Sides sides, lapack::HowMany howmany,
+    bool* select, int64_t n,
+    float const* T, int64_t ldt,
+    float* VL, int64_t ldvl,
+    float* VR, int64_t ldvr, int64_t mm,
+    int64_t* nfound,
+    float* work, int64_t lwork )
+{
+    char sides_ = to_char( sides );
+    char howmany_ = to_char( howmany );
+
+    // lapack_logical (32 or 64-bit) copy
+    lapack::vector< lapack_logical > select_( &select[0], &select[(n)] );
+    lapack_logical* select_ptr = &select_[0];
+
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ldt_ = to_lapack_int( ldt );
+    lapack_int ldvl_ = to_lapack_int( ldvl );
+    lapack_int ldvr_ = to_lapack_int( ldvr );
+    lapack_int mm_ = to_lapack_int( mm );
+    lapack_int nfound_ = 0;  // out
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_strevc3(
         &sides_, &howmany_,
@@ -69,7 +105,7 @@ int64_t trevc3(
         T, &ldt_,
         VL, &ldvl_,
         VR, &ldvr_, &mm_, &nfound_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -83,18 +119,49 @@ int64_t trevc3(
 // -----------------------------------------------------------------------------
 /// @ingroup geev_computational
 int64_t trevc3(
+    lapack::Sides sides, lapack::HowMany howmany,
+    bool* select, int64_t n,
+    float const* T, int64_t ldt,
+    float* VL, int64_t ldvl,
+    float* VR, int64_t ldvr, int64_t mm,
+    int64_t* nfound )
+{
+    internal::StatsScope stats_scope( "strevc3" );
+    int64_t lwork;
+    trevc3_work_size(
+        sides, howmany, select, n, T, ldt, VL, ldvl, VR, ldvr, mm, nfound,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return trevc3(
+        sides, howmany, select, n, T, ldt, VL, ldvl, VR, ldvr, mm, nfound,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+void trevc3_work_size(
     lapack::Sides sides, lapack::HowMany howmany,
     bool* select, int64_t n,
     double const* T, int64_t ldt,
     double* VL, int64_t ldvl,
     double* VR, int64_t ldvr, int64_t mm,
-    int64_t* nfound )
+    int64_t* nfound,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "dtrevc3" );
+    internal::WorkSizeKey key( "dtrevc3",
+        { to_char( sides ), to_char( howmany ), n, ldt, ldvl, ldvr, mm } );
+    if (internal::work_size_cache_find( key, lwork ))
+        return;
+
     char sides_ = to_char( sides );
     char howmany_ = to_char( howmany );
 
     // lapack_logical (32 or 64-bit) copy
-    std::vector< lapack_logical > select_( &select[0], &select[(n)] );
+    lapack::vector< lapack_logical > select_( &select[0], &select[(n)] );
     lapack_logical* select_ptr = &select_[0];
 
     lapack_int n_ = to_lapack_int( n );
@@ -108,6 +175,7 @@ int64_t trevc3(
     // query for workspace size
     double qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_dtrevc3(
         &sides_, &howmany_,
         select_ptr, &n_,
@@ -116,13 +184,40 @@ int64_t trevc3(
         VR, &ldvr_, &mm_, &nfound_,
         qry_work, &ineg_one, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+    internal::work_size_cache_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+int64_t trevc3(
+    lapack::Sides sides, lapack::HowMany howmany,
+    bool* select, int64_t n,
+    double const* T, int64_t ldt,
+    double* VL, int64_t ldvl,
+    double* VR, int64_t ldvr, int64_t mm,
+    int64_t* nfound,
+    double* work, int64_t lwork )
+{
+    char sides_ = to_char( sides );
+    char howmany_ = to_char( howmany );
+
+    // lapack_logical (32 or 64-bit) copy
+    lapack::vector< lapack_logical > select_( &select[0], &select[(n)] );
+    lapack_logical* select_ptr = &select_[0];
+
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ldt_ = to_lapack_int( ldt );
+    lapack_int ldvl_ = to_lapack_int( ldvl );
+    lapack_int ldvr_ = to_lapack_int( ldvr );
+    lapack_int mm_ = to_lapack_int( mm );
+    lapack_int nfound_ = 0;  // out
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_dtrevc3(
         &sides_, &howmany_,
@@ -130,7 +225,7 @@ int64_t trevc3(
         T, &ldt_,
         VL, &ldvl_,
         VR, &ldvr_, &mm_, &nfound_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -144,18 +239,50 @@ int64_t trevc3(
 // -----------------------------------------------------------------------------
 /// @ingroup geev_computational
 int64_t trevc3(
+    lapack::Sides sides, lapack::HowMany howmany,
+    bool* select, int64_t n,
+    double const* T, int64_t ldt,
+    double* VL, int64_t ldvl,
+    double* VR, int64_t ldvr, int64_t mm,
+    int64_t* nfound )
+{
+    internal::StatsScope stats_scope( "dtrevc3" );
+    int64_t lwork;
+    trevc3_work_size(
+        sides, howmany, select, n, T, ldt, VL, ldvl, VR, ldvr, mm, nfound,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return trevc3(
+        sides, howmany, select, n, T, ldt, VL, ldvl, VR, ldvr, mm, nfound,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+void trevc3_work_size(
     lapack::Sides sides, lapack::HowMany howmany,
     bool const* select, int64_t n,
     std::complex<float>* T, int64_t ldt,
     std::complex<float>* VL, int64_t ldvl,
     std::complex<float>* VR, int64_t ldvr, int64_t mm,
-    int64_t* nfound )
+    int64_t* nfound,
+    int64_t* lwork,
+    int64_t* lrwork )
 {
+    internal::StatsScope stats_scope( "ctrevc3" );
+    internal::WorkSizeKey key( "ctrevc3",
+        { to_char( sides ), to_char( howmany ), n, ldt, ldvl, ldvr, mm } );
+    if (internal::work_size_cache_find( key, lwork, lrwork ))
+        return;
+
     char sides_ = to_char( sides );
     char howmany_ = to_char( howmany );
 
     // lapack_logical (32 or 64-bit) copy
-    std::vector< lapack_logical > select_( &select[0], &select[(n)] );
+    lapack::vector< lapack_logical > select_( &select[0], &select[(n)] );
     lapack_logical const* select_ptr = &select_[0];
 
     lapack_int n_ = to_lapack_int( n );
@@ -170,6 +297,7 @@ int64_t trevc3(
     std::complex<float> qry_work[1];
     float qry_rwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_ctrevc3(
         &sides_, &howmany_,
         select_ptr, &n_,
@@ -179,15 +307,43 @@ int64_t trevc3(
         (lapack_complex_float*) qry_work, &ineg_one,
         qry_rwork, &ineg_one, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int lrwork_ = real(qry_rwork[0]);
+    *lwork = real(qry_work[0]);
+    *lrwork = real(qry_rwork[0]);
+    internal::work_size_cache_insert( key, *lwork, *lrwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( lrwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+int64_t trevc3(
+    lapack::Sides sides, lapack::HowMany howmany,
+    bool const* select, int64_t n,
+    std::complex<float>* T, int64_t ldt,
+    std::complex<float>* VL, int64_t ldvl,
+    std::complex<float>* VR, int64_t ldvr, int64_t mm,
+    int64_t* nfound,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork )
+{
+    char sides_ = to_char( sides );
+    char howmany_ = to_char( howmany );
+
+    // lapack_logical (32 or 64-bit) copy
+    lapack::vector< lapack_logical > select_( &select[0], &select[(n)] );
+    lapack_logical const* select_ptr = &select_[0];
+
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ldt_ = to_lapack_int( ldt );
+    lapack_int ldvl_ = to_lapack_int( ldvl );
+    lapack_int ldvr_ = to_lapack_int( ldvr );
+    lapack_int mm_ = to_lapack_int( mm );
+    lapack_int nfound_ = 0;  // out
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int lrwork_ = to_lapack_int( lrwork );
+    lapack_int info_ = 0;
 
     LAPACK_ctrevc3(
         &sides_, &howmany_,
@@ -195,8 +351,160 @@ int64_t trevc3(
         (lapack_complex_float*) T, &ldt_,
         (lapack_complex_float*) VL, &ldvl_,
         (lapack_complex_float*) VR, &ldvr_, &mm_, &nfound_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0], &lrwork_, &info_
+        (lapack_complex_float*) work, &lwork_,
+        rwork, &lrwork_, &info_
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *nfound = nfound_;
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+int64_t trevc3(
+    lapack::Sides sides, lapack::HowMany howmany,
+    bool const* select, int64_t n,
+    std::complex<float>* T, int64_t ldt,
+    std::complex<float>* VL, int64_t ldvl,
+    std::complex<float>* VR, int64_t ldvr, int64_t mm,
+    int64_t* nfound )
+{
+    internal::StatsScope stats_scope( "ctrevc3" );
+    int64_t lwork, lrwork;
+    trevc3_work_size(
+        sides, howmany, select, n, T, ldt, VL, ldvl, VR, ldvr, mm, nfound,
+        &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+
+    return trevc3(
+        sides, howmany, select, n, T, ldt, VL, ldvl, VR, ldvr, mm, nfound,
+        &work[0], lwork, &rwork[0], lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::trevc3 with caller-supplied workspace.
+/// Arguments are the same as for lapack::trevc3; the matrices are not
+/// modified. The sizes can be reused for any call of the same shape.
+///
+/// @param[out] lwork
+///     Required length of the work array.
+///
+/// @param[out] lrwork
+///     Required length of the rwork array.
+///
+/// @ingroup geev_computational
+void trevc3_work_size(
+    lapack::Sides sides, lapack::HowMany howmany,
+    bool const* select, int64_t n,
+    std::complex<double>* T, int64_t ldt,
+    std::complex<double>* VL, int64_t ldvl,
+    std::complex<double>* VR, int64_t ldvr, int64_t mm,
+    int64_t* nfound,
+    int64_t* lwork,
+    int64_t* lrwork )
+{
+    internal::StatsScope stats_scope( "ztrevc3" );
+    internal::WorkSizeKey key( "ztrevc3",
+        { to_char( sides ), to_char( howmany ), n, ldt, ldvl, ldvr, mm } );
+    if (internal::work_size_cache_find( key, lwork, lrwork ))
+        return;
+
+    char sides_ = to_char( sides );
+    char howmany_ = to_char( howmany );
+
+    // lapack_logical (32 or 64-bit) copy
+    lapack::vector< lapack_logical > select_( &select[0], &select[(n)] );
+    lapack_logical const* select_ptr = &select_[0];
+
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ldt_ = to_lapack_int( ldt );
+    lapack_int ldvl_ = to_lapack_int( ldvl );
+    lapack_int ldvr_ = to_lapack_int( ldvr );
+    lapack_int mm_ = to_lapack_int( mm );
+    lapack_int nfound_ = 0;  // out
+    lapack_int info_ = 0;
+
+    // query for workspace size
+    std::complex<double> qry_work[1];
+    double qry_rwork[1];
+    lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
+    LAPACK_ztrevc3(
+        &sides_, &howmany_,
+        select_ptr, &n_,
+        (lapack_complex_double*) T, &ldt_,
+        (lapack_complex_double*) VL, &ldvl_,
+        (lapack_complex_double*) VR, &ldvr_, &mm_, &nfound_,
+        (lapack_complex_double*) qry_work, &ineg_one,
+        qry_rwork, &ineg_one, &info_
+    );
+    query_timer.stop();
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = real(qry_work[0]);
+    *lrwork = real(qry_rwork[0]);
+    internal::work_size_cache_insert( key, *lwork, *lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of lapack::trevc3 with caller-supplied workspace, which
+/// skips the internal workspace query and allocation. Other arguments
+/// are the same as for lapack::trevc3.
+///
+/// @param[out] work
+///     Workspace of length lwork.
+///
+/// @param[in] lwork
+///     Length of work, at least as returned by lapack::trevc3_work_size.
+///
+/// @param[out] rwork
+///     Workspace of length lrwork.
+///
+/// @param[in] lrwork
+///     Length of rwork, at least as returned by lapack::trevc3_work_size.
+///
+/// @ingroup geev_computational
+int64_t trevc3(
+    lapack::Sides sides, lapack::HowMany howmany,
+    bool const* select, int64_t n,
+    std::complex<double>* T, int64_t ldt,
+    std::complex<double>* VL, int64_t ldvl,
+    std::complex<double>* VR, int64_t ldvr, int64_t mm,
+    int64_t* nfound,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork )
+{
+    char sides_ = to_char( sides );
+    char howmany_ = to_char( howmany );
+
+    // lapack_logical (32 or 64-bit) copy
+    lapack::vector< lapack_logical > select_( &select[0], &select[(n)] );
+    lapack_logical const* select_ptr = &select_[0];
+
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ldt_ = to_lapack_int( ldt );
+    lapack_int ldvl_ = to_lapack_int( ldvl );
+    lapack_int ldvr_ = to_lapack_int( ldvr );
+    lapack_int mm_ = to_lapack_int( mm );
+    lapack_int nfound_ = 0;  // out
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int lrwork_ = to_lapack_int( lrwork );
+    lapack_int info_ = 0;
+
+    LAPACK_ztrevc3(
+        &sides_, &howmany_,
+        select_ptr, &n_,
+        (lapack_complex_double*) T, &ldt_,
+        (lapack_complex_double*) VL, &ldvl_,
+        (lapack_complex_double*) VR, &ldvr_, &mm_, &nfound_,
+        (lapack_complex_double*) work, &lwork_,
+        rwork, &lrwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -339,58 +647,19 @@ int64_t trevc3(
     std::complex<double>* VR, int64_t ldvr, int64_t mm,
     int64_t* nfound )
 {
-    char sides_ = to_char( sides );
-    char howmany_ = to_char( howmany );
-
-    // lapack_logical (32 or 64-bit) copy
-    std::vector< lapack_logical > select_( &select[0], &select[(n)] );
-    lapack_logical const* select_ptr = &select_[0];
-
-    lapack_int n_ = to_lapack_int( n );
-    lapack_int ldt_ = to_lapack_int( ldt );
-    lapack_int ldvl_ = to_lapack_int( ldvl );
-    lapack_int ldvr_ = to_lapack_int( ldvr );
-    lapack_int mm_ = to_lapack_int( mm );
-    lapack_int nfound_ = 0;  // out
-    lapack_int info_ = 0;
-
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    double qry_rwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_ztrevc3(
-        &sides_, &howmany_,
-        select_ptr, &n_,
-        (lapack_complex_double*) T, &ldt_,
-        (lapack_complex_double*) VL, &ldvl_,
-        (lapack_complex_double*) VR, &ldvr_, &mm_, &nfound_,
-        (lapack_complex_double*) qry_work, &ineg_one,
-        qry_rwork, &ineg_one, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int lrwork_ = real(qry_rwork[0]);
+    internal::StatsScope stats_scope( "ztrevc3" );
+    int64_t lwork, lrwork;
+    trevc3_work_size(
+        sides, howmany, select, n, T, ldt, VL, ldvl, VR, ldvr, mm, nfound,
+        &lwork, &lrwork );
 
     // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( lrwork_ );
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< double > rwork( lrwork );
 
-    LAPACK_ztrevc3(
-        &sides_, &howmany_,
-        select_ptr, &n_,
-        (lapack_complex_double*) T, &ldt_,
-        (lapack_complex_double*) VL, &ldvl_,
-        (lapack_complex_double*) VR, &ldvr_, &mm_, &nfound_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0], &lrwork_, &info_
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    *nfound = nfound_;
-    return info_;
+    return trevc3(
+        sides, howmany, select, n, T, ldt, VL, ldvl, VR, ldvr, mm, nfound,
+        &work[0], lwork, &rwork[0], lrwork );
 }
 
 }  // namespace lapack
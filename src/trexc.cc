@@ -24,6 +24,7 @@ int64_t trexc(
     int64_t* ifst,
     int64_t* ilst )
 {
+    internal::StatsScope stats_scope( "strexc" );
     char compq_ = to_char_comp( compq );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldt_ = to_lapack_int( ldt );
@@ -57,6 +58,7 @@ int64_t trexc(
     int64_t* ifst,
     int64_t* ilst )
 {
+    internal::StatsScope stats_scope( "dtrexc" );
     char compq_ = to_char_comp( compq );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldt_ = to_lapack_int( ldt );
@@ -25,6 +25,7 @@ int64_t trrfs(
     float* ferr,
     float* berr )
 {
+    internal::StatsScope stats_scope( "strrfs" );
     char uplo_ = to_char( uplo );
     char trans_ = to_char( trans );
     char diag_ = to_char( diag );
@@ -64,6 +65,7 @@ int64_t trrfs(
     double* ferr,
     double* berr )
 {
+    internal::StatsScope stats_scope( "dtrrfs" );
     char uplo_ = to_char( uplo );
     char trans_ = to_char( trans );
     char diag_ = to_char( diag );
@@ -103,6 +105,7 @@ int64_t trrfs(
     float* ferr,
     float* berr )
 {
+    internal::StatsScope stats_scope( "ctrrfs" );
     char uplo_ = to_char( uplo );
     char trans_ = to_char( trans );
     char diag_ = to_char( diag );
@@ -142,6 +145,7 @@ int64_t trrfs(
     double* ferr,
     double* berr )
 {
+    internal::StatsScope stats_scope( "ztrrfs" );
     char uplo_ = to_char( uplo );
     char trans_ = to_char( trans );
     char diag_ = to_char( diag );
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack_internal.hh"
 #include "lapack/fortran.h"
+#include "work_size_cache.hh"
 #include "NoConstructAllocator.hh"
 
 #include <vector>
@@ -17,7 +18,7 @@ using blas::min;
 using blas::real;
 
 // -----------------------------------------------------------------------------
-int64_t trsen(
+void trsen_work_size(
     lapack::Sense sense, lapack::Job compq,
     bool const* select, int64_t n,
     float* T, int64_t ldt,
@@ -25,13 +26,16 @@ int64_t trsen(
     std::complex<float>* W,
     int64_t* nfound,
     float* s,
-    float* sep )
+    float* sep,
+    int64_t* lwork,
+    int64_t* liwork )
 {
+    internal::StatsScope stats_scope( "strsen" );
     char sense_ = to_char( sense );
     char compq_ = to_char_comp( compq );
 
     // lapack_logical (32 or 64-bit) copy
-    std::vector< lapack_logical > select_( &select[0], &select[(n)] );
+    lapack::vector< lapack_logical > select_( &select[0], &select[(n)] );
     lapack_logical const* select_ptr = &select_[0];
 
     lapack_int n_ = to_lapack_int( n );
@@ -48,6 +52,7 @@ int64_t trsen(
     float qry_work[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_strsen(
         &sense_, &compq_,
         select_ptr, &n_,
@@ -59,15 +64,45 @@ int64_t trsen(
         qry_work, &ineg_one,
         qry_iwork, &ineg_one, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    *lwork = real(qry_work[0]);
+    *liwork = real(qry_iwork[0]);
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+// -----------------------------------------------------------------------------
+int64_t trsen(
+    lapack::Sense sense, lapack::Job compq,
+    bool const* select, int64_t n,
+    float* T, int64_t ldt,
+    float* Q, int64_t ldq,
+    std::complex<float>* W,
+    int64_t* nfound,
+    float* s,
+    float* sep,
+    float* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    char sense_ = to_char( sense );
+    char compq_ = to_char_comp( compq );
+
+    // lapack_logical (32 or 64-bit) copy
+    lapack::vector< lapack_logical > select_( &select[0], &select[(n)] );
+    lapack_logical const* select_ptr = &select_[0];
+
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ldt_ = to_lapack_int( ldt );
+    lapack_int ldq_ = to_lapack_int( ldq );
+    lapack_int nfound_ = 0;  // out
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int liwork_ = to_lapack_int( liwork );
+    lapack_int info_ = 0;
+
+    // split-complex representation
+    lapack::vector< float > WR( max( 1, n ) );
+    lapack::vector< float > WI( max( 1, n ) );
 
     LAPACK_strsen(
         &sense_, &compq_,
@@ -77,8 +112,8 @@ int64_t trsen(
         &WR[0],
         &WI[0],
         &nfound_, s, sep,
-        &work[0], &lwork_,
-        &iwork[0], &liwork_, &info_
+        work, &lwork_,
+        iwork, &liwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -93,6 +128,32 @@ int64_t trsen(
 
 // -----------------------------------------------------------------------------
 int64_t trsen(
+    lapack::Sense sense, lapack::Job compq,
+    bool const* select, int64_t n,
+    float* T, int64_t ldt,
+    float* Q, int64_t ldq,
+    std::complex<float>* W,
+    int64_t* nfound,
+    float* s,
+    float* sep )
+{
+    internal::StatsScope stats_scope( "strsen" );
+    int64_t lwork, liwork;
+    trsen_work_size(
+        sense, compq, select, n, T, ldt, Q, ldq, W, nfound, s, sep,
+        &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return trsen(
+        sense, compq, select, n, T, ldt, Q, ldq, W, nfound, s, sep,
+        &work[0], lwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+void trsen_work_size(
     lapack::Sense sense, lapack::Job compq,
     bool const* select, int64_t n,
     double* T, int64_t ldt,
@@ -100,13 +161,16 @@ int64_t trsen(
     std::complex<double>* W,
     int64_t* nfound,
     double* s,
-    double* sep )
+    double* sep,
+    int64_t* lwork,
+    int64_t* liwork )
 {
+    internal::StatsScope stats_scope( "dtrsen" );
     char sense_ = to_char( sense );
     char compq_ = to_char_comp( compq );
 
     // lapack_logical (32 or 64-bit) copy
-    std::vector< lapack_logical > select_( &select[0], &select[(n)] );
+    lapack::vector< lapack_logical > select_( &select[0], &select[(n)] );
     lapack_logical const* select_ptr = &select_[0];
 
     lapack_int n_ = to_lapack_int( n );
@@ -123,6 +187,7 @@ int64_t trsen(
     double qry_work[1];
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_dtrsen(
         &sense_, &compq_,
         select_ptr, &n_,
@@ -134,15 +199,45 @@ int64_t trsen(
         qry_work, &ineg_one,
         qry_iwork, &ineg_one, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    *lwork = real(qry_work[0]);
+    *liwork = real(qry_iwork[0]);
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+// -----------------------------------------------------------------------------
+int64_t trsen(
+    lapack::Sense sense, lapack::Job compq,
+    bool const* select, int64_t n,
+    double* T, int64_t ldt,
+    double* Q, int64_t ldq,
+    std::complex<double>* W,
+    int64_t* nfound,
+    double* s,
+    double* sep,
+    double* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    char sense_ = to_char( sense );
+    char compq_ = to_char_comp( compq );
+
+    // lapack_logical (32 or 64-bit) copy
+    lapack::vector< lapack_logical > select_( &select[0], &select[(n)] );
+    lapack_logical const* select_ptr = &select_[0];
+
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ldt_ = to_lapack_int( ldt );
+    lapack_int ldq_ = to_lapack_int( ldq );
+    lapack_int nfound_ = 0;  // out
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int liwork_ = to_lapack_int( liwork );
+    lapack_int info_ = 0;
+
+    // split-complex representation
+    lapack::vector< double > WR( max( 1, n ) );
+    lapack::vector< double > WI( max( 1, n ) );
 
     LAPACK_dtrsen(
         &sense_, &compq_,
@@ -152,8 +247,8 @@ int64_t trsen(
         &WR[0],
         &WI[0],
         &nfound_, s, sep,
-        &work[0], &lwork_,
-        &iwork[0], &liwork_, &info_
+        work, &lwork_,
+        iwork, &liwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -168,6 +263,32 @@ int64_t trsen(
 
 // -----------------------------------------------------------------------------
 int64_t trsen(
+    lapack::Sense sense, lapack::Job compq,
+    bool const* select, int64_t n,
+    double* T, int64_t ldt,
+    double* Q, int64_t ldq,
+    std::complex<double>* W,
+    int64_t* nfound,
+    double* s,
+    double* sep )
+{
+    internal::StatsScope stats_scope( "dtrsen" );
+    int64_t lwork, liwork;
+    trsen_work_size(
+        sense, compq, select, n, T, ldt, Q, ldq, W, nfound, s, sep,
+        &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return trsen(
+        sense, compq, select, n, T, ldt, Q, ldq, W, nfound, s, sep,
+        &work[0], lwork, &iwork[0], liwork );
+}
+
+// -----------------------------------------------------------------------------
+void trsen_work_size(
     lapack::Sense sense, lapack::Job compq,
     bool const* select, int64_t n,
     std::complex<float>* T, int64_t ldt,
@@ -175,13 +296,15 @@ int64_t trsen(
     std::complex<float>* W,
     int64_t* nfound,
     float* s,
-    float* sep )
+    float* sep,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "ctrsen" );
     char sense_ = to_char( sense );
     char compq_ = to_char_comp( compq );
 
     // lapack_logical (32 or 64-bit) copy
-    std::vector< lapack_logical > select_( &select[0], &select[(n)] );
+    lapack::vector< lapack_logical > select_( &select[0], &select[(n)] );
     lapack_logical const* select_ptr = &select_[0];
 
     lapack_int n_ = to_lapack_int( n );
@@ -193,6 +316,7 @@ int64_t trsen(
     // query for workspace size
     std::complex<float> qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_ctrsen(
         &sense_, &compq_,
         select_ptr, &n_,
@@ -201,13 +325,38 @@ int64_t trsen(
         (lapack_complex_float*) W, &nfound_, s, sep,
         (lapack_complex_float*) qry_work, &ineg_one, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+// -----------------------------------------------------------------------------
+int64_t trsen(
+    lapack::Sense sense, lapack::Job compq,
+    bool const* select, int64_t n,
+    std::complex<float>* T, int64_t ldt,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* W,
+    int64_t* nfound,
+    float* s,
+    float* sep,
+    std::complex<float>* work, int64_t lwork )
+{
+    char sense_ = to_char( sense );
+    char compq_ = to_char_comp( compq );
+
+    // lapack_logical (32 or 64-bit) copy
+    lapack::vector< lapack_logical > select_( &select[0], &select[(n)] );
+    lapack_logical const* select_ptr = &select_[0];
+
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ldt_ = to_lapack_int( ldt );
+    lapack_int ldq_ = to_lapack_int( ldq );
+    lapack_int nfound_ = 0;  // out
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_ctrsen(
         &sense_, &compq_,
@@ -215,7 +364,7 @@ int64_t trsen(
         (lapack_complex_float*) T, &ldt_,
         (lapack_complex_float*) Q, &ldq_,
         (lapack_complex_float*) W, &nfound_, s, sep,
-        (lapack_complex_float*) &work[0], &lwork_, &info_
+        (lapack_complex_float*) work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -226,6 +375,39 @@ int64_t trsen(
 
 // -----------------------------------------------------------------------------
 int64_t trsen(
+    lapack::Sense sense, lapack::Job compq,
+    bool const* select, int64_t n,
+    std::complex<float>* T, int64_t ldt,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* W,
+    int64_t* nfound,
+    float* s,
+    float* sep )
+{
+    internal::StatsScope stats_scope( "ctrsen" );
+    int64_t lwork;
+    trsen_work_size(
+        sense, compq, select, n, T, ldt, Q, ldq, W, nfound, s, sep,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+
+    return trsen(
+        sense, compq, select, n, T, ldt, Q, ldq, W, nfound, s, sep,
+        &work[0], lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Workspace query for lapack::trsen with caller-supplied workspace.
+/// Arguments are the same as for lapack::trsen; the matrices are not
+/// modified. The sizes depend on the number of selected eigenvalues,
+/// so they are not cached.
+///
+/// @param[out] lwork
+///     Required length of the work array.
+///
+void trsen_work_size(
     lapack::Sense sense, lapack::Job compq,
     bool const* select, int64_t n,
     std::complex<double>* T, int64_t ldt,
@@ -233,13 +415,15 @@ int64_t trsen(
     std::complex<double>* W,
     int64_t* nfound,
     double* s,
-    double* sep )
+    double* sep,
+    int64_t* lwork )
 {
+    internal::StatsScope stats_scope( "ztrsen" );
     char sense_ = to_char( sense );
     char compq_ = to_char_comp( compq );
 
     // lapack_logical (32 or 64-bit) copy
-    std::vector< lapack_logical > select_( &select[0], &select[(n)] );
+    lapack::vector< lapack_logical > select_( &select[0], &select[(n)] );
     lapack_logical const* select_ptr = &select_[0];
 
     lapack_int n_ = to_lapack_int( n );
@@ -251,6 +435,7 @@ int64_t trsen(
     // query for workspace size
     std::complex<double> qry_work[1];
     lapack_int ineg_one = -1;
+    internal::StatsQueryTimer query_timer;
     LAPACK_ztrsen(
         &sense_, &compq_,
         select_ptr, &n_,
@@ -259,13 +444,48 @@ int64_t trsen(
         (lapack_complex_double*) W, &nfound_, s, sep,
         (lapack_complex_double*) qry_work, &ineg_one, &info_
     );
+    query_timer.stop();
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = real(qry_work[0]);
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// Variant of lapack::trsen with caller-supplied workspace, which
+/// skips the internal workspace query and allocation. Other arguments
+/// are the same as for lapack::trsen.
+///
+/// @param[out] work
+///     Workspace of length lwork.
+///
+/// @param[in] lwork
+///     Length of work, at least as returned by lapack::trsen_work_size.
+///
+int64_t trsen(
+    lapack::Sense sense, lapack::Job compq,
+    bool const* select, int64_t n,
+    std::complex<double>* T, int64_t ldt,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* W,
+    int64_t* nfound,
+    double* s,
+    double* sep,
+    std::complex<double>* work, int64_t lwork )
+{
+    char sense_ = to_char( sense );
+    char compq_ = to_char_comp( compq );
+
+    // lapack_logical (32 or 64-bit) copy
+    lapack::vector< lapack_logical > select_( &select[0], &select[(n)] );
+    lapack_logical const* select_ptr = &select_[0];
+
+    lapack_int n_ = to_lapack_int( n );
+    lapack_int ldt_ = to_lapack_int( ldt );
+    lapack_int ldq_ = to_lapack_int( ldq );
+    lapack_int nfound_ = 0;  // out
+    lapack_int lwork_ = to_lapack_int( lwork );
+    lapack_int info_ = 0;
 
     LAPACK_ztrsen(
         &sense_, &compq_,
@@ -273,7 +493,7 @@ int64_t trsen(
         (lapack_complex_double*) T, &ldt_,
         (lapack_complex_double*) Q, &ldq_,
         (lapack_complex_double*) W, &nfound_, s, sep,
-        (lapack_complex_double*) &work[0], &lwork_, &info_
+        (lapack_complex_double*) work, &lwork_, &info_
     );
     if (info_ < 0) {
         throw Error();
@@ -282,4 +502,29 @@ int64_t trsen(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+int64_t trsen(
+    lapack::Sense sense, lapack::Job compq,
+    bool const* select, int64_t n,
+    std::complex<double>* T, int64_t ldt,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* W,
+    int64_t* nfound,
+    double* s,
+    double* sep )
+{
+    internal::StatsScope stats_scope( "ztrsen" );
+    int64_t lwork;
+    trsen_work_size(
+        sense, compq, select, n, T, ldt, Q, ldq, W, nfound, s, sep,
+        &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+
+    return trsen(
+        sense, compq, select, n, T, ldt, Q, ldq, W, nfound, s, sep,
+        &work[0], lwork );
+}
+
 }  // namespace lapack
@@ -23,6 +23,7 @@ int64_t upgtr(
     std::complex<float> const* tau,
     std::complex<float>* Q, int64_t ldq )
 {
+    internal::StatsScope stats_scope( "cupgtr" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldq_ = to_lapack_int( ldq );
@@ -51,6 +52,7 @@ int64_t upgtr(
     std::complex<double> const* tau,
     std::complex<double>* Q, int64_t ldq )
 {
+    internal::StatsScope stats_scope( "zupgtr" );
     char uplo_ = to_char( uplo );
     lapack_int n_ = to_lapack_int( n );
     lapack_int ldq_ = to_lapack_int( ldq );
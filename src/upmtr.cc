@@ -24,6 +24,7 @@ int64_t upmtr(
     std::complex<float> const* tau,
     std::complex<float>* C, int64_t ldc )
 {
+    internal::StatsScope stats_scope( "cupmtr" );
     char side_ = to_char( side );
     char uplo_ = to_char( uplo );
     char trans_ = to_char( trans );
@@ -122,6 +123,7 @@ int64_t upmtr(
     std::complex<double> const* tau,
     std::complex<double>* C, int64_t ldc )
 {
+    internal::StatsScope stats_scope( "zupmtr" );
     char side_ = to_char( side );
     char uplo_ = to_char( uplo );
     char trans_ = to_char( trans );
@@ -0,0 +1,185 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/workspace.hh"
+#include "work_size_cache.hh"
+
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace lapack {
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+struct WorkSizeKeyHash
+{
+    std::size_t operator () ( WorkSizeKey const& key ) const
+    {
+        // FNV-1a over routine name and arguments.
+        uint64_t hash = 14695981039346656037ull;
+        for (const char* c = key.routine; *c != '\0'; ++c) {
+            hash = (hash ^ uint64_t( *c )) * 1099511628211ull;
+        }
+        for (int i = 0; i < key.nargs; ++i) {
+            hash = (hash ^ uint64_t( key.args[ i ] )) * 1099511628211ull;
+        }
+        return std::size_t( hash );
+    }
+};
+
+struct WorkSize
+{
+    int64_t lwork, lrwork, liwork;
+};
+
+//------------------------------------------------------------------------------
+// Process-wide cache of workspace queries. Lookups take a shared lock, so
+// concurrent hits do not serialize. To bound memory, the cache is simply
+// cleared when it reaches max_entries; typical applications use far fewer
+// distinct shapes.
+class WorkSizeCache
+{
+public:
+    static constexpr std::size_t max_entries = 4096;
+
+    bool find( WorkSizeKey const& key, WorkSize* size )
+    {
+        std::shared_lock< std::shared_mutex > lock( mutex_ );
+        auto iter = map_.find( key );
+        if (iter == map_.end()) {
+            ++misses;
+            return false;
+        }
+        *size = iter->second;
+        ++hits;
+        return true;
+    }
+
+    void insert( WorkSizeKey const& key, WorkSize const& size )
+    {
+        std::unique_lock< std::shared_mutex > lock( mutex_ );
+        if (map_.size() >= max_entries)
+            map_.clear();
+        map_[ key ] = size;
+    }
+
+    void clear()
+    {
+        std::unique_lock< std::shared_mutex > lock( mutex_ );
+        map_.clear();
+    }
+
+    std::size_t size()
+    {
+        std::shared_lock< std::shared_mutex > lock( mutex_ );
+        return map_.size();
+    }
+
+    std::atomic< bool > enabled { false };
+    std::atomic< int64_t > hits { 0 };
+    std::atomic< int64_t > misses { 0 };
+
+private:
+    std::shared_mutex mutex_;
+    std::unordered_map< WorkSizeKey, WorkSize, WorkSizeKeyHash > map_;
+};
+
+WorkSizeCache s_work_size_cache;
+
+//------------------------------------------------------------------------------
+bool work_size_cache_find(
+    WorkSizeKey const& key,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork )
+{
+    if (! s_work_size_cache.enabled.load( std::memory_order_relaxed ))
+        return false;
+
+    WorkSize size;
+    if (! s_work_size_cache.find( key, &size ))
+        return false;
+
+    if (lwork)
+        *lwork = size.lwork;
+    if (lrwork)
+        *lrwork = size.lrwork;
+    if (liwork)
+        *liwork = size.liwork;
+    return true;
+}
+
+//------------------------------------------------------------------------------
+void work_size_cache_insert(
+    WorkSizeKey const& key,
+    int64_t lwork, int64_t lrwork, int64_t liwork )
+{
+    if (! s_work_size_cache.enabled.load( std::memory_order_relaxed ))
+        return;
+
+    s_work_size_cache.insert( key, { lwork, lrwork, liwork } );
+}
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+/// Enables or disables the process-wide workspace-size cache.
+/// While enabled, *_work_size routines, and the wrappers that call them,
+/// remember the result of LAPACK's workspace query (lwork = -1) for each
+/// routine, job flags, and dimensions, and skip the query on later calls
+/// with the same arguments. Disabling keeps cached entries and counters;
+/// use work_size_cache_clear to discard them.
+///
+void work_size_cache_enable( bool enable )
+{
+    internal::s_work_size_cache.enabled = enable;
+}
+
+//------------------------------------------------------------------------------
+/// @return true if the workspace-size cache is enabled.
+///
+bool work_size_cache_enabled()
+{
+    return internal::s_work_size_cache.enabled;
+}
+
+//------------------------------------------------------------------------------
+/// Discards all cached workspace sizes and resets hit and miss counters.
+///
+void work_size_cache_clear()
+{
+    internal::s_work_size_cache.clear();
+    internal::s_work_size_cache.hits = 0;
+    internal::s_work_size_cache.misses = 0;
+}
+
+//------------------------------------------------------------------------------
+/// @return number of workspace queries answered from the cache
+/// since the last work_size_cache_clear.
+///
+int64_t work_size_cache_hits()
+{
+    return internal::s_work_size_cache.hits;
+}
+
+//------------------------------------------------------------------------------
+/// @return number of workspace queries that had to call LAPACK, while the
+/// cache was enabled, since the last work_size_cache_clear.
+///
+int64_t work_size_cache_misses()
+{
+    return internal::s_work_size_cache.misses;
+}
+
+//------------------------------------------------------------------------------
+/// @return number of entries currently in the workspace-size cache.
+///
+std::size_t work_size_cache_size()
+{
+    return internal::s_work_size_cache.size();
+}
+
+}  // namespace lapack
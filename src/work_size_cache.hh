@@ -0,0 +1,65 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_WORK_SIZE_CACHE_HH
+#define LAPACK_WORK_SIZE_CACHE_HH
+
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+
+namespace lapack {
+namespace internal {
+
+//------------------------------------------------------------------------------
+/// Key for the workspace-size cache: the Fortran routine name, which encodes
+/// the precision (e.g., "dgesdd"), followed by the job flags and dimensions
+/// that determine the workspace size. Pointer arguments are not part of the
+/// key, as LAPACK's workspace queries do not read the matrices.
+struct WorkSizeKey
+{
+    static constexpr int max_args = 12;
+
+    WorkSizeKey( const char* routine_, std::initializer_list< int64_t > args_ )
+        : routine( routine_ ),
+          nargs( 0 )
+    {
+        for (int64_t arg : args_) {
+            if (nargs < max_args)
+                args[ nargs++ ] = arg;
+        }
+    }
+
+    bool operator == ( WorkSizeKey const& other ) const
+    {
+        if (nargs != other.nargs || std::strcmp( routine, other.routine ) != 0)
+            return false;
+        for (int i = 0; i < nargs; ++i) {
+            if (args[ i ] != other.args[ i ])
+                return false;
+        }
+        return true;
+    }
+
+    const char* routine;  ///< string literal, e.g., "zheevr"
+    int64_t args[ max_args ];
+    int nargs;
+};
+
+/// Looks up key; on a hit, sets lwork, lrwork, liwork (those not null)
+/// and returns true. Returns false on a miss or if the cache is disabled.
+bool work_size_cache_find(
+    WorkSizeKey const& key,
+    int64_t* lwork, int64_t* lrwork=nullptr, int64_t* liwork=nullptr );
+
+/// Saves result of a workspace query for key, if the cache is enabled.
+void work_size_cache_insert(
+    WorkSizeKey const& key,
+    int64_t lwork, int64_t lrwork=0, int64_t liwork=0 );
+
+}  // namespace internal
+}  // namespace lapack
+
+#endif // LAPACK_WORK_SIZE_CACHE_HH
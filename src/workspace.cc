@@ -0,0 +1,534 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/workspace.hh"
+#include "lapack_internal.hh"
+#include "NoConstructAllocator.hh"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <vector>
+
+#if defined( _WIN32 ) || defined( _WIN64 )
+#   include <malloc.h>  // _aligned_malloc, _aligned_free
+#else
+#   include <stdlib.h>  // posix_memalign, free
+#   include <sys/mman.h>  // mmap, munmap, madvise
+#   define LAPACK_HAVE_MMAP
+#endif
+
+#if defined( __linux__ ) && defined( __has_include )
+#   if __has_include( <linux/mempolicy.h> ) && __has_include( <sys/syscall.h> )
+#       include <linux/mempolicy.h>  // MPOL_PREFERRED
+#       include <sys/syscall.h>      // SYS_mbind
+#       include <unistd.h>           // syscall
+#       define LAPACK_HAVE_MBIND
+#   endif
+#endif
+
+namespace lapack {
+
+namespace internal {
+
+static constexpr std::size_t min_alignment  = 64;
+static constexpr std::size_t page_size      = 4096;
+static constexpr std::size_t huge_page_size = 2*1024*1024;
+
+//------------------------------------------------------------------------------
+// Process-wide allocation options; see set_workspace_alignment, etc.
+std::atomic< std::size_t > s_alignment { min_alignment };
+std::atomic< std::size_t > s_huge_page_threshold { 0 };
+std::atomic< int >  s_numa_node { -1 };
+std::atomic< bool > s_first_touch { false };
+
+//------------------------------------------------------------------------------
+static std::size_t roundup( std::size_t bytes, std::size_t align )
+{
+    return (bytes + align - 1) / align * align;
+}
+
+//------------------------------------------------------------------------------
+static char* align_ptr( char* ptr, std::size_t align )
+{
+    return reinterpret_cast<char*>(
+        roundup( reinterpret_cast<std::uintptr_t>( ptr ), align ) );
+}
+
+//------------------------------------------------------------------------------
+// Allocates aligned memory from the heap; throws on failure.
+static void* aligned_malloc( std::size_t bytes, std::size_t align )
+{
+    void* memPtr = nullptr;
+    #if defined( _WIN32 ) || defined( _WIN64 )
+        memPtr = _aligned_malloc( bytes, align );
+        if (memPtr != nullptr)
+            return memPtr;
+    #else
+        int err = posix_memalign( &memPtr, align, bytes );
+        if (err == 0)
+            return memPtr;
+    #endif
+
+    throw std::bad_alloc();
+}
+
+//------------------------------------------------------------------------------
+static void aligned_free( void* ptr ) noexcept
+{
+    #if defined( _WIN32 ) || defined( _WIN64 )
+        _aligned_free( ptr );
+    #else
+        free( ptr );
+    #endif
+}
+
+#ifdef LAPACK_HAVE_MMAP
+//------------------------------------------------------------------------------
+// Maps bytes (a multiple of huge_page_size) aligned to huge-page or larger
+// boundary, so transparent huge pages can back the whole range.
+// Then applies NUMA placement options. Throws on failure.
+static void* huge_page_map( std::size_t bytes, std::size_t align )
+{
+    std::size_t map_align = std::max( align, huge_page_size );
+    std::size_t map_bytes = bytes + map_align;
+    void* raw_ptr = mmap( nullptr, map_bytes, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+    if (raw_ptr == MAP_FAILED)
+        throw std::bad_alloc();
+
+    // Trim the unaligned head and unused tail.
+    char* raw  = static_cast<char*>( raw_ptr );
+    char* base = align_ptr( raw, map_align );
+    if (base > raw)
+        munmap( raw, base - raw );
+    std::size_t tail = (raw + map_bytes) - (base + bytes);
+    if (tail > 0)
+        munmap( base + bytes, tail );
+
+    // Hints are best-effort; failures are ignored.
+    #ifdef MADV_HUGEPAGE
+        madvise( base, bytes, MADV_HUGEPAGE );
+    #endif
+
+    #ifdef LAPACK_HAVE_MBIND
+        int node = s_numa_node;
+        if (node >= 0 && node < 1024) {
+            constexpr int bits = 8 * sizeof( unsigned long );
+            unsigned long nodemask[ 1024 / bits ] = {};
+            nodemask[ node / bits ] = 1ul << (node % bits);
+            syscall( SYS_mbind, base, bytes, MPOL_PREFERRED,
+                     nodemask, 1024 + 1, 0 );
+        }
+    #endif
+
+    // Fault in pages from the calling thread, so first-touch policy
+    // places them on its NUMA node (or the node set above).
+    if (s_first_touch) {
+        for (std::size_t i = 0; i < bytes; i += page_size)
+            base[ i ] = 0;
+    }
+    return base;
+}
+#endif
+
+//------------------------------------------------------------------------------
+// Memory from the system, either the heap or, above the huge-page
+// threshold, mmap. bytes is rounded up as needed and updated.
+struct SystemBlock
+{
+    void* allocate( std::size_t* bytes, std::size_t align )
+    {
+        #ifdef LAPACK_HAVE_MMAP
+            std::size_t threshold = s_huge_page_threshold;
+            mapped = (threshold > 0 && *bytes >= threshold);
+            if (mapped) {
+                *bytes = roundup( *bytes, huge_page_size );
+                return huge_page_map( *bytes, align );
+            }
+        #endif
+        return aligned_malloc( *bytes, align );
+    }
+
+    void free( void* ptr, std::size_t bytes ) noexcept
+    {
+        #ifdef LAPACK_HAVE_MMAP
+            if (mapped) {
+                munmap( ptr, bytes );
+                return;
+            }
+        #endif
+        aligned_free( ptr );
+    }
+
+    bool mapped = false;
+};
+
+//------------------------------------------------------------------------------
+// Bump allocator backing lapack::vector when enabled. Memory is kept in a
+// list of blocks; when all temporaries have been released, multiple blocks
+// are coalesced into one, so after warm-up a single block serves every call.
+class WorkspaceArena
+{
+public:
+    ~WorkspaceArena()
+    {
+        release();
+    }
+
+    void* allocate( std::size_t bytes )
+    {
+        std::size_t align = s_alignment;
+        bytes = roundup( bytes, min_alignment );
+        char* ptr = nullptr;
+        if (! blocks_.empty()) {
+            Block& block = blocks_.back();
+            ptr = align_ptr( block.data + used_, align );
+            if (ptr + bytes > block.data + block.size)
+                ptr = nullptr;
+        }
+        if (ptr == nullptr) {
+            // New block at least doubles capacity, to amortize growth.
+            grow( std::max( bytes, capacity() ), align );
+            ptr = blocks_.back().data;
+        }
+        std::size_t used = (ptr + bytes) - blocks_.back().data;
+        in_use_ += used - used_;
+        used_ = used;
+        high_water_ = std::max( high_water_, in_use_ );
+        ++live_;
+        return ptr;
+    }
+
+    // Returns true if ptr came from the arena.
+    bool deallocate( void* ptr )
+    {
+        if (live_ == 0 || ! contains( ptr ))
+            return false;
+
+        --live_;
+        if (live_ == 0)
+            reset();
+        return true;
+    }
+
+    void trim()
+    {
+        if (live_ == 0) {
+            release();
+            high_water_ = 0;
+        }
+    }
+
+    std::size_t capacity() const
+    {
+        std::size_t total = 0;
+        for (auto const& block : blocks_)
+            total += block.size;
+        return total;
+    }
+
+    std::size_t high_water() const { return high_water_; }
+
+    bool enabled = false;
+
+private:
+    struct Block {
+        char* data;
+        std::size_t size;
+        std::size_t align;
+        SystemBlock system;
+    };
+
+    bool contains( void* ptr ) const
+    {
+        char* p = static_cast<char*>( ptr );
+        for (auto const& block : blocks_) {
+            if (block.data <= p && p < block.data + block.size)
+                return true;
+        }
+        return false;
+    }
+
+    void grow( std::size_t bytes, std::size_t align )
+    {
+        SystemBlock system;
+        char* data = static_cast<char*>( system.allocate( &bytes, align ) );
+        blocks_.push_back( { data, bytes, align, system } );
+        used_ = 0;
+    }
+
+    // Rewind to empty; coalesce blocks so the next call fits in one.
+    void reset()
+    {
+        if (blocks_.size() > 1) {
+            std::size_t total = capacity();
+            std::size_t align = blocks_.back().align;
+            release();
+            grow( total, align );
+        }
+        used_ = 0;
+        in_use_ = 0;
+    }
+
+    void release()
+    {
+        for (auto& block : blocks_)
+            block.system.free( block.data, block.size );
+        blocks_.clear();
+        used_ = 0;
+        in_use_ = 0;
+    }
+
+    std::vector<Block> blocks_;
+    std::size_t used_       = 0;  ///< bytes used in last block
+    std::size_t in_use_     = 0;  ///< bytes handed out since last reset,
+                                  ///< including alignment padding
+    std::size_t high_water_ = 0;
+    int64_t     live_       = 0;  ///< number of outstanding allocations
+};
+
+thread_local WorkspaceArena s_arena;
+
+//------------------------------------------------------------------------------
+// Memory resources. A thread's guard, if any, overrides the process-wide
+// resource; nullptr means the built-in aligned heap allocation.
+std::atomic< std::pmr::memory_resource* > s_resource { nullptr };
+thread_local std::pmr::memory_resource* s_thread_resource = nullptr;
+thread_local bool s_thread_resource_set = false;
+
+//------------------------------------------------------------------------------
+// Allocations outside the arena are preceded by a header recording where
+// they came from, so they are released correctly even if the resource or
+// options change between allocation and deallocation. The user pointer is
+// one alignment unit past the base, which leaves room for the header.
+struct AllocHeader
+{
+    std::pmr::memory_resource* resource;
+    void* base;
+    std::size_t bytes;  ///< total, including header
+    std::size_t align;
+    SystemBlock system;
+};
+
+static_assert( sizeof( AllocHeader ) <= min_alignment, "header too big" );
+
+//------------------------------------------------------------------------------
+void* workspace_allocate( std::size_t bytes )
+{
+    stats_record_alloc( bytes );
+
+    if (s_arena.enabled)
+        return s_arena.allocate( bytes );
+
+    std::pmr::memory_resource* resource = get_memory_resource();
+    std::size_t align = s_alignment;
+    std::size_t total = bytes + align;
+    if (total < bytes)
+        throw std::bad_alloc();
+
+    AllocHeader header { resource, nullptr, total, align, SystemBlock() };
+    if (resource)
+        header.base = resource->allocate( total, align );
+    else
+        header.base = header.system.allocate( &header.bytes, align );
+
+    char* ptr = static_cast<char*>( header.base ) + align;
+    new( ptr - sizeof( AllocHeader ) ) AllocHeader( header );
+    return ptr;
+}
+
+//------------------------------------------------------------------------------
+void workspace_deallocate( void* ptr ) noexcept
+{
+    if (ptr == nullptr || s_arena.deallocate( ptr ))
+        return;
+
+    AllocHeader header
+        = *reinterpret_cast<AllocHeader*>(
+            static_cast<char*>( ptr ) - sizeof( AllocHeader ) );
+    if (header.resource)
+        header.resource->deallocate( header.base, header.bytes, header.align );
+    else
+        header.system.free( header.base, header.bytes );
+}
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+/// Enables or disables the workspace arena for the calling thread.
+/// While enabled, temporary workspaces inside LAPACK++ wrappers are
+/// taken from a per-thread bump allocator instead of the heap.
+/// Disabling keeps the arena's memory; use workspace_arena_trim to free it.
+///
+void workspace_arena_enable( bool enable )
+{
+    internal::s_arena.enabled = enable;
+}
+
+//------------------------------------------------------------------------------
+/// @return true if the workspace arena is enabled for the calling thread.
+///
+bool workspace_arena_enabled()
+{
+    return internal::s_arena.enabled;
+}
+
+//------------------------------------------------------------------------------
+/// @return largest number of bytes in use at once in the calling thread's
+/// arena, since the thread started or the last workspace_arena_trim.
+///
+std::size_t workspace_arena_high_water()
+{
+    return internal::s_arena.high_water();
+}
+
+//------------------------------------------------------------------------------
+/// @return number of bytes currently reserved by the calling thread's arena.
+///
+std::size_t workspace_arena_capacity()
+{
+    return internal::s_arena.capacity();
+}
+
+//------------------------------------------------------------------------------
+/// Frees memory held by the calling thread's arena and resets its
+/// high-water mark. Does nothing if called while a wrapper on this thread
+/// still holds arena memory.
+///
+void workspace_arena_trim()
+{
+    internal::s_arena.trim();
+}
+
+//------------------------------------------------------------------------------
+/// Sets the process-wide memory resource used for temporary workspaces
+/// inside LAPACK++ wrappers. The resource must outlive all LAPACK++ calls
+/// that use it. Threads with a MemoryResourceGuard, or with the workspace
+/// arena enabled, are not affected.
+///
+/// @param[in] resource
+///     Memory resource, or nullptr to restore the default aligned heap
+///     allocation.
+///
+void set_memory_resource( std::pmr::memory_resource* resource )
+{
+    internal::s_resource = resource;
+}
+
+//------------------------------------------------------------------------------
+/// @return memory resource used for workspaces by the calling thread:
+/// the innermost MemoryResourceGuard's resource if any, else the
+/// process-wide resource. nullptr means the default aligned heap allocation.
+///
+std::pmr::memory_resource* get_memory_resource()
+{
+    if (internal::s_thread_resource_set)
+        return internal::s_thread_resource;
+    return internal::s_resource;
+}
+
+//------------------------------------------------------------------------------
+/// Sets the calling thread's workspace memory resource until the guard is
+/// destroyed, overriding the process-wide resource.
+///
+/// @param[in] resource
+///     Memory resource, or nullptr for the default aligned heap allocation.
+///
+MemoryResourceGuard::MemoryResourceGuard( std::pmr::memory_resource* resource )
+    : prev_resource_( internal::s_thread_resource ),
+      prev_set_( internal::s_thread_resource_set )
+{
+    internal::s_thread_resource = resource;
+    internal::s_thread_resource_set = true;
+}
+
+//------------------------------------------------------------------------------
+/// Restores the calling thread's previous memory resource.
+///
+MemoryResourceGuard::~MemoryResourceGuard()
+{
+    internal::s_thread_resource = prev_resource_;
+    internal::s_thread_resource_set = prev_set_;
+}
+
+//------------------------------------------------------------------------------
+/// Sets the alignment of workspaces allocated inside LAPACK++ wrappers,
+/// including those from a memory resource or the workspace arena.
+/// Applies to allocations made after the call.
+///
+/// @param[in] alignment
+///     Alignment in bytes; a power of 2. Values below 64 are raised to 64.
+///     Default 64.
+///
+void set_workspace_alignment( std::size_t alignment )
+{
+    lapack_error_if( alignment == 0 || (alignment & (alignment - 1)) != 0 );
+    internal::s_alignment = std::max( alignment, internal::min_alignment );
+}
+
+//------------------------------------------------------------------------------
+/// @return alignment in bytes of workspaces; see set_workspace_alignment.
+///
+std::size_t get_workspace_alignment()
+{
+    return internal::s_alignment;
+}
+
+//------------------------------------------------------------------------------
+/// Sets the size above which workspaces are allocated with mmap, aligned
+/// to 2 MiB and advised with madvise( MADV_HUGEPAGE ) so transparent huge
+/// pages back them. This reduces TLB misses for large workspaces, such as
+/// gesdd or hetrd_2stage on large matrices. Applies to the default heap
+/// allocation and to workspace arena blocks, not to memory resources.
+/// Has no effect on platforms without mmap.
+///
+/// @param[in] bytes
+///     Threshold in bytes; 0 disables huge-page allocation. Default 0.
+///
+void set_huge_page_threshold( std::size_t bytes )
+{
+    internal::s_huge_page_threshold = bytes;
+}
+
+//------------------------------------------------------------------------------
+/// @return huge-page threshold in bytes; see set_huge_page_threshold.
+///
+std::size_t get_huge_page_threshold()
+{
+    return internal::s_huge_page_threshold;
+}
+
+//------------------------------------------------------------------------------
+/// Sets NUMA placement for workspaces allocated via huge pages (see
+/// set_huge_page_threshold). On Linux, pages are placed preferably on the
+/// given node using mbind( MPOL_PREFERRED ); elsewhere node is ignored.
+///
+/// @param[in] node
+///     NUMA node, or -1 for the default policy. Default -1.
+///
+/// @param[in] first_touch
+///     If true, pages are faulted in by the allocating thread when
+///     allocated, rather than by whichever thread first writes them.
+///     Default false.
+///
+void set_workspace_numa( int node, bool first_touch )
+{
+    lapack_error_if( node < -1 );
+    internal::s_numa_node = node;
+    internal::s_first_touch = first_touch;
+}
+
+//------------------------------------------------------------------------------
+/// @return NUMA node for huge-page workspaces, or -1;
+/// see set_workspace_numa.
+///
+int get_workspace_numa_node()
+{
+    return internal::s_numa_node;
+}
+
+}  // namespace lapack
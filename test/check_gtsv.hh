@@ -0,0 +1,102 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef CHECK_GTSV_HH
+#define CHECK_GTSV_HH
+
+#include "blas.hh"
+#include "lapack.hh"
+
+#include <algorithm>
+#include <vector>
+
+//------------------------------------------------------------------------------
+// Computes the backward error
+//     || B - op(A) X ||_1 / (n ||A||_1 ||X||_1)
+// for the tridiagonal matrix A = tridiag( DL, D, DU ).
+template< typename scalar_t >
+blas::real_type< scalar_t > check_gtsv(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    scalar_t const* DL, scalar_t const* D, scalar_t const* DU,
+    scalar_t const* X, int64_t ldx,
+    scalar_t const* B, int64_t ldb )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using blas::conj;
+
+    if (n == 0 || nrhs == 0)
+        return 0;
+
+    // Sub- and super-diagonals of op(A).
+    bool cj = (trans == lapack::Op::ConjTrans);
+    auto op = [cj]( scalar_t x ) { return cj ? conj( x ) : x; };
+    scalar_t const* sub = (trans == lapack::Op::NoTrans ? DL : DU);
+    scalar_t const* sup = (trans == lapack::Op::NoTrans ? DU : DL);
+
+    real_t Anorm = std::max(
+        lapack::langt( lapack::Norm::One, n, DL, D, DU ),
+        lapack::langt( lapack::Norm::Inf, n, DL, D, DU ) );
+    real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, X, ldx );
+
+    std::vector< scalar_t > R( n );
+    real_t Rnorm = 0;
+    for (int64_t j = 0; j < nrhs; ++j) {
+        scalar_t const* x = &X[ j*ldx ];
+        for (int64_t i = 0; i < n; ++i) {
+            scalar_t ax = op( D[ i ] ) * x[ i ];
+            if (i > 0)
+                ax += op( sub[ i-1 ] ) * x[ i-1 ];
+            if (i < n-1)
+                ax += op( sup[ i ] ) * x[ i+1 ];
+            R[ i ] = B[ i + j*ldb ] - ax;
+        }
+        Rnorm = std::max( Rnorm, blas::asum( n, &R[0], 1 ) );
+    }
+    if (Anorm != 0 && Xnorm != 0)
+        Rnorm /= Anorm * Xnorm;
+    return Rnorm / n;
+}
+
+//------------------------------------------------------------------------------
+// Computes the backward error
+//     || B - A X ||_1 / (n ||A||_1 ||X||_1)
+// for the Hermitian tridiagonal matrix A with diagonal D and
+// sub-diagonal E.
+template< typename scalar_t >
+blas::real_type< scalar_t > check_ptsv(
+    int64_t n, int64_t nrhs,
+    blas::real_type< scalar_t > const* D, scalar_t const* E,
+    scalar_t const* X, int64_t ldx,
+    scalar_t const* B, int64_t ldb )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using blas::conj;
+
+    if (n == 0 || nrhs == 0)
+        return 0;
+
+    real_t Anorm = lapack::lanht( lapack::Norm::One, n, D, E );
+    real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, X, ldx );
+
+    std::vector< scalar_t > R( n );
+    real_t Rnorm = 0;
+    for (int64_t j = 0; j < nrhs; ++j) {
+        scalar_t const* x = &X[ j*ldx ];
+        for (int64_t i = 0; i < n; ++i) {
+            scalar_t ax = D[ i ] * x[ i ];
+            if (i > 0)
+                ax += E[ i-1 ] * x[ i-1 ];
+            if (i < n-1)
+                ax += conj( E[ i ] ) * x[ i+1 ];
+            R[ i ] = B[ i + j*ldb ] - ax;
+        }
+        Rnorm = std::max( Rnorm, blas::asum( n, &R[0], 1 ) );
+    }
+    if (Anorm != 0 && Xnorm != 0)
+        Rnorm /= Anorm * Xnorm;
+    return Rnorm / n;
+}
+
+#endif // CHECK_GTSV_HH
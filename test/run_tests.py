@@ -354,9 +354,15 @@ cmds = []
 if (opts.lu and opts.host):
     cmds += [
     [ 'gesv',  gen + dtype + align + n ],
+    [ 'gesv_mixed', gen + dtype_double + align + n + ' --nrhs 1,10' ],
+    [ 'gesv_mixed', gen + dtype_double + align + n + ' --nrhs 1,10 --gmres y --matrix svd --cond 1e4,1e9' ],
     # todo: equed
     [ 'gesvx', gen + dtype + align + n + factored + trans ],
     [ 'getrf', gen + dtype + align + mn ],
+    [ 'getrf', gen + dtype + align + mn + ' --tiled y --threads 1,4' ],
+    [ 'getrf_batch', gen + dtype + align + ' --dim 8,16,32,64 --batch 1000' ],
+    [ 'getrf_fixed', gen + dtype + align + trans + ' --dim 1,2,3,4,8,16 --nrhs 2 --batch 1000' ],
+    [ 'factor_lu', gen + dtype + align + n + ' --nrhs 1,10,100' ],
     [ 'getrs', gen + dtype + align + n + trans ],
     [ 'getri', gen + dtype + align + n ],
     [ 'gecon', gen + dtype + align + n ],
@@ -374,6 +380,7 @@ if (opts.lu and opts.device):
 if (opts.gb and opts.host):
     cmds += [
     [ 'gbsv',  gen + dtype + align + n  + kl + ku ],
+    [ 'gbsv_parallel', gen + dtype + align + ' --dim 100000,1000000 --kl 2,10 --ku 3,10 --nrhs 1,4 --threads 1,2,4' ],
     [ 'gbtrf', gen + dtype + align + mn + kl + ku ],
     [ 'gbtrs', gen + dtype + align + n  + kl + ku + trans ],
     [ 'gbcon', gen + dtype + align + n  + kl + ku ],
@@ -385,6 +392,8 @@ if (opts.gb and opts.host):
 if (opts.gt and opts.host):
     cmds += [
     [ 'gtsv',  gen + dtype + align + n ],
+    [ 'gtsv_batch', gen + dtype + align + trans + ' --dim 16,64,256 --nrhs 1 --batch 1000 --lanes 0,8' ],
+    [ 'gtsv_parallel', gen + dtype + align + ' --dim 100000,1000000 --nrhs 1,4 --threads 1,2,4' ],
     [ 'gttrf', gen + dtype +         n ],
     [ 'gttrs', gen + dtype + align + n + trans ],
     [ 'gtcon', gen + dtype +         n ],
@@ -395,7 +404,14 @@ if (opts.gt and opts.host):
 if (opts.chol and opts.host):
     cmds += [
     [ 'posv',  gen + dtype + align + n + uplo ],
+    [ 'posv_mixed', gen + dtype_double + align + n + uplo + ' --nrhs 1,10' ],
+    [ 'posv_mixed', gen + dtype_double + align + n + uplo + ' --nrhs 1,10 --gmres y --matrix poev --cond 1e4,1e6' ],
     [ 'potrf', gen + dtype + align + n + uplo ],
+    [ 'potrf', gen + dtype + align + n + uplo + ' --tiled y --threads 1,4' ],
+    [ 'potrf_batch', gen + dtype + align + uplo + ' --dim 4,8,16,32 --nrhs 1 --batch 1000 --lanes 0,8' ],
+    [ 'potrf_fixed', gen + dtype + align + uplo + ' --dim 1,2,3,4,8,16 --nrhs 2 --batch 1000' ],
+    [ 'potrf_update', gen + dtype + align + uplo + ' --dim 100x100x1,200x200x4,500x500x16' ],
+    [ 'factor_cholesky', gen + dtype + align + n + uplo + ' --nrhs 1,10,100' ],
     [ 'potrs', gen + dtype + align + n + uplo ],
     [ 'potri', gen + dtype + align + n + uplo ],
     [ 'pocon', gen + dtype + align + n + uplo ],
@@ -413,6 +429,7 @@ if (opts.chol and opts.host):
 
     # Banded
     [ 'pbsv',  gen + dtype + align + n + kd + uplo ],
+    [ 'pbsv_parallel', gen + dtype + align + uplo + ' --dim 100000,1000000 --kd 2,10 --nrhs 1,4 --threads 1,2,4' ],
     [ 'pbtrf', gen + dtype + align + n + kd + uplo ],
     [ 'pbtrs', gen + dtype + align + n + kd + uplo ],
     [ 'pbcon', gen + dtype + align + n + kd + uplo ],
@@ -421,6 +438,8 @@ if (opts.chol and opts.host):
 
     # Tri-diagonal
     [ 'ptsv',  gen + dtype + align + n ],
+    [ 'ptsv_batch', gen + dtype + align + uplo + ' --dim 16,64,256 --nrhs 1 --batch 1000 --lanes 0,8' ],
+    [ 'ptsv_parallel', gen + dtype + align + ' --dim 100000,1000000 --nrhs 1,4 --threads 1,2,4' ],
     [ 'pttrf', gen + dtype         + n ],
     [ 'pttrs', gen + dtype + align + n + uplo ],
     [ 'ptcon', gen + dtype         + n ],
@@ -487,6 +506,7 @@ if (opts.hesv and opts.host):
     cmds += [
     [ 'hesv',  gen + dtype + align + n + uplo ],
     [ 'hetrf', gen + dtype + align + n + uplo ],
+    [ 'factor_ldlt', gen + dtype + align + n + uplo + ' --nrhs 1,10,100' ],
     [ 'hetrs', gen + dtype + align + n + uplo ],
     [ 'hetri', gen + dtype + align + n + uplo ],
     [ 'hecon', gen + dtype + align + n + uplo ],
@@ -505,11 +525,13 @@ if (opts.hesv and opts.host):
 if (opts.least_squares and opts.host):
     cmds += [
     [ 'gels',   gen + dtype + align + mn + trans_nc ],
+    [ 'gels_mixed', gen + dtype_double + align + tall + ' --nrhs 1,10' ],
     [ 'gelsy',  gen + dtype + align + mn ],
     # todo: gelsd is failing
     #[ 'gelsd',  gen + dtype + align + mn ],
     [ 'gelss',  gen + dtype + align + mn ],
     [ 'getsls', gen + dtype + align + mn + trans_nc ],
+    [ 'streaming_qr', gen + dtype + align + tall + ' --nrhs 1,4 --nb 1,64' ],
 
     # Generalized
     [ 'gglse', gen + dtype + align + mnk ],
@@ -522,6 +544,12 @@ if (opts.qr and opts.host):
     cmds += [
     [ 'geqr',  gen + dtype + align + n + wide + tall ],
     [ 'geqrf', gen + dtype + align + n + wide + tall ],
+    [ 'geqrf', gen + dtype_complex + align + ' --dim 100x50 --stats y' ],
+    [ 'geqrf_fixed', gen + dtype + align + ' --dim 1,2,3,4,8,16 --dim 4x2,8x4,16x8 --batch 1000' ],
+    [ 'factor_qr', gen + dtype + align + n + tall + ' --nrhs 1,10,100' ],
+    [ 'qr_update', gen + dtype + align + n + wide + tall ],
+    [ 'geqrf_tsqr', gen + dtype + align + tall ],
+    [ 'geqrf_tsqr', gen + dtype + align + ' --dim 1000000x50,100000x200 --threads 1,2,4' ],
     # todo: ggqrf is failing
     #[ 'ggqrf', gen + dtype + align + mnk ],
     [ 'ungqr', gen + dtype + align + mn ],  # m >= n
@@ -589,9 +617,14 @@ if (opts.rq and opts.host):
 if (opts.syev and opts.host):
     cmds += [
     [ 'heev',  gen + dtype + align + n + jobz + uplo ],
+    [ 'heev_small', gen + dtype + align + jobz + uplo + ' --dim 1,2,3 --batch 10000' ],
     [ 'heevx', gen + dtype + align + n + jobz + uplo + vl + vu ],
     [ 'heevx', gen + dtype + align + n + jobz + uplo + il + iu ],
+    [ 'stebz_parallel', gen + dtype_real + n + vl + vu ],
+    [ 'stebz_parallel', gen + dtype_real + n + il + iu ],
+    [ 'stebz_parallel', gen + dtype_real + ' --dim 1000000 --il 1000 --iu 1999 --threads 1,2,4' ],
     [ 'heevd', gen + dtype + align + n + jobz + uplo ],
+    [ 'factor_symeig', gen + dtype + align + n + uplo + ' --nrhs 1,10,100' ],
     [ 'heevr', gen + dtype + align + n + jobz + uplo + vl + vu ],
     [ 'heevr', gen + dtype + align + n + jobz + uplo + il + iu ],
     [ 'hetrd', gen + dtype + align + n + uplo ],
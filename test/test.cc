@@ -100,8 +100,12 @@ std::vector< testsweeper::routines_t > routines = {
     // -----
     // LU
     { "gesv",               test_gesv,      Section::gesv },
+    { "gesv_mixed",         test_gesv_mixed, Section::gesv },
     { "gbsv",               test_gbsv,      Section::gesv },
+    { "gbsv_parallel",      test_gbsv_parallel, Section::gesv },
     { "gtsv",               test_gtsv,      Section::gesv },
+    { "gtsv_batch",         test_gtsv_batch, Section::gesv },
+    { "gtsv_parallel",      test_gtsv_parallel, Section::gesv },
     { "",                   nullptr,        Section::newline },
 
     { "gesvx",              test_gesvx,     Section::gesv }, // TODO Set up fact equed, (work array)=(LAPACKE rpivot)
@@ -110,6 +114,9 @@ std::vector< testsweeper::routines_t > routines = {
     { "",                   nullptr,        Section::newline },
 
     { "getrf",              test_getrf,     Section::gesv },
+    { "getrf_batch",        test_getrf_batch, Section::gesv },
+    { "getrf_fixed",        test_getrf_fixed, Section::gesv },
+    { "factor_lu",          test_factor_lu, Section::gesv },
     { "gbtrf",              test_gbtrf,     Section::gesv },
     { "gttrf",              test_gttrf,     Section::gesv },
     { "",                   nullptr,        Section::newline },
@@ -139,12 +146,20 @@ std::vector< testsweeper::routines_t > routines = {
     // -----
     // Cholesky
     { "posv",               test_posv,      Section::posv },
+    { "posv_mixed",         test_posv_mixed, Section::posv },
     { "ppsv",               test_ppsv,      Section::posv },
     { "pbsv",               test_pbsv,      Section::posv },
+    { "pbsv_parallel",      test_pbsv_parallel, Section::posv },
     { "ptsv",               test_ptsv,      Section::posv },
+    { "ptsv_batch",         test_ptsv_batch, Section::posv },
+    { "ptsv_parallel",      test_ptsv_parallel, Section::posv },
     { "",                   nullptr,        Section::newline },
 
     { "potrf",              test_potrf,     Section::posv },
+    { "potrf_batch",        test_potrf_batch, Section::posv },
+    { "potrf_fixed",        test_potrf_fixed, Section::posv },
+    { "potrf_update",       test_potrf_update, Section::posv },
+    { "factor_cholesky",    test_factor_cholesky, Section::posv },
     { "pptrf",              test_pptrf,     Section::posv },
     { "pbtrf",              test_pbtrf,     Section::posv },
     { "pttrf",              test_pttrf,     Section::posv },
@@ -234,6 +249,7 @@ std::vector< testsweeper::routines_t > routines = {
 
     { "hetrf",              test_hetrf,     Section::hesv }, // tested via LAPACKE
     { "hptrf",              test_hptrf,     Section::hesv }, // tested via LAPACKE
+    { "factor_ldlt",        test_factor_ldlt, Section::hesv },
     { "",                   nullptr,        Section::newline },
 
     { "hetrs",              test_hetrs,     Section::hesv }, // tested via LAPACKE
@@ -255,10 +271,12 @@ std::vector< testsweeper::routines_t > routines = {
     // -----
     // least squares
     { "gels",               test_gels,      Section::gels }, // tested via LAPACKE using gcc/MKL
+    { "gels_mixed",         test_gels_mixed, Section::gels },
     { "gelsy",              test_gelsy,     Section::gels }, // tested via LAPACKE using gcc/MKL TODO jpvt[i]=i rcond=0
     { "gelsd",              test_gelsd,     Section::gels }, // TODO: Segfaults for some Z sizes. src/gelsd.cc:275 lrwork_ too small?
     { "gelss",              test_gelss,     Section::gels }, // tested via LAPACKE using gcc/MKL TODO rcond=n
     { "getsls",             test_getsls,    Section::gels }, // tested via LAPACKE using gcc/MKL
+    { "streaming_qr",       test_streaming_qr, Section::gels },
     { "",                   nullptr,        Section::newline },
 
     { "gglse",              test_gglse,     Section::gels }, // tested via LAPACKE using gcc/MKL
@@ -269,6 +287,10 @@ std::vector< testsweeper::routines_t > routines = {
     // QR, LQ, RQ, QL
     { "geqr",               test_geqr,      Section::qr }, // tested numerically
     { "geqrf",              test_geqrf,     Section::qr }, // tested numerically
+    { "geqrf_fixed",        test_geqrf_fixed, Section::qr },
+    { "factor_qr",          test_factor_qr, Section::qr },
+    { "qr_update",          test_qr_update, Section::qr },
+    { "geqrf_tsqr",         test_geqrf_tsqr, Section::qr },
     { "gelqf",              test_gelqf,     Section::qr }, // tested numerically
     { "geqlf",              test_geqlf,     Section::qr }, // tested numerically
     { "gerqf",              test_gerqf,     Section::qr }, // tested numerically; R, Q are full sizeof(A), could be smaller
@@ -317,9 +339,11 @@ std::vector< testsweeper::routines_t > routines = {
     // -----
     // symmetric/Hermitian eigenvalues
     { "heev",               test_heev,      Section::heev }, // backward error check
+    { "heev_small",         test_heev_small, Section::heev }, // backward error check, compared to heev
     { "hpev",               test_hpev,      Section::heev }, // tested via LAPACKE
     { "hbev",               test_hbev,      Section::heev }, // tested via LAPACKE
     { "sturm",              test_sturm,     Section::heev },
+    { "stebz_parallel",     test_stebz_parallel, Section::heev },
     { "",                   nullptr,        Section::newline },
 
     { "heevx",              test_heevx,     Section::heev }, // backward error check
@@ -330,6 +354,7 @@ std::vector< testsweeper::routines_t > routines = {
     { "heevd",              test_heevd,     Section::heev }, // backward error check
     { "hpevd",              test_hpevd,     Section::heev }, // tested via LAPACKE using gcc/MKL
     { "hbevd",              test_hbevd,     Section::heev }, // tested via LAPACKE using gcc/MKL
+    { "factor_symeig",      test_factor_symeig, Section::heev },
     { "",                   nullptr,        Section::newline },
 
     { "heevr",              test_heevr,     Section::heev }, // backward error check
@@ -507,6 +532,10 @@ Params::Params():
     repeat    ( "repeat",     0,    PT_Value,   1,    1, 1000, "times to repeat each test" ),
     verbose   ( "verbose",    0,    PT_Value,   0,    0,   10, "verbose level" ),
     cache     ( "cache",      0,    PT_Value,  20,    1, 1024, "total cache size, in MiB" ),
+    hugepage  ( "hugepage",   0,    PT_Value, 'n', "ny", "also time with huge-page workspace (2 MiB threshold) and report speedup" ),
+    tiled     ( "tiled",      0,    PT_Value, 'n', "ny", "also time tiled task-parallel variant (getrf_parallel, potrf_parallel) and report its Gflop/s and speedup" ),
+    gmres     ( "gmres",      0,    PT_Value, 'n', "ny", "use GMRES-IR (gesv_mixed_gmres, posv_mixed_gmres) instead of classic refinement" ),
+    stats     ( "stats",      0,    PT_Value, 'n', "ny", "print LAPACK++ workspace and query counters after each run, as JSON" ),
 
     //----- routine parameters, enums
     //          name,         w, type,    default, help
@@ -549,6 +578,9 @@ Params::Params():
     ku        ( "ku",         6,    PT_List,      10,    0,  1e6, "upper bandwidth" ),
     nrhs      ( "nrhs",       6,    PT_List,      10,    0, 1e10, "number of right hand sides" ),
     nb        ( "nb",         4,    PT_List,     384,    0,  1e6, "block size" ),
+    batch     ( "batch",      7,    PT_List,    1000,    0, 1e10, "number of matrices in batch" ),
+    lanes     ( "lanes",      5,    PT_List,       0,    0,   64, "interleaved layout lanes; 0 is strided" ),
+    threads   ( "threads",    7,    PT_List,       0,    0, 4096, "host threads for parallel routines; 0 keeps the current number" ),
 
     vl        ( "vl",         6, 3, PT_List,    -inf, -inf,  inf, "lower bound of eigen/singular values to find" ),
     vu        ( "vu",         6, 3, PT_List,     inf, -inf,  inf, "upper bound of eigen/singular values to find" ),
@@ -582,15 +614,22 @@ Params::Params():
     ortho     ( "orth.",      8, 2, PT_Out, no_data, 0, 0, "orthogonality error" ),
     ortho_U   ( "U orth.",    8, 2, PT_Out, no_data, 0, 0, "U orthogonality error" ),
     ortho_V   ( "V orth.",    8, 2, PT_Out, no_data, 0, 0, "V orthogonality error" ),
+    growth    ( "growth",     8, 2, PT_Out, no_data, 0, 0, "element growth factor max |U| / max |A|" ),
+    growth2   ( "growth2",    8, 2, PT_Out, no_data, 0, 0, "second growth factor, e.g., tiled variant" ),
 
     time      ( "time (s)",   9, 3, PT_Out, no_data, 0, 0, "time to solution" ),
     gflops    ( "gflop/s",   12, 3, PT_Out, no_data, 0, 0, "Gflop/s rate" ),
+    gflops2   ( "gflop/s2",  12, 3, PT_Out, no_data, 0, 0, "second Gflop/s rate, e.g., tiled variant" ),
     gbytes    ( "gbyte/s",   12, 3, PT_Out, no_data, 0, 0, "Gbyte/s rate" ),
     iters     ( "iters",      5,    PT_Out, 0,       0, 0, "iterations to solution" ),
+    gmres_iters( "gmres iters", 11, PT_Out, 0,    0, 0, "total GMRES iterations of GMRES-IR" ),
+    speedup   ( "speedup",    7, 2, PT_Out, no_data, 0, 0, "baseline time / time, e.g., without huge pages, or sequential reference" ),
+    rate      ( "mat/s",     12, 0, PT_Out, no_data, 0, 0, "matrices per second (batch routines)" ),
 
     ref_time  ( "ref time (s)",  9, 3, PT_Out, no_data, 0, 0, "reference time to solution" ),
     ref_gflops( "ref gflop/s",  12, 3, PT_Out, no_data, 0, 0, "reference Gflop/s rate" ),
     ref_gbytes( "ref gbyte/s",  12, 3, PT_Out, no_data, 0, 0, "reference Gbyte/s rate" ),
+    ref_rate  ( "ref mat/s",    12, 0, PT_Out, no_data, 0, 0, "reference matrices per second (batch routines)" ),
     ref_iters ( "ref iters",     5,    PT_Out, 0,       0, 0, "reference iterations to solution" ),
 
     // default -1 means "no check"
@@ -615,6 +654,7 @@ Params::Params():
     repeat();
     verbose();
     cache();
+    stats();
 
     // routine's parameters are marked by the test routine; see main
 }
@@ -791,6 +831,7 @@ int main( int argc, char** argv )
         testsweeper::DataType last = params.datatype();
         std::string matrix, matrixB;
         double cond = 0, condD = 0, condB = 0, condD_B = 0;
+        lapack::stats_enable( params.stats() == 'y' );
         params.header();
         do {
             if (params.datatype() != last) {
@@ -798,6 +839,7 @@ int main( int argc, char** argv )
                 printf( "\n" );
             }
             for (int iter = 0; iter < repeat; ++iter) {
+                lapack::stats_reset();
                 try {
                     test_routine( params, true );
                 }
@@ -811,6 +853,9 @@ int main( int argc, char** argv )
                     print_matrix_header( params.matrixB, "test matrix B", &matrixB, &condB, &condD_B );
                 }
                 params.print();
+                if (params.stats() == 'y') {
+                    printf( "stats: %s\n", lapack::stats_json().c_str() );
+                }
                 fflush( stdout );
                 status += ! params.okay();
                 params.reset_output();
@@ -42,6 +42,10 @@ public:
     testsweeper::ParamInt    repeat;
     testsweeper::ParamInt    verbose;
     testsweeper::ParamInt    cache;
+    testsweeper::ParamChar   hugepage;
+    testsweeper::ParamChar   tiled;
+    testsweeper::ParamChar   gmres;
+    testsweeper::ParamChar   stats;
 
     //----- test matrix parameters
     MatrixParams matrix;
@@ -95,6 +99,9 @@ public:
     testsweeper::ParamInt     ku;
     testsweeper::ParamInt     nrhs;
     testsweeper::ParamInt     nb;
+    testsweeper::ParamInt     batch;
+    testsweeper::ParamInt     lanes;
+    testsweeper::ParamInt     threads;
     testsweeper::ParamDouble  vl;
     testsweeper::ParamDouble  vu;
     testsweeper::ParamInt     il;
@@ -119,15 +126,22 @@ public:
     testsweeper::ParamScientific ortho;
     testsweeper::ParamScientific ortho_U;
     testsweeper::ParamScientific ortho_V;
+    testsweeper::ParamScientific growth;
+    testsweeper::ParamScientific growth2;
 
     testsweeper::ParamDouble     time;
     testsweeper::ParamDouble     gflops;
+    testsweeper::ParamDouble     gflops2;
     testsweeper::ParamDouble     gbytes;
     testsweeper::ParamInt        iters;
+    testsweeper::ParamInt        gmres_iters;
+    testsweeper::ParamDouble     speedup;
+    testsweeper::ParamDouble     rate;
 
     testsweeper::ParamDouble     ref_time;
     testsweeper::ParamDouble     ref_gflops;
     testsweeper::ParamDouble     ref_gbytes;
+    testsweeper::ParamDouble     ref_rate;
     testsweeper::ParamInt        ref_iters;
 
     testsweeper::ParamOkay       okay;
@@ -174,8 +188,12 @@ void require_( bool cond, const char* condstr, const char* file, int line )
 // LAPACK
 // LU, general
 void test_gesv  ( Params& params, bool run );
+void test_gesv_mixed ( Params& params, bool run );
 void test_gesvx ( Params& params, bool run );
 void test_getrf ( Params& params, bool run );
+void test_getrf_batch ( Params& params, bool run );
+void test_getrf_fixed ( Params& params, bool run );
+void test_factor_lu ( Params& params, bool run );
 void test_getri ( Params& params, bool run );
 void test_getrs ( Params& params, bool run );
 void test_gecon ( Params& params, bool run );
@@ -184,6 +202,7 @@ void test_geequ ( Params& params, bool run );
 
 // LU, band
 void test_gbsv  ( Params& params, bool run );
+void test_gbsv_parallel ( Params& params, bool run );
 void test_gbsvx ( Params& params, bool run );
 void test_gbtrf ( Params& params, bool run );
 void test_gbtrs ( Params& params, bool run );
@@ -193,6 +212,8 @@ void test_gbequ ( Params& params, bool run );
 
 // LU, tridiagonal
 void test_gtsv  ( Params& params, bool run );
+void test_gtsv_batch ( Params& params, bool run );
+void test_gtsv_parallel ( Params& params, bool run );
 void test_gtsvx ( Params& params, bool run );
 void test_gttrf ( Params& params, bool run );
 void test_gttrs ( Params& params, bool run );
@@ -202,8 +223,13 @@ void test_gtequ ( Params& params, bool run );
 
 // Cholesky
 void test_posv  ( Params& params, bool run );
+void test_posv_mixed ( Params& params, bool run );
 void test_posvx ( Params& params, bool run );
 void test_potrf ( Params& params, bool run );
+void test_potrf_batch ( Params& params, bool run );
+void test_potrf_fixed ( Params& params, bool run );
+void test_potrf_update ( Params& params, bool run );
+void test_factor_cholesky ( Params& params, bool run );
 void test_potri ( Params& params, bool run );
 void test_potrs ( Params& params, bool run );
 void test_pocon ( Params& params, bool run );
@@ -221,6 +247,7 @@ void test_ppequ ( Params& params, bool run );
 
 // Cholesky, band
 void test_pbsv  ( Params& params, bool run );
+void test_pbsv_parallel ( Params& params, bool run );
 void test_pbtrf ( Params& params, bool run );
 void test_pbtrs ( Params& params, bool run );
 void test_pbcon ( Params& params, bool run );
@@ -229,6 +256,8 @@ void test_pbequ ( Params& params, bool run );
 
 // Cholesky, tridiagonal
 void test_ptsv  ( Params& params, bool run );
+void test_ptsv_batch ( Params& params, bool run );
+void test_ptsv_parallel ( Params& params, bool run );
 void test_pttrf ( Params& params, bool run );
 void test_pttrs ( Params& params, bool run );
 void test_ptcon ( Params& params, bool run );
@@ -277,6 +306,7 @@ void test_sytri_rk           ( Params& params, bool run );
 // hermetian
 void test_hesv  ( Params& params, bool run );
 void test_hetrf ( Params& params, bool run );
+void test_factor_ldlt ( Params& params, bool run );
 void test_hetrs ( Params& params, bool run );
 void test_hetri ( Params& params, bool run );
 void test_hecon ( Params& params, bool run );
@@ -292,16 +322,22 @@ void test_hprfs ( Params& params, bool run );
 
 // least squares
 void test_gels  ( Params& params, bool run );
+void test_gels_mixed ( Params& params, bool run );
 void test_gelsy ( Params& params, bool run );
 void test_gelsd ( Params& params, bool run );
 void test_gelss ( Params& params, bool run );
 void test_getsls( Params& params, bool run );
+void test_streaming_qr ( Params& params, bool run );
 void test_gglse ( Params& params, bool run );
 void test_ggglm ( Params& params, bool run );
 
 // QR, LQ, QL, RQ
 void test_geqr  ( Params& params, bool run );
 void test_geqrf ( Params& params, bool run );
+void test_geqrf_fixed ( Params& params, bool run );
+void test_factor_qr ( Params& params, bool run );
+void test_qr_update ( Params& params, bool run );
+void test_geqrf_tsqr ( Params& params, bool run );
 void test_gelqf ( Params& params, bool run );
 void test_geqlf ( Params& params, bool run );
 void test_gerqf ( Params& params, bool run );
@@ -339,13 +375,16 @@ void test_tprfb ( Params& params, bool run );
 
 // symmetric eigenvalues
 void test_heev  ( Params& params, bool run );
+void test_heev_small ( Params& params, bool run );
 void test_heevx ( Params& params, bool run );
 void test_heevd ( Params& params, bool run );
+void test_factor_symeig ( Params& params, bool run );
 void test_heevr ( Params& params, bool run );
 void test_hetrd ( Params& params, bool run );
 void test_lae2  ( Params& params, bool run );
 void test_laev2 ( Params& params, bool run );
 void test_sturm ( Params& params, bool run );
+void test_stebz_parallel ( Params& params, bool run );
 void test_ungtr ( Params& params, bool run );
 void test_unmtr ( Params& params, bool run );
 
@@ -0,0 +1,393 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/factor.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "check_gels.hh"
+
+#include <cmath>
+#include <vector>
+
+//------------------------------------------------------------------------------
+// Reference determinant of the n-by-n matrix A, from getrf.
+template< typename scalar_t >
+scalar_t det_ref( int64_t n, scalar_t const* A, int64_t lda )
+{
+    std::vector< scalar_t > LU( A, A + lda*n );
+    std::vector< int64_t > ipiv( blas::max( 1, n ) );
+    lapack::getrf( n, n, &LU[0], lda, &ipiv[0] );
+    scalar_t det = 1;
+    for (int64_t i = 0; i < n; ++i) {
+        det *= LU[ i + i*lda ];
+        if (ipiv[ i ] != i + 1)
+            det = -det;
+    }
+    return det;
+}
+
+// -----------------------------------------------------------------------------
+// Tests a factorization object made by make( A, lda ), from factor.hh.
+// A is m-by-n, with m > n only for QR. If hermitian, the uplo triangle of
+// A is mirrored into the other, so a full matrix serves for the checks.
+//
+// error:  solve, || B - A X ||_1 / (n || A ||_1 || X ||_1),
+//         or for QR the residual orthogonality of check_gels.
+// error2: inverse, || I - A A^{-1} ||_1 / (n || A ||_1 || A^{-1} ||_1).
+// error3: det, | det - det_ref | / (n | det_ref | / rcond), using the
+//         estimate rcond; not checked if det_ref overflows or underflows.
+//
+template< typename scalar_t, typename Make >
+void test_factor_work(
+    Params& params, bool run, bool hermitian, bool square, Make&& make )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using blas::conj;
+    using blas::real;
+
+    // get & mark input values
+    lapack::Uplo uplo = hermitian ? params.uplo() : lapack::Uplo::General;
+    int64_t m = square ? params.dim.n() : params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.error2();
+    params.error2.name( "inverse" );
+    params.error3();
+    params.error3.name( "det" );
+
+    if (! run)
+        return;
+
+    if (m < n) {
+        printf( "skipping because QR requires m >= n\n" );
+        return;
+    }
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, m ), align );
+    int64_t ldb = roundup( blas::max( 1, m ), align );
+    int64_t ldi = roundup( blas::max( 1, n ), align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_B = (size_t) ldb * nrhs;
+    size_t size_I = (size_t) ldi * n;
+
+    std::vector< scalar_t > A( size_A );
+    std::vector< scalar_t > B( size_B );
+    std::vector< scalar_t > X( size_B );
+    std::vector< scalar_t > Ainv( size_I );
+
+    lapack::generate_matrix( params.matrix, m, n, &A[0], lda );
+    if (hermitian) {
+        for (int64_t j = 0; j < n; ++j) {
+            A[ j + j*lda ] = real( A[ j + j*lda ] );
+            for (int64_t i = j+1; i < n; ++i) {
+                if (uplo == lapack::Uplo::Lower)
+                    A[ j + i*lda ] = conj( A[ i + j*lda ] );
+                else
+                    A[ i + j*lda ] = conj( A[ j + i*lda ] );
+            }
+        }
+    }
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, B.size(), &B[0] );
+    X = B;
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A m=%5lld, n=%5lld, lda=%5lld\n"
+                "B m=%5lld, nrhs=%5lld, ldb=%5lld\n",
+                llong( m ), llong( n ), llong( lda ),
+                llong( m ), llong( nrhs ), llong( ldb ) );
+    }
+    if (verbose >= 2) {
+        printf( "A = " ); print_matrix( m, n, &A[0], lda );
+        printf( "B = " ); print_matrix( m, nrhs, &B[0], ldb );
+    }
+
+    // ---------- run test: factor, then solve
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    auto F = make( &A[0], lda );
+    int64_t info_solve = F.solve( nrhs, &X[0], ldb );
+    time = testsweeper::get_wtime() - time;
+    if (F.info() != 0) {
+        fprintf( stderr, "factor returned error %lld\n", llong( F.info() ) );
+    }
+    if (info_solve != F.info()) {
+        fprintf( stderr, "solve returned %lld, but info is %lld\n",
+                 llong( info_solve ), llong( F.info() ) );
+    }
+
+    params.time() = time;
+
+    if (verbose >= 1) {
+        printf( "anorm %.2e, rcond %.2e\n",
+                double( F.anorm() ), double( F.rcond() ) );
+    }
+    if (verbose >= 2) {
+        printf( "X = " ); print_matrix( n, nrhs, &X[0], ldb );
+    }
+
+    if (params.check() == 'y' && F.info() == 0) {
+        // ---------- check solve
+        real_t Anorm = lapack::lange( lapack::Norm::One, m, n, &A[0], lda );
+        real_t error;
+        if (square) {
+            std::vector< scalar_t > R( B );
+            blas::gemm( blas::Layout::ColMajor, blas::Op::NoTrans, blas::Op::NoTrans,
+                        n, nrhs, n,
+                        -1.0, &A[0], lda,
+                              &X[0], ldb,
+                         1.0, &R[0], ldb );
+            real_t Rnorm = lapack::lange( lapack::Norm::One, n, nrhs, &R[0], ldb );
+            real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, &X[0], ldb );
+            error = Rnorm / (n * Anorm * Xnorm);
+        }
+        else {
+            real_t result[2];
+            check_gels( false, lapack::Op::NoTrans, m, n, nrhs,
+                        &A[0], lda, &X[0], ldb, &B[0], ldb, result );
+            error = result[0];
+        }
+        params.error() = error;
+        params.okay() = (error < tol);
+
+        if (m == n) {
+            // ---------- check inverse
+            F.inverse( &Ainv[0], ldi );
+            std::vector< scalar_t > R( size_I );
+            lapack::laset( lapack::MatrixType::General, n, n, 0.0, 1.0,
+                           &R[0], ldi );
+            blas::gemm( blas::Layout::ColMajor, blas::Op::NoTrans, blas::Op::NoTrans,
+                        n, n, n,
+                        -1.0, &A[0], lda,
+                              &Ainv[0], ldi,
+                         1.0, &R[0], ldi );
+            real_t Rnorm = lapack::lange( lapack::Norm::One, n, n, &R[0], ldi );
+            real_t Inorm = lapack::lange( lapack::Norm::One, n, n, &Ainv[0], ldi );
+            real_t error2 = Rnorm / (n * Anorm * Inorm);
+            params.error2() = error2;
+            params.okay() = params.okay() && (error2 < tol);
+
+            // ---------- check det
+            scalar_t dref = det_ref( n, &A[0], lda );
+            real_t dnorm = std::abs( dref );
+            if (dnorm != 0 && std::isfinite( dnorm )) {
+                real_t error3 = std::abs( scalar_t( F.det() ) - dref )
+                              * F.rcond() / (n * dnorm);
+                params.error3() = error3;
+                params.okay() = params.okay() && (error3 < tol);
+            }
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_factor_lu_work( Params& params, bool run )
+{
+    int64_t n = params.dim.n();
+    test_factor_work< scalar_t >(
+        params, run, false, true,
+        [n]( scalar_t const* A, int64_t lda ) {
+            return lapack::LU< scalar_t >( n, A, lda );
+        });
+}
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_factor_cholesky_work( Params& params, bool run )
+{
+    if (! run) {
+        params.matrix.kind.set_default( "rand_dominant" );
+    }
+    lapack::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    test_factor_work< scalar_t >(
+        params, run, true, true,
+        [uplo, n]( scalar_t const* A, int64_t lda ) {
+            return lapack::Cholesky< scalar_t >( uplo, n, A, lda );
+        });
+}
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_factor_qr_work( Params& params, bool run )
+{
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    test_factor_work< scalar_t >(
+        params, run, false, false,
+        [m, n]( scalar_t const* A, int64_t lda ) {
+            return lapack::QR< scalar_t >( m, n, A, lda );
+        });
+}
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_factor_ldlt_work( Params& params, bool run )
+{
+    lapack::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    test_factor_work< scalar_t >(
+        params, run, true, true,
+        [uplo, n]( scalar_t const* A, int64_t lda ) {
+            return lapack::LDLT< scalar_t >( uplo, n, A, lda );
+        });
+}
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_factor_symeig_work( Params& params, bool run )
+{
+    lapack::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    test_factor_work< scalar_t >(
+        params, run, true, true,
+        [uplo, n]( scalar_t const* A, int64_t lda ) {
+            return lapack::SymEig< scalar_t >( uplo, n, A, lda );
+        });
+}
+
+// -----------------------------------------------------------------------------
+void test_factor_lu( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_factor_lu_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_factor_lu_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_factor_lu_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_factor_lu_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_factor_cholesky( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_factor_cholesky_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_factor_cholesky_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_factor_cholesky_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_factor_cholesky_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_factor_qr( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_factor_qr_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_factor_qr_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_factor_qr_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_factor_qr_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_factor_ldlt( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_factor_ldlt_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_factor_ldlt_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_factor_ldlt_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_factor_ldlt_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_factor_symeig( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_factor_symeig_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_factor_symeig_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_factor_symeig_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_factor_symeig_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
@@ -0,0 +1,498 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/fixed.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+
+#include <algorithm>
+#include <vector>
+
+//------------------------------------------------------------------------------
+// Calls f( std::integral_constant< int, n >() ) for runtime n in
+// [first, last], so testers can reach the compile-time fixed:: kernels.
+// Returns false if n is out of range.
+template <int first, int last, typename F>
+bool dispatch( int64_t n, F&& f )
+{
+    if constexpr (first <= last) {
+        if (n == first) {
+            f( std::integral_constant< int, first >() );
+            return true;
+        }
+        return dispatch< first + 1, last >( n, f );
+    }
+    else {
+        return false;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Max relative difference between batches of m-by-n matrices; updates B.
+template< typename scalar_t >
+blas::real_type< scalar_t > max_rel_diff(
+    int64_t m, int64_t n, int64_t batch,
+    scalar_t const* A, scalar_t* B, int64_t ld, int64_t stride )
+{
+    using real_t = blas::real_type< scalar_t >;
+    real_t error = 0;
+    for (int64_t i = 0; i < batch; ++i) {
+        real_t Anorm = lapack::lange( lapack::Norm::One, m, n, &A[ i*stride ], ld );
+        blas::axpy( stride, -1.0, &A[ i*stride ], 1, &B[ i*stride ], 1 );
+        real_t diff = lapack::lange( lapack::Norm::One, m, n, &B[ i*stride ], ld );
+        if (Anorm != 0)
+            diff /= Anorm;
+        error = std::max( error, diff );
+    }
+    return error;
+}
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_getrf_fixed_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    lapack::Op trans = params.trans();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t batch = params.batch();
+    int64_t align = params.align();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.gflops();
+    params.rate();
+    params.ref_time();
+    params.ref_rate();
+    params.msg();
+
+    if (! run)
+        return;
+
+    if (n > lapack::fixed::max_size) {
+        params.msg() = "skipping: requires n <= 16";
+        return;
+    }
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    int64_t ldb = lda;
+    int64_t strideA = lda * n;
+    int64_t strideB = ldb * nrhs;
+    size_t size_A = (size_t) strideA * batch;
+    size_t size_B = (size_t) strideB * batch;
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > A_ref( size_A );
+    std::vector< scalar_t > B_tst( size_B );
+    std::vector< scalar_t > B_ref( size_B );
+    std::vector< int64_t > ipiv_tst( n * batch );
+    std::vector< int64_t > ipiv_ref( n * batch );
+
+    for (int64_t i = 0; i < batch; ++i) {
+        lapack::generate_matrix( params.matrix, n, n, &A_tst[ i*strideA ], lda );
+    }
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, B_tst.size(), &B_tst[0] );
+    A_ref = A_tst;
+    B_ref = B_tst;
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    int64_t nsingular = 0;
+    dispatch< 0, lapack::fixed::max_size >( n, [&]( auto N ) {
+        for (int64_t i = 0; i < batch; ++i) {
+            int64_t info = lapack::fixed::getrf< N >(
+                &A_tst[ i*strideA ], lda, &ipiv_tst[ i*n ] );
+            if (info != 0)
+                ++nsingular;
+        }
+    });
+    time = testsweeper::get_wtime() - time;
+    if (nsingular != 0) {
+        fprintf( stderr, "lapack::fixed::getrf returned %lld singular matrices\n",
+                 llong( nsingular ) );
+    }
+
+    params.time() = time;
+    double gflop = batch * lapack::Gflop< scalar_t >::getrf( n, n );
+    params.gflops() = gflop / time;
+    params.rate() = batch / time;
+
+    if (params.check() == 'y' || params.ref() == 'y') {
+        // ---------- run reference: lapack::getrf in a loop
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        for (int64_t i = 0; i < batch; ++i) {
+            lapack::getrf( n, n, &A_ref[ i*strideA ], lda, &ipiv_ref[ i*n ] );
+        }
+        time = testsweeper::get_wtime() - time;
+
+        params.ref_time() = time;
+        params.ref_rate() = batch / time;
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Pivots must match exactly; factors and solutions to rounding.
+        bool same = (ipiv_tst == ipiv_ref);
+        if (nsingular == 0) {
+            dispatch< 0, lapack::fixed::max_size >( n, [&]( auto N ) {
+                for (int64_t i = 0; i < batch; ++i) {
+                    lapack::fixed::getrs< N >(
+                        trans, nrhs, &A_tst[ i*strideA ], lda, &ipiv_tst[ i*n ],
+                        &B_tst[ i*strideB ], ldb );
+                    lapack::getrs(
+                        trans, n, nrhs, &A_ref[ i*strideA ], lda, &ipiv_ref[ i*n ],
+                        &B_ref[ i*strideB ], ldb );
+                }
+            });
+        }
+        real_t error = max_rel_diff( n, n, batch, &A_ref[0], &A_tst[0], lda, strideA );
+        real_t error_B = max_rel_diff( n, nrhs, batch, &B_ref[0], &B_tst[0], ldb, strideB );
+        error = std::max( error, error_B ) / blas::max( 1, n );
+
+        params.error() = error;
+        params.okay() = (error < tol) && same;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_potrf_fixed_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    lapack::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t batch = params.batch();
+    int64_t align = params.align();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.gflops();
+    params.rate();
+    params.ref_time();
+    params.ref_rate();
+    params.msg();
+
+    if (! run) {
+        params.matrix.kind.set_default( "rand_dominant" );
+        return;
+    }
+
+    if (n > lapack::fixed::max_size) {
+        params.msg() = "skipping: requires n <= 16";
+        return;
+    }
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    int64_t ldb = lda;
+    int64_t strideA = lda * n;
+    int64_t strideB = ldb * nrhs;
+    size_t size_A = (size_t) strideA * batch;
+    size_t size_B = (size_t) strideB * batch;
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > A_ref( size_A );
+    std::vector< scalar_t > B_tst( size_B );
+    std::vector< scalar_t > B_ref( size_B );
+
+    for (int64_t i = 0; i < batch; ++i) {
+        lapack::generate_matrix( params.matrix, n, n, &A_tst[ i*strideA ], lda );
+    }
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, B_tst.size(), &B_tst[0] );
+    A_ref = A_tst;
+    B_ref = B_tst;
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    int64_t nfailed = 0;
+    dispatch< 0, lapack::fixed::max_size >( n, [&]( auto N ) {
+        for (int64_t i = 0; i < batch; ++i) {
+            int64_t info = lapack::fixed::potrf< N >(
+                uplo, &A_tst[ i*strideA ], lda );
+            if (info != 0)
+                ++nfailed;
+        }
+    });
+    time = testsweeper::get_wtime() - time;
+    if (nfailed != 0) {
+        fprintf( stderr, "lapack::fixed::potrf returned %lld non-positive definite matrices\n",
+                 llong( nfailed ) );
+    }
+
+    params.time() = time;
+    double gflop = batch * lapack::Gflop< scalar_t >::potrf( n );
+    params.gflops() = gflop / time;
+    params.rate() = batch / time;
+
+    if (params.check() == 'y' || params.ref() == 'y') {
+        // ---------- run reference: lapack::potrf in a loop
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        for (int64_t i = 0; i < batch; ++i) {
+            lapack::potrf( uplo, n, &A_ref[ i*strideA ], lda );
+        }
+        time = testsweeper::get_wtime() - time;
+
+        params.ref_time() = time;
+        params.ref_rate() = batch / time;
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        if (nfailed == 0) {
+            dispatch< 0, lapack::fixed::max_size >( n, [&]( auto N ) {
+                for (int64_t i = 0; i < batch; ++i) {
+                    lapack::fixed::potrs< N >(
+                        uplo, nrhs, &A_tst[ i*strideA ], lda,
+                        &B_tst[ i*strideB ], ldb );
+                    lapack::potrs(
+                        uplo, n, nrhs, &A_ref[ i*strideA ], lda,
+                        &B_ref[ i*strideB ], ldb );
+                }
+            });
+        }
+        // Only the uplo triangle is referenced, so the other is unchanged
+        // in both, and the full-matrix difference is that of the factors.
+        real_t error = max_rel_diff( n, n, batch, &A_ref[0], &A_tst[0], lda, strideA );
+        real_t error_B = max_rel_diff( n, nrhs, batch, &B_ref[0], &B_tst[0], ldb, strideB );
+        error = std::max( error, error_B ) / blas::max( 1, n );
+
+        params.error() = error;
+        params.okay() = (error < tol) && (nfailed == 0);
+    }
+}
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_geqrf_fixed_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t batch = params.batch();
+    int64_t align = params.align();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.gflops();
+    params.rate();
+    params.ref_time();
+    params.ref_rate();
+    params.error2();
+    params.error2.name( "scaled error" );
+    params.msg();
+
+    if (! run)
+        return;
+
+    // To bound compile time, the tester instantiates only
+    // M = N and M = 2N, rather than all 17^2 sizes.
+    if (m > lapack::fixed::max_size || n > lapack::fixed::max_size
+        || (m != n && m != 2*n)) {
+        params.msg() = "skipping: requires m, n <= 16 and m = n or 2n";
+        return;
+    }
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, m ), align );
+    int64_t minmn = blas::min( m, n );
+    int64_t strideA = lda * n;
+    size_t size_A = (size_t) strideA * batch;
+    size_t size_tau = (size_t) minmn * batch;
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > A_ref( size_A );
+    std::vector< scalar_t > tau_tst( size_tau );
+    std::vector< scalar_t > tau_ref( size_tau );
+
+    for (int64_t i = 0; i < batch; ++i) {
+        lapack::generate_matrix( params.matrix, m, n, &A_tst[ i*strideA ], lda );
+    }
+    A_ref = A_tst;
+
+    // Copy of the first matrix with badly scaled columns, alternately
+    // near sqrt( overflow ) and sqrt( underflow ), so unscaled sums of
+    // squares in the column norms would overflow or underflow.
+    real_t big   = 4 * std::sqrt( std::numeric_limits< real_t >::max() );
+    real_t small = std::sqrt( std::numeric_limits< real_t >::min() ) / 4;
+    std::vector< scalar_t > S_tst( A_tst.begin(), A_tst.begin() + strideA );
+    std::vector< scalar_t > stau_tst( blas::max( 1, minmn ) );
+    std::vector< scalar_t > stau_ref( blas::max( 1, minmn ) );
+    for (int64_t j = 0; j < n; ++j) {
+        blas::scal( m, (j % 2 == 0 ? big : small), &S_tst[ j*lda ], 1 );
+    }
+    std::vector< scalar_t > S_ref = S_tst;
+
+    auto geqrf = [&]( auto N, auto M ) {
+        for (int64_t i = 0; i < batch; ++i) {
+            lapack::fixed::geqrf< M, N >(
+                &A_tst[ i*strideA ], lda, &tau_tst[ i*minmn ] );
+        }
+        lapack::fixed::geqrf< M, N >( &S_tst[0], lda, &stau_tst[0] );
+    };
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    if (m == n) {
+        dispatch< 0, lapack::fixed::max_size >( n, [&]( auto N ) {
+            geqrf( N, N );
+        });
+    }
+    else {
+        dispatch< 0, lapack::fixed::max_size / 2 >( n, [&]( auto N ) {
+            geqrf( N, std::integral_constant< int, 2*N >() );
+        });
+    }
+    time = testsweeper::get_wtime() - time;
+
+    params.time() = time;
+    double gflop = batch * lapack::Gflop< scalar_t >::geqrf( m, n );
+    params.gflops() = gflop / time;
+    params.rate() = batch / time;
+
+    if (params.check() == 'y' || params.ref() == 'y') {
+        // ---------- run reference: lapack::geqrf in a loop
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        for (int64_t i = 0; i < batch; ++i) {
+            lapack::geqrf( m, n, &A_ref[ i*strideA ], lda, &tau_ref[ i*minmn ] );
+        }
+        time = testsweeper::get_wtime() - time;
+
+        params.ref_time() = time;
+        params.ref_rate() = batch / time;
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Same reflector convention, so R, V, and tau match to rounding.
+        real_t error = max_rel_diff( m, n, batch, &A_ref[0], &A_tst[0], lda, strideA );
+        real_t error_tau = max_rel_diff( minmn, 1, batch, &tau_ref[0], &tau_tst[0],
+                                         blas::max( 1, minmn ), minmn );
+        error = std::max( error, error_tau ) / blas::max( 1, m );
+
+        // Compare the scaled matrix column by column, relative to each
+        // column, since the norm of the whole matrix hides small columns.
+        lapack::geqrf( m, n, &S_ref[0], lda, &stau_ref[0] );
+        real_t error2 = 0;
+        for (int64_t j = 0; j < n; ++j) {
+            error2 = std::max( error2, max_rel_diff(
+                m, 1, 1, &S_ref[ j*lda ], &S_tst[ j*lda ], lda, m ) );
+        }
+        error2 = std::max( error2, max_rel_diff(
+            minmn, 1, 1, &stau_ref[0], &stau_tst[0], blas::max( 1, minmn ), minmn ) );
+        error2 /= blas::max( 1, m );
+
+        params.error() = error;
+        params.error2() = error2;
+        params.okay() = (error < tol) && (error2 < tol);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_getrf_fixed( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_getrf_fixed_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_getrf_fixed_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_getrf_fixed_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_getrf_fixed_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_potrf_fixed( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_potrf_fixed_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_potrf_fixed_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_potrf_fixed_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_potrf_fixed_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_geqrf_fixed( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_geqrf_fixed_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_geqrf_fixed_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_geqrf_fixed_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_geqrf_fixed_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
@@ -0,0 +1,166 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "cblas_wrappers.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_gbsv_parallel_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t n = params.dim.n();
+    int64_t kl = params.kl();
+    int64_t ku = params.ku();
+    int64_t nrhs = params.nrhs();
+    int64_t threads = params.threads();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.speedup();
+
+    if (! run)
+        return;
+
+    // Sweeping --threads 1,2,4,... reports the scaling; the reference is
+    // sequential gbsv, so speedup = ref_time / time.
+    int threads_save = lapack::get_num_threads();
+    if (threads > 0)
+        lapack::set_num_threads( threads );
+
+    // ---------- setup
+    int64_t kd = 2*kl + ku + 1;  // number of diagonals in factor
+    int64_t ldab = roundup( kd, align );
+    int64_t ldb = roundup( blas::max( 1, n ), align );
+    size_t size_AB = (size_t) ldab * n;
+    size_t size_ipiv = (size_t) (n);
+    size_t size_B = (size_t) ldb * nrhs;
+
+    std::vector< scalar_t > AB( size_AB );
+    std::vector< int64_t > ipiv_tst( size_ipiv );
+    std::vector< int64_t > ipiv_ref( size_ipiv );
+    std::vector< scalar_t > B( size_B );
+
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, AB.size(), &AB[0] );
+    lapack::larnv( idist, iseed, B.size(), &B[0] );
+
+    // Pivoting stays inside partitions, so keep A diagonally dominant,
+    // which ensures every diagonal block is non-singular.
+    for (int64_t j = 0; j < n; ++j) {
+        AB[ kl + ku + j*ldab ] += kl + ku + 1;
+    }
+
+    std::vector< scalar_t > AB_tst = AB, B_tst = B;
+    std::vector< scalar_t > AB_ref = AB, B_ref = B;
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "AB n=%5lld, kl=%5lld, ku=%5lld, kd=%5lld, ldab=%5lld\n"
+                "B n=%5lld, nrhs=%5lld, ldb=%5lld, threads=%d\n",
+                llong( n ), llong( kl ), llong( ku ), llong( kd ), llong( ldab ),
+                llong( n ), llong( nrhs ), llong( ldb ),
+                lapack::get_num_threads() );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::gbsv_parallel( -1, kl, ku, nrhs, &AB_tst[0], ldab, &ipiv_tst[0], &B_tst[0], ldb ), lapack::Error );
+        assert_throw( lapack::gbsv_parallel(  n, -1, ku, nrhs, &AB_tst[0], ldab, &ipiv_tst[0], &B_tst[0], ldb ), lapack::Error );
+        assert_throw( lapack::gbsv_parallel(  n, kl, -1, nrhs, &AB_tst[0], ldab, &ipiv_tst[0], &B_tst[0], ldb ), lapack::Error );
+        assert_throw( lapack::gbsv_parallel(  n, kl, ku,   -1, &AB_tst[0], ldab, &ipiv_tst[0], &B_tst[0], ldb ), lapack::Error );
+        assert_throw( lapack::gbsv_parallel(  n, kl, ku, nrhs, &AB_tst[0], kd-1, &ipiv_tst[0], &B_tst[0], ldb ), lapack::Error );
+        assert_throw( lapack::gbsv_parallel(  n, kl, ku, nrhs, &AB_tst[0], ldab, &ipiv_tst[0], &B_tst[0], n-1 ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    int64_t info_tst = lapack::gbsv_parallel(
+        n, kl, ku, nrhs, &AB_tst[0], ldab, &ipiv_tst[0], &B_tst[0], ldb );
+    time = testsweeper::get_wtime() - time;
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::gbsv_parallel returned error %lld\n", llong( info_tst ) );
+    }
+
+    params.time() = time;
+
+    if (params.check() == 'y' || params.ref() == 'y') {
+        // ---------- run reference: sequential lapack::gbsv
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = lapack::gbsv(
+            n, kl, ku, nrhs, &AB_ref[0], ldab, &ipiv_ref[0], &B_ref[0], ldb );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "lapack::gbsv returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+        params.speedup() = params.ref_time() / params.time();
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Relative backwards error = ||b - Ax|| / (n * ||A|| * ||x||),
+        // with the original A, since the factors differ from gbsv.
+        // AB rows 0:kl-1 are ignored; start in row kl.
+        for (int64_t j = 0; j < nrhs; ++j) {
+            // B -= A * B_tst
+            cblas_gbmv( CblasColMajor, CblasNoTrans, n, n, kl, ku,
+                        -1.0, &AB[ kl ], ldab,
+                              &B_tst[ j*ldb ], 1,
+                         1.0, &B[ j*ldb ], 1 );
+        }
+
+        real_t error = lapack::lange( lapack::Norm::One, n, nrhs, &B[0], ldb );
+        real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, &B_tst[0], ldb );
+        real_t Anorm = lapack::langb( lapack::Norm::One, n, kl, ku, &AB[ kl ], ldab );
+        error /= (n * Anorm * Xnorm);
+        params.error() = error;
+        params.okay() = (error < tol) && (info_tst == 0);
+    }
+
+    lapack::set_num_threads( threads_save );
+}
+
+// -----------------------------------------------------------------------------
+void test_gbsv_parallel( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_gbsv_parallel_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_gbsv_parallel_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_gbsv_parallel_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_gbsv_parallel_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
@@ -0,0 +1,186 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "check_gels.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Returns || B - A X ||_F / || B ||_F.
+template< typename scalar_t >
+blas::real_type< scalar_t > gels_residual(
+    int64_t m, int64_t n, int64_t nrhs,
+    scalar_t const* A, int64_t lda,
+    scalar_t const* X, int64_t ldx,
+    scalar_t const* B, int64_t ldb )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    std::vector< scalar_t > R( m*nrhs );
+    lapack::lacpy( lapack::MatrixType::General, m, nrhs, B, ldb, &R[0], m );
+    blas::gemm( blas::Layout::ColMajor, blas::Op::NoTrans, blas::Op::NoTrans,
+                m, nrhs, n,
+                -1.0, A, lda,
+                      X, ldx,
+                 1.0, &R[0], m );
+    real_t Rnorm = lapack::lange( lapack::Norm::Fro, m, nrhs, &R[0], m );
+    real_t Bnorm = lapack::lange( lapack::Norm::Fro, m, nrhs, B, ldb );
+    return (Bnorm > 0 ? Rnorm / Bnorm : Rnorm);
+}
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_gels_mixed_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.speedup();
+    params.iters();
+    params.error2();
+    params.error2.name( "residual" );
+    params.error3();
+    params.error3.name( "ref resid." );
+
+    if (! run)
+        return;
+
+    if (m < n) {
+        printf( "skipping because gels_mixed requires m >= n\n" );
+        return;
+    }
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, m ), align );
+    int64_t ldb = roundup( blas::max( 1, m ), align );
+    int64_t ldx = roundup( blas::max( 1, n ), align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_B = (size_t) ldb * nrhs;
+    size_t size_X = (size_t) ldx * nrhs;
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > A_ref( size_A );
+    std::vector< scalar_t > B( size_B );
+    std::vector< scalar_t > B_ref( size_B );
+    std::vector< scalar_t > X_tst( size_X );
+
+    lapack::generate_matrix( params.matrix, m, n, &A_tst[0], lda );
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, B.size(), &B[0] );
+    A_ref = A_tst;
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A m=%5lld, n=%5lld, lda=%5lld\n"
+                "B m=%5lld, nrhs=%5lld, ldb=%5lld\n",
+                llong( m ), llong( n ), llong( lda ),
+                llong( m ), llong( nrhs ), llong( ldb ) );
+    }
+    if (verbose >= 2) {
+        printf( "A = " ); print_matrix( m, n, &A_tst[0], lda );
+        printf( "B = " ); print_matrix( m, nrhs, &B[0], ldb );
+    }
+
+    // test error exits
+    int64_t iter = 0;
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::gels_mixed( -1,  n, nrhs, &A_tst[0], lda, &B[0], ldb, &X_tst[0], ldx, &iter ), lapack::Error );
+        assert_throw( lapack::gels_mixed(  m, -1, nrhs, &A_tst[0], lda, &B[0], ldb, &X_tst[0], ldx, &iter ), lapack::Error );
+        assert_throw( lapack::gels_mixed(  m, m+1, nrhs, &A_tst[0], lda, &B[0], ldb, &X_tst[0], ldx, &iter ), lapack::Error );
+        assert_throw( lapack::gels_mixed(  m,  n,   -1, &A_tst[0], lda, &B[0], ldb, &X_tst[0], ldx, &iter ), lapack::Error );
+        assert_throw( lapack::gels_mixed(  m,  n, nrhs, &A_tst[0], m-1, &B[0], ldb, &X_tst[0], ldx, &iter ), lapack::Error );
+        assert_throw( lapack::gels_mixed(  m,  n, nrhs, &A_tst[0], lda, &B[0], m-1, &X_tst[0], ldx, &iter ), lapack::Error );
+        assert_throw( lapack::gels_mixed(  m,  n, nrhs, &A_tst[0], lda, &B[0], ldb, &X_tst[0], n-1, &iter ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    int64_t info_tst = lapack::gels_mixed( m, n, nrhs, &A_tst[0], lda,
+                                           &B[0], ldb, &X_tst[0], ldx, &iter );
+    time = testsweeper::get_wtime() - time;
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::gels_mixed returned error %lld\n", llong( info_tst ) );
+    }
+
+    params.time() = time;
+    params.iters() = iter;
+
+    if (verbose >= 2) {
+        printf( "X = " ); print_matrix( n, nrhs, &X_tst[0], ldx );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Residual orthogonal to range( A ), the same test as for gels
+        // in double precision.
+        real_t error[2];
+        check_gels( false, lapack::Op::NoTrans, m, n, nrhs,
+                    &A_ref[0], lda,
+                    &X_tst[0], ldx,
+                    &B[0], ldb,
+                    error );
+        params.error() = error[0];
+        params.error2() = gels_residual( m, n, nrhs, &A_ref[0], lda,
+                                         &X_tst[0], ldx, &B[0], ldb );
+        params.okay() = (error[0] < tol);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference: lapack::gels in double precision
+        std::vector< scalar_t > A_ref2 = A_ref;
+        B_ref = B;
+
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = lapack::gels( lapack::Op::NoTrans, m, n, nrhs,
+                                         &A_ref2[0], lda, &B_ref[0], ldb );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "lapack::gels returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+        params.speedup() = params.ref_time() / params.time();
+        // The residual of the mixed solution should match this one.
+        params.error3() = gels_residual( m, n, nrhs, &A_ref[0], lda,
+                                         &B_ref[0], ldb, &B[0], ldb );
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_gels_mixed( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Double:
+            test_gels_mixed_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_gels_mixed_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
@@ -10,8 +10,39 @@
 #include "error.hh"
 #include "lapacke_wrappers.hh"
 
+#include <memory_resource>
+#include <string>
 #include <vector>
 
+// -----------------------------------------------------------------------------
+// Memory resource that counts outstanding allocations.
+class CountingResource: public std::pmr::memory_resource
+{
+public:
+    int64_t allocs = 0;
+    int64_t live = 0;
+
+private:
+    void* do_allocate( size_t bytes, size_t align ) override
+    {
+        ++allocs;
+        ++live;
+        return std::pmr::new_delete_resource()->allocate( bytes, align );
+    }
+
+    void do_deallocate( void* ptr, size_t bytes, size_t align ) override
+    {
+        --live;
+        std::pmr::new_delete_resource()->deallocate( ptr, bytes, align );
+    }
+
+    bool do_is_equal( std::pmr::memory_resource const& other )
+        const noexcept override
+    {
+        return this == &other;
+    }
+};
+
 // -----------------------------------------------------------------------------
 template< typename scalar_t >
 void test_geqrf_work( Params& params, bool run )
@@ -51,10 +82,12 @@ void test_geqrf_work( Params& params, bool run )
     A_ref = A_tst;
 
     // ---------- run test
+    auto stats_before = lapack::stats();
     testsweeper::flush_cache( params.cache() );
     double time = testsweeper::get_wtime();
     int64_t info_tst = lapack::geqrf( m, n, &A_tst[0], lda, &tau_tst[0] );
     time = testsweeper::get_wtime() - time;
+    auto stats_after = lapack::stats();
     if (info_tst != 0) {
         fprintf( stderr, "lapack::geqrf returned error %lld\n", llong( info_tst ) );
     }
@@ -108,9 +141,60 @@ void test_geqrf_work( Params& params, bool run )
         real_t resid2 = lapack::lanhe( lapack::Norm::One, lapack::Uplo::Upper, minmn, &R[0], ldr );
         real_t error2 = ( resid2 / n );
 
+        // Caller-supplied workspace should give an identical factorization.
+        std::vector< scalar_t > A_ws = A_ref;
+        std::vector< scalar_t > tau_ws( size_tau );
+        int64_t lwork;
+        lapack::geqrf_work_size( m, n, &A_ws[0], lda, &tau_ws[0], &lwork );
+        std::vector< scalar_t > work( lwork );
+        lapack::geqrf( m, n, &A_ws[0], lda, &tau_ws[0], &work[0], lwork );
+        bool same = (A_ws == A_tst && tau_ws == tau_tst);
+
+        // Workspace-size cache should return the same lwork, from a hit.
+        bool cache_enabled = lapack::work_size_cache_enabled();
+        lapack::work_size_cache_enable( true );
+        int64_t lwork_1, lwork_2;
+        lapack::geqrf_work_size( m, n, &A_ws[0], lda, &tau_ws[0], &lwork_1 );
+        int64_t hits = lapack::work_size_cache_hits();
+        lapack::geqrf_work_size( m, n, &A_ws[0], lda, &tau_ws[0], &lwork_2 );
+        same = same && lwork_1 == lwork && lwork_2 == lwork
+                    && lapack::work_size_cache_hits() == hits + 1;
+        lapack::work_size_cache_enable( cache_enabled );
+
+        // Workspace should come from, and be returned to, the memory
+        // resource set by the guard.
+        if (! lapack::workspace_arena_enabled()) {
+            CountingResource resource;
+            {
+                lapack::MemoryResourceGuard guard( &resource );
+                A_ws = A_ref;
+                lapack::geqrf( m, n, &A_ws[0], lda, &tau_ws[0] );
+            }
+            same = same && A_ws == A_tst && resource.allocs > 0
+                        && resource.live == 0;
+        }
+
         params.error() = error1;
         params.ortho() = error2;
-        params.okay() = (error1 < tol) && (error2 < tol);
+        params.okay() = (error1 < tol) && (error2 < tol) && same;
+    }
+
+    if (params.stats() == 'y') {
+        // The call should be counted once, under its own precision's name,
+        // e.g., zgeqrf, not dgeqrf.
+        char prec = blas::is_complex< scalar_t >::value
+                  ? (sizeof( real_t ) == sizeof( float ) ? 'c' : 'z')
+                  : (sizeof( real_t ) == sizeof( float ) ? 's' : 'd');
+        bool counted = true;
+        for (char p : { 's', 'd', 'c', 'z' }) {
+            std::string name = std::string( 1, p ) + "geqrf";
+            int64_t calls = stats_after[ name ].calls - stats_before[ name ].calls;
+            counted = counted && calls == (p == prec ? 1 : 0);
+        }
+        if (! counted) {
+            fprintf( stderr, "lapack::geqrf not counted once as %cgeqrf\n", prec );
+        }
+        params.okay() = params.okay() && counted;
     }
 
     if (params.ref() == 'y') {
@@ -0,0 +1,212 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+
+#include <vector>
+
+#if LAPACK_VERSION >= 30400  // >= 3.4.0
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_geqrf_tsqr_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t threads = params.threads();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.ref_gflops();
+    params.gflops();
+    params.speedup();
+    params.ortho();
+    params.error2();
+    params.error2.name( "apply error" );
+
+    if (! run)
+        return;
+
+    if (m < n) {
+        printf( "skipping because geqrf_tsqr requires m >= n\n" );
+        return;
+    }
+
+    // Sweeping --threads 1,2,4,... reports the scaling; the reference is
+    // geqrf, so speedup = ref_time / time.
+    int threads_save = lapack::get_num_threads();
+    if (threads > 0)
+        lapack::set_num_threads( threads );
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, m ), align );
+    size_t size_A = (size_t) lda * n;
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > A_ref( size_A );
+    std::vector< scalar_t > T_tst( 1 );
+
+    lapack::generate_matrix( params.matrix, m, n, &A_tst[0], lda );
+    A_ref = A_tst;
+
+    // query for T size
+    lapack::geqrf_tsqr( m, n, &A_tst[0], lda, &T_tst[0], -1 );
+    int64_t tsize = std::real( T_tst[0] );
+    T_tst.resize( tsize );
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A m=%5lld, n=%5lld, lda=%5lld, tsize=%lld, threads=%d\n",
+                llong( m ), llong( n ), llong( lda ), llong( tsize ),
+                lapack::get_num_threads() );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::geqrf_tsqr(  m, -1, &A_tst[0], lda, &T_tst[0], tsize ), lapack::Error );
+        assert_throw( lapack::geqrf_tsqr( n-1, n, &A_tst[0], lda, &T_tst[0], tsize ), lapack::Error );
+        assert_throw( lapack::geqrf_tsqr(  m,  n, &A_tst[0], m-1, &T_tst[0], tsize ), lapack::Error );
+        assert_throw( lapack::geqrf_tsqr(  m,  n, &A_tst[0], lda, &T_tst[0], tsize-1 ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    int64_t info_tst = lapack::geqrf_tsqr( m, n, &A_tst[0], lda, &T_tst[0], tsize );
+    time = testsweeper::get_wtime() - time;
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::geqrf_tsqr returned error %lld\n", llong( info_tst ) );
+    }
+
+    params.time() = time;
+    double gflop = lapack::Gflop< scalar_t >::geqrf( m, n );
+    params.gflops() = gflop / time;
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // As in test_geqrf, following lapack/TESTING/LIN/zqrt01.f,
+        // with Q's first n columns formed by gemqr_tsqr.
+        int64_t ldq = m;
+        std::vector< scalar_t > Q( m * n ); // m by n
+        int64_t ldr = n;
+        std::vector< scalar_t > R( n * n ); // n by n
+
+        lapack::laset( lapack::MatrixType::General, m, n, 0.0, 1.0, &Q[0], ldq );
+        lapack::gemqr_tsqr( lapack::Side::Left, lapack::Op::NoTrans, m, n, n,
+                            &A_tst[0], lda, &T_tst[0], tsize, &Q[0], ldq );
+
+        // Copy R
+        lapack::laset( lapack::MatrixType::Lower, n, n, 0.0, 0.0, &R[0], ldr );
+        lapack::lacpy( lapack::MatrixType::Upper, n, n, &A_tst[0], lda, &R[0], ldr );
+
+        // Compute R - Q'*A
+        blas::gemm( blas::Layout::ColMajor,
+                    blas::Op::ConjTrans, blas::Op::NoTrans, n, n, m,
+                    -1.0, &Q[0], ldq, &A_ref[0], lda, 1.0, &R[0], ldr );
+
+        // Compute norm( R - Q'*A ) / ( N * norm(A) * EPS )
+        real_t Anorm = lapack::lange( lapack::Norm::One, m, n, &A_ref[0], lda );
+        real_t resid1 = lapack::lange( lapack::Norm::One, n, n, &R[0], ldr );
+        real_t error1 = 0;
+        if (Anorm > 0)
+            error1 = resid1 / ( n * Anorm );
+
+        // Compute I - Q'*Q
+        lapack::laset( lapack::MatrixType::Upper, n, n, 0.0, 1.0, &R[0], ldr );
+        blas::herk( blas::Layout::ColMajor, blas::Uplo::Upper, blas::Op::ConjTrans,
+                    n, m, -1.0, &Q[0], ldq, 1.0, &R[0], ldr );
+
+        // Compute norm( I - Q'*Q ) / ( N * EPS ) .
+        real_t resid2 = lapack::lanhe( lapack::Norm::One, lapack::Uplo::Upper, n, &R[0], ldr );
+        real_t error2 = ( resid2 / n );
+
+        // Applying Q^H to A, as a least squares solve would, should
+        // give [ R; 0 ].
+        std::vector< scalar_t > C = A_ref;
+        lapack::gemqr_tsqr( lapack::Side::Left, lapack::Op::ConjTrans, m, n, n,
+                            &A_tst[0], lda, &T_tst[0], tsize, &C[0], lda );
+        for (int64_t j = 0; j < n; ++j) {
+            for (int64_t i = 0; i < blas::min( j+1, m ); ++i)
+                C[ i + j*lda ] -= A_tst[ i + j*lda ];
+        }
+        real_t resid3 = lapack::lange( lapack::Norm::One, m, n, &C[0], lda );
+        real_t error3 = 0;
+        if (Anorm > 0)
+            error3 = resid3 / ( n * Anorm );
+
+        params.error() = error1;
+        params.ortho() = error2;
+        params.error2() = error3;
+        params.okay() = (error1 < tol) && (error2 < tol) && (error3 < tol);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference: lapack::geqrf
+        std::vector< scalar_t > tau_ref( n );
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = lapack::geqrf( m, n, &A_ref[0], lda, &tau_ref[0] );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "lapack::geqrf returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+        params.ref_gflops() = gflop / time;
+        params.speedup() = params.ref_time() / params.time();
+    }
+
+    lapack::set_num_threads( threads_save );
+}
+
+// -----------------------------------------------------------------------------
+void test_geqrf_tsqr( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_geqrf_tsqr_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_geqrf_tsqr_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_geqrf_tsqr_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_geqrf_tsqr_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
+
+#else
+
+// -----------------------------------------------------------------------------
+void test_geqrf_tsqr( Params& params, bool run )
+{
+    fprintf( stderr, "geqrf_tsqr requires LAPACK >= 3.4.0\n\n" );
+    exit(0);
+}
+
+#endif  // LAPACK >= 3.4.0
@@ -37,6 +37,8 @@ void test_gesdd_work( Params& params, bool run )
     params.ortho_V();
     params.error2();
     params.error2.name( "Sigma" );
+    if (params.hugepage() == 'y')
+        params.speedup();
 
     if (! run)
         return;
@@ -73,6 +75,22 @@ void test_gesdd_work( Params& params, bool run )
     }
 
     params.time() = time;
+
+    if (params.hugepage() == 'y') {
+        // ---------- time again with huge-page workspace
+        std::vector< scalar_t > A_hp = A_ref;
+        std::vector< real_t > S_hp( size_S );
+        std::vector< scalar_t > U_hp( size_U );
+        std::vector< scalar_t > VT_hp( size_VT );
+        size_t threshold = lapack::get_huge_page_threshold();
+        lapack::set_huge_page_threshold( 2*1024*1024 );
+        testsweeper::flush_cache( params.cache() );
+        double time_hp = testsweeper::get_wtime();
+        lapack::gesdd( jobu, m, n, &A_hp[0], lda, &S_hp[0], &U_hp[0], ldu, &VT_hp[0], ldvt );
+        time_hp = testsweeper::get_wtime() - time_hp;
+        lapack::set_huge_page_threshold( threshold );
+        params.speedup() = time / time_hp;
+    }
     //double gflop = lapack::Gflop< scalar_t >::gesdd( jobu, m, n );
     //params.gflops() = gflop / time;
 
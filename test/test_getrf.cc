@@ -10,8 +10,64 @@
 #include "error.hh"
 #include "lapacke_wrappers.hh"
 
+#include <algorithm>
 #include <vector>
 
+// -----------------------------------------------------------------------------
+// Element growth factor of LU, max |U| / max |A|.
+template< typename scalar_t >
+blas::real_type< scalar_t > growth_factor(
+    int64_t m, int64_t n,
+    scalar_t const* LU, scalar_t const* A, int64_t lda )
+{
+    using real_t = blas::real_type< scalar_t >;
+    real_t Umax = lapack::lantr( lapack::Norm::Max, lapack::Uplo::Upper,
+                                 lapack::Diag::NonUnit, m, n, LU, lda );
+    real_t Amax = lapack::lange( lapack::Norm::Max, m, n, A, lda );
+    return (Amax == 0 ? 0 : Umax / Amax);
+}
+
+// -----------------------------------------------------------------------------
+// Relative backwards error = ||b - Ax|| / (n * ||A|| * ||x||),
+// solving with the LU factors and pivots from getrf or getrf_parallel.
+template< typename scalar_t >
+blas::real_type< scalar_t > getrf_backward_error(
+    int64_t n, scalar_t const* LU, int64_t const* ipiv,
+    scalar_t const* A, int64_t lda, int64_t align, int64_t verbose )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    int64_t nrhs = 1;
+    int64_t ldb = roundup( blas::max( 1, n ), align );
+    size_t size_B = (size_t) ldb * nrhs;
+    std::vector< scalar_t > B_tst( size_B );
+    std::vector< scalar_t > B_ref( size_B );
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, B_tst.size(), &B_tst[0] );
+    B_ref = B_tst;
+
+    int64_t info = lapack::getrs(
+        lapack::Op::NoTrans, n, nrhs, LU, lda, ipiv, &B_tst[0], ldb );
+    if (info != 0) {
+        fprintf( stderr, "lapack::getrs returned error %lld\n", llong( info ) );
+    }
+
+    blas::gemm( blas::Layout::ColMajor, blas::Op::NoTrans, blas::Op::NoTrans,
+                n, nrhs, n,
+                -1.0, A, lda,
+                      &B_tst[0], ldb,
+                 1.0, &B_ref[0], ldb );
+    if (verbose >= 2) {
+        printf( "R = " ); print_matrix( n, nrhs, &B_ref[0], ldb );
+    }
+
+    real_t error = lapack::lange( lapack::Norm::One, n, nrhs, &B_ref[0], ldb );
+    real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, &B_tst[0], ldb );
+    real_t Anorm = lapack::lange( lapack::Norm::One, n, n,    A, lda );
+    return error / (n * Anorm * Xnorm);
+}
+
 // -----------------------------------------------------------------------------
 template< typename scalar_t >
 void test_getrf_work( Params& params, bool run )
@@ -21,6 +77,7 @@ void test_getrf_work( Params& params, bool run )
     // get & mark input values
     int64_t m = params.dim.m();
     int64_t n = params.dim.n();
+    int64_t threads = params.threads();
     int64_t align = params.align();
     int64_t verbose = params.verbose();
     params.matrix.mark();
@@ -32,10 +89,25 @@ void test_getrf_work( Params& params, bool run )
     params.ref_time();
     params.ref_gflops();
     params.gflops();
+    params.growth();
+    if (params.tiled() == 'y') {
+        params.gflops2();
+        params.gflops2.name( "tiled gflop/s" );
+        params.speedup();
+        params.growth2();
+        params.growth2.name( "tiled growth" );
+        params.error2();
+        params.error2.name( "tiled error" );
+    }
 
     if (! run)
         return;
 
+    // Threads for getrf_parallel; lapack::getrf threads only in the BLAS.
+    int threads_save = lapack::get_num_threads();
+    if (threads > 0)
+        lapack::set_num_threads( threads );
+
     // ---------- setup
     int64_t lda = roundup( blas::max( 1, m ), align );
     size_t size_A = (size_t) lda * n;
@@ -63,6 +135,9 @@ void test_getrf_work( Params& params, bool run )
         assert_throw( lapack::getrf( -1,  n, &A_tst[0], lda, &ipiv_tst[0] ), lapack::Error );
         assert_throw( lapack::getrf(  m, -1, &A_tst[0], lda, &ipiv_tst[0] ), lapack::Error );
         assert_throw( lapack::getrf(  m,  n, &A_tst[0], m-1, &ipiv_tst[0] ), lapack::Error );
+        assert_throw( lapack::getrf_parallel( -1,  n, &A_tst[0], lda, &ipiv_tst[0] ), lapack::Error );
+        assert_throw( lapack::getrf_parallel(  m, -1, &A_tst[0], lda, &ipiv_tst[0] ), lapack::Error );
+        assert_throw( lapack::getrf_parallel(  m,  n, &A_tst[0], m-1, &ipiv_tst[0] ), lapack::Error );
     }
 
     // ---------- run test
@@ -77,6 +152,29 @@ void test_getrf_work( Params& params, bool run )
     params.time() = time;
     double gflop = lapack::Gflop< scalar_t >::getrf( m, n );
     params.gflops() = gflop / time;
+    params.growth() = growth_factor( m, n, &A_tst[0], &A_ref[0], lda );
+
+    // Tiled, task-parallel variant with tournament pivoting (CALU).
+    // Its pivots generally differ from getrf's, so it is checked separately.
+    std::vector< scalar_t > A_tile;
+    std::vector< int64_t > ipiv_tile;
+    if (params.tiled() == 'y') {
+        A_tile = A_ref;
+        ipiv_tile.resize( size_ipiv );
+        testsweeper::flush_cache( params.cache() );
+        double time_tile = testsweeper::get_wtime();
+        int64_t info_tile = lapack::getrf_parallel(
+            m, n, &A_tile[0], lda, &ipiv_tile[0] );
+        time_tile = testsweeper::get_wtime() - time_tile;
+        if (info_tile != info_tst) {
+            fprintf( stderr, "lapack::getrf_parallel returned error %lld, getrf %lld\n",
+                     llong( info_tile ), llong( info_tst ) );
+        }
+
+        params.gflops2() = gflop / time_tile;
+        params.speedup() = time / time_tile;
+        params.growth2() = growth_factor( m, n, &A_tile[0], &A_ref[0], lda );
+    }
 
     if (verbose >= 2) {
         printf( "A_factor = " ); print_matrix( m, n, &A_tst[0], lda );
@@ -84,39 +182,28 @@ void test_getrf_work( Params& params, bool run )
 
     if (params.check() == 'y' && m == n) {
         // ---------- check error
-        // Relative backwards error = ||b - Ax|| / (n * ||A|| * ||x||).
         // For m != n, could check PA - LU.
-        int64_t nrhs = 1;
-        int64_t ldb = roundup( blas::max( 1, n ), align );
-        size_t size_B = (size_t) ldb * nrhs;
-        std::vector< scalar_t > B_tst( size_B );
-        std::vector< scalar_t > B_ref( size_B );
-        int64_t idist = 1;
-        int64_t iseed[4] = { 0, 1, 2, 3 };
-        lapack::larnv( idist, iseed, B_tst.size(), &B_tst[0] );
-        B_ref = B_tst;
-
-        info_tst = lapack::getrs(
-            lapack::Op::NoTrans, n, nrhs, &A_tst[0], lda, &ipiv_tst[0], &B_tst[0], ldb );
-        if (info_tst != 0) {
-            fprintf( stderr, "lapack::getrs returned error %lld\n", llong( info_tst ) );
-        }
+        real_t error = getrf_backward_error(
+            n, &A_tst[0], &ipiv_tst[0], &A_ref[0], lda, align, verbose );
 
-        blas::gemm( blas::Layout::ColMajor, blas::Op::NoTrans, blas::Op::NoTrans,
-                    n, nrhs, n,
-                    -1.0, &A_ref[0], lda,
-                          &B_tst[0], ldb,
-                     1.0, &B_ref[0], ldb );
-        if (verbose >= 2) {
-            printf( "R = " ); print_matrix( n, nrhs, &B_ref[0], ldb );
-        }
+        // Native lapack_int pivots should give an identical factorization.
+        std::vector< scalar_t > A_nat = A_ref;
+        std::vector< lapack_int > ipiv_nat( size_ipiv );
+        lapack::getrf( m, n, &A_nat[0], lda, &ipiv_nat[0] );
+        bool same = (A_nat == A_tst)
+                    && std::equal( ipiv_nat.begin(), ipiv_nat.end(),
+                                   ipiv_tst.begin() );
 
-        real_t error = lapack::lange( lapack::Norm::One, n, nrhs, &B_ref[0], ldb );
-        real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, &B_tst[0], ldb );
-        real_t Anorm = lapack::lange( lapack::Norm::One, n, n,    &A_ref[0], lda );
-        error /= (n * Anorm * Xnorm);
         params.error() = error;
-        params.okay() = (error < tol);
+        params.okay() = (error < tol) && same;
+
+        if (params.tiled() == 'y') {
+            // getrs takes getrf_parallel's pivots unchanged.
+            real_t error2 = getrf_backward_error(
+                n, &A_tile[0], &ipiv_tile[0], &A_ref[0], lda, align, verbose );
+            params.error2() = error2;
+            params.okay() = params.okay() && (error2 < tol);
+        }
     }
 
     if (params.ref() == 'y') {
@@ -136,6 +223,8 @@ void test_getrf_work( Params& params, bool run )
             printf( "Aref_factor = " ); print_matrix( m, n, &A_ref[0], lda );
         }
     }
+
+    lapack::set_num_threads( threads_save );
 }
 
 // -----------------------------------------------------------------------------
@@ -0,0 +1,163 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+
+#include <algorithm>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_getrf_batch_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t batch = params.batch();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.gflops();
+    params.rate();
+    params.ref_time();
+    params.ref_rate();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, m ), align );
+    int64_t minmn = blas::min( m, n );
+    int64_t strideA = lda * n;
+    size_t size_A = (size_t) strideA * batch;
+    size_t size_ipiv = (size_t) minmn * batch;
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > A_ref( size_A );
+    std::vector< int64_t > ipiv_tst( size_ipiv );
+    std::vector< int64_t > ipiv_ref( size_ipiv );
+    std::vector< int64_t > info_tst( batch );
+
+    for (int64_t i = 0; i < batch; ++i) {
+        lapack::generate_matrix( params.matrix, m, n, &A_tst[ i*strideA ], lda );
+    }
+    A_ref = A_tst;
+    std::vector< scalar_t > A_ptr;
+    if (params.check() == 'y')
+        A_ptr = A_tst;
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A m=%5lld, n=%5lld, lda=%5lld, batch=%5lld, threads=%d\n",
+                llong( m ), llong( n ), llong( lda ), llong( batch ),
+                lapack::get_num_threads() );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::getrf_batch( -1,  n, &A_tst[0], lda, strideA, &ipiv_tst[0], minmn, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::getrf_batch(  m, -1, &A_tst[0], lda, strideA, &ipiv_tst[0], minmn, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::getrf_batch(  m,  n, &A_tst[0], m-1, strideA, &ipiv_tst[0], minmn, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::getrf_batch(  m,  n, &A_tst[0], lda, strideA, &ipiv_tst[0], minmn,    -1, &info_tst[0] ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    int64_t nsingular = lapack::getrf_batch(
+        m, n, &A_tst[0], lda, strideA, &ipiv_tst[0], minmn,
+        batch, &info_tst[0] );
+    time = testsweeper::get_wtime() - time;
+    if (nsingular != 0) {
+        fprintf( stderr, "lapack::getrf_batch returned %lld singular matrices\n",
+                 llong( nsingular ) );
+    }
+
+    params.time() = time;
+    double gflop = batch * lapack::Gflop< scalar_t >::getrf( m, n );
+    params.gflops() = gflop / time;
+    params.rate() = batch / time;
+
+    if (params.check() == 'y' || params.ref() == 'y') {
+        // ---------- run reference: lapack::getrf in a loop
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        for (int64_t i = 0; i < batch; ++i) {
+            lapack::getrf( m, n, &A_ref[ i*strideA ], lda, &ipiv_ref[ i*minmn ] );
+        }
+        time = testsweeper::get_wtime() - time;
+
+        params.ref_time() = time;
+        params.ref_rate() = batch / time;
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Pointer-array form should give the same factors.
+        std::vector< int64_t > ipiv_ptr( size_ipiv );
+        std::vector< scalar_t* > Aarray( batch );
+        std::vector< int64_t* > ipiv_array( batch );
+        for (int64_t i = 0; i < batch; ++i) {
+            Aarray[ i ] = &A_ptr[ i*strideA ];
+            ipiv_array[ i ] = &ipiv_ptr[ i*minmn ];
+        }
+        lapack::getrf_batch( m, n, &Aarray[0], lda, &ipiv_array[0],
+                             batch, &info_tst[0] );
+        bool same = (ipiv_ptr == ipiv_tst) && (A_ptr == A_tst);
+
+        // Each matrix is factored by the same LAPACK routine as the loop,
+        // so factors should agree to rounding; pivots exactly.
+        real_t error = 0;
+        for (int64_t i = 0; i < batch; ++i) {
+            real_t Anorm = lapack::lange( lapack::Norm::One, m, n, &A_ref[ i*strideA ], lda );
+            blas::axpy( strideA, -1.0, &A_ref[ i*strideA ], 1, &A_tst[ i*strideA ], 1 );
+            real_t diff = lapack::lange( lapack::Norm::One, m, n, &A_tst[ i*strideA ], lda );
+            if (Anorm != 0)
+                diff /= Anorm;
+            error = std::max( error, diff );
+        }
+        same = same && (ipiv_tst == ipiv_ref);
+
+        params.error() = error;
+        params.okay() = (error < tol) && same;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_getrf_batch( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_getrf_batch_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_getrf_batch_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_getrf_batch_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_getrf_batch_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
@@ -0,0 +1,232 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "check_gtsv.hh"
+
+#include <algorithm>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_gtsv_batch_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    lapack::Op trans = params.trans();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t batch = params.batch();
+    int64_t lanes = params.lanes();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.rate();
+    params.ref_time();
+    params.ref_rate();
+    params.error2();
+    params.error2.name( "trs error" );
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t n1 = blas::max( 0, n-1 );
+    int64_t strideD = roundup( blas::max( 1, n ), align );
+    int64_t ldb = roundup( blas::max( 1, n ), align );
+    int64_t strideB = ldb * nrhs;
+    size_t size_D = (size_t) strideD * batch;
+    size_t size_B = (size_t) strideB * batch;
+
+    std::vector< scalar_t > DL( size_D ), D( size_D ), DU( size_D );
+    std::vector< scalar_t > B( size_B );
+
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, DL.size(), &DL[0] );
+    lapack::larnv( idist, iseed, D.size(), &D[0] );
+    lapack::larnv( idist, iseed, DU.size(), &DU[0] );
+    lapack::larnv( idist, iseed, B.size(), &B[0] );
+
+    std::vector< scalar_t > DL_tst = DL, D_tst = D, DU_tst = DU, B_tst = B;
+    std::vector< scalar_t > DL_ref = DL, D_ref = D, DU_ref = DU, B_ref = B;
+    std::vector< int64_t > info_tst( batch ), info_ref( batch );
+
+    // Interleaved copies; lanes == 0 tests the strided form.
+    int64_t nblocks = lanes > 0 ? (batch + lanes - 1) / lanes : 0;
+    std::vector< scalar_t > DL_int, D_int, DU_int, B_int;
+    if (lanes > 0) {
+        DL_int.resize( blas::max( 1, nblocks * n1*lanes ) );
+        D_int .resize( blas::max( 1, nblocks * n*lanes ) );
+        DU_int.resize( blas::max( 1, nblocks * n1*lanes ) );
+        B_int .resize( blas::max( 1, nblocks * n*nrhs*lanes ) );
+        lapack::batch_interleave( n1, 1, &DL[0], strideD, strideD, batch, &DL_int[0], lanes );
+        lapack::batch_interleave( n,  1, &D[0],  strideD, strideD, batch, &D_int[0],  lanes );
+        lapack::batch_interleave( n1, 1, &DU[0], strideD, strideD, batch, &DU_int[0], lanes );
+        lapack::batch_interleave( n, nrhs, &B[0], ldb, strideB, batch, &B_int[0], lanes );
+    }
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A n=%5lld, nrhs=%5lld, batch=%5lld, lanes=%3lld, threads=%d\n",
+                llong( n ), llong( nrhs ), llong( batch ), llong( lanes ),
+                lapack::get_num_threads() );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::gtsv_batch( -1, nrhs, &DL_tst[0], &D_tst[0], &DU_tst[0], strideD, &B_tst[0], ldb, strideB, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::gtsv_batch(  n,   -1, &DL_tst[0], &D_tst[0], &DU_tst[0], strideD, &B_tst[0], ldb, strideB, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::gtsv_batch(  n, nrhs, &DL_tst[0], &D_tst[0], &DU_tst[0],     n-1, &B_tst[0], ldb, strideB, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::gtsv_batch(  n, nrhs, &DL_tst[0], &D_tst[0], &DU_tst[0], strideD, &B_tst[0], n-1, strideB, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::gtsv_batch(  n, nrhs, &DL_tst[0], &D_tst[0], &DU_tst[0], strideD, &B_tst[0], ldb, strideB,    -1, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::gtsv_batch_interleaved( n, nrhs, &DL_tst[0], &D_tst[0], &DU_tst[0], &B_tst[0], 0, batch, &info_tst[0] ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    int64_t nsingular;
+    if (lanes > 0) {
+        nsingular = lapack::gtsv_batch_interleaved(
+            n, nrhs, &DL_int[0], &D_int[0], &DU_int[0], &B_int[0],
+            lanes, batch, &info_tst[0] );
+    }
+    else {
+        nsingular = lapack::gtsv_batch(
+            n, nrhs, &DL_tst[0], &D_tst[0], &DU_tst[0], strideD,
+            &B_tst[0], ldb, strideB, batch, &info_tst[0] );
+    }
+    time = testsweeper::get_wtime() - time;
+    if (nsingular != 0) {
+        fprintf( stderr, "lapack::gtsv_batch returned %lld singular systems\n",
+                 llong( nsingular ) );
+    }
+
+    params.time() = time;
+    params.rate() = batch / time;
+
+    if (params.check() == 'y' || params.ref() == 'y') {
+        // ---------- run reference: lapack::gtsv in a loop
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        for (int64_t i = 0; i < batch; ++i) {
+            info_ref[ i ] = lapack::gtsv(
+                n, nrhs, &DL_ref[ i*strideD ], &D_ref[ i*strideD ],
+                &DU_ref[ i*strideD ], &B_ref[ i*strideB ], ldb );
+        }
+        time = testsweeper::get_wtime() - time;
+
+        params.ref_time() = time;
+        params.ref_rate() = batch / time;
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        if (lanes > 0) {
+            lapack::batch_deinterleave( n, nrhs, &B_int[0], lanes, batch,
+                                        &B_tst[0], ldb, strideB );
+        }
+
+        // Backward error of each solution, with the original A and B.
+        real_t error = 0;
+        for (int64_t i = 0; i < batch; ++i) {
+            if (info_ref[ i ] != 0)
+                continue;
+            error = std::max( error, check_gtsv(
+                lapack::Op::NoTrans, n, nrhs,
+                &DL[ i*strideD ], &D[ i*strideD ], &DU[ i*strideD ],
+                &B_tst[ i*strideB ], ldb, &B[ i*strideB ], ldb ) );
+        }
+
+        // Factor with gttrf_batch, then solve op(A) X = B with
+        // gttrs_batch, in the same layout.
+        std::vector< scalar_t > DU2( size_D );
+        std::vector< int64_t > ipiv( size_D );
+        DL_tst = DL;
+        D_tst = D;
+        DU_tst = DU;
+        B_tst = B;
+        if (lanes > 0) {
+            int64_t n2 = blas::max( 0, n-2 );
+            std::vector< scalar_t > DU2_int( blas::max( 1, nblocks * n2*lanes ) );
+            std::vector< int64_t > ipiv_int( blas::max( 1, nblocks * n*lanes ) );
+            lapack::batch_interleave( n1, 1, &DL[0], strideD, strideD, batch, &DL_int[0], lanes );
+            lapack::batch_interleave( n,  1, &D[0],  strideD, strideD, batch, &D_int[0],  lanes );
+            lapack::batch_interleave( n1, 1, &DU[0], strideD, strideD, batch, &DU_int[0], lanes );
+            lapack::batch_interleave( n, nrhs, &B[0], ldb, strideB, batch, &B_int[0], lanes );
+            lapack::gttrf_batch_interleaved(
+                n, &DL_int[0], &D_int[0], &DU_int[0], &DU2_int[0],
+                &ipiv_int[0], lanes, batch, &info_tst[0] );
+            lapack::gttrs_batch_interleaved(
+                trans, n, nrhs, &DL_int[0], &D_int[0], &DU_int[0],
+                &DU2_int[0], &ipiv_int[0], &B_int[0], lanes, batch );
+            lapack::batch_deinterleave( n, nrhs, &B_int[0], lanes, batch,
+                                        &B_tst[0], ldb, strideB );
+        }
+        else {
+            lapack::gttrf_batch(
+                n, &DL_tst[0], &D_tst[0], &DU_tst[0], &DU2[0], strideD,
+                &ipiv[0], batch, &info_tst[0] );
+            lapack::gttrs_batch(
+                trans, n, nrhs, &DL_tst[0], &D_tst[0], &DU_tst[0], &DU2[0],
+                strideD, &ipiv[0], &B_tst[0], ldb, strideB, batch );
+        }
+        real_t error2 = 0;
+        for (int64_t i = 0; i < batch; ++i) {
+            if (info_ref[ i ] != 0)
+                continue;
+            error2 = std::max( error2, check_gtsv(
+                trans, n, nrhs,
+                &DL[ i*strideD ], &D[ i*strideD ], &DU[ i*strideD ],
+                &B_tst[ i*strideB ], ldb, &B[ i*strideB ], ldb ) );
+        }
+
+        // Exact zero pivots are found by both.
+        int64_t nmismatch = 0;
+        for (int64_t i = 0; i < batch; ++i) {
+            if (info_ref[ i ] != 0)
+                nmismatch += (info_tst[ i ] != info_ref[ i ]);
+        }
+
+        params.error() = error;
+        params.error2() = error2;
+        params.okay() = (error < tol) && (error2 < tol) && (nmismatch == 0);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_gtsv_batch( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_gtsv_batch_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_gtsv_batch_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_gtsv_batch_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_gtsv_batch_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
@@ -0,0 +1,141 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "check_gtsv.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_gtsv_parallel_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t threads = params.threads();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.speedup();
+
+    if (! run)
+        return;
+
+    // Sweeping --threads 1,2,4,... reports the scaling; the reference is
+    // sequential gtsv, so speedup = ref_time / time.
+    int threads_save = lapack::get_num_threads();
+    if (threads > 0)
+        lapack::set_num_threads( threads );
+
+    // ---------- setup
+    int64_t ldb = roundup( blas::max( 1, n ), align );
+    size_t size_D = (size_t) blas::max( 1, n );
+    size_t size_B = (size_t) ldb * nrhs;
+
+    std::vector< scalar_t > DL( size_D ), D( size_D ), DU( size_D );
+    std::vector< scalar_t > B( size_B );
+
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, DL.size(), &DL[0] );
+    lapack::larnv( idist, iseed, D.size(), &D[0] );
+    lapack::larnv( idist, iseed, DU.size(), &DU[0] );
+    lapack::larnv( idist, iseed, B.size(), &B[0] );
+
+    std::vector< scalar_t > DL_tst = DL, D_tst = D, DU_tst = DU, B_tst = B;
+    std::vector< scalar_t > DL_ref = DL, D_ref = D, DU_ref = DU, B_ref = B;
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A n=%5lld, nrhs=%5lld, ldb=%5lld, threads=%d\n",
+                llong( n ), llong( nrhs ), llong( ldb ),
+                lapack::get_num_threads() );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::gtsv_parallel( -1, nrhs, &DL_tst[0], &D_tst[0], &DU_tst[0], &B_tst[0], ldb ), lapack::Error );
+        assert_throw( lapack::gtsv_parallel(  n,   -1, &DL_tst[0], &D_tst[0], &DU_tst[0], &B_tst[0], ldb ), lapack::Error );
+        assert_throw( lapack::gtsv_parallel(  n, nrhs, &DL_tst[0], &D_tst[0], &DU_tst[0], &B_tst[0], n-1 ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    int64_t info_tst = lapack::gtsv_parallel(
+        n, nrhs, &DL_tst[0], &D_tst[0], &DU_tst[0], &B_tst[0], ldb );
+    time = testsweeper::get_wtime() - time;
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::gtsv_parallel returned error %lld\n", llong( info_tst ) );
+    }
+
+    params.time() = time;
+
+    if (params.check() == 'y' || params.ref() == 'y') {
+        // ---------- run reference: sequential lapack::gtsv
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = lapack::gtsv(
+            n, nrhs, &DL_ref[0], &D_ref[0], &DU_ref[0], &B_ref[0], ldb );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "lapack::gtsv returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+        params.speedup() = params.ref_time() / params.time();
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Pivoting stays inside partitions, so the factors and rounding
+        // differ from gtsv; check the backward error with the original A.
+        real_t error = check_gtsv(
+            lapack::Op::NoTrans, n, nrhs, &DL[0], &D[0], &DU[0],
+            &B_tst[0], ldb, &B[0], ldb );
+
+        params.error() = error;
+        params.okay() = (error < tol) && (info_tst == 0);
+    }
+
+    lapack::set_num_threads( threads_save );
+}
+
+// -----------------------------------------------------------------------------
+void test_gtsv_parallel( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_gtsv_parallel_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_gtsv_parallel_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_gtsv_parallel_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_gtsv_parallel_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
@@ -102,6 +102,29 @@ void test_heev_work( Params& params, bool run )
         params.okay()   = (jobz == Job::NoVec || result[ 0 ] < tol)
                        && (jobz == Job::NoVec || result[ 1 ] < tol)
                        && result[ 2 ] < tol;
+
+        // Caller-supplied workspace should give identical results.
+        std::vector< scalar_t > Z_ws = A;
+        std::vector< real_t > Lambda_ws( n );
+        int64_t lwork;
+        if constexpr (blas::is_complex< scalar_t >::value) {
+            int64_t lrwork;
+            lapack::heev_work_size( jobz, uplo, n, &Z_ws[0], lda,
+                                    &Lambda_ws[0], &lwork, &lrwork );
+            std::vector< scalar_t > work( lwork );
+            std::vector< real_t > rwork( lrwork );
+            lapack::heev( jobz, uplo, n, &Z_ws[0], lda, &Lambda_ws[0],
+                          &work[0], lwork, &rwork[0], lrwork );
+        }
+        else {
+            lapack::heev_work_size( jobz, uplo, n, &Z_ws[0], lda,
+                                    &Lambda_ws[0], &lwork );
+            std::vector< scalar_t > work( lwork );
+            lapack::heev( jobz, uplo, n, &Z_ws[0], lda, &Lambda_ws[0],
+                          &work[0], lwork );
+        }
+        params.okay() = params.okay()
+                        && Z_ws == Z && Lambda_ws == Lambda_tst;
     }
 
     if (params.ref() == 'y' || params.check() == 'y') {
@@ -0,0 +1,199 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "check_heev.hh"
+
+#include <algorithm>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_heev_small_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using lapack::Job;
+
+    // get & mark input values
+    lapack::Job jobz = params.jobz();
+    lapack::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t batch = params.batch();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.rate();
+    params.ref_time();
+    params.ref_rate();
+    params.ortho();
+    params.error2();
+    params.error2.name( "Lambda" );
+
+    if (! run)
+        return;
+
+    if (n > 3) {
+        params.msg() = "skipping: requires n <= 3";
+        return;
+    }
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    int64_t strideA = lda * n;
+    int64_t strideW = n;
+    size_t size_A = (size_t) strideA * batch;
+    size_t size_W = (size_t) strideW * batch;
+
+    std::vector< scalar_t > A( size_A );
+    std::vector< scalar_t > Z_tst( size_A );
+    std::vector< scalar_t > Z_ref( size_A );
+    std::vector< real_t > Lambda_tst( size_W );
+    std::vector< real_t > Lambda_ref( size_W );
+    std::vector< int64_t > info_tst( batch );
+
+    for (int64_t i = 0; i < batch; ++i) {
+        lapack::generate_matrix( params.matrix, n, n, &A[ i*strideA ], lda );
+    }
+    Z_tst = A;
+    Z_ref = A;
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A n=%5lld, lda=%5lld, batch=%5lld, threads=%d\n",
+                llong( n ), llong( lda ), llong( batch ),
+                lapack::get_num_threads() );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::heev_small_batch( Job(0), uplo,  n, &Z_tst[0], lda, strideA, &Lambda_tst[0], strideW, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::heev_small_batch( jobz,   uplo,  4, &Z_tst[0], 4,   16,      &Lambda_tst[0], 4,       batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::heev_small_batch( jobz,   uplo,  n, &Z_tst[0], n-1, strideA, &Lambda_tst[0], strideW, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::heev_small_batch( jobz,   uplo,  n, &Z_tst[0], lda, strideA, &Lambda_tst[0], strideW,    -1, &info_tst[0] ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    int64_t nfailed = lapack::heev_small_batch(
+        jobz, uplo, n, &Z_tst[0], lda, strideA, &Lambda_tst[0], strideW,
+        batch, &info_tst[0] );
+    time = testsweeper::get_wtime() - time;
+    if (nfailed != 0) {
+        fprintf( stderr, "lapack::heev_small_batch returned %lld failures\n",
+                 llong( nfailed ) );
+    }
+
+    params.time() = time;
+    params.rate() = batch / time;
+
+    if (params.check() == 'y' || params.ref() == 'y') {
+        // ---------- run reference: lapack::heev in a loop
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        for (int64_t i = 0; i < batch; ++i) {
+            lapack::heev( jobz, uplo, n, &Z_ref[ i*strideA ], lda,
+                          &Lambda_ref[ i*strideW ] );
+        }
+        time = testsweeper::get_wtime() - time;
+
+        params.ref_time() = time;
+        params.ref_rate() = batch / time;
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check numerical error
+        // result[ 0 ] = || A - Z Lambda Z^H || / (n ||A||), if jobz != NoVec.
+        // result[ 1 ] = || I - Z^H Z || / n, if jobz != NoVec.
+        // result[ 2 ] = 0 if Lambda is in non-decreasing order, else > 0.
+        // Maximum over the batch.
+        real_t error = 0, ortho = 0, order = 0;
+        for (int64_t i = 0; i < batch; ++i) {
+            real_t result[ 3 ] = { 0, 0, 0 };
+            check_heev( jobz, uplo, n, &A[ i*strideA ], lda,
+                        n, &Lambda_tst[ i*strideW ], &Z_tst[ i*strideA ], lda,
+                        result );
+            if (jobz != Job::NoVec) {
+                error = std::max( error, result[ 0 ] );
+                ortho = std::max( ortho, result[ 1 ] );
+            }
+            order = std::max( order, result[ 2 ] );
+        }
+
+        // Eigenvalues compared to the loop.
+        real_t error2 = rel_error( Lambda_tst, Lambda_ref );
+
+        // For 2x2, the laev2_batch kernel behind heev_small_batch
+        // should match laev2 in a loop.
+        if (n == 2) {
+            std::vector< scalar_t > a( batch ), b( batch ), c( batch );
+            std::vector< scalar_t > sn1_tst( batch );
+            std::vector< real_t > rt1_tst( batch ), rt2_tst( batch ), cs1_tst( batch );
+            for (int64_t i = 0; i < batch; ++i) {
+                scalar_t const* Ai = &A[ i*strideA ];
+                a[ i ] = Ai[ 0 ];
+                b[ i ] = (uplo == lapack::Uplo::Lower
+                          ? blas::conj( Ai[ 1 ] ) : Ai[ lda ]);
+                c[ i ] = Ai[ 1 + lda ];
+            }
+            lapack::laev2_batch( batch, &a[0], &b[0], &c[0],
+                                 &rt1_tst[0], &rt2_tst[0], &cs1_tst[0],
+                                 &sn1_tst[0] );
+            for (int64_t i = 0; i < batch; ++i) {
+                real_t rt1, rt2, cs1;
+                scalar_t sn1;
+                lapack::laev2( a[ i ], b[ i ], c[ i ], &rt1, &rt2, &cs1, &sn1 );
+                real_t scale = std::max( std::abs( rt1 ), std::abs( rt2 ) );
+                if (scale == 0)
+                    scale = 1;
+                error2 = std::max( { error2,
+                                     std::abs( rt1 - rt1_tst[ i ] ) / scale,
+                                     std::abs( rt2 - rt2_tst[ i ] ) / scale,
+                                     std::abs( cs1 - cs1_tst[ i ] ),
+                                     std::abs( sn1 - sn1_tst[ i ] ) } );
+            }
+        }
+
+        params.error()  = error;
+        params.ortho()  = ortho;
+        params.error2() = std::max( error2, order );
+        params.okay()   = (error < tol) && (ortho < tol)
+                       && (params.error2() < tol) && (nfailed == 0);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_heev_small( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_heev_small_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_heev_small_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_heev_small_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_heev_small_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
@@ -39,6 +39,8 @@ void test_heevd_work( Params& params, bool run )
     params.ortho();
     params.error2();
     params.error2.name( "Lambda" );
+    if (params.hugepage() == 'y')
+        params.speedup();
 
     if (! run)
         return;
@@ -76,6 +78,20 @@ void test_heevd_work( Params& params, bool run )
     }
 
     params.time() = time;
+
+    if (params.hugepage() == 'y') {
+        // ---------- time again with huge-page workspace
+        std::vector< scalar_t > Z_hp = A;
+        std::vector< real_t > Lambda_hp( n );
+        size_t threshold = lapack::get_huge_page_threshold();
+        lapack::set_huge_page_threshold( 2*1024*1024 );
+        testsweeper::flush_cache( params.cache() );
+        double time_hp = testsweeper::get_wtime();
+        lapack::heevd( jobz, uplo, n, &Z_hp[0], lda, &Lambda_hp[0] );
+        time_hp = testsweeper::get_wtime() - time_hp;
+        lapack::set_huge_page_threshold( threshold );
+        params.speedup() = time / time_hp;
+    }
     // double gflop = lapack::Gflop< scalar_t >::heevd( jobz, n );
     // params.gflops() = gflop / time;
 
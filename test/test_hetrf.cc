@@ -39,11 +39,13 @@ void test_hetrf_work( Params& params, bool run )
 
     std::vector< scalar_t > A_tst( size_A );
     std::vector< scalar_t > A_ref( size_A );
+    std::vector< scalar_t > A_ws( size_A );
     std::vector< int64_t > ipiv_tst( size_ipiv );
     std::vector< lapack_int > ipiv_ref( size_ipiv );
 
     lapack::generate_matrix( params.matrix, n, n, &A_tst[0], lda );
     A_ref = A_tst;
+    A_ws = A_tst;
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
@@ -78,6 +80,15 @@ void test_hetrf_work( Params& params, bool run )
         }
         error += abs_error( A_tst, A_ref );
         error += abs_error( ipiv_tst, ipiv_ref );
+
+        // Caller-supplied workspace should give an identical factorization.
+        std::vector< lapack_int > ipiv_ws( size_ipiv );
+        int64_t lwork;
+        lapack::hetrf_work_size( uplo, n, &A_ws[0], lda, &lwork );
+        std::vector< scalar_t > work( lwork );
+        lapack::hetrf( uplo, n, &A_ws[0], lda, &ipiv_ws[0], &work[0], lwork );
+        error += abs_error( A_ws, A_ref );
+        error += abs_error( ipiv_ws, ipiv_ref );
         params.error() = error;
         params.okay() = (error == 0);  // expect lapackpp == lapacke
     }
@@ -0,0 +1,192 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_posv_mixed_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // Constants
+    const scalar_t one = 1.0;
+    const real_t   eps = std::numeric_limits< real_t >::epsilon();
+
+    // get & mark input values
+    lapack::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    bool gmres = (params.gmres() == 'y');
+    real_t tol = params.tol() * eps;
+    params.matrix.mark();
+
+    // mark non-standard output values
+    params.ref_time();
+    params.ref_gflops();
+    params.gflops();
+    params.speedup();
+    params.iters();
+    if (gmres)
+        params.gmres_iters();
+
+    if (! run) {
+        params.matrix.kind.set_default( "rand_dominant" );
+        return;
+    }
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    int64_t ldb = roundup( blas::max( 1, n ), align );
+    int64_t ldx = roundup( blas::max( 1, n ), align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_B = (size_t) ldb * nrhs;
+    size_t size_X = (size_t) ldx * nrhs;
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > A_ref( size_A );
+    std::vector< scalar_t > B( size_B );
+    std::vector< scalar_t > B_ref( size_B );
+    std::vector< scalar_t > X_tst( size_X );
+
+    lapack::generate_matrix( params.matrix, n, n, &A_tst[0], lda );
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, B.size(), &B[0] );
+    A_ref = A_tst;
+    B_ref = B;
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A n=%5lld, lda=%5lld\n"
+                "B n=%5lld, nrhs=%5lld, ldb=%5lld\n",
+                llong( n ), llong( lda ),
+                llong( n ), llong( nrhs ), llong( ldb ) );
+    }
+    if (verbose >= 2) {
+        printf( "A = " );
+        print_matrix( n, n, &A_tst[0], lda );
+        printf( "B = " );
+        print_matrix( n, nrhs, &B[0], ldb );
+    }
+
+    // GMRES-IR caps: refinement iterations, and GMRES iterations per
+    // refinement iteration and right-hand side.
+    int64_t itermax = 30;
+    int64_t gmres_itermax = 50;
+
+    // test error exits
+    int64_t iter = 0;
+    int64_t gmres_iter = 0;
+    if (params.error_exit() == 'y') {
+        using lapack::Uplo;
+        assert_throw( lapack::posv_mixed( Uplo(0),  n, nrhs, &A_tst[0], lda, &B[0], ldb, &X_tst[0], ldx, &iter ), lapack::Error );
+        assert_throw( lapack::posv_mixed( uplo,    -1, nrhs, &A_tst[0], lda, &B[0], ldb, &X_tst[0], ldx, &iter ), lapack::Error );
+        assert_throw( lapack::posv_mixed( uplo,     n,   -1, &A_tst[0], lda, &B[0], ldb, &X_tst[0], ldx, &iter ), lapack::Error );
+        assert_throw( lapack::posv_mixed( uplo,     n, nrhs, &A_tst[0], n-1, &B[0], ldb, &X_tst[0], ldx, &iter ), lapack::Error );
+        assert_throw( lapack::posv_mixed( uplo,     n, nrhs, &A_tst[0], lda, &B[0], n-1, &X_tst[0], ldx, &iter ), lapack::Error );
+        assert_throw( lapack::posv_mixed( uplo,     n, nrhs, &A_tst[0], lda, &B[0], ldb, &X_tst[0], n-1, &iter ), lapack::Error );
+        assert_throw( lapack::posv_mixed_gmres( uplo, n, nrhs, &A_tst[0], lda, &B[0], ldb, &X_tst[0], ldx, 0.0, -1, gmres_itermax, &iter, &gmres_iter ), lapack::Error );
+        assert_throw( lapack::posv_mixed_gmres( uplo, n, nrhs, &A_tst[0], lda, &B[0], ldb, &X_tst[0], ldx, 0.0, itermax,  0, &iter, &gmres_iter ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    int64_t info_tst;
+    if (gmres) {
+        info_tst = lapack::posv_mixed_gmres( uplo, n, nrhs, &A_tst[0], lda,
+                                             &B[0], ldb, &X_tst[0], ldx,
+                                             0.0, itermax, gmres_itermax,
+                                             &iter, &gmres_iter );
+    }
+    else {
+        info_tst = lapack::posv_mixed( uplo, n, nrhs, &A_tst[0], lda,
+                                       &B[0], ldb, &X_tst[0], ldx, &iter );
+    }
+    time = testsweeper::get_wtime() - time;
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::posv_mixed%s returned error %lld\n",
+                 (gmres ? "_gmres" : ""), llong( info_tst ) );
+    }
+
+    params.time() = time;
+    params.iters() = iter;
+    if (gmres)
+        params.gmres_iters() = gmres_iter;
+    double gflop = lapack::Gflop< scalar_t >::posv( n, nrhs );
+    params.gflops() = gflop / time;
+
+    if (verbose >= 2) {
+        printf( "X = " );
+        print_matrix( n, nrhs, &X_tst[0], ldx );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Relative backwards error = ||b - Ax|| / (n * ||A|| * ||x||),
+        // the same test as for posv in double precision.
+        blas::hemm( blas::Layout::ColMajor, blas::Side::Left, uplo,
+                    n, nrhs,
+                    -one, &A_ref[0], lda,
+                          &X_tst[0], ldx,
+                    one,  &B_ref[0], ldb );
+        if (verbose >= 2) {
+            printf( "R = " );
+            print_matrix( n, nrhs, &B_ref[0], ldb );
+        }
+
+        real_t error = lapack::lange( lapack::Norm::One, n, nrhs, &B_ref[0], ldb );
+        real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, &X_tst[0], ldx );
+        real_t Anorm = lapack::lanhe( lapack::Norm::One, uplo, n, &A_ref[0], lda );
+        error /= (n * Anorm * Xnorm);
+        params.error() = error;
+        params.okay() = (error < tol);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference: lapack::posv in double precision
+        B_ref = B;
+
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = lapack::posv( uplo, n, nrhs, &A_ref[0], lda,
+                                         &B_ref[0], ldb );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "lapack::posv returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+        params.ref_gflops() = gflop / time;
+        params.speedup() = params.ref_time() / params.time();
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_posv_mixed( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Double:
+            test_posv_mixed_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_posv_mixed_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
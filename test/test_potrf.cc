@@ -21,6 +21,7 @@ void test_potrf_work( Params& params, bool run )
     // get & mark input values
     lapack::Uplo uplo = params.uplo();
     int64_t n = params.dim.n();
+    int64_t threads = params.threads();
     int64_t align = params.align();
     int64_t verbose = params.verbose();
     params.matrix.mark();
@@ -32,12 +33,22 @@ void test_potrf_work( Params& params, bool run )
     params.ref_time();
     params.ref_gflops();
     params.gflops();
+    if (params.tiled() == 'y') {
+        params.gflops2();
+        params.gflops2.name( "tiled gflop/s" );
+        params.speedup();
+    }
 
     if (! run) {
         params.matrix.kind.set_default( "rand_dominant" );
         return;
     }
 
+    // Threads for potrf_parallel; lapack::potrf threads only in the BLAS.
+    int threads_save = lapack::get_num_threads();
+    if (threads > 0)
+        lapack::set_num_threads( threads );
+
     // ---------- setup
     int64_t lda = roundup( blas::max( 1, n ), align );
     size_t size_A = (size_t) lda * n;
@@ -63,6 +74,9 @@ void test_potrf_work( Params& params, bool run )
         assert_throw( lapack::potrf( Uplo(0),  n, &A_tst[0], lda ), lapack::Error );
         assert_throw( lapack::potrf( uplo,    -1, &A_tst[0], lda ), lapack::Error );
         assert_throw( lapack::potrf( uplo,     n, &A_tst[0], n-1 ), lapack::Error );
+        assert_throw( lapack::potrf_parallel( Uplo(0),  n, &A_tst[0], lda ), lapack::Error );
+        assert_throw( lapack::potrf_parallel( uplo,    -1, &A_tst[0], lda ), lapack::Error );
+        assert_throw( lapack::potrf_parallel( uplo,     n, &A_tst[0], n-1 ), lapack::Error );
     }
 
     // ---------- run test
@@ -78,6 +92,25 @@ void test_potrf_work( Params& params, bool run )
     double gflop = lapack::Gflop< scalar_t >::potrf( n );
     params.gflops() = gflop / time;
 
+    if (params.tiled() == 'y') {
+        // ---------- time tiled, task-parallel variant
+        // The error check below then covers its factor instead of potrf's.
+        std::vector< scalar_t > A_tile = A_ref;
+        testsweeper::flush_cache( params.cache() );
+        double time_tile = testsweeper::get_wtime();
+        int64_t info_tile = lapack::potrf_parallel( uplo, n, &A_tile[0], lda );
+        time_tile = testsweeper::get_wtime() - time_tile;
+        if (info_tile != info_tst) {
+            fprintf( stderr, "lapack::potrf_parallel returned error %lld, potrf %lld\n",
+                     llong( info_tile ), llong( info_tst ) );
+        }
+
+        params.gflops2() = gflop / time_tile;
+        params.speedup() = time / time_tile;
+        if (params.check() == 'y')
+            A_tst = A_tile;
+    }
+
     if (verbose >= 2) {
         printf( "A_factor = " ); print_matrix( n, n, &A_tst[0], lda );
     }
@@ -135,6 +168,8 @@ void test_potrf_work( Params& params, bool run )
             printf( "Aref_factor = " ); print_matrix( n, n, &A_ref[0], lda );
         }
     }
+
+    lapack::set_num_threads( threads_save );
 }
 
 // -----------------------------------------------------------------------------
@@ -0,0 +1,200 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+
+#include <algorithm>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_potrf_batch_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    lapack::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t batch = params.batch();
+    int64_t lanes = params.lanes();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.gflops();
+    params.rate();
+    params.ref_time();
+    params.ref_rate();
+
+    if (! run) {
+        params.matrix.kind.set_default( "rand_dominant" );
+        return;
+    }
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    int64_t ldb = lda;
+    int64_t strideA = lda * n;
+    int64_t strideB = ldb * nrhs;
+    size_t size_A = (size_t) strideA * batch;
+    size_t size_B = (size_t) strideB * batch;
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > A_ref( size_A );
+    std::vector< scalar_t > B_tst( size_B );
+    std::vector< scalar_t > B_ref( size_B );
+    std::vector< int64_t > info_tst( batch );
+
+    for (int64_t i = 0; i < batch; ++i) {
+        lapack::generate_matrix( params.matrix, n, n, &A_tst[ i*strideA ], lda );
+    }
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, B_tst.size(), &B_tst[0] );
+    A_ref = A_tst;
+    B_ref = B_tst;
+
+    // Interleaved copies; lanes == 0 tests the strided form.
+    std::vector< scalar_t > A_int, B_int;
+    if (lanes > 0) {
+        A_int.resize( blas::max( 1, (batch + lanes - 1) / lanes * n*n*lanes ) );
+        B_int.resize( blas::max( 1, (batch + lanes - 1) / lanes * n*nrhs*lanes ) );
+        lapack::batch_interleave( n, n, &A_tst[0], lda, strideA, batch,
+                                  &A_int[0], lanes );
+        lapack::batch_interleave( n, nrhs, &B_tst[0], ldb, strideB, batch,
+                                  &B_int[0], lanes );
+    }
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A n=%5lld, lda=%5lld, batch=%5lld, lanes=%3lld, threads=%d\n",
+                llong( n ), llong( lda ), llong( batch ), llong( lanes ),
+                lapack::get_num_threads() );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        using lapack::Uplo;
+        assert_throw( lapack::potrf_batch( Uplo(0),  n, &A_tst[0], lda, strideA, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::potrf_batch( uplo,    -1, &A_tst[0], lda, strideA, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::potrf_batch( uplo,     n, &A_tst[0], n-1, strideA, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::potrf_batch( uplo,     n, &A_tst[0], lda, strideA,    -1, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::potrf_batch_interleaved( uplo, n, &A_tst[0], 0, batch, &info_tst[0] ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    int64_t nfailed;
+    if (lanes > 0) {
+        nfailed = lapack::potrf_batch_interleaved(
+            uplo, n, &A_int[0], lanes, batch, &info_tst[0] );
+    }
+    else {
+        nfailed = lapack::potrf_batch(
+            uplo, n, &A_tst[0], lda, strideA, batch, &info_tst[0] );
+    }
+    time = testsweeper::get_wtime() - time;
+    if (nfailed != 0) {
+        fprintf( stderr, "lapack::potrf_batch returned %lld non-positive definite matrices\n",
+                 llong( nfailed ) );
+    }
+
+    params.time() = time;
+    double gflop = batch * lapack::Gflop< scalar_t >::potrf( n );
+    params.gflops() = gflop / time;
+    params.rate() = batch / time;
+
+    if (params.check() == 'y' || params.ref() == 'y') {
+        // ---------- run reference: lapack::potrf in a loop
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        for (int64_t i = 0; i < batch; ++i) {
+            lapack::potrf( uplo, n, &A_ref[ i*strideA ], lda );
+        }
+        time = testsweeper::get_wtime() - time;
+
+        params.ref_time() = time;
+        params.ref_rate() = batch / time;
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Solve with the batched factors and compare factors and solutions
+        // to the loop. The interleaved kernels use a different order of
+        // operations than LAPACK, so agreement is to rounding.
+        if (lanes > 0) {
+            lapack::potrs_batch_interleaved(
+                uplo, n, nrhs, &A_int[0], &B_int[0], lanes, batch );
+            lapack::batch_deinterleave( n, n, &A_int[0], lanes, batch,
+                                        &A_tst[0], lda, strideA );
+            lapack::batch_deinterleave( n, nrhs, &B_int[0], lanes, batch,
+                                        &B_tst[0], ldb, strideB );
+        }
+        else {
+            lapack::potrs_batch( uplo, n, nrhs, &A_tst[0], lda, strideA,
+                                 &B_tst[0], ldb, strideB, batch );
+        }
+
+        real_t error = 0;
+        for (int64_t i = 0; i < batch; ++i) {
+            lapack::potrs( uplo, n, nrhs, &A_ref[ i*strideA ], lda,
+                           &B_ref[ i*strideB ], ldb );
+
+            scalar_t* Ai = &A_tst[ i*strideA ];
+            scalar_t* Bi = &B_tst[ i*strideB ];
+            real_t Anorm = lapack::lanhe( lapack::Norm::One, uplo, n, &A_ref[ i*strideA ], lda );
+            real_t Bnorm = lapack::lange( lapack::Norm::One, n, nrhs, &B_ref[ i*strideB ], ldb );
+            blas::axpy( strideA, -1.0, &A_ref[ i*strideA ], 1, Ai, 1 );
+            blas::axpy( strideB, -1.0, &B_ref[ i*strideB ], 1, Bi, 1 );
+            real_t diffA = lapack::lanhe( lapack::Norm::One, uplo, n, Ai, lda );
+            real_t diffB = lapack::lange( lapack::Norm::One, n, nrhs, Bi, ldb );
+            if (Anorm != 0)
+                diffA /= Anorm;
+            if (Bnorm != 0)
+                diffB /= Bnorm;
+            error = std::max( { error, diffA, diffB } );
+        }
+        error /= blas::max( 1, n );
+
+        params.error() = error;
+        params.okay() = (error < tol) && (nfailed == 0);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_potrf_batch( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_potrf_batch_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_potrf_batch_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_potrf_batch_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_potrf_batch_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
@@ -0,0 +1,208 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Returns || A - F^H F || / (n || A ||) for upper F = U,
+// or || A - F F^H || / (n || A ||) for lower F = L.
+template< typename scalar_t >
+blas::real_type< scalar_t > potrf_backward_error(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t const* A, int64_t lda,
+    scalar_t const* F, int64_t ldf )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // Zero the other triangle of the factor so herk can use all of it.
+    std::vector< scalar_t > Fz( n*n );
+    std::vector< scalar_t > R( n*n );
+    lapack::MatrixType mtype = (uplo == lapack::Uplo::Lower
+                                ? lapack::MatrixType::Lower
+                                : lapack::MatrixType::Upper);
+    lapack::laset( lapack::MatrixType::General, n, n, 0.0, 0.0, &Fz[0], n );
+    lapack::lacpy( mtype, n, n, F, ldf, &Fz[0], n );
+    lapack::lacpy( mtype, n, n, A, lda, &R[0], n );
+
+    blas::herk( blas::Layout::ColMajor, uplo,
+                (uplo == lapack::Uplo::Lower ? blas::Op::NoTrans
+                                             : blas::Op::ConjTrans),
+                n, n, -1.0, &Fz[0], n, 1.0, &R[0], n );
+
+    real_t Anorm = lapack::lanhe( lapack::Norm::One, uplo, n, A, lda );
+    real_t Rnorm = lapack::lanhe( lapack::Norm::One, uplo, n, &R[0], n );
+    return (Anorm > 0 ? Rnorm / (n * Anorm) : Rnorm);
+}
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_potrf_update_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    lapack::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t k = params.dim.k();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.speedup();
+    params.error2();
+    params.error2.name( "downdate error" );
+
+    if (! run) {
+        params.matrix.kind.set_default( "rand_dominant" );
+        return;
+    }
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    int64_t ldx = roundup( blas::max( 1, n ), align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_X = (size_t) ldx * k;
+
+    std::vector< scalar_t > A( size_A );
+    std::vector< scalar_t > A_up( size_A );
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > X( size_X );
+
+    lapack::generate_matrix( params.matrix, n, n, &A[0], lda );
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, X.size(), &X[0] );
+
+    // A_up = A + X X^H
+    A_up = A;
+    blas::herk( blas::Layout::ColMajor, uplo, blas::Op::NoTrans,
+                n, k, 1.0, &X[0], ldx, 1.0, &A_up[0], lda );
+
+    A_tst = A;
+    int64_t info = lapack::potrf( uplo, n, &A_tst[0], lda );
+    if (info != 0) {
+        fprintf( stderr, "lapack::potrf returned error %lld\n", llong( info ) );
+    }
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A n=%5lld, lda=%5lld, k=%5lld\n",
+                llong( n ), llong( lda ), llong( k ) );
+    }
+    if (verbose >= 2) {
+        printf( "A = " ); print_matrix( n, n, &A[0], lda );
+        printf( "X = " ); print_matrix( n, k, &X[0], ldx );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        using lapack::Uplo;
+        assert_throw( lapack::potrf_update( Uplo(0), n,  k, &A_tst[0], lda, &X[0], ldx ), lapack::Error );
+        assert_throw( lapack::potrf_update( uplo,   -1,  k, &A_tst[0], lda, &X[0], ldx ), lapack::Error );
+        assert_throw( lapack::potrf_update( uplo,    n, -1, &A_tst[0], lda, &X[0], ldx ), lapack::Error );
+        assert_throw( lapack::potrf_update( uplo,    n,  k, &A_tst[0], n-1, &X[0], ldx ), lapack::Error );
+        assert_throw( lapack::potrf_update( uplo,    n,  k, &A_tst[0], lda, &X[0], n-1 ), lapack::Error );
+        assert_throw( lapack::potrf_downdate( Uplo(0), n,  k, &A_tst[0], lda, &X[0], ldx ), lapack::Error );
+        assert_throw( lapack::potrf_downdate( uplo,   -1,  k, &A_tst[0], lda, &X[0], ldx ), lapack::Error );
+        assert_throw( lapack::potrf_downdate( uplo,    n, -1, &A_tst[0], lda, &X[0], ldx ), lapack::Error );
+        assert_throw( lapack::potrf_downdate( uplo,    n,  k, &A_tst[0], n-1, &X[0], ldx ), lapack::Error );
+        assert_throw( lapack::potrf_downdate( uplo,    n,  k, &A_tst[0], lda, &X[0], n-1 ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    int64_t info_tst = lapack::potrf_update( uplo, n, k, &A_tst[0], lda, &X[0], ldx );
+    time = testsweeper::get_wtime() - time;
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::potrf_update returned error %lld\n", llong( info_tst ) );
+    }
+
+    params.time() = time;
+
+    if (verbose >= 2) {
+        printf( "A_update = " ); print_matrix( n, n, &A_tst[0], lda );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Backward error of the updated factor for A + X X^H.
+        real_t error = potrf_backward_error( uplo, n, &A_up[0], lda, &A_tst[0], lda );
+
+        // Downdating it again should give a factor of A.
+        int64_t info_dn = lapack::potrf_downdate( uplo, n, k, &A_tst[0], lda, &X[0], ldx );
+        if (info_dn != 0) {
+            fprintf( stderr, "lapack::potrf_downdate returned error %lld\n", llong( info_dn ) );
+        }
+        real_t error2 = potrf_backward_error( uplo, n, &A[0], lda, &A_tst[0], lda );
+
+        // Removing x = 2 a11^{1/2} e_1 leaves a11 - |x_1|^2 < 0, so the
+        // downdate must report the loss of positive definiteness and
+        // leave the factor unchanged.
+        bool okay_pd = true;
+        if (n > 0) {
+            std::vector< scalar_t > x( n, 0.0 );
+            x[ 0 ] = real_t( 2 ) * A_tst[ 0 ];
+            std::vector< scalar_t > A_save = A_tst;
+            int64_t info_pd = lapack::potrf_downdate( uplo, n, 1, &A_tst[0], lda, &x[0], n );
+            okay_pd = (info_pd == 1) && (A_tst == A_save);
+        }
+
+        params.error() = error;
+        params.error2() = error2;
+        params.okay() = (error < tol) && (error2 < tol) && (info_dn == 0)
+                        && okay_pd;
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference: refactor A + X X^H with lapack::potrf
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = lapack::potrf( uplo, n, &A_up[0], lda );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "lapack::potrf returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+        params.speedup() = params.ref_time() / params.time();
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_potrf_update( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_potrf_update_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_potrf_update_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_potrf_update_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_potrf_update_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
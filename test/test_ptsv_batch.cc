@@ -0,0 +1,223 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "check_gtsv.hh"
+
+#include <algorithm>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_ptsv_batch_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    lapack::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t batch = params.batch();
+    int64_t lanes = params.lanes();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.rate();
+    params.ref_time();
+    params.ref_rate();
+    params.error2();
+    params.error2.name( "trs error" );
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t n1 = blas::max( 0, n-1 );
+    int64_t strideD = roundup( blas::max( 1, n ), align );
+    int64_t ldb = roundup( blas::max( 1, n ), align );
+    int64_t strideB = ldb * nrhs;
+    size_t size_D = (size_t) strideD * batch;
+    size_t size_B = (size_t) strideB * batch;
+
+    std::vector< real_t > D( size_D );
+    std::vector< scalar_t > E( size_D );
+    std::vector< scalar_t > B( size_B );
+
+    // D in [3, 4] with |E| <= sqrt(2) makes A diagonally dominant,
+    // hence positive definite.
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, D.size(), &D[0] );
+    for (auto& d : D)
+        d += 3;
+    idist = 2;
+    lapack::larnv( idist, iseed, E.size(), &E[0] );
+    lapack::larnv( idist, iseed, B.size(), &B[0] );
+
+    std::vector< real_t > D_tst = D, D_ref = D;
+    std::vector< scalar_t > E_tst = E, E_ref = E;
+    std::vector< scalar_t > B_tst = B, B_ref = B;
+    std::vector< int64_t > info_tst( batch );
+
+    // Interleaved copies; lanes == 0 tests the strided form.
+    int64_t nblocks = lanes > 0 ? (batch + lanes - 1) / lanes : 0;
+    std::vector< real_t > D_int;
+    std::vector< scalar_t > E_int, B_int;
+    if (lanes > 0) {
+        D_int.resize( blas::max( 1, nblocks * n*lanes ) );
+        E_int.resize( blas::max( 1, nblocks * n1*lanes ) );
+        B_int.resize( blas::max( 1, nblocks * n*nrhs*lanes ) );
+        lapack::batch_interleave( n,  1, &D[0], strideD, strideD, batch, &D_int[0], lanes );
+        lapack::batch_interleave( n1, 1, &E[0], strideD, strideD, batch, &E_int[0], lanes );
+        lapack::batch_interleave( n, nrhs, &B[0], ldb, strideB, batch, &B_int[0], lanes );
+    }
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A n=%5lld, nrhs=%5lld, batch=%5lld, lanes=%3lld, threads=%d\n",
+                llong( n ), llong( nrhs ), llong( batch ), llong( lanes ),
+                lapack::get_num_threads() );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::ptsv_batch( -1, nrhs, &D_tst[0], &E_tst[0], strideD, &B_tst[0], ldb, strideB, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::ptsv_batch(  n,   -1, &D_tst[0], &E_tst[0], strideD, &B_tst[0], ldb, strideB, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::ptsv_batch(  n, nrhs, &D_tst[0], &E_tst[0],     n-1, &B_tst[0], ldb, strideB, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::ptsv_batch(  n, nrhs, &D_tst[0], &E_tst[0], strideD, &B_tst[0], n-1, strideB, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::ptsv_batch(  n, nrhs, &D_tst[0], &E_tst[0], strideD, &B_tst[0], ldb, strideB,    -1, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::ptsv_batch_interleaved( n, nrhs, &D_tst[0], &E_tst[0], &B_tst[0], 0, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::pttrs_batch( lapack::Uplo(0), n, nrhs, &D_tst[0], &E_tst[0], strideD, &B_tst[0], ldb, strideB, batch ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    int64_t nfailed;
+    if (lanes > 0) {
+        nfailed = lapack::ptsv_batch_interleaved(
+            n, nrhs, &D_int[0], &E_int[0], &B_int[0],
+            lanes, batch, &info_tst[0] );
+    }
+    else {
+        nfailed = lapack::ptsv_batch(
+            n, nrhs, &D_tst[0], &E_tst[0], strideD,
+            &B_tst[0], ldb, strideB, batch, &info_tst[0] );
+    }
+    time = testsweeper::get_wtime() - time;
+    if (nfailed != 0) {
+        fprintf( stderr, "lapack::ptsv_batch returned %lld non-positive definite matrices\n",
+                 llong( nfailed ) );
+    }
+
+    params.time() = time;
+    params.rate() = batch / time;
+
+    if (params.check() == 'y' || params.ref() == 'y') {
+        // ---------- run reference: lapack::ptsv in a loop
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        for (int64_t i = 0; i < batch; ++i) {
+            lapack::ptsv( n, nrhs, &D_ref[ i*strideD ], &E_ref[ i*strideD ],
+                          &B_ref[ i*strideB ], ldb );
+        }
+        time = testsweeper::get_wtime() - time;
+
+        params.ref_time() = time;
+        params.ref_rate() = batch / time;
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        if (lanes > 0) {
+            lapack::batch_deinterleave( n, nrhs, &B_int[0], lanes, batch,
+                                        &B_tst[0], ldb, strideB );
+        }
+
+        // Backward error of each solution, with the original A and B.
+        real_t error = 0;
+        for (int64_t i = 0; i < batch; ++i) {
+            error = std::max( error, check_ptsv(
+                n, nrhs, &D[ i*strideD ], &E[ i*strideD ],
+                &B_tst[ i*strideB ], ldb, &B[ i*strideB ], ldb ) );
+        }
+
+        // Factor A = L D L^H with pttrf_batch, then solve with
+        // pttrs_batch in the same layout. For uplo = Upper, pttrs takes
+        // the super-diagonal of U = L^H, which is conj( E ).
+        D_tst = D;
+        E_tst = E;
+        B_tst = B;
+        if (lanes > 0) {
+            lapack::batch_interleave( n,  1, &D[0], strideD, strideD, batch, &D_int[0], lanes );
+            lapack::batch_interleave( n1, 1, &E[0], strideD, strideD, batch, &E_int[0], lanes );
+            lapack::batch_interleave( n, nrhs, &B[0], ldb, strideB, batch, &B_int[0], lanes );
+            lapack::pttrf_batch_interleaved(
+                n, &D_int[0], &E_int[0], lanes, batch, &info_tst[0] );
+            if (uplo == lapack::Uplo::Upper) {
+                for (auto& e : E_int)
+                    e = blas::conj( e );
+            }
+            lapack::pttrs_batch_interleaved(
+                uplo, n, nrhs, &D_int[0], &E_int[0], &B_int[0], lanes, batch );
+            lapack::batch_deinterleave( n, nrhs, &B_int[0], lanes, batch,
+                                        &B_tst[0], ldb, strideB );
+        }
+        else {
+            lapack::pttrf_batch(
+                n, &D_tst[0], &E_tst[0], strideD, batch, &info_tst[0] );
+            if (uplo == lapack::Uplo::Upper) {
+                for (auto& e : E_tst)
+                    e = blas::conj( e );
+            }
+            lapack::pttrs_batch(
+                uplo, n, nrhs, &D_tst[0], &E_tst[0], strideD,
+                &B_tst[0], ldb, strideB, batch );
+        }
+        real_t error2 = 0;
+        for (int64_t i = 0; i < batch; ++i) {
+            error2 = std::max( error2, check_ptsv(
+                n, nrhs, &D[ i*strideD ], &E[ i*strideD ],
+                &B_tst[ i*strideB ], ldb, &B[ i*strideB ], ldb ) );
+        }
+
+        params.error() = error;
+        params.error2() = error2;
+        params.okay() = (error < tol) && (error2 < tol) && (nfailed == 0);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_ptsv_batch( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_ptsv_batch_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_ptsv_batch_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_ptsv_batch_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_ptsv_batch_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
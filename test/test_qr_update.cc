@@ -0,0 +1,232 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Returns || A - Q R ||_1 / (m || A ||_1) + || I - Q^H Q ||_1 / m,
+// for m-by-m Q and m-by-n R, also checking that R is upper trapezoidal.
+template< typename scalar_t >
+blas::real_type< scalar_t > qr_update_error(
+    int64_t m, int64_t n,
+    scalar_t const* A, int64_t lda,
+    scalar_t const* Q, int64_t ldq,
+    scalar_t const* R, int64_t ldr )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    if (m == 0)
+        return 0;
+
+    std::vector< scalar_t > E( m*blas::max( 1, n ) );
+    lapack::lacpy( lapack::MatrixType::General, m, n, A, lda, &E[0], m );
+    blas::gemm( blas::Layout::ColMajor, blas::Op::NoTrans, blas::Op::NoTrans,
+                m, n, m,
+                -1.0, Q, ldq,
+                      R, ldr,
+                 1.0, &E[0], m );
+    real_t Anorm = lapack::lange( lapack::Norm::One, m, n, A, lda );
+    real_t error = lapack::lange( lapack::Norm::One, m, n, &E[0], m );
+    error = (Anorm > 0 ? error / (m * Anorm) : error);
+
+    std::vector< scalar_t > I( m*m );
+    lapack::laset( lapack::MatrixType::General, m, m, 0.0, 1.0, &I[0], m );
+    blas::herk( blas::Layout::ColMajor, blas::Uplo::Upper, blas::Op::ConjTrans,
+                m, m, -1.0, Q, ldq, 1.0, &I[0], m );
+    error += lapack::lanhe( lapack::Norm::One, lapack::Uplo::Upper, m, &I[0], m ) / m;
+
+    // Entries below the diagonal of R must be exactly zero.
+    for (int64_t j = 0; j < n; ++j) {
+        for (int64_t i = j+1; i < m; ++i) {
+            if (R[ i + j*ldr ] != scalar_t( 0 ))
+                return std::numeric_limits< real_t >::infinity();
+        }
+    }
+    return error;
+}
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_qr_update_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.speedup();
+    params.error.name( "insert col" );
+    params.error2();
+    params.error2.name( "delete col" );
+    params.error3();
+    params.error3.name( "insert row" );
+    params.error4();
+    params.error4.name( "delete row" );
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    // Arrays have room for one more row and column.
+    int64_t ld = roundup( m+1, align );
+    size_t size = (size_t) ld * (blas::max( m, n ) + 1);
+    int64_t minmn = blas::min( m, n );
+
+    std::vector< scalar_t > A( size );
+    std::vector< scalar_t > A_up( size );
+    std::vector< scalar_t > Q( size );
+    std::vector< scalar_t > R( size );
+    std::vector< scalar_t > tau( blas::max( 1, minmn ) );
+    std::vector< scalar_t > x( m+1 );
+    std::vector< scalar_t > y( n+1 );
+
+    lapack::generate_matrix( params.matrix, m, n, &A[0], ld );
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, x.size(), &x[0] );
+    lapack::larnv( idist, iseed, y.size(), &y[0] );
+
+    // Full QR factorization of A: R from geqrf, Q m-by-m from ungqr.
+    R = A;
+    if (minmn > 0)
+        lapack::geqrf( m, n, &R[0], ld, &tau[0] );
+    lapack::laset( lapack::MatrixType::General, m, m, 0.0, 0.0, &Q[0], ld );
+    lapack::lacpy( lapack::MatrixType::Lower, m, minmn, &R[0], ld, &Q[0], ld );
+    if (m > 0)
+        lapack::ungqr( m, m, minmn, &Q[0], ld, &tau[0] );
+    for (int64_t j = 0; j < n; ++j) {
+        for (int64_t i = j+1; i < m; ++i)
+            R[ i + j*ld ] = 0;
+    }
+
+    // Insert and delete in the middle.
+    int64_t j = n/2 + 1;
+    int64_t i = m/2 + 1;
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A m=%5lld, n=%5lld, ld=%5lld, j=%lld, i=%lld\n",
+                llong( m ), llong( n ), llong( ld ), llong( j ), llong( i ) );
+    }
+    if (verbose >= 2) {
+        printf( "A = " ); print_matrix( m, n, &A[0], ld );
+        printf( "Q = " ); print_matrix( m, m, &Q[0], ld );
+        printf( "R = " ); print_matrix( m, n, &R[0], ld );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::qr_insert_col( -1, n,   j, &Q[0], ld, &R[0], ld, &x[0], 1 ), lapack::Error );
+        assert_throw( lapack::qr_insert_col(  m, n, n+2, &Q[0], ld, &R[0], ld, &x[0], 1 ), lapack::Error );
+        assert_throw( lapack::qr_insert_col(  m, n,   j, &Q[0], ld, &R[0], ld, &x[0], 0 ), lapack::Error );
+        assert_throw( lapack::qr_delete_col(  m, n,   0, &Q[0], ld, &R[0], ld ), lapack::Error );
+        assert_throw( lapack::qr_insert_row(  m, n,   i, &Q[0], m,  &R[0], ld, &y[0], 1 ), lapack::Error );
+        assert_throw( lapack::qr_insert_row(  m, n, m+2, &Q[0], ld, &R[0], ld, &y[0], 1 ), lapack::Error );
+        assert_throw( lapack::qr_delete_row(  m, n,   i, (scalar_t*) nullptr, ld, &R[0], ld ), lapack::Error );
+        assert_throw( lapack::qr_delete_row(  0, n,   1, &Q[0], ld, &R[0], ld ), lapack::Error );
+    }
+
+    // A_up = [ A(:, 1:j-1), x, A(:, j:n) ]
+    lapack::lacpy( lapack::MatrixType::General, m, j-1, &A[0], ld, &A_up[0], ld );
+    blas::copy( m, &x[0], 1, &A_up[ (j-1)*ld ], 1 );
+    lapack::lacpy( lapack::MatrixType::General, m, n-j+1,
+                   &A[ (j-1)*ld ], ld, &A_up[ j*ld ], ld );
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    lapack::qr_insert_col( m, n, j, &Q[0], ld, &R[0], ld, &x[0], 1 );
+    time = testsweeper::get_wtime() - time;
+
+    params.time() = time;
+
+    if (verbose >= 2) {
+        printf( "Q_up = " ); print_matrix( m, m, &Q[0], ld );
+        printf( "R_up = " ); print_matrix( m, n+1, &R[0], ld );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        real_t error = qr_update_error( m, n+1, &A_up[0], ld, &Q[0], ld, &R[0], ld );
+
+        // Deleting column j again should give a factorization of A.
+        lapack::qr_delete_col( m, n+1, j, &Q[0], ld, &R[0], ld );
+        real_t error2 = qr_update_error( m, n, &A[0], ld, &Q[0], ld, &R[0], ld );
+
+        // Insert y^T as row i of A.
+        lapack::qr_insert_row( m, n, i, &Q[0], ld, &R[0], ld, &y[0], 1 );
+        std::vector< scalar_t > A_row( size );
+        lapack::lacpy( lapack::MatrixType::General, i-1, n, &A[0], ld, &A_row[0], ld );
+        blas::copy( n, &y[0], 1, &A_row[ i-1 ], ld );
+        lapack::lacpy( lapack::MatrixType::General, m-i+1, n,
+                       &A[ i-1 ], ld, &A_row[ i ], ld );
+        real_t error3 = qr_update_error( m+1, n, &A_row[0], ld, &Q[0], ld, &R[0], ld );
+
+        // Deleting row i again should give a factorization of A.
+        lapack::qr_delete_row( m+1, n, i, &Q[0], ld, &R[0], ld );
+        real_t error4 = qr_update_error( m, n, &A[0], ld, &Q[0], ld, &R[0], ld );
+
+        params.error() = error;
+        params.error2() = error2;
+        params.error3() = error3;
+        params.error4() = error4;
+        params.okay() = (error < tol) && (error2 < tol)
+                        && (error3 < tol) && (error4 < tol);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference: refactor [ A x ] with lapack::geqrf
+        int64_t minmn1 = blas::min( m, n+1 );
+        std::vector< scalar_t > tau_ref( blas::max( 1, minmn1 ) );
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        if (minmn1 > 0)
+            lapack::geqrf( m, n+1, &A_up[0], ld, &tau_ref[0] );
+        time = testsweeper::get_wtime() - time;
+
+        params.ref_time() = time;
+        params.speedup() = params.ref_time() / params.time();
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_qr_update( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_qr_update_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_qr_update_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_qr_update_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_qr_update_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
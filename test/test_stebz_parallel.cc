@@ -0,0 +1,149 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_stebz_parallel_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t n = params.dim.n();
+    int64_t threads = params.threads();
+    int64_t verbose = params.verbose();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    real_t  vl;  // = params.vl();
+    real_t  vu;  // = params.vu();
+    int64_t il;  // = params.il();
+    int64_t iu;  // = params.iu();
+    lapack::Range range;  // derived from vl,vu,il,iu
+    params.get_range( n, &range, &vl, &vu, &il, &iu );
+
+    // mark non-standard output values
+    params.ref_time();
+    params.speedup();
+
+    if (! run)
+        return;
+
+    // Sweeping --threads 1,2,4,... reports the scaling; the reference is
+    // sequential stevx, so speedup = ref_time / time.
+    int threads_save = lapack::get_num_threads();
+    if (threads > 0)
+        lapack::set_num_threads( threads );
+
+    // ---------- setup
+    real_t abstol = 0;  // default value
+    int64_t nfound;
+    int64_t nfound_ref;
+
+    std::vector< real_t > D( n ), E( blas::max( 1, n-1 ) );
+    std::vector< real_t > Lambda_tst( n );
+    std::vector< real_t > Lambda_ref( n );
+    std::vector< real_t > Z( 1 );
+    std::vector< int64_t > ifail( n );
+
+    int64_t idist = 2;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, D.size(), &D[0] );
+    lapack::larnv( idist, iseed, E.size(), &E[0] );
+    std::vector< real_t > D_ref = D, E_ref = E;
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "T n=%5lld, range=%c, il=%lld, iu=%lld, threads=%d\n",
+                llong( n ), to_char( range ), llong( il ), llong( iu ),
+                lapack::get_num_threads() );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::stebz_parallel( lapack::Range(0), n, &D[0], &E[0], vl, vu, il, iu, abstol, &nfound, &Lambda_tst[0] ), lapack::Error );
+        assert_throw( lapack::stebz_parallel( range, -1, &D[0], &E[0], vl, vu, il, iu, abstol, &nfound, &Lambda_tst[0] ), lapack::Error );
+        assert_throw( lapack::stebz_parallel( lapack::Range::Value, n, &D[0], &E[0], 1, 0, il, iu, abstol, &nfound, &Lambda_tst[0] ), lapack::Error );
+        assert_throw( lapack::stebz_parallel( lapack::Range::Index, n, &D[0], &E[0], vl, vu, 0, iu, abstol, &nfound, &Lambda_tst[0] ), lapack::Error );
+        assert_throw( lapack::stebz_parallel( lapack::Range::Index, n, &D[0], &E[0], vl, vu, il, n+1, abstol, &nfound, &Lambda_tst[0] ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    int64_t info_tst = lapack::stebz_parallel(
+        range, n, &D[0], &E[0], vl, vu, il, iu, abstol,
+        &nfound, &Lambda_tst[0] );
+    time = testsweeper::get_wtime() - time;
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::stebz_parallel returned error %lld\n", llong( info_tst ) );
+    }
+
+    params.time() = time;
+
+    if (verbose >= 2) {
+        printf( "nfound = %lld\n", llong( nfound ) );
+        printf( "Lambda = " );
+        print_vector( nfound, &Lambda_tst[0], 1 );
+    }
+
+    if (params.check() == 'y' || params.ref() == 'y') {
+        // ---------- run reference: sequential lapack::stevx
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = lapack::stevx(
+            lapack::Job::NoVec, range, n, &D_ref[0], &E_ref[0],
+            vl, vu, il, iu, abstol, &nfound_ref,
+            &Lambda_ref[0], &Z[0], 1, &ifail[0] );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "lapack::stevx returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+        params.speedup() = params.ref_time() / params.time();
+
+        if (verbose >= 2) {
+            printf( "Lambda_ref = " );
+            print_vector( nfound_ref, &Lambda_ref[0], 1 );
+        }
+
+        // ---------- check error compared to reference
+        real_t error = rel_error( Lambda_tst, Lambda_ref );
+        if (info_tst != info_ref) {
+            error = 1;
+        }
+        error += std::abs( nfound - nfound_ref );
+        params.error() = error;
+        params.okay() = (error < tol);
+    }
+
+    lapack::set_num_threads( threads_save );
+}
+
+// -----------------------------------------------------------------------------
+void test_stebz_parallel( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_stebz_parallel_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_stebz_parallel_work< double >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unsupported datatype" );
+            break;
+    }
+}
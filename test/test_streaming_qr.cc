@@ -0,0 +1,180 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+#include "check_gels.hh"
+
+#include <vector>
+
+#if LAPACK_VERSION >= 30400  // >= 3.4.0
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_streaming_qr_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t nb = params.nb();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.error2();
+    params.error2.name( "remove error" );
+
+    if (! run)
+        return;
+
+    if (m < n || nb < 1) {
+        printf( "skipping because streaming_qr requires m >= n and nb >= 1\n" );
+        return;
+    }
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, m ), align );
+    int64_t ldb = roundup( blas::max( 1, m ), align );
+    int64_t ldx = roundup( blas::max( 1, n ), align );
+    size_t size_A = (size_t) lda * n;
+    size_t size_B = (size_t) ldb * nrhs;
+    size_t size_X = (size_t) ldx * nrhs;
+
+    std::vector< scalar_t > A( size_A );
+    std::vector< scalar_t > B( size_B );
+    std::vector< scalar_t > X( size_X );
+
+    lapack::generate_matrix( params.matrix, m, n, &A[0], lda );
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, B.size(), &B[0] );
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A m=%5lld, n=%5lld, lda=%5lld, nrhs=%5lld, nb=%5lld\n",
+                llong( m ), llong( n ), llong( lda ), llong( nrhs ),
+                llong( nb ) );
+    }
+
+    lapack::StreamingQR< scalar_t > ls( n, nrhs );
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::StreamingQR< scalar_t >( -1, nrhs ), lapack::Error );
+        assert_throw( lapack::StreamingQR< scalar_t >(  n,   -1 ), lapack::Error );
+        assert_throw( lapack::StreamingQR< scalar_t >(  n, nrhs, 0 ), lapack::Error );
+        assert_throw( lapack::StreamingQR< scalar_t >(  n, nrhs, 2 ), lapack::Error );
+        assert_throw( ls.add_rows( -1, &A[0], lda, &B[0], ldb ), lapack::Error );
+        assert_throw( ls.add_rows(  m, &A[0], m-1, &B[0], ldb ), lapack::Error );
+        assert_throw( ls.add_rows(  m, &A[0], lda, &B[0], m-1 ), lapack::Error );
+        assert_throw( ls.solve( &X[0], n-1 ), lapack::Error );
+    }
+
+    // ---------- run test
+    // Stream A and B in blocks of nb rows, then solve.
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    for (int64_t i = 0; i < m; i += nb) {
+        int64_t ib = blas::min( nb, m - i );
+        ls.add_rows( ib, &A[ i ], lda, &B[ i ], ldb );
+    }
+    int64_t info_tst = ls.solve( &X[0], ldx );
+    time = testsweeper::get_wtime() - time;
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::StreamingQR::solve returned error %lld\n", llong( info_tst ) );
+    }
+
+    params.time() = time;
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Residual orthogonal to A, as for gels.
+        real_t error[2];
+        check_gels( false, lapack::Op::NoTrans, m, n, nrhs,
+                    &A[0], lda, &X[0], ldx, &B[0], ldb, error );
+        params.error() = error[0];
+        params.okay() = (error[0] < tol) && (ls.rows() == m);
+
+        // Downdate the first block, if enough rows remain, and check
+        // the solution for the remaining rows.
+        int64_t mr = m - blas::min( nb, m );
+        if (mr >= n && n > 0) {
+            int64_t info_rm = ls.remove_rows( m - mr, &A[0], lda, &B[0], ldb );
+            if (info_rm != 0) {
+                fprintf( stderr, "lapack::StreamingQR::remove_rows returned error %lld\n",
+                         llong( info_rm ) );
+            }
+            ls.solve( &X[0], ldx );
+            check_gels( false, lapack::Op::NoTrans, mr, n, nrhs,
+                        &A[ m - mr ], lda, &X[0], ldx, &B[ m - mr ], ldb, error );
+            params.error2() = error[0];
+            params.okay() = params.okay() && (error[0] < tol)
+                            && (info_rm == 0) && (ls.rows() == mr);
+        }
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference: gels with all rows at once
+        std::vector< scalar_t > A_ref = A;
+        std::vector< scalar_t > B_ref = B;
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = lapack::gels( lapack::Op::NoTrans, m, n, nrhs,
+                                         &A_ref[0], lda, &B_ref[0], ldb );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "lapack::gels returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_streaming_qr( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_streaming_qr_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_streaming_qr_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_streaming_qr_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_streaming_qr_work< std::complex<double> >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unknown datatype" );
+            break;
+    }
+}
+
+#else
+
+// -----------------------------------------------------------------------------
+void test_streaming_qr( Params& params, bool run )
+{
+    fprintf( stderr, "streaming_qr requires LAPACK >= 3.4.0\n\n" );
+    exit(0);
+}
+
+#endif  // LAPACK >= 3.4.0
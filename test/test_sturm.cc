@@ -192,6 +192,31 @@ void test_sturm_work( Params& params, bool run )
         ++error;
     }
 
+    // The multi-shift sturm must give the same counts.
+    std::vector< scalar_t > shifts = {
+        eig_min_before, eig_min_after, eig_mid_before,
+        eig_mid_after,  eig_max_before, eig_max_after };
+    std::vector< int64_t > counts( shifts.size() );
+    std::vector< int64_t > counts_ref = {
+        r_min_before, r_min_after, r_mid_before,
+        r_mid_after,  r_max_before, r_max_after };
+    lapack::sturm( n, &diag[0], &offd[0], shifts.size(), &shifts[0],
+                   &counts[0] );
+
+    if (verbose >= 2) {
+        printf( "\n"
+                "multi-shift counts:" );
+        for (auto c : counts)
+            printf( " %lld", llong( c ) );
+        printf( "\n" );
+    }
+
+    for (size_t j = 0; j < counts.size(); ++j) {
+        if (counts[ j ] != counts_ref[ j ]) {
+            ++error;
+        }
+    }
+
     time = testsweeper::get_wtime() - time;
 
     params.ref_time() = time;